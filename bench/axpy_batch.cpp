@@ -0,0 +1,100 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// USM saxpy_batch on the host device across batch sizes and vector lengths:
+//  the strided API, the group API with the same vectors given as pointers, and
+//  the group API with a skewed batch, where one vector holds half of the
+//  elements and the rest are spread over the others.
+
+#include <CL/sycl.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "bench_common.hpp"
+#include "onemkl/onemkl.hpp"
+
+// Largest number of elements of one batched operand.
+static const std::int64_t max_elements = std::int64_t(1) << 26;
+
+int main() {
+    cl::sycl::device dev((cl::sycl::host_selector()));
+    cl::sycl::queue queue(dev);
+    auto ctx = queue.get_context();
+    float *x = (float *)cl::sycl::malloc_shared(max_elements * sizeof(float), dev, ctx);
+    float *y = (float *)cl::sycl::malloc_shared(max_elements * sizeof(float), dev, ctx);
+    std::fill(x, x + max_elements, 1.0f);
+    std::fill(y, y + max_elements, 1.0f);
+    onemkl::blas::warmup(queue);
+
+    std::vector<cl::sycl::event> dependencies;
+    std::printf("%8s %10s %16s %16s %16s\n", "n", "batch", "strided [us]", "pointers [us]",
+                "skewed [us]");
+    for (std::int64_t n : { 16, 256, 4096, 65536 }) {
+        for (std::int64_t batch = 10; batch <= 1000000; batch *= 10) {
+            if (batch * n > max_elements)
+                break;
+            int reps = (int)std::max<std::int64_t>(3, 10000000 / (batch * n));
+
+            std::vector<const float *> x_array(batch), x_skewed(batch);
+            std::vector<float *> y_array(batch), y_skewed(batch);
+            for (std::int64_t i = 0; i < batch; i++) {
+                x_array[i] = x + i * n;
+                y_array[i] = y + i * n;
+            }
+            std::int64_t long_n = batch * n / 2, short_n = n / 2;
+            x_skewed[0]         = x;
+            y_skewed[0]         = y;
+            for (std::int64_t i = 1; i < batch; i++) {
+                x_skewed[i] = x + long_n + (i - 1) * short_n;
+                y_skewed[i] = y + long_n + (i - 1) * short_n;
+            }
+
+            auto strided = [&]() {
+                onemkl::blas::axpy_batch(queue, n, 1.0f, x, 1, n, y, 1, n, batch, dependencies)
+                    .wait();
+            };
+            auto pointers = [&]() {
+                float alpha       = 1.0f;
+                std::int64_t size = n, inc = 1;
+                onemkl::blas::axpy_batch(queue, &size, &alpha, x_array.data(), &inc,
+                                         y_array.data(), &inc, 1, &batch, dependencies)
+                    .wait();
+            };
+            auto skewed = [&]() {
+                float alpha[2]         = { 1.0f, 1.0f };
+                std::int64_t size[2]   = { long_n, short_n }, inc[2] = { 1, 1 };
+                std::int64_t groups[2] = { 1, batch - 1 };
+                onemkl::blas::axpy_batch(queue, size, alpha, x_skewed.data(), inc,
+                                         y_skewed.data(), inc, 2, groups, dependencies)
+                    .wait();
+            };
+
+            std::printf("%8lld %10lld %16.1f %16.1f %16.1f\n", (long long)n, (long long)batch,
+                        bench::median(bench::sample_ns(strided, reps, 5)) / 1000.0,
+                        bench::median(bench::sample_ns(pointers, reps, 5)) / 1000.0,
+                        bench::median(bench::sample_ns(skewed, reps, 5)) / 1000.0);
+        }
+    }
+
+    cl::sycl::free(x, ctx);
+    cl::sycl::free(y, ctx);
+    return 0;
+}
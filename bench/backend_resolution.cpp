@@ -0,0 +1,84 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Per-call cost of resolving the backend for a queue: the device query chain
+//  that select_backend() goes through, against the device-keyed and the
+//  per-thread queue caches the loader consults. A run-time API USM axpy with n = 1 is reported for scale.
+
+#include <CL/sycl.hpp>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "bench_common.hpp"
+#include "include/device_cache.hpp"
+#include "onemkl/onemkl.hpp"
+
+static const char *volatile sink;
+
+static void run(cl::sycl::device &dev) {
+    cl::sycl::queue queue(dev);
+    typedef onemkl::device_cache<const char *> cache_t;
+
+    auto uncached = bench::sample_ns([&]() { sink = onemkl::select_backend(queue); }, 100000);
+
+    cache_t cache;
+    cache.insert(queue.get_device(), onemkl::select_backend(queue));
+    auto cached = bench::sample_ns(
+        [&]() {
+            const char *lib = nullptr;
+            cache.find(queue.get_device(), lib);
+            sink = lib;
+        },
+        100000);
+
+    onemkl::queue_cache<const char *> queues;
+    queues.insert(queue, onemkl::select_backend(queue));
+    auto per_queue = bench::sample_ns(
+        [&]() {
+            const char *lib = nullptr;
+            queues.find(queue, lib);
+            sink = lib;
+        },
+        100000);
+
+    auto ctx = queue.get_context();
+    float *x = (float *)cl::sycl::malloc_shared(sizeof(float), dev, ctx);
+    float *y = (float *)cl::sycl::malloc_shared(sizeof(float), dev, ctx);
+    x[0] = y[0] = 1.0f;
+    std::vector<cl::sycl::event> dependencies;
+    auto end_to_end = bench::sample_ns(
+        [&]() { onemkl::blas::axpy(queue, 1, 1.0f, x, 1, y, 1, dependencies).wait(); }, 2000);
+    cl::sycl::free(x, ctx);
+    cl::sycl::free(y, ctx);
+
+    std::printf("%-40s %16.1f %16.1f %16.1f %16.1f\n", bench::device_name(dev).c_str(),
+                bench::median(uncached), bench::median(cached), bench::median(per_queue),
+                bench::median(end_to_end));
+}
+
+int main() {
+    std::printf("%-40s %16s %16s %16s %16s\n", "device", "select_backend", "device cache",
+                "queue cache", "axpy n=1");
+    std::printf("%-40s %16s %16s %16s %16s\n", "", "[ns/call]", "[ns/call]", "[ns/call]",
+                "[ns/call]");
+    for (auto &dev : bench::cpu_devices())
+        run(dev);
+    return 0;
+}
@@ -0,0 +1,395 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// onemkl_blas_bench: sweeps level 1, 2 and 3, batch and extension routines
+//  over precisions, transposes, leading dimensions and sizes, through both the
+//  run-time and the compile-time (mklcpu) API and with both buffers and USM.
+//  Every case reports median and p99 latency, GFLOPS and GB/s as JSON.
+//
+//  onemkl_blas_bench [--device host|cpu] [--quick] [--filter <substring>]
+//                    [--output <file>] [--baseline <file> [--threshold <fraction>]]
+//
+//  With --baseline, the cases are compared with a previous report by name and
+//  those slower than the baseline median by more than the threshold (0.10 by
+//  default) are reported on stderr and flagged in the JSON; the exit status is
+//  then 1 if there is any regression.
+
+#include <CL/sycl.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "bench_common.hpp"
+#include "bench_report.hpp"
+#include "onemkl/onemkl.hpp"
+
+enum class api_kind { rt, ct };
+
+// Calls onemkl::blas::func through the run-time dispatching API or through
+//  the compile-time API of the mklcpu backend.
+#define BLAS_CALL(api, func, ...)                                                      \
+    ((api) == api_kind::rt                                                             \
+         ? onemkl::blas::func(__VA_ARGS__)                                             \
+         : onemkl::blas::func<onemkl::library::intelmkl, onemkl::backend::intelcpu>( \
+               __VA_ARGS__))
+
+// Operand storage with the same interface for both memory models: data()
+//  is what the BLAS call takes, a USM pointer or a buffer.
+template <typename fp>
+class usm_array {
+public:
+    usm_array(cl::sycl::queue &queue, std::int64_t count, fp value)
+            : context(queue.get_context()) {
+        p = (fp *)cl::sycl::malloc_shared(count * sizeof(fp), queue.get_device(), context);
+        std::fill(p, p + count, value);
+    }
+    usm_array(const usm_array &) = delete;
+    usm_array &operator=(const usm_array &) = delete;
+    ~usm_array() {
+        cl::sycl::free(p, context);
+    }
+
+    void set_diagonal(std::int64_t n, std::int64_t ld, fp value) {
+        for (std::int64_t i = 0; i < n; i++)
+            p[i * (ld + 1)] = value;
+    }
+    fp *data() {
+        return p;
+    }
+    static const char *name() {
+        return "usm";
+    }
+
+private:
+    cl::sycl::context context;
+    fp *p;
+};
+
+template <typename fp>
+class buffer_array {
+public:
+    buffer_array(cl::sycl::queue &, std::int64_t count, fp value)
+            : buf(cl::sycl::range<1>(count)) {
+        auto acc = buf.template get_access<cl::sycl::access::mode::discard_write>();
+        for (std::int64_t i = 0; i < count; i++)
+            acc[i] = value;
+    }
+
+    void set_diagonal(std::int64_t n, std::int64_t ld, fp value) {
+        auto acc = buf.template get_access<cl::sycl::access::mode::read_write>();
+        for (std::int64_t i = 0; i < n; i++)
+            acc[i * (ld + 1)] = value;
+    }
+    cl::sycl::buffer<fp, 1> &data() {
+        return buf;
+    }
+    static const char *name() {
+        return "buffer";
+    }
+
+private:
+    cl::sycl::buffer<fp, 1> buf;
+};
+
+template <typename fp>
+const char *precision_name();
+template <>
+const char *precision_name<float>() {
+    return "s";
+}
+template <>
+const char *precision_name<double>() {
+    return "d";
+}
+
+static const char *trans_name(onemkl::transpose trans) {
+    return trans == onemkl::transpose::nontrans ? "N" : "T";
+}
+
+struct suite {
+    cl::sycl::queue queue;
+    bool quick = false;
+    std::string filter;
+    std::vector<bench::record> records;
+
+    suite(const cl::sycl::device &dev) : queue(dev) {}
+
+    bench::record make(const char *routine, api_kind api, const char *memory,
+                       const char *precision, const std::string &trans, std::int64_t m,
+                       std::int64_t n, std::int64_t k, std::int64_t ld,
+                       std::int64_t batch = 1) {
+        bench::record r;
+        r.routine   = routine;
+        r.api       = api == api_kind::rt ? "rt" : "ct";
+        r.memory    = memory;
+        r.precision = precision;
+        r.trans     = trans;
+        r.m         = m;
+        r.n         = n;
+        r.k         = k;
+        r.ld        = ld;
+        r.batch     = batch;
+        char name[256];
+        std::snprintf(name, sizeof(name), "%s/%s/%s/%s/%s/%lldx%lldx%lld/ld%lld/b%lld", routine,
+                      r.api.c_str(), memory, precision, trans.c_str(), (long long)m,
+                      (long long)n, (long long)k, (long long)ld, (long long)batch);
+        r.name = name;
+        return r;
+    }
+
+    bool selected(const bench::record &r) const {
+        return filter.empty() || r.name.find(filter) != std::string::npos;
+    }
+
+    // Times single calls of f(): the number of samples is chosen from a first
+    //  timed call so that every case takes about the same time, with at least
+    //  11 samples so that the median is stable.
+    template <typename F>
+    void run(bench::record r, double flops, double bytes, F f) {
+        f();
+        auto start = bench::clock::now();
+        f();
+        double once   = std::chrono::duration<double, std::nano>(bench::clock::now() - start)
+                          .count();
+        double budget = quick ? 2e7 : 2e8;
+        int samples   = (int)std::min(1001.0, std::max(11.0, budget / std::max(once, 1.0)));
+
+        std::vector<double> ns = bench::sample_ns(f, 1, samples);
+        r.median_ns            = bench::median(ns);
+        r.p99_ns               = bench::percentile(ns, 0.99);
+        r.gflops               = flops / r.median_ns;
+        r.gbps                 = bytes / r.median_ns;
+        std::fprintf(stderr, "%-64s %14.1f ns\n", r.name.c_str(), r.median_ns);
+        records.push_back(r);
+    }
+};
+
+template <typename fp, template <typename> class array>
+void bench_level1(suite &s, api_kind api, std::int64_t n) {
+    const char *memory = array<fp>::name(), *precision = precision_name<fp>();
+    double size        = sizeof(fp);
+
+    bench::record r = s.make("axpy", api, memory, precision, "-", 0, n, 0, 1);
+    if (s.selected(r)) {
+        array<fp> x(s.queue, n, fp(1)), y(s.queue, n, fp(0));
+        s.run(r, 2.0 * n, 3.0 * n * size, [&]() {
+            BLAS_CALL(api, axpy, s.queue, n, fp(0.5), x.data(), 1, y.data(), 1);
+            s.queue.wait();
+        });
+    }
+
+    r = s.make("dot", api, memory, precision, "-", 0, n, 0, 1);
+    if (s.selected(r)) {
+        array<fp> x(s.queue, n, fp(1)), y(s.queue, n, fp(0.5)), result(s.queue, 1, fp(0));
+        s.run(r, 2.0 * n, 2.0 * n * size, [&]() {
+            BLAS_CALL(api, dot, s.queue, n, x.data(), 1, y.data(), 1, result.data());
+            s.queue.wait();
+        });
+    }
+}
+
+template <typename fp, template <typename> class array>
+void bench_level2(suite &s, api_kind api, onemkl::transpose trans, std::int64_t n,
+                  std::int64_t ld) {
+    bench::record r = s.make("gemv", api, array<fp>::name(), precision_name<fp>(),
+                             trans_name(trans), n, n, 0, ld);
+    if (!s.selected(r))
+        return;
+    array<fp> a(s.queue, ld * n, fp(0.5)), x(s.queue, n, fp(1)), y(s.queue, n, fp(0));
+    s.run(r, 2.0 * n * n, (double)(n * n + 2 * n) * sizeof(fp), [&]() {
+        BLAS_CALL(api, gemv, s.queue, trans, n, n, fp(1), a.data(), ld, x.data(), 1, fp(0),
+                  y.data(), 1);
+        s.queue.wait();
+    });
+}
+
+template <typename fp, template <typename> class array>
+void bench_level3(suite &s, api_kind api, onemkl::transpose transa, onemkl::transpose transb,
+                  std::int64_t n, std::int64_t ld) {
+    const char *memory = array<fp>::name(), *precision = precision_name<fp>();
+    std::string trans  = std::string(trans_name(transa)) + trans_name(transb);
+    double size        = sizeof(fp);
+
+    bench::record r = s.make("gemm", api, memory, precision, trans, n, n, n, ld);
+    if (s.selected(r)) {
+        array<fp> a(s.queue, ld * n, fp(0.5)), b(s.queue, ld * n, fp(0.25)),
+            c(s.queue, ld * n, fp(0));
+        s.run(r, 2.0 * n * n * n, 4.0 * n * n * size, [&]() {
+            BLAS_CALL(api, gemm, s.queue, transa, transb, n, n, n, fp(1), a.data(), ld, b.data(),
+                      ld, fp(0), c.data(), ld);
+            s.queue.wait();
+        });
+    }
+
+    // trsm and gemmt use transa only, so they are measured once per transa.
+    if (transb != onemkl::transpose::nontrans)
+        return;
+    trans = trans_name(transa);
+
+    r = s.make("trsm", api, memory, precision, trans, n, n, 0, ld);
+    if (s.selected(r)) {
+        // A is the identity, so that repeated solves leave B unchanged.
+        array<fp> a(s.queue, ld * n, fp(0)), b(s.queue, ld * n, fp(1));
+        a.set_diagonal(n, ld, fp(1));
+        s.run(r, 1.0 * n * n * n, 2.5 * n * n * size, [&]() {
+            BLAS_CALL(api, trsm, s.queue, onemkl::side::left, onemkl::uplo::upper, transa,
+                      onemkl::diag::nonunit, n, n, fp(1), a.data(), ld, b.data(), ld);
+            s.queue.wait();
+        });
+    }
+
+    r = s.make("gemmt", api, memory, precision, trans, n, n, n, ld);
+    if (s.selected(r)) {
+        array<fp> a(s.queue, ld * n, fp(0.5)), b(s.queue, ld * n, fp(0.25)),
+            c(s.queue, ld * n, fp(0));
+        s.run(r, 1.0 * n * (n + 1) * n, (3.0 * n * n + n) * size, [&]() {
+            BLAS_CALL(api, gemmt, s.queue, onemkl::uplo::upper, transa,
+                      onemkl::transpose::nontrans, n, n, fp(1), a.data(), ld, b.data(), ld,
+                      fp(0), c.data(), ld);
+            s.queue.wait();
+        });
+    }
+}
+
+template <typename fp, template <typename> class array>
+void bench_batch(suite &s, api_kind api, onemkl::transpose transa, onemkl::transpose transb,
+                 std::int64_t n, std::int64_t ld) {
+    // About 2^20 elements per batched operand, whatever the matrix size.
+    std::int64_t batch  = std::max<std::int64_t>(1, (std::int64_t(1) << 20) / (n * n));
+    std::int64_t stride = ld * n;
+    std::string trans   = std::string(trans_name(transa)) + trans_name(transb);
+
+    bench::record r = s.make("gemm_batch", api, array<fp>::name(), precision_name<fp>(), trans, n,
+                             n, n, ld, batch);
+    if (!s.selected(r))
+        return;
+    array<fp> a(s.queue, stride * batch, fp(0.5)), b(s.queue, stride * batch, fp(0.25)),
+        c(s.queue, stride * batch, fp(0));
+    s.run(r, 2.0 * n * n * n * batch, 4.0 * n * n * batch * sizeof(fp), [&]() {
+        BLAS_CALL(api, gemm_batch, s.queue, transa, transb, n, n, n, fp(1), a.data(), ld, stride,
+                  b.data(), ld, stride, fp(0), c.data(), ld, stride, batch);
+        s.queue.wait();
+    });
+}
+
+template <typename fp, template <typename> class array>
+void bench_all(suite &s, api_kind api) {
+    const onemkl::transpose transposes[] = { onemkl::transpose::nontrans,
+                                             onemkl::transpose::trans };
+    // Leading dimensions are either tight or padded by 16 elements.
+    const std::int64_t pads[] = { 0, 16 };
+
+    std::vector<std::int64_t> level1_sizes = { 1 << 10, 1 << 16, 1 << 20 };
+    std::vector<std::int64_t> level2_sizes = { 128, 512, 2048 };
+    std::vector<std::int64_t> level3_sizes = { 64, 256, 1024 };
+    std::vector<std::int64_t> batch_sizes  = { 8, 32, 128 };
+    if (s.quick) {
+        level1_sizes.resize(1);
+        level2_sizes.resize(1);
+        level3_sizes.resize(1);
+        batch_sizes.resize(1);
+    }
+
+    for (std::int64_t n : level1_sizes)
+        bench_level1<fp, array>(s, api, n);
+    for (std::int64_t n : level2_sizes)
+        for (auto trans : transposes)
+            for (std::int64_t pad : pads)
+                bench_level2<fp, array>(s, api, trans, n, n + pad);
+    for (std::int64_t n : level3_sizes)
+        for (auto transa : transposes)
+            for (auto transb : transposes)
+                for (std::int64_t pad : pads)
+                    bench_level3<fp, array>(s, api, transa, transb, n, n + pad);
+    for (std::int64_t n : batch_sizes)
+        for (auto transa : transposes)
+            for (auto transb : transposes)
+                for (std::int64_t pad : pads)
+                    bench_batch<fp, array>(s, api, transa, transb, n, n + pad);
+}
+
+static int usage(const char *program) {
+    std::fprintf(stderr,
+                 "usage: %s [--device host|cpu] [--quick] [--filter <substring>]\n"
+                 "       [--output <file>] [--baseline <file> [--threshold <fraction>]]\n",
+                 program);
+    return 2;
+}
+
+int main(int argc, char **argv) {
+    std::string device = "host", output, baseline;
+    std::string filter;
+    double threshold = 0.10;
+    bool quick       = false;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--quick")
+            quick = true;
+        else if (i + 1 < argc && arg == "--device")
+            device = argv[++i];
+        else if (i + 1 < argc && arg == "--filter")
+            filter = argv[++i];
+        else if (i + 1 < argc && arg == "--output")
+            output = argv[++i];
+        else if (i + 1 < argc && arg == "--baseline")
+            baseline = argv[++i];
+        else if (i + 1 < argc && arg == "--threshold")
+            threshold = std::atof(argv[++i]);
+        else
+            return usage(argv[0]);
+    }
+    if (device != "host" && device != "cpu")
+        return usage(argv[0]);
+
+    cl::sycl::device dev = device == "host" ? cl::sycl::device(cl::sycl::host_selector())
+                                            : cl::sycl::device(cl::sycl::cpu_selector());
+    suite s(dev);
+    s.quick  = quick;
+    s.filter = filter;
+    onemkl::blas::warmup(s.queue);
+
+    for (api_kind api : { api_kind::rt, api_kind::ct }) {
+        bench_all<float, buffer_array>(s, api);
+        bench_all<float, usm_array>(s, api);
+        bench_all<double, buffer_array>(s, api);
+        bench_all<double, usm_array>(s, api);
+    }
+
+    int regressions = 0;
+    if (!baseline.empty()) {
+        regressions = bench::compare_baseline(s.records, bench::read_baseline(baseline),
+                                              threshold, stderr);
+        std::fprintf(stderr, "%d regression(s) beyond %.0f%% against %s\n", regressions,
+                     100.0 * threshold, baseline.c_str());
+    }
+
+    std::FILE *out = output.empty() ? stdout : std::fopen(output.c_str(), "w");
+    if (!out) {
+        std::fprintf(stderr, "cannot open %s\n", output.c_str());
+        return 2;
+    }
+    bench::write_json(out, bench::device_name(dev), s.records);
+    if (out != stdout)
+        std::fclose(out);
+    return regressions ? 1 : 0;
+}
@@ -0,0 +1,175 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// onemkl_blas_replay: re-executes a call stream recorded with
+//  onemkl::blas::record_start() or ONEMKL_BLAS_RECORD, in order, on the
+//  backend serving the chosen device, with synthetic operands of the recorded
+//  sizes. Each call is run once untimed and then --repeat times; its time is
+//  the median. Reports the time of every call (--calls, and in the JSON), per
+//  routine and in total.
+//
+//  onemkl_blas_replay <recording> [--device host|cpu|gpu] [--repeat <n>]
+//                     [--calls] [--output <file>]
+//
+//  Calls that cannot be replayed (packed GEMM, compact routines) or that the
+//  backend does not support are counted as skipped.
+
+#include <CL/sycl.hpp>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "bench_common.hpp"
+#include "onemkl/onemkl.hpp"
+
+struct call_time {
+    std::size_t index;
+    const onemkl::blas::recorded_call *call;
+    double median_ns;
+};
+
+struct routine_time {
+    std::int64_t calls = 0;
+    double total_ns    = 0.0;
+};
+
+static void write_json(std::FILE *out, const std::string &device, const std::string &recording,
+                       const std::vector<call_time> &times,
+                       const std::map<std::string, routine_time> &routines, double total_ns,
+                       std::int64_t skipped) {
+    std::fprintf(out, "{\n  \"device\": \"%s\",\n  \"recording\": \"%s\",\n  \"calls\": [\n",
+                 device.c_str(), recording.c_str());
+    for (std::size_t i = 0; i < times.size(); i++)
+        std::fprintf(out,
+                     "    {\"index\": %zu, \"name\": \"%s\", \"arguments\": \"%s\", "
+                     "\"median_ns\": %.1f}%s\n",
+                     times[i].index, times[i].call->name.c_str(),
+                     times[i].call->arguments.c_str(), times[i].median_ns,
+                     i + 1 < times.size() ? "," : "");
+    std::fprintf(out, "  ],\n  \"routines\": [\n");
+    std::size_t i = 0;
+    for (const auto &r : routines)
+        std::fprintf(out, "    {\"name\": \"%s\", \"calls\": %lld, \"total_ns\": %.1f}%s\n",
+                     r.first.c_str(), (long long)r.second.calls, r.second.total_ns,
+                     ++i < routines.size() ? "," : "");
+    std::fprintf(out, "  ],\n  \"total_ns\": %.1f,\n  \"skipped\": %lld\n}\n", total_ns,
+                 (long long)skipped);
+}
+
+static int usage(const char *program) {
+    std::fprintf(stderr,
+                 "usage: %s <recording> [--device host|cpu|gpu] [--repeat <n>] [--calls]\n"
+                 "       [--output <file>]\n",
+                 program);
+    return 2;
+}
+
+int main(int argc, char **argv) {
+    std::string recording, device = "host", output;
+    int repeat      = 5;
+    bool show_calls = false;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--calls")
+            show_calls = true;
+        else if (i + 1 < argc && arg == "--device")
+            device = argv[++i];
+        else if (i + 1 < argc && arg == "--repeat")
+            repeat = std::atoi(argv[++i]);
+        else if (i + 1 < argc && arg == "--output")
+            output = argv[++i];
+        else if (recording.empty() && arg.compare(0, 2, "--") != 0)
+            recording = arg;
+        else
+            return usage(argv[0]);
+    }
+    if (recording.empty() || repeat < 1 || (device != "host" && device != "cpu" && device != "gpu"))
+        return usage(argv[0]);
+
+    std::vector<onemkl::blas::recorded_call> calls;
+    try {
+        calls = onemkl::blas::record_load(recording);
+    }
+    catch (std::exception const &e) {
+        std::fprintf(stderr, "%s\n", e.what());
+        return 2;
+    }
+
+    cl::sycl::device dev = device == "host"
+                               ? cl::sycl::device(cl::sycl::host_selector())
+                               : device == "cpu" ? cl::sycl::device(cl::sycl::cpu_selector())
+                                                 : cl::sycl::device(cl::sycl::gpu_selector());
+    cl::sycl::queue queue(dev);
+    onemkl::blas::warmup(queue);
+
+    std::vector<call_time> times;
+    std::map<std::string, routine_time> routines;
+    double total_ns      = 0.0;
+    std::int64_t skipped = 0;
+    for (std::size_t i = 0; i < calls.size(); i++) {
+        auto &call = calls[i];
+        if (!call.replayable) {
+            skipped++;
+            continue;
+        }
+        double median_ns;
+        try {
+            onemkl::blas::replay_prepare(queue, call);
+            median_ns = bench::median(
+                bench::sample_ns([&]() { onemkl::blas::replay_run(queue, call); }, 1, repeat));
+        }
+        catch (std::exception const &e) {
+            std::fprintf(stderr, "call %zu, %s: %s\n", i, call.name.c_str(), e.what());
+            onemkl::blas::replay_release(call);
+            skipped++;
+            continue;
+        }
+        onemkl::blas::replay_release(call);
+
+        times.push_back({ i, &call, median_ns });
+        routines[call.name].calls++;
+        routines[call.name].total_ns += median_ns;
+        total_ns += median_ns;
+        if (show_calls)
+            std::printf("%6zu %12.1f us  %s(%s)\n", i, median_ns / 1e3, call.name.c_str(),
+                        call.arguments.c_str());
+    }
+
+    std::printf("%-32s %8s %14s %12s\n", "routine", "calls", "total (us)", "mean (us)");
+    for (const auto &r : routines)
+        std::printf("%-32s %8lld %14.1f %12.1f\n", r.first.c_str(), (long long)r.second.calls,
+                    r.second.total_ns / 1e3, r.second.total_ns / 1e3 / r.second.calls);
+    std::printf("total: %zu calls replayed in %.1f us on %s, %lld skipped\n", times.size(),
+                total_ns / 1e3, bench::device_name(dev).c_str(), (long long)skipped);
+
+    if (!output.empty()) {
+        std::FILE *out = std::fopen(output.c_str(), "w");
+        if (!out) {
+            std::fprintf(stderr, "cannot open %s\n", output.c_str());
+            return 2;
+        }
+        write_json(out, bench::device_name(dev), recording, times, routines, total_ns, skipped);
+        std::fclose(out);
+    }
+    return 0;
+}
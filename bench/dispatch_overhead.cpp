@@ -0,0 +1,122 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Cost of each layer between a USM saxpy call and MKL, for tiny n where the
+//  layers dominate. Every column is the median latency of a call + wait:
+//    mkl        ::saxpy called directly, with no queue involved
+//    submit     an empty host task submitted to the queue, the SYCL floor
+//    backend    onemkl::mklcpu::axpy, the backend entry point
+//    ct         axpy<library::intelmkl, backend::intelcpu>, compile-time API
+//    rt         onemkl::blas::axpy, run-time dispatch through the loader
+//    predicates axpy_precondition + axpy_postcondition alone
+//  ONEMKL_DISABLE_PREDICATES is a compile-time switch, so this source is built
+//  twice: bench_dispatch_overhead with predicates and
+//  bench_dispatch_overhead_nopred without.
+
+#include <CL/sycl.hpp>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "bench_common.hpp"
+#include "mkl_blas.h"
+#include "onemkl/onemkl.hpp"
+
+static const std::int64_t reps = 2000;
+
+// Empty task on the host, submitted the way the mklcpu backend submits its
+//  work: run_on_host_intel when the compiler has it, single_task otherwise.
+template <typename K, typename H, typename F>
+static inline auto empty_task(H &cgh, F f, int) -> decltype(cgh.run_on_host_intel(f)) {
+    return cgh.run_on_host_intel(f);
+}
+
+template <typename K, typename H, typename F>
+static inline void empty_task(H &cgh, F f, long) {
+    cgh.template single_task<K>(f);
+}
+
+class dispatch_overhead_empty_task;
+
+template <typename F>
+static double median_ns(F f) {
+    return bench::median(bench::sample_ns(f, reps));
+}
+
+int main() {
+#ifdef ONEMKL_DISABLE_PREDICATES
+    std::printf("predicates: disabled (ONEMKL_DISABLE_PREDICATES)\n\n");
+#else
+    std::printf("predicates: enabled\n\n");
+#endif
+
+    std::vector<cl::sycl::event> dependencies;
+    for (auto dev : bench::cpu_devices()) {
+        cl::sycl::queue queue(dev);
+        auto ctx = queue.get_context();
+        float *x = (float *)cl::sycl::malloc_shared(256 * sizeof(float), dev, ctx);
+        float *y = (float *)cl::sycl::malloc_shared(256 * sizeof(float), dev, ctx);
+        for (int i = 0; i < 256; i++)
+            x[i] = y[i] = 1.0f;
+        onemkl::blas::warmup(queue);
+
+        std::printf("%s [ns]\n", bench::device_name(dev).c_str());
+        std::printf("%6s %10s %10s %10s %10s %10s %10s\n", "n", "mkl", "submit", "backend", "ct",
+                    "rt", "predicates");
+        for (std::int64_t n : { 1, 16, 256 }) {
+            float alpha      = 1e-6f;
+            std::int64_t one = 1;
+
+            double ns_mkl = median_ns([&]() {
+                ::saxpy((const MKL_INT *)&n, &alpha, x, (const MKL_INT *)&one, y,
+                        (const MKL_INT *)&one);
+            });
+            double ns_submit = median_ns([&]() {
+                queue
+                    .submit([&](cl::sycl::handler &cgh) {
+                        empty_task<dispatch_overhead_empty_task>(cgh, []() {}, 0);
+                    })
+                    .wait();
+            });
+            double ns_backend = median_ns([&]() {
+                onemkl::mklcpu::axpy(queue, n, alpha, x, 1, y, 1, dependencies).wait();
+            });
+            double ns_ct = median_ns([&]() {
+                onemkl::blas::axpy<onemkl::library::intelmkl, onemkl::backend::intelcpu>(
+                    queue, n, alpha, x, 1, y, 1, dependencies)
+                    .wait();
+            });
+            double ns_rt = median_ns([&]() {
+                onemkl::blas::axpy(queue, n, alpha, x, 1, y, 1, dependencies).wait();
+            });
+            double ns_predicates = median_ns([&]() {
+                onemkl::blas::axpy_precondition(queue, n, alpha, x, 1, y, 1, dependencies);
+                onemkl::blas::axpy_postcondition(queue, n, alpha, x, 1, y, 1, dependencies);
+            });
+
+            std::printf("%6lld %10.1f %10.1f %10.1f %10.1f %10.1f %10.1f\n", (long long)n, ns_mkl,
+                        ns_submit, ns_backend, ns_ct, ns_rt, ns_predicates);
+        }
+        std::printf("\n");
+
+        cl::sycl::free(x, ctx);
+        cl::sycl::free(y, ctx);
+    }
+    return 0;
+}
@@ -0,0 +1,97 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// USM sgemm_batch on the host device across batch sizes and square matrix
+//  sizes: the strided API, the strided API with a broadcast A (stride_a = 0),
+//  and, for reference, the group API with pointer arrays built by the caller,
+//  which is what the strided API used to do internally.
+
+#include <CL/sycl.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "bench_common.hpp"
+#include "onemkl/onemkl.hpp"
+
+// Largest number of elements of one batched operand.
+static const std::int64_t max_elements = std::int64_t(1) << 24;
+
+int main() {
+    cl::sycl::device dev((cl::sycl::host_selector()));
+    cl::sycl::queue queue(dev);
+    auto ctx = queue.get_context();
+    float *a = (float *)cl::sycl::malloc_shared(max_elements * sizeof(float), dev, ctx);
+    float *b = (float *)cl::sycl::malloc_shared(max_elements * sizeof(float), dev, ctx);
+    float *c = (float *)cl::sycl::malloc_shared(max_elements * sizeof(float), dev, ctx);
+    std::fill(a, a + max_elements, 1.0f);
+    std::fill(b, b + max_elements, 1.0f);
+    onemkl::blas::warmup(queue);
+
+    auto nontrans = onemkl::transpose::nontrans;
+    std::vector<cl::sycl::event> dependencies;
+    std::printf("%6s %10s %16s %16s %16s\n", "n", "batch", "strided [us]", "broadcast [us]",
+                "pointers [us]");
+    for (std::int64_t n : { 4, 8, 16, 32, 64 }) {
+        for (std::int64_t batch = 10; batch <= 1000000; batch *= 10) {
+            std::int64_t stride = n * n;
+            if (batch * stride > max_elements)
+                break;
+            int reps = (int)std::max<std::int64_t>(3, 1000000 / (batch * stride));
+
+            auto strided = [&]() {
+                onemkl::blas::gemm_batch(queue, nontrans, nontrans, n, n, n, 1.0f, a, n, stride, b,
+                                         n, stride, 0.0f, c, n, stride, batch, dependencies)
+                    .wait();
+            };
+            auto broadcast = [&]() {
+                onemkl::blas::gemm_batch(queue, nontrans, nontrans, n, n, n, 1.0f, a, n, 0, b, n,
+                                         stride, 0.0f, c, n, stride, batch, dependencies)
+                    .wait();
+            };
+            auto pointers = [&]() {
+                std::vector<const float *> a_array(batch), b_array(batch);
+                std::vector<float *> c_array(batch);
+                for (std::int64_t i = 0; i < batch; i++) {
+                    a_array[i] = a + i * stride;
+                    b_array[i] = b + i * stride;
+                    c_array[i] = c + i * stride;
+                }
+                float alpha             = 1.0f, beta = 0.0f;
+                onemkl::transpose trans = nontrans;
+                std::int64_t size       = n, ld = n;
+                onemkl::blas::gemm_batch(queue, &trans, &trans, &size, &size, &size, &alpha,
+                                         a_array.data(), &ld, b_array.data(), &ld, &beta,
+                                         c_array.data(), &ld, 1, &batch, dependencies)
+                    .wait();
+            };
+
+            std::printf("%6lld %10lld %16.1f %16.1f %16.1f\n", (long long)n, (long long)batch,
+                        bench::median(bench::sample_ns(strided, reps, 5)) / 1000.0,
+                        bench::median(bench::sample_ns(broadcast, reps, 5)) / 1000.0,
+                        bench::median(bench::sample_ns(pointers, reps, 5)) / 1000.0);
+        }
+    }
+
+    cl::sycl::free(a, ctx);
+    cl::sycl::free(b, ctx);
+    cl::sycl::free(c, ctx);
+    return 0;
+}
@@ -0,0 +1,93 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// bfloat16 gemm on the host device against sgemm on the same shapes, in
+//  GFLOPS: gemm_ext with bfloat16 A and B and a float C, and gemm with
+//  bfloat16 A, B and C. Matrices are USM shared allocations, so the timings
+//  include no buffer copies.
+
+#include <CL/sycl.hpp>
+#include <cstdint>
+#include <cstdio>
+
+#include "bench_common.hpp"
+#include "onemkl/onemkl.hpp"
+
+using onemkl::bfloat16;
+
+template <typename T>
+static T *alloc_filled(cl::sycl::queue &queue, std::int64_t count, float value) {
+    T *p = (T *)cl::sycl::malloc_shared(count * sizeof(T), queue.get_device(),
+                                        queue.get_context());
+    for (std::int64_t i = 0; i < count; i++)
+        p[i] = T(value);
+    return p;
+}
+
+int main() {
+    cl::sycl::queue queue((cl::sycl::host_selector()));
+    onemkl::blas::warmup(queue);
+
+    auto nontrans = onemkl::transpose::nontrans;
+    std::printf("GFLOPS\n%6s %6s %6s %10s %12s %12s\n", "m", "n", "k", "sgemm", "bf16->f32",
+                "bf16->bf16");
+    for (std::int64_t size : { 256, 512, 1024, 2048, 4096 }) {
+        std::int64_t m = size, n = size, k = size;
+
+        float *a_f32      = alloc_filled<float>(queue, m * k, 0.5f);
+        float *b_f32      = alloc_filled<float>(queue, k * n, 0.25f);
+        float *c_f32      = alloc_filled<float>(queue, m * n, 0.0f);
+        bfloat16 *a_bf16  = alloc_filled<bfloat16>(queue, m * k, 0.5f);
+        bfloat16 *b_bf16  = alloc_filled<bfloat16>(queue, k * n, 0.25f);
+        bfloat16 *c_bf16  = alloc_filled<bfloat16>(queue, m * n, 0.0f);
+        int samples       = size <= 1024 ? 11 : 3;
+        std::int64_t reps = size <= 512 ? 10 : 1;
+
+        double ns_sgemm = bench::median(bench::sample_ns(
+            [&]() {
+                onemkl::blas::gemm(queue, nontrans, nontrans, m, n, k, 1.0f, a_f32, m, b_f32, k,
+                                   0.0f, c_f32, m)
+                    .wait();
+            },
+            reps, samples));
+        double ns_ext = bench::median(bench::sample_ns(
+            [&]() {
+                onemkl::blas::gemm_ext(queue, nontrans, nontrans, m, n, k, 1.0f, a_bf16, m, b_bf16,
+                                       k, 0.0f, c_f32, m)
+                    .wait();
+            },
+            reps, samples));
+        double ns_bf16 = bench::median(bench::sample_ns(
+            [&]() {
+                onemkl::blas::gemm(queue, nontrans, nontrans, m, n, k, bfloat16(1.0f), a_bf16, m,
+                                   b_bf16, k, bfloat16(0.0f), c_bf16, m)
+                    .wait();
+            },
+            reps, samples));
+
+        double flops = 2.0 * m * n * k;
+        std::printf("%6lld %6lld %6lld %10.1f %12.1f %12.1f\n", (long long)m, (long long)n,
+                    (long long)k, flops / ns_sgemm, flops / ns_ext, flops / ns_bf16);
+
+        for (void *p : { (void *)a_f32, (void *)b_f32, (void *)c_f32, (void *)a_bf16,
+                         (void *)b_bf16, (void *)c_bf16 })
+            cl::sycl::free(p, queue.get_context());
+    }
+    return 0;
+}
@@ -0,0 +1,100 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Half-precision gemm on the host device, run either through the library
+//  (gemm with half A, B and C, converted block by block inside), or the way
+//  the library used to run it: full float copies of A, B and C, converted one
+//  value at a time, and a float gemm. Peak RSS only grows, so each way runs in
+//  a process of its own, and the RSS column is the peak so far:
+//
+//    bench_gemm_half          streamed conversion in the library
+//    bench_gemm_half copy     full float copies
+
+#include <CL/sycl.hpp>
+#include <sys/resource.h>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "bench_common.hpp"
+#include "onemkl/onemkl.hpp"
+
+using cl::sycl::half;
+
+static long peak_rss_mib() {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss / 1024;
+}
+
+int main(int argc, char **argv) {
+    bool copy = argc > 1 && std::strcmp(argv[1], "copy") == 0;
+    cl::sycl::queue queue((cl::sycl::host_selector()));
+    onemkl::blas::warmup(queue);
+
+    struct shape {
+        std::int64_t m, n, k;
+    };
+    auto nontrans = onemkl::transpose::nontrans;
+    std::printf("%s\n%6s %6s %6s %10s %16s\n", copy ? "full float copies" : "streamed", "m", "n",
+                "k", "GFLOPS", "peak RSS [MiB]");
+    for (shape s : { shape{ 512, 512, 512 }, shape{ 2048, 2048, 2048 }, shape{ 4096, 4096, 4096 },
+                     shape{ 1024, 1024, 65536 } }) {
+        std::vector<half> a(s.m * s.k, half(0.5f)), b(s.k * s.n, half(0.25f)),
+            c(s.m * s.n, half(0.0f));
+        cl::sycl::buffer<half, 1> a_buf(a.data(), a.size()), b_buf(b.data(), b.size()),
+            c_buf(c.data(), c.size());
+
+        auto streamed = [&]() {
+            onemkl::blas::gemm(queue, nontrans, nontrans, s.m, s.n, s.k, half(1.0f), a_buf, s.m,
+                               b_buf, s.k, half(0.0f), c_buf, s.m);
+            queue.wait();
+        };
+        auto copied = [&]() {
+            auto a_half = a_buf.get_access<cl::sycl::access::mode::read>();
+            auto b_half = b_buf.get_access<cl::sycl::access::mode::read>();
+            auto c_half = c_buf.get_access<cl::sycl::access::mode::read_write>();
+            std::vector<float> a_f(a.size()), b_f(b.size()), c_f(c.size());
+            for (std::size_t i = 0; i < a_f.size(); i++)
+                a_f[i] = a_half[i];
+            for (std::size_t i = 0; i < b_f.size(); i++)
+                b_f[i] = b_half[i];
+            for (std::size_t i = 0; i < c_f.size(); i++)
+                c_f[i] = c_half[i];
+            {
+                cl::sycl::buffer<float, 1> a_fb(a_f.data(), a_f.size()),
+                    b_fb(b_f.data(), b_f.size()), c_fb(c_f.data(), c_f.size());
+                onemkl::blas::gemm(queue, nontrans, nontrans, s.m, s.n, s.k, 1.0f, a_fb, s.m, b_fb,
+                                   s.k, 0.0f, c_fb, s.m);
+            }
+            for (std::size_t i = 0; i < c_f.size(); i++)
+                c_half[i] = c_f[i];
+        };
+
+        double ns;
+        if (copy)
+            ns = bench::median(bench::sample_ns(copied, 1, 3));
+        else
+            ns = bench::median(bench::sample_ns(streamed, 1, 3));
+        std::printf("%6lld %6lld %6lld %10.1f %16ld\n", (long long)s.m, (long long)s.n,
+                    (long long)s.k, 2.0 * s.m * s.n * s.k / ns, peak_rss_mib());
+    }
+    return 0;
+}
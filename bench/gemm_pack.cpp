@@ -0,0 +1,97 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// sgemm on the host device with the same A and a different B on every call,
+//  against packing A once with gemm_pack and calling gemm_compute for every B.
+//  Times are per multiplication; the pack column is the one-off cost of
+//  gemm_pack, which "speedup" does not include.
+
+#include <CL/sycl.hpp>
+#include <cstdint>
+#include <cstdio>
+
+#include "bench_common.hpp"
+#include "onemkl/onemkl.hpp"
+
+// Number of different B matrices multiplied by the same A.
+static const std::int64_t num_b = 16;
+
+static float *alloc_filled(cl::sycl::queue &queue, std::int64_t count, float value) {
+    float *p = (float *)cl::sycl::malloc_shared(count * sizeof(float), queue.get_device(),
+                                                queue.get_context());
+    for (std::int64_t i = 0; i < count; i++)
+        p[i] = value;
+    return p;
+}
+
+int main() {
+    cl::sycl::queue queue((cl::sycl::host_selector()));
+    onemkl::blas::warmup(queue);
+
+    auto nontrans = onemkl::transpose::nontrans;
+    std::printf("%6s %6s %6s %12s %12s %12s %10s\n", "m", "n", "k", "gemm [us]", "compute [us]",
+                "pack [us]", "speedup");
+    for (std::int64_t size : { 32, 64, 128, 256, 512, 1024 }) {
+        std::int64_t m = size, n = size, k = size;
+
+        float *a          = alloc_filled(queue, m * k, 0.5f);
+        float *b          = alloc_filled(queue, k * n * num_b, 0.25f);
+        float *c          = alloc_filled(queue, m * n, 0.0f);
+        int samples       = 11;
+        std::int64_t reps = size <= 256 ? 10 : 1;
+
+        double ns_gemm = bench::median(bench::sample_ns(
+            [&]() {
+                for (std::int64_t i = 0; i < num_b; i++)
+                    onemkl::blas::gemm(queue, nontrans, nontrans, m, n, k, 1.0f, a, m,
+                                       b + i * k * n, k, 0.0f, c, m)
+                        .wait();
+            },
+            reps, samples));
+        double ns_pack = bench::median(bench::sample_ns(
+            [&]() {
+                onemkl::blas::gemm_pack(queue, onemkl::pack_matrix::a, nontrans, m, n, k, 1.0f,
+                                        a, m)
+                    .ready()
+                    .wait();
+            },
+            reps, samples));
+
+        auto packed = onemkl::blas::gemm_pack(queue, onemkl::pack_matrix::a, nontrans, m, n, k,
+                                              1.0f, a, m);
+        double ns_compute = bench::median(bench::sample_ns(
+            [&]() {
+                for (std::int64_t i = 0; i < num_b; i++)
+                    onemkl::blas::gemm_compute(queue, packed, nontrans, b + i * k * n, k, 0.0f, c,
+                                               m)
+                        .wait();
+            },
+            reps, samples));
+
+        ns_gemm /= num_b;
+        ns_compute /= num_b;
+        std::printf("%6lld %6lld %6lld %12.2f %12.2f %12.2f %10.2f\n", (long long)m,
+                    (long long)n, (long long)k, ns_gemm / 1e3, ns_compute / 1e3, ns_pack / 1e3,
+                    ns_gemm / ns_compute);
+
+        for (void *p : { (void *)a, (void *)b, (void *)c })
+            cl::sycl::free(p, queue.get_context());
+    }
+    return 0;
+}
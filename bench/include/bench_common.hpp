@@ -0,0 +1,84 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _BENCH_COMMON_HPP_
+#define _BENCH_COMMON_HPP_
+
+#include <CL/sycl.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace bench {
+
+typedef std::chrono::steady_clock clock;
+
+// Time `reps` back-to-back calls of f() per sample; returns the per-call time
+//  of every sample in nanoseconds. The first sample is a discarded warm-up.
+template <typename F>
+std::vector<double> sample_ns(F f, std::int64_t reps, int samples = 11) {
+    std::vector<double> result;
+    for (int s = 0; s <= samples; s++) {
+        auto start = clock::now();
+        for (std::int64_t r = 0; r < reps; r++)
+            f();
+        auto stop = clock::now();
+        if (s > 0)
+            result.push_back(std::chrono::duration<double, std::nano>(stop - start).count() /
+                             reps);
+    }
+    return result;
+}
+
+inline double percentile(std::vector<double> v, double p) {
+    if (v.empty())
+        return 0.0;
+    std::sort(v.begin(), v.end());
+    std::size_t idx = static_cast<std::size_t>(p * (v.size() - 1) + 0.5);
+    return v[std::min(idx, v.size() - 1)];
+}
+
+inline double median(const std::vector<double> &v) {
+    return percentile(v, 0.5);
+}
+
+// Devices every benchmark runs on: the host device, and the OpenCL CPU device
+//  when one is available.
+inline std::vector<cl::sycl::device> cpu_devices() {
+    std::vector<cl::sycl::device> devices;
+    devices.push_back(cl::sycl::device(cl::sycl::host_selector()));
+    try {
+        devices.push_back(cl::sycl::device(cl::sycl::cpu_selector()));
+    }
+    catch (cl::sycl::exception const &) {
+    }
+    return devices;
+}
+
+inline std::string device_name(const cl::sycl::device &dev) {
+    return dev.is_host() ? std::string("host")
+                         : dev.get_info<cl::sycl::info::device::name>();
+}
+
+} // namespace bench
+
+#endif //_BENCH_COMMON_HPP_
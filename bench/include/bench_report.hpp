@@ -0,0 +1,143 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _BENCH_REPORT_HPP_
+#define _BENCH_REPORT_HPP_
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace bench {
+
+// One measured case. The name is unique within a run and identifies the
+//  case in a baseline; the other fields describe it for downstream tools.
+struct record {
+    std::string name;
+    std::string routine;
+    std::string api;
+    std::string memory;
+    std::string precision;
+    std::string trans;
+    std::int64_t m     = 0;
+    std::int64_t n     = 0;
+    std::int64_t k     = 0;
+    std::int64_t ld    = 0;
+    std::int64_t batch = 1;
+    double median_ns   = 0.0;
+    double p99_ns      = 0.0;
+    double gflops      = 0.0;
+    double gbps        = 0.0;
+    // Filled in when a baseline is given: baseline median and whether this
+    //  case is slower than it by more than the threshold.
+    double baseline_ns = 0.0;
+    bool regression    = false;
+};
+
+inline std::string json_escape(const std::string &s) {
+    std::string result;
+    for (char c : s) {
+        if (c == '"' || c == '\\')
+            result += '\\';
+        if ((unsigned char)c < 0x20)
+            continue;
+        result += c;
+    }
+    return result;
+}
+
+// Writes a run as a JSON object, one result per line so that reports diff
+//  cleanly and read_baseline() can read them back without a JSON parser.
+inline void write_json(std::FILE *out, const std::string &device,
+                       const std::vector<record> &records) {
+    std::fprintf(out, "{\n  \"device\": \"%s\",\n  \"results\": [\n",
+                 json_escape(device).c_str());
+    for (std::size_t i = 0; i < records.size(); i++) {
+        const record &r = records[i];
+        std::fprintf(out,
+                     "    {\"name\": \"%s\", \"routine\": \"%s\", \"api\": \"%s\", "
+                     "\"memory\": \"%s\", \"precision\": \"%s\", \"trans\": \"%s\", "
+                     "\"m\": %lld, \"n\": %lld, \"k\": %lld, \"ld\": %lld, \"batch\": %lld, "
+                     "\"median_ns\": %.1f, \"p99_ns\": %.1f, \"gflops\": %.3f, \"gbps\": %.3f",
+                     json_escape(r.name).c_str(), r.routine.c_str(), r.api.c_str(),
+                     r.memory.c_str(), r.precision.c_str(), r.trans.c_str(), (long long)r.m,
+                     (long long)r.n, (long long)r.k, (long long)r.ld, (long long)r.batch,
+                     r.median_ns, r.p99_ns, r.gflops, r.gbps);
+        if (r.baseline_ns > 0.0)
+            std::fprintf(out, ", \"baseline_ns\": %.1f, \"regression\": %s", r.baseline_ns,
+                         r.regression ? "true" : "false");
+        std::fprintf(out, "}%s\n", i + 1 < records.size() ? "," : "");
+    }
+    std::fprintf(out, "  ]\n}\n");
+}
+
+// Reads name -> median_ns from a report written by write_json(). Lines
+//  without both fields are ignored.
+inline std::map<std::string, double> read_baseline(const std::string &path) {
+    std::map<std::string, double> result;
+    std::ifstream in(path);
+    std::string line;
+    const std::string name_key   = "\"name\": \"";
+    const std::string median_key = "\"median_ns\": ";
+    while (std::getline(in, line)) {
+        std::size_t name_pos   = line.find(name_key);
+        std::size_t median_pos = line.find(median_key);
+        if (name_pos == std::string::npos || median_pos == std::string::npos)
+            continue;
+        name_pos += name_key.size();
+        std::size_t name_end = line.find('"', name_pos);
+        if (name_end == std::string::npos)
+            continue;
+        result[line.substr(name_pos, name_end - name_pos)] =
+            std::strtod(line.c_str() + median_pos + median_key.size(), nullptr);
+    }
+    return result;
+}
+
+// Marks every record whose median is more than `threshold` (a fraction)
+//  above its baseline, prints those to `log` and returns their number.
+//  Cases missing from the baseline are not compared.
+inline int compare_baseline(std::vector<record> &records,
+                            const std::map<std::string, double> &baseline, double threshold,
+                            std::FILE *log) {
+    int regressions = 0;
+    for (record &r : records) {
+        auto it = baseline.find(r.name);
+        if (it == baseline.end() || it->second <= 0.0)
+            continue;
+        r.baseline_ns = it->second;
+        r.regression  = r.median_ns > r.baseline_ns * (1.0 + threshold);
+        if (r.regression) {
+            regressions++;
+            std::fprintf(log, "REGRESSION %s: %.1f ns -> %.1f ns (%+.1f%%)\n", r.name.c_str(),
+                         r.baseline_ns, r.median_ns,
+                         100.0 * (r.median_ns / r.baseline_ns - 1.0));
+        }
+    }
+    return regressions;
+}
+
+} // namespace bench
+
+#endif //_BENCH_REPORT_HPP_
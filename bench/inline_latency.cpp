@@ -0,0 +1,107 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Latency of a USM saxpy (call + wait) for n = 1 .. 64k on the mklcpu backend,
+//  with command group submission and with inline execution of small calls
+//  (ONEMKL_MKLCPU_INLINE_THRESHOLD). The threshold is read from the
+//  environment, so each mode runs in a child process (this executable with
+//  --child).
+
+#include <CL/sycl.hpp>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "bench_common.hpp"
+#include "onemkl/onemkl.hpp"
+
+#ifdef _WIN64
+    #define popen  _popen
+    #define pclose _pclose
+#endif
+
+static const std::int64_t max_n = 65536;
+
+static int child(std::size_t device_index) {
+    auto devices = bench::cpu_devices();
+    if (device_index >= devices.size())
+        return 1;
+    auto dev = devices[device_index];
+    cl::sycl::queue queue(dev);
+    auto ctx = queue.get_context();
+    float *x = (float *)cl::sycl::malloc_shared(max_n * sizeof(float), dev, ctx);
+    float *y = (float *)cl::sycl::malloc_shared(max_n * sizeof(float), dev, ctx);
+    for (std::int64_t i = 0; i < max_n; i++)
+        x[i] = y[i] = 1.0f;
+
+    std::vector<cl::sycl::event> dependencies;
+    for (std::int64_t n = 1; n <= max_n; n *= 2) {
+        std::int64_t reps = std::max<std::int64_t>(20, 200000 / n);
+        auto t = bench::sample_ns(
+            [&]() { onemkl::blas::axpy(queue, n, 1e-6f, x, 1, y, 1, dependencies).wait(); },
+            reps);
+        std::printf("%lld %f\n", (long long)n, bench::median(t) / 1000.0);
+    }
+
+    cl::sycl::free(x, ctx);
+    cl::sycl::free(y, ctx);
+    return 0;
+}
+
+static std::map<std::int64_t, double> run_child(const char *self, std::size_t d,
+                                                const char *threshold) {
+#ifdef _WIN64
+    _putenv_s("ONEMKL_MKLCPU_INLINE_THRESHOLD", threshold);
+#else
+    setenv("ONEMKL_MKLCPU_INLINE_THRESHOLD", threshold, 1);
+#endif
+    std::map<std::int64_t, double> result;
+    std::string cmd = std::string("\"") + self + "\" --child " + std::to_string(d);
+    FILE *out = popen(cmd.c_str(), "r");
+    if (!out)
+        return result;
+    long long n;
+    double us;
+    while (std::fscanf(out, "%lld %lf", &n, &us) == 2)
+        result[n] = us;
+    pclose(out);
+    return result;
+}
+
+int main(int argc, char **argv) {
+    if (argc == 3 && std::strcmp(argv[1], "--child") == 0)
+        return child(std::strtoul(argv[2], nullptr, 10));
+
+    auto devices = bench::cpu_devices();
+    for (std::size_t d = 0; d < devices.size(); d++) {
+        auto submitted = run_child(argv[0], d, "0");
+        auto inlined   = run_child(argv[0], d, std::to_string(max_n).c_str());
+
+        std::printf("%s\n", bench::device_name(devices[d]).c_str());
+        std::printf("%10s %16s %16s\n", "n", "submit [us]", "inline [us]");
+        for (auto &r : submitted)
+            std::printf("%10lld %16.2f %16.2f\n", (long long)r.first, r.second, inlined[r.first]);
+        std::printf("\n");
+    }
+    return 0;
+}
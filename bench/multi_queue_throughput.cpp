@@ -0,0 +1,87 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Aggregate sgemm throughput of Q queues on the host device, each driven by
+//  its own thread, with and without a per-queue thread budget
+//  (onemkl::blas::set_num_threads) of hardware_concurrency / Q threads.
+//  Without a budget every concurrent host task sizes MKL to all cores.
+
+#include <CL/sycl.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include "bench_common.hpp"
+#include "onemkl/onemkl.hpp"
+
+static const std::int64_t n = 512;
+static const int iterations = 20;
+
+// GFLOP/s of all queues together.
+static double run(int num_queues, bool budget) {
+    cl::sycl::device dev((cl::sycl::host_selector()));
+    int hw = std::max(1u, std::thread::hardware_concurrency());
+
+    std::vector<cl::sycl::queue> queues;
+    std::vector<float *> data;
+    for (int q = 0; q < num_queues; q++) {
+        queues.push_back(cl::sycl::queue(dev));
+        auto ctx = queues.back().get_context();
+        float *p = (float *)cl::sycl::malloc_shared(3 * n * n * sizeof(float), dev, ctx);
+        std::fill(p, p + 3 * n * n, 1.0f);
+        data.push_back(p);
+        onemkl::blas::set_num_threads(queues.back(), budget ? std::max(1, hw / num_queues) : 0);
+        onemkl::blas::warmup(queues.back());
+    }
+
+    auto work = [&](int q) {
+        float *a = data[q], *b = a + n * n, *c = b + n * n;
+        for (int i = 0; i < iterations; i++)
+            onemkl::blas::gemm(queues[q], onemkl::transpose::nontrans, onemkl::transpose::nontrans,
+                               n, n, n, 1.0f, a, n, b, n, 0.0f, c, n)
+                .wait();
+    };
+
+    auto start = bench::clock::now();
+    std::vector<std::thread> threads;
+    for (int q = 0; q < num_queues; q++)
+        threads.emplace_back(work, q);
+    for (auto &t : threads)
+        t.join();
+    double seconds = std::chrono::duration<double>(bench::clock::now() - start).count();
+
+    for (int q = 0; q < num_queues; q++)
+        cl::sycl::free(data[q], queues[q].get_context());
+    return 2.0 * n * n * n * iterations * num_queues / seconds * 1e-9;
+}
+
+int main() {
+    int hw = std::max(1u, std::thread::hardware_concurrency());
+    std::printf("sgemm n=%lld, %d hardware threads\n", (long long)n, hw);
+    std::printf("%8s %18s %18s %10s\n", "queues", "default [GF/s]", "budget [GF/s]", "speedup");
+    for (int q = 1; q <= 2 * hw && q <= 64; q *= 2) {
+        double shared   = run(q, false);
+        double budgeted = run(q, true);
+        std::printf("%8d %18.1f %18.1f %10.2f\n", q, shared, budgeted, budgeted / shared);
+    }
+    return 0;
+}
@@ -0,0 +1,91 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Latency of the first run-time API call in a fresh process, without and with
+//  onemkl::blas::warmup() beforehand. Every measurement runs in its own child
+//  process (this executable re-invoked with --child), since backend loading
+//  and runtime initialization only happen once per process.
+
+#include <CL/sycl.hpp>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "bench_common.hpp"
+#include "onemkl/onemkl.hpp"
+
+static double axpy_ms(cl::sycl::queue &queue, std::vector<float> &x, std::vector<float> &y) {
+    auto start = bench::clock::now();
+    {
+        cl::sycl::buffer<float, 1> x_buffer(x.data(), cl::sycl::range<1>(x.size()));
+        cl::sycl::buffer<float, 1> y_buffer(y.data(), cl::sycl::range<1>(y.size()));
+        onemkl::blas::axpy(queue, x.size(), 1.0f, x_buffer, 1, y_buffer, 1);
+    }
+    queue.wait();
+    return std::chrono::duration<double, std::milli>(bench::clock::now() - start).count();
+}
+
+static int child(bool warm, std::size_t device_index) {
+    auto devices = bench::cpu_devices();
+    if (device_index >= devices.size())
+        return 1;
+    cl::sycl::queue queue(devices[device_index]);
+    std::vector<float> x(1024, 1.0f), y(1024, 1.0f);
+
+    double warmup = 0.0;
+    if (warm) {
+        auto start = bench::clock::now();
+        onemkl::blas::warmup(queue);
+        warmup = std::chrono::duration<double, std::milli>(bench::clock::now() - start).count();
+    }
+    double first  = axpy_ms(queue, x, y);
+    double second = axpy_ms(queue, x, y);
+
+    std::printf("%-6s %-32s %14.3f %14.3f %14.3f\n", warm ? "warm" : "cold",
+                bench::device_name(devices[device_index]).c_str(), warmup, first, second);
+    std::fflush(stdout);
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    if (argc == 4 && std::strcmp(argv[1], "--child") == 0)
+        return child(std::strcmp(argv[2], "warm") == 0, std::strtoul(argv[3], nullptr, 10));
+
+    int runs = (argc > 1) ? std::atoi(argv[1]) : 5;
+    std::printf("%-6s %-32s %14s %14s %14s\n", "mode", "device", "warmup [ms]", "1st call [ms]",
+                "2nd call [ms]");
+    std::fflush(stdout);
+
+    auto num_devices = bench::cpu_devices().size();
+    const char *modes[] = { "cold", "warm" };
+    for (std::size_t d = 0; d < num_devices; d++) {
+        for (auto mode : modes) {
+            for (int r = 0; r < runs; r++) {
+                std::string cmd = std::string("\"") + argv[0] + "\" --child " + mode + " " +
+                                  std::to_string(d);
+                if (std::system(cmd.c_str()) != 0)
+                    std::fprintf(stderr, "child run failed: %s\n", cmd.c_str());
+            }
+        }
+    }
+    return 0;
+}
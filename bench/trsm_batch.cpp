@@ -0,0 +1,106 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// USM strsm_batch on the host device across batch sizes and square matrix
+//  sizes: the strided API, the group API with one group, and a loop of USM
+//  trsm calls, one per matrix, waited for together at the end.
+
+#include <CL/sycl.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "bench_common.hpp"
+#include "onemkl/onemkl.hpp"
+
+// Largest number of elements of one batched operand.
+static const std::int64_t max_elements = std::int64_t(1) << 24;
+
+int main() {
+    cl::sycl::device dev((cl::sycl::host_selector()));
+    cl::sycl::queue queue(dev);
+    auto ctx = queue.get_context();
+    float *a = (float *)cl::sycl::malloc_shared(max_elements * sizeof(float), dev, ctx);
+    float *b = (float *)cl::sycl::malloc_shared(max_elements * sizeof(float), dev, ctx);
+    std::fill(b, b + max_elements, 1.0f);
+    onemkl::blas::warmup(queue);
+
+    auto left     = onemkl::side::left;
+    auto upper    = onemkl::uplo::upper;
+    auto nontrans = onemkl::transpose::nontrans;
+    auto nonunit  = onemkl::diag::nonunit;
+    std::vector<cl::sycl::event> dependencies;
+    std::printf("%6s %10s %16s %16s %16s\n", "n", "batch", "strided [us]", "group [us]",
+                "loop [us]");
+    for (std::int64_t n : { 4, 8, 16, 32, 64 }) {
+        // Identity triangles, so that repeated solves leave B unchanged.
+        std::int64_t stride = n * n;
+        std::fill(a, a + max_elements, 0.0f);
+        for (std::int64_t i = 0; i < max_elements / stride; i++)
+            for (std::int64_t j = 0; j < n; j++)
+                a[i * stride + j * (n + 1)] = 1.0f;
+
+        for (std::int64_t batch = 10; batch <= 1000000; batch *= 10) {
+            if (batch * stride > max_elements)
+                break;
+            int reps = (int)std::max<std::int64_t>(3, 1000000 / (batch * stride));
+
+            std::vector<const float *> a_array(batch);
+            std::vector<float *> b_array(batch);
+            for (std::int64_t i = 0; i < batch; i++) {
+                a_array[i] = a + i * stride;
+                b_array[i] = b + i * stride;
+            }
+
+            auto strided = [&]() {
+                onemkl::blas::trsm_batch(queue, left, upper, nontrans, nonunit, n, n, 1.0f, a, n,
+                                         stride, b, n, stride, batch, dependencies)
+                    .wait();
+            };
+            auto group = [&]() {
+                onemkl::side side_      = left;
+                onemkl::uplo uplo_      = upper;
+                onemkl::transpose trans = nontrans;
+                onemkl::diag diag_      = nonunit;
+                float alpha             = 1.0f;
+                std::int64_t size       = n, ld = n;
+                onemkl::blas::trsm_batch(queue, &side_, &uplo_, &trans, &diag_, &size, &size,
+                                         &alpha, a_array.data(), &ld, b_array.data(), &ld, 1,
+                                         &batch, dependencies)
+                    .wait();
+            };
+            auto loop = [&]() {
+                for (std::int64_t i = 0; i < batch; i++)
+                    onemkl::blas::trsm(queue, left, upper, nontrans, nonunit, n, n, 1.0f,
+                                       a + i * stride, n, b + i * stride, n, dependencies);
+                queue.wait();
+            };
+
+            std::printf("%6lld %10lld %16.1f %16.1f %16.1f\n", (long long)n, (long long)batch,
+                        bench::median(bench::sample_ns(strided, reps, 5)) / 1000.0,
+                        bench::median(bench::sample_ns(group, reps, 5)) / 1000.0,
+                        bench::median(bench::sample_ns(loop, reps, 5)) / 1000.0);
+        }
+    }
+
+    cl::sycl::free(a, ctx);
+    cl::sycl::free(b, ctx);
+    return 0;
+}
@@ -0,0 +1,57 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_BFLOAT16_HPP_
+#define _ONEMKL_BFLOAT16_HPP_
+
+#include <cstdint>
+#include <cstring>
+
+namespace onemkl {
+
+// bfloat16: seeeeeee'emmmmmmm, the upper half of an IEEE single.
+//  Conversion from float rounds to nearest even and keeps NaNs quiet;
+//  conversion to float is exact.
+struct bfloat16 {
+    std::uint16_t raw;
+
+    bfloat16() = default;
+    bfloat16(float f) : raw(from_float(f)) {}
+    bfloat16(double d) : raw(from_float(float(d))) {}
+    bfloat16(int i) : raw(from_float(float(i))) {}
+
+    operator float() const {
+        std::uint32_t u = std::uint32_t(raw) << 16;
+        float f;
+        std::memcpy(&f, &u, sizeof(f));
+        return f;
+    }
+
+    static std::uint16_t from_float(float f) {
+        std::uint32_t u;
+        std::memcpy(&u, &f, sizeof(u));
+        if ((u & 0x7fffffffu) > 0x7f800000u)
+            return std::uint16_t((u >> 16) | 0x40u);
+        return std::uint16_t((u + 0x7fffu + ((u >> 16) & 1u)) >> 16);
+    }
+};
+
+} // namespace onemkl
+
+#endif //_ONEMKL_BFLOAT16_HPP_
@@ -21,13 +21,19 @@
 #define _ONEMKL_BLAS_HPP_
 
 #include <CL/sycl.hpp>
+#include <algorithm>
 #include <complex>
 #include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
 
 #include "onemkl/detail/config.hpp"
 #include "onemkl/types.hpp"
 
 #include "onemkl/detail/backends_selector.hpp"
+#include "onemkl/detail/exceptions.hpp"
 
 #include "onemkl/blas/predicates.hpp"
 
@@ -45,13 +51,382 @@
 namespace onemkl {
 namespace blas {
 
+// Backend management
+
+// Load the backend libraries enabled in this build and resolve their function
+//  tables, so that the first call for each does not pay for it. Libraries that
+//  cannot be loaded are skipped; preload(b) and preload(queue) throw instead.
+static inline void preload() {
+    detail::preload();
+}
+
+static inline void preload(backend b) {
+    detail::preload(b);
+}
+
+static inline void preload(cl::sycl::queue &queue) {
+    detail::preload(queue);
+}
+
+// Preload the backend for the queue and run a minimal call on it, so that the
+//  SYCL runtime and the backend library are initialized ahead of real work.
+static inline void warmup(cl::sycl::queue &queue) {
+    detail::warmup(queue);
+}
+
+// Tracing
+
+// Record every call made through the run-time dispatching API from now on:
+//  routine, precision, integer arguments (dimensions, leading dimensions,
+//  increments), backend, time spent in the call on the host and, for USM calls
+//  on queues with enable_profiling, execution time on the device. trace_stop()
+//  writes the records to path as a Chrome trace (chrome://tracing, Perfetto);
+//  so does the exit of the process if tracing is still on. Setting
+//  ONEMKL_BLAS_TRACE to a file name traces the whole process. Starting again
+//  discards the records not yet written. Each thread keeps only its last
+//  65536 calls, or ONEMKL_BLAS_TRACE_LIMIT if set when tracing starts; the
+//  number of older calls dropped is printed to stderr when the trace is
+//  written.
+static inline void trace_start(const std::string &path) {
+    detail::trace_start(path.c_str());
+}
+
+static inline void trace_stop() {
+    detail::trace_stop();
+}
+
+// Statistics
+
+// Count calls made through the run-time dispatching API, per routine and
+//  precision: calls, estimated flops and bytes, and time spent in the calls on
+//  the host. Backends that support it (mklcpu) also time the host tasks of
+//  each routine, cumulated and histogrammed (see onemkl/blas/stats.hpp), and
+//  count internal costs such as precision conversions and the setup of batch
+//  pointer arrays. Counting is per thread, without locks; stats() adds up the
+//  counters of all threads. Setting ONEMKL_BLAS_STATS to a file name counts
+//  the whole process and dumps the counters to that file at exit.
+static inline void stats_enable(bool enable = true) {
+    detail::stats_enable(enable);
+}
+
+// Counters since the start of the process or the last stats_reset().
+static inline stats_report stats() {
+    return detail::stats();
+}
+
+static inline void stats_reset() {
+    detail::stats_reset();
+}
+
+// Write stats() to path, as JSON if path ends in ".json", as CSV otherwise.
+static inline void stats_dump(const std::string &path) {
+    detail::stats_dump(path.c_str());
+}
+
+// Recording
+
+// Record the signature of every call made through the run-time dispatching API
+//  from now on to path, in a compact binary format: routine, scalar arguments,
+//  sizes of the data operands and, for the group batch APIs, the per-group
+//  arrays. Operand contents are not recorded. record_stop() closes the file;
+//  so does the exit of the process. Setting ONEMKL_BLAS_RECORD to a file name
+//  records the whole process. The onemkl_blas_replay tool re-executes a
+//  recording on any backend and times each call.
+static inline void record_start(const std::string &path) {
+    detail::record_start(path.c_str());
+}
+
+static inline void record_stop() {
+    detail::record_stop();
+}
+
+// Calls of the recording at path, in the order they were made. Throws
+//  std::runtime_error if the file is not a recording of this version of the
+//  library.
+static inline std::vector<recorded_call> record_load(const std::string &path) {
+    return detail::record_load(path.c_str());
+}
+
+// Allocate and fill synthetic operands of the recorded sizes for call, in USM
+//  shared memory or buffers on the device of queue. Diagonals are set to one
+//  and the other elements kept small, so that triangular solves stay finite.
+static inline void replay_prepare(cl::sycl::queue &queue, recorded_call &call) {
+    detail::replay_prepare(queue, call);
+}
+
+// Run a prepared call on queue and wait for it to complete. A call can run
+//  any number of times; routines that update an operand in place start from
+//  the previous result.
+static inline void replay_run(cl::sycl::queue &queue, recorded_call &call) {
+    detail::replay_run(queue, call);
+}
+
+// Free the operands allocated by replay_prepare().
+static inline void replay_release(recorded_call &call) {
+    detail::replay_release(call);
+}
+
+// Execution control
+
+// While a fused_scope is alive, USM level 1 and level 2 calls on its queue are
+//  batched by backends that support it (mklcpu): a call joins the task of the
+//  calls before it as long as that task has not started, and the calls run in
+//  order. A call with dependencies, or made after other oneMKL work was
+//  submitted on the thread, starts a new task. Kernels the application submits
+//  itself are not seen: on an in-order queue, end the scope before submitting
+//  one. The event returned by a call completes once the call has run, like
+//  outside of a scope. Scopes can nest; batching stops when the outermost
+//  scope on the queue ends.
+class fused_scope {
+public:
+    explicit fused_scope(cl::sycl::queue &queue) : queue(queue) {
+        detail::fused_begin(queue);
+    }
+
+    ~fused_scope() {
+        detail::fused_end(queue);
+    }
+
+    fused_scope(const fused_scope &) = delete;
+    fused_scope &operator=(const fused_scope &) = delete;
+
+private:
+    cl::sycl::queue &queue;
+};
+
+// Limit the number of threads each call on queue may use, so that queues
+//  running concurrently share the cores instead of each using all of them.
+//  Applies to calls submitted after it returns; 0 restores the default. Only
+//  backends running on host threads (mklcpu) use the budget. The setting does
+//  not keep queue alive, and ends with it.
+static inline void set_num_threads(cl::sycl::queue &queue, int num_threads) {
+    detail::set_num_threads(queue, num_threads);
+}
+
+// Run the calls on queue in a task arena of their own, with at most
+//  max_concurrency threads (0: all) on NUMA node numa_node (-1: any), so that
+//  work on other queues cannot starve them. Replaces set_num_threads; both
+//  values at their defaults restore the default. Needs mklcpu built with
+//  ENABLE_MKLCPU_THREAD_TBB, otherwise only max_concurrency is applied.
+static inline void set_task_arena(cl::sycl::queue &queue, int max_concurrency,
+                                  int numa_node = -1) {
+    detail::set_task_arena(queue, max_concurrency, numa_node, nullptr);
+}
+
+// Run the calls on queue in arena, a tbb::task_arena that must outlive the
+//  calls submitted while it is set. Only arena types, those with a
+//  max_concurrency() member, select this overload, so that an integer lvalue
+//  still goes to the one above.
+template <typename Arena>
+static inline auto set_task_arena(cl::sycl::queue &queue, Arena &arena)
+    -> decltype((void)arena.max_concurrency()) {
+    detail::set_task_arena(queue, 0, -1, static_cast<void *>(&arena));
+}
+
+// Packed GEMM
+
+// Size in bytes of op(A) (which = a) or op(B) (which = b) of an m x n x k GEMM
+//  in the packed layout of the backend of queue.
+template <typename T>
+std::int64_t gemm_pack_get_size(cl::sycl::queue &queue, pack_matrix which, std::int64_t m,
+                                std::int64_t n, std::int64_t k);
+
+template <>
+inline std::int64_t gemm_pack_get_size<float>(cl::sycl::queue &queue, pack_matrix which,
+                                              std::int64_t m, std::int64_t n, std::int64_t k) {
+    return detail::sgemm_pack_get_size(queue, which, m, n, k);
+}
+
+template <>
+inline std::int64_t gemm_pack_get_size<double>(cl::sycl::queue &queue, pack_matrix which,
+                                               std::int64_t m, std::int64_t n, std::int64_t k) {
+    return detail::dgemm_pack_get_size(queue, which, m, n, k);
+}
+
+// alpha * op(A) or alpha * op(B) of an m x n x k GEMM, packed once by gemm_pack
+//  so that gemm_compute can multiply it by any number of other matrices without
+//  packing it again. The layout is private to the backend of the queue it was
+//  packed on, and the handle must only be used on that queue. Copies share the
+//  packed matrix; the last one to go waits for the packing and for the
+//  gemm_compute calls made with it, then frees it.
+template <typename T>
+class gemm_pack_handle {
+public:
+    gemm_pack_handle(cl::sycl::queue &queue, pack_matrix which, transpose trans, std::int64_t m,
+                     std::int64_t n, std::int64_t k, T alpha, cl::sycl::buffer<T, 1> &src,
+                     std::int64_t ld)
+            : storage(std::make_shared<packed_storage>(queue, which, m, n, k)) {
+        storage->ready =
+            detail::gemm_pack(queue, which, trans, m, n, k, alpha, src, ld, storage->data);
+    }
+
+    gemm_pack_handle(cl::sycl::queue &queue, pack_matrix which, transpose trans, std::int64_t m,
+                     std::int64_t n, std::int64_t k, T alpha, const T *src, std::int64_t ld,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {})
+            : storage(std::make_shared<packed_storage>(queue, which, m, n, k)) {
+        storage->ready = detail::gemm_pack(queue, which, trans, m, n, k, alpha, src, ld,
+                                           storage->data, dependencies);
+    }
+
+    pack_matrix which() const {
+        return storage->which;
+    }
+
+    std::int64_t m() const {
+        return storage->m;
+    }
+
+    std::int64_t n() const {
+        return storage->n;
+    }
+
+    std::int64_t k() const {
+        return storage->k;
+    }
+
+    // Packed data, complete once ready() is.
+    const T *data() const {
+        return storage->data;
+    }
+
+    cl::sycl::event ready() const {
+        return storage->ready;
+    }
+
+    // Keep the packed data until e, a computation reading it, completes.
+    void used_by(const cl::sycl::event &e) const {
+        storage->use(e);
+    }
+
+private:
+    struct packed_storage {
+        packed_storage(cl::sycl::queue &queue, pack_matrix which, std::int64_t m, std::int64_t n,
+                       std::int64_t k)
+                : queue(queue),
+                  which(which),
+                  m(m),
+                  n(n),
+                  k(k) {
+            std::int64_t size = gemm_pack_get_size<T>(queue, which, m, n, k);
+            data              = static_cast<T *>(
+                cl::sycl::malloc_shared(size, queue.get_device(), queue.get_context()));
+            if (!data)
+                throw MemoryAllocationException("gemm_pack: cannot allocate packed matrix");
+        }
+
+        // Completed computations are dropped, so that a handle used many times
+        //  does not accumulate events.
+        void use(const cl::sycl::event &e) {
+            auto complete = [](const cl::sycl::event &u) {
+                return u.get_info<cl::sycl::info::event::command_execution_status>() ==
+                       cl::sycl::info::event_command_status::complete;
+            };
+            std::lock_guard<std::mutex> lock(mutex);
+            uses.erase(std::remove_if(uses.begin(), uses.end(), complete), uses.end());
+            uses.push_back(e);
+        }
+
+        ~packed_storage() {
+            ready.wait();
+            cl::sycl::event::wait(uses);
+            cl::sycl::free(data, queue.get_context());
+        }
+
+        packed_storage(const packed_storage &) = delete;
+        packed_storage &operator=(const packed_storage &) = delete;
+
+        cl::sycl::queue queue;
+        pack_matrix which;
+        std::int64_t m, n, k;
+        T *data;
+        cl::sycl::event ready;
+
+        std::mutex mutex;
+        cl::sycl::vector_class<cl::sycl::event> uses;
+    };
+
+    std::shared_ptr<packed_storage> storage;
+};
+
+// Pack alpha * op(src), op(A) if which is a and op(B) if which is b, for
+//  gemm_compute.
+template <typename T>
+static inline gemm_pack_handle<T> gemm_pack(cl::sycl::queue &queue, pack_matrix which,
+                                            transpose trans, std::int64_t m, std::int64_t n,
+                                            std::int64_t k, T alpha, cl::sycl::buffer<T, 1> &src,
+                                            std::int64_t ld) {
+    return gemm_pack_handle<T>(queue, which, trans, m, n, k, alpha, src, ld);
+}
+
+template <typename T>
+static inline gemm_pack_handle<T> gemm_pack(
+    cl::sycl::queue &queue, pack_matrix which, transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t k, T alpha, const T *src, std::int64_t ld,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    return gemm_pack_handle<T>(queue, which, trans, m, n, k, alpha, src, ld, dependencies);
+}
+
+// C = a * op(B) + beta * C, where a was packed with which = a, and alpha
+//  applied then.
+template <typename T>
+static inline void gemm_compute(cl::sycl::queue &queue, const gemm_pack_handle<T> &a,
+                                transpose transb, cl::sycl::buffer<T, 1> &b, std::int64_t ldb,
+                                T beta, cl::sycl::buffer<T, 1> &c, std::int64_t ldc) {
+    if (a.which() != pack_matrix::a)
+        throw InvalidArgumentsException("gemm_compute: a is not a packed A matrix");
+    a.used_by(detail::gemm_compute(queue, pack_matrix::a, transb, a.m(), a.n(), a.k(), a.data(),
+                                   b, ldb, beta, c, ldc, { a.ready() }));
+}
+
+// C = op(A) * b + beta * C, where b was packed with which = b.
+template <typename T>
+static inline void gemm_compute(cl::sycl::queue &queue, transpose transa,
+                                cl::sycl::buffer<T, 1> &a, std::int64_t lda,
+                                const gemm_pack_handle<T> &b, T beta, cl::sycl::buffer<T, 1> &c,
+                                std::int64_t ldc) {
+    if (b.which() != pack_matrix::b)
+        throw InvalidArgumentsException("gemm_compute: b is not a packed B matrix");
+    b.used_by(detail::gemm_compute(queue, pack_matrix::b, transa, b.m(), b.n(), b.k(), b.data(),
+                                   a, lda, beta, c, ldc, { b.ready() }));
+}
+
+template <typename T>
+static inline cl::sycl::event gemm_compute(
+    cl::sycl::queue &queue, const gemm_pack_handle<T> &a, transpose transb, const T *b,
+    std::int64_t ldb, T beta, T *c, std::int64_t ldc,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    if (a.which() != pack_matrix::a)
+        throw InvalidArgumentsException("gemm_compute: a is not a packed A matrix");
+    cl::sycl::vector_class<cl::sycl::event> events(dependencies);
+    events.push_back(a.ready());
+    auto done = detail::gemm_compute(queue, pack_matrix::a, transb, a.m(), a.n(), a.k(), a.data(),
+                                     b, ldb, beta, c, ldc, events);
+    a.used_by(done);
+    return done;
+}
+
+template <typename T>
+static inline cl::sycl::event gemm_compute(
+    cl::sycl::queue &queue, transpose transa, const T *a, std::int64_t lda,
+    const gemm_pack_handle<T> &b, T beta, T *c, std::int64_t ldc,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    if (b.which() != pack_matrix::b)
+        throw InvalidArgumentsException("gemm_compute: b is not a packed B matrix");
+    cl::sycl::vector_class<cl::sycl::event> events(dependencies);
+    events.push_back(b.ready());
+    auto done = detail::gemm_compute(queue, pack_matrix::b, transa, b.m(), b.n(), b.k(), b.data(),
+                                     a, lda, beta, c, ldc, events);
+    b.used_by(done);
+    return done;
+}
+
 // Buffer APIs
 
 static inline void asum(cl::sycl::queue &queue, std::int64_t n,
                         cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<float, 1> &result) {
     asum_precondition(queue, n, x, incx, result);
-    detail::asum(select_backend(queue), queue, n, x, incx, result);
+    detail::asum(queue, n, x, incx, result);
     asum_postcondition(queue, n, x, incx, result);
 }
 
@@ -59,21 +434,21 @@ static inline void asum(cl::sycl::queue &queue, std::int64_t n,
                         cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<double, 1> &result) {
     asum_precondition(queue, n, x, incx, result);
-    detail::asum(select_backend(queue), queue, n, x, incx, result);
+    detail::asum(queue, n, x, incx, result);
     asum_postcondition(queue, n, x, incx, result);
 }
 
 static inline void asum(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
                         std::int64_t incx, cl::sycl::buffer<float, 1> &result) {
     asum_precondition(queue, n, x, incx, result);
-    detail::asum(select_backend(queue), queue, n, x, incx, result);
+    detail::asum(queue, n, x, incx, result);
     asum_postcondition(queue, n, x, incx, result);
 }
 
 static inline void asum(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &x,
                         std::int64_t incx, cl::sycl::buffer<double, 1> &result) {
     asum_precondition(queue, n, x, incx, result);
-    detail::asum(select_backend(queue), queue, n, x, incx, result);
+    detail::asum(queue, n, x, incx, result);
     asum_postcondition(queue, n, x, incx, result);
 }
 
@@ -81,7 +456,7 @@ static inline void axpy(cl::sycl::queue &queue, std::int64_t n, float alpha,
                         cl::sycl::buffer<float, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
     axpy_precondition(queue, n, alpha, x, incx, y, incy);
-    detail::axpy(select_backend(queue), queue, n, alpha, x, incx, y, incy);
+    detail::axpy(queue, n, alpha, x, incx, y, incy);
     axpy_postcondition(queue, n, alpha, x, incx, y, incy);
 }
 
@@ -89,7 +464,7 @@ static inline void axpy(cl::sycl::queue &queue, std::int64_t n, double alpha,
                         cl::sycl::buffer<double, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
     axpy_precondition(queue, n, alpha, x, incx, y, incy);
-    detail::axpy(select_backend(queue), queue, n, alpha, x, incx, y, incy);
+    detail::axpy(queue, n, alpha, x, incx, y, incy);
     axpy_postcondition(queue, n, alpha, x, incx, y, incy);
 }
 
@@ -97,7 +472,7 @@ static inline void axpy(cl::sycl::queue &queue, std::int64_t n, std::complex<flo
                         cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
     axpy_precondition(queue, n, alpha, x, incx, y, incy);
-    detail::axpy(select_backend(queue), queue, n, alpha, x, incx, y, incy);
+    detail::axpy(queue, n, alpha, x, incx, y, incy);
     axpy_postcondition(queue, n, alpha, x, incx, y, incy);
 }
 
@@ -105,21 +480,57 @@ static inline void axpy(cl::sycl::queue &queue, std::int64_t n, std::complex<dou
                         cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy) {
     axpy_precondition(queue, n, alpha, x, incx, y, incy);
-    detail::axpy(select_backend(queue), queue, n, alpha, x, incx, y, incy);
+    detail::axpy(queue, n, alpha, x, incx, y, incy);
     axpy_postcondition(queue, n, alpha, x, incx, y, incy);
 }
 
+static inline void axpy_batch(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                              cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                              std::int64_t stridex, cl::sycl::buffer<float, 1> &y,
+                              std::int64_t incy, std::int64_t stridey, std::int64_t batch_size) {
+    axpy_batch_precondition(queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
+    detail::axpy_batch(queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
+    axpy_batch_postcondition(queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
+}
+
+static inline void axpy_batch(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                              cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                              std::int64_t stridex, cl::sycl::buffer<double, 1> &y,
+                              std::int64_t incy, std::int64_t stridey, std::int64_t batch_size) {
+    axpy_batch_precondition(queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
+    detail::axpy_batch(queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
+    axpy_batch_postcondition(queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
+}
+
+static inline void axpy_batch(cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
+                              cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                              std::int64_t stridex, cl::sycl::buffer<std::complex<float>, 1> &y,
+                              std::int64_t incy, std::int64_t stridey, std::int64_t batch_size) {
+    axpy_batch_precondition(queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
+    detail::axpy_batch(queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
+    axpy_batch_postcondition(queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
+}
+
+static inline void axpy_batch(cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+                              cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                              std::int64_t stridex, cl::sycl::buffer<std::complex<double>, 1> &y,
+                              std::int64_t incy, std::int64_t stridey, std::int64_t batch_size) {
+    axpy_batch_precondition(queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
+    detail::axpy_batch(queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
+    axpy_batch_postcondition(queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
+}
+
 static inline void copy(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
                         std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
     copy_precondition(queue, n, x, incx, y, incy);
-    detail::copy(select_backend(queue), queue, n, x, incx, y, incy);
+    detail::copy(queue, n, x, incx, y, incy);
     copy_postcondition(queue, n, x, incx, y, incy);
 }
 
 static inline void copy(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &x,
                         std::int64_t incx, cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
     copy_precondition(queue, n, x, incx, y, incy);
-    detail::copy(select_backend(queue), queue, n, x, incx, y, incy);
+    detail::copy(queue, n, x, incx, y, incy);
     copy_postcondition(queue, n, x, incx, y, incy);
 }
 
@@ -127,7 +538,7 @@ static inline void copy(cl::sycl::queue &queue, std::int64_t n,
                         cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
     copy_precondition(queue, n, x, incx, y, incy);
-    detail::copy(select_backend(queue), queue, n, x, incx, y, incy);
+    detail::copy(queue, n, x, incx, y, incy);
     copy_postcondition(queue, n, x, incx, y, incy);
 }
 
@@ -135,7 +546,7 @@ static inline void copy(cl::sycl::queue &queue, std::int64_t n,
                         cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy) {
     copy_precondition(queue, n, x, incx, y, incy);
-    detail::copy(select_backend(queue), queue, n, x, incx, y, incy);
+    detail::copy(queue, n, x, incx, y, incy);
     copy_postcondition(queue, n, x, incx, y, incy);
 }
 
@@ -143,7 +554,7 @@ static inline void dot(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<
                        std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
                        cl::sycl::buffer<float, 1> &result) {
     dot_precondition(queue, n, x, incx, y, incy, result);
-    detail::dot(select_backend(queue), queue, n, x, incx, y, incy, result);
+    detail::dot(queue, n, x, incx, y, incy, result);
     dot_postcondition(queue, n, x, incx, y, incy, result);
 }
 
@@ -151,7 +562,7 @@ static inline void dot(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<
                        std::int64_t incx, cl::sycl::buffer<double, 1> &y, std::int64_t incy,
                        cl::sycl::buffer<double, 1> &result) {
     dot_precondition(queue, n, x, incx, y, incy, result);
-    detail::dot(select_backend(queue), queue, n, x, incx, y, incy, result);
+    detail::dot(queue, n, x, incx, y, incy, result);
     dot_postcondition(queue, n, x, incx, y, incy, result);
 }
 
@@ -159,7 +570,7 @@ static inline void dot(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<
                        std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
                        cl::sycl::buffer<double, 1> &result) {
     dot_precondition(queue, n, x, incx, y, incy, result);
-    detail::dot(select_backend(queue), queue, n, x, incx, y, incy, result);
+    detail::dot(queue, n, x, incx, y, incy, result);
     dot_postcondition(queue, n, x, incx, y, incy, result);
 }
 
@@ -168,7 +579,7 @@ static inline void dotc(cl::sycl::queue &queue, std::int64_t n,
                         cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
                         cl::sycl::buffer<std::complex<float>, 1> &result) {
     dotc_precondition(queue, n, x, incx, y, incy, result);
-    detail::dotc(select_backend(queue), queue, n, x, incx, y, incy, result);
+    detail::dotc(queue, n, x, incx, y, incy, result);
     dotc_postcondition(queue, n, x, incx, y, incy, result);
 }
 
@@ -177,7 +588,7 @@ static inline void dotc(cl::sycl::queue &queue, std::int64_t n,
                         cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
                         cl::sycl::buffer<std::complex<double>, 1> &result) {
     dotc_precondition(queue, n, x, incx, y, incy, result);
-    detail::dotc(select_backend(queue), queue, n, x, incx, y, incy, result);
+    detail::dotc(queue, n, x, incx, y, incy, result);
     dotc_postcondition(queue, n, x, incx, y, incy, result);
 }
 
@@ -186,7 +597,7 @@ static inline void dotu(cl::sycl::queue &queue, std::int64_t n,
                         cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
                         cl::sycl::buffer<std::complex<float>, 1> &result) {
     dotu_precondition(queue, n, x, incx, y, incy, result);
-    detail::dotu(select_backend(queue), queue, n, x, incx, y, incy, result);
+    detail::dotu(queue, n, x, incx, y, incy, result);
     dotu_postcondition(queue, n, x, incx, y, incy, result);
 }
 
@@ -195,7 +606,7 @@ static inline void dotu(cl::sycl::queue &queue, std::int64_t n,
                         cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
                         cl::sycl::buffer<std::complex<double>, 1> &result) {
     dotu_precondition(queue, n, x, incx, y, incy, result);
-    detail::dotu(select_backend(queue), queue, n, x, incx, y, incy, result);
+    detail::dotu(queue, n, x, incx, y, incy, result);
     dotu_postcondition(queue, n, x, incx, y, incy, result);
 }
 
@@ -205,8 +616,7 @@ static inline void gbmv(cl::sycl::queue &queue, transpose trans, std::int64_t m,
                         cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
                         cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
     gbmv_precondition(queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy);
-    detail::gbmv(select_backend(queue), queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y,
-                 incy);
+    detail::gbmv(queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy);
     gbmv_postcondition(queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy);
 }
 
@@ -216,8 +626,7 @@ static inline void gbmv(cl::sycl::queue &queue, transpose trans, std::int64_t m,
                         cl::sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
                         cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
     gbmv_precondition(queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy);
-    detail::gbmv(select_backend(queue), queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y,
-                 incy);
+    detail::gbmv(queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy);
     gbmv_postcondition(queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy);
 }
 
@@ -228,8 +637,7 @@ static inline void gbmv(cl::sycl::queue &queue, transpose trans, std::int64_t m,
                         std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &y,
                         std::int64_t incy) {
     gbmv_precondition(queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy);
-    detail::gbmv(select_backend(queue), queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y,
-                 incy);
+    detail::gbmv(queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy);
     gbmv_postcondition(queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy);
 }
 
@@ -240,8 +648,7 @@ static inline void gbmv(cl::sycl::queue &queue, transpose trans, std::int64_t m,
                         std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &y,
                         std::int64_t incy) {
     gbmv_precondition(queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy);
-    detail::gbmv(select_backend(queue), queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y,
-                 incy);
+    detail::gbmv(queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy);
     gbmv_postcondition(queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy);
 }
 
@@ -250,8 +657,7 @@ static inline void gemm(cl::sycl::queue &queue, transpose transa, transpose tran
                         std::int64_t lda, cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
                         float beta, cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
     gemm_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
-    detail::gemm(select_backend(queue), queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta,
-                 c, ldc);
+    detail::gemm(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
     gemm_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
@@ -261,8 +667,7 @@ static inline void gemm(cl::sycl::queue &queue, transpose transa, transpose tran
                         cl::sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
                         cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
     gemm_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
-    detail::gemm(select_backend(queue), queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta,
-                 c, ldc);
+    detail::gemm(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
     gemm_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
@@ -273,8 +678,7 @@ static inline void gemm(cl::sycl::queue &queue, transpose transa, transpose tran
                         std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c,
                         std::int64_t ldc) {
     gemm_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
-    detail::gemm(select_backend(queue), queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta,
-                 c, ldc);
+    detail::gemm(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
     gemm_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
@@ -285,8 +689,7 @@ static inline void gemm(cl::sycl::queue &queue, transpose transa, transpose tran
                         std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c,
                         std::int64_t ldc) {
     gemm_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
-    detail::gemm(select_backend(queue), queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta,
-                 c, ldc);
+    detail::gemm(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
     gemm_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
@@ -295,8 +698,17 @@ static inline void gemm(cl::sycl::queue &queue, transpose transa, transpose tran
                         std::int64_t lda, cl::sycl::buffer<half, 1> &b, std::int64_t ldb, half beta,
                         cl::sycl::buffer<half, 1> &c, std::int64_t ldc) {
     gemm_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
-    detail::gemm(select_backend(queue), queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta,
-                 c, ldc);
+    detail::gemm(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    gemm_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+static inline void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                        std::int64_t n, std::int64_t k, bfloat16 alpha,
+                        cl::sycl::buffer<bfloat16, 1> &a, std::int64_t lda,
+                        cl::sycl::buffer<bfloat16, 1> &b, std::int64_t ldb, bfloat16 beta,
+                        cl::sycl::buffer<bfloat16, 1> &c, std::int64_t ldc) {
+    gemm_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    detail::gemm(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
     gemm_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
@@ -309,8 +721,8 @@ static inline void gemm_batch(cl::sycl::queue &queue, transpose transa, transpos
                               std::int64_t stride_c, std::int64_t batch_size) {
     gemm_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
                             stride_b, beta, c, ldc, stride_c, batch_size);
-    detail::gemm_batch(select_backend(queue), queue, transa, transb, m, n, k, alpha, a, lda,
-                       stride_a, b, ldb, stride_b, beta, c, ldc, stride_c, batch_size);
+    detail::gemm_batch(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b,
+                       beta, c, ldc, stride_c, batch_size);
     gemm_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
                              stride_b, beta, c, ldc, stride_c, batch_size);
 }
@@ -324,8 +736,8 @@ static inline void gemm_batch(cl::sycl::queue &queue, transpose transa, transpos
                               std::int64_t stride_c, std::int64_t batch_size) {
     gemm_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
                             stride_b, beta, c, ldc, stride_c, batch_size);
-    detail::gemm_batch(select_backend(queue), queue, transa, transb, m, n, k, alpha, a, lda,
-                       stride_a, b, ldb, stride_b, beta, c, ldc, stride_c, batch_size);
+    detail::gemm_batch(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b,
+                       beta, c, ldc, stride_c, batch_size);
     gemm_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
                              stride_b, beta, c, ldc, stride_c, batch_size);
 }
@@ -340,8 +752,8 @@ static inline void gemm_batch(cl::sycl::queue &queue, transpose transa, transpos
                               std::int64_t stride_c, std::int64_t batch_size) {
     gemm_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
                             stride_b, beta, c, ldc, stride_c, batch_size);
-    detail::gemm_batch(select_backend(queue), queue, transa, transb, m, n, k, alpha, a, lda,
-                       stride_a, b, ldb, stride_b, beta, c, ldc, stride_c, batch_size);
+    detail::gemm_batch(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b,
+                       beta, c, ldc, stride_c, batch_size);
     gemm_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
                              stride_b, beta, c, ldc, stride_c, batch_size);
 }
@@ -356,8 +768,8 @@ static inline void gemm_batch(cl::sycl::queue &queue, transpose transa, transpos
                               std::int64_t stride_c, std::int64_t batch_size) {
     gemm_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
                             stride_b, beta, c, ldc, stride_c, batch_size);
-    detail::gemm_batch(select_backend(queue), queue, transa, transb, m, n, k, alpha, a, lda,
-                       stride_a, b, ldb, stride_b, beta, c, ldc, stride_c, batch_size);
+    detail::gemm_batch(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b,
+                       beta, c, ldc, stride_c, batch_size);
     gemm_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
                              stride_b, beta, c, ldc, stride_c, batch_size);
 }
@@ -368,8 +780,17 @@ static inline void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose
                             cl::sycl::buffer<half, 1> &b, std::int64_t ldb, float beta,
                             cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
     gemm_ext_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
-    detail::gemm_ext(select_backend(queue), queue, transa, transb, m, n, k, alpha, a, lda, b, ldb,
-                     beta, c, ldc);
+    detail::gemm_ext(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    gemm_ext_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+static inline void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb,
+                            std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                            cl::sycl::buffer<bfloat16, 1> &a, std::int64_t lda,
+                            cl::sycl::buffer<bfloat16, 1> &b, std::int64_t ldb, float beta,
+                            cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+    gemm_ext_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    detail::gemm_ext(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
     gemm_ext_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
@@ -381,8 +802,8 @@ static inline void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose
                             std::int64_t ldc, cl::sycl::buffer<int32_t, 1> &co) {
     gemm_ext_precondition(queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo,
                           beta, c, ldc, co);
-    detail::gemm_ext(select_backend(queue), queue, transa, transb, offsetc, m, n, k, alpha, a, lda,
-                     ao, b, ldb, bo, beta, c, ldc, co);
+    detail::gemm_ext(queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo, beta,
+                     c, ldc, co);
     gemm_ext_postcondition(queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo,
                            beta, c, ldc, co);
 }
@@ -393,8 +814,7 @@ static inline void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose
                             cl::sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
                             cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
     gemm_ext_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
-    detail::gemm_ext(select_backend(queue), queue, transa, transb, m, n, k, alpha, a, lda, b, ldb,
-                     beta, c, ldc);
+    detail::gemm_ext(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
     gemm_ext_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
@@ -404,8 +824,7 @@ static inline void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose
                             cl::sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
                             cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
     gemm_ext_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
-    detail::gemm_ext(select_backend(queue), queue, transa, transb, m, n, k, alpha, a, lda, b, ldb,
-                     beta, c, ldc);
+    detail::gemm_ext(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
     gemm_ext_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
@@ -416,8 +835,7 @@ static inline void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose
                             std::int64_t ldb, std::complex<float> beta,
                             cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
     gemm_ext_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
-    detail::gemm_ext(select_backend(queue), queue, transa, transb, m, n, k, alpha, a, lda, b, ldb,
-                     beta, c, ldc);
+    detail::gemm_ext(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
     gemm_ext_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
@@ -429,8 +847,7 @@ static inline void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose
                             std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c,
                             std::int64_t ldc) {
     gemm_ext_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
-    detail::gemm_ext(select_backend(queue), queue, transa, transb, m, n, k, alpha, a, lda, b, ldb,
-                     beta, c, ldc);
+    detail::gemm_ext(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
     gemm_ext_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
@@ -440,8 +857,7 @@ static inline void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose
                             cl::sycl::buffer<half, 1> &b, std::int64_t ldb, half beta,
                             cl::sycl::buffer<half, 1> &c, std::int64_t ldc) {
     gemm_ext_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
-    detail::gemm_ext(select_backend(queue), queue, transa, transb, m, n, k, alpha, a, lda, b, ldb,
-                     beta, c, ldc);
+    detail::gemm_ext(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
     gemm_ext_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
@@ -452,8 +868,7 @@ static inline void gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose tra
                          cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
     gemmt_precondition(queue, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c,
                        ldc);
-    detail::gemmt(select_backend(queue), queue, upper_lower, transa, transb, n, k, alpha, a, lda, b,
-                  ldb, beta, c, ldc);
+    detail::gemmt(queue, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
     gemmt_postcondition(queue, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c,
                         ldc);
 }
@@ -465,8 +880,7 @@ static inline void gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose tra
                          cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
     gemmt_precondition(queue, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c,
                        ldc);
-    detail::gemmt(select_backend(queue), queue, upper_lower, transa, transb, n, k, alpha, a, lda, b,
-                  ldb, beta, c, ldc);
+    detail::gemmt(queue, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
     gemmt_postcondition(queue, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c,
                         ldc);
 }
@@ -479,8 +893,7 @@ static inline void gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose tra
                          cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
     gemmt_precondition(queue, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c,
                        ldc);
-    detail::gemmt(select_backend(queue), queue, upper_lower, transa, transb, n, k, alpha, a, lda, b,
-                  ldb, beta, c, ldc);
+    detail::gemmt(queue, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
     gemmt_postcondition(queue, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c,
                         ldc);
 }
@@ -493,8 +906,7 @@ static inline void gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose tra
                          cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
     gemmt_precondition(queue, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c,
                        ldc);
-    detail::gemmt(select_backend(queue), queue, upper_lower, transa, transb, n, k, alpha, a, lda, b,
-                  ldb, beta, c, ldc);
+    detail::gemmt(queue, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
     gemmt_postcondition(queue, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c,
                         ldc);
 }
@@ -504,7 +916,7 @@ static inline void gemv(cl::sycl::queue &queue, transpose trans, std::int64_t m,
                         cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
                         cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
     gemv_precondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
-    detail::gemv(select_backend(queue), queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+    detail::gemv(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
     gemv_postcondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
 }
 
@@ -513,7 +925,7 @@ static inline void gemv(cl::sycl::queue &queue, transpose trans, std::int64_t m,
                         cl::sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
                         cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
     gemv_precondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
-    detail::gemv(select_backend(queue), queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+    detail::gemv(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
     gemv_postcondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
 }
 
@@ -523,7 +935,7 @@ static inline void gemv(cl::sycl::queue &queue, transpose trans, std::int64_t m,
                         std::int64_t incx, std::complex<float> beta,
                         cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
     gemv_precondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
-    detail::gemv(select_backend(queue), queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+    detail::gemv(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
     gemv_postcondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
 }
 
@@ -533,7 +945,7 @@ static inline void gemv(cl::sycl::queue &queue, transpose trans, std::int64_t m,
                         std::int64_t incx, std::complex<double> beta,
                         cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy) {
     gemv_precondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
-    detail::gemv(select_backend(queue), queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+    detail::gemv(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
     gemv_postcondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
 }
 
@@ -542,7 +954,7 @@ static inline void ger(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, f
                        cl::sycl::buffer<float, 1> &y, std::int64_t incy,
                        cl::sycl::buffer<float, 1> &a, std::int64_t lda) {
     ger_precondition(queue, m, n, alpha, x, incx, y, incy, a, lda);
-    detail::ger(select_backend(queue), queue, m, n, alpha, x, incx, y, incy, a, lda);
+    detail::ger(queue, m, n, alpha, x, incx, y, incy, a, lda);
     ger_postcondition(queue, m, n, alpha, x, incx, y, incy, a, lda);
 }
 
@@ -551,7 +963,7 @@ static inline void ger(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, d
                        cl::sycl::buffer<double, 1> &y, std::int64_t incy,
                        cl::sycl::buffer<double, 1> &a, std::int64_t lda) {
     ger_precondition(queue, m, n, alpha, x, incx, y, incy, a, lda);
-    detail::ger(select_backend(queue), queue, m, n, alpha, x, incx, y, incy, a, lda);
+    detail::ger(queue, m, n, alpha, x, incx, y, incy, a, lda);
     ger_postcondition(queue, m, n, alpha, x, incx, y, incy, a, lda);
 }
 
@@ -561,7 +973,7 @@ static inline void gerc(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
                         std::int64_t incy, cl::sycl::buffer<std::complex<float>, 1> &a,
                         std::int64_t lda) {
     gerc_precondition(queue, m, n, alpha, x, incx, y, incy, a, lda);
-    detail::gerc(select_backend(queue), queue, m, n, alpha, x, incx, y, incy, a, lda);
+    detail::gerc(queue, m, n, alpha, x, incx, y, incy, a, lda);
     gerc_postcondition(queue, m, n, alpha, x, incx, y, incy, a, lda);
 }
 
@@ -571,7 +983,7 @@ static inline void gerc(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
                         std::int64_t incy, cl::sycl::buffer<std::complex<double>, 1> &a,
                         std::int64_t lda) {
     gerc_precondition(queue, m, n, alpha, x, incx, y, incy, a, lda);
-    detail::gerc(select_backend(queue), queue, m, n, alpha, x, incx, y, incy, a, lda);
+    detail::gerc(queue, m, n, alpha, x, incx, y, incy, a, lda);
     gerc_postcondition(queue, m, n, alpha, x, incx, y, incy, a, lda);
 }
 
@@ -581,7 +993,7 @@ static inline void geru(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
                         std::int64_t incy, cl::sycl::buffer<std::complex<float>, 1> &a,
                         std::int64_t lda) {
     geru_precondition(queue, m, n, alpha, x, incx, y, incy, a, lda);
-    detail::geru(select_backend(queue), queue, m, n, alpha, x, incx, y, incy, a, lda);
+    detail::geru(queue, m, n, alpha, x, incx, y, incy, a, lda);
     geru_postcondition(queue, m, n, alpha, x, incx, y, incy, a, lda);
 }
 
@@ -591,7 +1003,7 @@ static inline void geru(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
                         std::int64_t incy, cl::sycl::buffer<std::complex<double>, 1> &a,
                         std::int64_t lda) {
     geru_precondition(queue, m, n, alpha, x, incx, y, incy, a, lda);
-    detail::geru(select_backend(queue), queue, m, n, alpha, x, incx, y, incy, a, lda);
+    detail::geru(queue, m, n, alpha, x, incx, y, incy, a, lda);
     geru_postcondition(queue, m, n, alpha, x, incx, y, incy, a, lda);
 }
 
@@ -601,8 +1013,7 @@ static inline void hbmv(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n
                         std::int64_t incx, std::complex<float> beta,
                         cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
     hbmv_precondition(queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy);
-    detail::hbmv(select_backend(queue), queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y,
-                 incy);
+    detail::hbmv(queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy);
     hbmv_postcondition(queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy);
 }
 
@@ -612,8 +1023,7 @@ static inline void hbmv(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n
                         std::int64_t incx, std::complex<double> beta,
                         cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy) {
     hbmv_precondition(queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy);
-    detail::hbmv(select_backend(queue), queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y,
-                 incy);
+    detail::hbmv(queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy);
     hbmv_postcondition(queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy);
 }
 
@@ -624,8 +1034,7 @@ static inline void hemm(cl::sycl::queue &queue, side left_right, uplo upper_lowe
                         std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c,
                         std::int64_t ldc) {
     hemm_precondition(queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
-    detail::hemm(select_backend(queue), queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb,
-                 beta, c, ldc);
+    detail::hemm(queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
     hemm_postcondition(queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
@@ -636,8 +1045,7 @@ static inline void hemm(cl::sycl::queue &queue, side left_right, uplo upper_lowe
                         std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c,
                         std::int64_t ldc) {
     hemm_precondition(queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
-    detail::hemm(select_backend(queue), queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb,
-                 beta, c, ldc);
+    detail::hemm(queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
     hemm_postcondition(queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
@@ -647,8 +1055,7 @@ static inline void hemv(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n
                         std::int64_t incx, std::complex<float> beta,
                         cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
     hemv_precondition(queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy);
-    detail::hemv(select_backend(queue), queue, upper_lower, n, alpha, a, lda, x, incx, beta, y,
-                 incy);
+    detail::hemv(queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy);
     hemv_postcondition(queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy);
 }
 
@@ -658,8 +1065,7 @@ static inline void hemv(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n
                         std::int64_t incx, std::complex<double> beta,
                         cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy) {
     hemv_precondition(queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy);
-    detail::hemv(select_backend(queue), queue, upper_lower, n, alpha, a, lda, x, incx, beta, y,
-                 incy);
+    detail::hemv(queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy);
     hemv_postcondition(queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy);
 }
 
@@ -667,7 +1073,7 @@ static inline void her(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
                        cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
                        cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda) {
     her_precondition(queue, upper_lower, n, alpha, x, incx, a, lda);
-    detail::her(select_backend(queue), queue, upper_lower, n, alpha, x, incx, a, lda);
+    detail::her(queue, upper_lower, n, alpha, x, incx, a, lda);
     her_postcondition(queue, upper_lower, n, alpha, x, incx, a, lda);
 }
 
@@ -675,7 +1081,7 @@ static inline void her(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
                        cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
                        cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda) {
     her_precondition(queue, upper_lower, n, alpha, x, incx, a, lda);
-    detail::her(select_backend(queue), queue, upper_lower, n, alpha, x, incx, a, lda);
+    detail::her(queue, upper_lower, n, alpha, x, incx, a, lda);
     her_postcondition(queue, upper_lower, n, alpha, x, incx, a, lda);
 }
 
@@ -685,7 +1091,7 @@ static inline void her2(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n
                         std::int64_t incy, cl::sycl::buffer<std::complex<float>, 1> &a,
                         std::int64_t lda) {
     her2_precondition(queue, upper_lower, n, alpha, x, incx, y, incy, a, lda);
-    detail::her2(select_backend(queue), queue, upper_lower, n, alpha, x, incx, y, incy, a, lda);
+    detail::her2(queue, upper_lower, n, alpha, x, incx, y, incy, a, lda);
     her2_postcondition(queue, upper_lower, n, alpha, x, incx, y, incy, a, lda);
 }
 
@@ -695,7 +1101,7 @@ static inline void her2(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n
                         std::int64_t incy, cl::sycl::buffer<std::complex<double>, 1> &a,
                         std::int64_t lda) {
     her2_precondition(queue, upper_lower, n, alpha, x, incx, y, incy, a, lda);
-    detail::her2(select_backend(queue), queue, upper_lower, n, alpha, x, incx, y, incy, a, lda);
+    detail::her2(queue, upper_lower, n, alpha, x, incx, y, incy, a, lda);
     her2_postcondition(queue, upper_lower, n, alpha, x, incx, y, incy, a, lda);
 }
 
@@ -705,8 +1111,7 @@ static inline void her2k(cl::sycl::queue &queue, uplo upper_lower, transpose tra
                          cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, float beta,
                          cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
     her2k_precondition(queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
-    detail::her2k(select_backend(queue), queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb,
-                  beta, c, ldc);
+    detail::her2k(queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
     her2k_postcondition(queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
@@ -717,8 +1122,7 @@ static inline void her2k(cl::sycl::queue &queue, uplo upper_lower, transpose tra
                          double beta, cl::sycl::buffer<std::complex<double>, 1> &c,
                          std::int64_t ldc) {
     her2k_precondition(queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
-    detail::her2k(select_backend(queue), queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb,
-                  beta, c, ldc);
+    detail::her2k(queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
     her2k_postcondition(queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
@@ -727,8 +1131,7 @@ static inline void herk(cl::sycl::queue &queue, uplo upper_lower, transpose tran
                         std::int64_t lda, float beta, cl::sycl::buffer<std::complex<float>, 1> &c,
                         std::int64_t ldc) {
     herk_precondition(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
-    detail::herk(select_backend(queue), queue, upper_lower, trans, n, k, alpha, a, lda, beta, c,
-                 ldc);
+    detail::herk(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
     herk_postcondition(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
 }
 
@@ -737,8 +1140,7 @@ static inline void herk(cl::sycl::queue &queue, uplo upper_lower, transpose tran
                         std::int64_t lda, double beta, cl::sycl::buffer<std::complex<double>, 1> &c,
                         std::int64_t ldc) {
     herk_precondition(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
-    detail::herk(select_backend(queue), queue, upper_lower, trans, n, k, alpha, a, lda, beta, c,
-                 ldc);
+    detail::herk(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
     herk_postcondition(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
 }
 
@@ -748,7 +1150,7 @@ static inline void hpmv(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n
                         std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &y,
                         std::int64_t incy) {
     hpmv_precondition(queue, upper_lower, n, alpha, a, x, incx, beta, y, incy);
-    detail::hpmv(select_backend(queue), queue, upper_lower, n, alpha, a, x, incx, beta, y, incy);
+    detail::hpmv(queue, upper_lower, n, alpha, a, x, incx, beta, y, incy);
     hpmv_postcondition(queue, upper_lower, n, alpha, a, x, incx, beta, y, incy);
 }
 
@@ -758,7 +1160,7 @@ static inline void hpmv(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n
                         std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &y,
                         std::int64_t incy) {
     hpmv_precondition(queue, upper_lower, n, alpha, a, x, incx, beta, y, incy);
-    detail::hpmv(select_backend(queue), queue, upper_lower, n, alpha, a, x, incx, beta, y, incy);
+    detail::hpmv(queue, upper_lower, n, alpha, a, x, incx, beta, y, incy);
     hpmv_postcondition(queue, upper_lower, n, alpha, a, x, incx, beta, y, incy);
 }
 
@@ -766,7 +1168,7 @@ static inline void hpr(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
                        cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
                        cl::sycl::buffer<std::complex<float>, 1> &a) {
     hpr_precondition(queue, upper_lower, n, alpha, x, incx, a);
-    detail::hpr(select_backend(queue), queue, upper_lower, n, alpha, x, incx, a);
+    detail::hpr(queue, upper_lower, n, alpha, x, incx, a);
     hpr_postcondition(queue, upper_lower, n, alpha, x, incx, a);
 }
 
@@ -774,7 +1176,7 @@ static inline void hpr(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
                        cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
                        cl::sycl::buffer<std::complex<double>, 1> &a) {
     hpr_precondition(queue, upper_lower, n, alpha, x, incx, a);
-    detail::hpr(select_backend(queue), queue, upper_lower, n, alpha, x, incx, a);
+    detail::hpr(queue, upper_lower, n, alpha, x, incx, a);
     hpr_postcondition(queue, upper_lower, n, alpha, x, incx, a);
 }
 
@@ -783,7 +1185,7 @@ static inline void hpr2(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n
                         std::int64_t incx, cl::sycl::buffer<std::complex<float>, 1> &y,
                         std::int64_t incy, cl::sycl::buffer<std::complex<float>, 1> &a) {
     hpr2_precondition(queue, upper_lower, n, alpha, x, incx, y, incy, a);
-    detail::hpr2(select_backend(queue), queue, upper_lower, n, alpha, x, incx, y, incy, a);
+    detail::hpr2(queue, upper_lower, n, alpha, x, incx, y, incy, a);
     hpr2_postcondition(queue, upper_lower, n, alpha, x, incx, y, incy, a);
 }
 
@@ -792,21 +1194,21 @@ static inline void hpr2(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n
                         std::int64_t incx, cl::sycl::buffer<std::complex<double>, 1> &y,
                         std::int64_t incy, cl::sycl::buffer<std::complex<double>, 1> &a) {
     hpr2_precondition(queue, upper_lower, n, alpha, x, incx, y, incy, a);
-    detail::hpr2(select_backend(queue), queue, upper_lower, n, alpha, x, incx, y, incy, a);
+    detail::hpr2(queue, upper_lower, n, alpha, x, incx, y, incy, a);
     hpr2_postcondition(queue, upper_lower, n, alpha, x, incx, y, incy, a);
 }
 
 static inline void iamax(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
                          std::int64_t incx, cl::sycl::buffer<std::int64_t, 1> &result) {
     iamax_precondition(queue, n, x, incx, result);
-    detail::iamax(select_backend(queue), queue, n, x, incx, result);
+    detail::iamax(queue, n, x, incx, result);
     iamax_postcondition(queue, n, x, incx, result);
 }
 
 static inline void iamax(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &x,
                          std::int64_t incx, cl::sycl::buffer<std::int64_t, 1> &result) {
     iamax_precondition(queue, n, x, incx, result);
-    detail::iamax(select_backend(queue), queue, n, x, incx, result);
+    detail::iamax(queue, n, x, incx, result);
     iamax_postcondition(queue, n, x, incx, result);
 }
 
@@ -814,7 +1216,7 @@ static inline void iamax(cl::sycl::queue &queue, std::int64_t n,
                          cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
                          cl::sycl::buffer<std::int64_t, 1> &result) {
     iamax_precondition(queue, n, x, incx, result);
-    detail::iamax(select_backend(queue), queue, n, x, incx, result);
+    detail::iamax(queue, n, x, incx, result);
     iamax_postcondition(queue, n, x, incx, result);
 }
 
@@ -822,21 +1224,21 @@ static inline void iamax(cl::sycl::queue &queue, std::int64_t n,
                          cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
                          cl::sycl::buffer<std::int64_t, 1> &result) {
     iamax_precondition(queue, n, x, incx, result);
-    detail::iamax(select_backend(queue), queue, n, x, incx, result);
+    detail::iamax(queue, n, x, incx, result);
     iamax_postcondition(queue, n, x, incx, result);
 }
 
 static inline void iamin(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
                          std::int64_t incx, cl::sycl::buffer<std::int64_t, 1> &result) {
     iamin_precondition(queue, n, x, incx, result);
-    detail::iamin(select_backend(queue), queue, n, x, incx, result);
+    detail::iamin(queue, n, x, incx, result);
     iamin_postcondition(queue, n, x, incx, result);
 }
 
 static inline void iamin(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &x,
                          std::int64_t incx, cl::sycl::buffer<std::int64_t, 1> &result) {
     iamin_precondition(queue, n, x, incx, result);
-    detail::iamin(select_backend(queue), queue, n, x, incx, result);
+    detail::iamin(queue, n, x, incx, result);
     iamin_postcondition(queue, n, x, incx, result);
 }
 
@@ -844,7 +1246,7 @@ static inline void iamin(cl::sycl::queue &queue, std::int64_t n,
                          cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
                          cl::sycl::buffer<std::int64_t, 1> &result) {
     iamin_precondition(queue, n, x, incx, result);
-    detail::iamin(select_backend(queue), queue, n, x, incx, result);
+    detail::iamin(queue, n, x, incx, result);
     iamin_postcondition(queue, n, x, incx, result);
 }
 
@@ -852,7 +1254,7 @@ static inline void iamin(cl::sycl::queue &queue, std::int64_t n,
                          cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
                          cl::sycl::buffer<std::int64_t, 1> &result) {
     iamin_precondition(queue, n, x, incx, result);
-    detail::iamin(select_backend(queue), queue, n, x, incx, result);
+    detail::iamin(queue, n, x, incx, result);
     iamin_postcondition(queue, n, x, incx, result);
 }
 
@@ -860,7 +1262,7 @@ static inline void nrm2(cl::sycl::queue &queue, std::int64_t n,
                         cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<float, 1> &result) {
     nrm2_precondition(queue, n, x, incx, result);
-    detail::nrm2(select_backend(queue), queue, n, x, incx, result);
+    detail::nrm2(queue, n, x, incx, result);
     nrm2_postcondition(queue, n, x, incx, result);
 }
 
@@ -868,21 +1270,21 @@ static inline void nrm2(cl::sycl::queue &queue, std::int64_t n,
                         cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<double, 1> &result) {
     nrm2_precondition(queue, n, x, incx, result);
-    detail::nrm2(select_backend(queue), queue, n, x, incx, result);
+    detail::nrm2(queue, n, x, incx, result);
     nrm2_postcondition(queue, n, x, incx, result);
 }
 
 static inline void nrm2(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
                         std::int64_t incx, cl::sycl::buffer<float, 1> &result) {
     nrm2_precondition(queue, n, x, incx, result);
-    detail::nrm2(select_backend(queue), queue, n, x, incx, result);
+    detail::nrm2(queue, n, x, incx, result);
     nrm2_postcondition(queue, n, x, incx, result);
 }
 
 static inline void nrm2(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &x,
                         std::int64_t incx, cl::sycl::buffer<double, 1> &result) {
     nrm2_precondition(queue, n, x, incx, result);
-    detail::nrm2(select_backend(queue), queue, n, x, incx, result);
+    detail::nrm2(queue, n, x, incx, result);
     nrm2_postcondition(queue, n, x, incx, result);
 }
 
@@ -891,7 +1293,7 @@ static inline void rot(cl::sycl::queue &queue, std::int64_t n,
                        cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy, float c,
                        float s) {
     rot_precondition(queue, n, x, incx, y, incy, c, s);
-    detail::rot(select_backend(queue), queue, n, x, incx, y, incy, c, s);
+    detail::rot(queue, n, x, incx, y, incy, c, s);
     rot_postcondition(queue, n, x, incx, y, incy, c, s);
 }
 
@@ -900,7 +1302,7 @@ static inline void rot(cl::sycl::queue &queue, std::int64_t n,
                        cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy, double c,
                        double s) {
     rot_precondition(queue, n, x, incx, y, incy, c, s);
-    detail::rot(select_backend(queue), queue, n, x, incx, y, incy, c, s);
+    detail::rot(queue, n, x, incx, y, incy, c, s);
     rot_postcondition(queue, n, x, incx, y, incy, c, s);
 }
 
@@ -908,7 +1310,7 @@ static inline void rot(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<
                        std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy, float c,
                        float s) {
     rot_precondition(queue, n, x, incx, y, incy, c, s);
-    detail::rot(select_backend(queue), queue, n, x, incx, y, incy, c, s);
+    detail::rot(queue, n, x, incx, y, incy, c, s);
     rot_postcondition(queue, n, x, incx, y, incy, c, s);
 }
 
@@ -916,7 +1318,7 @@ static inline void rot(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<
                        std::int64_t incx, cl::sycl::buffer<double, 1> &y, std::int64_t incy,
                        double c, double s) {
     rot_precondition(queue, n, x, incx, y, incy, c, s);
-    detail::rot(select_backend(queue), queue, n, x, incx, y, incy, c, s);
+    detail::rot(queue, n, x, incx, y, incy, c, s);
     rot_postcondition(queue, n, x, incx, y, incy, c, s);
 }
 
@@ -924,7 +1326,7 @@ static inline void rotg(cl::sycl::queue &queue, cl::sycl::buffer<float, 1> &a,
                         cl::sycl::buffer<float, 1> &b, cl::sycl::buffer<float, 1> &c,
                         cl::sycl::buffer<float, 1> &s) {
     rotg_precondition(queue, a, b, c, s);
-    detail::rotg(select_backend(queue), queue, a, b, c, s);
+    detail::rotg(queue, a, b, c, s);
     rotg_postcondition(queue, a, b, c, s);
 }
 
@@ -932,7 +1334,7 @@ static inline void rotg(cl::sycl::queue &queue, cl::sycl::buffer<double, 1> &a,
                         cl::sycl::buffer<double, 1> &b, cl::sycl::buffer<double, 1> &c,
                         cl::sycl::buffer<double, 1> &s) {
     rotg_precondition(queue, a, b, c, s);
-    detail::rotg(select_backend(queue), queue, a, b, c, s);
+    detail::rotg(queue, a, b, c, s);
     rotg_postcondition(queue, a, b, c, s);
 }
 
@@ -940,7 +1342,7 @@ static inline void rotg(cl::sycl::queue &queue, cl::sycl::buffer<std::complex<fl
                         cl::sycl::buffer<std::complex<float>, 1> &b, cl::sycl::buffer<float, 1> &c,
                         cl::sycl::buffer<std::complex<float>, 1> &s) {
     rotg_precondition(queue, a, b, c, s);
-    detail::rotg(select_backend(queue), queue, a, b, c, s);
+    detail::rotg(queue, a, b, c, s);
     rotg_postcondition(queue, a, b, c, s);
 }
 
@@ -949,7 +1351,7 @@ static inline void rotg(cl::sycl::queue &queue, cl::sycl::buffer<std::complex<do
                         cl::sycl::buffer<double, 1> &c,
                         cl::sycl::buffer<std::complex<double>, 1> &s) {
     rotg_precondition(queue, a, b, c, s);
-    detail::rotg(select_backend(queue), queue, a, b, c, s);
+    detail::rotg(queue, a, b, c, s);
     rotg_postcondition(queue, a, b, c, s);
 }
 
@@ -957,7 +1359,7 @@ static inline void rotm(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer
                         std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
                         cl::sycl::buffer<float, 1> &param) {
     rotm_precondition(queue, n, x, incx, y, incy, param);
-    detail::rotm(select_backend(queue), queue, n, x, incx, y, incy, param);
+    detail::rotm(queue, n, x, incx, y, incy, param);
     rotm_postcondition(queue, n, x, incx, y, incy, param);
 }
 
@@ -965,7 +1367,7 @@ static inline void rotm(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer
                         std::int64_t incx, cl::sycl::buffer<double, 1> &y, std::int64_t incy,
                         cl::sycl::buffer<double, 1> &param) {
     rotm_precondition(queue, n, x, incx, y, incy, param);
-    detail::rotm(select_backend(queue), queue, n, x, incx, y, incy, param);
+    detail::rotm(queue, n, x, incx, y, incy, param);
     rotm_postcondition(queue, n, x, incx, y, incy, param);
 }
 
@@ -973,7 +1375,7 @@ static inline void rotmg(cl::sycl::queue &queue, cl::sycl::buffer<float, 1> &d1,
                          cl::sycl::buffer<float, 1> &d2, cl::sycl::buffer<float, 1> &x1, float y1,
                          cl::sycl::buffer<float, 1> &param) {
     rotmg_precondition(queue, d1, d2, x1, y1, param);
-    detail::rotmg(select_backend(queue), queue, d1, d2, x1, y1, param);
+    detail::rotmg(queue, d1, d2, x1, y1, param);
     rotmg_postcondition(queue, d1, d2, x1, y1, param);
 }
 
@@ -981,7 +1383,7 @@ static inline void rotmg(cl::sycl::queue &queue, cl::sycl::buffer<double, 1> &d1
                          cl::sycl::buffer<double, 1> &d2, cl::sycl::buffer<double, 1> &x1,
                          double y1, cl::sycl::buffer<double, 1> &param) {
     rotmg_precondition(queue, d1, d2, x1, y1, param);
-    detail::rotmg(select_backend(queue), queue, d1, d2, x1, y1, param);
+    detail::rotmg(queue, d1, d2, x1, y1, param);
     rotmg_postcondition(queue, d1, d2, x1, y1, param);
 }
 
@@ -990,8 +1392,7 @@ static inline void sbmv(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n
                         cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
                         cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
     sbmv_precondition(queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy);
-    detail::sbmv(select_backend(queue), queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y,
-                 incy);
+    detail::sbmv(queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy);
     sbmv_postcondition(queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy);
 }
 
@@ -1000,50 +1401,49 @@ static inline void sbmv(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n
                         cl::sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
                         cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
     sbmv_precondition(queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy);
-    detail::sbmv(select_backend(queue), queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y,
-                 incy);
+    detail::sbmv(queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy);
     sbmv_postcondition(queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy);
 }
 
 static inline void scal(cl::sycl::queue &queue, std::int64_t n, float alpha,
                         cl::sycl::buffer<float, 1> &x, std::int64_t incx) {
     scal_precondition(queue, n, alpha, x, incx);
-    detail::scal(select_backend(queue), queue, n, alpha, x, incx);
+    detail::scal(queue, n, alpha, x, incx);
     scal_postcondition(queue, n, alpha, x, incx);
 }
 
 static inline void scal(cl::sycl::queue &queue, std::int64_t n, double alpha,
                         cl::sycl::buffer<double, 1> &x, std::int64_t incx) {
     scal_precondition(queue, n, alpha, x, incx);
-    detail::scal(select_backend(queue), queue, n, alpha, x, incx);
+    detail::scal(queue, n, alpha, x, incx);
     scal_postcondition(queue, n, alpha, x, incx);
 }
 
 static inline void scal(cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
                         cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
     scal_precondition(queue, n, alpha, x, incx);
-    detail::scal(select_backend(queue), queue, n, alpha, x, incx);
+    detail::scal(queue, n, alpha, x, incx);
     scal_postcondition(queue, n, alpha, x, incx);
 }
 
 static inline void scal(cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
                         cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
     scal_precondition(queue, n, alpha, x, incx);
-    detail::scal(select_backend(queue), queue, n, alpha, x, incx);
+    detail::scal(queue, n, alpha, x, incx);
     scal_postcondition(queue, n, alpha, x, incx);
 }
 
 static inline void scal(cl::sycl::queue &queue, std::int64_t n, float alpha,
                         cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
     scal_precondition(queue, n, alpha, x, incx);
-    detail::scal(select_backend(queue), queue, n, alpha, x, incx);
+    detail::scal(queue, n, alpha, x, incx);
     scal_postcondition(queue, n, alpha, x, incx);
 }
 
 static inline void scal(cl::sycl::queue &queue, std::int64_t n, double alpha,
                         cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
     scal_precondition(queue, n, alpha, x, incx);
-    detail::scal(select_backend(queue), queue, n, alpha, x, incx);
+    detail::scal(queue, n, alpha, x, incx);
     scal_postcondition(queue, n, alpha, x, incx);
 }
 
@@ -1052,7 +1452,7 @@ static inline void sdsdot(cl::sycl::queue &queue, std::int64_t n, float sb,
                           cl::sycl::buffer<float, 1> &y, std::int64_t incy,
                           cl::sycl::buffer<float, 1> &result) {
     sdsdot_precondition(queue, n, sb, x, incx, y, incy, result);
-    detail::sdsdot(select_backend(queue), queue, n, sb, x, incx, y, incy, result);
+    detail::sdsdot(queue, n, sb, x, incx, y, incy, result);
     sdsdot_postcondition(queue, n, sb, x, incx, y, incy, result);
 }
 
@@ -1061,7 +1461,7 @@ static inline void spmv(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n
                         std::int64_t incx, float beta, cl::sycl::buffer<float, 1> &y,
                         std::int64_t incy) {
     spmv_precondition(queue, upper_lower, n, alpha, a, x, incx, beta, y, incy);
-    detail::spmv(select_backend(queue), queue, upper_lower, n, alpha, a, x, incx, beta, y, incy);
+    detail::spmv(queue, upper_lower, n, alpha, a, x, incx, beta, y, incy);
     spmv_postcondition(queue, upper_lower, n, alpha, a, x, incx, beta, y, incy);
 }
 
@@ -1070,7 +1470,7 @@ static inline void spmv(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n
                         std::int64_t incx, double beta, cl::sycl::buffer<double, 1> &y,
                         std::int64_t incy) {
     spmv_precondition(queue, upper_lower, n, alpha, a, x, incx, beta, y, incy);
-    detail::spmv(select_backend(queue), queue, upper_lower, n, alpha, a, x, incx, beta, y, incy);
+    detail::spmv(queue, upper_lower, n, alpha, a, x, incx, beta, y, incy);
     spmv_postcondition(queue, upper_lower, n, alpha, a, x, incx, beta, y, incy);
 }
 
@@ -1078,7 +1478,7 @@ static inline void spr(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
                        cl::sycl::buffer<float, 1> &x, std::int64_t incx,
                        cl::sycl::buffer<float, 1> &a) {
     spr_precondition(queue, upper_lower, n, alpha, x, incx, a);
-    detail::spr(select_backend(queue), queue, upper_lower, n, alpha, x, incx, a);
+    detail::spr(queue, upper_lower, n, alpha, x, incx, a);
     spr_postcondition(queue, upper_lower, n, alpha, x, incx, a);
 }
 
@@ -1086,7 +1486,7 @@ static inline void spr(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
                        cl::sycl::buffer<double, 1> &x, std::int64_t incx,
                        cl::sycl::buffer<double, 1> &a) {
     spr_precondition(queue, upper_lower, n, alpha, x, incx, a);
-    detail::spr(select_backend(queue), queue, upper_lower, n, alpha, x, incx, a);
+    detail::spr(queue, upper_lower, n, alpha, x, incx, a);
     spr_postcondition(queue, upper_lower, n, alpha, x, incx, a);
 }
 
@@ -1095,7 +1495,7 @@ static inline void spr2(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n
                         cl::sycl::buffer<float, 1> &y, std::int64_t incy,
                         cl::sycl::buffer<float, 1> &a) {
     spr2_precondition(queue, upper_lower, n, alpha, x, incx, y, incy, a);
-    detail::spr2(select_backend(queue), queue, upper_lower, n, alpha, x, incx, y, incy, a);
+    detail::spr2(queue, upper_lower, n, alpha, x, incx, y, incy, a);
     spr2_postcondition(queue, upper_lower, n, alpha, x, incx, y, incy, a);
 }
 
@@ -1104,21 +1504,21 @@ static inline void spr2(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n
                         cl::sycl::buffer<double, 1> &y, std::int64_t incy,
                         cl::sycl::buffer<double, 1> &a) {
     spr2_precondition(queue, upper_lower, n, alpha, x, incx, y, incy, a);
-    detail::spr2(select_backend(queue), queue, upper_lower, n, alpha, x, incx, y, incy, a);
+    detail::spr2(queue, upper_lower, n, alpha, x, incx, y, incy, a);
     spr2_postcondition(queue, upper_lower, n, alpha, x, incx, y, incy, a);
 }
 
 static inline void swap(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
                         std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
     swap_precondition(queue, n, x, incx, y, incy);
-    detail::swap(select_backend(queue), queue, n, x, incx, y, incy);
+    detail::swap(queue, n, x, incx, y, incy);
     swap_postcondition(queue, n, x, incx, y, incy);
 }
 
 static inline void swap(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &x,
                         std::int64_t incx, cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
     swap_precondition(queue, n, x, incx, y, incy);
-    detail::swap(select_backend(queue), queue, n, x, incx, y, incy);
+    detail::swap(queue, n, x, incx, y, incy);
     swap_postcondition(queue, n, x, incx, y, incy);
 }
 
@@ -1126,7 +1526,7 @@ static inline void swap(cl::sycl::queue &queue, std::int64_t n,
                         cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
     swap_precondition(queue, n, x, incx, y, incy);
-    detail::swap(select_backend(queue), queue, n, x, incx, y, incy);
+    detail::swap(queue, n, x, incx, y, incy);
     swap_postcondition(queue, n, x, incx, y, incy);
 }
 
@@ -1134,7 +1534,7 @@ static inline void swap(cl::sycl::queue &queue, std::int64_t n,
                         cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy) {
     swap_precondition(queue, n, x, incx, y, incy);
-    detail::swap(select_backend(queue), queue, n, x, incx, y, incy);
+    detail::swap(queue, n, x, incx, y, incy);
     swap_postcondition(queue, n, x, incx, y, incy);
 }
 
@@ -1143,8 +1543,7 @@ static inline void symm(cl::sycl::queue &queue, side left_right, uplo upper_lowe
                         std::int64_t lda, cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
                         float beta, cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
     symm_precondition(queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
-    detail::symm(select_backend(queue), queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb,
-                 beta, c, ldc);
+    detail::symm(queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
     symm_postcondition(queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
@@ -1153,8 +1552,7 @@ static inline void symm(cl::sycl::queue &queue, side left_right, uplo upper_lowe
                         std::int64_t lda, cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
                         double beta, cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
     symm_precondition(queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
-    detail::symm(select_backend(queue), queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb,
-                 beta, c, ldc);
+    detail::symm(queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
     symm_postcondition(queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
@@ -1165,8 +1563,7 @@ static inline void symm(cl::sycl::queue &queue, side left_right, uplo upper_lowe
                         std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c,
                         std::int64_t ldc) {
     symm_precondition(queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
-    detail::symm(select_backend(queue), queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb,
-                 beta, c, ldc);
+    detail::symm(queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
     symm_postcondition(queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
@@ -1177,8 +1574,7 @@ static inline void symm(cl::sycl::queue &queue, side left_right, uplo upper_lowe
                         std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c,
                         std::int64_t ldc) {
     symm_precondition(queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
-    detail::symm(select_backend(queue), queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb,
-                 beta, c, ldc);
+    detail::symm(queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
     symm_postcondition(queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
@@ -1187,8 +1583,7 @@ static inline void symv(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n
                         cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
                         cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
     symv_precondition(queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy);
-    detail::symv(select_backend(queue), queue, upper_lower, n, alpha, a, lda, x, incx, beta, y,
-                 incy);
+    detail::symv(queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy);
     symv_postcondition(queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy);
 }
 
@@ -1197,8 +1592,7 @@ static inline void symv(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n
                         cl::sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
                         cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
     symv_precondition(queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy);
-    detail::symv(select_backend(queue), queue, upper_lower, n, alpha, a, lda, x, incx, beta, y,
-                 incy);
+    detail::symv(queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy);
     symv_postcondition(queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy);
 }
 
@@ -1206,7 +1600,7 @@ static inline void syr(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
                        cl::sycl::buffer<float, 1> &x, std::int64_t incx,
                        cl::sycl::buffer<float, 1> &a, std::int64_t lda) {
     syr_precondition(queue, upper_lower, n, alpha, x, incx, a, lda);
-    detail::syr(select_backend(queue), queue, upper_lower, n, alpha, x, incx, a, lda);
+    detail::syr(queue, upper_lower, n, alpha, x, incx, a, lda);
     syr_postcondition(queue, upper_lower, n, alpha, x, incx, a, lda);
 }
 
@@ -1214,7 +1608,7 @@ static inline void syr(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
                        cl::sycl::buffer<double, 1> &x, std::int64_t incx,
                        cl::sycl::buffer<double, 1> &a, std::int64_t lda) {
     syr_precondition(queue, upper_lower, n, alpha, x, incx, a, lda);
-    detail::syr(select_backend(queue), queue, upper_lower, n, alpha, x, incx, a, lda);
+    detail::syr(queue, upper_lower, n, alpha, x, incx, a, lda);
     syr_postcondition(queue, upper_lower, n, alpha, x, incx, a, lda);
 }
 
@@ -1223,7 +1617,7 @@ static inline void syr2(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n
                         cl::sycl::buffer<float, 1> &y, std::int64_t incy,
                         cl::sycl::buffer<float, 1> &a, std::int64_t lda) {
     syr2_precondition(queue, upper_lower, n, alpha, x, incx, y, incy, a, lda);
-    detail::syr2(select_backend(queue), queue, upper_lower, n, alpha, x, incx, y, incy, a, lda);
+    detail::syr2(queue, upper_lower, n, alpha, x, incx, y, incy, a, lda);
     syr2_postcondition(queue, upper_lower, n, alpha, x, incx, y, incy, a, lda);
 }
 
@@ -1232,7 +1626,7 @@ static inline void syr2(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n
                         cl::sycl::buffer<double, 1> &y, std::int64_t incy,
                         cl::sycl::buffer<double, 1> &a, std::int64_t lda) {
     syr2_precondition(queue, upper_lower, n, alpha, x, incx, y, incy, a, lda);
-    detail::syr2(select_backend(queue), queue, upper_lower, n, alpha, x, incx, y, incy, a, lda);
+    detail::syr2(queue, upper_lower, n, alpha, x, incx, y, incy, a, lda);
     syr2_postcondition(queue, upper_lower, n, alpha, x, incx, y, incy, a, lda);
 }
 
@@ -1241,8 +1635,7 @@ static inline void syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose tra
                          std::int64_t lda, cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
                          float beta, cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
     syr2k_precondition(queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
-    detail::syr2k(select_backend(queue), queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb,
-                  beta, c, ldc);
+    detail::syr2k(queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
     syr2k_postcondition(queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
@@ -1251,8 +1644,7 @@ static inline void syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose tra
                          std::int64_t lda, cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
                          double beta, cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
     syr2k_precondition(queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
-    detail::syr2k(select_backend(queue), queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb,
-                  beta, c, ldc);
+    detail::syr2k(queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
     syr2k_postcondition(queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
@@ -1263,8 +1655,7 @@ static inline void syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose tra
                          std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c,
                          std::int64_t ldc) {
     syr2k_precondition(queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
-    detail::syr2k(select_backend(queue), queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb,
-                  beta, c, ldc);
+    detail::syr2k(queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
     syr2k_postcondition(queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
@@ -1275,8 +1666,7 @@ static inline void syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose tra
                          std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c,
                          std::int64_t ldc) {
     syr2k_precondition(queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
-    detail::syr2k(select_backend(queue), queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb,
-                  beta, c, ldc);
+    detail::syr2k(queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
     syr2k_postcondition(queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
@@ -1285,8 +1675,7 @@ static inline void syrk(cl::sycl::queue &queue, uplo upper_lower, transpose tran
                         std::int64_t lda, float beta, cl::sycl::buffer<float, 1> &c,
                         std::int64_t ldc) {
     syrk_precondition(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
-    detail::syrk(select_backend(queue), queue, upper_lower, trans, n, k, alpha, a, lda, beta, c,
-                 ldc);
+    detail::syrk(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
     syrk_postcondition(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
 }
 
@@ -1295,8 +1684,7 @@ static inline void syrk(cl::sycl::queue &queue, uplo upper_lower, transpose tran
                         std::int64_t lda, double beta, cl::sycl::buffer<double, 1> &c,
                         std::int64_t ldc) {
     syrk_precondition(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
-    detail::syrk(select_backend(queue), queue, upper_lower, trans, n, k, alpha, a, lda, beta, c,
-                 ldc);
+    detail::syrk(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
     syrk_postcondition(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
 }
 
@@ -1306,8 +1694,7 @@ static inline void syrk(cl::sycl::queue &queue, uplo upper_lower, transpose tran
                         std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c,
                         std::int64_t ldc) {
     syrk_precondition(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
-    detail::syrk(select_backend(queue), queue, upper_lower, trans, n, k, alpha, a, lda, beta, c,
-                 ldc);
+    detail::syrk(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
     syrk_postcondition(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
 }
 
@@ -1317,8 +1704,7 @@ static inline void syrk(cl::sycl::queue &queue, uplo upper_lower, transpose tran
                         std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c,
                         std::int64_t ldc) {
     syrk_precondition(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
-    detail::syrk(select_backend(queue), queue, upper_lower, trans, n, k, alpha, a, lda, beta, c,
-                 ldc);
+    detail::syrk(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
     syrk_postcondition(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
 }
 
@@ -1326,8 +1712,7 @@ static inline void tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose tran
                         std::int64_t n, std::int64_t k, cl::sycl::buffer<float, 1> &a,
                         std::int64_t lda, cl::sycl::buffer<float, 1> &x, std::int64_t incx) {
     tbmv_precondition(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
-    detail::tbmv(select_backend(queue), queue, upper_lower, trans, unit_diag, n, k, a, lda, x,
-                 incx);
+    detail::tbmv(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
     tbmv_postcondition(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
 }
 
@@ -1335,8 +1720,7 @@ static inline void tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose tran
                         std::int64_t n, std::int64_t k, cl::sycl::buffer<double, 1> &a,
                         std::int64_t lda, cl::sycl::buffer<double, 1> &x, std::int64_t incx) {
     tbmv_precondition(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
-    detail::tbmv(select_backend(queue), queue, upper_lower, trans, unit_diag, n, k, a, lda, x,
-                 incx);
+    detail::tbmv(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
     tbmv_postcondition(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
 }
 
@@ -1345,8 +1729,7 @@ static inline void tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose tran
                         std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &x,
                         std::int64_t incx) {
     tbmv_precondition(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
-    detail::tbmv(select_backend(queue), queue, upper_lower, trans, unit_diag, n, k, a, lda, x,
-                 incx);
+    detail::tbmv(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
     tbmv_postcondition(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
 }
 
@@ -1355,8 +1738,7 @@ static inline void tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose tran
                         cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
     tbmv_precondition(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
-    detail::tbmv(select_backend(queue), queue, upper_lower, trans, unit_diag, n, k, a, lda, x,
-                 incx);
+    detail::tbmv(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
     tbmv_postcondition(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
 }
 
@@ -1364,8 +1746,7 @@ static inline void tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose tran
                         std::int64_t n, std::int64_t k, cl::sycl::buffer<float, 1> &a,
                         std::int64_t lda, cl::sycl::buffer<float, 1> &x, std::int64_t incx) {
     tbsv_precondition(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
-    detail::tbsv(select_backend(queue), queue, upper_lower, trans, unit_diag, n, k, a, lda, x,
-                 incx);
+    detail::tbsv(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
     tbsv_postcondition(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
 }
 
@@ -1373,8 +1754,7 @@ static inline void tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose tran
                         std::int64_t n, std::int64_t k, cl::sycl::buffer<double, 1> &a,
                         std::int64_t lda, cl::sycl::buffer<double, 1> &x, std::int64_t incx) {
     tbsv_precondition(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
-    detail::tbsv(select_backend(queue), queue, upper_lower, trans, unit_diag, n, k, a, lda, x,
-                 incx);
+    detail::tbsv(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
     tbsv_postcondition(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
 }
 
@@ -1383,8 +1763,7 @@ static inline void tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose tran
                         std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &x,
                         std::int64_t incx) {
     tbsv_precondition(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
-    detail::tbsv(select_backend(queue), queue, upper_lower, trans, unit_diag, n, k, a, lda, x,
-                 incx);
+    detail::tbsv(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
     tbsv_postcondition(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
 }
 
@@ -1393,8 +1772,7 @@ static inline void tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose tran
                         cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
     tbsv_precondition(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
-    detail::tbsv(select_backend(queue), queue, upper_lower, trans, unit_diag, n, k, a, lda, x,
-                 incx);
+    detail::tbsv(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
     tbsv_postcondition(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
 }
 
@@ -1402,7 +1780,7 @@ static inline void tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose tran
                         std::int64_t n, cl::sycl::buffer<float, 1> &a,
                         cl::sycl::buffer<float, 1> &x, std::int64_t incx) {
     tpmv_precondition(queue, upper_lower, trans, unit_diag, n, a, x, incx);
-    detail::tpmv(select_backend(queue), queue, upper_lower, trans, unit_diag, n, a, x, incx);
+    detail::tpmv(queue, upper_lower, trans, unit_diag, n, a, x, incx);
     tpmv_postcondition(queue, upper_lower, trans, unit_diag, n, a, x, incx);
 }
 
@@ -1410,7 +1788,7 @@ static inline void tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose tran
                         std::int64_t n, cl::sycl::buffer<double, 1> &a,
                         cl::sycl::buffer<double, 1> &x, std::int64_t incx) {
     tpmv_precondition(queue, upper_lower, trans, unit_diag, n, a, x, incx);
-    detail::tpmv(select_backend(queue), queue, upper_lower, trans, unit_diag, n, a, x, incx);
+    detail::tpmv(queue, upper_lower, trans, unit_diag, n, a, x, incx);
     tpmv_postcondition(queue, upper_lower, trans, unit_diag, n, a, x, incx);
 }
 
@@ -1418,7 +1796,7 @@ static inline void tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose tran
                         std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &a,
                         cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
     tpmv_precondition(queue, upper_lower, trans, unit_diag, n, a, x, incx);
-    detail::tpmv(select_backend(queue), queue, upper_lower, trans, unit_diag, n, a, x, incx);
+    detail::tpmv(queue, upper_lower, trans, unit_diag, n, a, x, incx);
     tpmv_postcondition(queue, upper_lower, trans, unit_diag, n, a, x, incx);
 }
 
@@ -1426,7 +1804,7 @@ static inline void tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose tran
                         std::int64_t n, cl::sycl::buffer<std::complex<double>, 1> &a,
                         cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
     tpmv_precondition(queue, upper_lower, trans, unit_diag, n, a, x, incx);
-    detail::tpmv(select_backend(queue), queue, upper_lower, trans, unit_diag, n, a, x, incx);
+    detail::tpmv(queue, upper_lower, trans, unit_diag, n, a, x, incx);
     tpmv_postcondition(queue, upper_lower, trans, unit_diag, n, a, x, incx);
 }
 
@@ -1434,7 +1812,7 @@ static inline void tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose tran
                         std::int64_t n, cl::sycl::buffer<float, 1> &a,
                         cl::sycl::buffer<float, 1> &x, std::int64_t incx) {
     tpsv_precondition(queue, upper_lower, trans, unit_diag, n, a, x, incx);
-    detail::tpsv(select_backend(queue), queue, upper_lower, trans, unit_diag, n, a, x, incx);
+    detail::tpsv(queue, upper_lower, trans, unit_diag, n, a, x, incx);
     tpsv_postcondition(queue, upper_lower, trans, unit_diag, n, a, x, incx);
 }
 
@@ -1442,7 +1820,7 @@ static inline void tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose tran
                         std::int64_t n, cl::sycl::buffer<double, 1> &a,
                         cl::sycl::buffer<double, 1> &x, std::int64_t incx) {
     tpsv_precondition(queue, upper_lower, trans, unit_diag, n, a, x, incx);
-    detail::tpsv(select_backend(queue), queue, upper_lower, trans, unit_diag, n, a, x, incx);
+    detail::tpsv(queue, upper_lower, trans, unit_diag, n, a, x, incx);
     tpsv_postcondition(queue, upper_lower, trans, unit_diag, n, a, x, incx);
 }
 
@@ -1450,7 +1828,7 @@ static inline void tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose tran
                         std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &a,
                         cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
     tpsv_precondition(queue, upper_lower, trans, unit_diag, n, a, x, incx);
-    detail::tpsv(select_backend(queue), queue, upper_lower, trans, unit_diag, n, a, x, incx);
+    detail::tpsv(queue, upper_lower, trans, unit_diag, n, a, x, incx);
     tpsv_postcondition(queue, upper_lower, trans, unit_diag, n, a, x, incx);
 }
 
@@ -1458,7 +1836,7 @@ static inline void tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose tran
                         std::int64_t n, cl::sycl::buffer<std::complex<double>, 1> &a,
                         cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
     tpsv_precondition(queue, upper_lower, trans, unit_diag, n, a, x, incx);
-    detail::tpsv(select_backend(queue), queue, upper_lower, trans, unit_diag, n, a, x, incx);
+    detail::tpsv(queue, upper_lower, trans, unit_diag, n, a, x, incx);
     tpsv_postcondition(queue, upper_lower, trans, unit_diag, n, a, x, incx);
 }
 
@@ -1468,8 +1846,7 @@ static inline void trmm(cl::sycl::queue &queue, side left_right, uplo upper_lowe
                         cl::sycl::buffer<float, 1> &b, std::int64_t ldb) {
     trmm_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
                       ldb);
-    detail::trmm(select_backend(queue), queue, left_right, upper_lower, trans, unit_diag, m, n,
-                 alpha, a, lda, b, ldb);
+    detail::trmm(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb);
     trmm_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
                        ldb);
 }
@@ -1480,8 +1857,7 @@ static inline void trmm(cl::sycl::queue &queue, side left_right, uplo upper_lowe
                         cl::sycl::buffer<double, 1> &b, std::int64_t ldb) {
     trmm_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
                       ldb);
-    detail::trmm(select_backend(queue), queue, left_right, upper_lower, trans, unit_diag, m, n,
-                 alpha, a, lda, b, ldb);
+    detail::trmm(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb);
     trmm_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
                        ldb);
 }
@@ -1492,8 +1868,7 @@ static inline void trmm(cl::sycl::queue &queue, side left_right, uplo upper_lowe
                         cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb) {
     trmm_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
                       ldb);
-    detail::trmm(select_backend(queue), queue, left_right, upper_lower, trans, unit_diag, m, n,
-                 alpha, a, lda, b, ldb);
+    detail::trmm(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb);
     trmm_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
                        ldb);
 }
@@ -1504,8 +1879,7 @@ static inline void trmm(cl::sycl::queue &queue, side left_right, uplo upper_lowe
                         cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb) {
     trmm_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
                       ldb);
-    detail::trmm(select_backend(queue), queue, left_right, upper_lower, trans, unit_diag, m, n,
-                 alpha, a, lda, b, ldb);
+    detail::trmm(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb);
     trmm_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
                        ldb);
 }
@@ -1514,7 +1888,7 @@ static inline void trmv(cl::sycl::queue &queue, uplo upper_lower, transpose tran
                         std::int64_t n, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<float, 1> &x, std::int64_t incx) {
     trmv_precondition(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx);
-    detail::trmv(select_backend(queue), queue, upper_lower, trans, unit_diag, n, a, lda, x, incx);
+    detail::trmv(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx);
     trmv_postcondition(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx);
 }
 
@@ -1522,7 +1896,7 @@ static inline void trmv(cl::sycl::queue &queue, uplo upper_lower, transpose tran
                         std::int64_t n, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<double, 1> &x, std::int64_t incx) {
     trmv_precondition(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx);
-    detail::trmv(select_backend(queue), queue, upper_lower, trans, unit_diag, n, a, lda, x, incx);
+    detail::trmv(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx);
     trmv_postcondition(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx);
 }
 
@@ -1531,7 +1905,7 @@ static inline void trmv(cl::sycl::queue &queue, uplo upper_lower, transpose tran
                         std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &x,
                         std::int64_t incx) {
     trmv_precondition(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx);
-    detail::trmv(select_backend(queue), queue, upper_lower, trans, unit_diag, n, a, lda, x, incx);
+    detail::trmv(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx);
     trmv_postcondition(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx);
 }
 
@@ -1540,7 +1914,7 @@ static inline void trmv(cl::sycl::queue &queue, uplo upper_lower, transpose tran
                         std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &x,
                         std::int64_t incx) {
     trmv_precondition(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx);
-    detail::trmv(select_backend(queue), queue, upper_lower, trans, unit_diag, n, a, lda, x, incx);
+    detail::trmv(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx);
     trmv_postcondition(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx);
 }
 
@@ -1550,8 +1924,7 @@ static inline void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lowe
                         cl::sycl::buffer<float, 1> &b, std::int64_t ldb) {
     trsm_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
                       ldb);
-    detail::trsm(select_backend(queue), queue, left_right, upper_lower, trans, unit_diag, m, n,
-                 alpha, a, lda, b, ldb);
+    detail::trsm(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb);
     trsm_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
                        ldb);
 }
@@ -1562,8 +1935,7 @@ static inline void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lowe
                         cl::sycl::buffer<double, 1> &b, std::int64_t ldb) {
     trsm_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
                       ldb);
-    detail::trsm(select_backend(queue), queue, left_right, upper_lower, trans, unit_diag, m, n,
-                 alpha, a, lda, b, ldb);
+    detail::trsm(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb);
     trsm_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
                        ldb);
 }
@@ -1574,8 +1946,7 @@ static inline void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lowe
                         cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb) {
     trsm_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
                       ldb);
-    detail::trsm(select_backend(queue), queue, left_right, upper_lower, trans, unit_diag, m, n,
-                 alpha, a, lda, b, ldb);
+    detail::trsm(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb);
     trsm_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
                        ldb);
 }
@@ -1586,8 +1957,7 @@ static inline void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lowe
                         cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb) {
     trsm_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
                       ldb);
-    detail::trsm(select_backend(queue), queue, left_right, upper_lower, trans, unit_diag, m, n,
-                 alpha, a, lda, b, ldb);
+    detail::trsm(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb);
     trsm_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
                        ldb);
 }
@@ -1599,8 +1969,8 @@ static inline void trsm_batch(cl::sycl::queue &queue, side left_right, uplo uppe
                               std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
     trsm_batch_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
                             stride_a, b, ldb, stride_b, batch_size);
-    detail::trsm_batch(select_backend(queue), queue, left_right, upper_lower, trans, unit_diag, m,
-                       n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size);
+    detail::trsm_batch(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                       stride_a, b, ldb, stride_b, batch_size);
     trsm_batch_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
                              stride_a, b, ldb, stride_b, batch_size);
 }
@@ -1612,8 +1982,8 @@ static inline void trsm_batch(cl::sycl::queue &queue, side left_right, uplo uppe
                               std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
     trsm_batch_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
                             stride_a, b, ldb, stride_b, batch_size);
-    detail::trsm_batch(select_backend(queue), queue, left_right, upper_lower, trans, unit_diag, m,
-                       n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size);
+    detail::trsm_batch(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                       stride_a, b, ldb, stride_b, batch_size);
     trsm_batch_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
                              stride_a, b, ldb, stride_b, batch_size);
 }
@@ -1626,8 +1996,8 @@ static inline void trsm_batch(cl::sycl::queue &queue, side left_right, uplo uppe
                               std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
     trsm_batch_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
                             stride_a, b, ldb, stride_b, batch_size);
-    detail::trsm_batch(select_backend(queue), queue, left_right, upper_lower, trans, unit_diag, m,
-                       n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size);
+    detail::trsm_batch(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                       stride_a, b, ldb, stride_b, batch_size);
     trsm_batch_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
                              stride_a, b, ldb, stride_b, batch_size);
 }
@@ -1640,8 +2010,8 @@ static inline void trsm_batch(cl::sycl::queue &queue, side left_right, uplo uppe
                               std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
     trsm_batch_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
                             stride_a, b, ldb, stride_b, batch_size);
-    detail::trsm_batch(select_backend(queue), queue, left_right, upper_lower, trans, unit_diag, m,
-                       n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size);
+    detail::trsm_batch(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                       stride_a, b, ldb, stride_b, batch_size);
     trsm_batch_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
                              stride_a, b, ldb, stride_b, batch_size);
 }
@@ -1650,7 +2020,7 @@ static inline void trsv(cl::sycl::queue &queue, uplo upper_lower, transpose tran
                         std::int64_t n, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<float, 1> &x, std::int64_t incx) {
     trsv_precondition(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx);
-    detail::trsv(select_backend(queue), queue, upper_lower, trans, unit_diag, n, a, lda, x, incx);
+    detail::trsv(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx);
     trsv_postcondition(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx);
 }
 
@@ -1658,7 +2028,7 @@ static inline void trsv(cl::sycl::queue &queue, uplo upper_lower, transpose tran
                         std::int64_t n, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<double, 1> &x, std::int64_t incx) {
     trsv_precondition(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx);
-    detail::trsv(select_backend(queue), queue, upper_lower, trans, unit_diag, n, a, lda, x, incx);
+    detail::trsv(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx);
     trsv_postcondition(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx);
 }
 
@@ -1667,7 +2037,7 @@ static inline void trsv(cl::sycl::queue &queue, uplo upper_lower, transpose tran
                         std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &x,
                         std::int64_t incx) {
     trsv_precondition(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx);
-    detail::trsv(select_backend(queue), queue, upper_lower, trans, unit_diag, n, a, lda, x, incx);
+    detail::trsv(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx);
     trsv_postcondition(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx);
 }
 
@@ -1676,17 +2046,21 @@ static inline void trsv(cl::sycl::queue &queue, uplo upper_lower, transpose tran
                         std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &x,
                         std::int64_t incx) {
     trsv_precondition(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx);
-    detail::trsv(select_backend(queue), queue, upper_lower, trans, unit_diag, n, a, lda, x, incx);
+    detail::trsv(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx);
     trsv_postcondition(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx);
 }
 
 // USM APIs
 
+// Each call returns an event to wait on for its completion. Calls run on the
+//  calling thread (mklcpu with ONEMKL_MKLCPU_INLINE_THRESHOLD) return a
+//  default-constructed event, which is complete.
+
 static inline cl::sycl::event asum(
     cl::sycl::queue &queue, std::int64_t n, const std::complex<float> *x, std::int64_t incx,
     float *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     asum_precondition(queue, n, x, incx, result, dependencies);
-    auto done = detail::asum(select_backend(queue), queue, n, x, incx, result, dependencies);
+    auto done = detail::asum(queue, n, x, incx, result, dependencies);
     asum_postcondition(queue, n, x, incx, result, dependencies);
     return done;
 }
@@ -1695,7 +2069,7 @@ static inline cl::sycl::event asum(
     cl::sycl::queue &queue, std::int64_t n, const std::complex<double> *x, std::int64_t incx,
     double *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     asum_precondition(queue, n, x, incx, result, dependencies);
-    auto done = detail::asum(select_backend(queue), queue, n, x, incx, result, dependencies);
+    auto done = detail::asum(queue, n, x, incx, result, dependencies);
     asum_postcondition(queue, n, x, incx, result, dependencies);
     return done;
 }
@@ -1704,7 +2078,7 @@ static inline cl::sycl::event asum(
     cl::sycl::queue &queue, std::int64_t n, const float *x, std::int64_t incx, float *result,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     asum_precondition(queue, n, x, incx, result, dependencies);
-    auto done = detail::asum(select_backend(queue), queue, n, x, incx, result, dependencies);
+    auto done = detail::asum(queue, n, x, incx, result, dependencies);
     asum_postcondition(queue, n, x, incx, result, dependencies);
     return done;
 }
@@ -1713,7 +2087,7 @@ static inline cl::sycl::event asum(
     cl::sycl::queue &queue, std::int64_t n, const double *x, std::int64_t incx, double *result,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     asum_precondition(queue, n, x, incx, result, dependencies);
-    auto done = detail::asum(select_backend(queue), queue, n, x, incx, result, dependencies);
+    auto done = detail::asum(queue, n, x, incx, result, dependencies);
     asum_postcondition(queue, n, x, incx, result, dependencies);
     return done;
 }
@@ -1722,8 +2096,7 @@ static inline cl::sycl::event axpy(
     cl::sycl::queue &queue, std::int64_t n, float alpha, const float *x, std::int64_t incx,
     float *y, std::int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     axpy_precondition(queue, n, alpha, x, incx, y, incy, dependencies);
-    auto done =
-        detail::axpy(select_backend(queue), queue, n, alpha, x, incx, y, incy, dependencies);
+    auto done = detail::axpy(queue, n, alpha, x, incx, y, incy, dependencies);
     axpy_postcondition(queue, n, alpha, x, incx, y, incy, dependencies);
     return done;
 }
@@ -1733,8 +2106,7 @@ static inline cl::sycl::event axpy(
     double *y, std::int64_t incy,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     axpy_precondition(queue, n, alpha, x, incx, y, incy, dependencies);
-    auto done =
-        detail::axpy(select_backend(queue), queue, n, alpha, x, incx, y, incy, dependencies);
+    auto done = detail::axpy(queue, n, alpha, x, incx, y, incy, dependencies);
     axpy_postcondition(queue, n, alpha, x, incx, y, incy, dependencies);
     return done;
 }
@@ -1744,8 +2116,7 @@ static inline cl::sycl::event axpy(
     std::int64_t incx, std::complex<float> *y, std::int64_t incy,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     axpy_precondition(queue, n, alpha, x, incx, y, incy, dependencies);
-    auto done =
-        detail::axpy(select_backend(queue), queue, n, alpha, x, incx, y, incy, dependencies);
+    auto done = detail::axpy(queue, n, alpha, x, incx, y, incy, dependencies);
     axpy_postcondition(queue, n, alpha, x, incx, y, incy, dependencies);
     return done;
 }
@@ -1755,8 +2126,7 @@ static inline cl::sycl::event axpy(
     const std::complex<double> *x, std::int64_t incx, std::complex<double> *y, std::int64_t incy,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     axpy_precondition(queue, n, alpha, x, incx, y, incy, dependencies);
-    auto done =
-        detail::axpy(select_backend(queue), queue, n, alpha, x, incx, y, incy, dependencies);
+    auto done = detail::axpy(queue, n, alpha, x, incx, y, incy, dependencies);
     axpy_postcondition(queue, n, alpha, x, incx, y, incy, dependencies);
     return done;
 }
@@ -1767,8 +2137,8 @@ static inline cl::sycl::event axpy_batch(
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     axpy_batch_precondition(queue, n, alpha, x, incx, y, incy, group_count, group_size,
                             dependencies);
-    auto done = detail::axpy_batch(select_backend(queue), queue, n, alpha, x, incx, y, incy,
-                                   group_count, group_size, dependencies);
+    auto done = detail::axpy_batch(queue, n, alpha, x, incx, y, incy, group_count, group_size,
+                                   dependencies);
     axpy_batch_postcondition(queue, n, alpha, x, incx, y, incy, group_count, group_size,
                              dependencies);
     return done;
@@ -1780,8 +2150,8 @@ static inline cl::sycl::event axpy_batch(
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     axpy_batch_precondition(queue, n, alpha, x, incx, y, incy, group_count, group_size,
                             dependencies);
-    auto done = detail::axpy_batch(select_backend(queue), queue, n, alpha, x, incx, y, incy,
-                                   group_count, group_size, dependencies);
+    auto done = detail::axpy_batch(queue, n, alpha, x, incx, y, incy, group_count, group_size,
+                                   dependencies);
     axpy_batch_postcondition(queue, n, alpha, x, incx, y, incy, group_count, group_size,
                              dependencies);
     return done;
@@ -1794,8 +2164,8 @@ static inline cl::sycl::event axpy_batch(
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     axpy_batch_precondition(queue, n, alpha, x, incx, y, incy, group_count, group_size,
                             dependencies);
-    auto done = detail::axpy_batch(select_backend(queue), queue, n, alpha, x, incx, y, incy,
-                                   group_count, group_size, dependencies);
+    auto done = detail::axpy_batch(queue, n, alpha, x, incx, y, incy, group_count, group_size,
+                                   dependencies);
     axpy_batch_postcondition(queue, n, alpha, x, incx, y, incy, group_count, group_size,
                              dependencies);
     return done;
@@ -1808,18 +2178,281 @@ static inline cl::sycl::event axpy_batch(
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     axpy_batch_precondition(queue, n, alpha, x, incx, y, incy, group_count, group_size,
                             dependencies);
-    auto done = detail::axpy_batch(select_backend(queue), queue, n, alpha, x, incx, y, incy,
-                                   group_count, group_size, dependencies);
+    auto done = detail::axpy_batch(queue, n, alpha, x, incx, y, incy, group_count, group_size,
+                                   dependencies);
     axpy_batch_postcondition(queue, n, alpha, x, incx, y, incy, group_count, group_size,
                              dependencies);
     return done;
 }
 
+static inline cl::sycl::event axpy_batch(
+    cl::sycl::queue &queue, std::int64_t n, float alpha, const float *x, std::int64_t incx,
+    std::int64_t stridex, float *y, std::int64_t incy, std::int64_t stridey,
+    std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    axpy_batch_precondition(queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size,
+                            dependencies);
+    auto done = detail::axpy_batch(queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size,
+                                   dependencies);
+    axpy_batch_postcondition(queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size,
+                             dependencies);
+    return done;
+}
+
+static inline cl::sycl::event axpy_batch(
+    cl::sycl::queue &queue, std::int64_t n, double alpha, const double *x, std::int64_t incx,
+    std::int64_t stridex, double *y, std::int64_t incy, std::int64_t stridey,
+    std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    axpy_batch_precondition(queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size,
+                            dependencies);
+    auto done = detail::axpy_batch(queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size,
+                                   dependencies);
+    axpy_batch_postcondition(queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size,
+                             dependencies);
+    return done;
+}
+
+static inline cl::sycl::event axpy_batch(
+    cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha, const std::complex<float> *x,
+    std::int64_t incx, std::int64_t stridex, std::complex<float> *y, std::int64_t incy,
+    std::int64_t stridey, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    axpy_batch_precondition(queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size,
+                            dependencies);
+    auto done = detail::axpy_batch(queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size,
+                                   dependencies);
+    axpy_batch_postcondition(queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size,
+                             dependencies);
+    return done;
+}
+
+static inline cl::sycl::event axpy_batch(
+    cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+    const std::complex<double> *x, std::int64_t incx, std::int64_t stridex, std::complex<double> *y,
+    std::int64_t incy, std::int64_t stridey, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    axpy_batch_precondition(queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size,
+                            dependencies);
+    auto done = detail::axpy_batch(queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size,
+                                   dependencies);
+    axpy_batch_postcondition(queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size,
+                             dependencies);
+    return done;
+}
+
+// Compact batches interleave their matrices in packs of compact_lanes: in a
+//  pack, element (i, j) of every matrix is stored next to that of the others.
+//  compact_size() is the number of elements to allocate for batch_size
+//  matrices with cols columns and leading dimension ld.
+static constexpr std::int64_t compact_lanes = 16;
+
+static inline std::int64_t compact_size(std::int64_t ld, std::int64_t cols,
+                                        std::int64_t batch_size) {
+    return (batch_size + compact_lanes - 1) / compact_lanes * compact_lanes * ld * cols;
+}
+
+static inline cl::sycl::event compact_pack(
+    cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols, const float **a, std::int64_t lda,
+    float *ap, std::int64_t ldap, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    compact_pack_precondition(queue, rows, cols, a, lda, ap, ldap, batch_size, dependencies);
+    auto done = detail::compact_pack(queue, rows, cols, a, lda, ap, ldap, batch_size, dependencies);
+    compact_pack_postcondition(queue, rows, cols, a, lda, ap, ldap, batch_size, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event compact_pack(
+    cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols, const double **a,
+    std::int64_t lda, double *ap, std::int64_t ldap, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    compact_pack_precondition(queue, rows, cols, a, lda, ap, ldap, batch_size, dependencies);
+    auto done = detail::compact_pack(queue, rows, cols, a, lda, ap, ldap, batch_size, dependencies);
+    compact_pack_postcondition(queue, rows, cols, a, lda, ap, ldap, batch_size, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event compact_pack(
+    cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols, const std::complex<float> **a,
+    std::int64_t lda, std::complex<float> *ap, std::int64_t ldap, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    compact_pack_precondition(queue, rows, cols, a, lda, ap, ldap, batch_size, dependencies);
+    auto done = detail::compact_pack(queue, rows, cols, a, lda, ap, ldap, batch_size, dependencies);
+    compact_pack_postcondition(queue, rows, cols, a, lda, ap, ldap, batch_size, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event compact_pack(
+    cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols, const std::complex<double> **a,
+    std::int64_t lda, std::complex<double> *ap, std::int64_t ldap, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    compact_pack_precondition(queue, rows, cols, a, lda, ap, ldap, batch_size, dependencies);
+    auto done = detail::compact_pack(queue, rows, cols, a, lda, ap, ldap, batch_size, dependencies);
+    compact_pack_postcondition(queue, rows, cols, a, lda, ap, ldap, batch_size, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event compact_unpack(
+    cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols, const float *ap,
+    std::int64_t ldap, float **a, std::int64_t lda, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    compact_unpack_precondition(queue, rows, cols, ap, ldap, a, lda, batch_size, dependencies);
+    auto done = detail::compact_unpack(queue, rows, cols, ap, ldap, a, lda, batch_size,
+                                       dependencies);
+    compact_unpack_postcondition(queue, rows, cols, ap, ldap, a, lda, batch_size, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event compact_unpack(
+    cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols, const double *ap,
+    std::int64_t ldap, double **a, std::int64_t lda, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    compact_unpack_precondition(queue, rows, cols, ap, ldap, a, lda, batch_size, dependencies);
+    auto done = detail::compact_unpack(queue, rows, cols, ap, ldap, a, lda, batch_size,
+                                       dependencies);
+    compact_unpack_postcondition(queue, rows, cols, ap, ldap, a, lda, batch_size, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event compact_unpack(
+    cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols, const std::complex<float> *ap,
+    std::int64_t ldap, std::complex<float> **a, std::int64_t lda, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    compact_unpack_precondition(queue, rows, cols, ap, ldap, a, lda, batch_size, dependencies);
+    auto done = detail::compact_unpack(queue, rows, cols, ap, ldap, a, lda, batch_size,
+                                       dependencies);
+    compact_unpack_postcondition(queue, rows, cols, ap, ldap, a, lda, batch_size, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event compact_unpack(
+    cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols, const std::complex<double> *ap,
+    std::int64_t ldap, std::complex<double> **a, std::int64_t lda, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    compact_unpack_precondition(queue, rows, cols, ap, ldap, a, lda, batch_size, dependencies);
+    auto done = detail::compact_unpack(queue, rows, cols, ap, ldap, a, lda, batch_size,
+                                       dependencies);
+    compact_unpack_postcondition(queue, rows, cols, ap, ldap, a, lda, batch_size, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event gemm_compact(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, float alpha, const float *ap, std::int64_t ldap, const float *bp,
+    std::int64_t ldbp, float beta, float *cp, std::int64_t ldcp, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    gemm_compact_precondition(queue, transa, transb, m, n, k, alpha, ap, ldap, bp, ldbp, beta, cp,
+                              ldcp, batch_size, dependencies);
+    auto done = detail::gemm_compact(queue, transa, transb, m, n, k, alpha, ap, ldap, bp, ldbp,
+                                     beta, cp, ldcp, batch_size, dependencies);
+    gemm_compact_postcondition(queue, transa, transb, m, n, k, alpha, ap, ldap, bp, ldbp, beta, cp,
+                               ldcp, batch_size, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event gemm_compact(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, double alpha, const double *ap, std::int64_t ldap, const double *bp,
+    std::int64_t ldbp, double beta, double *cp, std::int64_t ldcp, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    gemm_compact_precondition(queue, transa, transb, m, n, k, alpha, ap, ldap, bp, ldbp, beta, cp,
+                              ldcp, batch_size, dependencies);
+    auto done = detail::gemm_compact(queue, transa, transb, m, n, k, alpha, ap, ldap, bp, ldbp,
+                                     beta, cp, ldcp, batch_size, dependencies);
+    gemm_compact_postcondition(queue, transa, transb, m, n, k, alpha, ap, ldap, bp, ldbp, beta, cp,
+                               ldcp, batch_size, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event gemm_compact(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<float> alpha, const std::complex<float> *ap, std::int64_t ldap,
+    const std::complex<float> *bp, std::int64_t ldbp, std::complex<float> beta,
+    std::complex<float> *cp, std::int64_t ldcp, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    gemm_compact_precondition(queue, transa, transb, m, n, k, alpha, ap, ldap, bp, ldbp, beta, cp,
+                              ldcp, batch_size, dependencies);
+    auto done = detail::gemm_compact(queue, transa, transb, m, n, k, alpha, ap, ldap, bp, ldbp,
+                                     beta, cp, ldcp, batch_size, dependencies);
+    gemm_compact_postcondition(queue, transa, transb, m, n, k, alpha, ap, ldap, bp, ldbp, beta, cp,
+                               ldcp, batch_size, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event gemm_compact(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<double> alpha, const std::complex<double> *ap, std::int64_t ldap,
+    const std::complex<double> *bp, std::int64_t ldbp, std::complex<double> beta,
+    std::complex<double> *cp, std::int64_t ldcp, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    gemm_compact_precondition(queue, transa, transb, m, n, k, alpha, ap, ldap, bp, ldbp, beta, cp,
+                              ldcp, batch_size, dependencies);
+    auto done = detail::gemm_compact(queue, transa, transb, m, n, k, alpha, ap, ldap, bp, ldbp,
+                                     beta, cp, ldcp, batch_size, dependencies);
+    gemm_compact_postcondition(queue, transa, transb, m, n, k, alpha, ap, ldap, bp, ldbp, beta, cp,
+                               ldcp, batch_size, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event trsm_compact(
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+    std::int64_t m, std::int64_t n, float alpha, const float *ap, std::int64_t ldap, float *bp,
+    std::int64_t ldbp, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    trsm_compact_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, ap,
+                              ldap, bp, ldbp, batch_size, dependencies);
+    auto done = detail::trsm_compact(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha,
+                                     ap, ldap, bp, ldbp, batch_size, dependencies);
+    trsm_compact_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, ap,
+                               ldap, bp, ldbp, batch_size, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event trsm_compact(
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+    std::int64_t m, std::int64_t n, double alpha, const double *ap, std::int64_t ldap, double *bp,
+    std::int64_t ldbp, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    trsm_compact_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, ap,
+                              ldap, bp, ldbp, batch_size, dependencies);
+    auto done = detail::trsm_compact(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha,
+                                     ap, ldap, bp, ldbp, batch_size, dependencies);
+    trsm_compact_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, ap,
+                               ldap, bp, ldbp, batch_size, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event trsm_compact(
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+    std::int64_t m, std::int64_t n, std::complex<float> alpha, const std::complex<float> *ap,
+    std::int64_t ldap, std::complex<float> *bp, std::int64_t ldbp, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    trsm_compact_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, ap,
+                              ldap, bp, ldbp, batch_size, dependencies);
+    auto done = detail::trsm_compact(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha,
+                                     ap, ldap, bp, ldbp, batch_size, dependencies);
+    trsm_compact_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, ap,
+                               ldap, bp, ldbp, batch_size, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event trsm_compact(
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+    std::int64_t m, std::int64_t n, std::complex<double> alpha, const std::complex<double> *ap,
+    std::int64_t ldap, std::complex<double> *bp, std::int64_t ldbp, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    trsm_compact_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, ap,
+                              ldap, bp, ldbp, batch_size, dependencies);
+    auto done = detail::trsm_compact(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha,
+                                     ap, ldap, bp, ldbp, batch_size, dependencies);
+    trsm_compact_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, ap,
+                               ldap, bp, ldbp, batch_size, dependencies);
+    return done;
+}
+
 static inline cl::sycl::event copy(
     cl::sycl::queue &queue, std::int64_t n, const float *x, std::int64_t incx, float *y,
     std::int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     copy_precondition(queue, n, x, incx, y, incy, dependencies);
-    auto done = detail::copy(select_backend(queue), queue, n, x, incx, y, incy, dependencies);
+    auto done = detail::copy(queue, n, x, incx, y, incy, dependencies);
     copy_postcondition(queue, n, x, incx, y, incy, dependencies);
     return done;
 }
@@ -1828,7 +2461,7 @@ static inline cl::sycl::event copy(
     cl::sycl::queue &queue, std::int64_t n, const double *x, std::int64_t incx, double *y,
     std::int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     copy_precondition(queue, n, x, incx, y, incy, dependencies);
-    auto done = detail::copy(select_backend(queue), queue, n, x, incx, y, incy, dependencies);
+    auto done = detail::copy(queue, n, x, incx, y, incy, dependencies);
     copy_postcondition(queue, n, x, incx, y, incy, dependencies);
     return done;
 }
@@ -1838,7 +2471,7 @@ static inline cl::sycl::event copy(
     std::complex<float> *y, std::int64_t incy,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     copy_precondition(queue, n, x, incx, y, incy, dependencies);
-    auto done = detail::copy(select_backend(queue), queue, n, x, incx, y, incy, dependencies);
+    auto done = detail::copy(queue, n, x, incx, y, incy, dependencies);
     copy_postcondition(queue, n, x, incx, y, incy, dependencies);
     return done;
 }
@@ -1848,7 +2481,7 @@ static inline cl::sycl::event copy(
     std::complex<double> *y, std::int64_t incy,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     copy_precondition(queue, n, x, incx, y, incy, dependencies);
-    auto done = detail::copy(select_backend(queue), queue, n, x, incx, y, incy, dependencies);
+    auto done = detail::copy(queue, n, x, incx, y, incy, dependencies);
     copy_postcondition(queue, n, x, incx, y, incy, dependencies);
     return done;
 }
@@ -1858,8 +2491,7 @@ static inline cl::sycl::event dot(
     std::int64_t incy, float *result,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     dot_precondition(queue, n, x, incx, y, incy, result, dependencies);
-    auto done =
-        detail::dot(select_backend(queue), queue, n, x, incx, y, incy, result, dependencies);
+    auto done = detail::dot(queue, n, x, incx, y, incy, result, dependencies);
     dot_postcondition(queue, n, x, incx, y, incy, result, dependencies);
     return done;
 }
@@ -1869,8 +2501,7 @@ static inline cl::sycl::event dot(
     std::int64_t incy, double *result,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     dot_precondition(queue, n, x, incx, y, incy, result, dependencies);
-    auto done =
-        detail::dot(select_backend(queue), queue, n, x, incx, y, incy, result, dependencies);
+    auto done = detail::dot(queue, n, x, incx, y, incy, result, dependencies);
     dot_postcondition(queue, n, x, incx, y, incy, result, dependencies);
     return done;
 }
@@ -1880,8 +2511,7 @@ static inline cl::sycl::event dot(
     std::int64_t incy, double *result,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     dot_precondition(queue, n, x, incx, y, incy, result, dependencies);
-    auto done =
-        detail::dot(select_backend(queue), queue, n, x, incx, y, incy, result, dependencies);
+    auto done = detail::dot(queue, n, x, incx, y, incy, result, dependencies);
     dot_postcondition(queue, n, x, incx, y, incy, result, dependencies);
     return done;
 }
@@ -1891,8 +2521,7 @@ static inline cl::sycl::event dotc(
     const std::complex<float> *y, std::int64_t incy, std::complex<float> *result,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     dotc_precondition(queue, n, x, incx, y, incy, result, dependencies);
-    auto done =
-        detail::dotc(select_backend(queue), queue, n, x, incx, y, incy, result, dependencies);
+    auto done = detail::dotc(queue, n, x, incx, y, incy, result, dependencies);
     dotc_postcondition(queue, n, x, incx, y, incy, result, dependencies);
     return done;
 }
@@ -1902,8 +2531,7 @@ static inline cl::sycl::event dotc(
     const std::complex<double> *y, std::int64_t incy, std::complex<double> *result,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     dotc_precondition(queue, n, x, incx, y, incy, result, dependencies);
-    auto done =
-        detail::dotc(select_backend(queue), queue, n, x, incx, y, incy, result, dependencies);
+    auto done = detail::dotc(queue, n, x, incx, y, incy, result, dependencies);
     dotc_postcondition(queue, n, x, incx, y, incy, result, dependencies);
     return done;
 }
@@ -1913,8 +2541,7 @@ static inline cl::sycl::event dotu(
     const std::complex<float> *y, std::int64_t incy, std::complex<float> *result,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     dotu_precondition(queue, n, x, incx, y, incy, result, dependencies);
-    auto done =
-        detail::dotu(select_backend(queue), queue, n, x, incx, y, incy, result, dependencies);
+    auto done = detail::dotu(queue, n, x, incx, y, incy, result, dependencies);
     dotu_postcondition(queue, n, x, incx, y, incy, result, dependencies);
     return done;
 }
@@ -1924,8 +2551,7 @@ static inline cl::sycl::event dotu(
     const std::complex<double> *y, std::int64_t incy, std::complex<double> *result,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     dotu_precondition(queue, n, x, incx, y, incy, result, dependencies);
-    auto done =
-        detail::dotu(select_backend(queue), queue, n, x, incx, y, incy, result, dependencies);
+    auto done = detail::dotu(queue, n, x, incx, y, incy, result, dependencies);
     dotu_postcondition(queue, n, x, incx, y, incy, result, dependencies);
     return done;
 }
@@ -1937,8 +2563,8 @@ static inline cl::sycl::event gbmv(
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     gbmv_precondition(queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy,
                       dependencies);
-    auto done = detail::gbmv(select_backend(queue), queue, trans, m, n, kl, ku, alpha, a, lda, x,
-                             incx, beta, y, incy, dependencies);
+    auto done = detail::gbmv(queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy,
+                             dependencies);
     gbmv_postcondition(queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy,
                        dependencies);
     return done;
@@ -1951,8 +2577,8 @@ static inline cl::sycl::event gbmv(
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     gbmv_precondition(queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy,
                       dependencies);
-    auto done = detail::gbmv(select_backend(queue), queue, trans, m, n, kl, ku, alpha, a, lda, x,
-                             incx, beta, y, incy, dependencies);
+    auto done = detail::gbmv(queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy,
+                             dependencies);
     gbmv_postcondition(queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy,
                        dependencies);
     return done;
@@ -1966,8 +2592,8 @@ static inline cl::sycl::event gbmv(
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     gbmv_precondition(queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy,
                       dependencies);
-    auto done = detail::gbmv(select_backend(queue), queue, trans, m, n, kl, ku, alpha, a, lda, x,
-                             incx, beta, y, incy, dependencies);
+    auto done = detail::gbmv(queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy,
+                             dependencies);
     gbmv_postcondition(queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy,
                        dependencies);
     return done;
@@ -1981,8 +2607,8 @@ static inline cl::sycl::event gbmv(
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     gbmv_precondition(queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy,
                       dependencies);
-    auto done = detail::gbmv(select_backend(queue), queue, trans, m, n, kl, ku, alpha, a, lda, x,
-                             incx, beta, y, incy, dependencies);
+    auto done = detail::gbmv(queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy,
+                             dependencies);
     gbmv_postcondition(queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy,
                        dependencies);
     return done;
@@ -1995,8 +2621,8 @@ static inline cl::sycl::event gemm(
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     gemm_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
                       dependencies);
-    auto done = detail::gemm(select_backend(queue), queue, transa, transb, m, n, k, alpha, a, lda,
-                             b, ldb, beta, c, ldc, dependencies);
+    auto done = detail::gemm(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                             dependencies);
     gemm_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
                        dependencies);
     return done;
@@ -2009,8 +2635,8 @@ static inline cl::sycl::event gemm(
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     gemm_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
                       dependencies);
-    auto done = detail::gemm(select_backend(queue), queue, transa, transb, m, n, k, alpha, a, lda,
-                             b, ldb, beta, c, ldc, dependencies);
+    auto done = detail::gemm(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                             dependencies);
     gemm_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
                        dependencies);
     return done;
@@ -2024,8 +2650,8 @@ static inline cl::sycl::event gemm(
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     gemm_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
                       dependencies);
-    auto done = detail::gemm(select_backend(queue), queue, transa, transb, m, n, k, alpha, a, lda,
-                             b, ldb, beta, c, ldc, dependencies);
+    auto done = detail::gemm(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                             dependencies);
     gemm_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
                        dependencies);
     return done;
@@ -2039,8 +2665,22 @@ static inline cl::sycl::event gemm(
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     gemm_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
                       dependencies);
-    auto done = detail::gemm(select_backend(queue), queue, transa, transb, m, n, k, alpha, a, lda,
-                             b, ldb, beta, c, ldc, dependencies);
+    auto done = detail::gemm(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                             dependencies);
+    gemm_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                       dependencies);
+    return done;
+}
+
+static inline cl::sycl::event gemm(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, bfloat16 alpha, const bfloat16 *a, std::int64_t lda, const bfloat16 *b,
+    std::int64_t ldb, bfloat16 beta, bfloat16 *c, std::int64_t ldc,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    gemm_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                      dependencies);
+    auto done = detail::gemm(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                             dependencies);
     gemm_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
                        dependencies);
     return done;
@@ -2053,9 +2693,8 @@ static inline cl::sycl::event gemm_batch(
     std::int64_t *group_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     gemm_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
                             group_count, group_size, dependencies);
-    auto done =
-        detail::gemm_batch(select_backend(queue), queue, transa, transb, m, n, k, alpha, a, lda, b,
-                           ldb, beta, c, ldc, group_count, group_size, dependencies);
+    auto done = detail::gemm_batch(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c,
+                                   ldc, group_count, group_size, dependencies);
     gemm_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
                              group_count, group_size, dependencies);
     return done;
@@ -2068,9 +2707,8 @@ static inline cl::sycl::event gemm_batch(
     std::int64_t *group_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     gemm_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
                             group_count, group_size, dependencies);
-    auto done =
-        detail::gemm_batch(select_backend(queue), queue, transa, transb, m, n, k, alpha, a, lda, b,
-                           ldb, beta, c, ldc, group_count, group_size, dependencies);
+    auto done = detail::gemm_batch(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c,
+                                   ldc, group_count, group_size, dependencies);
     gemm_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
                              group_count, group_size, dependencies);
     return done;
@@ -2084,9 +2722,8 @@ static inline cl::sycl::event gemm_batch(
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     gemm_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
                             group_count, group_size, dependencies);
-    auto done =
-        detail::gemm_batch(select_backend(queue), queue, transa, transb, m, n, k, alpha, a, lda, b,
-                           ldb, beta, c, ldc, group_count, group_size, dependencies);
+    auto done = detail::gemm_batch(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c,
+                                   ldc, group_count, group_size, dependencies);
     gemm_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
                              group_count, group_size, dependencies);
     return done;
@@ -2100,9 +2737,8 @@ static inline cl::sycl::event gemm_batch(
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     gemm_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
                             group_count, group_size, dependencies);
-    auto done =
-        detail::gemm_batch(select_backend(queue), queue, transa, transb, m, n, k, alpha, a, lda, b,
-                           ldb, beta, c, ldc, group_count, group_size, dependencies);
+    auto done = detail::gemm_batch(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c,
+                                   ldc, group_count, group_size, dependencies);
     gemm_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
                              group_count, group_size, dependencies);
     return done;
@@ -2116,9 +2752,8 @@ static inline cl::sycl::event gemm_batch(
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     gemm_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
                             stride_b, beta, c, ldc, stride_c, batch_size, dependencies);
-    auto done = detail::gemm_batch(select_backend(queue), queue, transa, transb, m, n, k, alpha, a,
-                                   lda, stride_a, b, ldb, stride_b, beta, c, ldc, stride_c,
-                                   batch_size, dependencies);
+    auto done = detail::gemm_batch(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                                   stride_b, beta, c, ldc, stride_c, batch_size, dependencies);
     gemm_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
                              stride_b, beta, c, ldc, stride_c, batch_size, dependencies);
     return done;
@@ -2132,9 +2767,8 @@ static inline cl::sycl::event gemm_batch(
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     gemm_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
                             stride_b, beta, c, ldc, stride_c, batch_size, dependencies);
-    auto done = detail::gemm_batch(select_backend(queue), queue, transa, transb, m, n, k, alpha, a,
-                                   lda, stride_a, b, ldb, stride_b, beta, c, ldc, stride_c,
-                                   batch_size, dependencies);
+    auto done = detail::gemm_batch(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                                   stride_b, beta, c, ldc, stride_c, batch_size, dependencies);
     gemm_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
                              stride_b, beta, c, ldc, stride_c, batch_size, dependencies);
     return done;
@@ -2148,9 +2782,8 @@ static inline cl::sycl::event gemm_batch(
     std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     gemm_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
                             stride_b, beta, c, ldc, stride_c, batch_size, dependencies);
-    auto done = detail::gemm_batch(select_backend(queue), queue, transa, transb, m, n, k, alpha, a,
-                                   lda, stride_a, b, ldb, stride_b, beta, c, ldc, stride_c,
-                                   batch_size, dependencies);
+    auto done = detail::gemm_batch(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                                   stride_b, beta, c, ldc, stride_c, batch_size, dependencies);
     gemm_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
                              stride_b, beta, c, ldc, stride_c, batch_size, dependencies);
     return done;
@@ -2164,14 +2797,169 @@ static inline cl::sycl::event gemm_batch(
     std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     gemm_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
                             stride_b, beta, c, ldc, stride_c, batch_size, dependencies);
-    auto done = detail::gemm_batch(select_backend(queue), queue, transa, transb, m, n, k, alpha, a,
-                                   lda, stride_a, b, ldb, stride_b, beta, c, ldc, stride_c,
-                                   batch_size, dependencies);
+    auto done = detail::gemm_batch(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                                   stride_b, beta, c, ldc, stride_c, batch_size, dependencies);
     gemm_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
                              stride_b, beta, c, ldc, stride_c, batch_size, dependencies);
     return done;
 }
 
+static inline cl::sycl::event trsm_batch(
+    cl::sycl::queue &queue, side *left_right, uplo *upper_lower, transpose *trans, diag *unit_diag,
+    std::int64_t *m, std::int64_t *n, float *alpha, const float **a, std::int64_t *lda, float **b,
+    std::int64_t *ldb, std::int64_t group_count, std::int64_t *group_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    trsm_batch_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                            b, ldb, group_count, group_size, dependencies);
+    auto done = detail::trsm_batch(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                                   lda, b, ldb, group_count, group_size, dependencies);
+    trsm_batch_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                             b, ldb, group_count, group_size, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event trsm_batch(
+    cl::sycl::queue &queue, side *left_right, uplo *upper_lower, transpose *trans, diag *unit_diag,
+    std::int64_t *m, std::int64_t *n, double *alpha, const double **a, std::int64_t *lda,
+    double **b, std::int64_t *ldb, std::int64_t group_count, std::int64_t *group_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    trsm_batch_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                            b, ldb, group_count, group_size, dependencies);
+    auto done = detail::trsm_batch(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                                   lda, b, ldb, group_count, group_size, dependencies);
+    trsm_batch_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                             b, ldb, group_count, group_size, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event trsm_batch(
+    cl::sycl::queue &queue, side *left_right, uplo *upper_lower, transpose *trans, diag *unit_diag,
+    std::int64_t *m, std::int64_t *n, std::complex<float> *alpha, const std::complex<float> **a,
+    std::int64_t *lda, std::complex<float> **b, std::int64_t *ldb, std::int64_t group_count,
+    std::int64_t *group_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    trsm_batch_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                            b, ldb, group_count, group_size, dependencies);
+    auto done = detail::trsm_batch(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                                   lda, b, ldb, group_count, group_size, dependencies);
+    trsm_batch_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                             b, ldb, group_count, group_size, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event trsm_batch(
+    cl::sycl::queue &queue, side *left_right, uplo *upper_lower, transpose *trans, diag *unit_diag,
+    std::int64_t *m, std::int64_t *n, std::complex<double> *alpha, const std::complex<double> **a,
+    std::int64_t *lda, std::complex<double> **b, std::int64_t *ldb, std::int64_t group_count,
+    std::int64_t *group_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    trsm_batch_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                            b, ldb, group_count, group_size, dependencies);
+    auto done = detail::trsm_batch(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                                   lda, b, ldb, group_count, group_size, dependencies);
+    trsm_batch_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                             b, ldb, group_count, group_size, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event trsm_batch(
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+    std::int64_t m, std::int64_t n, float alpha, const float *a, std::int64_t lda,
+    std::int64_t stride_a, float *b, std::int64_t ldb, std::int64_t stride_b,
+    std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    trsm_batch_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                            stride_a, b, ldb, stride_b, batch_size, dependencies);
+    auto done = detail::trsm_batch(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                                   lda, stride_a, b, ldb, stride_b, batch_size, dependencies);
+    trsm_batch_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                             stride_a, b, ldb, stride_b, batch_size, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event trsm_batch(
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+    std::int64_t m, std::int64_t n, double alpha, const double *a, std::int64_t lda,
+    std::int64_t stride_a, double *b, std::int64_t ldb, std::int64_t stride_b,
+    std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    trsm_batch_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                            stride_a, b, ldb, stride_b, batch_size, dependencies);
+    auto done = detail::trsm_batch(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                                   lda, stride_a, b, ldb, stride_b, batch_size, dependencies);
+    trsm_batch_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                             stride_a, b, ldb, stride_b, batch_size, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event trsm_batch(
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+    std::int64_t m, std::int64_t n, std::complex<float> alpha, const std::complex<float> *a,
+    std::int64_t lda, std::int64_t stride_a, std::complex<float> *b, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    trsm_batch_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                            stride_a, b, ldb, stride_b, batch_size, dependencies);
+    auto done = detail::trsm_batch(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                                   lda, stride_a, b, ldb, stride_b, batch_size, dependencies);
+    trsm_batch_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                             stride_a, b, ldb, stride_b, batch_size, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event trsm_batch(
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+    std::int64_t m, std::int64_t n, std::complex<double> alpha, const std::complex<double> *a,
+    std::int64_t lda, std::int64_t stride_a, std::complex<double> *b, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    trsm_batch_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                            stride_a, b, ldb, stride_b, batch_size, dependencies);
+    auto done = detail::trsm_batch(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                                   lda, stride_a, b, ldb, stride_b, batch_size, dependencies);
+    trsm_batch_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                             stride_a, b, ldb, stride_b, batch_size, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event gemm_ext(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, float alpha, const half *a, std::int64_t lda, const half *b, std::int64_t ldb,
+    float beta, float *c, std::int64_t ldc,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    gemm_ext_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                          dependencies);
+    auto done = detail::gemm_ext(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c,
+                                 ldc, dependencies);
+    gemm_ext_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                           dependencies);
+    return done;
+}
+
+static inline cl::sycl::event gemm_ext(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, float alpha, const bfloat16 *a, std::int64_t lda, const bfloat16 *b,
+    std::int64_t ldb, float beta, float *c, std::int64_t ldc,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    gemm_ext_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                          dependencies);
+    auto done = detail::gemm_ext(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c,
+                                 ldc, dependencies);
+    gemm_ext_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                           dependencies);
+    return done;
+}
+
+static inline cl::sycl::event gemm_ext(
+    cl::sycl::queue &queue, transpose transa, transpose transb, offset offsetc, std::int64_t m,
+    std::int64_t n, std::int64_t k, float alpha, const int8_t *a, std::int64_t lda, int8_t ao,
+    const uint8_t *b, std::int64_t ldb, uint8_t bo, float beta, int32_t *c, std::int64_t ldc,
+    const int32_t *co, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    gemm_ext_precondition(queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo,
+                          beta, c, ldc, co, dependencies);
+    auto done = detail::gemm_ext(queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb,
+                                 bo, beta, c, ldc, co, dependencies);
+    gemm_ext_postcondition(queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo,
+                           beta, c, ldc, co, dependencies);
+    return done;
+}
+
 static inline cl::sycl::event gemmt(
     cl::sycl::queue &queue, uplo upper_lower, transpose transa, transpose transb, std::int64_t n,
     std::int64_t k, float alpha, const float *a, std::int64_t lda, const float *b, std::int64_t ldb,
@@ -2179,8 +2967,8 @@ static inline cl::sycl::event gemmt(
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     gemmt_precondition(queue, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c,
                        ldc, dependencies);
-    auto done = detail::gemmt(select_backend(queue), queue, upper_lower, transa, transb, n, k,
-                              alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    auto done = detail::gemmt(queue, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta,
+                              c, ldc, dependencies);
     gemmt_postcondition(queue, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c,
                         ldc, dependencies);
     return done;
@@ -2193,8 +2981,8 @@ static inline cl::sycl::event gemmt(
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     gemmt_precondition(queue, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c,
                        ldc, dependencies);
-    auto done = detail::gemmt(select_backend(queue), queue, upper_lower, transa, transb, n, k,
-                              alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    auto done = detail::gemmt(queue, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta,
+                              c, ldc, dependencies);
     gemmt_postcondition(queue, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c,
                         ldc, dependencies);
     return done;
@@ -2208,8 +2996,8 @@ static inline cl::sycl::event gemmt(
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     gemmt_precondition(queue, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c,
                        ldc, dependencies);
-    auto done = detail::gemmt(select_backend(queue), queue, upper_lower, transa, transb, n, k,
-                              alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    auto done = detail::gemmt(queue, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta,
+                              c, ldc, dependencies);
     gemmt_postcondition(queue, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c,
                         ldc, dependencies);
     return done;
@@ -2223,8 +3011,8 @@ static inline cl::sycl::event gemmt(
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     gemmt_precondition(queue, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c,
                        ldc, dependencies);
-    auto done = detail::gemmt(select_backend(queue), queue, upper_lower, transa, transb, n, k,
-                              alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    auto done = detail::gemmt(queue, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta,
+                              c, ldc, dependencies);
     gemmt_postcondition(queue, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c,
                         ldc, dependencies);
     return done;
@@ -2235,8 +3023,8 @@ static inline cl::sycl::event gemv(
     const float *a, std::int64_t lda, const float *x, std::int64_t incx, float beta, float *y,
     std::int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     gemv_precondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
-    auto done = detail::gemv(select_backend(queue), queue, trans, m, n, alpha, a, lda, x, incx,
-                             beta, y, incy, dependencies);
+    auto done =
+        detail::gemv(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
     gemv_postcondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
     return done;
 }
@@ -2246,8 +3034,8 @@ static inline cl::sycl::event gemv(
     const double *a, std::int64_t lda, const double *x, std::int64_t incx, double beta, double *y,
     std::int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     gemv_precondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
-    auto done = detail::gemv(select_backend(queue), queue, trans, m, n, alpha, a, lda, x, incx,
-                             beta, y, incy, dependencies);
+    auto done =
+        detail::gemv(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
     gemv_postcondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
     return done;
 }
@@ -2259,8 +3047,8 @@ static inline cl::sycl::event gemv(
     std::complex<float> *y, std::int64_t incy,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     gemv_precondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
-    auto done = detail::gemv(select_backend(queue), queue, trans, m, n, alpha, a, lda, x, incx,
-                             beta, y, incy, dependencies);
+    auto done =
+        detail::gemv(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
     gemv_postcondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
     return done;
 }
@@ -2272,8 +3060,8 @@ static inline cl::sycl::event gemv(
     std::complex<double> *y, std::int64_t incy,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     gemv_precondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
-    auto done = detail::gemv(select_backend(queue), queue, trans, m, n, alpha, a, lda, x, incx,
-                             beta, y, incy, dependencies);
+    auto done =
+        detail::gemv(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
     gemv_postcondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
     return done;
 }
@@ -2283,8 +3071,7 @@ static inline cl::sycl::event ger(
     std::int64_t incx, const float *y, std::int64_t incy, float *a, std::int64_t lda,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     ger_precondition(queue, m, n, alpha, x, incx, y, incy, a, lda, dependencies);
-    auto done = detail::ger(select_backend(queue), queue, m, n, alpha, x, incx, y, incy, a, lda,
-                            dependencies);
+    auto done = detail::ger(queue, m, n, alpha, x, incx, y, incy, a, lda, dependencies);
     ger_postcondition(queue, m, n, alpha, x, incx, y, incy, a, lda, dependencies);
     return done;
 }
@@ -2294,8 +3081,7 @@ static inline cl::sycl::event ger(
     std::int64_t incx, const double *y, std::int64_t incy, double *a, std::int64_t lda,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     ger_precondition(queue, m, n, alpha, x, incx, y, incy, a, lda, dependencies);
-    auto done = detail::ger(select_backend(queue), queue, m, n, alpha, x, incx, y, incy, a, lda,
-                            dependencies);
+    auto done = detail::ger(queue, m, n, alpha, x, incx, y, incy, a, lda, dependencies);
     ger_postcondition(queue, m, n, alpha, x, incx, y, incy, a, lda, dependencies);
     return done;
 }
@@ -2306,8 +3092,7 @@ static inline cl::sycl::event gerc(
     std::int64_t incy, std::complex<float> *a, std::int64_t lda,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     gerc_precondition(queue, m, n, alpha, x, incx, y, incy, a, lda, dependencies);
-    auto done = detail::gerc(select_backend(queue), queue, m, n, alpha, x, incx, y, incy, a, lda,
-                             dependencies);
+    auto done = detail::gerc(queue, m, n, alpha, x, incx, y, incy, a, lda, dependencies);
     gerc_postcondition(queue, m, n, alpha, x, incx, y, incy, a, lda, dependencies);
     return done;
 }
@@ -2318,8 +3103,7 @@ static inline cl::sycl::event gerc(
     std::int64_t incy, std::complex<double> *a, std::int64_t lda,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     gerc_precondition(queue, m, n, alpha, x, incx, y, incy, a, lda, dependencies);
-    auto done = detail::gerc(select_backend(queue), queue, m, n, alpha, x, incx, y, incy, a, lda,
-                             dependencies);
+    auto done = detail::gerc(queue, m, n, alpha, x, incx, y, incy, a, lda, dependencies);
     gerc_postcondition(queue, m, n, alpha, x, incx, y, incy, a, lda, dependencies);
     return done;
 }
@@ -2330,8 +3114,7 @@ static inline cl::sycl::event geru(
     std::int64_t incy, std::complex<float> *a, std::int64_t lda,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     geru_precondition(queue, m, n, alpha, x, incx, y, incy, a, lda, dependencies);
-    auto done = detail::geru(select_backend(queue), queue, m, n, alpha, x, incx, y, incy, a, lda,
-                             dependencies);
+    auto done = detail::geru(queue, m, n, alpha, x, incx, y, incy, a, lda, dependencies);
     geru_postcondition(queue, m, n, alpha, x, incx, y, incy, a, lda, dependencies);
     return done;
 }
@@ -2342,8 +3125,7 @@ static inline cl::sycl::event geru(
     std::int64_t incy, std::complex<double> *a, std::int64_t lda,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     geru_precondition(queue, m, n, alpha, x, incx, y, incy, a, lda, dependencies);
-    auto done = detail::geru(select_backend(queue), queue, m, n, alpha, x, incx, y, incy, a, lda,
-                             dependencies);
+    auto done = detail::geru(queue, m, n, alpha, x, incx, y, incy, a, lda, dependencies);
     geru_postcondition(queue, m, n, alpha, x, incx, y, incy, a, lda, dependencies);
     return done;
 }
@@ -2356,8 +3138,8 @@ static inline cl::sycl::event hbmv(
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     hbmv_precondition(queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy,
                       dependencies);
-    auto done = detail::hbmv(select_backend(queue), queue, upper_lower, n, k, alpha, a, lda, x,
-                             incx, beta, y, incy, dependencies);
+    auto done =
+        detail::hbmv(queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy, dependencies);
     hbmv_postcondition(queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy,
                        dependencies);
     return done;
@@ -2371,8 +3153,8 @@ static inline cl::sycl::event hbmv(
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     hbmv_precondition(queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy,
                       dependencies);
-    auto done = detail::hbmv(select_backend(queue), queue, upper_lower, n, k, alpha, a, lda, x,
-                             incx, beta, y, incy, dependencies);
+    auto done =
+        detail::hbmv(queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy, dependencies);
     hbmv_postcondition(queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy,
                        dependencies);
     return done;
@@ -2386,8 +3168,8 @@ static inline cl::sycl::event hemm(
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     hemm_precondition(queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc,
                       dependencies);
-    auto done = detail::hemm(select_backend(queue), queue, left_right, upper_lower, m, n, alpha, a,
-                             lda, b, ldb, beta, c, ldc, dependencies);
+    auto done = detail::hemm(queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c,
+                             ldc, dependencies);
     hemm_postcondition(queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc,
                        dependencies);
     return done;
@@ -2401,8 +3183,8 @@ static inline cl::sycl::event hemm(
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     hemm_precondition(queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc,
                       dependencies);
-    auto done = detail::hemm(select_backend(queue), queue, left_right, upper_lower, m, n, alpha, a,
-                             lda, b, ldb, beta, c, ldc, dependencies);
+    auto done = detail::hemm(queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c,
+                             ldc, dependencies);
     hemm_postcondition(queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc,
                        dependencies);
     return done;
@@ -2414,8 +3196,8 @@ static inline cl::sycl::event hemv(
     std::complex<float> beta, std::complex<float> *y, std::int64_t incy,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     hemv_precondition(queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
-    auto done = detail::hemv(select_backend(queue), queue, upper_lower, n, alpha, a, lda, x, incx,
-                             beta, y, incy, dependencies);
+    auto done =
+        detail::hemv(queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
     hemv_postcondition(queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
     return done;
 }
@@ -2426,8 +3208,8 @@ static inline cl::sycl::event hemv(
     std::int64_t incx, std::complex<double> beta, std::complex<double> *y, std::int64_t incy,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     hemv_precondition(queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
-    auto done = detail::hemv(select_backend(queue), queue, upper_lower, n, alpha, a, lda, x, incx,
-                             beta, y, incy, dependencies);
+    auto done =
+        detail::hemv(queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
     hemv_postcondition(queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
     return done;
 }
@@ -2437,8 +3219,7 @@ static inline cl::sycl::event her(
     const std::complex<float> *x, std::int64_t incx, std::complex<float> *a, std::int64_t lda,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     her_precondition(queue, upper_lower, n, alpha, x, incx, a, lda, dependencies);
-    auto done = detail::her(select_backend(queue), queue, upper_lower, n, alpha, x, incx, a, lda,
-                            dependencies);
+    auto done = detail::her(queue, upper_lower, n, alpha, x, incx, a, lda, dependencies);
     her_postcondition(queue, upper_lower, n, alpha, x, incx, a, lda, dependencies);
     return done;
 }
@@ -2448,8 +3229,7 @@ static inline cl::sycl::event her(
     const std::complex<double> *x, std::int64_t incx, std::complex<double> *a, std::int64_t lda,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     her_precondition(queue, upper_lower, n, alpha, x, incx, a, lda, dependencies);
-    auto done = detail::her(select_backend(queue), queue, upper_lower, n, alpha, x, incx, a, lda,
-                            dependencies);
+    auto done = detail::her(queue, upper_lower, n, alpha, x, incx, a, lda, dependencies);
     her_postcondition(queue, upper_lower, n, alpha, x, incx, a, lda, dependencies);
     return done;
 }
@@ -2460,8 +3240,7 @@ static inline cl::sycl::event her2(
     std::int64_t incy, std::complex<float> *a, std::int64_t lda,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     her2_precondition(queue, upper_lower, n, alpha, x, incx, y, incy, a, lda, dependencies);
-    auto done = detail::her2(select_backend(queue), queue, upper_lower, n, alpha, x, incx, y, incy,
-                             a, lda, dependencies);
+    auto done = detail::her2(queue, upper_lower, n, alpha, x, incx, y, incy, a, lda, dependencies);
     her2_postcondition(queue, upper_lower, n, alpha, x, incx, y, incy, a, lda, dependencies);
     return done;
 }
@@ -2472,8 +3251,7 @@ static inline cl::sycl::event her2(
     std::int64_t incy, std::complex<double> *a, std::int64_t lda,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     her2_precondition(queue, upper_lower, n, alpha, x, incx, y, incy, a, lda, dependencies);
-    auto done = detail::her2(select_backend(queue), queue, upper_lower, n, alpha, x, incx, y, incy,
-                             a, lda, dependencies);
+    auto done = detail::her2(queue, upper_lower, n, alpha, x, incx, y, incy, a, lda, dependencies);
     her2_postcondition(queue, upper_lower, n, alpha, x, incx, y, incy, a, lda, dependencies);
     return done;
 }
@@ -2485,8 +3263,8 @@ static inline cl::sycl::event her2k(
     std::int64_t ldc, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     her2k_precondition(queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
                        dependencies);
-    auto done = detail::her2k(select_backend(queue), queue, upper_lower, trans, n, k, alpha, a, lda,
-                              b, ldb, beta, c, ldc, dependencies);
+    auto done = detail::her2k(queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                              dependencies);
     her2k_postcondition(queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
                         dependencies);
     return done;
@@ -2499,8 +3277,8 @@ static inline cl::sycl::event her2k(
     std::int64_t ldc, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     her2k_precondition(queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
                        dependencies);
-    auto done = detail::her2k(select_backend(queue), queue, upper_lower, trans, n, k, alpha, a, lda,
-                              b, ldb, beta, c, ldc, dependencies);
+    auto done = detail::her2k(queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                              dependencies);
     her2k_postcondition(queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
                         dependencies);
     return done;
@@ -2511,8 +3289,8 @@ static inline cl::sycl::event herk(
     float alpha, const std::complex<float> *a, std::int64_t lda, float beta, std::complex<float> *c,
     std::int64_t ldc, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     herk_precondition(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
-    auto done = detail::herk(select_backend(queue), queue, upper_lower, trans, n, k, alpha, a, lda,
-                             beta, c, ldc, dependencies);
+    auto done =
+        detail::herk(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
     herk_postcondition(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
     return done;
 }
@@ -2523,8 +3301,8 @@ static inline cl::sycl::event herk(
     std::complex<double> *c, std::int64_t ldc,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     herk_precondition(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
-    auto done = detail::herk(select_backend(queue), queue, upper_lower, trans, n, k, alpha, a, lda,
-                             beta, c, ldc, dependencies);
+    auto done =
+        detail::herk(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
     herk_postcondition(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
     return done;
 }
@@ -2535,8 +3313,7 @@ static inline cl::sycl::event hpmv(
     std::complex<float> beta, std::complex<float> *y, std::int64_t incy,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     hpmv_precondition(queue, upper_lower, n, alpha, a, x, incx, beta, y, incy, dependencies);
-    auto done = detail::hpmv(select_backend(queue), queue, upper_lower, n, alpha, a, x, incx, beta,
-                             y, incy, dependencies);
+    auto done = detail::hpmv(queue, upper_lower, n, alpha, a, x, incx, beta, y, incy, dependencies);
     hpmv_postcondition(queue, upper_lower, n, alpha, a, x, incx, beta, y, incy, dependencies);
     return done;
 }
@@ -2547,8 +3324,7 @@ static inline cl::sycl::event hpmv(
     std::complex<double> beta, std::complex<double> *y, std::int64_t incy,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     hpmv_precondition(queue, upper_lower, n, alpha, a, x, incx, beta, y, incy, dependencies);
-    auto done = detail::hpmv(select_backend(queue), queue, upper_lower, n, alpha, a, x, incx, beta,
-                             y, incy, dependencies);
+    auto done = detail::hpmv(queue, upper_lower, n, alpha, a, x, incx, beta, y, incy, dependencies);
     hpmv_postcondition(queue, upper_lower, n, alpha, a, x, incx, beta, y, incy, dependencies);
     return done;
 }
@@ -2558,8 +3334,7 @@ static inline cl::sycl::event hpr(
     const std::complex<float> *x, std::int64_t incx, std::complex<float> *a,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     hpr_precondition(queue, upper_lower, n, alpha, x, incx, a, dependencies);
-    auto done =
-        detail::hpr(select_backend(queue), queue, upper_lower, n, alpha, x, incx, a, dependencies);
+    auto done = detail::hpr(queue, upper_lower, n, alpha, x, incx, a, dependencies);
     hpr_postcondition(queue, upper_lower, n, alpha, x, incx, a, dependencies);
     return done;
 }
@@ -2569,8 +3344,7 @@ static inline cl::sycl::event hpr(
     const std::complex<double> *x, std::int64_t incx, std::complex<double> *a,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     hpr_precondition(queue, upper_lower, n, alpha, x, incx, a, dependencies);
-    auto done =
-        detail::hpr(select_backend(queue), queue, upper_lower, n, alpha, x, incx, a, dependencies);
+    auto done = detail::hpr(queue, upper_lower, n, alpha, x, incx, a, dependencies);
     hpr_postcondition(queue, upper_lower, n, alpha, x, incx, a, dependencies);
     return done;
 }
@@ -2581,8 +3355,7 @@ static inline cl::sycl::event hpr2(
     std::int64_t incy, std::complex<float> *a,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     hpr2_precondition(queue, upper_lower, n, alpha, x, incx, y, incy, a, dependencies);
-    auto done = detail::hpr2(select_backend(queue), queue, upper_lower, n, alpha, x, incx, y, incy,
-                             a, dependencies);
+    auto done = detail::hpr2(queue, upper_lower, n, alpha, x, incx, y, incy, a, dependencies);
     hpr2_postcondition(queue, upper_lower, n, alpha, x, incx, y, incy, a, dependencies);
     return done;
 }
@@ -2593,8 +3366,7 @@ static inline cl::sycl::event hpr2(
     std::int64_t incy, std::complex<double> *a,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     hpr2_precondition(queue, upper_lower, n, alpha, x, incx, y, incy, a, dependencies);
-    auto done = detail::hpr2(select_backend(queue), queue, upper_lower, n, alpha, x, incx, y, incy,
-                             a, dependencies);
+    auto done = detail::hpr2(queue, upper_lower, n, alpha, x, incx, y, incy, a, dependencies);
     hpr2_postcondition(queue, upper_lower, n, alpha, x, incx, y, incy, a, dependencies);
     return done;
 }
@@ -2603,7 +3375,7 @@ static inline cl::sycl::event iamax(
     cl::sycl::queue &queue, std::int64_t n, const float *x, std::int64_t incx, std::int64_t *result,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     iamax_precondition(queue, n, x, incx, result, dependencies);
-    auto done = detail::iamax(select_backend(queue), queue, n, x, incx, result, dependencies);
+    auto done = detail::iamax(queue, n, x, incx, result, dependencies);
     iamax_postcondition(queue, n, x, incx, result, dependencies);
     return done;
 }
@@ -2612,7 +3384,7 @@ static inline cl::sycl::event iamax(
     cl::sycl::queue &queue, std::int64_t n, const double *x, std::int64_t incx,
     std::int64_t *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     iamax_precondition(queue, n, x, incx, result, dependencies);
-    auto done = detail::iamax(select_backend(queue), queue, n, x, incx, result, dependencies);
+    auto done = detail::iamax(queue, n, x, incx, result, dependencies);
     iamax_postcondition(queue, n, x, incx, result, dependencies);
     return done;
 }
@@ -2621,7 +3393,7 @@ static inline cl::sycl::event iamax(
     cl::sycl::queue &queue, std::int64_t n, const std::complex<float> *x, std::int64_t incx,
     std::int64_t *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     iamax_precondition(queue, n, x, incx, result, dependencies);
-    auto done = detail::iamax(select_backend(queue), queue, n, x, incx, result, dependencies);
+    auto done = detail::iamax(queue, n, x, incx, result, dependencies);
     iamax_postcondition(queue, n, x, incx, result, dependencies);
     return done;
 }
@@ -2630,7 +3402,7 @@ static inline cl::sycl::event iamax(
     cl::sycl::queue &queue, std::int64_t n, const std::complex<double> *x, std::int64_t incx,
     std::int64_t *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     iamax_precondition(queue, n, x, incx, result, dependencies);
-    auto done = detail::iamax(select_backend(queue), queue, n, x, incx, result, dependencies);
+    auto done = detail::iamax(queue, n, x, incx, result, dependencies);
     iamax_postcondition(queue, n, x, incx, result, dependencies);
     return done;
 }
@@ -2639,7 +3411,7 @@ static inline cl::sycl::event iamin(
     cl::sycl::queue &queue, std::int64_t n, const float *x, std::int64_t incx, std::int64_t *result,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     iamin_precondition(queue, n, x, incx, result, dependencies);
-    auto done = detail::iamin(select_backend(queue), queue, n, x, incx, result, dependencies);
+    auto done = detail::iamin(queue, n, x, incx, result, dependencies);
     iamin_postcondition(queue, n, x, incx, result, dependencies);
     return done;
 }
@@ -2648,7 +3420,7 @@ static inline cl::sycl::event iamin(
     cl::sycl::queue &queue, std::int64_t n, const double *x, std::int64_t incx,
     std::int64_t *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     iamin_precondition(queue, n, x, incx, result, dependencies);
-    auto done = detail::iamin(select_backend(queue), queue, n, x, incx, result, dependencies);
+    auto done = detail::iamin(queue, n, x, incx, result, dependencies);
     iamin_postcondition(queue, n, x, incx, result, dependencies);
     return done;
 }
@@ -2657,7 +3429,7 @@ static inline cl::sycl::event iamin(
     cl::sycl::queue &queue, std::int64_t n, const std::complex<float> *x, std::int64_t incx,
     std::int64_t *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     iamin_precondition(queue, n, x, incx, result, dependencies);
-    auto done = detail::iamin(select_backend(queue), queue, n, x, incx, result, dependencies);
+    auto done = detail::iamin(queue, n, x, incx, result, dependencies);
     iamin_postcondition(queue, n, x, incx, result, dependencies);
     return done;
 }
@@ -2666,7 +3438,7 @@ static inline cl::sycl::event iamin(
     cl::sycl::queue &queue, std::int64_t n, const std::complex<double> *x, std::int64_t incx,
     std::int64_t *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     iamin_precondition(queue, n, x, incx, result, dependencies);
-    auto done = detail::iamin(select_backend(queue), queue, n, x, incx, result, dependencies);
+    auto done = detail::iamin(queue, n, x, incx, result, dependencies);
     iamin_postcondition(queue, n, x, incx, result, dependencies);
     return done;
 }
@@ -2675,7 +3447,7 @@ static inline cl::sycl::event nrm2(
     cl::sycl::queue &queue, std::int64_t n, const std::complex<float> *x, std::int64_t incx,
     float *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     nrm2_precondition(queue, n, x, incx, result, dependencies);
-    auto done = detail::nrm2(select_backend(queue), queue, n, x, incx, result, dependencies);
+    auto done = detail::nrm2(queue, n, x, incx, result, dependencies);
     nrm2_postcondition(queue, n, x, incx, result, dependencies);
     return done;
 }
@@ -2684,7 +3456,7 @@ static inline cl::sycl::event nrm2(
     cl::sycl::queue &queue, std::int64_t n, const std::complex<double> *x, std::int64_t incx,
     double *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     nrm2_precondition(queue, n, x, incx, result, dependencies);
-    auto done = detail::nrm2(select_backend(queue), queue, n, x, incx, result, dependencies);
+    auto done = detail::nrm2(queue, n, x, incx, result, dependencies);
     nrm2_postcondition(queue, n, x, incx, result, dependencies);
     return done;
 }
@@ -2693,7 +3465,7 @@ static inline cl::sycl::event nrm2(
     cl::sycl::queue &queue, std::int64_t n, const float *x, std::int64_t incx, float *result,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     nrm2_precondition(queue, n, x, incx, result, dependencies);
-    auto done = detail::nrm2(select_backend(queue), queue, n, x, incx, result, dependencies);
+    auto done = detail::nrm2(queue, n, x, incx, result, dependencies);
     nrm2_postcondition(queue, n, x, incx, result, dependencies);
     return done;
 }
@@ -2702,7 +3474,7 @@ static inline cl::sycl::event nrm2(
     cl::sycl::queue &queue, std::int64_t n, const double *x, std::int64_t incx, double *result,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     nrm2_precondition(queue, n, x, incx, result, dependencies);
-    auto done = detail::nrm2(select_backend(queue), queue, n, x, incx, result, dependencies);
+    auto done = detail::nrm2(queue, n, x, incx, result, dependencies);
     nrm2_postcondition(queue, n, x, incx, result, dependencies);
     return done;
 }
@@ -2712,7 +3484,7 @@ static inline cl::sycl::event rot(
     std::complex<float> *y, std::int64_t incy, float c, float s,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     rot_precondition(queue, n, x, incx, y, incy, c, s, dependencies);
-    auto done = detail::rot(select_backend(queue), queue, n, x, incx, y, incy, c, s, dependencies);
+    auto done = detail::rot(queue, n, x, incx, y, incy, c, s, dependencies);
     rot_postcondition(queue, n, x, incx, y, incy, c, s, dependencies);
     return done;
 }
@@ -2722,7 +3494,7 @@ static inline cl::sycl::event rot(
     std::complex<double> *y, std::int64_t incy, double c, double s,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     rot_precondition(queue, n, x, incx, y, incy, c, s, dependencies);
-    auto done = detail::rot(select_backend(queue), queue, n, x, incx, y, incy, c, s, dependencies);
+    auto done = detail::rot(queue, n, x, incx, y, incy, c, s, dependencies);
     rot_postcondition(queue, n, x, incx, y, incy, c, s, dependencies);
     return done;
 }
@@ -2732,7 +3504,7 @@ static inline cl::sycl::event rot(
     std::int64_t incy, float c, float s,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     rot_precondition(queue, n, x, incx, y, incy, c, s, dependencies);
-    auto done = detail::rot(select_backend(queue), queue, n, x, incx, y, incy, c, s, dependencies);
+    auto done = detail::rot(queue, n, x, incx, y, incy, c, s, dependencies);
     rot_postcondition(queue, n, x, incx, y, incy, c, s, dependencies);
     return done;
 }
@@ -2742,7 +3514,7 @@ static inline cl::sycl::event rot(
     std::int64_t incy, double c, double s,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     rot_precondition(queue, n, x, incx, y, incy, c, s, dependencies);
-    auto done = detail::rot(select_backend(queue), queue, n, x, incx, y, incy, c, s, dependencies);
+    auto done = detail::rot(queue, n, x, incx, y, incy, c, s, dependencies);
     rot_postcondition(queue, n, x, incx, y, incy, c, s, dependencies);
     return done;
 }
@@ -2751,7 +3523,7 @@ static inline cl::sycl::event rotg(
     cl::sycl::queue &queue, float *a, float *b, float *c, float *s,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     rotg_precondition(queue, a, b, c, s, dependencies);
-    auto done = detail::rotg(select_backend(queue), queue, a, b, c, s, dependencies);
+    auto done = detail::rotg(queue, a, b, c, s, dependencies);
     rotg_postcondition(queue, a, b, c, s, dependencies);
     return done;
 }
@@ -2760,7 +3532,7 @@ static inline cl::sycl::event rotg(
     cl::sycl::queue &queue, double *a, double *b, double *c, double *s,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     rotg_precondition(queue, a, b, c, s, dependencies);
-    auto done = detail::rotg(select_backend(queue), queue, a, b, c, s, dependencies);
+    auto done = detail::rotg(queue, a, b, c, s, dependencies);
     rotg_postcondition(queue, a, b, c, s, dependencies);
     return done;
 }
@@ -2769,7 +3541,7 @@ static inline cl::sycl::event rotg(
     cl::sycl::queue &queue, std::complex<float> *a, std::complex<float> *b, float *c,
     std::complex<float> *s, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     rotg_precondition(queue, a, b, c, s, dependencies);
-    auto done = detail::rotg(select_backend(queue), queue, a, b, c, s, dependencies);
+    auto done = detail::rotg(queue, a, b, c, s, dependencies);
     rotg_postcondition(queue, a, b, c, s, dependencies);
     return done;
 }
@@ -2778,7 +3550,7 @@ static inline cl::sycl::event rotg(
     cl::sycl::queue &queue, std::complex<double> *a, std::complex<double> *b, double *c,
     std::complex<double> *s, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     rotg_precondition(queue, a, b, c, s, dependencies);
-    auto done = detail::rotg(select_backend(queue), queue, a, b, c, s, dependencies);
+    auto done = detail::rotg(queue, a, b, c, s, dependencies);
     rotg_postcondition(queue, a, b, c, s, dependencies);
     return done;
 }
@@ -2788,8 +3560,7 @@ static inline cl::sycl::event rotm(
     std::int64_t incy, float *param,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     rotm_precondition(queue, n, x, incx, y, incy, param, dependencies);
-    auto done =
-        detail::rotm(select_backend(queue), queue, n, x, incx, y, incy, param, dependencies);
+    auto done = detail::rotm(queue, n, x, incx, y, incy, param, dependencies);
     rotm_postcondition(queue, n, x, incx, y, incy, param, dependencies);
     return done;
 }
@@ -2799,8 +3570,7 @@ static inline cl::sycl::event rotm(
     std::int64_t incy, double *param,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     rotm_precondition(queue, n, x, incx, y, incy, param, dependencies);
-    auto done =
-        detail::rotm(select_backend(queue), queue, n, x, incx, y, incy, param, dependencies);
+    auto done = detail::rotm(queue, n, x, incx, y, incy, param, dependencies);
     rotm_postcondition(queue, n, x, incx, y, incy, param, dependencies);
     return done;
 }
@@ -2809,7 +3579,7 @@ static inline cl::sycl::event rotmg(
     cl::sycl::queue &queue, float *d1, float *d2, float *x1, float y1, float *param,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     rotmg_precondition(queue, d1, d2, x1, y1, param, dependencies);
-    auto done = detail::rotmg(select_backend(queue), queue, d1, d2, x1, y1, param, dependencies);
+    auto done = detail::rotmg(queue, d1, d2, x1, y1, param, dependencies);
     rotmg_postcondition(queue, d1, d2, x1, y1, param, dependencies);
     return done;
 }
@@ -2818,7 +3588,7 @@ static inline cl::sycl::event rotmg(
     cl::sycl::queue &queue, double *d1, double *d2, double *x1, double y1, double *param,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     rotmg_precondition(queue, d1, d2, x1, y1, param, dependencies);
-    auto done = detail::rotmg(select_backend(queue), queue, d1, d2, x1, y1, param, dependencies);
+    auto done = detail::rotmg(queue, d1, d2, x1, y1, param, dependencies);
     rotmg_postcondition(queue, d1, d2, x1, y1, param, dependencies);
     return done;
 }
@@ -2829,8 +3599,8 @@ static inline cl::sycl::event sbmv(
     std::int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     sbmv_precondition(queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy,
                       dependencies);
-    auto done = detail::sbmv(select_backend(queue), queue, upper_lower, n, k, alpha, a, lda, x,
-                             incx, beta, y, incy, dependencies);
+    auto done =
+        detail::sbmv(queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy, dependencies);
     sbmv_postcondition(queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy,
                        dependencies);
     return done;
@@ -2842,8 +3612,8 @@ static inline cl::sycl::event sbmv(
     std::int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     sbmv_precondition(queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy,
                       dependencies);
-    auto done = detail::sbmv(select_backend(queue), queue, upper_lower, n, k, alpha, a, lda, x,
-                             incx, beta, y, incy, dependencies);
+    auto done =
+        detail::sbmv(queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy, dependencies);
     sbmv_postcondition(queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy,
                        dependencies);
     return done;
@@ -2853,7 +3623,7 @@ static inline cl::sycl::event scal(
     cl::sycl::queue &queue, std::int64_t n, float alpha, float *x, std::int64_t incx,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     scal_precondition(queue, n, alpha, x, incx, dependencies);
-    auto done = detail::scal(select_backend(queue), queue, n, alpha, x, incx, dependencies);
+    auto done = detail::scal(queue, n, alpha, x, incx, dependencies);
     scal_postcondition(queue, n, alpha, x, incx, dependencies);
     return done;
 }
@@ -2862,7 +3632,7 @@ static inline cl::sycl::event scal(
     cl::sycl::queue &queue, std::int64_t n, double alpha, double *x, std::int64_t incx,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     scal_precondition(queue, n, alpha, x, incx, dependencies);
-    auto done = detail::scal(select_backend(queue), queue, n, alpha, x, incx, dependencies);
+    auto done = detail::scal(queue, n, alpha, x, incx, dependencies);
     scal_postcondition(queue, n, alpha, x, incx, dependencies);
     return done;
 }
@@ -2871,7 +3641,7 @@ static inline cl::sycl::event scal(
     cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha, std::complex<float> *x,
     std::int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     scal_precondition(queue, n, alpha, x, incx, dependencies);
-    auto done = detail::scal(select_backend(queue), queue, n, alpha, x, incx, dependencies);
+    auto done = detail::scal(queue, n, alpha, x, incx, dependencies);
     scal_postcondition(queue, n, alpha, x, incx, dependencies);
     return done;
 }
@@ -2880,7 +3650,7 @@ static inline cl::sycl::event scal(
     cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha, std::complex<double> *x,
     std::int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     scal_precondition(queue, n, alpha, x, incx, dependencies);
-    auto done = detail::scal(select_backend(queue), queue, n, alpha, x, incx, dependencies);
+    auto done = detail::scal(queue, n, alpha, x, incx, dependencies);
     scal_postcondition(queue, n, alpha, x, incx, dependencies);
     return done;
 }
@@ -2889,7 +3659,7 @@ static inline cl::sycl::event scal(
     cl::sycl::queue &queue, std::int64_t n, float alpha, std::complex<float> *x, std::int64_t incx,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     scal_precondition(queue, n, alpha, x, incx, dependencies);
-    auto done = detail::scal(select_backend(queue), queue, n, alpha, x, incx, dependencies);
+    auto done = detail::scal(queue, n, alpha, x, incx, dependencies);
     scal_postcondition(queue, n, alpha, x, incx, dependencies);
     return done;
 }
@@ -2898,7 +3668,7 @@ static inline cl::sycl::event scal(
     cl::sycl::queue &queue, std::int64_t n, double alpha, std::complex<double> *x,
     std::int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     scal_precondition(queue, n, alpha, x, incx, dependencies);
-    auto done = detail::scal(select_backend(queue), queue, n, alpha, x, incx, dependencies);
+    auto done = detail::scal(queue, n, alpha, x, incx, dependencies);
     scal_postcondition(queue, n, alpha, x, incx, dependencies);
     return done;
 }
@@ -2908,8 +3678,7 @@ static inline cl::sycl::event sdsdot(
     const float *y, std::int64_t incy, float *result,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     sdsdot_precondition(queue, n, sb, x, incx, y, incy, result, dependencies);
-    auto done =
-        detail::sdsdot(select_backend(queue), queue, n, sb, x, incx, y, incy, result, dependencies);
+    auto done = detail::sdsdot(queue, n, sb, x, incx, y, incy, result, dependencies);
     sdsdot_postcondition(queue, n, sb, x, incx, y, incy, result, dependencies);
     return done;
 }
@@ -2919,8 +3688,7 @@ static inline cl::sycl::event spmv(
     const float *x, std::int64_t incx, float beta, float *y, std::int64_t incy,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     spmv_precondition(queue, upper_lower, n, alpha, a, x, incx, beta, y, incy, dependencies);
-    auto done = detail::spmv(select_backend(queue), queue, upper_lower, n, alpha, a, x, incx, beta,
-                             y, incy, dependencies);
+    auto done = detail::spmv(queue, upper_lower, n, alpha, a, x, incx, beta, y, incy, dependencies);
     spmv_postcondition(queue, upper_lower, n, alpha, a, x, incx, beta, y, incy, dependencies);
     return done;
 }
@@ -2930,8 +3698,7 @@ static inline cl::sycl::event spmv(
     const double *x, std::int64_t incx, double beta, double *y, std::int64_t incy,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     spmv_precondition(queue, upper_lower, n, alpha, a, x, incx, beta, y, incy, dependencies);
-    auto done = detail::spmv(select_backend(queue), queue, upper_lower, n, alpha, a, x, incx, beta,
-                             y, incy, dependencies);
+    auto done = detail::spmv(queue, upper_lower, n, alpha, a, x, incx, beta, y, incy, dependencies);
     spmv_postcondition(queue, upper_lower, n, alpha, a, x, incx, beta, y, incy, dependencies);
     return done;
 }
@@ -2940,8 +3707,7 @@ static inline cl::sycl::event spr(
     cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, float alpha, const float *x,
     std::int64_t incx, float *a, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     spr_precondition(queue, upper_lower, n, alpha, x, incx, a, dependencies);
-    auto done =
-        detail::spr(select_backend(queue), queue, upper_lower, n, alpha, x, incx, a, dependencies);
+    auto done = detail::spr(queue, upper_lower, n, alpha, x, incx, a, dependencies);
     spr_postcondition(queue, upper_lower, n, alpha, x, incx, a, dependencies);
     return done;
 }
@@ -2951,8 +3717,7 @@ static inline cl::sycl::event spr(
     std::int64_t incx, double *a,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     spr_precondition(queue, upper_lower, n, alpha, x, incx, a, dependencies);
-    auto done =
-        detail::spr(select_backend(queue), queue, upper_lower, n, alpha, x, incx, a, dependencies);
+    auto done = detail::spr(queue, upper_lower, n, alpha, x, incx, a, dependencies);
     spr_postcondition(queue, upper_lower, n, alpha, x, incx, a, dependencies);
     return done;
 }
@@ -2962,8 +3727,7 @@ static inline cl::sycl::event spr2(
     std::int64_t incx, const float *y, std::int64_t incy, float *a,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     spr2_precondition(queue, upper_lower, n, alpha, x, incx, y, incy, a, dependencies);
-    auto done = detail::spr2(select_backend(queue), queue, upper_lower, n, alpha, x, incx, y, incy,
-                             a, dependencies);
+    auto done = detail::spr2(queue, upper_lower, n, alpha, x, incx, y, incy, a, dependencies);
     spr2_postcondition(queue, upper_lower, n, alpha, x, incx, y, incy, a, dependencies);
     return done;
 }
@@ -2973,8 +3737,7 @@ static inline cl::sycl::event spr2(
     std::int64_t incx, const double *y, std::int64_t incy, double *a,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     spr2_precondition(queue, upper_lower, n, alpha, x, incx, y, incy, a, dependencies);
-    auto done = detail::spr2(select_backend(queue), queue, upper_lower, n, alpha, x, incx, y, incy,
-                             a, dependencies);
+    auto done = detail::spr2(queue, upper_lower, n, alpha, x, incx, y, incy, a, dependencies);
     spr2_postcondition(queue, upper_lower, n, alpha, x, incx, y, incy, a, dependencies);
     return done;
 }
@@ -2983,7 +3746,7 @@ static inline cl::sycl::event swap(
     cl::sycl::queue &queue, std::int64_t n, float *x, std::int64_t incx, float *y,
     std::int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     swap_precondition(queue, n, x, incx, y, incy, dependencies);
-    auto done = detail::swap(select_backend(queue), queue, n, x, incx, y, incy, dependencies);
+    auto done = detail::swap(queue, n, x, incx, y, incy, dependencies);
     swap_postcondition(queue, n, x, incx, y, incy, dependencies);
     return done;
 }
@@ -2992,7 +3755,7 @@ static inline cl::sycl::event swap(
     cl::sycl::queue &queue, std::int64_t n, double *x, std::int64_t incx, double *y,
     std::int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     swap_precondition(queue, n, x, incx, y, incy, dependencies);
-    auto done = detail::swap(select_backend(queue), queue, n, x, incx, y, incy, dependencies);
+    auto done = detail::swap(queue, n, x, incx, y, incy, dependencies);
     swap_postcondition(queue, n, x, incx, y, incy, dependencies);
     return done;
 }
@@ -3002,7 +3765,7 @@ static inline cl::sycl::event swap(
     std::complex<float> *y, std::int64_t incy,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     swap_precondition(queue, n, x, incx, y, incy, dependencies);
-    auto done = detail::swap(select_backend(queue), queue, n, x, incx, y, incy, dependencies);
+    auto done = detail::swap(queue, n, x, incx, y, incy, dependencies);
     swap_postcondition(queue, n, x, incx, y, incy, dependencies);
     return done;
 }
@@ -3012,7 +3775,7 @@ static inline cl::sycl::event swap(
     std::complex<double> *y, std::int64_t incy,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     swap_precondition(queue, n, x, incx, y, incy, dependencies);
-    auto done = detail::swap(select_backend(queue), queue, n, x, incx, y, incy, dependencies);
+    auto done = detail::swap(queue, n, x, incx, y, incy, dependencies);
     swap_postcondition(queue, n, x, incx, y, incy, dependencies);
     return done;
 }
@@ -3023,8 +3786,8 @@ static inline cl::sycl::event symm(
     float *c, std::int64_t ldc, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     symm_precondition(queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc,
                       dependencies);
-    auto done = detail::symm(select_backend(queue), queue, left_right, upper_lower, m, n, alpha, a,
-                             lda, b, ldb, beta, c, ldc, dependencies);
+    auto done = detail::symm(queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c,
+                             ldc, dependencies);
     symm_postcondition(queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc,
                        dependencies);
     return done;
@@ -3036,8 +3799,8 @@ static inline cl::sycl::event symm(
     double *c, std::int64_t ldc, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     symm_precondition(queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc,
                       dependencies);
-    auto done = detail::symm(select_backend(queue), queue, left_right, upper_lower, m, n, alpha, a,
-                             lda, b, ldb, beta, c, ldc, dependencies);
+    auto done = detail::symm(queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c,
+                             ldc, dependencies);
     symm_postcondition(queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc,
                        dependencies);
     return done;
@@ -3051,8 +3814,8 @@ static inline cl::sycl::event symm(
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     symm_precondition(queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc,
                       dependencies);
-    auto done = detail::symm(select_backend(queue), queue, left_right, upper_lower, m, n, alpha, a,
-                             lda, b, ldb, beta, c, ldc, dependencies);
+    auto done = detail::symm(queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c,
+                             ldc, dependencies);
     symm_postcondition(queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc,
                        dependencies);
     return done;
@@ -3066,8 +3829,8 @@ static inline cl::sycl::event symm(
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     symm_precondition(queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc,
                       dependencies);
-    auto done = detail::symm(select_backend(queue), queue, left_right, upper_lower, m, n, alpha, a,
-                             lda, b, ldb, beta, c, ldc, dependencies);
+    auto done = detail::symm(queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c,
+                             ldc, dependencies);
     symm_postcondition(queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc,
                        dependencies);
     return done;
@@ -3078,8 +3841,8 @@ static inline cl::sycl::event symv(
     std::int64_t lda, const float *x, std::int64_t incx, float beta, float *y, std::int64_t incy,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     symv_precondition(queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
-    auto done = detail::symv(select_backend(queue), queue, upper_lower, n, alpha, a, lda, x, incx,
-                             beta, y, incy, dependencies);
+    auto done =
+        detail::symv(queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
     symv_postcondition(queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
     return done;
 }
@@ -3089,8 +3852,8 @@ static inline cl::sycl::event symv(
     std::int64_t lda, const double *x, std::int64_t incx, double beta, double *y, std::int64_t incy,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     symv_precondition(queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
-    auto done = detail::symv(select_backend(queue), queue, upper_lower, n, alpha, a, lda, x, incx,
-                             beta, y, incy, dependencies);
+    auto done =
+        detail::symv(queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
     symv_postcondition(queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
     return done;
 }
@@ -3100,8 +3863,7 @@ static inline cl::sycl::event syr(
     std::int64_t incx, float *a, std::int64_t lda,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     syr_precondition(queue, upper_lower, n, alpha, x, incx, a, lda, dependencies);
-    auto done = detail::syr(select_backend(queue), queue, upper_lower, n, alpha, x, incx, a, lda,
-                            dependencies);
+    auto done = detail::syr(queue, upper_lower, n, alpha, x, incx, a, lda, dependencies);
     syr_postcondition(queue, upper_lower, n, alpha, x, incx, a, lda, dependencies);
     return done;
 }
@@ -3111,8 +3873,7 @@ static inline cl::sycl::event syr(
     std::int64_t incx, double *a, std::int64_t lda,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     syr_precondition(queue, upper_lower, n, alpha, x, incx, a, lda, dependencies);
-    auto done = detail::syr(select_backend(queue), queue, upper_lower, n, alpha, x, incx, a, lda,
-                            dependencies);
+    auto done = detail::syr(queue, upper_lower, n, alpha, x, incx, a, lda, dependencies);
     syr_postcondition(queue, upper_lower, n, alpha, x, incx, a, lda, dependencies);
     return done;
 }
@@ -3122,8 +3883,7 @@ static inline cl::sycl::event syr2(
     std::int64_t incx, const float *y, std::int64_t incy, float *a, std::int64_t lda,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     syr2_precondition(queue, upper_lower, n, alpha, x, incx, y, incy, a, lda, dependencies);
-    auto done = detail::syr2(select_backend(queue), queue, upper_lower, n, alpha, x, incx, y, incy,
-                             a, lda, dependencies);
+    auto done = detail::syr2(queue, upper_lower, n, alpha, x, incx, y, incy, a, lda, dependencies);
     syr2_postcondition(queue, upper_lower, n, alpha, x, incx, y, incy, a, lda, dependencies);
     return done;
 }
@@ -3133,8 +3893,7 @@ static inline cl::sycl::event syr2(
     std::int64_t incx, const double *y, std::int64_t incy, double *a, std::int64_t lda,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     syr2_precondition(queue, upper_lower, n, alpha, x, incx, y, incy, a, lda, dependencies);
-    auto done = detail::syr2(select_backend(queue), queue, upper_lower, n, alpha, x, incx, y, incy,
-                             a, lda, dependencies);
+    auto done = detail::syr2(queue, upper_lower, n, alpha, x, incx, y, incy, a, lda, dependencies);
     syr2_postcondition(queue, upper_lower, n, alpha, x, incx, y, incy, a, lda, dependencies);
     return done;
 }
@@ -3145,8 +3904,8 @@ static inline cl::sycl::event syr2k(
     float *c, std::int64_t ldc, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     syr2k_precondition(queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
                        dependencies);
-    auto done = detail::syr2k(select_backend(queue), queue, upper_lower, trans, n, k, alpha, a, lda,
-                              b, ldb, beta, c, ldc, dependencies);
+    auto done = detail::syr2k(queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                              dependencies);
     syr2k_postcondition(queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
                         dependencies);
     return done;
@@ -3158,8 +3917,8 @@ static inline cl::sycl::event syr2k(
     double *c, std::int64_t ldc, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     syr2k_precondition(queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
                        dependencies);
-    auto done = detail::syr2k(select_backend(queue), queue, upper_lower, trans, n, k, alpha, a, lda,
-                              b, ldb, beta, c, ldc, dependencies);
+    auto done = detail::syr2k(queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                              dependencies);
     syr2k_postcondition(queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
                         dependencies);
     return done;
@@ -3173,8 +3932,8 @@ static inline cl::sycl::event syr2k(
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     syr2k_precondition(queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
                        dependencies);
-    auto done = detail::syr2k(select_backend(queue), queue, upper_lower, trans, n, k, alpha, a, lda,
-                              b, ldb, beta, c, ldc, dependencies);
+    auto done = detail::syr2k(queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                              dependencies);
     syr2k_postcondition(queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
                         dependencies);
     return done;
@@ -3188,8 +3947,8 @@ static inline cl::sycl::event syr2k(
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     syr2k_precondition(queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
                        dependencies);
-    auto done = detail::syr2k(select_backend(queue), queue, upper_lower, trans, n, k, alpha, a, lda,
-                              b, ldb, beta, c, ldc, dependencies);
+    auto done = detail::syr2k(queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                              dependencies);
     syr2k_postcondition(queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
                         dependencies);
     return done;
@@ -3200,8 +3959,8 @@ static inline cl::sycl::event syrk(
     float alpha, const float *a, std::int64_t lda, float beta, float *c, std::int64_t ldc,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     syrk_precondition(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
-    auto done = detail::syrk(select_backend(queue), queue, upper_lower, trans, n, k, alpha, a, lda,
-                             beta, c, ldc, dependencies);
+    auto done =
+        detail::syrk(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
     syrk_postcondition(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
     return done;
 }
@@ -3211,8 +3970,8 @@ static inline cl::sycl::event syrk(
     double alpha, const double *a, std::int64_t lda, double beta, double *c, std::int64_t ldc,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     syrk_precondition(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
-    auto done = detail::syrk(select_backend(queue), queue, upper_lower, trans, n, k, alpha, a, lda,
-                             beta, c, ldc, dependencies);
+    auto done =
+        detail::syrk(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
     syrk_postcondition(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
     return done;
 }
@@ -3223,8 +3982,8 @@ static inline cl::sycl::event syrk(
     std::complex<float> beta, std::complex<float> *c, std::int64_t ldc,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     syrk_precondition(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
-    auto done = detail::syrk(select_backend(queue), queue, upper_lower, trans, n, k, alpha, a, lda,
-                             beta, c, ldc, dependencies);
+    auto done =
+        detail::syrk(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
     syrk_postcondition(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
     return done;
 }
@@ -3235,8 +3994,8 @@ static inline cl::sycl::event syrk(
     std::complex<double> beta, std::complex<double> *c, std::int64_t ldc,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     syrk_precondition(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
-    auto done = detail::syrk(select_backend(queue), queue, upper_lower, trans, n, k, alpha, a, lda,
-                             beta, c, ldc, dependencies);
+    auto done =
+        detail::syrk(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
     syrk_postcondition(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
     return done;
 }
@@ -3246,8 +4005,8 @@ static inline cl::sycl::event tbmv(
     std::int64_t k, const float *a, std::int64_t lda, float *x, std::int64_t incx,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     tbmv_precondition(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
-    auto done = detail::tbmv(select_backend(queue), queue, upper_lower, trans, unit_diag, n, k, a,
-                             lda, x, incx, dependencies);
+    auto done =
+        detail::tbmv(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
     tbmv_postcondition(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
     return done;
 }
@@ -3257,8 +4016,8 @@ static inline cl::sycl::event tbmv(
     std::int64_t k, const double *a, std::int64_t lda, double *x, std::int64_t incx,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     tbmv_precondition(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
-    auto done = detail::tbmv(select_backend(queue), queue, upper_lower, trans, unit_diag, n, k, a,
-                             lda, x, incx, dependencies);
+    auto done =
+        detail::tbmv(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
     tbmv_postcondition(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
     return done;
 }
@@ -3268,8 +4027,8 @@ static inline cl::sycl::event tbmv(
     std::int64_t k, const std::complex<float> *a, std::int64_t lda, std::complex<float> *x,
     std::int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     tbmv_precondition(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
-    auto done = detail::tbmv(select_backend(queue), queue, upper_lower, trans, unit_diag, n, k, a,
-                             lda, x, incx, dependencies);
+    auto done =
+        detail::tbmv(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
     tbmv_postcondition(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
     return done;
 }
@@ -3279,8 +4038,8 @@ static inline cl::sycl::event tbmv(
     std::int64_t k, const std::complex<double> *a, std::int64_t lda, std::complex<double> *x,
     std::int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     tbmv_precondition(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
-    auto done = detail::tbmv(select_backend(queue), queue, upper_lower, trans, unit_diag, n, k, a,
-                             lda, x, incx, dependencies);
+    auto done =
+        detail::tbmv(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
     tbmv_postcondition(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
     return done;
 }
@@ -3290,8 +4049,8 @@ static inline cl::sycl::event tbsv(
     std::int64_t k, const float *a, std::int64_t lda, float *x, std::int64_t incx,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     tbsv_precondition(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
-    auto done = detail::tbsv(select_backend(queue), queue, upper_lower, trans, unit_diag, n, k, a,
-                             lda, x, incx, dependencies);
+    auto done =
+        detail::tbsv(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
     tbsv_postcondition(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
     return done;
 }
@@ -3301,8 +4060,8 @@ static inline cl::sycl::event tbsv(
     std::int64_t k, const double *a, std::int64_t lda, double *x, std::int64_t incx,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     tbsv_precondition(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
-    auto done = detail::tbsv(select_backend(queue), queue, upper_lower, trans, unit_diag, n, k, a,
-                             lda, x, incx, dependencies);
+    auto done =
+        detail::tbsv(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
     tbsv_postcondition(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
     return done;
 }
@@ -3312,8 +4071,8 @@ static inline cl::sycl::event tbsv(
     std::int64_t k, const std::complex<float> *a, std::int64_t lda, std::complex<float> *x,
     std::int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     tbsv_precondition(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
-    auto done = detail::tbsv(select_backend(queue), queue, upper_lower, trans, unit_diag, n, k, a,
-                             lda, x, incx, dependencies);
+    auto done =
+        detail::tbsv(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
     tbsv_postcondition(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
     return done;
 }
@@ -3323,8 +4082,8 @@ static inline cl::sycl::event tbsv(
     std::int64_t k, const std::complex<double> *a, std::int64_t lda, std::complex<double> *x,
     std::int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     tbsv_precondition(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
-    auto done = detail::tbsv(select_backend(queue), queue, upper_lower, trans, unit_diag, n, k, a,
-                             lda, x, incx, dependencies);
+    auto done =
+        detail::tbsv(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
     tbsv_postcondition(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
     return done;
 }
@@ -3334,8 +4093,7 @@ static inline cl::sycl::event tpmv(
     const float *a, float *x, std::int64_t incx,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     tpmv_precondition(queue, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
-    auto done = detail::tpmv(select_backend(queue), queue, upper_lower, trans, unit_diag, n, a, x,
-                             incx, dependencies);
+    auto done = detail::tpmv(queue, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
     tpmv_postcondition(queue, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
     return done;
 }
@@ -3345,8 +4103,7 @@ static inline cl::sycl::event tpmv(
     const double *a, double *x, std::int64_t incx,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     tpmv_precondition(queue, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
-    auto done = detail::tpmv(select_backend(queue), queue, upper_lower, trans, unit_diag, n, a, x,
-                             incx, dependencies);
+    auto done = detail::tpmv(queue, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
     tpmv_postcondition(queue, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
     return done;
 }
@@ -3356,8 +4113,7 @@ static inline cl::sycl::event tpmv(
     const std::complex<float> *a, std::complex<float> *x, std::int64_t incx,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     tpmv_precondition(queue, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
-    auto done = detail::tpmv(select_backend(queue), queue, upper_lower, trans, unit_diag, n, a, x,
-                             incx, dependencies);
+    auto done = detail::tpmv(queue, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
     tpmv_postcondition(queue, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
     return done;
 }
@@ -3367,8 +4123,7 @@ static inline cl::sycl::event tpmv(
     const std::complex<double> *a, std::complex<double> *x, std::int64_t incx,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     tpmv_precondition(queue, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
-    auto done = detail::tpmv(select_backend(queue), queue, upper_lower, trans, unit_diag, n, a, x,
-                             incx, dependencies);
+    auto done = detail::tpmv(queue, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
     tpmv_postcondition(queue, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
     return done;
 }
@@ -3378,8 +4133,7 @@ static inline cl::sycl::event tpsv(
     const float *a, float *x, std::int64_t incx,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     tpsv_precondition(queue, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
-    auto done = detail::tpsv(select_backend(queue), queue, upper_lower, trans, unit_diag, n, a, x,
-                             incx, dependencies);
+    auto done = detail::tpsv(queue, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
     tpsv_postcondition(queue, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
     return done;
 }
@@ -3389,8 +4143,7 @@ static inline cl::sycl::event tpsv(
     const double *a, double *x, std::int64_t incx,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     tpsv_precondition(queue, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
-    auto done = detail::tpsv(select_backend(queue), queue, upper_lower, trans, unit_diag, n, a, x,
-                             incx, dependencies);
+    auto done = detail::tpsv(queue, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
     tpsv_postcondition(queue, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
     return done;
 }
@@ -3400,8 +4153,7 @@ static inline cl::sycl::event tpsv(
     const std::complex<float> *a, std::complex<float> *x, std::int64_t incx,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     tpsv_precondition(queue, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
-    auto done = detail::tpsv(select_backend(queue), queue, upper_lower, trans, unit_diag, n, a, x,
-                             incx, dependencies);
+    auto done = detail::tpsv(queue, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
     tpsv_postcondition(queue, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
     return done;
 }
@@ -3411,8 +4163,7 @@ static inline cl::sycl::event tpsv(
     const std::complex<double> *a, std::complex<double> *x, std::int64_t incx,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     tpsv_precondition(queue, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
-    auto done = detail::tpsv(select_backend(queue), queue, upper_lower, trans, unit_diag, n, a, x,
-                             incx, dependencies);
+    auto done = detail::tpsv(queue, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
     tpsv_postcondition(queue, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
     return done;
 }
@@ -3423,8 +4174,8 @@ static inline cl::sycl::event trmm(
     std::int64_t ldb, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     trmm_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb,
                       dependencies);
-    auto done = detail::trmm(select_backend(queue), queue, left_right, upper_lower, trans,
-                             unit_diag, m, n, alpha, a, lda, b, ldb, dependencies);
+    auto done = detail::trmm(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                             b, ldb, dependencies);
     trmm_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
                        ldb, dependencies);
     return done;
@@ -3436,8 +4187,8 @@ static inline cl::sycl::event trmm(
     std::int64_t ldb, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     trmm_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb,
                       dependencies);
-    auto done = detail::trmm(select_backend(queue), queue, left_right, upper_lower, trans,
-                             unit_diag, m, n, alpha, a, lda, b, ldb, dependencies);
+    auto done = detail::trmm(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                             b, ldb, dependencies);
     trmm_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
                        ldb, dependencies);
     return done;
@@ -3450,8 +4201,8 @@ static inline cl::sycl::event trmm(
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     trmm_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb,
                       dependencies);
-    auto done = detail::trmm(select_backend(queue), queue, left_right, upper_lower, trans,
-                             unit_diag, m, n, alpha, a, lda, b, ldb, dependencies);
+    auto done = detail::trmm(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                             b, ldb, dependencies);
     trmm_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
                        ldb, dependencies);
     return done;
@@ -3464,8 +4215,8 @@ static inline cl::sycl::event trmm(
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     trmm_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb,
                       dependencies);
-    auto done = detail::trmm(select_backend(queue), queue, left_right, upper_lower, trans,
-                             unit_diag, m, n, alpha, a, lda, b, ldb, dependencies);
+    auto done = detail::trmm(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                             b, ldb, dependencies);
     trmm_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
                        ldb, dependencies);
     return done;
@@ -3476,8 +4227,8 @@ static inline cl::sycl::event trmv(
     const float *a, std::int64_t lda, float *x, std::int64_t incx,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     trmv_precondition(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
-    auto done = detail::trmv(select_backend(queue), queue, upper_lower, trans, unit_diag, n, a, lda,
-                             x, incx, dependencies);
+    auto done =
+        detail::trmv(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
     trmv_postcondition(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
     return done;
 }
@@ -3487,8 +4238,8 @@ static inline cl::sycl::event trmv(
     const double *a, std::int64_t lda, double *x, std::int64_t incx,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     trmv_precondition(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
-    auto done = detail::trmv(select_backend(queue), queue, upper_lower, trans, unit_diag, n, a, lda,
-                             x, incx, dependencies);
+    auto done =
+        detail::trmv(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
     trmv_postcondition(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
     return done;
 }
@@ -3498,8 +4249,8 @@ static inline cl::sycl::event trmv(
     const std::complex<float> *a, std::int64_t lda, std::complex<float> *x, std::int64_t incx,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     trmv_precondition(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
-    auto done = detail::trmv(select_backend(queue), queue, upper_lower, trans, unit_diag, n, a, lda,
-                             x, incx, dependencies);
+    auto done =
+        detail::trmv(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
     trmv_postcondition(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
     return done;
 }
@@ -3509,8 +4260,8 @@ static inline cl::sycl::event trmv(
     const std::complex<double> *a, std::int64_t lda, std::complex<double> *x, std::int64_t incx,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     trmv_precondition(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
-    auto done = detail::trmv(select_backend(queue), queue, upper_lower, trans, unit_diag, n, a, lda,
-                             x, incx, dependencies);
+    auto done =
+        detail::trmv(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
     trmv_postcondition(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
     return done;
 }
@@ -3521,8 +4272,8 @@ static inline cl::sycl::event trsm(
     std::int64_t ldb, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     trsm_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb,
                       dependencies);
-    auto done = detail::trsm(select_backend(queue), queue, left_right, upper_lower, trans,
-                             unit_diag, m, n, alpha, a, lda, b, ldb, dependencies);
+    auto done = detail::trsm(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                             b, ldb, dependencies);
     trsm_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
                        ldb, dependencies);
     return done;
@@ -3534,8 +4285,8 @@ static inline cl::sycl::event trsm(
     std::int64_t ldb, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     trsm_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb,
                       dependencies);
-    auto done = detail::trsm(select_backend(queue), queue, left_right, upper_lower, trans,
-                             unit_diag, m, n, alpha, a, lda, b, ldb, dependencies);
+    auto done = detail::trsm(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                             b, ldb, dependencies);
     trsm_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
                        ldb, dependencies);
     return done;
@@ -3548,8 +4299,8 @@ static inline cl::sycl::event trsm(
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     trsm_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb,
                       dependencies);
-    auto done = detail::trsm(select_backend(queue), queue, left_right, upper_lower, trans,
-                             unit_diag, m, n, alpha, a, lda, b, ldb, dependencies);
+    auto done = detail::trsm(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                             b, ldb, dependencies);
     trsm_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
                        ldb, dependencies);
     return done;
@@ -3562,8 +4313,8 @@ static inline cl::sycl::event trsm(
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     trsm_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb,
                       dependencies);
-    auto done = detail::trsm(select_backend(queue), queue, left_right, upper_lower, trans,
-                             unit_diag, m, n, alpha, a, lda, b, ldb, dependencies);
+    auto done = detail::trsm(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                             b, ldb, dependencies);
     trsm_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
                        ldb, dependencies);
     return done;
@@ -3574,8 +4325,8 @@ static inline cl::sycl::event trsv(
     const float *a, std::int64_t lda, float *x, std::int64_t incx,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     trsv_precondition(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
-    auto done = detail::trsv(select_backend(queue), queue, upper_lower, trans, unit_diag, n, a, lda,
-                             x, incx, dependencies);
+    auto done =
+        detail::trsv(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
     trsv_postcondition(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
     return done;
 }
@@ -3585,8 +4336,8 @@ static inline cl::sycl::event trsv(
     const double *a, std::int64_t lda, double *x, std::int64_t incx,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     trsv_precondition(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
-    auto done = detail::trsv(select_backend(queue), queue, upper_lower, trans, unit_diag, n, a, lda,
-                             x, incx, dependencies);
+    auto done =
+        detail::trsv(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
     trsv_postcondition(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
     return done;
 }
@@ -3596,8 +4347,8 @@ static inline cl::sycl::event trsv(
     const std::complex<float> *a, std::int64_t lda, std::complex<float> *x, std::int64_t incx,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     trsv_precondition(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
-    auto done = detail::trsv(select_backend(queue), queue, upper_lower, trans, unit_diag, n, a, lda,
-                             x, incx, dependencies);
+    auto done =
+        detail::trsv(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
     trsv_postcondition(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
     return done;
 }
@@ -3607,8 +4358,8 @@ static inline cl::sycl::event trsv(
     const std::complex<double> *a, std::int64_t lda, std::complex<double> *x, std::int64_t incx,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
     trsv_precondition(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
-    auto done = detail::trsv(select_backend(queue), queue, upper_lower, trans, unit_diag, n, a, lda,
-                             x, incx, dependencies);
+    auto done =
+        detail::trsv(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
     trsv_postcondition(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
     return done;
 }
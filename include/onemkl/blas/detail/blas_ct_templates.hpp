@@ -234,6 +234,30 @@ static inline void axpy(cl::sycl::queue &queue, std::int64_t n, std::complex<dou
                         cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy);
 
+template <onemkl::library lib, onemkl::backend backend>
+static inline void axpy_batch(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                              cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                              std::int64_t stridex, cl::sycl::buffer<float, 1> &y,
+                              std::int64_t incy, std::int64_t stridey, std::int64_t batch_size);
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void axpy_batch(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                              cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                              std::int64_t stridex, cl::sycl::buffer<double, 1> &y,
+                              std::int64_t incy, std::int64_t stridey, std::int64_t batch_size);
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void axpy_batch(cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
+                              cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                              std::int64_t stridex, cl::sycl::buffer<std::complex<float>, 1> &y,
+                              std::int64_t incy, std::int64_t stridey, std::int64_t batch_size);
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void axpy_batch(cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+                              cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                              std::int64_t stridex, cl::sycl::buffer<std::complex<double>, 1> &y,
+                              std::int64_t incy, std::int64_t stridey, std::int64_t batch_size);
+
 template <onemkl::library lib, onemkl::backend backend>
 static inline void gerc(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
                         std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &x,
@@ -397,6 +421,13 @@ static inline void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose
                             cl::sycl::buffer<half, 1> &b, std::int64_t ldb, float beta,
                             cl::sycl::buffer<float, 1> &c, std::int64_t ldc);
 
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb,
+                            std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                            cl::sycl::buffer<bfloat16, 1> &a, std::int64_t lda,
+                            cl::sycl::buffer<bfloat16, 1> &b, std::int64_t ldb, float beta,
+                            cl::sycl::buffer<float, 1> &c, std::int64_t ldc);
+
 template <onemkl::library lib, onemkl::backend backend>
 static inline void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb,
                             offset offsetc, std::int64_t m, std::int64_t n, std::int64_t k,
@@ -528,6 +559,13 @@ static inline void gemm(cl::sycl::queue &queue, transpose transa, transpose tran
                         std::int64_t lda, cl::sycl::buffer<half, 1> &b, std::int64_t ldb, half beta,
                         cl::sycl::buffer<half, 1> &c, std::int64_t ldc);
 
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                        std::int64_t n, std::int64_t k, bfloat16 alpha,
+                        cl::sycl::buffer<bfloat16, 1> &a, std::int64_t lda,
+                        cl::sycl::buffer<bfloat16, 1> &b, std::int64_t ldb, bfloat16 beta,
+                        cl::sycl::buffer<bfloat16, 1> &c, std::int64_t ldc);
+
 template <onemkl::library lib, onemkl::backend backend>
 static inline void herk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, std::int64_t n,
                         std::int64_t k, float alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
@@ -1290,6 +1328,138 @@ static inline cl::sycl::event axpy_batch(
     std::int64_t *incy, std::int64_t group_count, std::int64_t *group_size,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
+template <onemkl::library lib, onemkl::backend backend>
+static inline cl::sycl::event axpy_batch(
+    cl::sycl::queue &queue, std::int64_t n, float alpha, const float *x, std::int64_t incx,
+    std::int64_t stridex, float *y, std::int64_t incy, std::int64_t stridey,
+    std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline cl::sycl::event axpy_batch(
+    cl::sycl::queue &queue, std::int64_t n, double alpha, const double *x, std::int64_t incx,
+    std::int64_t stridex, double *y, std::int64_t incy, std::int64_t stridey,
+    std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline cl::sycl::event axpy_batch(
+    cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha, const std::complex<float> *x,
+    std::int64_t incx, std::int64_t stridex, std::complex<float> *y, std::int64_t incy,
+    std::int64_t stridey, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline cl::sycl::event axpy_batch(
+    cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+    const std::complex<double> *x, std::int64_t incx, std::int64_t stridex, std::complex<double> *y,
+    std::int64_t incy, std::int64_t stridey, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline cl::sycl::event compact_pack(
+    cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols, const float **a, std::int64_t lda,
+    float *ap, std::int64_t ldap, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline cl::sycl::event compact_pack(
+    cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols, const double **a,
+    std::int64_t lda, double *ap, std::int64_t ldap, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline cl::sycl::event compact_pack(
+    cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols, const std::complex<float> **a,
+    std::int64_t lda, std::complex<float> *ap, std::int64_t ldap, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline cl::sycl::event compact_pack(
+    cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols, const std::complex<double> **a,
+    std::int64_t lda, std::complex<double> *ap, std::int64_t ldap, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline cl::sycl::event compact_unpack(
+    cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols, const float *ap,
+    std::int64_t ldap, float **a, std::int64_t lda, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline cl::sycl::event compact_unpack(
+    cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols, const double *ap,
+    std::int64_t ldap, double **a, std::int64_t lda, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline cl::sycl::event compact_unpack(
+    cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols, const std::complex<float> *ap,
+    std::int64_t ldap, std::complex<float> **a, std::int64_t lda, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline cl::sycl::event compact_unpack(
+    cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols, const std::complex<double> *ap,
+    std::int64_t ldap, std::complex<double> **a, std::int64_t lda, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline cl::sycl::event gemm_compact(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, float alpha, const float *ap, std::int64_t ldap, const float *bp,
+    std::int64_t ldbp, float beta, float *cp, std::int64_t ldcp, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline cl::sycl::event gemm_compact(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, double alpha, const double *ap, std::int64_t ldap, const double *bp,
+    std::int64_t ldbp, double beta, double *cp, std::int64_t ldcp, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline cl::sycl::event gemm_compact(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<float> alpha, const std::complex<float> *ap, std::int64_t ldap,
+    const std::complex<float> *bp, std::int64_t ldbp, std::complex<float> beta,
+    std::complex<float> *cp, std::int64_t ldcp, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline cl::sycl::event gemm_compact(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<double> alpha, const std::complex<double> *ap, std::int64_t ldap,
+    const std::complex<double> *bp, std::int64_t ldbp, std::complex<double> beta,
+    std::complex<double> *cp, std::int64_t ldcp, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline cl::sycl::event trsm_compact(
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+    std::int64_t m, std::int64_t n, float alpha, const float *ap, std::int64_t ldap, float *bp,
+    std::int64_t ldbp, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline cl::sycl::event trsm_compact(
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+    std::int64_t m, std::int64_t n, double alpha, const double *ap, std::int64_t ldap, double *bp,
+    std::int64_t ldbp, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline cl::sycl::event trsm_compact(
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+    std::int64_t m, std::int64_t n, std::complex<float> alpha, const std::complex<float> *ap,
+    std::int64_t ldap, std::complex<float> *bp, std::int64_t ldbp, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline cl::sycl::event trsm_compact(
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+    std::int64_t m, std::int64_t n, std::complex<double> alpha, const std::complex<double> *ap,
+    std::int64_t ldap, std::complex<double> *bp, std::int64_t ldbp, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
 template <onemkl::library lib, onemkl::backend backend>
 static inline cl::sycl::event gerc(
     cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::complex<float> alpha,
@@ -1466,6 +1636,64 @@ static inline cl::sycl::event gemm_batch(
     std::complex<double> beta, std::complex<double> *c, std::int64_t ldc, std::int64_t stride_c,
     std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
+template <onemkl::library lib, onemkl::backend backend>
+static inline cl::sycl::event trsm_batch(
+    cl::sycl::queue &queue, side *left_right, uplo *upper_lower, transpose *trans, diag *unit_diag,
+    std::int64_t *m, std::int64_t *n, float *alpha, const float **a, std::int64_t *lda, float **b,
+    std::int64_t *ldb, std::int64_t group_count, std::int64_t *group_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline cl::sycl::event trsm_batch(
+    cl::sycl::queue &queue, side *left_right, uplo *upper_lower, transpose *trans, diag *unit_diag,
+    std::int64_t *m, std::int64_t *n, double *alpha, const double **a, std::int64_t *lda,
+    double **b, std::int64_t *ldb, std::int64_t group_count, std::int64_t *group_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline cl::sycl::event trsm_batch(
+    cl::sycl::queue &queue, side *left_right, uplo *upper_lower, transpose *trans, diag *unit_diag,
+    std::int64_t *m, std::int64_t *n, std::complex<float> *alpha, const std::complex<float> **a,
+    std::int64_t *lda, std::complex<float> **b, std::int64_t *ldb, std::int64_t group_count,
+    std::int64_t *group_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline cl::sycl::event trsm_batch(
+    cl::sycl::queue &queue, side *left_right, uplo *upper_lower, transpose *trans, diag *unit_diag,
+    std::int64_t *m, std::int64_t *n, std::complex<double> *alpha, const std::complex<double> **a,
+    std::int64_t *lda, std::complex<double> **b, std::int64_t *ldb, std::int64_t group_count,
+    std::int64_t *group_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline cl::sycl::event trsm_batch(
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+    std::int64_t m, std::int64_t n, float alpha, const float *a, std::int64_t lda,
+    std::int64_t stride_a, float *b, std::int64_t ldb, std::int64_t stride_b,
+    std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline cl::sycl::event trsm_batch(
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+    std::int64_t m, std::int64_t n, double alpha, const double *a, std::int64_t lda,
+    std::int64_t stride_a, double *b, std::int64_t ldb, std::int64_t stride_b,
+    std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline cl::sycl::event trsm_batch(
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+    std::int64_t m, std::int64_t n, std::complex<float> alpha, const std::complex<float> *a,
+    std::int64_t lda, std::int64_t stride_a, std::complex<float> *b, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline cl::sycl::event trsm_batch(
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+    std::int64_t m, std::int64_t n, std::complex<double> alpha, const std::complex<double> *a,
+    std::int64_t lda, std::int64_t stride_a, std::complex<double> *b, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
 template <onemkl::library lib, onemkl::backend backend>
 static inline cl::sycl::event spmv(
     cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, float alpha, const float *a,
@@ -1564,6 +1792,13 @@ static inline cl::sycl::event gemm(
     std::complex<double> *c, std::int64_t ldc,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
+template <onemkl::library lib, onemkl::backend backend>
+static inline cl::sycl::event gemm(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, bfloat16 alpha, const bfloat16 *a, std::int64_t lda, const bfloat16 *b,
+    std::int64_t ldb, bfloat16 beta, bfloat16 *c, std::int64_t ldc,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
 template <onemkl::library lib, onemkl::backend backend>
 static inline cl::sycl::event herk(
     cl::sycl::queue &queue, uplo upper_lower, transpose trans, std::int64_t n, std::int64_t k,
@@ -1883,6 +2118,27 @@ static inline cl::sycl::event hemv(
     std::int64_t incx, std::complex<double> beta, std::complex<double> *y, std::int64_t incy,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
+template <onemkl::library lib, onemkl::backend backend>
+static inline cl::sycl::event gemm_ext(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, float alpha, const half *a, std::int64_t lda, const half *b, std::int64_t ldb,
+    float beta, float *c, std::int64_t ldc,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline cl::sycl::event gemm_ext(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, float alpha, const bfloat16 *a, std::int64_t lda, const bfloat16 *b,
+    std::int64_t ldb, float beta, float *c, std::int64_t ldc,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline cl::sycl::event gemm_ext(
+    cl::sycl::queue &queue, transpose transa, transpose transb, offset offsetc, std::int64_t m,
+    std::int64_t n, std::int64_t k, float alpha, const int8_t *a, std::int64_t lda, int8_t ao,
+    const uint8_t *b, std::int64_t ldb, uint8_t bo, float beta, int32_t *c, std::int64_t ldc,
+    const int32_t *co, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
 template <onemkl::library lib, onemkl::backend backend>
 static inline cl::sycl::event gemmt(
     cl::sycl::queue &queue, uplo upper_lower, transpose transa, transpose transb, std::int64_t n,
@@ -23,100 +23,178 @@
 #include <CL/sycl.hpp>
 #include <complex>
 #include <cstdint>
+#include <vector>
 
 #include <onemkl/types.hpp>
+#include "onemkl/blas/record.hpp"
+#include "onemkl/blas/stats.hpp"
+#include "onemkl/detail/backends.hpp"
 #include "onemkl/detail/export.hpp"
 
 namespace onemkl {
 namespace blas {
 namespace detail {
 
+// Backend management
+
+ONEMKL_EXPORT void preload();
+ONEMKL_EXPORT void preload(backend b);
+ONEMKL_EXPORT void preload(cl::sycl::queue &queue);
+ONEMKL_EXPORT void warmup(cl::sycl::queue &queue);
+
+// Tracing
+
+ONEMKL_EXPORT void trace_start(const char *path);
+ONEMKL_EXPORT void trace_stop();
+
+// Statistics
+
+ONEMKL_EXPORT void stats_enable(bool enable);
+ONEMKL_EXPORT stats_report stats();
+ONEMKL_EXPORT void stats_reset();
+ONEMKL_EXPORT void stats_dump(const char *path);
+
+// Recording
+
+ONEMKL_EXPORT void record_start(const char *path);
+ONEMKL_EXPORT void record_stop();
+ONEMKL_EXPORT std::vector<recorded_call> record_load(const char *path);
+ONEMKL_EXPORT void replay_prepare(cl::sycl::queue &queue, recorded_call &call);
+ONEMKL_EXPORT void replay_run(cl::sycl::queue &queue, recorded_call &call);
+ONEMKL_EXPORT void replay_release(recorded_call &call);
+
+// Execution control
+
+ONEMKL_EXPORT void fused_begin(cl::sycl::queue &queue);
+ONEMKL_EXPORT void fused_end(cl::sycl::queue &queue);
+ONEMKL_EXPORT void set_num_threads(cl::sycl::queue &queue, int num_threads);
+ONEMKL_EXPORT void set_task_arena(cl::sycl::queue &queue, int max_concurrency, int numa_node,
+                                  void *arena);
+
+// Packed GEMM
+
+ONEMKL_EXPORT std::int64_t sgemm_pack_get_size(cl::sycl::queue &queue, pack_matrix which,
+                                               std::int64_t m, std::int64_t n, std::int64_t k);
+ONEMKL_EXPORT cl::sycl::event gemm_pack(cl::sycl::queue &queue, pack_matrix which, transpose trans,
+                                        std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                                        cl::sycl::buffer<float, 1> &src, std::int64_t ld,
+                                        float *dst);
+ONEMKL_EXPORT cl::sycl::event gemm_pack(
+    cl::sycl::queue &queue, pack_matrix which, transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t k, float alpha, const float *src, std::int64_t ld, float *dst,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event gemm_compute(
+    cl::sycl::queue &queue, pack_matrix which, transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t k, const float *packed, cl::sycl::buffer<float, 1> &x, std::int64_t ldx,
+    float beta, cl::sycl::buffer<float, 1> &c, std::int64_t ldc,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event gemm_compute(
+    cl::sycl::queue &queue, pack_matrix which, transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t k, const float *packed, const float *x, std::int64_t ldx, float beta, float *c,
+    std::int64_t ldc, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT std::int64_t dgemm_pack_get_size(cl::sycl::queue &queue, pack_matrix which,
+                                               std::int64_t m, std::int64_t n, std::int64_t k);
+ONEMKL_EXPORT cl::sycl::event gemm_pack(cl::sycl::queue &queue, pack_matrix which, transpose trans,
+                                        std::int64_t m, std::int64_t n, std::int64_t k,
+                                        double alpha, cl::sycl::buffer<double, 1> &src,
+                                        std::int64_t ld, double *dst);
+ONEMKL_EXPORT cl::sycl::event gemm_pack(
+    cl::sycl::queue &queue, pack_matrix which, transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t k, double alpha, const double *src, std::int64_t ld, double *dst,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event gemm_compute(
+    cl::sycl::queue &queue, pack_matrix which, transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t k, const double *packed, cl::sycl::buffer<double, 1> &x, std::int64_t ldx,
+    double beta, cl::sycl::buffer<double, 1> &c, std::int64_t ldc,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event gemm_compute(
+    cl::sycl::queue &queue, pack_matrix which, transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t k, const double *packed, const double *x, std::int64_t ldx, double beta, double *c,
+    std::int64_t ldc, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
 // Buffer APIs
 
-ONEMKL_EXPORT void herk(char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
-                        std::int64_t n, std::int64_t k, float alpha,
-                        cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda, float beta,
-                        cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc);
-ONEMKL_EXPORT void herk(char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
-                        std::int64_t n, std::int64_t k, double alpha,
-                        cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda, double beta,
-                        cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc);
+ONEMKL_EXPORT void herk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, std::int64_t n,
+                        std::int64_t k, float alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+                        std::int64_t lda, float beta, cl::sycl::buffer<std::complex<float>, 1> &c,
+                        std::int64_t ldc);
+ONEMKL_EXPORT void herk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, std::int64_t n,
+                        std::int64_t k, double alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+                        std::int64_t lda, double beta, cl::sycl::buffer<std::complex<double>, 1> &c,
+                        std::int64_t ldc);
 
-ONEMKL_EXPORT void scal(char *libname, cl::sycl::queue &queue, std::int64_t n, float alpha,
+ONEMKL_EXPORT void scal(cl::sycl::queue &queue, std::int64_t n, float alpha,
                         cl::sycl::buffer<float, 1> &x, std::int64_t incx);
-ONEMKL_EXPORT void scal(char *libname, cl::sycl::queue &queue, std::int64_t n, double alpha,
+ONEMKL_EXPORT void scal(cl::sycl::queue &queue, std::int64_t n, double alpha,
                         cl::sycl::buffer<double, 1> &x, std::int64_t incx);
-ONEMKL_EXPORT void scal(char *libname, cl::sycl::queue &queue, std::int64_t n,
-                        std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &x,
-                        std::int64_t incx);
-ONEMKL_EXPORT void scal(char *libname, cl::sycl::queue &queue, std::int64_t n,
-                        std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &x,
-                        std::int64_t incx);
-ONEMKL_EXPORT void scal(char *libname, cl::sycl::queue &queue, std::int64_t n, float alpha,
+ONEMKL_EXPORT void scal(cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
+                        cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx);
+ONEMKL_EXPORT void scal(cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+                        cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx);
+ONEMKL_EXPORT void scal(cl::sycl::queue &queue, std::int64_t n, float alpha,
                         cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx);
-ONEMKL_EXPORT void scal(char *libname, cl::sycl::queue &queue, std::int64_t n, double alpha,
+ONEMKL_EXPORT void scal(cl::sycl::queue &queue, std::int64_t n, double alpha,
                         cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx);
 
-ONEMKL_EXPORT void trmv(char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
-                        diag unit_diag, std::int64_t n, cl::sycl::buffer<float, 1> &a,
-                        std::int64_t lda, cl::sycl::buffer<float, 1> &x, std::int64_t incx);
-ONEMKL_EXPORT void trmv(char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
-                        diag unit_diag, std::int64_t n, cl::sycl::buffer<double, 1> &a,
-                        std::int64_t lda, cl::sycl::buffer<double, 1> &x, std::int64_t incx);
-ONEMKL_EXPORT void trmv(char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
-                        diag unit_diag, std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &a,
+ONEMKL_EXPORT void trmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
+                        std::int64_t n, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                        cl::sycl::buffer<float, 1> &x, std::int64_t incx);
+ONEMKL_EXPORT void trmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
+                        std::int64_t n, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                        cl::sycl::buffer<double, 1> &x, std::int64_t incx);
+ONEMKL_EXPORT void trmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
+                        std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &a,
                         std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &x,
                         std::int64_t incx);
-ONEMKL_EXPORT void trmv(char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
-                        diag unit_diag, std::int64_t n,
-                        cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
-                        cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx);
+ONEMKL_EXPORT void trmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
+                        std::int64_t n, cl::sycl::buffer<std::complex<double>, 1> &a,
+                        std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &x,
+                        std::int64_t incx);
 
-ONEMKL_EXPORT void tpmv(char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
-                        diag unit_diag, std::int64_t n, cl::sycl::buffer<float, 1> &a,
+ONEMKL_EXPORT void tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
+                        std::int64_t n, cl::sycl::buffer<float, 1> &a,
                         cl::sycl::buffer<float, 1> &x, std::int64_t incx);
-ONEMKL_EXPORT void tpmv(char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
-                        diag unit_diag, std::int64_t n, cl::sycl::buffer<double, 1> &a,
+ONEMKL_EXPORT void tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
+                        std::int64_t n, cl::sycl::buffer<double, 1> &a,
                         cl::sycl::buffer<double, 1> &x, std::int64_t incx);
-ONEMKL_EXPORT void tpmv(char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
-                        diag unit_diag, std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &a,
+ONEMKL_EXPORT void tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
+                        std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &a,
                         cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx);
-ONEMKL_EXPORT void tpmv(char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
-                        diag unit_diag, std::int64_t n,
-                        cl::sycl::buffer<std::complex<double>, 1> &a,
+ONEMKL_EXPORT void tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
+                        std::int64_t n, cl::sycl::buffer<std::complex<double>, 1> &a,
                         cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx);
 
-ONEMKL_EXPORT void spr(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
-                       float alpha, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+ONEMKL_EXPORT void spr(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, float alpha,
+                       cl::sycl::buffer<float, 1> &x, std::int64_t incx,
                        cl::sycl::buffer<float, 1> &a);
-ONEMKL_EXPORT void spr(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
-                       double alpha, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+ONEMKL_EXPORT void spr(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, double alpha,
+                       cl::sycl::buffer<double, 1> &x, std::int64_t incx,
                        cl::sycl::buffer<double, 1> &a);
 
-ONEMKL_EXPORT void gemm_batch(char *libname, cl::sycl::queue &queue, transpose transa,
-                              transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
-                              float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+ONEMKL_EXPORT void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb,
+                              std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                              cl::sycl::buffer<float, 1> &a, std::int64_t lda,
                               std::int64_t stride_a, cl::sycl::buffer<float, 1> &b,
                               std::int64_t ldb, std::int64_t stride_b, float beta,
                               cl::sycl::buffer<float, 1> &c, std::int64_t ldc,
                               std::int64_t stride_c, std::int64_t batch_size);
-ONEMKL_EXPORT void gemm_batch(char *libname, cl::sycl::queue &queue, transpose transa,
-                              transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
-                              double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+ONEMKL_EXPORT void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb,
+                              std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
+                              cl::sycl::buffer<double, 1> &a, std::int64_t lda,
                               std::int64_t stride_a, cl::sycl::buffer<double, 1> &b,
                               std::int64_t ldb, std::int64_t stride_b, double beta,
                               cl::sycl::buffer<double, 1> &c, std::int64_t ldc,
                               std::int64_t stride_c, std::int64_t batch_size);
-ONEMKL_EXPORT void gemm_batch(char *libname, cl::sycl::queue &queue, transpose transa,
-                              transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+ONEMKL_EXPORT void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb,
+                              std::int64_t m, std::int64_t n, std::int64_t k,
                               std::complex<float> alpha,
                               cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
                               std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &b,
                               std::int64_t ldb, std::int64_t stride_b, std::complex<float> beta,
                               cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
                               std::int64_t stride_c, std::int64_t batch_size);
-ONEMKL_EXPORT void gemm_batch(char *libname, cl::sycl::queue &queue, transpose transa,
-                              transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+ONEMKL_EXPORT void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb,
+                              std::int64_t m, std::int64_t n, std::int64_t k,
                               std::complex<double> alpha,
                               cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
                               std::int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &b,
@@ -124,681 +202,668 @@ ONEMKL_EXPORT void gemm_batch(char *libname, cl::sycl::queue &queue, transpose t
                               cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
                               std::int64_t stride_c, std::int64_t batch_size);
 
-ONEMKL_EXPORT void syrk(char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
-                        std::int64_t n, std::int64_t k, float alpha, cl::sycl::buffer<float, 1> &a,
+ONEMKL_EXPORT void syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, std::int64_t n,
+                        std::int64_t k, float alpha, cl::sycl::buffer<float, 1> &a,
                         std::int64_t lda, float beta, cl::sycl::buffer<float, 1> &c,
                         std::int64_t ldc);
-ONEMKL_EXPORT void syrk(char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
-                        std::int64_t n, std::int64_t k, double alpha,
-                        cl::sycl::buffer<double, 1> &a, std::int64_t lda, double beta,
-                        cl::sycl::buffer<double, 1> &c, std::int64_t ldc);
-ONEMKL_EXPORT void syrk(char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
-                        std::int64_t n, std::int64_t k, std::complex<float> alpha,
+ONEMKL_EXPORT void syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, std::int64_t n,
+                        std::int64_t k, double alpha, cl::sycl::buffer<double, 1> &a,
+                        std::int64_t lda, double beta, cl::sycl::buffer<double, 1> &c,
+                        std::int64_t ldc);
+ONEMKL_EXPORT void syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, std::int64_t n,
+                        std::int64_t k, std::complex<float> alpha,
                         cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
                         std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c,
                         std::int64_t ldc);
-ONEMKL_EXPORT void syrk(char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
-                        std::int64_t n, std::int64_t k, std::complex<double> alpha,
+ONEMKL_EXPORT void syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, std::int64_t n,
+                        std::int64_t k, std::complex<double> alpha,
                         cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
                         std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c,
                         std::int64_t ldc);
 
-ONEMKL_EXPORT void her2(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+ONEMKL_EXPORT void her2(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
                         std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &x,
                         std::int64_t incx, cl::sycl::buffer<std::complex<float>, 1> &y,
                         std::int64_t incy, cl::sycl::buffer<std::complex<float>, 1> &a,
                         std::int64_t lda);
-ONEMKL_EXPORT void her2(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+ONEMKL_EXPORT void her2(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
                         std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &x,
                         std::int64_t incx, cl::sycl::buffer<std::complex<double>, 1> &y,
                         std::int64_t incy, cl::sycl::buffer<std::complex<double>, 1> &a,
                         std::int64_t lda);
 
-ONEMKL_EXPORT void hbmv(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
-                        std::int64_t k, std::complex<float> alpha,
-                        cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
-                        cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
-                        std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &y,
-                        std::int64_t incy);
-ONEMKL_EXPORT void hbmv(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
-                        std::int64_t k, std::complex<double> alpha,
-                        cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
-                        cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
-                        std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &y,
-                        std::int64_t incy);
+ONEMKL_EXPORT void hbmv(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, std::int64_t k,
+                        std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+                        std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &x,
+                        std::int64_t incx, std::complex<float> beta,
+                        cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy);
+ONEMKL_EXPORT void hbmv(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, std::int64_t k,
+                        std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+                        std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &x,
+                        std::int64_t incx, std::complex<double> beta,
+                        cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy);
 
-ONEMKL_EXPORT void rot(char *libname, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void rot(cl::sycl::queue &queue, std::int64_t n,
                        cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
                        cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy, float c,
                        float s);
-ONEMKL_EXPORT void rot(char *libname, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void rot(cl::sycl::queue &queue, std::int64_t n,
                        cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
                        cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy, double c,
                        double s);
-ONEMKL_EXPORT void rot(char *libname, cl::sycl::queue &queue, std::int64_t n,
-                       cl::sycl::buffer<float, 1> &x, std::int64_t incx,
-                       cl::sycl::buffer<float, 1> &y, std::int64_t incy, float c, float s);
-ONEMKL_EXPORT void rot(char *libname, cl::sycl::queue &queue, std::int64_t n,
-                       cl::sycl::buffer<double, 1> &x, std::int64_t incx,
-                       cl::sycl::buffer<double, 1> &y, std::int64_t incy, double c, double s);
+ONEMKL_EXPORT void rot(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                       std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy, float c,
+                       float s);
+ONEMKL_EXPORT void rot(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &x,
+                       std::int64_t incx, cl::sycl::buffer<double, 1> &y, std::int64_t incy,
+                       double c, double s);
 
-ONEMKL_EXPORT void axpy(char *libname, cl::sycl::queue &queue, std::int64_t n, float alpha,
+ONEMKL_EXPORT void axpy(cl::sycl::queue &queue, std::int64_t n, float alpha,
                         cl::sycl::buffer<float, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<float, 1> &y, std::int64_t incy);
-ONEMKL_EXPORT void axpy(char *libname, cl::sycl::queue &queue, std::int64_t n, double alpha,
+ONEMKL_EXPORT void axpy(cl::sycl::queue &queue, std::int64_t n, double alpha,
                         cl::sycl::buffer<double, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<double, 1> &y, std::int64_t incy);
-ONEMKL_EXPORT void axpy(char *libname, cl::sycl::queue &queue, std::int64_t n,
-                        std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &x,
-                        std::int64_t incx, cl::sycl::buffer<std::complex<float>, 1> &y,
-                        std::int64_t incy);
-ONEMKL_EXPORT void axpy(char *libname, cl::sycl::queue &queue, std::int64_t n,
-                        std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &x,
-                        std::int64_t incx, cl::sycl::buffer<std::complex<double>, 1> &y,
-                        std::int64_t incy);
+ONEMKL_EXPORT void axpy(cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
+                        cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                        cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy);
+ONEMKL_EXPORT void axpy(cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+                        cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                        cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy);
 
-ONEMKL_EXPORT void gerc(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+ONEMKL_EXPORT void axpy_batch(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                              cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                              std::int64_t stridex, cl::sycl::buffer<float, 1> &y,
+                              std::int64_t incy, std::int64_t stridey, std::int64_t batch_size);
+ONEMKL_EXPORT void axpy_batch(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                              cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                              std::int64_t stridex, cl::sycl::buffer<double, 1> &y,
+                              std::int64_t incy, std::int64_t stridey, std::int64_t batch_size);
+ONEMKL_EXPORT void axpy_batch(cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
+                              cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                              std::int64_t stridex, cl::sycl::buffer<std::complex<float>, 1> &y,
+                              std::int64_t incy, std::int64_t stridey, std::int64_t batch_size);
+ONEMKL_EXPORT void axpy_batch(cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+                              cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                              std::int64_t stridex, cl::sycl::buffer<std::complex<double>, 1> &y,
+                              std::int64_t incy, std::int64_t stridey, std::int64_t batch_size);
+
+ONEMKL_EXPORT void gerc(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
                         std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &x,
                         std::int64_t incx, cl::sycl::buffer<std::complex<float>, 1> &y,
                         std::int64_t incy, cl::sycl::buffer<std::complex<float>, 1> &a,
                         std::int64_t lda);
-ONEMKL_EXPORT void gerc(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+ONEMKL_EXPORT void gerc(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
                         std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &x,
                         std::int64_t incx, cl::sycl::buffer<std::complex<double>, 1> &y,
                         std::int64_t incy, cl::sycl::buffer<std::complex<double>, 1> &a,
                         std::int64_t lda);
 
-ONEMKL_EXPORT void syr2k(char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
-                         std::int64_t n, std::int64_t k, float alpha, cl::sycl::buffer<float, 1> &a,
+ONEMKL_EXPORT void syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans, std::int64_t n,
+                         std::int64_t k, float alpha, cl::sycl::buffer<float, 1> &a,
                          std::int64_t lda, cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
                          float beta, cl::sycl::buffer<float, 1> &c, std::int64_t ldc);
-ONEMKL_EXPORT void syr2k(char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
-                         std::int64_t n, std::int64_t k, double alpha,
-                         cl::sycl::buffer<double, 1> &a, std::int64_t lda,
-                         cl::sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
-                         cl::sycl::buffer<double, 1> &c, std::int64_t ldc);
-ONEMKL_EXPORT void syr2k(char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
-                         std::int64_t n, std::int64_t k, std::complex<float> alpha,
+ONEMKL_EXPORT void syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans, std::int64_t n,
+                         std::int64_t k, double alpha, cl::sycl::buffer<double, 1> &a,
+                         std::int64_t lda, cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                         double beta, cl::sycl::buffer<double, 1> &c, std::int64_t ldc);
+ONEMKL_EXPORT void syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans, std::int64_t n,
+                         std::int64_t k, std::complex<float> alpha,
                          cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
                          cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
                          std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c,
                          std::int64_t ldc);
-ONEMKL_EXPORT void syr2k(char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
-                         std::int64_t n, std::int64_t k, std::complex<double> alpha,
+ONEMKL_EXPORT void syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans, std::int64_t n,
+                         std::int64_t k, std::complex<double> alpha,
                          cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
                          cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
                          std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c,
                          std::int64_t ldc);
 
-ONEMKL_EXPORT void gemv(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m,
-                        std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
-                        std::int64_t lda, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
-                        float beta, cl::sycl::buffer<float, 1> &y, std::int64_t incy);
-ONEMKL_EXPORT void gemv(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m,
-                        std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a,
-                        std::int64_t lda, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
-                        double beta, cl::sycl::buffer<double, 1> &y, std::int64_t incy);
-ONEMKL_EXPORT void gemv(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m,
-                        std::int64_t n, std::complex<float> alpha,
-                        cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
-                        cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
-                        std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &y,
-                        std::int64_t incy);
-ONEMKL_EXPORT void gemv(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m,
-                        std::int64_t n, std::complex<double> alpha,
-                        cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
-                        cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
-                        std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &y,
-                        std::int64_t incy);
+ONEMKL_EXPORT void gemv(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                        float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                        cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
+                        cl::sycl::buffer<float, 1> &y, std::int64_t incy);
+ONEMKL_EXPORT void gemv(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                        double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                        cl::sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
+                        cl::sycl::buffer<double, 1> &y, std::int64_t incy);
+ONEMKL_EXPORT void gemv(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                        std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+                        std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &x,
+                        std::int64_t incx, std::complex<float> beta,
+                        cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy);
+ONEMKL_EXPORT void gemv(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                        std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+                        std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &x,
+                        std::int64_t incx, std::complex<double> beta,
+                        cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy);
 
-ONEMKL_EXPORT void her(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
-                       float alpha, cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+ONEMKL_EXPORT void her(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, float alpha,
+                       cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
                        cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda);
-ONEMKL_EXPORT void her(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
-                       double alpha, cl::sycl::buffer<std::complex<double>, 1> &x,
-                       std::int64_t incx, cl::sycl::buffer<std::complex<double>, 1> &a,
-                       std::int64_t lda);
+ONEMKL_EXPORT void her(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, double alpha,
+                       cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                       cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda);
 
-ONEMKL_EXPORT void hpr(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
-                       float alpha, cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+ONEMKL_EXPORT void hpr(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, float alpha,
+                       cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
                        cl::sycl::buffer<std::complex<float>, 1> &a);
-ONEMKL_EXPORT void hpr(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
-                       double alpha, cl::sycl::buffer<std::complex<double>, 1> &x,
-                       std::int64_t incx, cl::sycl::buffer<std::complex<double>, 1> &a);
+ONEMKL_EXPORT void hpr(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, double alpha,
+                       cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                       cl::sycl::buffer<std::complex<double>, 1> &a);
 
-ONEMKL_EXPORT void gemm_ext(char *libname, cl::sycl::queue &queue, transpose transa,
-                            transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
-                            float alpha, cl::sycl::buffer<half, 1> &a, std::int64_t lda,
+ONEMKL_EXPORT void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb,
+                            std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                            cl::sycl::buffer<half, 1> &a, std::int64_t lda,
                             cl::sycl::buffer<half, 1> &b, std::int64_t ldb, float beta,
                             cl::sycl::buffer<float, 1> &c, std::int64_t ldc);
-ONEMKL_EXPORT void gemm_ext(char *libname, cl::sycl::queue &queue, transpose transa,
-                            transpose transb, offset offsetc, std::int64_t m, std::int64_t n,
-                            std::int64_t k, float alpha, cl::sycl::buffer<int8_t, 1> &a,
-                            std::int64_t lda, int8_t ao, cl::sycl::buffer<uint8_t, 1> &b,
-                            std::int64_t ldb, uint8_t bo, float beta,
-                            cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc,
-                            cl::sycl::buffer<int32_t, 1> &co);
-ONEMKL_EXPORT void gemm_ext(char *libname, cl::sycl::queue &queue, transpose transa,
-                            transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
-                            float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+
+ONEMKL_EXPORT void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb,
+                            std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                            cl::sycl::buffer<bfloat16, 1> &a, std::int64_t lda,
+                            cl::sycl::buffer<bfloat16, 1> &b, std::int64_t ldb, float beta,
+                            cl::sycl::buffer<float, 1> &c, std::int64_t ldc);
+ONEMKL_EXPORT void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb,
+                            offset offsetc, std::int64_t m, std::int64_t n, std::int64_t k,
+                            float alpha, cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda,
+                            int8_t ao, cl::sycl::buffer<uint8_t, 1> &b, std::int64_t ldb,
+                            uint8_t bo, float beta, cl::sycl::buffer<int32_t, 1> &c,
+                            std::int64_t ldc, cl::sycl::buffer<int32_t, 1> &co);
+ONEMKL_EXPORT void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb,
+                            std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                            cl::sycl::buffer<float, 1> &a, std::int64_t lda,
                             cl::sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
                             cl::sycl::buffer<float, 1> &c, std::int64_t ldc);
-ONEMKL_EXPORT void gemm_ext(char *libname, cl::sycl::queue &queue, transpose transa,
-                            transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
-                            double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+ONEMKL_EXPORT void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb,
+                            std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
+                            cl::sycl::buffer<double, 1> &a, std::int64_t lda,
                             cl::sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
                             cl::sycl::buffer<double, 1> &c, std::int64_t ldc);
-ONEMKL_EXPORT void gemm_ext(char *libname, cl::sycl::queue &queue, transpose transa,
-                            transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+ONEMKL_EXPORT void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb,
+                            std::int64_t m, std::int64_t n, std::int64_t k,
                             std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
                             std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b,
                             std::int64_t ldb, std::complex<float> beta,
                             cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc);
-ONEMKL_EXPORT void gemm_ext(char *libname, cl::sycl::queue &queue, transpose transa,
-                            transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+ONEMKL_EXPORT void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb,
+                            std::int64_t m, std::int64_t n, std::int64_t k,
                             std::complex<double> alpha,
                             cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
                             cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
                             std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c,
                             std::int64_t ldc);
-ONEMKL_EXPORT void gemm_ext(char *libname, cl::sycl::queue &queue, transpose transa,
-                            transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
-                            half alpha, cl::sycl::buffer<half, 1> &a, std::int64_t lda,
+ONEMKL_EXPORT void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb,
+                            std::int64_t m, std::int64_t n, std::int64_t k, half alpha,
+                            cl::sycl::buffer<half, 1> &a, std::int64_t lda,
                             cl::sycl::buffer<half, 1> &b, std::int64_t ldb, half beta,
                             cl::sycl::buffer<half, 1> &c, std::int64_t ldc);
 
-ONEMKL_EXPORT void iamin(char *libname, cl::sycl::queue &queue, std::int64_t n,
-                         cl::sycl::buffer<float, 1> &x, std::int64_t incx,
-                         cl::sycl::buffer<std::int64_t, 1> &result);
-ONEMKL_EXPORT void iamin(char *libname, cl::sycl::queue &queue, std::int64_t n,
-                         cl::sycl::buffer<double, 1> &x, std::int64_t incx,
-                         cl::sycl::buffer<std::int64_t, 1> &result);
-ONEMKL_EXPORT void iamin(char *libname, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void iamin(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                         std::int64_t incx, cl::sycl::buffer<std::int64_t, 1> &result);
+ONEMKL_EXPORT void iamin(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &x,
+                         std::int64_t incx, cl::sycl::buffer<std::int64_t, 1> &result);
+ONEMKL_EXPORT void iamin(cl::sycl::queue &queue, std::int64_t n,
                          cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
                          cl::sycl::buffer<std::int64_t, 1> &result);
-ONEMKL_EXPORT void iamin(char *libname, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void iamin(cl::sycl::queue &queue, std::int64_t n,
                          cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
                          cl::sycl::buffer<std::int64_t, 1> &result);
 
-ONEMKL_EXPORT void hpmv(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+ONEMKL_EXPORT void hpmv(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
                         std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
                         cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
                         std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &y,
                         std::int64_t incy);
-ONEMKL_EXPORT void hpmv(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+ONEMKL_EXPORT void hpmv(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
                         std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
                         cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
                         std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &y,
                         std::int64_t incy);
 
-ONEMKL_EXPORT void spmv(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
-                        float alpha, cl::sycl::buffer<float, 1> &a, cl::sycl::buffer<float, 1> &x,
+ONEMKL_EXPORT void spmv(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, float alpha,
+                        cl::sycl::buffer<float, 1> &a, cl::sycl::buffer<float, 1> &x,
                         std::int64_t incx, float beta, cl::sycl::buffer<float, 1> &y,
                         std::int64_t incy);
-ONEMKL_EXPORT void spmv(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
-                        double alpha, cl::sycl::buffer<double, 1> &a,
-                        cl::sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
-                        cl::sycl::buffer<double, 1> &y, std::int64_t incy);
+ONEMKL_EXPORT void spmv(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, double alpha,
+                        cl::sycl::buffer<double, 1> &a, cl::sycl::buffer<double, 1> &x,
+                        std::int64_t incx, double beta, cl::sycl::buffer<double, 1> &y,
+                        std::int64_t incy);
 
-ONEMKL_EXPORT void rotmg(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<float, 1> &d1,
+ONEMKL_EXPORT void rotmg(cl::sycl::queue &queue, cl::sycl::buffer<float, 1> &d1,
                          cl::sycl::buffer<float, 1> &d2, cl::sycl::buffer<float, 1> &x1, float y1,
                          cl::sycl::buffer<float, 1> &param);
-ONEMKL_EXPORT void rotmg(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<double, 1> &d1,
+ONEMKL_EXPORT void rotmg(cl::sycl::queue &queue, cl::sycl::buffer<double, 1> &d1,
                          cl::sycl::buffer<double, 1> &d2, cl::sycl::buffer<double, 1> &x1,
                          double y1, cl::sycl::buffer<double, 1> &param);
 
-ONEMKL_EXPORT void swap(char *libname, cl::sycl::queue &queue, std::int64_t n,
-                        cl::sycl::buffer<float, 1> &x, std::int64_t incx,
-                        cl::sycl::buffer<float, 1> &y, std::int64_t incy);
-ONEMKL_EXPORT void swap(char *libname, cl::sycl::queue &queue, std::int64_t n,
-                        cl::sycl::buffer<double, 1> &x, std::int64_t incx,
-                        cl::sycl::buffer<double, 1> &y, std::int64_t incy);
-ONEMKL_EXPORT void swap(char *libname, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void swap(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                        std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy);
+ONEMKL_EXPORT void swap(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &x,
+                        std::int64_t incx, cl::sycl::buffer<double, 1> &y, std::int64_t incy);
+ONEMKL_EXPORT void swap(cl::sycl::queue &queue, std::int64_t n,
                         cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy);
-ONEMKL_EXPORT void swap(char *libname, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void swap(cl::sycl::queue &queue, std::int64_t n,
                         cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy);
 
-ONEMKL_EXPORT void geru(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+ONEMKL_EXPORT void geru(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
                         std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &x,
                         std::int64_t incx, cl::sycl::buffer<std::complex<float>, 1> &y,
                         std::int64_t incy, cl::sycl::buffer<std::complex<float>, 1> &a,
                         std::int64_t lda);
-ONEMKL_EXPORT void geru(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+ONEMKL_EXPORT void geru(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
                         std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &x,
                         std::int64_t incx, cl::sycl::buffer<std::complex<double>, 1> &y,
                         std::int64_t incy, cl::sycl::buffer<std::complex<double>, 1> &a,
                         std::int64_t lda);
 
-ONEMKL_EXPORT void nrm2(char *libname, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void nrm2(cl::sycl::queue &queue, std::int64_t n,
                         cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<float, 1> &result);
-ONEMKL_EXPORT void nrm2(char *libname, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void nrm2(cl::sycl::queue &queue, std::int64_t n,
                         cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<double, 1> &result);
-ONEMKL_EXPORT void nrm2(char *libname, cl::sycl::queue &queue, std::int64_t n,
-                        cl::sycl::buffer<float, 1> &x, std::int64_t incx,
-                        cl::sycl::buffer<float, 1> &result);
-ONEMKL_EXPORT void nrm2(char *libname, cl::sycl::queue &queue, std::int64_t n,
-                        cl::sycl::buffer<double, 1> &x, std::int64_t incx,
-                        cl::sycl::buffer<double, 1> &result);
+ONEMKL_EXPORT void nrm2(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                        std::int64_t incx, cl::sycl::buffer<float, 1> &result);
+ONEMKL_EXPORT void nrm2(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &x,
+                        std::int64_t incx, cl::sycl::buffer<double, 1> &result);
 
-ONEMKL_EXPORT void gemmt(char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose transa,
+ONEMKL_EXPORT void gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa,
                          transpose transb, std::int64_t n, std::int64_t k, float alpha,
                          cl::sycl::buffer<float, 1> &a, std::int64_t lda,
                          cl::sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
                          cl::sycl::buffer<float, 1> &c, std::int64_t ldc);
-ONEMKL_EXPORT void gemmt(char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose transa,
+ONEMKL_EXPORT void gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa,
                          transpose transb, std::int64_t n, std::int64_t k, double alpha,
                          cl::sycl::buffer<double, 1> &a, std::int64_t lda,
                          cl::sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
                          cl::sycl::buffer<double, 1> &c, std::int64_t ldc);
-ONEMKL_EXPORT void gemmt(char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose transa,
+ONEMKL_EXPORT void gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa,
                          transpose transb, std::int64_t n, std::int64_t k,
                          std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
                          std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b,
                          std::int64_t ldb, std::complex<float> beta,
                          cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc);
-ONEMKL_EXPORT void gemmt(char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose transa,
+ONEMKL_EXPORT void gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa,
                          transpose transb, std::int64_t n, std::int64_t k,
                          std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
                          std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b,
                          std::int64_t ldb, std::complex<double> beta,
                          cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc);
 
-ONEMKL_EXPORT void gemm(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
-                        std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
-                        cl::sycl::buffer<float, 1> &a, std::int64_t lda,
-                        cl::sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
-                        cl::sycl::buffer<float, 1> &c, std::int64_t ldc);
-ONEMKL_EXPORT void gemm(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
-                        std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
+ONEMKL_EXPORT void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                        std::int64_t n, std::int64_t k, float alpha, cl::sycl::buffer<float, 1> &a,
+                        std::int64_t lda, cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                        float beta, cl::sycl::buffer<float, 1> &c, std::int64_t ldc);
+ONEMKL_EXPORT void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                        std::int64_t n, std::int64_t k, double alpha,
                         cl::sycl::buffer<double, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
                         cl::sycl::buffer<double, 1> &c, std::int64_t ldc);
-ONEMKL_EXPORT void gemm(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
-                        std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+ONEMKL_EXPORT void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                        std::int64_t n, std::int64_t k, std::complex<float> alpha,
                         cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
                         std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c,
                         std::int64_t ldc);
-ONEMKL_EXPORT void gemm(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
-                        std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+ONEMKL_EXPORT void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                        std::int64_t n, std::int64_t k, std::complex<double> alpha,
                         cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
                         std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c,
                         std::int64_t ldc);
-ONEMKL_EXPORT void gemm(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
-                        std::int64_t m, std::int64_t n, std::int64_t k, half alpha,
-                        cl::sycl::buffer<half, 1> &a, std::int64_t lda,
-                        cl::sycl::buffer<half, 1> &b, std::int64_t ldb, half beta,
+ONEMKL_EXPORT void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                        std::int64_t n, std::int64_t k, half alpha, cl::sycl::buffer<half, 1> &a,
+                        std::int64_t lda, cl::sycl::buffer<half, 1> &b, std::int64_t ldb, half beta,
                         cl::sycl::buffer<half, 1> &c, std::int64_t ldc);
 
-ONEMKL_EXPORT void syr2(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
-                        float alpha, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+ONEMKL_EXPORT void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                        std::int64_t n, std::int64_t k, bfloat16 alpha,
+                        cl::sycl::buffer<bfloat16, 1> &a, std::int64_t lda,
+                        cl::sycl::buffer<bfloat16, 1> &b, std::int64_t ldb, bfloat16 beta,
+                        cl::sycl::buffer<bfloat16, 1> &c, std::int64_t ldc);
+
+ONEMKL_EXPORT void syr2(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, float alpha,
+                        cl::sycl::buffer<float, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<float, 1> &y, std::int64_t incy,
                         cl::sycl::buffer<float, 1> &a, std::int64_t lda);
-ONEMKL_EXPORT void syr2(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
-                        double alpha, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+ONEMKL_EXPORT void syr2(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, double alpha,
+                        cl::sycl::buffer<double, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<double, 1> &y, std::int64_t incy,
                         cl::sycl::buffer<double, 1> &a, std::int64_t lda);
 
-ONEMKL_EXPORT void ger(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
-                       float alpha, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+ONEMKL_EXPORT void ger(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, float alpha,
+                       cl::sycl::buffer<float, 1> &x, std::int64_t incx,
                        cl::sycl::buffer<float, 1> &y, std::int64_t incy,
                        cl::sycl::buffer<float, 1> &a, std::int64_t lda);
-ONEMKL_EXPORT void ger(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
-                       double alpha, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+ONEMKL_EXPORT void ger(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, double alpha,
+                       cl::sycl::buffer<double, 1> &x, std::int64_t incx,
                        cl::sycl::buffer<double, 1> &y, std::int64_t incy,
                        cl::sycl::buffer<double, 1> &a, std::int64_t lda);
 
-ONEMKL_EXPORT void trsm(char *libname, cl::sycl::queue &queue, side left_right, uplo upper_lower,
-                        transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
-                        float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+ONEMKL_EXPORT void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans,
+                        diag unit_diag, std::int64_t m, std::int64_t n, float alpha,
+                        cl::sycl::buffer<float, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<float, 1> &b, std::int64_t ldb);
-ONEMKL_EXPORT void trsm(char *libname, cl::sycl::queue &queue, side left_right, uplo upper_lower,
-                        transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
-                        double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+ONEMKL_EXPORT void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans,
+                        diag unit_diag, std::int64_t m, std::int64_t n, double alpha,
+                        cl::sycl::buffer<double, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<double, 1> &b, std::int64_t ldb);
-ONEMKL_EXPORT void trsm(char *libname, cl::sycl::queue &queue, side left_right, uplo upper_lower,
-                        transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
-                        std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
-                        std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b,
-                        std::int64_t ldb);
-ONEMKL_EXPORT void trsm(char *libname, cl::sycl::queue &queue, side left_right, uplo upper_lower,
-                        transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
-                        std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
-                        std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b,
-                        std::int64_t ldb);
+ONEMKL_EXPORT void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans,
+                        diag unit_diag, std::int64_t m, std::int64_t n, std::complex<float> alpha,
+                        cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                        cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb);
+ONEMKL_EXPORT void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans,
+                        diag unit_diag, std::int64_t m, std::int64_t n, std::complex<double> alpha,
+                        cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                        cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb);
 
-ONEMKL_EXPORT void dotu(char *libname, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void dotu(cl::sycl::queue &queue, std::int64_t n,
                         cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
                         cl::sycl::buffer<std::complex<float>, 1> &result);
-ONEMKL_EXPORT void dotu(char *libname, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void dotu(cl::sycl::queue &queue, std::int64_t n,
                         cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
                         cl::sycl::buffer<std::complex<double>, 1> &result);
 
-ONEMKL_EXPORT void hemm(char *libname, cl::sycl::queue &queue, side left_right, uplo upper_lower,
-                        std::int64_t m, std::int64_t n, std::complex<float> alpha,
+ONEMKL_EXPORT void hemm(cl::sycl::queue &queue, side left_right, uplo upper_lower, std::int64_t m,
+                        std::int64_t n, std::complex<float> alpha,
                         cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
                         std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c,
                         std::int64_t ldc);
-ONEMKL_EXPORT void hemm(char *libname, cl::sycl::queue &queue, side left_right, uplo upper_lower,
-                        std::int64_t m, std::int64_t n, std::complex<double> alpha,
+ONEMKL_EXPORT void hemm(cl::sycl::queue &queue, side left_right, uplo upper_lower, std::int64_t m,
+                        std::int64_t n, std::complex<double> alpha,
                         cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
                         std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c,
                         std::int64_t ldc);
 
-ONEMKL_EXPORT void hpr2(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+ONEMKL_EXPORT void hpr2(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
                         std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &x,
                         std::int64_t incx, cl::sycl::buffer<std::complex<float>, 1> &y,
                         std::int64_t incy, cl::sycl::buffer<std::complex<float>, 1> &a);
-ONEMKL_EXPORT void hpr2(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+ONEMKL_EXPORT void hpr2(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
                         std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &x,
                         std::int64_t incx, cl::sycl::buffer<std::complex<double>, 1> &y,
                         std::int64_t incy, cl::sycl::buffer<std::complex<double>, 1> &a);
 
-ONEMKL_EXPORT void gbmv(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m,
-                        std::int64_t n, std::int64_t kl, std::int64_t ku, float alpha,
+ONEMKL_EXPORT void gbmv(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                        std::int64_t kl, std::int64_t ku, float alpha,
                         cl::sycl::buffer<float, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
                         cl::sycl::buffer<float, 1> &y, std::int64_t incy);
-ONEMKL_EXPORT void gbmv(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m,
-                        std::int64_t n, std::int64_t kl, std::int64_t ku, double alpha,
+ONEMKL_EXPORT void gbmv(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                        std::int64_t kl, std::int64_t ku, double alpha,
                         cl::sycl::buffer<double, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
                         cl::sycl::buffer<double, 1> &y, std::int64_t incy);
-ONEMKL_EXPORT void gbmv(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m,
-                        std::int64_t n, std::int64_t kl, std::int64_t ku, std::complex<float> alpha,
+ONEMKL_EXPORT void gbmv(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                        std::int64_t kl, std::int64_t ku, std::complex<float> alpha,
                         cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
                         std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &y,
                         std::int64_t incy);
-ONEMKL_EXPORT void gbmv(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m,
-                        std::int64_t n, std::int64_t kl, std::int64_t ku,
-                        std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
-                        std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &x,
-                        std::int64_t incx, std::complex<double> beta,
-                        cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy);
+ONEMKL_EXPORT void gbmv(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                        std::int64_t kl, std::int64_t ku, std::complex<double> alpha,
+                        cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                        cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                        std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &y,
+                        std::int64_t incy);
 
-ONEMKL_EXPORT void tbmv(char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
-                        diag unit_diag, std::int64_t n, std::int64_t k,
-                        cl::sycl::buffer<float, 1> &a, std::int64_t lda,
-                        cl::sycl::buffer<float, 1> &x, std::int64_t incx);
-ONEMKL_EXPORT void tbmv(char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
-                        diag unit_diag, std::int64_t n, std::int64_t k,
-                        cl::sycl::buffer<double, 1> &a, std::int64_t lda,
-                        cl::sycl::buffer<double, 1> &x, std::int64_t incx);
-ONEMKL_EXPORT void tbmv(char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
-                        diag unit_diag, std::int64_t n, std::int64_t k,
-                        cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
-                        cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx);
-ONEMKL_EXPORT void tbmv(char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
-                        diag unit_diag, std::int64_t n, std::int64_t k,
+ONEMKL_EXPORT void tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
+                        std::int64_t n, std::int64_t k, cl::sycl::buffer<float, 1> &a,
+                        std::int64_t lda, cl::sycl::buffer<float, 1> &x, std::int64_t incx);
+ONEMKL_EXPORT void tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
+                        std::int64_t n, std::int64_t k, cl::sycl::buffer<double, 1> &a,
+                        std::int64_t lda, cl::sycl::buffer<double, 1> &x, std::int64_t incx);
+ONEMKL_EXPORT void tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
+                        std::int64_t n, std::int64_t k, cl::sycl::buffer<std::complex<float>, 1> &a,
+                        std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &x,
+                        std::int64_t incx);
+ONEMKL_EXPORT void tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
+                        std::int64_t n, std::int64_t k,
                         cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx);
 
-ONEMKL_EXPORT void symm(char *libname, cl::sycl::queue &queue, side left_right, uplo upper_lower,
-                        std::int64_t m, std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
+ONEMKL_EXPORT void symm(cl::sycl::queue &queue, side left_right, uplo upper_lower, std::int64_t m,
+                        std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
                         std::int64_t lda, cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
                         float beta, cl::sycl::buffer<float, 1> &c, std::int64_t ldc);
-ONEMKL_EXPORT void symm(char *libname, cl::sycl::queue &queue, side left_right, uplo upper_lower,
-                        std::int64_t m, std::int64_t n, double alpha,
-                        cl::sycl::buffer<double, 1> &a, std::int64_t lda,
-                        cl::sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
-                        cl::sycl::buffer<double, 1> &c, std::int64_t ldc);
-ONEMKL_EXPORT void symm(char *libname, cl::sycl::queue &queue, side left_right, uplo upper_lower,
-                        std::int64_t m, std::int64_t n, std::complex<float> alpha,
+ONEMKL_EXPORT void symm(cl::sycl::queue &queue, side left_right, uplo upper_lower, std::int64_t m,
+                        std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a,
+                        std::int64_t lda, cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                        double beta, cl::sycl::buffer<double, 1> &c, std::int64_t ldc);
+ONEMKL_EXPORT void symm(cl::sycl::queue &queue, side left_right, uplo upper_lower, std::int64_t m,
+                        std::int64_t n, std::complex<float> alpha,
                         cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
                         std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c,
                         std::int64_t ldc);
-ONEMKL_EXPORT void symm(char *libname, cl::sycl::queue &queue, side left_right, uplo upper_lower,
-                        std::int64_t m, std::int64_t n, std::complex<double> alpha,
+ONEMKL_EXPORT void symm(cl::sycl::queue &queue, side left_right, uplo upper_lower, std::int64_t m,
+                        std::int64_t n, std::complex<double> alpha,
                         cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
                         std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c,
                         std::int64_t ldc);
 
-ONEMKL_EXPORT void dotc(char *libname, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void dotc(cl::sycl::queue &queue, std::int64_t n,
                         cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
                         cl::sycl::buffer<std::complex<float>, 1> &result);
-ONEMKL_EXPORT void dotc(char *libname, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void dotc(cl::sycl::queue &queue, std::int64_t n,
                         cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
                         cl::sycl::buffer<std::complex<double>, 1> &result);
 
-ONEMKL_EXPORT void syr(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
-                       float alpha, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+ONEMKL_EXPORT void syr(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, float alpha,
+                       cl::sycl::buffer<float, 1> &x, std::int64_t incx,
                        cl::sycl::buffer<float, 1> &a, std::int64_t lda);
-ONEMKL_EXPORT void syr(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
-                       double alpha, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+ONEMKL_EXPORT void syr(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, double alpha,
+                       cl::sycl::buffer<double, 1> &x, std::int64_t incx,
                        cl::sycl::buffer<double, 1> &a, std::int64_t lda);
 
-ONEMKL_EXPORT void trmm(char *libname, cl::sycl::queue &queue, side left_right, uplo upper_lower,
-                        transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
-                        float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+ONEMKL_EXPORT void trmm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans,
+                        diag unit_diag, std::int64_t m, std::int64_t n, float alpha,
+                        cl::sycl::buffer<float, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<float, 1> &b, std::int64_t ldb);
-ONEMKL_EXPORT void trmm(char *libname, cl::sycl::queue &queue, side left_right, uplo upper_lower,
-                        transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
-                        double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+ONEMKL_EXPORT void trmm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans,
+                        diag unit_diag, std::int64_t m, std::int64_t n, double alpha,
+                        cl::sycl::buffer<double, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<double, 1> &b, std::int64_t ldb);
-ONEMKL_EXPORT void trmm(char *libname, cl::sycl::queue &queue, side left_right, uplo upper_lower,
-                        transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
-                        std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
-                        std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b,
-                        std::int64_t ldb);
-ONEMKL_EXPORT void trmm(char *libname, cl::sycl::queue &queue, side left_right, uplo upper_lower,
-                        transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
-                        std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
-                        std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b,
-                        std::int64_t ldb);
+ONEMKL_EXPORT void trmm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans,
+                        diag unit_diag, std::int64_t m, std::int64_t n, std::complex<float> alpha,
+                        cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                        cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb);
+ONEMKL_EXPORT void trmm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans,
+                        diag unit_diag, std::int64_t m, std::int64_t n, std::complex<double> alpha,
+                        cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                        cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb);
 
-ONEMKL_EXPORT void symv(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
-                        float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+ONEMKL_EXPORT void symv(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, float alpha,
+                        cl::sycl::buffer<float, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
                         cl::sycl::buffer<float, 1> &y, std::int64_t incy);
-ONEMKL_EXPORT void symv(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
-                        double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+ONEMKL_EXPORT void symv(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, double alpha,
+                        cl::sycl::buffer<double, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
                         cl::sycl::buffer<double, 1> &y, std::int64_t incy);
 
-ONEMKL_EXPORT void tpsv(char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
-                        diag unit_diag, std::int64_t n, cl::sycl::buffer<float, 1> &a,
+ONEMKL_EXPORT void tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
+                        std::int64_t n, cl::sycl::buffer<float, 1> &a,
                         cl::sycl::buffer<float, 1> &x, std::int64_t incx);
-ONEMKL_EXPORT void tpsv(char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
-                        diag unit_diag, std::int64_t n, cl::sycl::buffer<double, 1> &a,
+ONEMKL_EXPORT void tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
+                        std::int64_t n, cl::sycl::buffer<double, 1> &a,
                         cl::sycl::buffer<double, 1> &x, std::int64_t incx);
-ONEMKL_EXPORT void tpsv(char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
-                        diag unit_diag, std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &a,
+ONEMKL_EXPORT void tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
+                        std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &a,
                         cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx);
-ONEMKL_EXPORT void tpsv(char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
-                        diag unit_diag, std::int64_t n,
-                        cl::sycl::buffer<std::complex<double>, 1> &a,
+ONEMKL_EXPORT void tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
+                        std::int64_t n, cl::sycl::buffer<std::complex<double>, 1> &a,
                         cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx);
 
-ONEMKL_EXPORT void trsv(char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
-                        diag unit_diag, std::int64_t n, cl::sycl::buffer<float, 1> &a,
-                        std::int64_t lda, cl::sycl::buffer<float, 1> &x, std::int64_t incx);
-ONEMKL_EXPORT void trsv(char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
-                        diag unit_diag, std::int64_t n, cl::sycl::buffer<double, 1> &a,
-                        std::int64_t lda, cl::sycl::buffer<double, 1> &x, std::int64_t incx);
-ONEMKL_EXPORT void trsv(char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
-                        diag unit_diag, std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &a,
+ONEMKL_EXPORT void trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
+                        std::int64_t n, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                        cl::sycl::buffer<float, 1> &x, std::int64_t incx);
+ONEMKL_EXPORT void trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
+                        std::int64_t n, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                        cl::sycl::buffer<double, 1> &x, std::int64_t incx);
+ONEMKL_EXPORT void trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
+                        std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &a,
                         std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &x,
                         std::int64_t incx);
-ONEMKL_EXPORT void trsv(char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
-                        diag unit_diag, std::int64_t n,
-                        cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
-                        cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx);
+ONEMKL_EXPORT void trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
+                        std::int64_t n, cl::sycl::buffer<std::complex<double>, 1> &a,
+                        std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &x,
+                        std::int64_t incx);
 
-ONEMKL_EXPORT void copy(char *libname, cl::sycl::queue &queue, std::int64_t n,
-                        cl::sycl::buffer<float, 1> &x, std::int64_t incx,
-                        cl::sycl::buffer<float, 1> &y, std::int64_t incy);
-ONEMKL_EXPORT void copy(char *libname, cl::sycl::queue &queue, std::int64_t n,
-                        cl::sycl::buffer<double, 1> &x, std::int64_t incx,
-                        cl::sycl::buffer<double, 1> &y, std::int64_t incy);
-ONEMKL_EXPORT void copy(char *libname, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void copy(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                        std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy);
+ONEMKL_EXPORT void copy(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &x,
+                        std::int64_t incx, cl::sycl::buffer<double, 1> &y, std::int64_t incy);
+ONEMKL_EXPORT void copy(cl::sycl::queue &queue, std::int64_t n,
                         cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy);
-ONEMKL_EXPORT void copy(char *libname, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void copy(cl::sycl::queue &queue, std::int64_t n,
                         cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy);
 
-ONEMKL_EXPORT void hemv(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+ONEMKL_EXPORT void hemv(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
                         std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
                         std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &x,
                         std::int64_t incx, std::complex<float> beta,
                         cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy);
-ONEMKL_EXPORT void hemv(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+ONEMKL_EXPORT void hemv(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
                         std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
                         std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &x,
                         std::int64_t incx, std::complex<double> beta,
                         cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy);
 
-ONEMKL_EXPORT void iamax(char *libname, cl::sycl::queue &queue, std::int64_t n,
-                         cl::sycl::buffer<float, 1> &x, std::int64_t incx,
-                         cl::sycl::buffer<std::int64_t, 1> &result);
-ONEMKL_EXPORT void iamax(char *libname, cl::sycl::queue &queue, std::int64_t n,
-                         cl::sycl::buffer<double, 1> &x, std::int64_t incx,
-                         cl::sycl::buffer<std::int64_t, 1> &result);
-ONEMKL_EXPORT void iamax(char *libname, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void iamax(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                         std::int64_t incx, cl::sycl::buffer<std::int64_t, 1> &result);
+ONEMKL_EXPORT void iamax(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &x,
+                         std::int64_t incx, cl::sycl::buffer<std::int64_t, 1> &result);
+ONEMKL_EXPORT void iamax(cl::sycl::queue &queue, std::int64_t n,
                          cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
                          cl::sycl::buffer<std::int64_t, 1> &result);
-ONEMKL_EXPORT void iamax(char *libname, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void iamax(cl::sycl::queue &queue, std::int64_t n,
                          cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
                          cl::sycl::buffer<std::int64_t, 1> &result);
 
-ONEMKL_EXPORT void sbmv(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
-                        std::int64_t k, float alpha, cl::sycl::buffer<float, 1> &a,
-                        std::int64_t lda, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
-                        float beta, cl::sycl::buffer<float, 1> &y, std::int64_t incy);
-ONEMKL_EXPORT void sbmv(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
-                        std::int64_t k, double alpha, cl::sycl::buffer<double, 1> &a,
-                        std::int64_t lda, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
-                        double beta, cl::sycl::buffer<double, 1> &y, std::int64_t incy);
+ONEMKL_EXPORT void sbmv(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, std::int64_t k,
+                        float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                        cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
+                        cl::sycl::buffer<float, 1> &y, std::int64_t incy);
+ONEMKL_EXPORT void sbmv(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, std::int64_t k,
+                        double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                        cl::sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
+                        cl::sycl::buffer<double, 1> &y, std::int64_t incy);
 
-ONEMKL_EXPORT void asum(char *libname, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void asum(cl::sycl::queue &queue, std::int64_t n,
                         cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<float, 1> &result);
-ONEMKL_EXPORT void asum(char *libname, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void asum(cl::sycl::queue &queue, std::int64_t n,
                         cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<double, 1> &result);
-ONEMKL_EXPORT void asum(char *libname, cl::sycl::queue &queue, std::int64_t n,
-                        cl::sycl::buffer<float, 1> &x, std::int64_t incx,
-                        cl::sycl::buffer<float, 1> &result);
-ONEMKL_EXPORT void asum(char *libname, cl::sycl::queue &queue, std::int64_t n,
-                        cl::sycl::buffer<double, 1> &x, std::int64_t incx,
-                        cl::sycl::buffer<double, 1> &result);
+ONEMKL_EXPORT void asum(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                        std::int64_t incx, cl::sycl::buffer<float, 1> &result);
+ONEMKL_EXPORT void asum(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &x,
+                        std::int64_t incx, cl::sycl::buffer<double, 1> &result);
 
-ONEMKL_EXPORT void tbsv(char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
-                        diag unit_diag, std::int64_t n, std::int64_t k,
-                        cl::sycl::buffer<float, 1> &a, std::int64_t lda,
-                        cl::sycl::buffer<float, 1> &x, std::int64_t incx);
-ONEMKL_EXPORT void tbsv(char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
-                        diag unit_diag, std::int64_t n, std::int64_t k,
-                        cl::sycl::buffer<double, 1> &a, std::int64_t lda,
-                        cl::sycl::buffer<double, 1> &x, std::int64_t incx);
-ONEMKL_EXPORT void tbsv(char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
-                        diag unit_diag, std::int64_t n, std::int64_t k,
-                        cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
-                        cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx);
-ONEMKL_EXPORT void tbsv(char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
-                        diag unit_diag, std::int64_t n, std::int64_t k,
+ONEMKL_EXPORT void tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
+                        std::int64_t n, std::int64_t k, cl::sycl::buffer<float, 1> &a,
+                        std::int64_t lda, cl::sycl::buffer<float, 1> &x, std::int64_t incx);
+ONEMKL_EXPORT void tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
+                        std::int64_t n, std::int64_t k, cl::sycl::buffer<double, 1> &a,
+                        std::int64_t lda, cl::sycl::buffer<double, 1> &x, std::int64_t incx);
+ONEMKL_EXPORT void tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
+                        std::int64_t n, std::int64_t k, cl::sycl::buffer<std::complex<float>, 1> &a,
+                        std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &x,
+                        std::int64_t incx);
+ONEMKL_EXPORT void tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
+                        std::int64_t n, std::int64_t k,
                         cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx);
 
-ONEMKL_EXPORT void spr2(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
-                        float alpha, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+ONEMKL_EXPORT void spr2(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, float alpha,
+                        cl::sycl::buffer<float, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<float, 1> &y, std::int64_t incy,
                         cl::sycl::buffer<float, 1> &a);
-ONEMKL_EXPORT void spr2(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
-                        double alpha, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+ONEMKL_EXPORT void spr2(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, double alpha,
+                        cl::sycl::buffer<double, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<double, 1> &y, std::int64_t incy,
                         cl::sycl::buffer<double, 1> &a);
 
-ONEMKL_EXPORT void trsm_batch(char *libname, cl::sycl::queue &queue, side left_right,
-                              uplo upper_lower, transpose trans, diag unit_diag, std::int64_t m,
-                              std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
-                              std::int64_t lda, std::int64_t stride_a,
-                              cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
-                              std::int64_t stride_b, std::int64_t batch_size);
-ONEMKL_EXPORT void trsm_batch(char *libname, cl::sycl::queue &queue, side left_right,
-                              uplo upper_lower, transpose trans, diag unit_diag, std::int64_t m,
-                              std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a,
-                              std::int64_t lda, std::int64_t stride_a,
-                              cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
-                              std::int64_t stride_b, std::int64_t batch_size);
-ONEMKL_EXPORT void trsm_batch(char *libname, cl::sycl::queue &queue, side left_right,
-                              uplo upper_lower, transpose trans, diag unit_diag, std::int64_t m,
-                              std::int64_t n, std::complex<float> alpha,
+ONEMKL_EXPORT void trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_lower,
+                              transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
+                              float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                              std::int64_t stride_a, cl::sycl::buffer<float, 1> &b,
+                              std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size);
+ONEMKL_EXPORT void trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_lower,
+                              transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
+                              double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                              std::int64_t stride_a, cl::sycl::buffer<double, 1> &b,
+                              std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size);
+ONEMKL_EXPORT void trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_lower,
+                              transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
+                              std::complex<float> alpha,
                               cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
                               std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &b,
                               std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size);
-ONEMKL_EXPORT void trsm_batch(char *libname, cl::sycl::queue &queue, side left_right,
-                              uplo upper_lower, transpose trans, diag unit_diag, std::int64_t m,
-                              std::int64_t n, std::complex<double> alpha,
+ONEMKL_EXPORT void trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_lower,
+                              transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
+                              std::complex<double> alpha,
                               cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
                               std::int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &b,
                               std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size);
 
-ONEMKL_EXPORT void rotm(char *libname, cl::sycl::queue &queue, std::int64_t n,
-                        cl::sycl::buffer<float, 1> &x, std::int64_t incx,
-                        cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+ONEMKL_EXPORT void rotm(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                        std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
                         cl::sycl::buffer<float, 1> &param);
-ONEMKL_EXPORT void rotm(char *libname, cl::sycl::queue &queue, std::int64_t n,
-                        cl::sycl::buffer<double, 1> &x, std::int64_t incx,
-                        cl::sycl::buffer<double, 1> &y, std::int64_t incy,
+ONEMKL_EXPORT void rotm(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &x,
+                        std::int64_t incx, cl::sycl::buffer<double, 1> &y, std::int64_t incy,
                         cl::sycl::buffer<double, 1> &param);
 
-ONEMKL_EXPORT void dot(char *libname, cl::sycl::queue &queue, std::int64_t n,
-                       cl::sycl::buffer<float, 1> &x, std::int64_t incx,
-                       cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+ONEMKL_EXPORT void dot(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                       std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
                        cl::sycl::buffer<float, 1> &result);
-ONEMKL_EXPORT void dot(char *libname, cl::sycl::queue &queue, std::int64_t n,
-                       cl::sycl::buffer<double, 1> &x, std::int64_t incx,
-                       cl::sycl::buffer<double, 1> &y, std::int64_t incy,
+ONEMKL_EXPORT void dot(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &x,
+                       std::int64_t incx, cl::sycl::buffer<double, 1> &y, std::int64_t incy,
                        cl::sycl::buffer<double, 1> &result);
-ONEMKL_EXPORT void dot(char *libname, cl::sycl::queue &queue, std::int64_t n,
-                       cl::sycl::buffer<float, 1> &x, std::int64_t incx,
-                       cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+ONEMKL_EXPORT void dot(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                       std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
                        cl::sycl::buffer<double, 1> &result);
 
-ONEMKL_EXPORT void sdsdot(char *libname, cl::sycl::queue &queue, std::int64_t n, float sb,
+ONEMKL_EXPORT void sdsdot(cl::sycl::queue &queue, std::int64_t n, float sb,
                           cl::sycl::buffer<float, 1> &x, std::int64_t incx,
                           cl::sycl::buffer<float, 1> &y, std::int64_t incy,
                           cl::sycl::buffer<float, 1> &result);
 
-ONEMKL_EXPORT void her2k(char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
-                         std::int64_t n, std::int64_t k, std::complex<float> alpha,
+ONEMKL_EXPORT void her2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans, std::int64_t n,
+                         std::int64_t k, std::complex<float> alpha,
                          cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
                          cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, float beta,
                          cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc);
-ONEMKL_EXPORT void her2k(char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
-                         std::int64_t n, std::int64_t k, std::complex<double> alpha,
+ONEMKL_EXPORT void her2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans, std::int64_t n,
+                         std::int64_t k, std::complex<double> alpha,
                          cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
                          cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
                          double beta, cl::sycl::buffer<std::complex<double>, 1> &c,
                          std::int64_t ldc);
 
-ONEMKL_EXPORT void rotg(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<float, 1> &a,
+ONEMKL_EXPORT void rotg(cl::sycl::queue &queue, cl::sycl::buffer<float, 1> &a,
                         cl::sycl::buffer<float, 1> &b, cl::sycl::buffer<float, 1> &c,
                         cl::sycl::buffer<float, 1> &s);
-ONEMKL_EXPORT void rotg(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<double, 1> &a,
+ONEMKL_EXPORT void rotg(cl::sycl::queue &queue, cl::sycl::buffer<double, 1> &a,
                         cl::sycl::buffer<double, 1> &b, cl::sycl::buffer<double, 1> &c,
                         cl::sycl::buffer<double, 1> &s);
-ONEMKL_EXPORT void rotg(char *libname, cl::sycl::queue &queue,
-                        cl::sycl::buffer<std::complex<float>, 1> &a,
+ONEMKL_EXPORT void rotg(cl::sycl::queue &queue, cl::sycl::buffer<std::complex<float>, 1> &a,
                         cl::sycl::buffer<std::complex<float>, 1> &b, cl::sycl::buffer<float, 1> &c,
                         cl::sycl::buffer<std::complex<float>, 1> &s);
-ONEMKL_EXPORT void rotg(char *libname, cl::sycl::queue &queue,
-                        cl::sycl::buffer<std::complex<double>, 1> &a,
+ONEMKL_EXPORT void rotg(cl::sycl::queue &queue, cl::sycl::buffer<std::complex<double>, 1> &a,
                         cl::sycl::buffer<std::complex<double>, 1> &b,
                         cl::sycl::buffer<double, 1> &c,
                         cl::sycl::buffer<std::complex<double>, 1> &s);
@@ -806,792 +871,924 @@ ONEMKL_EXPORT void rotg(char *libname, cl::sycl::queue &queue,
 // USM APIs
 
 ONEMKL_EXPORT cl::sycl::event herk(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans, std::int64_t n,
-    std::int64_t k, float alpha, const std::complex<float> *a, std::int64_t lda, float beta,
-    std::complex<float> *c, std::int64_t ldc,
-    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+    cl::sycl::queue &queue, uplo upper_lower, transpose trans, std::int64_t n, std::int64_t k,
+    float alpha, const std::complex<float> *a, std::int64_t lda, float beta, std::complex<float> *c,
+    std::int64_t ldc, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event herk(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans, std::int64_t n,
-    std::int64_t k, double alpha, const std::complex<double> *a, std::int64_t lda, double beta,
+    cl::sycl::queue &queue, uplo upper_lower, transpose trans, std::int64_t n, std::int64_t k,
+    double alpha, const std::complex<double> *a, std::int64_t lda, double beta,
     std::complex<double> *c, std::int64_t ldc,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
 ONEMKL_EXPORT cl::sycl::event scal(
-    char *libname, cl::sycl::queue &queue, std::int64_t n, float alpha, float *x, std::int64_t incx,
+    cl::sycl::queue &queue, std::int64_t n, float alpha, float *x, std::int64_t incx,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event scal(
-    char *libname, cl::sycl::queue &queue, std::int64_t n, double alpha, double *x,
-    std::int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event scal(
-    char *libname, cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
-    std::complex<float> *x, std::int64_t incx,
+    cl::sycl::queue &queue, std::int64_t n, double alpha, double *x, std::int64_t incx,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event scal(
-    char *libname, cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
-    std::complex<double> *x, std::int64_t incx,
-    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+    cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha, std::complex<float> *x,
+    std::int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event scal(
-    char *libname, cl::sycl::queue &queue, std::int64_t n, float alpha, std::complex<float> *x,
+    cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha, std::complex<double> *x,
     std::int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event scal(
-    char *libname, cl::sycl::queue &queue, std::int64_t n, double alpha, std::complex<double> *x,
+    cl::sycl::queue &queue, std::int64_t n, float alpha, std::complex<float> *x, std::int64_t incx,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event scal(
+    cl::sycl::queue &queue, std::int64_t n, double alpha, std::complex<double> *x,
     std::int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
 ONEMKL_EXPORT cl::sycl::event trmv(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
-    std::int64_t n, const float *a, std::int64_t lda, float *x, std::int64_t incx,
+    cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+    const float *a, std::int64_t lda, float *x, std::int64_t incx,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event trmv(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
-    std::int64_t n, const double *a, std::int64_t lda, double *x, std::int64_t incx,
+    cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+    const double *a, std::int64_t lda, double *x, std::int64_t incx,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event trmv(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
-    std::int64_t n, const std::complex<float> *a, std::int64_t lda, std::complex<float> *x,
-    std::int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+    cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+    const std::complex<float> *a, std::int64_t lda, std::complex<float> *x, std::int64_t incx,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event trmv(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
-    std::int64_t n, const std::complex<double> *a, std::int64_t lda, std::complex<double> *x,
-    std::int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+    cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+    const std::complex<double> *a, std::int64_t lda, std::complex<double> *x, std::int64_t incx,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
 ONEMKL_EXPORT cl::sycl::event tpmv(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
-    std::int64_t n, const float *a, float *x, std::int64_t incx,
+    cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+    const float *a, float *x, std::int64_t incx,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event tpmv(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
-    std::int64_t n, const double *a, double *x, std::int64_t incx,
+    cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+    const double *a, double *x, std::int64_t incx,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event tpmv(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
-    std::int64_t n, const std::complex<float> *a, std::complex<float> *x, std::int64_t incx,
+    cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+    const std::complex<float> *a, std::complex<float> *x, std::int64_t incx,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event tpmv(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
-    std::int64_t n, const std::complex<double> *a, std::complex<double> *x, std::int64_t incx,
+    cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+    const std::complex<double> *a, std::complex<double> *x, std::int64_t incx,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event spr(char *libname, cl::sycl::queue &queue, uplo upper_lower,
-                                  std::int64_t n, float alpha, const float *x, std::int64_t incx,
-                                  float *a,
+ONEMKL_EXPORT cl::sycl::event spr(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                                  float alpha, const float *x, std::int64_t incx, float *a,
                                   const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event spr(char *libname, cl::sycl::queue &queue, uplo upper_lower,
-                                  std::int64_t n, double alpha, const double *x, std::int64_t incx,
-                                  double *a,
+ONEMKL_EXPORT cl::sycl::event spr(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                                  double alpha, const double *x, std::int64_t incx, double *a,
                                   const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
 ONEMKL_EXPORT cl::sycl::event gemm_batch(
-    char *libname, cl::sycl::queue &queue, transpose *transa, transpose *transb, std::int64_t *m,
-    std::int64_t *n, std::int64_t *k, float *alpha, const float **a, std::int64_t *lda,
-    const float **b, std::int64_t *ldb, float *beta, float **c, std::int64_t *ldc,
-    std::int64_t group_count, std::int64_t *group_size,
-    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+    cl::sycl::queue &queue, transpose *transa, transpose *transb, std::int64_t *m, std::int64_t *n,
+    std::int64_t *k, float *alpha, const float **a, std::int64_t *lda, const float **b,
+    std::int64_t *ldb, float *beta, float **c, std::int64_t *ldc, std::int64_t group_count,
+    std::int64_t *group_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event gemm_batch(
-    char *libname, cl::sycl::queue &queue, transpose *transa, transpose *transb, std::int64_t *m,
-    std::int64_t *n, std::int64_t *k, double *alpha, const double **a, std::int64_t *lda,
-    const double **b, std::int64_t *ldb, double *beta, double **c, std::int64_t *ldc,
-    std::int64_t group_count, std::int64_t *group_size,
-    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+    cl::sycl::queue &queue, transpose *transa, transpose *transb, std::int64_t *m, std::int64_t *n,
+    std::int64_t *k, double *alpha, const double **a, std::int64_t *lda, const double **b,
+    std::int64_t *ldb, double *beta, double **c, std::int64_t *ldc, std::int64_t group_count,
+    std::int64_t *group_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event gemm_batch(
-    char *libname, cl::sycl::queue &queue, transpose *transa, transpose *transb, std::int64_t *m,
-    std::int64_t *n, std::int64_t *k, std::complex<float> *alpha, const std::complex<float> **a,
-    std::int64_t *lda, const std::complex<float> **b, std::int64_t *ldb, std::complex<float> *beta,
+    cl::sycl::queue &queue, transpose *transa, transpose *transb, std::int64_t *m, std::int64_t *n,
+    std::int64_t *k, std::complex<float> *alpha, const std::complex<float> **a, std::int64_t *lda,
+    const std::complex<float> **b, std::int64_t *ldb, std::complex<float> *beta,
     std::complex<float> **c, std::int64_t *ldc, std::int64_t group_count, std::int64_t *group_size,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event gemm_batch(
-    char *libname, cl::sycl::queue &queue, transpose *transa, transpose *transb, std::int64_t *m,
-    std::int64_t *n, std::int64_t *k, std::complex<double> *alpha, const std::complex<double> **a,
-    std::int64_t *lda, const std::complex<double> **b, std::int64_t *ldb,
-    std::complex<double> *beta, std::complex<double> **c, std::int64_t *ldc,
-    std::int64_t group_count, std::int64_t *group_size,
+    cl::sycl::queue &queue, transpose *transa, transpose *transb, std::int64_t *m, std::int64_t *n,
+    std::int64_t *k, std::complex<double> *alpha, const std::complex<double> **a, std::int64_t *lda,
+    const std::complex<double> **b, std::int64_t *ldb, std::complex<double> *beta,
+    std::complex<double> **c, std::int64_t *ldc, std::int64_t group_count, std::int64_t *group_size,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event gemm_batch(
-    char *libname, cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
-    std::int64_t n, std::int64_t k, float alpha, const float *a, std::int64_t lda,
-    std::int64_t stride_a, const float *b, std::int64_t ldb, std::int64_t stride_b, float beta,
-    float *c, std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, float alpha, const float *a, std::int64_t lda, std::int64_t stride_a,
+    const float *b, std::int64_t ldb, std::int64_t stride_b, float beta, float *c, std::int64_t ldc,
+    std::int64_t stride_c, std::int64_t batch_size,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event gemm_batch(
-    char *libname, cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
-    std::int64_t n, std::int64_t k, double alpha, const double *a, std::int64_t lda,
-    std::int64_t stride_a, const double *b, std::int64_t ldb, std::int64_t stride_b, double beta,
-    double *c, std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, double alpha, const double *a, std::int64_t lda, std::int64_t stride_a,
+    const double *b, std::int64_t ldb, std::int64_t stride_b, double beta, double *c,
+    std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event gemm_batch(
-    char *libname, cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
-    std::int64_t n, std::int64_t k, std::complex<float> alpha, const std::complex<float> *a,
-    std::int64_t lda, std::int64_t stride_a, const std::complex<float> *b, std::int64_t ldb,
-    std::int64_t stride_b, std::complex<float> beta, std::complex<float> *c, std::int64_t ldc,
-    std::int64_t stride_c, std::int64_t batch_size,
-    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+    std::int64_t stride_a, const std::complex<float> *b, std::int64_t ldb, std::int64_t stride_b,
+    std::complex<float> beta, std::complex<float> *c, std::int64_t ldc, std::int64_t stride_c,
+    std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event gemm_batch(
-    char *libname, cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
-    std::int64_t n, std::int64_t k, std::complex<double> alpha, const std::complex<double> *a,
-    std::int64_t lda, std::int64_t stride_a, const std::complex<double> *b, std::int64_t ldb,
-    std::int64_t stride_b, std::complex<double> beta, std::complex<double> *c, std::int64_t ldc,
-    std::int64_t stride_c, std::int64_t batch_size,
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
+    std::int64_t stride_a, const std::complex<double> *b, std::int64_t ldb, std::int64_t stride_b,
+    std::complex<double> beta, std::complex<double> *c, std::int64_t ldc, std::int64_t stride_c,
+    std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT cl::sycl::event trsm_batch(
+    cl::sycl::queue &queue, side *left_right, uplo *upper_lower, transpose *trans, diag *unit_diag,
+    std::int64_t *m, std::int64_t *n, float *alpha, const float **a, std::int64_t *lda, float **b,
+    std::int64_t *ldb, std::int64_t group_count, std::int64_t *group_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event trsm_batch(
+    cl::sycl::queue &queue, side *left_right, uplo *upper_lower, transpose *trans, diag *unit_diag,
+    std::int64_t *m, std::int64_t *n, double *alpha, const double **a, std::int64_t *lda,
+    double **b, std::int64_t *ldb, std::int64_t group_count, std::int64_t *group_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event trsm_batch(
+    cl::sycl::queue &queue, side *left_right, uplo *upper_lower, transpose *trans, diag *unit_diag,
+    std::int64_t *m, std::int64_t *n, std::complex<float> *alpha, const std::complex<float> **a,
+    std::int64_t *lda, std::complex<float> **b, std::int64_t *ldb, std::int64_t group_count,
+    std::int64_t *group_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event trsm_batch(
+    cl::sycl::queue &queue, side *left_right, uplo *upper_lower, transpose *trans, diag *unit_diag,
+    std::int64_t *m, std::int64_t *n, std::complex<double> *alpha, const std::complex<double> **a,
+    std::int64_t *lda, std::complex<double> **b, std::int64_t *ldb, std::int64_t group_count,
+    std::int64_t *group_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT cl::sycl::event trsm_batch(
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+    std::int64_t m, std::int64_t n, float alpha, const float *a, std::int64_t lda,
+    std::int64_t stride_a, float *b, std::int64_t ldb, std::int64_t stride_b,
+    std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event trsm_batch(
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+    std::int64_t m, std::int64_t n, double alpha, const double *a, std::int64_t lda,
+    std::int64_t stride_a, double *b, std::int64_t ldb, std::int64_t stride_b,
+    std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event trsm_batch(
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+    std::int64_t m, std::int64_t n, std::complex<float> alpha, const std::complex<float> *a,
+    std::int64_t lda, std::int64_t stride_a, std::complex<float> *b, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event trsm_batch(
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+    std::int64_t m, std::int64_t n, std::complex<double> alpha, const std::complex<double> *a,
+    std::int64_t lda, std::int64_t stride_a, std::complex<double> *b, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
 ONEMKL_EXPORT cl::sycl::event syrk(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans, std::int64_t n,
-    std::int64_t k, float alpha, const float *a, std::int64_t lda, float beta, float *c,
-    std::int64_t ldc, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+    cl::sycl::queue &queue, uplo upper_lower, transpose trans, std::int64_t n, std::int64_t k,
+    float alpha, const float *a, std::int64_t lda, float beta, float *c, std::int64_t ldc,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event syrk(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans, std::int64_t n,
-    std::int64_t k, double alpha, const double *a, std::int64_t lda, double beta, double *c,
-    std::int64_t ldc, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+    cl::sycl::queue &queue, uplo upper_lower, transpose trans, std::int64_t n, std::int64_t k,
+    double alpha, const double *a, std::int64_t lda, double beta, double *c, std::int64_t ldc,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event syrk(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans, std::int64_t n,
-    std::int64_t k, std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+    cl::sycl::queue &queue, uplo upper_lower, transpose trans, std::int64_t n, std::int64_t k,
+    std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
     std::complex<float> beta, std::complex<float> *c, std::int64_t ldc,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event syrk(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans, std::int64_t n,
-    std::int64_t k, std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
+    cl::sycl::queue &queue, uplo upper_lower, transpose trans, std::int64_t n, std::int64_t k,
+    std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
     std::complex<double> beta, std::complex<double> *c, std::int64_t ldc,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
 ONEMKL_EXPORT cl::sycl::event her2(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
-    std::complex<float> alpha, const std::complex<float> *x, std::int64_t incx,
-    const std::complex<float> *y, std::int64_t incy, std::complex<float> *a, std::int64_t lda,
+    cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, std::complex<float> alpha,
+    const std::complex<float> *x, std::int64_t incx, const std::complex<float> *y,
+    std::int64_t incy, std::complex<float> *a, std::int64_t lda,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event her2(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
-    std::complex<double> alpha, const std::complex<double> *x, std::int64_t incx,
-    const std::complex<double> *y, std::int64_t incy, std::complex<double> *a, std::int64_t lda,
+    cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, std::complex<double> alpha,
+    const std::complex<double> *x, std::int64_t incx, const std::complex<double> *y,
+    std::int64_t incy, std::complex<double> *a, std::int64_t lda,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
 ONEMKL_EXPORT cl::sycl::event hbmv(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, std::int64_t k,
+    cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, std::int64_t k,
     std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
     const std::complex<float> *x, std::int64_t incx, std::complex<float> beta,
     std::complex<float> *y, std::int64_t incy,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event hbmv(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, std::int64_t k,
+    cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, std::int64_t k,
     std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
     const std::complex<double> *x, std::int64_t incx, std::complex<double> beta,
     std::complex<double> *y, std::int64_t incy,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event rot(char *libname, cl::sycl::queue &queue, std::int64_t n,
-                                  std::complex<float> *x, std::int64_t incx, std::complex<float> *y,
-                                  std::int64_t incy, float c, float s,
+ONEMKL_EXPORT cl::sycl::event rot(cl::sycl::queue &queue, std::int64_t n, std::complex<float> *x,
+                                  std::int64_t incx, std::complex<float> *y, std::int64_t incy,
+                                  float c, float s,
                                   const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event rot(char *libname, cl::sycl::queue &queue, std::int64_t n,
-                                  std::complex<double> *x, std::int64_t incx,
-                                  std::complex<double> *y, std::int64_t incy, double c, double s,
+ONEMKL_EXPORT cl::sycl::event rot(cl::sycl::queue &queue, std::int64_t n, std::complex<double> *x,
+                                  std::int64_t incx, std::complex<double> *y, std::int64_t incy,
+                                  double c, double s,
                                   const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event rot(char *libname, cl::sycl::queue &queue, std::int64_t n, float *x,
+ONEMKL_EXPORT cl::sycl::event rot(cl::sycl::queue &queue, std::int64_t n, float *x,
                                   std::int64_t incx, float *y, std::int64_t incy, float c, float s,
                                   const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event rot(char *libname, cl::sycl::queue &queue, std::int64_t n, double *x,
+ONEMKL_EXPORT cl::sycl::event rot(cl::sycl::queue &queue, std::int64_t n, double *x,
                                   std::int64_t incx, double *y, std::int64_t incy, double c,
                                   double s,
                                   const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
 ONEMKL_EXPORT cl::sycl::event axpy(
-    char *libname, cl::sycl::queue &queue, std::int64_t n, float alpha, const float *x,
-    std::int64_t incx, float *y, std::int64_t incy,
-    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+    cl::sycl::queue &queue, std::int64_t n, float alpha, const float *x, std::int64_t incx,
+    float *y, std::int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event axpy(
-    char *libname, cl::sycl::queue &queue, std::int64_t n, double alpha, const double *x,
-    std::int64_t incx, double *y, std::int64_t incy,
-    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+    cl::sycl::queue &queue, std::int64_t n, double alpha, const double *x, std::int64_t incx,
+    double *y, std::int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event axpy(
-    char *libname, cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
-    const std::complex<float> *x, std::int64_t incx, std::complex<float> *y, std::int64_t incy,
+    cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha, const std::complex<float> *x,
+    std::int64_t incx, std::complex<float> *y, std::int64_t incy,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event axpy(
-    char *libname, cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+    cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
     const std::complex<double> *x, std::int64_t incx, std::complex<double> *y, std::int64_t incy,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
 ONEMKL_EXPORT cl::sycl::event axpy_batch(
-    char *libname, cl::sycl::queue &queue, std::int64_t *n, float *alpha, const float **x,
-    std::int64_t *incx, float **y, std::int64_t *incy, std::int64_t group_count,
-    std::int64_t *group_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+    cl::sycl::queue &queue, std::int64_t *n, float *alpha, const float **x, std::int64_t *incx,
+    float **y, std::int64_t *incy, std::int64_t group_count, std::int64_t *group_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event axpy_batch(
-    char *libname, cl::sycl::queue &queue, std::int64_t *n, double *alpha, const double **x,
-    std::int64_t *incx, double **y, std::int64_t *incy, std::int64_t group_count,
-    std::int64_t *group_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+    cl::sycl::queue &queue, std::int64_t *n, double *alpha, const double **x, std::int64_t *incx,
+    double **y, std::int64_t *incy, std::int64_t group_count, std::int64_t *group_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event axpy_batch(
-    char *libname, cl::sycl::queue &queue, std::int64_t *n, std::complex<float> *alpha,
+    cl::sycl::queue &queue, std::int64_t *n, std::complex<float> *alpha,
     const std::complex<float> **x, std::int64_t *incx, std::complex<float> **y, std::int64_t *incy,
     std::int64_t group_count, std::int64_t *group_size,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event axpy_batch(
-    char *libname, cl::sycl::queue &queue, std::int64_t *n, std::complex<double> *alpha,
+    cl::sycl::queue &queue, std::int64_t *n, std::complex<double> *alpha,
     const std::complex<double> **x, std::int64_t *incx, std::complex<double> **y,
     std::int64_t *incy, std::int64_t group_count, std::int64_t *group_size,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
+ONEMKL_EXPORT cl::sycl::event axpy_batch(
+    cl::sycl::queue &queue, std::int64_t n, float alpha, const float *x, std::int64_t incx,
+    std::int64_t stridex, float *y, std::int64_t incy, std::int64_t stridey,
+    std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event axpy_batch(
+    cl::sycl::queue &queue, std::int64_t n, double alpha, const double *x, std::int64_t incx,
+    std::int64_t stridex, double *y, std::int64_t incy, std::int64_t stridey,
+    std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event axpy_batch(
+    cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha, const std::complex<float> *x,
+    std::int64_t incx, std::int64_t stridex, std::complex<float> *y, std::int64_t incy,
+    std::int64_t stridey, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event axpy_batch(
+    cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+    const std::complex<double> *x, std::int64_t incx, std::int64_t stridex, std::complex<double> *y,
+    std::int64_t incy, std::int64_t stridey, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT cl::sycl::event compact_pack(
+    cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols, const float **a, std::int64_t lda,
+    float *ap, std::int64_t ldap, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event compact_pack(
+    cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols, const double **a,
+    std::int64_t lda, double *ap, std::int64_t ldap, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event compact_pack(
+    cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols, const std::complex<float> **a,
+    std::int64_t lda, std::complex<float> *ap, std::int64_t ldap, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event compact_pack(
+    cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols, const std::complex<double> **a,
+    std::int64_t lda, std::complex<double> *ap, std::int64_t ldap, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT cl::sycl::event compact_unpack(
+    cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols, const float *ap,
+    std::int64_t ldap, float **a, std::int64_t lda, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event compact_unpack(
+    cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols, const double *ap,
+    std::int64_t ldap, double **a, std::int64_t lda, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event compact_unpack(
+    cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols, const std::complex<float> *ap,
+    std::int64_t ldap, std::complex<float> **a, std::int64_t lda, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event compact_unpack(
+    cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols, const std::complex<double> *ap,
+    std::int64_t ldap, std::complex<double> **a, std::int64_t lda, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT cl::sycl::event gemm_compact(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, float alpha, const float *ap, std::int64_t ldap, const float *bp,
+    std::int64_t ldbp, float beta, float *cp, std::int64_t ldcp, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event gemm_compact(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, double alpha, const double *ap, std::int64_t ldap, const double *bp,
+    std::int64_t ldbp, double beta, double *cp, std::int64_t ldcp, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event gemm_compact(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<float> alpha, const std::complex<float> *ap, std::int64_t ldap,
+    const std::complex<float> *bp, std::int64_t ldbp, std::complex<float> beta,
+    std::complex<float> *cp, std::int64_t ldcp, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event gemm_compact(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<double> alpha, const std::complex<double> *ap, std::int64_t ldap,
+    const std::complex<double> *bp, std::int64_t ldbp, std::complex<double> beta,
+    std::complex<double> *cp, std::int64_t ldcp, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT cl::sycl::event trsm_compact(
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+    std::int64_t m, std::int64_t n, float alpha, const float *ap, std::int64_t ldap, float *bp,
+    std::int64_t ldbp, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event trsm_compact(
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+    std::int64_t m, std::int64_t n, double alpha, const double *ap, std::int64_t ldap, double *bp,
+    std::int64_t ldbp, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event trsm_compact(
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+    std::int64_t m, std::int64_t n, std::complex<float> alpha, const std::complex<float> *ap,
+    std::int64_t ldap, std::complex<float> *bp, std::int64_t ldbp, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event trsm_compact(
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+    std::int64_t m, std::int64_t n, std::complex<double> alpha, const std::complex<double> *ap,
+    std::int64_t ldap, std::complex<double> *bp, std::int64_t ldbp, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
 ONEMKL_EXPORT cl::sycl::event gerc(
-    char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
-    std::complex<float> alpha, const std::complex<float> *x, std::int64_t incx,
-    const std::complex<float> *y, std::int64_t incy, std::complex<float> *a, std::int64_t lda,
+    cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::complex<float> alpha,
+    const std::complex<float> *x, std::int64_t incx, const std::complex<float> *y,
+    std::int64_t incy, std::complex<float> *a, std::int64_t lda,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event gerc(
-    char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
-    std::complex<double> alpha, const std::complex<double> *x, std::int64_t incx,
-    const std::complex<double> *y, std::int64_t incy, std::complex<double> *a, std::int64_t lda,
+    cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::complex<double> alpha,
+    const std::complex<double> *x, std::int64_t incx, const std::complex<double> *y,
+    std::int64_t incy, std::complex<double> *a, std::int64_t lda,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
 ONEMKL_EXPORT cl::sycl::event syr2k(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans, std::int64_t n,
-    std::int64_t k, float alpha, const float *a, std::int64_t lda, const float *b, std::int64_t ldb,
-    float beta, float *c, std::int64_t ldc,
-    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+    cl::sycl::queue &queue, uplo upper_lower, transpose trans, std::int64_t n, std::int64_t k,
+    float alpha, const float *a, std::int64_t lda, const float *b, std::int64_t ldb, float beta,
+    float *c, std::int64_t ldc, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event syr2k(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans, std::int64_t n,
-    std::int64_t k, double alpha, const double *a, std::int64_t lda, const double *b,
-    std::int64_t ldb, double beta, double *c, std::int64_t ldc,
-    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+    cl::sycl::queue &queue, uplo upper_lower, transpose trans, std::int64_t n, std::int64_t k,
+    double alpha, const double *a, std::int64_t lda, const double *b, std::int64_t ldb, double beta,
+    double *c, std::int64_t ldc, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event syr2k(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans, std::int64_t n,
-    std::int64_t k, std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+    cl::sycl::queue &queue, uplo upper_lower, transpose trans, std::int64_t n, std::int64_t k,
+    std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
     const std::complex<float> *b, std::int64_t ldb, std::complex<float> beta,
     std::complex<float> *c, std::int64_t ldc,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event syr2k(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans, std::int64_t n,
-    std::int64_t k, std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
+    cl::sycl::queue &queue, uplo upper_lower, transpose trans, std::int64_t n, std::int64_t k,
+    std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
     const std::complex<double> *b, std::int64_t ldb, std::complex<double> beta,
     std::complex<double> *c, std::int64_t ldc,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
 ONEMKL_EXPORT cl::sycl::event gemv(
-    char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
-    float alpha, const float *a, std::int64_t lda, const float *x, std::int64_t incx, float beta,
-    float *y, std::int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, float alpha,
+    const float *a, std::int64_t lda, const float *x, std::int64_t incx, float beta, float *y,
+    std::int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event gemv(
-    char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
-    double alpha, const double *a, std::int64_t lda, const double *x, std::int64_t incx,
-    double beta, double *y, std::int64_t incy,
-    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, double alpha,
+    const double *a, std::int64_t lda, const double *x, std::int64_t incx, double beta, double *y,
+    std::int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event gemv(
-    char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
     std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
     const std::complex<float> *x, std::int64_t incx, std::complex<float> beta,
     std::complex<float> *y, std::int64_t incy,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event gemv(
-    char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
     std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
     const std::complex<double> *x, std::int64_t incx, std::complex<double> beta,
     std::complex<double> *y, std::int64_t incy,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event her(char *libname, cl::sycl::queue &queue, uplo upper_lower,
-                                  std::int64_t n, float alpha, const std::complex<float> *x,
-                                  std::int64_t incx, std::complex<float> *a, std::int64_t lda,
+ONEMKL_EXPORT cl::sycl::event her(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                                  float alpha, const std::complex<float> *x, std::int64_t incx,
+                                  std::complex<float> *a, std::int64_t lda,
                                   const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event her(char *libname, cl::sycl::queue &queue, uplo upper_lower,
-                                  std::int64_t n, double alpha, const std::complex<double> *x,
-                                  std::int64_t incx, std::complex<double> *a, std::int64_t lda,
+ONEMKL_EXPORT cl::sycl::event her(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                                  double alpha, const std::complex<double> *x, std::int64_t incx,
+                                  std::complex<double> *a, std::int64_t lda,
                                   const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event hpr(char *libname, cl::sycl::queue &queue, uplo upper_lower,
-                                  std::int64_t n, float alpha, const std::complex<float> *x,
-                                  std::int64_t incx, std::complex<float> *a,
+ONEMKL_EXPORT cl::sycl::event hpr(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                                  float alpha, const std::complex<float> *x, std::int64_t incx,
+                                  std::complex<float> *a,
                                   const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event hpr(char *libname, cl::sycl::queue &queue, uplo upper_lower,
-                                  std::int64_t n, double alpha, const std::complex<double> *x,
-                                  std::int64_t incx, std::complex<double> *a,
+ONEMKL_EXPORT cl::sycl::event hpr(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                                  double alpha, const std::complex<double> *x, std::int64_t incx,
+                                  std::complex<double> *a,
                                   const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
 ONEMKL_EXPORT cl::sycl::event iamin(
-    char *libname, cl::sycl::queue &queue, std::int64_t n, const float *x, std::int64_t incx,
-    std::int64_t *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+    cl::sycl::queue &queue, std::int64_t n, const float *x, std::int64_t incx, std::int64_t *result,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event iamin(
-    char *libname, cl::sycl::queue &queue, std::int64_t n, const double *x, std::int64_t incx,
+    cl::sycl::queue &queue, std::int64_t n, const double *x, std::int64_t incx,
     std::int64_t *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event iamin(
-    char *libname, cl::sycl::queue &queue, std::int64_t n, const std::complex<float> *x,
-    std::int64_t incx, std::int64_t *result,
-    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+    cl::sycl::queue &queue, std::int64_t n, const std::complex<float> *x, std::int64_t incx,
+    std::int64_t *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event iamin(
-    char *libname, cl::sycl::queue &queue, std::int64_t n, const std::complex<double> *x,
-    std::int64_t incx, std::int64_t *result,
-    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+    cl::sycl::queue &queue, std::int64_t n, const std::complex<double> *x, std::int64_t incx,
+    std::int64_t *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
 ONEMKL_EXPORT cl::sycl::event hpmv(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
-    std::complex<float> alpha, const std::complex<float> *a, const std::complex<float> *x,
-    std::int64_t incx, std::complex<float> beta, std::complex<float> *y, std::int64_t incy,
+    cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, std::complex<float> alpha,
+    const std::complex<float> *a, const std::complex<float> *x, std::int64_t incx,
+    std::complex<float> beta, std::complex<float> *y, std::int64_t incy,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event hpmv(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
-    std::complex<double> alpha, const std::complex<double> *a, const std::complex<double> *x,
-    std::int64_t incx, std::complex<double> beta, std::complex<double> *y, std::int64_t incy,
+    cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, std::complex<double> alpha,
+    const std::complex<double> *a, const std::complex<double> *x, std::int64_t incx,
+    std::complex<double> beta, std::complex<double> *y, std::int64_t incy,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
 ONEMKL_EXPORT cl::sycl::event spmv(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, float alpha,
-    const float *a, const float *x, std::int64_t incx, float beta, float *y, std::int64_t incy,
+    cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, float alpha, const float *a,
+    const float *x, std::int64_t incx, float beta, float *y, std::int64_t incy,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event spmv(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, double alpha,
-    const double *a, const double *x, std::int64_t incx, double beta, double *y, std::int64_t incy,
+    cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, double alpha, const double *a,
+    const double *x, std::int64_t incx, double beta, double *y, std::int64_t incy,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
 ONEMKL_EXPORT cl::sycl::event rotmg(
-    char *libname, cl::sycl::queue &queue, float *d1, float *d2, float *x1, float y1, float *param,
+    cl::sycl::queue &queue, float *d1, float *d2, float *x1, float y1, float *param,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event rotmg(
-    char *libname, cl::sycl::queue &queue, double *d1, double *d2, double *x1, double y1,
-    double *param, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+    cl::sycl::queue &queue, double *d1, double *d2, double *x1, double y1, double *param,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
 ONEMKL_EXPORT cl::sycl::event swap(
-    char *libname, cl::sycl::queue &queue, std::int64_t n, float *x, std::int64_t incx, float *y,
+    cl::sycl::queue &queue, std::int64_t n, float *x, std::int64_t incx, float *y,
     std::int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event swap(
-    char *libname, cl::sycl::queue &queue, std::int64_t n, double *x, std::int64_t incx, double *y,
+    cl::sycl::queue &queue, std::int64_t n, double *x, std::int64_t incx, double *y,
     std::int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event swap(
-    char *libname, cl::sycl::queue &queue, std::int64_t n, std::complex<float> *x,
-    std::int64_t incx, std::complex<float> *y, std::int64_t incy,
+    cl::sycl::queue &queue, std::int64_t n, std::complex<float> *x, std::int64_t incx,
+    std::complex<float> *y, std::int64_t incy,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event swap(
-    char *libname, cl::sycl::queue &queue, std::int64_t n, std::complex<double> *x,
-    std::int64_t incx, std::complex<double> *y, std::int64_t incy,
+    cl::sycl::queue &queue, std::int64_t n, std::complex<double> *x, std::int64_t incx,
+    std::complex<double> *y, std::int64_t incy,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
 ONEMKL_EXPORT cl::sycl::event geru(
-    char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
-    std::complex<float> alpha, const std::complex<float> *x, std::int64_t incx,
-    const std::complex<float> *y, std::int64_t incy, std::complex<float> *a, std::int64_t lda,
+    cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::complex<float> alpha,
+    const std::complex<float> *x, std::int64_t incx, const std::complex<float> *y,
+    std::int64_t incy, std::complex<float> *a, std::int64_t lda,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event geru(
-    char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
-    std::complex<double> alpha, const std::complex<double> *x, std::int64_t incx,
-    const std::complex<double> *y, std::int64_t incy, std::complex<double> *a, std::int64_t lda,
+    cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::complex<double> alpha,
+    const std::complex<double> *x, std::int64_t incx, const std::complex<double> *y,
+    std::int64_t incy, std::complex<double> *a, std::int64_t lda,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
 ONEMKL_EXPORT cl::sycl::event nrm2(
-    char *libname, cl::sycl::queue &queue, std::int64_t n, const std::complex<float> *x,
-    std::int64_t incx, float *result,
-    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event nrm2(
-    char *libname, cl::sycl::queue &queue, std::int64_t n, const std::complex<double> *x,
-    std::int64_t incx, double *result,
-    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event nrm2(
-    char *libname, cl::sycl::queue &queue, std::int64_t n, const float *x, std::int64_t incx,
+    cl::sycl::queue &queue, std::int64_t n, const std::complex<float> *x, std::int64_t incx,
     float *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event nrm2(
-    char *libname, cl::sycl::queue &queue, std::int64_t n, const double *x, std::int64_t incx,
+    cl::sycl::queue &queue, std::int64_t n, const std::complex<double> *x, std::int64_t incx,
     double *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event nrm2(
+    cl::sycl::queue &queue, std::int64_t n, const float *x, std::int64_t incx, float *result,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event nrm2(
+    cl::sycl::queue &queue, std::int64_t n, const double *x, std::int64_t incx, double *result,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event gemmt(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose transa, transpose transb,
-    std::int64_t n, std::int64_t k, float alpha, const float *a, std::int64_t lda, const float *b,
+ONEMKL_EXPORT cl::sycl::event gemm_ext(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, float alpha, const half *a, std::int64_t lda, const half *b, std::int64_t ldb,
+    float beta, float *c, std::int64_t ldc,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT cl::sycl::event gemm_ext(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, float alpha, const bfloat16 *a, std::int64_t lda, const bfloat16 *b,
     std::int64_t ldb, float beta, float *c, std::int64_t ldc,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT cl::sycl::event gemm_ext(
+    cl::sycl::queue &queue, transpose transa, transpose transb, offset offsetc, std::int64_t m,
+    std::int64_t n, std::int64_t k, float alpha, const int8_t *a, std::int64_t lda, int8_t ao,
+    const uint8_t *b, std::int64_t ldb, uint8_t bo, float beta, int32_t *c, std::int64_t ldc,
+    const int32_t *co, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT cl::sycl::event gemmt(
+    cl::sycl::queue &queue, uplo upper_lower, transpose transa, transpose transb, std::int64_t n,
+    std::int64_t k, float alpha, const float *a, std::int64_t lda, const float *b, std::int64_t ldb,
+    float beta, float *c, std::int64_t ldc,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event gemmt(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose transa, transpose transb,
-    std::int64_t n, std::int64_t k, double alpha, const double *a, std::int64_t lda,
-    const double *b, std::int64_t ldb, double beta, double *c, std::int64_t ldc,
+    cl::sycl::queue &queue, uplo upper_lower, transpose transa, transpose transb, std::int64_t n,
+    std::int64_t k, double alpha, const double *a, std::int64_t lda, const double *b,
+    std::int64_t ldb, double beta, double *c, std::int64_t ldc,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event gemmt(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose transa, transpose transb,
-    std::int64_t n, std::int64_t k, std::complex<float> alpha, const std::complex<float> *a,
-    std::int64_t lda, const std::complex<float> *b, std::int64_t ldb, std::complex<float> beta,
+    cl::sycl::queue &queue, uplo upper_lower, transpose transa, transpose transb, std::int64_t n,
+    std::int64_t k, std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+    const std::complex<float> *b, std::int64_t ldb, std::complex<float> beta,
     std::complex<float> *c, std::int64_t ldc,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event gemmt(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose transa, transpose transb,
-    std::int64_t n, std::int64_t k, std::complex<double> alpha, const std::complex<double> *a,
-    std::int64_t lda, const std::complex<double> *b, std::int64_t ldb, std::complex<double> beta,
+    cl::sycl::queue &queue, uplo upper_lower, transpose transa, transpose transb, std::int64_t n,
+    std::int64_t k, std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
+    const std::complex<double> *b, std::int64_t ldb, std::complex<double> beta,
     std::complex<double> *c, std::int64_t ldc,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
 ONEMKL_EXPORT cl::sycl::event gemm(
-    char *libname, cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
-    std::int64_t n, std::int64_t k, float alpha, const float *a, std::int64_t lda, const float *b,
-    std::int64_t ldb, float beta, float *c, std::int64_t ldc,
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, float alpha, const float *a, std::int64_t lda, const float *b, std::int64_t ldb,
+    float beta, float *c, std::int64_t ldc,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event gemm(
-    char *libname, cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
-    std::int64_t n, std::int64_t k, double alpha, const double *a, std::int64_t lda,
-    const double *b, std::int64_t ldb, double beta, double *c, std::int64_t ldc,
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, double alpha, const double *a, std::int64_t lda, const double *b,
+    std::int64_t ldb, double beta, double *c, std::int64_t ldc,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event gemm(
-    char *libname, cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
-    std::int64_t n, std::int64_t k, std::complex<float> alpha, const std::complex<float> *a,
-    std::int64_t lda, const std::complex<float> *b, std::int64_t ldb, std::complex<float> beta,
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+    const std::complex<float> *b, std::int64_t ldb, std::complex<float> beta,
     std::complex<float> *c, std::int64_t ldc,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event gemm(
-    char *libname, cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
-    std::int64_t n, std::int64_t k, std::complex<double> alpha, const std::complex<double> *a,
-    std::int64_t lda, const std::complex<double> *b, std::int64_t ldb, std::complex<double> beta,
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
+    const std::complex<double> *b, std::int64_t ldb, std::complex<double> beta,
     std::complex<double> *c, std::int64_t ldc,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
+ONEMKL_EXPORT cl::sycl::event gemm(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, bfloat16 alpha, const bfloat16 *a, std::int64_t lda, const bfloat16 *b,
+    std::int64_t ldb, bfloat16 beta, bfloat16 *c, std::int64_t ldc,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
 ONEMKL_EXPORT cl::sycl::event syr2(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, float alpha,
-    const float *x, std::int64_t incx, const float *y, std::int64_t incy, float *a,
-    std::int64_t lda, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+    cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, float alpha, const float *x,
+    std::int64_t incx, const float *y, std::int64_t incy, float *a, std::int64_t lda,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event syr2(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, double alpha,
-    const double *x, std::int64_t incx, const double *y, std::int64_t incy, double *a,
-    std::int64_t lda, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+    cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, double alpha, const double *x,
+    std::int64_t incx, const double *y, std::int64_t incy, double *a, std::int64_t lda,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event ger(char *libname, cl::sycl::queue &queue, std::int64_t m,
-                                  std::int64_t n, float alpha, const float *x, std::int64_t incx,
-                                  const float *y, std::int64_t incy, float *a, std::int64_t lda,
+ONEMKL_EXPORT cl::sycl::event ger(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                  float alpha, const float *x, std::int64_t incx, const float *y,
+                                  std::int64_t incy, float *a, std::int64_t lda,
                                   const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event ger(char *libname, cl::sycl::queue &queue, std::int64_t m,
-                                  std::int64_t n, double alpha, const double *x, std::int64_t incx,
-                                  const double *y, std::int64_t incy, double *a, std::int64_t lda,
+ONEMKL_EXPORT cl::sycl::event ger(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                  double alpha, const double *x, std::int64_t incx, const double *y,
+                                  std::int64_t incy, double *a, std::int64_t lda,
                                   const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
 ONEMKL_EXPORT cl::sycl::event trsm(
-    char *libname, cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans,
-    diag unit_diag, std::int64_t m, std::int64_t n, float alpha, const float *a, std::int64_t lda,
-    float *b, std::int64_t ldb, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+    std::int64_t m, std::int64_t n, float alpha, const float *a, std::int64_t lda, float *b,
+    std::int64_t ldb, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event trsm(
-    char *libname, cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans,
-    diag unit_diag, std::int64_t m, std::int64_t n, double alpha, const double *a, std::int64_t lda,
-    double *b, std::int64_t ldb, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+    std::int64_t m, std::int64_t n, double alpha, const double *a, std::int64_t lda, double *b,
+    std::int64_t ldb, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event trsm(
-    char *libname, cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans,
-    diag unit_diag, std::int64_t m, std::int64_t n, std::complex<float> alpha,
-    const std::complex<float> *a, std::int64_t lda, std::complex<float> *b, std::int64_t ldb,
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+    std::int64_t m, std::int64_t n, std::complex<float> alpha, const std::complex<float> *a,
+    std::int64_t lda, std::complex<float> *b, std::int64_t ldb,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event trsm(
-    char *libname, cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans,
-    diag unit_diag, std::int64_t m, std::int64_t n, std::complex<double> alpha,
-    const std::complex<double> *a, std::int64_t lda, std::complex<double> *b, std::int64_t ldb,
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+    std::int64_t m, std::int64_t n, std::complex<double> alpha, const std::complex<double> *a,
+    std::int64_t lda, std::complex<double> *b, std::int64_t ldb,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
 ONEMKL_EXPORT cl::sycl::event dotu(
-    char *libname, cl::sycl::queue &queue, std::int64_t n, const std::complex<float> *x,
-    std::int64_t incx, const std::complex<float> *y, std::int64_t incy, std::complex<float> *result,
+    cl::sycl::queue &queue, std::int64_t n, const std::complex<float> *x, std::int64_t incx,
+    const std::complex<float> *y, std::int64_t incy, std::complex<float> *result,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event dotu(
-    char *libname, cl::sycl::queue &queue, std::int64_t n, const std::complex<double> *x,
-    std::int64_t incx, const std::complex<double> *y, std::int64_t incy,
-    std::complex<double> *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+    cl::sycl::queue &queue, std::int64_t n, const std::complex<double> *x, std::int64_t incx,
+    const std::complex<double> *y, std::int64_t incy, std::complex<double> *result,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
 ONEMKL_EXPORT cl::sycl::event hemm(
-    char *libname, cl::sycl::queue &queue, side left_right, uplo upper_lower, std::int64_t m,
-    std::int64_t n, std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, std::int64_t m, std::int64_t n,
+    std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
     const std::complex<float> *b, std::int64_t ldb, std::complex<float> beta,
     std::complex<float> *c, std::int64_t ldc,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event hemm(
-    char *libname, cl::sycl::queue &queue, side left_right, uplo upper_lower, std::int64_t m,
-    std::int64_t n, std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, std::int64_t m, std::int64_t n,
+    std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
     const std::complex<double> *b, std::int64_t ldb, std::complex<double> beta,
     std::complex<double> *c, std::int64_t ldc,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
 ONEMKL_EXPORT cl::sycl::event hpr2(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
-    std::complex<float> alpha, const std::complex<float> *x, std::int64_t incx,
-    const std::complex<float> *y, std::int64_t incy, std::complex<float> *a,
+    cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, std::complex<float> alpha,
+    const std::complex<float> *x, std::int64_t incx, const std::complex<float> *y,
+    std::int64_t incy, std::complex<float> *a,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event hpr2(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
-    std::complex<double> alpha, const std::complex<double> *x, std::int64_t incx,
-    const std::complex<double> *y, std::int64_t incy, std::complex<double> *a,
+    cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, std::complex<double> alpha,
+    const std::complex<double> *x, std::int64_t incx, const std::complex<double> *y,
+    std::int64_t incy, std::complex<double> *a,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
 ONEMKL_EXPORT cl::sycl::event gbmv(
-    char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
-    std::int64_t kl, std::int64_t ku, float alpha, const float *a, std::int64_t lda, const float *x,
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, std::int64_t kl,
+    std::int64_t ku, float alpha, const float *a, std::int64_t lda, const float *x,
     std::int64_t incx, float beta, float *y, std::int64_t incy,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event gbmv(
-    char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
-    std::int64_t kl, std::int64_t ku, double alpha, const double *a, std::int64_t lda,
-    const double *x, std::int64_t incx, double beta, double *y, std::int64_t incy,
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, std::int64_t kl,
+    std::int64_t ku, double alpha, const double *a, std::int64_t lda, const double *x,
+    std::int64_t incx, double beta, double *y, std::int64_t incy,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event gbmv(
-    char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
-    std::int64_t kl, std::int64_t ku, std::complex<float> alpha, const std::complex<float> *a,
-    std::int64_t lda, const std::complex<float> *x, std::int64_t incx, std::complex<float> beta,
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, std::int64_t kl,
+    std::int64_t ku, std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+    const std::complex<float> *x, std::int64_t incx, std::complex<float> beta,
     std::complex<float> *y, std::int64_t incy,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event gbmv(
-    char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
-    std::int64_t kl, std::int64_t ku, std::complex<double> alpha, const std::complex<double> *a,
-    std::int64_t lda, const std::complex<double> *x, std::int64_t incx, std::complex<double> beta,
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, std::int64_t kl,
+    std::int64_t ku, std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
+    const std::complex<double> *x, std::int64_t incx, std::complex<double> beta,
     std::complex<double> *y, std::int64_t incy,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
 ONEMKL_EXPORT cl::sycl::event tbmv(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
-    std::int64_t n, std::int64_t k, const float *a, std::int64_t lda, float *x, std::int64_t incx,
+    cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+    std::int64_t k, const float *a, std::int64_t lda, float *x, std::int64_t incx,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event tbmv(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
-    std::int64_t n, std::int64_t k, const double *a, std::int64_t lda, double *x, std::int64_t incx,
+    cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+    std::int64_t k, const double *a, std::int64_t lda, double *x, std::int64_t incx,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event tbmv(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
-    std::int64_t n, std::int64_t k, const std::complex<float> *a, std::int64_t lda,
-    std::complex<float> *x, std::int64_t incx,
-    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+    cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+    std::int64_t k, const std::complex<float> *a, std::int64_t lda, std::complex<float> *x,
+    std::int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event tbmv(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
-    std::int64_t n, std::int64_t k, const std::complex<double> *a, std::int64_t lda,
-    std::complex<double> *x, std::int64_t incx,
-    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+    cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+    std::int64_t k, const std::complex<double> *a, std::int64_t lda, std::complex<double> *x,
+    std::int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
 ONEMKL_EXPORT cl::sycl::event symm(
-    char *libname, cl::sycl::queue &queue, side left_right, uplo upper_lower, std::int64_t m,
-    std::int64_t n, float alpha, const float *a, std::int64_t lda, const float *b, std::int64_t ldb,
-    float beta, float *c, std::int64_t ldc,
-    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, std::int64_t m, std::int64_t n,
+    float alpha, const float *a, std::int64_t lda, const float *b, std::int64_t ldb, float beta,
+    float *c, std::int64_t ldc, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event symm(
-    char *libname, cl::sycl::queue &queue, side left_right, uplo upper_lower, std::int64_t m,
-    std::int64_t n, double alpha, const double *a, std::int64_t lda, const double *b,
-    std::int64_t ldb, double beta, double *c, std::int64_t ldc,
-    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, std::int64_t m, std::int64_t n,
+    double alpha, const double *a, std::int64_t lda, const double *b, std::int64_t ldb, double beta,
+    double *c, std::int64_t ldc, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event symm(
-    char *libname, cl::sycl::queue &queue, side left_right, uplo upper_lower, std::int64_t m,
-    std::int64_t n, std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, std::int64_t m, std::int64_t n,
+    std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
     const std::complex<float> *b, std::int64_t ldb, std::complex<float> beta,
     std::complex<float> *c, std::int64_t ldc,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event symm(
-    char *libname, cl::sycl::queue &queue, side left_right, uplo upper_lower, std::int64_t m,
-    std::int64_t n, std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, std::int64_t m, std::int64_t n,
+    std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
     const std::complex<double> *b, std::int64_t ldb, std::complex<double> beta,
     std::complex<double> *c, std::int64_t ldc,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
 ONEMKL_EXPORT cl::sycl::event dotc(
-    char *libname, cl::sycl::queue &queue, std::int64_t n, const std::complex<float> *x,
-    std::int64_t incx, const std::complex<float> *y, std::int64_t incy, std::complex<float> *result,
+    cl::sycl::queue &queue, std::int64_t n, const std::complex<float> *x, std::int64_t incx,
+    const std::complex<float> *y, std::int64_t incy, std::complex<float> *result,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event dotc(
-    char *libname, cl::sycl::queue &queue, std::int64_t n, const std::complex<double> *x,
-    std::int64_t incx, const std::complex<double> *y, std::int64_t incy,
-    std::complex<double> *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+    cl::sycl::queue &queue, std::int64_t n, const std::complex<double> *x, std::int64_t incx,
+    const std::complex<double> *y, std::int64_t incy, std::complex<double> *result,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event syr(char *libname, cl::sycl::queue &queue, uplo upper_lower,
-                                  std::int64_t n, float alpha, const float *x, std::int64_t incx,
-                                  float *a, std::int64_t lda,
+ONEMKL_EXPORT cl::sycl::event syr(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                                  float alpha, const float *x, std::int64_t incx, float *a,
+                                  std::int64_t lda,
                                   const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event syr(char *libname, cl::sycl::queue &queue, uplo upper_lower,
-                                  std::int64_t n, double alpha, const double *x, std::int64_t incx,
-                                  double *a, std::int64_t lda,
+ONEMKL_EXPORT cl::sycl::event syr(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                                  double alpha, const double *x, std::int64_t incx, double *a,
+                                  std::int64_t lda,
                                   const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
 ONEMKL_EXPORT cl::sycl::event trmm(
-    char *libname, cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans,
-    diag unit_diag, std::int64_t m, std::int64_t n, float alpha, const float *a, std::int64_t lda,
-    float *b, std::int64_t ldb, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+    std::int64_t m, std::int64_t n, float alpha, const float *a, std::int64_t lda, float *b,
+    std::int64_t ldb, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event trmm(
-    char *libname, cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans,
-    diag unit_diag, std::int64_t m, std::int64_t n, double alpha, const double *a, std::int64_t lda,
-    double *b, std::int64_t ldb, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+    std::int64_t m, std::int64_t n, double alpha, const double *a, std::int64_t lda, double *b,
+    std::int64_t ldb, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event trmm(
-    char *libname, cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans,
-    diag unit_diag, std::int64_t m, std::int64_t n, std::complex<float> alpha,
-    const std::complex<float> *a, std::int64_t lda, std::complex<float> *b, std::int64_t ldb,
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+    std::int64_t m, std::int64_t n, std::complex<float> alpha, const std::complex<float> *a,
+    std::int64_t lda, std::complex<float> *b, std::int64_t ldb,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event trmm(
-    char *libname, cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans,
-    diag unit_diag, std::int64_t m, std::int64_t n, std::complex<double> alpha,
-    const std::complex<double> *a, std::int64_t lda, std::complex<double> *b, std::int64_t ldb,
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+    std::int64_t m, std::int64_t n, std::complex<double> alpha, const std::complex<double> *a,
+    std::int64_t lda, std::complex<double> *b, std::int64_t ldb,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
 ONEMKL_EXPORT cl::sycl::event symv(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, float alpha,
-    const float *a, std::int64_t lda, const float *x, std::int64_t incx, float beta, float *y,
-    std::int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+    cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, float alpha, const float *a,
+    std::int64_t lda, const float *x, std::int64_t incx, float beta, float *y, std::int64_t incy,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event symv(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, double alpha,
-    const double *a, std::int64_t lda, const double *x, std::int64_t incx, double beta, double *y,
-    std::int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+    cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, double alpha, const double *a,
+    std::int64_t lda, const double *x, std::int64_t incx, double beta, double *y, std::int64_t incy,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
 ONEMKL_EXPORT cl::sycl::event tpsv(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
-    std::int64_t n, const float *a, float *x, std::int64_t incx,
+    cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+    const float *a, float *x, std::int64_t incx,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event tpsv(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
-    std::int64_t n, const double *a, double *x, std::int64_t incx,
+    cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+    const double *a, double *x, std::int64_t incx,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event tpsv(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
-    std::int64_t n, const std::complex<float> *a, std::complex<float> *x, std::int64_t incx,
+    cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+    const std::complex<float> *a, std::complex<float> *x, std::int64_t incx,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event tpsv(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
-    std::int64_t n, const std::complex<double> *a, std::complex<double> *x, std::int64_t incx,
+    cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+    const std::complex<double> *a, std::complex<double> *x, std::int64_t incx,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
 ONEMKL_EXPORT cl::sycl::event trsv(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
-    std::int64_t n, const float *a, std::int64_t lda, float *x, std::int64_t incx,
+    cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+    const float *a, std::int64_t lda, float *x, std::int64_t incx,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event trsv(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
-    std::int64_t n, const double *a, std::int64_t lda, double *x, std::int64_t incx,
+    cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+    const double *a, std::int64_t lda, double *x, std::int64_t incx,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event trsv(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
-    std::int64_t n, const std::complex<float> *a, std::int64_t lda, std::complex<float> *x,
-    std::int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+    cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+    const std::complex<float> *a, std::int64_t lda, std::complex<float> *x, std::int64_t incx,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event trsv(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
-    std::int64_t n, const std::complex<double> *a, std::int64_t lda, std::complex<double> *x,
-    std::int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+    cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+    const std::complex<double> *a, std::int64_t lda, std::complex<double> *x, std::int64_t incx,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
 ONEMKL_EXPORT cl::sycl::event copy(
-    char *libname, cl::sycl::queue &queue, std::int64_t n, const float *x, std::int64_t incx,
-    float *y, std::int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+    cl::sycl::queue &queue, std::int64_t n, const float *x, std::int64_t incx, float *y,
+    std::int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event copy(
-    char *libname, cl::sycl::queue &queue, std::int64_t n, const double *x, std::int64_t incx,
-    double *y, std::int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+    cl::sycl::queue &queue, std::int64_t n, const double *x, std::int64_t incx, double *y,
+    std::int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event copy(
-    char *libname, cl::sycl::queue &queue, std::int64_t n, const std::complex<float> *x,
-    std::int64_t incx, std::complex<float> *y, std::int64_t incy,
+    cl::sycl::queue &queue, std::int64_t n, const std::complex<float> *x, std::int64_t incx,
+    std::complex<float> *y, std::int64_t incy,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event copy(
-    char *libname, cl::sycl::queue &queue, std::int64_t n, const std::complex<double> *x,
-    std::int64_t incx, std::complex<double> *y, std::int64_t incy,
+    cl::sycl::queue &queue, std::int64_t n, const std::complex<double> *x, std::int64_t incx,
+    std::complex<double> *y, std::int64_t incy,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
 ONEMKL_EXPORT cl::sycl::event hemv(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
-    std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
-    const std::complex<float> *x, std::int64_t incx, std::complex<float> beta,
-    std::complex<float> *y, std::int64_t incy,
+    cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, std::complex<float> alpha,
+    const std::complex<float> *a, std::int64_t lda, const std::complex<float> *x, std::int64_t incx,
+    std::complex<float> beta, std::complex<float> *y, std::int64_t incy,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event hemv(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
-    std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
-    const std::complex<double> *x, std::int64_t incx, std::complex<double> beta,
-    std::complex<double> *y, std::int64_t incy,
+    cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, std::complex<double> alpha,
+    const std::complex<double> *a, std::int64_t lda, const std::complex<double> *x,
+    std::int64_t incx, std::complex<double> beta, std::complex<double> *y, std::int64_t incy,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
 ONEMKL_EXPORT cl::sycl::event iamax(
-    char *libname, cl::sycl::queue &queue, std::int64_t n, const float *x, std::int64_t incx,
-    std::int64_t *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+    cl::sycl::queue &queue, std::int64_t n, const float *x, std::int64_t incx, std::int64_t *result,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event iamax(
-    char *libname, cl::sycl::queue &queue, std::int64_t n, const double *x, std::int64_t incx,
+    cl::sycl::queue &queue, std::int64_t n, const double *x, std::int64_t incx,
     std::int64_t *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event iamax(
-    char *libname, cl::sycl::queue &queue, std::int64_t n, const std::complex<float> *x,
-    std::int64_t incx, std::int64_t *result,
-    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+    cl::sycl::queue &queue, std::int64_t n, const std::complex<float> *x, std::int64_t incx,
+    std::int64_t *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event iamax(
-    char *libname, cl::sycl::queue &queue, std::int64_t n, const std::complex<double> *x,
-    std::int64_t incx, std::int64_t *result,
-    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+    cl::sycl::queue &queue, std::int64_t n, const std::complex<double> *x, std::int64_t incx,
+    std::int64_t *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
 ONEMKL_EXPORT cl::sycl::event sbmv(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, std::int64_t k,
-    float alpha, const float *a, std::int64_t lda, const float *x, std::int64_t incx, float beta,
-    float *y, std::int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+    cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, std::int64_t k, float alpha,
+    const float *a, std::int64_t lda, const float *x, std::int64_t incx, float beta, float *y,
+    std::int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event sbmv(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, std::int64_t k,
-    double alpha, const double *a, std::int64_t lda, const double *x, std::int64_t incx,
-    double beta, double *y, std::int64_t incy,
-    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+    cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, std::int64_t k, double alpha,
+    const double *a, std::int64_t lda, const double *x, std::int64_t incx, double beta, double *y,
+    std::int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
 ONEMKL_EXPORT cl::sycl::event asum(
-    char *libname, cl::sycl::queue &queue, std::int64_t n, const std::complex<float> *x,
-    std::int64_t incx, float *result,
-    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event asum(
-    char *libname, cl::sycl::queue &queue, std::int64_t n, const std::complex<double> *x,
-    std::int64_t incx, double *result,
-    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event asum(
-    char *libname, cl::sycl::queue &queue, std::int64_t n, const float *x, std::int64_t incx,
+    cl::sycl::queue &queue, std::int64_t n, const std::complex<float> *x, std::int64_t incx,
     float *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event asum(
-    char *libname, cl::sycl::queue &queue, std::int64_t n, const double *x, std::int64_t incx,
+    cl::sycl::queue &queue, std::int64_t n, const std::complex<double> *x, std::int64_t incx,
     double *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event asum(
+    cl::sycl::queue &queue, std::int64_t n, const float *x, std::int64_t incx, float *result,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event asum(
+    cl::sycl::queue &queue, std::int64_t n, const double *x, std::int64_t incx, double *result,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
 ONEMKL_EXPORT cl::sycl::event tbsv(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
-    std::int64_t n, std::int64_t k, const float *a, std::int64_t lda, float *x, std::int64_t incx,
+    cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+    std::int64_t k, const float *a, std::int64_t lda, float *x, std::int64_t incx,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event tbsv(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
-    std::int64_t n, std::int64_t k, const double *a, std::int64_t lda, double *x, std::int64_t incx,
+    cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+    std::int64_t k, const double *a, std::int64_t lda, double *x, std::int64_t incx,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event tbsv(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
-    std::int64_t n, std::int64_t k, const std::complex<float> *a, std::int64_t lda,
-    std::complex<float> *x, std::int64_t incx,
-    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+    cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+    std::int64_t k, const std::complex<float> *a, std::int64_t lda, std::complex<float> *x,
+    std::int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event tbsv(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
-    std::int64_t n, std::int64_t k, const std::complex<double> *a, std::int64_t lda,
-    std::complex<double> *x, std::int64_t incx,
-    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+    cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+    std::int64_t k, const std::complex<double> *a, std::int64_t lda, std::complex<double> *x,
+    std::int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
 ONEMKL_EXPORT cl::sycl::event spr2(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, float alpha,
-    const float *x, std::int64_t incx, const float *y, std::int64_t incy, float *a,
+    cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, float alpha, const float *x,
+    std::int64_t incx, const float *y, std::int64_t incy, float *a,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event spr2(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, double alpha,
-    const double *x, std::int64_t incx, const double *y, std::int64_t incy, double *a,
+    cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, double alpha, const double *x,
+    std::int64_t incx, const double *y, std::int64_t incy, double *a,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
 ONEMKL_EXPORT cl::sycl::event rotm(
-    char *libname, cl::sycl::queue &queue, std::int64_t n, float *x, std::int64_t incx, float *y,
+    cl::sycl::queue &queue, std::int64_t n, float *x, std::int64_t incx, float *y,
     std::int64_t incy, float *param,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event rotm(
-    char *libname, cl::sycl::queue &queue, std::int64_t n, double *x, std::int64_t incx, double *y,
+    cl::sycl::queue &queue, std::int64_t n, double *x, std::int64_t incx, double *y,
     std::int64_t incy, double *param,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event dot(char *libname, cl::sycl::queue &queue, std::int64_t n,
-                                  const float *x, std::int64_t incx, const float *y,
-                                  std::int64_t incy, float *result,
+ONEMKL_EXPORT cl::sycl::event dot(cl::sycl::queue &queue, std::int64_t n, const float *x,
+                                  std::int64_t incx, const float *y, std::int64_t incy,
+                                  float *result,
                                   const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event dot(char *libname, cl::sycl::queue &queue, std::int64_t n,
-                                  const double *x, std::int64_t incx, const double *y,
-                                  std::int64_t incy, double *result,
+ONEMKL_EXPORT cl::sycl::event dot(cl::sycl::queue &queue, std::int64_t n, const double *x,
+                                  std::int64_t incx, const double *y, std::int64_t incy,
+                                  double *result,
                                   const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event dot(char *libname, cl::sycl::queue &queue, std::int64_t n,
-                                  const float *x, std::int64_t incx, const float *y,
-                                  std::int64_t incy, double *result,
+ONEMKL_EXPORT cl::sycl::event dot(cl::sycl::queue &queue, std::int64_t n, const float *x,
+                                  std::int64_t incx, const float *y, std::int64_t incy,
+                                  double *result,
                                   const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
 ONEMKL_EXPORT cl::sycl::event sdsdot(
-    char *libname, cl::sycl::queue &queue, std::int64_t n, float sb, const float *x,
-    std::int64_t incx, const float *y, std::int64_t incy, float *result,
+    cl::sycl::queue &queue, std::int64_t n, float sb, const float *x, std::int64_t incx,
+    const float *y, std::int64_t incy, float *result,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
 ONEMKL_EXPORT cl::sycl::event her2k(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans, std::int64_t n,
-    std::int64_t k, std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+    cl::sycl::queue &queue, uplo upper_lower, transpose trans, std::int64_t n, std::int64_t k,
+    std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
     const std::complex<float> *b, std::int64_t ldb, float beta, std::complex<float> *c,
     std::int64_t ldc, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event her2k(
-    char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans, std::int64_t n,
-    std::int64_t k, std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
+    cl::sycl::queue &queue, uplo upper_lower, transpose trans, std::int64_t n, std::int64_t k,
+    std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
     const std::complex<double> *b, std::int64_t ldb, double beta, std::complex<double> *c,
     std::int64_t ldc, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
 ONEMKL_EXPORT cl::sycl::event rotg(
-    char *libname, cl::sycl::queue &queue, float *a, float *b, float *c, float *s,
+    cl::sycl::queue &queue, float *a, float *b, float *c, float *s,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event rotg(
-    char *libname, cl::sycl::queue &queue, double *a, double *b, double *c, double *s,
+    cl::sycl::queue &queue, double *a, double *b, double *c, double *s,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event rotg(
-    char *libname, cl::sycl::queue &queue, std::complex<float> *a, std::complex<float> *b, float *c,
+    cl::sycl::queue &queue, std::complex<float> *a, std::complex<float> *b, float *c,
     std::complex<float> *s, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event rotg(
-    char *libname, cl::sycl::queue &queue, std::complex<double> *a, std::complex<double> *b,
-    double *c, std::complex<double> *s,
-    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+    cl::sycl::queue &queue, std::complex<double> *a, std::complex<double> *b, double *c,
+    std::complex<double> *s, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
 } //namespace detail
 } //namespace blas
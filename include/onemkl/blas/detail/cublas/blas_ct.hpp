@@ -418,6 +418,56 @@ void axpy<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int6
     axpy_postcondition(queue, n, alpha, x, incx, y, incy);
 }
 
+template <>
+void axpy_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                                     float alpha, cl::sycl::buffer<float, 1> &x,
+                                                     std::int64_t incx, std::int64_t stridex,
+                                                     cl::sycl::buffer<float, 1> &y,
+                                                     std::int64_t incy, std::int64_t stridey,
+                                                     std::int64_t batch_size) {
+    axpy_batch_precondition(queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
+    onemkl::cublas::axpy_batch(queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
+    axpy_batch_postcondition(queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
+}
+
+template <>
+void axpy_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                                     double alpha, cl::sycl::buffer<double, 1> &x,
+                                                     std::int64_t incx, std::int64_t stridex,
+                                                     cl::sycl::buffer<double, 1> &y,
+                                                     std::int64_t incy, std::int64_t stridey,
+                                                     std::int64_t batch_size) {
+    axpy_batch_precondition(queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
+    onemkl::cublas::axpy_batch(queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
+    axpy_batch_postcondition(queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
+}
+
+template <>
+void axpy_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                                     std::complex<float> alpha,
+                                                     cl::sycl::buffer<std::complex<float>, 1> &x,
+                                                     std::int64_t incx, std::int64_t stridex,
+                                                     cl::sycl::buffer<std::complex<float>, 1> &y,
+                                                     std::int64_t incy, std::int64_t stridey,
+                                                     std::int64_t batch_size) {
+    axpy_batch_precondition(queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
+    onemkl::cublas::axpy_batch(queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
+    axpy_batch_postcondition(queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
+}
+
+template <>
+void axpy_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                                     std::complex<double> alpha,
+                                                     cl::sycl::buffer<std::complex<double>, 1> &x,
+                                                     std::int64_t incx, std::int64_t stridex,
+                                                     cl::sycl::buffer<std::complex<double>, 1> &y,
+                                                     std::int64_t incy, std::int64_t stridey,
+                                                     std::int64_t batch_size) {
+    axpy_batch_precondition(queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
+    onemkl::cublas::axpy_batch(queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
+    axpy_batch_postcondition(queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
+}
+
 template <>
 void gerc<library::cublas, backend::nvidiagpu>(
     cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::complex<float> alpha,
@@ -715,6 +765,21 @@ void gemm_ext<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, trans
     gemm_ext_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
+template <>
+void gemm_ext<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, transpose transa,
+                                                   transpose transb, std::int64_t m, std::int64_t n,
+                                                   std::int64_t k, float alpha,
+                                                   cl::sycl::buffer<bfloat16, 1> &a,
+                                                   std::int64_t lda,
+                                                   cl::sycl::buffer<bfloat16, 1> &b,
+                                                   std::int64_t ldb, float beta,
+                                                   cl::sycl::buffer<float, 1> &c,
+                                                   std::int64_t ldc) {
+    gemm_ext_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    onemkl::cublas::gemm_ext(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    gemm_ext_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
 template <>
 void gemm_ext<library::cublas, backend::nvidiagpu>(
     cl::sycl::queue &queue, transpose transa, transpose transb, offset offsetc, std::int64_t m,
@@ -951,6 +1016,19 @@ void gemm<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, transpose
     gemm_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
+template <>
+void gemm<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, transpose transa,
+                                               transpose transb, std::int64_t m, std::int64_t n,
+                                               std::int64_t k, bfloat16 alpha,
+                                               cl::sycl::buffer<bfloat16, 1> &a, std::int64_t lda,
+                                               cl::sycl::buffer<bfloat16, 1> &b, std::int64_t ldb,
+                                               bfloat16 beta, cl::sycl::buffer<bfloat16, 1> &c,
+                                               std::int64_t ldc) {
+    gemm_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    onemkl::cublas::gemm(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    gemm_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
 template <>
 void herk<library::cublas, backend::nvidiagpu>(
     cl::sycl::queue &queue, uplo upper_lower, transpose trans, std::int64_t n, std::int64_t k,
@@ -2439,6 +2517,282 @@ cl::sycl::event axpy_batch<library::cublas, backend::nvidiagpu>(
     return done;
 }
 
+template <>
+cl::sycl::event axpy_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, std::int64_t n, float alpha, const float *x, std::int64_t incx,
+    std::int64_t stridex, float *y, std::int64_t incy, std::int64_t stridey,
+    std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    axpy_batch_precondition(queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size,
+                            dependencies);
+    auto done = onemkl::cublas::axpy_batch(queue, n, alpha, x, incx, stridex, y, incy, stridey,
+                                           batch_size, dependencies);
+    axpy_batch_postcondition(queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size,
+                             dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event axpy_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, std::int64_t n, double alpha, const double *x, std::int64_t incx,
+    std::int64_t stridex, double *y, std::int64_t incy, std::int64_t stridey,
+    std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    axpy_batch_precondition(queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size,
+                            dependencies);
+    auto done = onemkl::cublas::axpy_batch(queue, n, alpha, x, incx, stridex, y, incy, stridey,
+                                           batch_size, dependencies);
+    axpy_batch_postcondition(queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size,
+                             dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event axpy_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha, const std::complex<float> *x,
+    std::int64_t incx, std::int64_t stridex, std::complex<float> *y, std::int64_t incy,
+    std::int64_t stridey, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    axpy_batch_precondition(queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size,
+                            dependencies);
+    auto done = onemkl::cublas::axpy_batch(queue, n, alpha, x, incx, stridex, y, incy, stridey,
+                                           batch_size, dependencies);
+    axpy_batch_postcondition(queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size,
+                             dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event axpy_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+    const std::complex<double> *x, std::int64_t incx, std::int64_t stridex, std::complex<double> *y,
+    std::int64_t incy, std::int64_t stridey, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    axpy_batch_precondition(queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size,
+                            dependencies);
+    auto done = onemkl::cublas::axpy_batch(queue, n, alpha, x, incx, stridex, y, incy, stridey,
+                                           batch_size, dependencies);
+    axpy_batch_postcondition(queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size,
+                             dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event compact_pack<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols, const float **a, std::int64_t lda,
+    float *ap, std::int64_t ldap, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    compact_pack_precondition(queue, rows, cols, a, lda, ap, ldap, batch_size, dependencies);
+    auto done = onemkl::cublas::compact_pack(queue, rows, cols, a, lda, ap, ldap, batch_size,
+                                             dependencies);
+    compact_pack_postcondition(queue, rows, cols, a, lda, ap, ldap, batch_size, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event compact_pack<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols, const double **a,
+    std::int64_t lda, double *ap, std::int64_t ldap, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    compact_pack_precondition(queue, rows, cols, a, lda, ap, ldap, batch_size, dependencies);
+    auto done = onemkl::cublas::compact_pack(queue, rows, cols, a, lda, ap, ldap, batch_size,
+                                             dependencies);
+    compact_pack_postcondition(queue, rows, cols, a, lda, ap, ldap, batch_size, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event compact_pack<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols, const std::complex<float> **a,
+    std::int64_t lda, std::complex<float> *ap, std::int64_t ldap, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    compact_pack_precondition(queue, rows, cols, a, lda, ap, ldap, batch_size, dependencies);
+    auto done = onemkl::cublas::compact_pack(queue, rows, cols, a, lda, ap, ldap, batch_size,
+                                             dependencies);
+    compact_pack_postcondition(queue, rows, cols, a, lda, ap, ldap, batch_size, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event compact_pack<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols, const std::complex<double> **a,
+    std::int64_t lda, std::complex<double> *ap, std::int64_t ldap, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    compact_pack_precondition(queue, rows, cols, a, lda, ap, ldap, batch_size, dependencies);
+    auto done = onemkl::cublas::compact_pack(queue, rows, cols, a, lda, ap, ldap, batch_size,
+                                             dependencies);
+    compact_pack_postcondition(queue, rows, cols, a, lda, ap, ldap, batch_size, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event compact_unpack<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols, const float *ap,
+    std::int64_t ldap, float **a, std::int64_t lda, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    compact_unpack_precondition(queue, rows, cols, ap, ldap, a, lda, batch_size, dependencies);
+    auto done = onemkl::cublas::compact_unpack(queue, rows, cols, ap, ldap, a, lda, batch_size,
+                                               dependencies);
+    compact_unpack_postcondition(queue, rows, cols, ap, ldap, a, lda, batch_size, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event compact_unpack<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols, const double *ap,
+    std::int64_t ldap, double **a, std::int64_t lda, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    compact_unpack_precondition(queue, rows, cols, ap, ldap, a, lda, batch_size, dependencies);
+    auto done = onemkl::cublas::compact_unpack(queue, rows, cols, ap, ldap, a, lda, batch_size,
+                                               dependencies);
+    compact_unpack_postcondition(queue, rows, cols, ap, ldap, a, lda, batch_size, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event compact_unpack<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols, const std::complex<float> *ap,
+    std::int64_t ldap, std::complex<float> **a, std::int64_t lda, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    compact_unpack_precondition(queue, rows, cols, ap, ldap, a, lda, batch_size, dependencies);
+    auto done = onemkl::cublas::compact_unpack(queue, rows, cols, ap, ldap, a, lda, batch_size,
+                                               dependencies);
+    compact_unpack_postcondition(queue, rows, cols, ap, ldap, a, lda, batch_size, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event compact_unpack<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols, const std::complex<double> *ap,
+    std::int64_t ldap, std::complex<double> **a, std::int64_t lda, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    compact_unpack_precondition(queue, rows, cols, ap, ldap, a, lda, batch_size, dependencies);
+    auto done = onemkl::cublas::compact_unpack(queue, rows, cols, ap, ldap, a, lda, batch_size,
+                                               dependencies);
+    compact_unpack_postcondition(queue, rows, cols, ap, ldap, a, lda, batch_size, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event gemm_compact<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, float alpha, const float *ap, std::int64_t ldap, const float *bp,
+    std::int64_t ldbp, float beta, float *cp, std::int64_t ldcp, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    gemm_compact_precondition(queue, transa, transb, m, n, k, alpha, ap, ldap, bp, ldbp, beta, cp,
+                              ldcp, batch_size, dependencies);
+    auto done = onemkl::cublas::gemm_compact(queue, transa, transb, m, n, k, alpha, ap, ldap, bp,
+                                             ldbp, beta, cp, ldcp, batch_size, dependencies);
+    gemm_compact_postcondition(queue, transa, transb, m, n, k, alpha, ap, ldap, bp, ldbp, beta, cp,
+                               ldcp, batch_size, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event gemm_compact<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, double alpha, const double *ap, std::int64_t ldap, const double *bp,
+    std::int64_t ldbp, double beta, double *cp, std::int64_t ldcp, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    gemm_compact_precondition(queue, transa, transb, m, n, k, alpha, ap, ldap, bp, ldbp, beta, cp,
+                              ldcp, batch_size, dependencies);
+    auto done = onemkl::cublas::gemm_compact(queue, transa, transb, m, n, k, alpha, ap, ldap, bp,
+                                             ldbp, beta, cp, ldcp, batch_size, dependencies);
+    gemm_compact_postcondition(queue, transa, transb, m, n, k, alpha, ap, ldap, bp, ldbp, beta, cp,
+                               ldcp, batch_size, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event gemm_compact<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<float> alpha, const std::complex<float> *ap, std::int64_t ldap,
+    const std::complex<float> *bp, std::int64_t ldbp, std::complex<float> beta,
+    std::complex<float> *cp, std::int64_t ldcp, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    gemm_compact_precondition(queue, transa, transb, m, n, k, alpha, ap, ldap, bp, ldbp, beta, cp,
+                              ldcp, batch_size, dependencies);
+    auto done = onemkl::cublas::gemm_compact(queue, transa, transb, m, n, k, alpha, ap, ldap, bp,
+                                             ldbp, beta, cp, ldcp, batch_size, dependencies);
+    gemm_compact_postcondition(queue, transa, transb, m, n, k, alpha, ap, ldap, bp, ldbp, beta, cp,
+                               ldcp, batch_size, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event gemm_compact<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<double> alpha, const std::complex<double> *ap, std::int64_t ldap,
+    const std::complex<double> *bp, std::int64_t ldbp, std::complex<double> beta,
+    std::complex<double> *cp, std::int64_t ldcp, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    gemm_compact_precondition(queue, transa, transb, m, n, k, alpha, ap, ldap, bp, ldbp, beta, cp,
+                              ldcp, batch_size, dependencies);
+    auto done = onemkl::cublas::gemm_compact(queue, transa, transb, m, n, k, alpha, ap, ldap, bp,
+                                             ldbp, beta, cp, ldcp, batch_size, dependencies);
+    gemm_compact_postcondition(queue, transa, transb, m, n, k, alpha, ap, ldap, bp, ldbp, beta, cp,
+                               ldcp, batch_size, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event trsm_compact<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+    std::int64_t m, std::int64_t n, float alpha, const float *ap, std::int64_t ldap, float *bp,
+    std::int64_t ldbp, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    trsm_compact_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, ap,
+                              ldap, bp, ldbp, batch_size, dependencies);
+    auto done = onemkl::cublas::trsm_compact(queue, left_right, upper_lower, trans, unit_diag, m, n,
+                                             alpha, ap, ldap, bp, ldbp, batch_size, dependencies);
+    trsm_compact_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, ap,
+                               ldap, bp, ldbp, batch_size, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event trsm_compact<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+    std::int64_t m, std::int64_t n, double alpha, const double *ap, std::int64_t ldap, double *bp,
+    std::int64_t ldbp, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    trsm_compact_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, ap,
+                              ldap, bp, ldbp, batch_size, dependencies);
+    auto done = onemkl::cublas::trsm_compact(queue, left_right, upper_lower, trans, unit_diag, m, n,
+                                             alpha, ap, ldap, bp, ldbp, batch_size, dependencies);
+    trsm_compact_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, ap,
+                               ldap, bp, ldbp, batch_size, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event trsm_compact<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+    std::int64_t m, std::int64_t n, std::complex<float> alpha, const std::complex<float> *ap,
+    std::int64_t ldap, std::complex<float> *bp, std::int64_t ldbp, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    trsm_compact_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, ap,
+                              ldap, bp, ldbp, batch_size, dependencies);
+    auto done = onemkl::cublas::trsm_compact(queue, left_right, upper_lower, trans, unit_diag, m, n,
+                                             alpha, ap, ldap, bp, ldbp, batch_size, dependencies);
+    trsm_compact_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, ap,
+                               ldap, bp, ldbp, batch_size, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event trsm_compact<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+    std::int64_t m, std::int64_t n, std::complex<double> alpha, const std::complex<double> *ap,
+    std::int64_t ldap, std::complex<double> *bp, std::int64_t ldbp, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    trsm_compact_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, ap,
+                              ldap, bp, ldbp, batch_size, dependencies);
+    auto done = onemkl::cublas::trsm_compact(queue, left_right, upper_lower, trans, unit_diag, m, n,
+                                             alpha, ap, ldap, bp, ldbp, batch_size, dependencies);
+    trsm_compact_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, ap,
+                               ldap, bp, ldbp, batch_size, dependencies);
+    return done;
+}
+
 template <>
 cl::sycl::event gerc<library::cublas, backend::nvidiagpu>(
     cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::complex<float> alpha,
@@ -2789,6 +3143,136 @@ cl::sycl::event gemm_batch<library::cublas, backend::nvidiagpu>(
     return done;
 }
 
+template <>
+cl::sycl::event trsm_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, side *left_right, uplo *upper_lower, transpose *trans, diag *unit_diag,
+    std::int64_t *m, std::int64_t *n, float *alpha, const float **a, std::int64_t *lda, float **b,
+    std::int64_t *ldb, std::int64_t group_count, std::int64_t *group_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    trsm_batch_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                            b, ldb, group_count, group_size, dependencies);
+    auto done = onemkl::cublas::trsm_batch(queue, left_right, upper_lower, trans, unit_diag, m, n,
+                                           alpha, a, lda, b, ldb, group_count, group_size,
+                                           dependencies);
+    trsm_batch_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                             b, ldb, group_count, group_size, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event trsm_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, side *left_right, uplo *upper_lower, transpose *trans, diag *unit_diag,
+    std::int64_t *m, std::int64_t *n, double *alpha, const double **a, std::int64_t *lda,
+    double **b, std::int64_t *ldb, std::int64_t group_count, std::int64_t *group_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    trsm_batch_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                            b, ldb, group_count, group_size, dependencies);
+    auto done = onemkl::cublas::trsm_batch(queue, left_right, upper_lower, trans, unit_diag, m, n,
+                                           alpha, a, lda, b, ldb, group_count, group_size,
+                                           dependencies);
+    trsm_batch_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                             b, ldb, group_count, group_size, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event trsm_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, side *left_right, uplo *upper_lower, transpose *trans, diag *unit_diag,
+    std::int64_t *m, std::int64_t *n, std::complex<float> *alpha, const std::complex<float> **a,
+    std::int64_t *lda, std::complex<float> **b, std::int64_t *ldb, std::int64_t group_count,
+    std::int64_t *group_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    trsm_batch_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                            b, ldb, group_count, group_size, dependencies);
+    auto done = onemkl::cublas::trsm_batch(queue, left_right, upper_lower, trans, unit_diag, m, n,
+                                           alpha, a, lda, b, ldb, group_count, group_size,
+                                           dependencies);
+    trsm_batch_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                             b, ldb, group_count, group_size, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event trsm_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, side *left_right, uplo *upper_lower, transpose *trans, diag *unit_diag,
+    std::int64_t *m, std::int64_t *n, std::complex<double> *alpha, const std::complex<double> **a,
+    std::int64_t *lda, std::complex<double> **b, std::int64_t *ldb, std::int64_t group_count,
+    std::int64_t *group_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    trsm_batch_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                            b, ldb, group_count, group_size, dependencies);
+    auto done = onemkl::cublas::trsm_batch(queue, left_right, upper_lower, trans, unit_diag, m, n,
+                                           alpha, a, lda, b, ldb, group_count, group_size,
+                                           dependencies);
+    trsm_batch_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                             b, ldb, group_count, group_size, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event trsm_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+    std::int64_t m, std::int64_t n, float alpha, const float *a, std::int64_t lda,
+    std::int64_t stride_a, float *b, std::int64_t ldb, std::int64_t stride_b,
+    std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    trsm_batch_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                            stride_a, b, ldb, stride_b, batch_size, dependencies);
+    auto done = onemkl::cublas::trsm_batch(queue, left_right, upper_lower, trans, unit_diag, m, n,
+                                           alpha, a, lda, stride_a, b, ldb, stride_b, batch_size,
+                                           dependencies);
+    trsm_batch_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                             stride_a, b, ldb, stride_b, batch_size, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event trsm_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+    std::int64_t m, std::int64_t n, double alpha, const double *a, std::int64_t lda,
+    std::int64_t stride_a, double *b, std::int64_t ldb, std::int64_t stride_b,
+    std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    trsm_batch_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                            stride_a, b, ldb, stride_b, batch_size, dependencies);
+    auto done = onemkl::cublas::trsm_batch(queue, left_right, upper_lower, trans, unit_diag, m, n,
+                                           alpha, a, lda, stride_a, b, ldb, stride_b, batch_size,
+                                           dependencies);
+    trsm_batch_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                             stride_a, b, ldb, stride_b, batch_size, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event trsm_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+    std::int64_t m, std::int64_t n, std::complex<float> alpha, const std::complex<float> *a,
+    std::int64_t lda, std::int64_t stride_a, std::complex<float> *b, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    trsm_batch_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                            stride_a, b, ldb, stride_b, batch_size, dependencies);
+    auto done = onemkl::cublas::trsm_batch(queue, left_right, upper_lower, trans, unit_diag, m, n,
+                                           alpha, a, lda, stride_a, b, ldb, stride_b, batch_size,
+                                           dependencies);
+    trsm_batch_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                             stride_a, b, ldb, stride_b, batch_size, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event trsm_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+    std::int64_t m, std::int64_t n, std::complex<double> alpha, const std::complex<double> *a,
+    std::int64_t lda, std::int64_t stride_a, std::complex<double> *b, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    trsm_batch_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                            stride_a, b, ldb, stride_b, batch_size, dependencies);
+    auto done = onemkl::cublas::trsm_batch(queue, left_right, upper_lower, trans, unit_diag, m, n,
+                                           alpha, a, lda, stride_a, b, ldb, stride_b, batch_size,
+                                           dependencies);
+    trsm_batch_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                             stride_a, b, ldb, stride_b, batch_size, dependencies);
+    return done;
+}
+
 template <>
 cl::sycl::event spmv<library::cublas, backend::nvidiagpu>(
     cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, float alpha, const float *a,
@@ -2981,6 +3465,21 @@ cl::sycl::event gemm<library::cublas, backend::nvidiagpu>(
     return done;
 }
 
+template <>
+cl::sycl::event gemm<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, bfloat16 alpha, const bfloat16 *a, std::int64_t lda, const bfloat16 *b,
+    std::int64_t ldb, bfloat16 beta, bfloat16 *c, std::int64_t ldc,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    gemm_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                      dependencies);
+    auto done = onemkl::cublas::gemm(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c,
+                                     ldc, dependencies);
+    gemm_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                       dependencies);
+    return done;
+}
+
 template <>
 cl::sycl::event herk<library::cublas, backend::nvidiagpu>(
     cl::sycl::queue &queue, uplo upper_lower, transpose trans, std::int64_t n, std::int64_t k,
@@ -3622,6 +4121,51 @@ cl::sycl::event hemv<library::cublas, backend::nvidiagpu>(
     return done;
 }
 
+template <>
+cl::sycl::event gemm_ext<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, float alpha, const half *a, std::int64_t lda, const half *b, std::int64_t ldb,
+    float beta, float *c, std::int64_t ldc,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    gemm_ext_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                          dependencies);
+    auto done = onemkl::cublas::gemm_ext(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb,
+                                         beta, c, ldc, dependencies);
+    gemm_ext_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                           dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event gemm_ext<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, float alpha, const bfloat16 *a, std::int64_t lda, const bfloat16 *b,
+    std::int64_t ldb, float beta, float *c, std::int64_t ldc,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    gemm_ext_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                          dependencies);
+    auto done = onemkl::cublas::gemm_ext(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb,
+                                         beta, c, ldc, dependencies);
+    gemm_ext_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                           dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event gemm_ext<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, transpose transa, transpose transb, offset offsetc, std::int64_t m,
+    std::int64_t n, std::int64_t k, float alpha, const int8_t *a, std::int64_t lda, int8_t ao,
+    const uint8_t *b, std::int64_t ldb, uint8_t bo, float beta, int32_t *c, std::int64_t ldc,
+    const int32_t *co, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    gemm_ext_precondition(queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo,
+                          beta, c, ldc, co, dependencies);
+    auto done = onemkl::cublas::gemm_ext(queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao,
+                                         b, ldb, bo, beta, c, ldc, co, dependencies);
+    gemm_ext_postcondition(queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo,
+                           beta, c, ldc, co, dependencies);
+    return done;
+}
+
 template <>
 cl::sycl::event gemmt<library::cublas, backend::nvidiagpu>(
     cl::sycl::queue &queue, uplo upper_lower, transpose transa, transpose transb, std::int64_t n,
@@ -722,6 +722,91 @@ inline void axpy_postcondition(cl::sycl::queue &queue, std::int64_t n, std::comp
 #endif
 }
 
+inline void axpy_batch_precondition(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                                    cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                    std::int64_t stridex, cl::sycl::buffer<float, 1> &y,
+                                    std::int64_t incy, std::int64_t stridey,
+                                    std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void axpy_batch_postcondition(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                                     cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                     std::int64_t stridex, cl::sycl::buffer<float, 1> &y,
+                                     std::int64_t incy, std::int64_t stridey,
+                                     std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void axpy_batch_precondition(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                                    cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                                    std::int64_t stridex, cl::sycl::buffer<double, 1> &y,
+                                    std::int64_t incy, std::int64_t stridey,
+                                    std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void axpy_batch_postcondition(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                                     cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                                     std::int64_t stridex, cl::sycl::buffer<double, 1> &y,
+                                     std::int64_t incy, std::int64_t stridey,
+                                     std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void axpy_batch_precondition(cl::sycl::queue &queue, std::int64_t n,
+                                    std::complex<float> alpha,
+                                    cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                                    std::int64_t stridex,
+                                    cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
+                                    std::int64_t stridey, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void axpy_batch_postcondition(cl::sycl::queue &queue, std::int64_t n,
+                                     std::complex<float> alpha,
+                                     cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                                     std::int64_t stridex,
+                                     cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
+                                     std::int64_t stridey, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void axpy_batch_precondition(cl::sycl::queue &queue, std::int64_t n,
+                                    std::complex<double> alpha,
+                                    cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                                    std::int64_t stridex,
+                                    cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
+                                    std::int64_t stridey, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void axpy_batch_postcondition(cl::sycl::queue &queue, std::int64_t n,
+                                     std::complex<double> alpha,
+                                     cl::sycl::buffer<std::complex<double>, 1> &x,
+                                     std::int64_t incx, std::int64_t stridex,
+                                     cl::sycl::buffer<std::complex<double>, 1> &y,
+                                     std::int64_t incy, std::int64_t stridey,
+                                     std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
 inline void gerc_precondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
                               std::complex<float> alpha,
                               cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
@@ -1011,6 +1096,26 @@ inline void gemm_ext_postcondition(cl::sycl::queue &queue, transpose transa, tra
 #endif
 }
 
+inline void gemm_ext_precondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                  std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                                  cl::sycl::buffer<bfloat16, 1> &a, std::int64_t lda,
+                                  cl::sycl::buffer<bfloat16, 1> &b, std::int64_t ldb, float beta,
+                                  cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_ext_postcondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                   std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                                   cl::sycl::buffer<bfloat16, 1> &a, std::int64_t lda,
+                                   cl::sycl::buffer<bfloat16, 1> &b, std::int64_t ldb, float beta,
+                                   cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
 inline void gemm_ext_precondition(cl::sycl::queue &queue, transpose transa, transpose transb,
                                   offset offsetc, std::int64_t m, std::int64_t n, std::int64_t k,
                                   float alpha, cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda,
@@ -1679,6 +1784,26 @@ inline void gemm_postcondition(cl::sycl::queue &queue, transpose transa, transpo
 #endif
 }
 
+inline void gemm_precondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                              std::int64_t m, std::int64_t n, std::int64_t k, bfloat16 alpha,
+                              cl::sycl::buffer<bfloat16, 1> &a, std::int64_t lda,
+                              cl::sycl::buffer<bfloat16, 1> &b, std::int64_t ldb, bfloat16 beta,
+                              cl::sycl::buffer<bfloat16, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_postcondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                               std::int64_t m, std::int64_t n, std::int64_t k, bfloat16 alpha,
+                               cl::sycl::buffer<bfloat16, 1> &a, std::int64_t lda,
+                               cl::sycl::buffer<bfloat16, 1> &b, std::int64_t ldb, bfloat16 beta,
+                               cl::sycl::buffer<bfloat16, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
 inline void syr2_precondition(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, float alpha,
                               cl::sycl::buffer<float, 1> &x, std::int64_t incx,
                               cl::sycl::buffer<float, 1> &y, std::int64_t incy,
@@ -3697,6 +3822,193 @@ inline void gemm_batch_postcondition(
 #endif
 }
 
+inline void trsm_batch_precondition(cl::sycl::queue &queue, side *left_right, uplo *upper_lower,
+                                    transpose *trans, diag *unit_diag, std::int64_t *m,
+                                    std::int64_t *n, float *alpha, const float **a,
+                                    std::int64_t *lda, float **b, std::int64_t *ldb,
+                                    std::int64_t group_count, std::int64_t *group_size,
+                                    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void trsm_batch_postcondition(cl::sycl::queue &queue, side *left_right, uplo *upper_lower,
+                                     transpose *trans, diag *unit_diag, std::int64_t *m,
+                                     std::int64_t *n, float *alpha, const float **a,
+                                     std::int64_t *lda, float **b, std::int64_t *ldb,
+                                     std::int64_t group_count, std::int64_t *group_size,
+                                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void trsm_batch_precondition(cl::sycl::queue &queue, side *left_right, uplo *upper_lower,
+                                    transpose *trans, diag *unit_diag, std::int64_t *m,
+                                    std::int64_t *n, double *alpha, const double **a,
+                                    std::int64_t *lda, double **b, std::int64_t *ldb,
+                                    std::int64_t group_count, std::int64_t *group_size,
+                                    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void trsm_batch_postcondition(cl::sycl::queue &queue, side *left_right, uplo *upper_lower,
+                                     transpose *trans, diag *unit_diag, std::int64_t *m,
+                                     std::int64_t *n, double *alpha, const double **a,
+                                     std::int64_t *lda, double **b, std::int64_t *ldb,
+                                     std::int64_t group_count, std::int64_t *group_size,
+                                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void trsm_batch_precondition(cl::sycl::queue &queue, side *left_right, uplo *upper_lower,
+                                    transpose *trans, diag *unit_diag, std::int64_t *m,
+                                    std::int64_t *n, std::complex<float> *alpha,
+                                    const std::complex<float> **a, std::int64_t *lda,
+                                    std::complex<float> **b, std::int64_t *ldb,
+                                    std::int64_t group_count, std::int64_t *group_size,
+                                    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void trsm_batch_postcondition(cl::sycl::queue &queue, side *left_right, uplo *upper_lower,
+                                     transpose *trans, diag *unit_diag, std::int64_t *m,
+                                     std::int64_t *n, std::complex<float> *alpha,
+                                     const std::complex<float> **a, std::int64_t *lda,
+                                     std::complex<float> **b, std::int64_t *ldb,
+                                     std::int64_t group_count, std::int64_t *group_size,
+                                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void trsm_batch_precondition(cl::sycl::queue &queue, side *left_right, uplo *upper_lower,
+                                    transpose *trans, diag *unit_diag, std::int64_t *m,
+                                    std::int64_t *n, std::complex<double> *alpha,
+                                    const std::complex<double> **a, std::int64_t *lda,
+                                    std::complex<double> **b, std::int64_t *ldb,
+                                    std::int64_t group_count, std::int64_t *group_size,
+                                    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void trsm_batch_postcondition(cl::sycl::queue &queue, side *left_right, uplo *upper_lower,
+                                     transpose *trans, diag *unit_diag, std::int64_t *m,
+                                     std::int64_t *n, std::complex<double> *alpha,
+                                     const std::complex<double> **a, std::int64_t *lda,
+                                     std::complex<double> **b, std::int64_t *ldb,
+                                     std::int64_t group_count, std::int64_t *group_size,
+                                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void trsm_batch_precondition(cl::sycl::queue &queue, side left_right, uplo upper_lower,
+                                    transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
+                                    float alpha, const float *a, std::int64_t lda,
+                                    std::int64_t stride_a, float *b, std::int64_t ldb,
+                                    std::int64_t stride_b, std::int64_t batch_size,
+                                    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void trsm_batch_postcondition(cl::sycl::queue &queue, side left_right, uplo upper_lower,
+                                     transpose trans, diag unit_diag, std::int64_t m,
+                                     std::int64_t n, float alpha, const float *a, std::int64_t lda,
+                                     std::int64_t stride_a, float *b, std::int64_t ldb,
+                                     std::int64_t stride_b, std::int64_t batch_size,
+                                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void trsm_batch_precondition(cl::sycl::queue &queue, side left_right, uplo upper_lower,
+                                    transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
+                                    double alpha, const double *a, std::int64_t lda,
+                                    std::int64_t stride_a, double *b, std::int64_t ldb,
+                                    std::int64_t stride_b, std::int64_t batch_size,
+                                    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void trsm_batch_postcondition(cl::sycl::queue &queue, side left_right, uplo upper_lower,
+                                     transpose trans, diag unit_diag, std::int64_t m,
+                                     std::int64_t n, double alpha, const double *a,
+                                     std::int64_t lda, std::int64_t stride_a, double *b,
+                                     std::int64_t ldb, std::int64_t stride_b,
+                                     std::int64_t batch_size,
+                                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void trsm_batch_precondition(cl::sycl::queue &queue, side left_right, uplo upper_lower,
+                                    transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
+                                    std::complex<float> alpha, const std::complex<float> *a,
+                                    std::int64_t lda, std::int64_t stride_a, std::complex<float> *b,
+                                    std::int64_t ldb, std::int64_t stride_b,
+                                    std::int64_t batch_size,
+                                    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void trsm_batch_postcondition(cl::sycl::queue &queue, side left_right, uplo upper_lower,
+                                     transpose trans, diag unit_diag, std::int64_t m,
+                                     std::int64_t n, std::complex<float> alpha,
+                                     const std::complex<float> *a, std::int64_t lda,
+                                     std::int64_t stride_a, std::complex<float> *b,
+                                     std::int64_t ldb, std::int64_t stride_b,
+                                     std::int64_t batch_size,
+                                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void trsm_batch_precondition(cl::sycl::queue &queue, side left_right, uplo upper_lower,
+                                    transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
+                                    std::complex<double> alpha, const std::complex<double> *a,
+                                    std::int64_t lda, std::int64_t stride_a,
+                                    std::complex<double> *b, std::int64_t ldb,
+                                    std::int64_t stride_b, std::int64_t batch_size,
+                                    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void trsm_batch_postcondition(cl::sycl::queue &queue, side left_right, uplo upper_lower,
+                                     transpose trans, diag unit_diag, std::int64_t m,
+                                     std::int64_t n, std::complex<double> alpha,
+                                     const std::complex<double> *a, std::int64_t lda,
+                                     std::int64_t stride_a, std::complex<double> *b,
+                                     std::int64_t ldb, std::int64_t stride_b,
+                                     std::int64_t batch_size,
+                                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
 inline void syrk_precondition(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
                               std::int64_t n, std::int64_t k, float alpha, const float *a,
                               std::int64_t lda, float beta, float *c, std::int64_t ldc,
@@ -4076,6 +4388,412 @@ inline void axpy_batch_postcondition(cl::sycl::queue &queue, std::int64_t *n,
 #endif
 }
 
+inline void axpy_batch_precondition(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                                    const float *x, std::int64_t incx, std::int64_t stridex,
+                                    float *y, std::int64_t incy, std::int64_t stridey,
+                                    std::int64_t batch_size,
+                                    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void axpy_batch_postcondition(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                                     const float *x, std::int64_t incx, std::int64_t stridex,
+                                     float *y, std::int64_t incy, std::int64_t stridey,
+                                     std::int64_t batch_size,
+                                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void axpy_batch_precondition(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                                    const double *x, std::int64_t incx, std::int64_t stridex,
+                                    double *y, std::int64_t incy, std::int64_t stridey,
+                                    std::int64_t batch_size,
+                                    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void axpy_batch_postcondition(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                                     const double *x, std::int64_t incx, std::int64_t stridex,
+                                     double *y, std::int64_t incy, std::int64_t stridey,
+                                     std::int64_t batch_size,
+                                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void axpy_batch_precondition(cl::sycl::queue &queue, std::int64_t n,
+                                    std::complex<float> alpha, const std::complex<float> *x,
+                                    std::int64_t incx, std::int64_t stridex, std::complex<float> *y,
+                                    std::int64_t incy, std::int64_t stridey,
+                                    std::int64_t batch_size,
+                                    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void axpy_batch_postcondition(cl::sycl::queue &queue, std::int64_t n,
+                                     std::complex<float> alpha, const std::complex<float> *x,
+                                     std::int64_t incx, std::int64_t stridex,
+                                     std::complex<float> *y, std::int64_t incy,
+                                     std::int64_t stridey, std::int64_t batch_size,
+                                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void axpy_batch_precondition(cl::sycl::queue &queue, std::int64_t n,
+                                    std::complex<double> alpha, const std::complex<double> *x,
+                                    std::int64_t incx, std::int64_t stridex,
+                                    std::complex<double> *y, std::int64_t incy,
+                                    std::int64_t stridey, std::int64_t batch_size,
+                                    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void axpy_batch_postcondition(cl::sycl::queue &queue, std::int64_t n,
+                                     std::complex<double> alpha, const std::complex<double> *x,
+                                     std::int64_t incx, std::int64_t stridex,
+                                     std::complex<double> *y, std::int64_t incy,
+                                     std::int64_t stridey, std::int64_t batch_size,
+                                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void compact_pack_precondition(cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols,
+                                      const float **a, std::int64_t lda, float *ap,
+                                      std::int64_t ldap, std::int64_t batch_size,
+                                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void compact_pack_postcondition(
+    cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols, const float **a, std::int64_t lda,
+    float *ap, std::int64_t ldap, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void compact_pack_precondition(cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols,
+                                      const double **a, std::int64_t lda, double *ap,
+                                      std::int64_t ldap, std::int64_t batch_size,
+                                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void compact_pack_postcondition(
+    cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols, const double **a,
+    std::int64_t lda, double *ap, std::int64_t ldap, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void compact_pack_precondition(cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols,
+                                      const std::complex<float> **a, std::int64_t lda,
+                                      std::complex<float> *ap, std::int64_t ldap,
+                                      std::int64_t batch_size,
+                                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void compact_pack_postcondition(
+    cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols, const std::complex<float> **a,
+    std::int64_t lda, std::complex<float> *ap, std::int64_t ldap, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void compact_pack_precondition(cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols,
+                                      const std::complex<double> **a, std::int64_t lda,
+                                      std::complex<double> *ap, std::int64_t ldap,
+                                      std::int64_t batch_size,
+                                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void compact_pack_postcondition(
+    cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols, const std::complex<double> **a,
+    std::int64_t lda, std::complex<double> *ap, std::int64_t ldap, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void compact_unpack_precondition(
+    cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols, const float *ap,
+    std::int64_t ldap, float **a, std::int64_t lda, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void compact_unpack_postcondition(
+    cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols, const float *ap,
+    std::int64_t ldap, float **a, std::int64_t lda, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void compact_unpack_precondition(
+    cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols, const double *ap,
+    std::int64_t ldap, double **a, std::int64_t lda, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void compact_unpack_postcondition(
+    cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols, const double *ap,
+    std::int64_t ldap, double **a, std::int64_t lda, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void compact_unpack_precondition(
+    cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols, const std::complex<float> *ap,
+    std::int64_t ldap, std::complex<float> **a, std::int64_t lda, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void compact_unpack_postcondition(
+    cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols, const std::complex<float> *ap,
+    std::int64_t ldap, std::complex<float> **a, std::int64_t lda, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void compact_unpack_precondition(
+    cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols, const std::complex<double> *ap,
+    std::int64_t ldap, std::complex<double> **a, std::int64_t lda, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void compact_unpack_postcondition(
+    cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols, const std::complex<double> *ap,
+    std::int64_t ldap, std::complex<double> **a, std::int64_t lda, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_compact_precondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                      std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                                      const float *ap, std::int64_t ldap, const float *bp,
+                                      std::int64_t ldbp, float beta, float *cp, std::int64_t ldcp,
+                                      std::int64_t batch_size,
+                                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_compact_postcondition(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, float alpha, const float *ap, std::int64_t ldap, const float *bp,
+    std::int64_t ldbp, float beta, float *cp, std::int64_t ldcp, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_compact_precondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                      std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
+                                      const double *ap, std::int64_t ldap, const double *bp,
+                                      std::int64_t ldbp, double beta, double *cp, std::int64_t ldcp,
+                                      std::int64_t batch_size,
+                                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_compact_postcondition(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, double alpha, const double *ap, std::int64_t ldap, const double *bp,
+    std::int64_t ldbp, double beta, double *cp, std::int64_t ldcp, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_compact_precondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                      std::int64_t m, std::int64_t n, std::int64_t k,
+                                      std::complex<float> alpha, const std::complex<float> *ap,
+                                      std::int64_t ldap, const std::complex<float> *bp,
+                                      std::int64_t ldbp, std::complex<float> beta,
+                                      std::complex<float> *cp, std::int64_t ldcp,
+                                      std::int64_t batch_size,
+                                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_compact_postcondition(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<float> alpha, const std::complex<float> *ap, std::int64_t ldap,
+    const std::complex<float> *bp, std::int64_t ldbp, std::complex<float> beta,
+    std::complex<float> *cp, std::int64_t ldcp, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_compact_precondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                      std::int64_t m, std::int64_t n, std::int64_t k,
+                                      std::complex<double> alpha, const std::complex<double> *ap,
+                                      std::int64_t ldap, const std::complex<double> *bp,
+                                      std::int64_t ldbp, std::complex<double> beta,
+                                      std::complex<double> *cp, std::int64_t ldcp,
+                                      std::int64_t batch_size,
+                                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_compact_postcondition(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<double> alpha, const std::complex<double> *ap, std::int64_t ldap,
+    const std::complex<double> *bp, std::int64_t ldbp, std::complex<double> beta,
+    std::complex<double> *cp, std::int64_t ldcp, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void trsm_compact_precondition(cl::sycl::queue &queue, side left_right, uplo upper_lower,
+                                      transpose trans, diag unit_diag, std::int64_t m,
+                                      std::int64_t n, float alpha, const float *ap,
+                                      std::int64_t ldap, float *bp, std::int64_t ldbp,
+                                      std::int64_t batch_size,
+                                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void trsm_compact_postcondition(
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+    std::int64_t m, std::int64_t n, float alpha, const float *ap, std::int64_t ldap, float *bp,
+    std::int64_t ldbp, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void trsm_compact_precondition(cl::sycl::queue &queue, side left_right, uplo upper_lower,
+                                      transpose trans, diag unit_diag, std::int64_t m,
+                                      std::int64_t n, double alpha, const double *ap,
+                                      std::int64_t ldap, double *bp, std::int64_t ldbp,
+                                      std::int64_t batch_size,
+                                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void trsm_compact_postcondition(
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+    std::int64_t m, std::int64_t n, double alpha, const double *ap, std::int64_t ldap, double *bp,
+    std::int64_t ldbp, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void trsm_compact_precondition(cl::sycl::queue &queue, side left_right, uplo upper_lower,
+                                      transpose trans, diag unit_diag, std::int64_t m,
+                                      std::int64_t n, std::complex<float> alpha,
+                                      const std::complex<float> *ap, std::int64_t ldap,
+                                      std::complex<float> *bp, std::int64_t ldbp,
+                                      std::int64_t batch_size,
+                                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void trsm_compact_postcondition(
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+    std::int64_t m, std::int64_t n, std::complex<float> alpha, const std::complex<float> *ap,
+    std::int64_t ldap, std::complex<float> *bp, std::int64_t ldbp, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void trsm_compact_precondition(cl::sycl::queue &queue, side left_right, uplo upper_lower,
+                                      transpose trans, diag unit_diag, std::int64_t m,
+                                      std::int64_t n, std::complex<double> alpha,
+                                      const std::complex<double> *ap, std::int64_t ldap,
+                                      std::complex<double> *bp, std::int64_t ldbp,
+                                      std::int64_t batch_size,
+                                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void trsm_compact_postcondition(
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+    std::int64_t m, std::int64_t n, std::complex<double> alpha, const std::complex<double> *ap,
+    std::int64_t ldap, std::complex<double> *bp, std::int64_t ldbp, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
 inline void gerc_precondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
                               std::complex<float> alpha, const std::complex<float> *x,
                               std::int64_t incx, const std::complex<float> *y, std::int64_t incy,
@@ -4702,6 +5420,68 @@ inline void nrm2_postcondition(cl::sycl::queue &queue, std::int64_t n, const dou
 #endif
 }
 
+inline void gemm_ext_precondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                  std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                                  const half *a, std::int64_t lda, const half *b, std::int64_t ldb,
+                                  float beta, float *c, std::int64_t ldc,
+                                  const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_ext_postcondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                   std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                                   const half *a, std::int64_t lda, const half *b, std::int64_t ldb,
+                                   float beta, float *c, std::int64_t ldc,
+                                   const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_ext_precondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                  std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                                  const bfloat16 *a, std::int64_t lda, const bfloat16 *b,
+                                  std::int64_t ldb, float beta, float *c, std::int64_t ldc,
+                                  const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_ext_postcondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                   std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                                   const bfloat16 *a, std::int64_t lda, const bfloat16 *b,
+                                   std::int64_t ldb, float beta, float *c, std::int64_t ldc,
+                                   const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_ext_precondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                  offset offsetc, std::int64_t m, std::int64_t n, std::int64_t k,
+                                  float alpha, const int8_t *a, std::int64_t lda, int8_t ao,
+                                  const uint8_t *b, std::int64_t ldb, uint8_t bo, float beta,
+                                  int32_t *c, std::int64_t ldc, const int32_t *co,
+                                  const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_ext_postcondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                   offset offsetc, std::int64_t m, std::int64_t n, std::int64_t k,
+                                   float alpha, const int8_t *a, std::int64_t lda, int8_t ao,
+                                   const uint8_t *b, std::int64_t ldb, uint8_t bo, float beta,
+                                   int32_t *c, std::int64_t ldc, const int32_t *co,
+                                   const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
 inline void gemmt_precondition(cl::sycl::queue &queue, uplo upper_lower, transpose transa,
                                transpose transb, std::int64_t n, std::int64_t k, float alpha,
                                const float *a, std::int64_t lda, const float *b, std::int64_t ldb,
@@ -4891,6 +5671,26 @@ inline void gemm_postcondition(cl::sycl::queue &queue, transpose transa, transpo
 #endif
 }
 
+inline void gemm_precondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                              std::int64_t m, std::int64_t n, std::int64_t k, bfloat16 alpha,
+                              const bfloat16 *a, std::int64_t lda, const bfloat16 *b,
+                              std::int64_t ldb, bfloat16 beta, bfloat16 *c, std::int64_t ldc,
+                              const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_postcondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                               std::int64_t m, std::int64_t n, std::int64_t k, bfloat16 alpha,
+                               const bfloat16 *a, std::int64_t lda, const bfloat16 *b,
+                               std::int64_t ldb, bfloat16 beta, bfloat16 *c, std::int64_t ldc,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
 inline void syr2_precondition(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, float alpha,
                               const float *x, std::int64_t incx, const float *y, std::int64_t incy,
                               float *a, std::int64_t lda,
@@ -0,0 +1,52 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_BLAS_RECORD_HPP_
+#define _ONEMKL_BLAS_RECORD_HPP_
+
+#include <memory>
+#include <string>
+
+namespace onemkl {
+namespace blas {
+namespace detail {
+
+struct replay_state;
+
+} // namespace detail
+
+// One call of a recording, as returned by record_load(). name is the routine,
+//  e.g. "sgemm_usm", arguments the recorded arguments in order: scalars by
+//  value, data operands by their number of elements, the per-group arrays of
+//  the group batch APIs by their contents. Calls that are not replayable are
+//  those with arguments in opaque formats (packed GEMM, compact routines);
+//  they are listed but replay_prepare() rejects them.
+struct recorded_call {
+    std::string name;
+    std::string arguments;
+    int thread      = 0;
+    bool replayable = false;
+
+    std::shared_ptr<detail::replay_state> state;
+};
+
+} // namespace blas
+} // namespace onemkl
+
+#endif //_ONEMKL_BLAS_RECORD_HPP_
@@ -0,0 +1,95 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_BLAS_STATS_HPP_
+#define _ONEMKL_BLAS_STATS_HPP_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace onemkl {
+namespace blas {
+
+// Execution times are histogrammed in stats_buckets buckets: bucket 0 counts
+//  times under 1 us, bucket i times in [2^(i-1), 2^i) us, and the last bucket
+//  every longer time.
+static constexpr int stats_buckets = 20;
+
+static inline int stats_bucket(std::uint64_t ns) {
+    std::uint64_t us = ns / 1000;
+    int bucket       = 0;
+    while (us && bucket < stats_buckets - 1) {
+        us >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+// Counters of one routine in one precision and memory model, e.g. "sgemm_usm".
+//  calls, flops, bytes and submit_ns are counted by the run-time dispatching
+//  layer; flops and bytes are estimated from the dimensions of each call
+//  (0 for routines without a model, such as the group batch APIs). tasks,
+//  exec_ns and exec_histogram are the host tasks of the routine as timed by
+//  the backend, which also counts calls made through the compile-time API.
+struct routine_stats {
+    std::string name;
+    std::string routine;
+    std::string precision;
+    bool usm                = false;
+    std::uint64_t calls     = 0;
+    std::uint64_t flops     = 0;
+    std::uint64_t bytes     = 0;
+    std::uint64_t submit_ns = 0;
+    std::uint64_t tasks     = 0;
+    std::uint64_t exec_ns   = 0;
+
+    std::uint64_t exec_histogram[stats_buckets] = {};
+};
+
+// Internal costs counted by the backends, e.g. "mklcpu.fp16_conversion_bytes".
+struct counter_stats {
+    std::string name;
+    std::uint64_t value = 0;
+};
+
+struct stats_report {
+    std::vector<routine_stats> routines;
+    std::vector<counter_stats> counters;
+};
+
+namespace detail {
+
+// Receives the counters a backend keeps itself. Cumulative counters are reset
+//  by stats_reset(); the others (high water marks, memory held) are levels.
+class stats_sink {
+public:
+    virtual void task(const char *name, std::uint64_t tasks, std::uint64_t exec_ns,
+                      const std::uint64_t *exec_histogram) = 0;
+    virtual void counter(const char *name, std::uint64_t value, bool cumulative) = 0;
+
+protected:
+    ~stats_sink() = default;
+};
+
+} // namespace detail
+} // namespace blas
+} // namespace onemkl
+
+#endif //_ONEMKL_BLAS_STATS_HPP_
@@ -35,28 +35,46 @@
 #define NVIDIA_ID 4318
 
 namespace onemkl {
-inline char *select_backend(cl::sycl::queue &queue) {
+
+inline backend get_backend(cl::sycl::queue &queue) {
     if (queue.is_host()) {
-        return (char *)LIB_NAME("onemkl_blas_mklcpu");
+        return backend::intelcpu;
     }
     else if (queue.get_device().is_cpu()) {
-        return (char *)LIB_NAME("onemkl_blas_mklcpu");
+        return backend::intelcpu;
     }
     else if (queue.get_device().is_gpu()) {
         unsigned int vendor_id = static_cast<unsigned int>(
             queue.get_device().get_info<cl::sycl::info::device::vendor_id>());
 
         if (vendor_id == INTEL_ID)
-            return (char *)LIB_NAME("onemkl_blas_mklgpu");
+            return backend::intelgpu;
         else if (vendor_id == NVIDIA_ID)
-            return (char *)LIB_NAME("onemkl_blas_cublas");
-        return (char *)"unsupported";
+            return backend::nvidiagpu;
+        return backend::unsupported;
     }
     else {
-        return (char *)"unsupported";
+        return backend::unsupported;
+    }
+}
+
+inline char *backend_libname(backend b) {
+    switch (b) {
+        case backend::intelcpu:
+            return (char *)LIB_NAME("onemkl_blas_mklcpu");
+        case backend::intelgpu:
+            return (char *)LIB_NAME("onemkl_blas_mklgpu");
+        case backend::nvidiagpu:
+            return (char *)LIB_NAME("onemkl_blas_cublas");
+        default:
+            return (char *)"unsupported";
     }
 }
 
+inline char *select_backend(cl::sycl::queue &queue) {
+    return backend_libname(get_backend(queue));
+}
+
 } //namespace onemkl
 
 #endif //_ONEMKL_BACKENDS_SELECTOR_HPP_
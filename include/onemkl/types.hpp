@@ -20,6 +20,8 @@
 #ifndef _ONEMKL_TYPES_HPP_
 #define _ONEMKL_TYPES_HPP_
 
+#include "onemkl/bfloat16.hpp"
+
 namespace onemkl {
 
 // BLAS flag types.
@@ -33,6 +35,8 @@ enum class side : char { left = 0, right = 1, L = 0, R = 1 };
 
 enum class offset : char { row = 0, column = 1, fix = 2, R = 0, C = 1, F = 2 };
 
+enum class pack_matrix : char { a = 0, b = 1, A = 0, B = 1 };
+
 // LAPACK flag types.
 enum class job : char {
     novec        = 0,
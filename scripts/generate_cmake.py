@@ -83,11 +83,7 @@ add_library(${{LIB_OBJ}} OBJECT
 """.format(libname=libname))
 
 for f in file_list:
-    if re.search('_dyn.c', f):
-        out_file.write("""  $<$<BOOL:${{BUILD_SHARED_LIBS}}>: {filename}>
-""".format(filename=f))
-    else:
-        out_file.write("""  {filename}
+    out_file.write("""  {filename}
 """.format(filename=f))
 
 out_file.write("""
@@ -96,6 +92,7 @@ out_file.write("""
 target_include_directories(${{LIB_OBJ}}
   PRIVATE ${{PROJECT_SOURCE_DIR}}/include
           ${{PROJECT_SOURCE_DIR}}/src
+          ${{CMAKE_BINARY_DIR}}/bin
 )
 
 target_link_libraries(${{LIB_OBJ}}
@@ -136,12 +136,18 @@ out_file.write("""//
 
 #include "{header}"
 #include "{table}"
+#include "onemkl/detail/config.hpp"
 
-#define WRAPPER_VERSION 1
+#define WRAPPER_VERSION 2
 
-extern "C" function_table_t mkl_blas_table = {{
-    WRAPPER_VERSION,
-""".format(table=in_table.strip('src/'), header=in_filename.strip('include/')))
+#ifdef BUILD_SHARED_LIBS
+    #define WRAPPER_TABLE mkl_blas_table
+#else
+    #define WRAPPER_TABLE mkl_blas_{libname}_table
+#endif
+
+static const function_table_entry_t wrapper_entries[] = {{
+""".format(table=in_table.strip('src/'), header=in_filename.strip('include/'), libname=libname))
 
 namespace = ""
 for nmsp in namespace_list:
@@ -149,11 +155,17 @@ for nmsp in namespace_list:
 with open(table_list, "r") as f:
     table = f.readlines()
 
+# Each line of the list is "<function_table_t field> <routine>"
 for t in table:
-    out_file.write("    " + namespace + t.strip() + ",\n")
+    field, routine = t.split()
+    out_file.write("    ONEMKL_TABLE_ENTRY(" + field + ", " + namespace + routine + "),\n")
 
+out_file.write("""}};
 
-out_file.write("\n};\n")
+extern "C" function_index_t WRAPPER_TABLE = {{
+    WRAPPER_VERSION, sizeof(wrapper_entries) / sizeof(wrapper_entries[0]), wrapper_entries
+}};
+""")
 out_file.close()
 
 print("Formatting with clang-format " + table_file)
@@ -103,6 +103,32 @@ void trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_lower, trans
     throw backend_unsupported_exception();
 }
 
+void axpy_batch(cl::sycl::queue &queue, int64_t n, float alpha, cl::sycl::buffer<float, 1> &x,
+                int64_t incx, int64_t stridex, cl::sycl::buffer<float, 1> &y, int64_t incy,
+                int64_t stridey, int64_t batch_size) {
+    throw backend_unsupported_exception();
+}
+
+void axpy_batch(cl::sycl::queue &queue, int64_t n, double alpha, cl::sycl::buffer<double, 1> &x,
+                int64_t incx, int64_t stridex, cl::sycl::buffer<double, 1> &y, int64_t incy,
+                int64_t stridey, int64_t batch_size) {
+    throw backend_unsupported_exception();
+}
+
+void axpy_batch(cl::sycl::queue &queue, int64_t n, std::complex<float> alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &x, int64_t incx, int64_t stridex,
+                cl::sycl::buffer<std::complex<float>, 1> &y, int64_t incy, int64_t stridey,
+                int64_t batch_size) {
+    throw backend_unsupported_exception();
+}
+
+void axpy_batch(cl::sycl::queue &queue, int64_t n, std::complex<double> alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &x, int64_t incx, int64_t stridex,
+                cl::sycl::buffer<std::complex<double>, 1> &y, int64_t incy, int64_t stridey,
+                int64_t batch_size) {
+    throw backend_unsupported_exception();
+}
+
 // USM APIs
 
 template <typename Func, typename T>
@@ -212,6 +238,74 @@ cl::sycl::event axpy_batch(cl::sycl::queue &queue, int64_t *n, float *alpha, con
     throw backend_unsupported_exception();
 }
 
+cl::sycl::event trsm_batch(cl::sycl::queue &queue, side *left_right, uplo *upper_lower,
+                           transpose *trans, diag *unit_diag, int64_t *m, int64_t *n, float *alpha,
+                           const float **a, int64_t *lda, float **b, int64_t *ldb,
+                           int64_t group_count, int64_t *group_size,
+                           const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event trsm_batch(cl::sycl::queue &queue, side *left_right, uplo *upper_lower,
+                           transpose *trans, diag *unit_diag, int64_t *m, int64_t *n, double *alpha,
+                           const double **a, int64_t *lda, double **b, int64_t *ldb,
+                           int64_t group_count, int64_t *group_size,
+                           const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event trsm_batch(cl::sycl::queue &queue, side *left_right, uplo *upper_lower,
+                           transpose *trans, diag *unit_diag, int64_t *m, int64_t *n,
+                           std::complex<float> *alpha, const std::complex<float> **a, int64_t *lda,
+                           std::complex<float> **b, int64_t *ldb, int64_t group_count,
+                           int64_t *group_size,
+                           const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event trsm_batch(cl::sycl::queue &queue, side *left_right, uplo *upper_lower,
+                           transpose *trans, diag *unit_diag, int64_t *m, int64_t *n,
+                           std::complex<double> *alpha, const std::complex<double> **a,
+                           int64_t *lda, std::complex<double> **b, int64_t *ldb,
+                           int64_t group_count, int64_t *group_size,
+                           const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_lower,
+                           transpose trans, diag unit_diag, int64_t m, int64_t n, float alpha,
+                           const float *a, int64_t lda, int64_t stride_a, float *b, int64_t ldb,
+                           int64_t stride_b, int64_t batch_size,
+                           const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_lower,
+                           transpose trans, diag unit_diag, int64_t m, int64_t n, double alpha,
+                           const double *a, int64_t lda, int64_t stride_a, double *b, int64_t ldb,
+                           int64_t stride_b, int64_t batch_size,
+                           const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_lower,
+                           transpose trans, diag unit_diag, int64_t m, int64_t n,
+                           std::complex<float> alpha, const std::complex<float> *a, int64_t lda,
+                           int64_t stride_a, std::complex<float> *b, int64_t ldb, int64_t stride_b,
+                           int64_t batch_size,
+                           const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_lower,
+                           transpose trans, diag unit_diag, int64_t m, int64_t n,
+                           std::complex<double> alpha, const std::complex<double> *a, int64_t lda,
+                           int64_t stride_a, std::complex<double> *b, int64_t ldb, int64_t stride_b,
+                           int64_t batch_size,
+                           const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
 cl::sycl::event axpy_batch(cl::sycl::queue &queue, int64_t *n, double *alpha, const double **x,
                            int64_t *incx, double **y, int64_t *incy, int64_t group_count,
                            int64_t *group_size,
@@ -233,5 +327,155 @@ cl::sycl::event axpy_batch(cl::sycl::queue &queue, int64_t *n, std::complex<doub
     throw backend_unsupported_exception();
 }
 
+cl::sycl::event axpy_batch(cl::sycl::queue &queue, int64_t n, float alpha, const float *x,
+                           int64_t incx, int64_t stridex, float *y, int64_t incy, int64_t stridey,
+                           int64_t batch_size,
+                           const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event axpy_batch(cl::sycl::queue &queue, int64_t n, double alpha, const double *x,
+                           int64_t incx, int64_t stridex, double *y, int64_t incy, int64_t stridey,
+                           int64_t batch_size,
+                           const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event axpy_batch(cl::sycl::queue &queue, int64_t n, std::complex<float> alpha,
+                           const std::complex<float> *x, int64_t incx, int64_t stridex,
+                           std::complex<float> *y, int64_t incy, int64_t stridey,
+                           int64_t batch_size,
+                           const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event axpy_batch(cl::sycl::queue &queue, int64_t n, std::complex<double> alpha,
+                           const std::complex<double> *x, int64_t incx, int64_t stridex,
+                           std::complex<double> *y, int64_t incy, int64_t stridey,
+                           int64_t batch_size,
+                           const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event compact_pack(cl::sycl::queue &queue, int64_t rows, int64_t cols, const float **a,
+                             int64_t lda, float *ap, int64_t ldap, int64_t batch_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event compact_pack(cl::sycl::queue &queue, int64_t rows, int64_t cols, const double **a,
+                             int64_t lda, double *ap, int64_t ldap, int64_t batch_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event compact_pack(cl::sycl::queue &queue, int64_t rows, int64_t cols,
+                             const std::complex<float> **a, int64_t lda, std::complex<float> *ap,
+                             int64_t ldap, int64_t batch_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event compact_pack(cl::sycl::queue &queue, int64_t rows, int64_t cols,
+                             const std::complex<double> **a, int64_t lda, std::complex<double> *ap,
+                             int64_t ldap, int64_t batch_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event compact_unpack(cl::sycl::queue &queue, int64_t rows, int64_t cols, const float *ap,
+                               int64_t ldap, float **a, int64_t lda, int64_t batch_size,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event compact_unpack(cl::sycl::queue &queue, int64_t rows, int64_t cols, const double *ap,
+                               int64_t ldap, double **a, int64_t lda, int64_t batch_size,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event compact_unpack(cl::sycl::queue &queue, int64_t rows, int64_t cols,
+                               const std::complex<float> *ap, int64_t ldap, std::complex<float> **a,
+                               int64_t lda, int64_t batch_size,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event compact_unpack(cl::sycl::queue &queue, int64_t rows, int64_t cols,
+                               const std::complex<double> *ap, int64_t ldap,
+                               std::complex<double> **a, int64_t lda, int64_t batch_size,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event gemm_compact(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                             int64_t n, int64_t k, float alpha, const float *ap, int64_t ldap,
+                             const float *bp, int64_t ldbp, float beta, float *cp, int64_t ldcp,
+                             int64_t batch_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event gemm_compact(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                             int64_t n, int64_t k, double alpha, const double *ap, int64_t ldap,
+                             const double *bp, int64_t ldbp, double beta, double *cp, int64_t ldcp,
+                             int64_t batch_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event gemm_compact(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                             int64_t n, int64_t k, std::complex<float> alpha,
+                             const std::complex<float> *ap, int64_t ldap,
+                             const std::complex<float> *bp, int64_t ldbp, std::complex<float> beta,
+                             std::complex<float> *cp, int64_t ldcp, int64_t batch_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event gemm_compact(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                             int64_t n, int64_t k, std::complex<double> alpha,
+                             const std::complex<double> *ap, int64_t ldap,
+                             const std::complex<double> *bp, int64_t ldbp,
+                             std::complex<double> beta, std::complex<double> *cp, int64_t ldcp,
+                             int64_t batch_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event trsm_compact(cl::sycl::queue &queue, side left_right, uplo upper_lower,
+                             transpose trans, diag unit_diag, int64_t m, int64_t n, float alpha,
+                             const float *ap, int64_t ldap, float *bp, int64_t ldbp,
+                             int64_t batch_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event trsm_compact(cl::sycl::queue &queue, side left_right, uplo upper_lower,
+                             transpose trans, diag unit_diag, int64_t m, int64_t n, double alpha,
+                             const double *ap, int64_t ldap, double *bp, int64_t ldbp,
+                             int64_t batch_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event trsm_compact(cl::sycl::queue &queue, side left_right, uplo upper_lower,
+                             transpose trans, diag unit_diag, int64_t m, int64_t n,
+                             std::complex<float> alpha, const std::complex<float> *ap, int64_t ldap,
+                             std::complex<float> *bp, int64_t ldbp, int64_t batch_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event trsm_compact(cl::sycl::queue &queue, side left_right, uplo upper_lower,
+                             transpose trans, diag unit_diag, int64_t m, int64_t n,
+                             std::complex<double> alpha, const std::complex<double> *ap,
+                             int64_t ldap, std::complex<double> *bp, int64_t ldbp,
+                             int64_t batch_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
 } // namespace cublas
 } // namespace onemkl
@@ -119,10 +119,42 @@ GEMM_EXT_LAUNCHER(std::complex<double>, std::complex<double>, std::complex<doubl
 
 #undef GEMM_EXT_LAUNCHER
 
+void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+              std::int64_t n, std::int64_t k, float alpha, cl::sycl::buffer<bfloat16, 1> &a,
+              std::int64_t lda, cl::sycl::buffer<bfloat16, 1> &b, std::int64_t ldb, float beta,
+              cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+    throw backend_unsupported_exception();
+}
+
 // USM APIs
 
 // BLAS-like extensions
 
+cl::sycl::event gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                         std::int64_t n, std::int64_t k, float alpha, const half *a,
+                         std::int64_t lda, const half *b, std::int64_t ldb, float beta, float *c,
+                         std::int64_t ldc,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                         std::int64_t n, std::int64_t k, float alpha, const bfloat16 *a,
+                         std::int64_t lda, const bfloat16 *b, std::int64_t ldb, float beta,
+                         float *c, std::int64_t ldc,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb, offset offsetc,
+                         std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                         const int8_t *a, std::int64_t lda, int8_t ao, const uint8_t *b,
+                         std::int64_t ldb, uint8_t bo, float beta, int32_t *c, std::int64_t ldc,
+                         const int32_t *co,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
 cl::sycl::event gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa, transpose transb,
                       int64_t n, int64_t k, float alpha, const float *a, int64_t lda,
                       const float *b, int64_t ldb, float beta, float *c, int64_t ldc,
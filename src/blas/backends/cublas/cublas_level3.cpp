@@ -74,6 +74,13 @@ void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64
     throw std::runtime_error("Not implemented for cublas");
 }
 
+void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+          std::int64_t n, std::int64_t k, bfloat16 alpha, cl::sycl::buffer<bfloat16, 1> &a,
+          std::int64_t lda, cl::sycl::buffer<bfloat16, 1> &b, std::int64_t ldb, bfloat16 beta,
+          cl::sycl::buffer<bfloat16, 1> &c, std::int64_t ldc) {
+    throw backend_unsupported_exception();
+}
+
 template <typename Func, typename T>
 inline void symm(Func func, cl::sycl::queue &queue, side left_right, uplo upper_lower, int64_t m,
                  int64_t n, T alpha, cl::sycl::buffer<T, 1> &a, int64_t lda,
@@ -432,6 +439,14 @@ cl::sycl::event gemm(cl::sycl::queue &queue, transpose transa, transpose transb,
     throw std::runtime_error("Not implemented for cublas");
 }
 
+cl::sycl::event gemm(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                     std::int64_t n, std::int64_t k, bfloat16 alpha, const bfloat16 *a,
+                     std::int64_t lda, const bfloat16 *b, std::int64_t ldb, bfloat16 beta,
+                     bfloat16 *c, std::int64_t ldc,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
 template <typename Func, typename T>
 inline cl::sycl::event symm(Func func, cl::sycl::queue &queue, side left_right, uplo upper_lower,
                             int64_t m, int64_t n, T alpha, const T *a, int64_t lda, const T *b,
@@ -17,346 +17,358 @@
 *
 **************************************************************************/
 #include "blas/function_table.hpp"
+#include "onemkl/detail/config.hpp"
 #include "onemkl/blas/detail/cublas/onemkl_blas_cublas.hpp"
 
-#define WRAPPER_VERSION 1
+#define WRAPPER_VERSION 2
 
-extern "C" function_table_t mkl_blas_table = {
-    WRAPPER_VERSION,
-    onemkl::cublas::asum,
-    onemkl::cublas::asum,
-    onemkl::cublas::asum,
-    onemkl::cublas::asum,
-    onemkl::cublas::axpy,
-    onemkl::cublas::axpy,
-    onemkl::cublas::axpy,
-    onemkl::cublas::axpy,
-    onemkl::cublas::copy,
-    onemkl::cublas::copy,
-    onemkl::cublas::copy,
-    onemkl::cublas::copy,
-    onemkl::cublas::dot,
-    onemkl::cublas::dot,
-    onemkl::cublas::dot,
-    onemkl::cublas::dotc,
-    onemkl::cublas::dotc,
-    onemkl::cublas::dotu,
-    onemkl::cublas::dotu,
-    onemkl::cublas::iamin,
-    onemkl::cublas::iamin,
-    onemkl::cublas::iamin,
-    onemkl::cublas::iamin,
-    onemkl::cublas::iamax,
-    onemkl::cublas::iamax,
-    onemkl::cublas::iamax,
-    onemkl::cublas::iamax,
-    onemkl::cublas::nrm2,
-    onemkl::cublas::nrm2,
-    onemkl::cublas::nrm2,
-    onemkl::cublas::nrm2,
-    onemkl::cublas::rot,
-    onemkl::cublas::rot,
-    onemkl::cublas::rot,
-    onemkl::cublas::rot,
-    onemkl::cublas::rotg,
-    onemkl::cublas::rotg,
-    onemkl::cublas::rotg,
-    onemkl::cublas::rotg,
-    onemkl::cublas::rotm,
-    onemkl::cublas::rotm,
-    onemkl::cublas::rotmg,
-    onemkl::cublas::rotmg,
-    onemkl::cublas::scal,
-    onemkl::cublas::scal,
-    onemkl::cublas::scal,
-    onemkl::cublas::scal,
-    onemkl::cublas::scal,
-    onemkl::cublas::scal,
-    onemkl::cublas::sdsdot,
-    onemkl::cublas::swap,
-    onemkl::cublas::swap,
-    onemkl::cublas::swap,
-    onemkl::cublas::swap,
-    onemkl::cublas::gbmv,
-    onemkl::cublas::gbmv,
-    onemkl::cublas::gbmv,
-    onemkl::cublas::gbmv,
-    onemkl::cublas::gemv,
-    onemkl::cublas::gemv,
-    onemkl::cublas::gemv,
-    onemkl::cublas::gemv,
-    onemkl::cublas::ger,
-    onemkl::cublas::ger,
-    onemkl::cublas::gerc,
-    onemkl::cublas::gerc,
-    onemkl::cublas::geru,
-    onemkl::cublas::geru,
-    onemkl::cublas::hbmv,
-    onemkl::cublas::hbmv,
-    onemkl::cublas::hemv,
-    onemkl::cublas::hemv,
-    onemkl::cublas::her,
-    onemkl::cublas::her,
-    onemkl::cublas::her2,
-    onemkl::cublas::her2,
-    onemkl::cublas::hpmv,
-    onemkl::cublas::hpmv,
-    onemkl::cublas::hpr,
-    onemkl::cublas::hpr,
-    onemkl::cublas::hpr2,
-    onemkl::cublas::hpr2,
-    onemkl::cublas::sbmv,
-    onemkl::cublas::sbmv,
-    onemkl::cublas::spmv,
-    onemkl::cublas::spmv,
-    onemkl::cublas::spr,
-    onemkl::cublas::spr,
-    onemkl::cublas::spr2,
-    onemkl::cublas::spr2,
-    onemkl::cublas::symv,
-    onemkl::cublas::symv,
-    onemkl::cublas::syr,
-    onemkl::cublas::syr,
-    onemkl::cublas::syr2,
-    onemkl::cublas::syr2,
-    onemkl::cublas::tbmv,
-    onemkl::cublas::tbmv,
-    onemkl::cublas::tbmv,
-    onemkl::cublas::tbmv,
-    onemkl::cublas::tbsv,
-    onemkl::cublas::tbsv,
-    onemkl::cublas::tbsv,
-    onemkl::cublas::tbsv,
-    onemkl::cublas::tpmv,
-    onemkl::cublas::tpmv,
-    onemkl::cublas::tpmv,
-    onemkl::cublas::tpmv,
-    onemkl::cublas::tpsv,
-    onemkl::cublas::tpsv,
-    onemkl::cublas::tpsv,
-    onemkl::cublas::tpsv,
-    onemkl::cublas::trmv,
-    onemkl::cublas::trmv,
-    onemkl::cublas::trmv,
-    onemkl::cublas::trmv,
-    onemkl::cublas::trsv,
-    onemkl::cublas::trsv,
-    onemkl::cublas::trsv,
-    onemkl::cublas::trsv,
-    onemkl::cublas::gemm,
-    onemkl::cublas::gemm,
-    onemkl::cublas::gemm,
-    onemkl::cublas::gemm,
-    onemkl::cublas::gemm,
-    onemkl::cublas::hemm,
-    onemkl::cublas::hemm,
-    onemkl::cublas::herk,
-    onemkl::cublas::herk,
-    onemkl::cublas::her2k,
-    onemkl::cublas::her2k,
-    onemkl::cublas::symm,
-    onemkl::cublas::symm,
-    onemkl::cublas::symm,
-    onemkl::cublas::symm,
-    onemkl::cublas::syrk,
-    onemkl::cublas::syrk,
-    onemkl::cublas::syrk,
-    onemkl::cublas::syrk,
-    onemkl::cublas::syr2k,
-    onemkl::cublas::syr2k,
-    onemkl::cublas::syr2k,
-    onemkl::cublas::syr2k,
-    onemkl::cublas::trmm,
-    onemkl::cublas::trmm,
-    onemkl::cublas::trmm,
-    onemkl::cublas::trmm,
-    onemkl::cublas::trsm,
-    onemkl::cublas::trsm,
-    onemkl::cublas::trsm,
-    onemkl::cublas::trsm,
-    onemkl::cublas::gemm_batch,
-    onemkl::cublas::gemm_batch,
-    onemkl::cublas::gemm_batch,
-    onemkl::cublas::gemm_batch,
-    onemkl::cublas::trsm_batch,
-    onemkl::cublas::trsm_batch,
-    onemkl::cublas::trsm_batch,
-    onemkl::cublas::trsm_batch,
-    onemkl::cublas::gemmt,
-    onemkl::cublas::gemmt,
-    onemkl::cublas::gemmt,
-    onemkl::cublas::gemmt,
-    onemkl::cublas::gemm_ext,
-    onemkl::cublas::gemm_ext,
-    onemkl::cublas::gemm_ext,
-    onemkl::cublas::gemm_ext,
-    onemkl::cublas::gemm_ext,
-    onemkl::cublas::gemm_ext,
-    onemkl::cublas::gemm_ext,
-    onemkl::cublas::asum,
-    onemkl::cublas::asum,
-    onemkl::cublas::asum,
-    onemkl::cublas::asum,
-    onemkl::cublas::axpy,
-    onemkl::cublas::axpy,
-    onemkl::cublas::axpy,
-    onemkl::cublas::axpy,
-    onemkl::cublas::axpy_batch,
-    onemkl::cublas::axpy_batch,
-    onemkl::cublas::axpy_batch,
-    onemkl::cublas::axpy_batch,
-    onemkl::cublas::copy,
-    onemkl::cublas::copy,
-    onemkl::cublas::copy,
-    onemkl::cublas::copy,
-    onemkl::cublas::dot,
-    onemkl::cublas::dot,
-    onemkl::cublas::dot,
-    onemkl::cublas::dotc,
-    onemkl::cublas::dotc,
-    onemkl::cublas::dotu,
-    onemkl::cublas::dotu,
-    onemkl::cublas::iamin,
-    onemkl::cublas::iamin,
-    onemkl::cublas::iamin,
-    onemkl::cublas::iamin,
-    onemkl::cublas::iamax,
-    onemkl::cublas::iamax,
-    onemkl::cublas::iamax,
-    onemkl::cublas::iamax,
-    onemkl::cublas::nrm2,
-    onemkl::cublas::nrm2,
-    onemkl::cublas::nrm2,
-    onemkl::cublas::nrm2,
-    onemkl::cublas::rot,
-    onemkl::cublas::rot,
-    onemkl::cublas::rot,
-    onemkl::cublas::rot,
-    onemkl::cublas::rotg,
-    onemkl::cublas::rotg,
-    onemkl::cublas::rotg,
-    onemkl::cublas::rotg,
-    onemkl::cublas::rotm,
-    onemkl::cublas::rotm,
-    onemkl::cublas::rotmg,
-    onemkl::cublas::rotmg,
-    onemkl::cublas::scal,
-    onemkl::cublas::scal,
-    onemkl::cublas::scal,
-    onemkl::cublas::scal,
-    onemkl::cublas::scal,
-    onemkl::cublas::scal,
-    onemkl::cublas::sdsdot,
-    onemkl::cublas::swap,
-    onemkl::cublas::swap,
-    onemkl::cublas::swap,
-    onemkl::cublas::swap,
-    onemkl::cublas::gbmv,
-    onemkl::cublas::gbmv,
-    onemkl::cublas::gbmv,
-    onemkl::cublas::gbmv,
-    onemkl::cublas::gemv,
-    onemkl::cublas::gemv,
-    onemkl::cublas::gemv,
-    onemkl::cublas::gemv,
-    onemkl::cublas::ger,
-    onemkl::cublas::ger,
-    onemkl::cublas::gerc,
-    onemkl::cublas::gerc,
-    onemkl::cublas::geru,
-    onemkl::cublas::geru,
-    onemkl::cublas::hbmv,
-    onemkl::cublas::hbmv,
-    onemkl::cublas::hemv,
-    onemkl::cublas::hemv,
-    onemkl::cublas::her,
-    onemkl::cublas::her,
-    onemkl::cublas::her2,
-    onemkl::cublas::her2,
-    onemkl::cublas::hpmv,
-    onemkl::cublas::hpmv,
-    onemkl::cublas::hpr,
-    onemkl::cublas::hpr,
-    onemkl::cublas::hpr2,
-    onemkl::cublas::hpr2,
-    onemkl::cublas::sbmv,
-    onemkl::cublas::sbmv,
-    onemkl::cublas::spmv,
-    onemkl::cublas::spmv,
-    onemkl::cublas::spr,
-    onemkl::cublas::spr,
-    onemkl::cublas::spr2,
-    onemkl::cublas::spr2,
-    onemkl::cublas::symv,
-    onemkl::cublas::symv,
-    onemkl::cublas::syr,
-    onemkl::cublas::syr,
-    onemkl::cublas::syr2,
-    onemkl::cublas::syr2,
-    onemkl::cublas::tbmv,
-    onemkl::cublas::tbmv,
-    onemkl::cublas::tbmv,
-    onemkl::cublas::tbmv,
-    onemkl::cublas::tbsv,
-    onemkl::cublas::tbsv,
-    onemkl::cublas::tbsv,
-    onemkl::cublas::tbsv,
-    onemkl::cublas::tpmv,
-    onemkl::cublas::tpmv,
-    onemkl::cublas::tpmv,
-    onemkl::cublas::tpmv,
-    onemkl::cublas::tpsv,
-    onemkl::cublas::tpsv,
-    onemkl::cublas::tpsv,
-    onemkl::cublas::tpsv,
-    onemkl::cublas::trmv,
-    onemkl::cublas::trmv,
-    onemkl::cublas::trmv,
-    onemkl::cublas::trmv,
-    onemkl::cublas::trsv,
-    onemkl::cublas::trsv,
-    onemkl::cublas::trsv,
-    onemkl::cublas::trsv,
-    onemkl::cublas::gemm,
-    onemkl::cublas::gemm,
-    onemkl::cublas::gemm,
-    onemkl::cublas::gemm,
-    onemkl::cublas::hemm,
-    onemkl::cublas::hemm,
-    onemkl::cublas::herk,
-    onemkl::cublas::herk,
-    onemkl::cublas::her2k,
-    onemkl::cublas::her2k,
-    onemkl::cublas::symm,
-    onemkl::cublas::symm,
-    onemkl::cublas::symm,
-    onemkl::cublas::symm,
-    onemkl::cublas::syrk,
-    onemkl::cublas::syrk,
-    onemkl::cublas::syrk,
-    onemkl::cublas::syrk,
-    onemkl::cublas::syr2k,
-    onemkl::cublas::syr2k,
-    onemkl::cublas::syr2k,
-    onemkl::cublas::syr2k,
-    onemkl::cublas::trmm,
-    onemkl::cublas::trmm,
-    onemkl::cublas::trmm,
-    onemkl::cublas::trmm,
-    onemkl::cublas::trsm,
-    onemkl::cublas::trsm,
-    onemkl::cublas::trsm,
-    onemkl::cublas::trsm,
-    onemkl::cublas::gemm_batch,
-    onemkl::cublas::gemm_batch,
-    onemkl::cublas::gemm_batch,
-    onemkl::cublas::gemm_batch,
-    onemkl::cublas::gemm_batch,
-    onemkl::cublas::gemm_batch,
-    onemkl::cublas::gemm_batch,
-    onemkl::cublas::gemm_batch,
-    onemkl::cublas::gemmt,
-    onemkl::cublas::gemmt,
-    onemkl::cublas::gemmt,
-    onemkl::cublas::gemmt,
+// Shared backends are loaded with dlopen and looked up by a common name, static
+//  ones are linked into the loader and need a name of their own.
+#ifdef BUILD_SHARED_LIBS
+    #define WRAPPER_TABLE mkl_blas_table
+#else
+    #define WRAPPER_TABLE mkl_blas_cublas_table
+#endif
+
+static const function_table_entry_t wrapper_entries[] = {
+    ONEMKL_TABLE_ENTRY(scasum_sycl, onemkl::cublas::asum),
+    ONEMKL_TABLE_ENTRY(dzasum_sycl, onemkl::cublas::asum),
+    ONEMKL_TABLE_ENTRY(sasum_sycl, onemkl::cublas::asum),
+    ONEMKL_TABLE_ENTRY(dasum_sycl, onemkl::cublas::asum),
+    ONEMKL_TABLE_ENTRY(saxpy_sycl, onemkl::cublas::axpy),
+    ONEMKL_TABLE_ENTRY(daxpy_sycl, onemkl::cublas::axpy),
+    ONEMKL_TABLE_ENTRY(caxpy_sycl, onemkl::cublas::axpy),
+    ONEMKL_TABLE_ENTRY(zaxpy_sycl, onemkl::cublas::axpy),
+    ONEMKL_TABLE_ENTRY(scopy_sycl, onemkl::cublas::copy),
+    ONEMKL_TABLE_ENTRY(dcopy_sycl, onemkl::cublas::copy),
+    ONEMKL_TABLE_ENTRY(ccopy_sycl, onemkl::cublas::copy),
+    ONEMKL_TABLE_ENTRY(zcopy_sycl, onemkl::cublas::copy),
+    ONEMKL_TABLE_ENTRY(sdot_sycl, onemkl::cublas::dot),
+    ONEMKL_TABLE_ENTRY(ddot_sycl, onemkl::cublas::dot),
+    ONEMKL_TABLE_ENTRY(dsdot_sycl, onemkl::cublas::dot),
+    ONEMKL_TABLE_ENTRY(cdotc_sycl, onemkl::cublas::dotc),
+    ONEMKL_TABLE_ENTRY(zdotc_sycl, onemkl::cublas::dotc),
+    ONEMKL_TABLE_ENTRY(cdotu_sycl, onemkl::cublas::dotu),
+    ONEMKL_TABLE_ENTRY(zdotu_sycl, onemkl::cublas::dotu),
+    ONEMKL_TABLE_ENTRY(isamin_sycl, onemkl::cublas::iamin),
+    ONEMKL_TABLE_ENTRY(idamin_sycl, onemkl::cublas::iamin),
+    ONEMKL_TABLE_ENTRY(icamin_sycl, onemkl::cublas::iamin),
+    ONEMKL_TABLE_ENTRY(izamin_sycl, onemkl::cublas::iamin),
+    ONEMKL_TABLE_ENTRY(isamax_sycl, onemkl::cublas::iamax),
+    ONEMKL_TABLE_ENTRY(idamax_sycl, onemkl::cublas::iamax),
+    ONEMKL_TABLE_ENTRY(icamax_sycl, onemkl::cublas::iamax),
+    ONEMKL_TABLE_ENTRY(izamax_sycl, onemkl::cublas::iamax),
+    ONEMKL_TABLE_ENTRY(snrm2_sycl, onemkl::cublas::nrm2),
+    ONEMKL_TABLE_ENTRY(dnrm2_sycl, onemkl::cublas::nrm2),
+    ONEMKL_TABLE_ENTRY(scnrm2_sycl, onemkl::cublas::nrm2),
+    ONEMKL_TABLE_ENTRY(dznrm2_sycl, onemkl::cublas::nrm2),
+    ONEMKL_TABLE_ENTRY(srot_sycl, onemkl::cublas::rot),
+    ONEMKL_TABLE_ENTRY(drot_sycl, onemkl::cublas::rot),
+    ONEMKL_TABLE_ENTRY(csrot_sycl, onemkl::cublas::rot),
+    ONEMKL_TABLE_ENTRY(zdrot_sycl, onemkl::cublas::rot),
+    ONEMKL_TABLE_ENTRY(srotg_sycl, onemkl::cublas::rotg),
+    ONEMKL_TABLE_ENTRY(drotg_sycl, onemkl::cublas::rotg),
+    ONEMKL_TABLE_ENTRY(crotg_sycl, onemkl::cublas::rotg),
+    ONEMKL_TABLE_ENTRY(zrotg_sycl, onemkl::cublas::rotg),
+    ONEMKL_TABLE_ENTRY(srotm_sycl, onemkl::cublas::rotm),
+    ONEMKL_TABLE_ENTRY(drotm_sycl, onemkl::cublas::rotm),
+    ONEMKL_TABLE_ENTRY(srotmg_sycl, onemkl::cublas::rotmg),
+    ONEMKL_TABLE_ENTRY(drotmg_sycl, onemkl::cublas::rotmg),
+    ONEMKL_TABLE_ENTRY(sscal_sycl, onemkl::cublas::scal),
+    ONEMKL_TABLE_ENTRY(dscal_sycl, onemkl::cublas::scal),
+    ONEMKL_TABLE_ENTRY(cscal_sycl, onemkl::cublas::scal),
+    ONEMKL_TABLE_ENTRY(csscal_sycl, onemkl::cublas::scal),
+    ONEMKL_TABLE_ENTRY(zscal_sycl, onemkl::cublas::scal),
+    ONEMKL_TABLE_ENTRY(zdscal_sycl, onemkl::cublas::scal),
+    ONEMKL_TABLE_ENTRY(sdsdot_sycl, onemkl::cublas::sdsdot),
+    ONEMKL_TABLE_ENTRY(sswap_sycl, onemkl::cublas::swap),
+    ONEMKL_TABLE_ENTRY(dswap_sycl, onemkl::cublas::swap),
+    ONEMKL_TABLE_ENTRY(cswap_sycl, onemkl::cublas::swap),
+    ONEMKL_TABLE_ENTRY(zswap_sycl, onemkl::cublas::swap),
+    ONEMKL_TABLE_ENTRY(sgbmv_sycl, onemkl::cublas::gbmv),
+    ONEMKL_TABLE_ENTRY(dgbmv_sycl, onemkl::cublas::gbmv),
+    ONEMKL_TABLE_ENTRY(cgbmv_sycl, onemkl::cublas::gbmv),
+    ONEMKL_TABLE_ENTRY(zgbmv_sycl, onemkl::cublas::gbmv),
+    ONEMKL_TABLE_ENTRY(sgemv_sycl, onemkl::cublas::gemv),
+    ONEMKL_TABLE_ENTRY(dgemv_sycl, onemkl::cublas::gemv),
+    ONEMKL_TABLE_ENTRY(cgemv_sycl, onemkl::cublas::gemv),
+    ONEMKL_TABLE_ENTRY(zgemv_sycl, onemkl::cublas::gemv),
+    ONEMKL_TABLE_ENTRY(sger_sycl, onemkl::cublas::ger),
+    ONEMKL_TABLE_ENTRY(dger_sycl, onemkl::cublas::ger),
+    ONEMKL_TABLE_ENTRY(cgerc_sycl, onemkl::cublas::gerc),
+    ONEMKL_TABLE_ENTRY(zgerc_sycl, onemkl::cublas::gerc),
+    ONEMKL_TABLE_ENTRY(cgeru_sycl, onemkl::cublas::geru),
+    ONEMKL_TABLE_ENTRY(zgeru_sycl, onemkl::cublas::geru),
+    ONEMKL_TABLE_ENTRY(chbmv_sycl, onemkl::cublas::hbmv),
+    ONEMKL_TABLE_ENTRY(zhbmv_sycl, onemkl::cublas::hbmv),
+    ONEMKL_TABLE_ENTRY(chemv_sycl, onemkl::cublas::hemv),
+    ONEMKL_TABLE_ENTRY(zhemv_sycl, onemkl::cublas::hemv),
+    ONEMKL_TABLE_ENTRY(cher_sycl, onemkl::cublas::her),
+    ONEMKL_TABLE_ENTRY(zher_sycl, onemkl::cublas::her),
+    ONEMKL_TABLE_ENTRY(cher2_sycl, onemkl::cublas::her2),
+    ONEMKL_TABLE_ENTRY(zher2_sycl, onemkl::cublas::her2),
+    ONEMKL_TABLE_ENTRY(chpmv_sycl, onemkl::cublas::hpmv),
+    ONEMKL_TABLE_ENTRY(zhpmv_sycl, onemkl::cublas::hpmv),
+    ONEMKL_TABLE_ENTRY(chpr_sycl, onemkl::cublas::hpr),
+    ONEMKL_TABLE_ENTRY(zhpr_sycl, onemkl::cublas::hpr),
+    ONEMKL_TABLE_ENTRY(chpr2_sycl, onemkl::cublas::hpr2),
+    ONEMKL_TABLE_ENTRY(zhpr2_sycl, onemkl::cublas::hpr2),
+    ONEMKL_TABLE_ENTRY(ssbmv_sycl, onemkl::cublas::sbmv),
+    ONEMKL_TABLE_ENTRY(dsbmv_sycl, onemkl::cublas::sbmv),
+    ONEMKL_TABLE_ENTRY(sspmv_sycl, onemkl::cublas::spmv),
+    ONEMKL_TABLE_ENTRY(dspmv_sycl, onemkl::cublas::spmv),
+    ONEMKL_TABLE_ENTRY(sspr_sycl, onemkl::cublas::spr),
+    ONEMKL_TABLE_ENTRY(dspr_sycl, onemkl::cublas::spr),
+    ONEMKL_TABLE_ENTRY(sspr2_sycl, onemkl::cublas::spr2),
+    ONEMKL_TABLE_ENTRY(dspr2_sycl, onemkl::cublas::spr2),
+    ONEMKL_TABLE_ENTRY(ssymv_sycl, onemkl::cublas::symv),
+    ONEMKL_TABLE_ENTRY(dsymv_sycl, onemkl::cublas::symv),
+    ONEMKL_TABLE_ENTRY(ssyr_sycl, onemkl::cublas::syr),
+    ONEMKL_TABLE_ENTRY(dsyr_sycl, onemkl::cublas::syr),
+    ONEMKL_TABLE_ENTRY(ssyr2_sycl, onemkl::cublas::syr2),
+    ONEMKL_TABLE_ENTRY(dsyr2_sycl, onemkl::cublas::syr2),
+    ONEMKL_TABLE_ENTRY(stbmv_sycl, onemkl::cublas::tbmv),
+    ONEMKL_TABLE_ENTRY(dtbmv_sycl, onemkl::cublas::tbmv),
+    ONEMKL_TABLE_ENTRY(ctbmv_sycl, onemkl::cublas::tbmv),
+    ONEMKL_TABLE_ENTRY(ztbmv_sycl, onemkl::cublas::tbmv),
+    ONEMKL_TABLE_ENTRY(stbsv_sycl, onemkl::cublas::tbsv),
+    ONEMKL_TABLE_ENTRY(dtbsv_sycl, onemkl::cublas::tbsv),
+    ONEMKL_TABLE_ENTRY(ctbsv_sycl, onemkl::cublas::tbsv),
+    ONEMKL_TABLE_ENTRY(ztbsv_sycl, onemkl::cublas::tbsv),
+    ONEMKL_TABLE_ENTRY(stpmv_sycl, onemkl::cublas::tpmv),
+    ONEMKL_TABLE_ENTRY(dtpmv_sycl, onemkl::cublas::tpmv),
+    ONEMKL_TABLE_ENTRY(ctpmv_sycl, onemkl::cublas::tpmv),
+    ONEMKL_TABLE_ENTRY(ztpmv_sycl, onemkl::cublas::tpmv),
+    ONEMKL_TABLE_ENTRY(stpsv_sycl, onemkl::cublas::tpsv),
+    ONEMKL_TABLE_ENTRY(dtpsv_sycl, onemkl::cublas::tpsv),
+    ONEMKL_TABLE_ENTRY(ctpsv_sycl, onemkl::cublas::tpsv),
+    ONEMKL_TABLE_ENTRY(ztpsv_sycl, onemkl::cublas::tpsv),
+    ONEMKL_TABLE_ENTRY(strmv_sycl, onemkl::cublas::trmv),
+    ONEMKL_TABLE_ENTRY(dtrmv_sycl, onemkl::cublas::trmv),
+    ONEMKL_TABLE_ENTRY(ctrmv_sycl, onemkl::cublas::trmv),
+    ONEMKL_TABLE_ENTRY(ztrmv_sycl, onemkl::cublas::trmv),
+    ONEMKL_TABLE_ENTRY(strsv_sycl, onemkl::cublas::trsv),
+    ONEMKL_TABLE_ENTRY(dtrsv_sycl, onemkl::cublas::trsv),
+    ONEMKL_TABLE_ENTRY(ctrsv_sycl, onemkl::cublas::trsv),
+    ONEMKL_TABLE_ENTRY(ztrsv_sycl, onemkl::cublas::trsv),
+    ONEMKL_TABLE_ENTRY(sgemm_sycl, onemkl::cublas::gemm),
+    ONEMKL_TABLE_ENTRY(dgemm_sycl, onemkl::cublas::gemm),
+    ONEMKL_TABLE_ENTRY(cgemm_sycl, onemkl::cublas::gemm),
+    ONEMKL_TABLE_ENTRY(zgemm_sycl, onemkl::cublas::gemm),
+    ONEMKL_TABLE_ENTRY(hgemm_sycl, onemkl::cublas::gemm),
+    ONEMKL_TABLE_ENTRY(chemm_sycl, onemkl::cublas::hemm),
+    ONEMKL_TABLE_ENTRY(zhemm_sycl, onemkl::cublas::hemm),
+    ONEMKL_TABLE_ENTRY(cherk_sycl, onemkl::cublas::herk),
+    ONEMKL_TABLE_ENTRY(zherk_sycl, onemkl::cublas::herk),
+    ONEMKL_TABLE_ENTRY(cher2k_sycl, onemkl::cublas::her2k),
+    ONEMKL_TABLE_ENTRY(zher2k_sycl, onemkl::cublas::her2k),
+    ONEMKL_TABLE_ENTRY(ssymm_sycl, onemkl::cublas::symm),
+    ONEMKL_TABLE_ENTRY(dsymm_sycl, onemkl::cublas::symm),
+    ONEMKL_TABLE_ENTRY(csymm_sycl, onemkl::cublas::symm),
+    ONEMKL_TABLE_ENTRY(zsymm_sycl, onemkl::cublas::symm),
+    ONEMKL_TABLE_ENTRY(ssyrk_sycl, onemkl::cublas::syrk),
+    ONEMKL_TABLE_ENTRY(dsyrk_sycl, onemkl::cublas::syrk),
+    ONEMKL_TABLE_ENTRY(csyrk_sycl, onemkl::cublas::syrk),
+    ONEMKL_TABLE_ENTRY(zsyrk_sycl, onemkl::cublas::syrk),
+    ONEMKL_TABLE_ENTRY(ssyr2k_sycl, onemkl::cublas::syr2k),
+    ONEMKL_TABLE_ENTRY(dsyr2k_sycl, onemkl::cublas::syr2k),
+    ONEMKL_TABLE_ENTRY(csyr2k_sycl, onemkl::cublas::syr2k),
+    ONEMKL_TABLE_ENTRY(zsyr2k_sycl, onemkl::cublas::syr2k),
+    ONEMKL_TABLE_ENTRY(strmm_sycl, onemkl::cublas::trmm),
+    ONEMKL_TABLE_ENTRY(dtrmm_sycl, onemkl::cublas::trmm),
+    ONEMKL_TABLE_ENTRY(ctrmm_sycl, onemkl::cublas::trmm),
+    ONEMKL_TABLE_ENTRY(ztrmm_sycl, onemkl::cublas::trmm),
+    ONEMKL_TABLE_ENTRY(strsm_sycl, onemkl::cublas::trsm),
+    ONEMKL_TABLE_ENTRY(dtrsm_sycl, onemkl::cublas::trsm),
+    ONEMKL_TABLE_ENTRY(ctrsm_sycl, onemkl::cublas::trsm),
+    ONEMKL_TABLE_ENTRY(ztrsm_sycl, onemkl::cublas::trsm),
+    ONEMKL_TABLE_ENTRY(sgemm_batch_strided_sycl, onemkl::cublas::gemm_batch),
+    ONEMKL_TABLE_ENTRY(dgemm_batch_strided_sycl, onemkl::cublas::gemm_batch),
+    ONEMKL_TABLE_ENTRY(cgemm_batch_strided_sycl, onemkl::cublas::gemm_batch),
+    ONEMKL_TABLE_ENTRY(zgemm_batch_strided_sycl, onemkl::cublas::gemm_batch),
+    ONEMKL_TABLE_ENTRY(strsm_batch_strided_sycl, onemkl::cublas::trsm_batch),
+    ONEMKL_TABLE_ENTRY(dtrsm_batch_strided_sycl, onemkl::cublas::trsm_batch),
+    ONEMKL_TABLE_ENTRY(ctrsm_batch_strided_sycl, onemkl::cublas::trsm_batch),
+    ONEMKL_TABLE_ENTRY(ztrsm_batch_strided_sycl, onemkl::cublas::trsm_batch),
+    ONEMKL_TABLE_ENTRY(sgemmt_sycl, onemkl::cublas::gemmt),
+    ONEMKL_TABLE_ENTRY(dgemmt_sycl, onemkl::cublas::gemmt),
+    ONEMKL_TABLE_ENTRY(cgemmt_sycl, onemkl::cublas::gemmt),
+    ONEMKL_TABLE_ENTRY(zgemmt_sycl, onemkl::cublas::gemmt),
+    ONEMKL_TABLE_ENTRY(gemm_f16f16f32_ext_sycl, onemkl::cublas::gemm_ext),
+    ONEMKL_TABLE_ENTRY(gemm_s8u8s32_ext_sycl, onemkl::cublas::gemm_ext),
+    ONEMKL_TABLE_ENTRY(sgemm_ext_sycl, onemkl::cublas::gemm_ext),
+    ONEMKL_TABLE_ENTRY(dgemm_ext_sycl, onemkl::cublas::gemm_ext),
+    ONEMKL_TABLE_ENTRY(cgemm_ext_sycl, onemkl::cublas::gemm_ext),
+    ONEMKL_TABLE_ENTRY(zgemm_ext_sycl, onemkl::cublas::gemm_ext),
+    ONEMKL_TABLE_ENTRY(hgemm_ext_sycl, onemkl::cublas::gemm_ext),
+    ONEMKL_TABLE_ENTRY(scasum_usm_sycl, onemkl::cublas::asum),
+    ONEMKL_TABLE_ENTRY(dzasum_usm_sycl, onemkl::cublas::asum),
+    ONEMKL_TABLE_ENTRY(sasum_usm_sycl, onemkl::cublas::asum),
+    ONEMKL_TABLE_ENTRY(dasum_usm_sycl, onemkl::cublas::asum),
+    ONEMKL_TABLE_ENTRY(saxpy_usm_sycl, onemkl::cublas::axpy),
+    ONEMKL_TABLE_ENTRY(daxpy_usm_sycl, onemkl::cublas::axpy),
+    ONEMKL_TABLE_ENTRY(caxpy_usm_sycl, onemkl::cublas::axpy),
+    ONEMKL_TABLE_ENTRY(zaxpy_usm_sycl, onemkl::cublas::axpy),
+    ONEMKL_TABLE_ENTRY(saxpy_batch_group_usm_sycl, onemkl::cublas::axpy_batch),
+    ONEMKL_TABLE_ENTRY(daxpy_batch_group_usm_sycl, onemkl::cublas::axpy_batch),
+    ONEMKL_TABLE_ENTRY(caxpy_batch_group_usm_sycl, onemkl::cublas::axpy_batch),
+    ONEMKL_TABLE_ENTRY(zaxpy_batch_group_usm_sycl, onemkl::cublas::axpy_batch),
+    ONEMKL_TABLE_ENTRY(scopy_usm_sycl, onemkl::cublas::copy),
+    ONEMKL_TABLE_ENTRY(dcopy_usm_sycl, onemkl::cublas::copy),
+    ONEMKL_TABLE_ENTRY(ccopy_usm_sycl, onemkl::cublas::copy),
+    ONEMKL_TABLE_ENTRY(zcopy_usm_sycl, onemkl::cublas::copy),
+    ONEMKL_TABLE_ENTRY(sdot_usm_sycl, onemkl::cublas::dot),
+    ONEMKL_TABLE_ENTRY(ddot_usm_sycl, onemkl::cublas::dot),
+    ONEMKL_TABLE_ENTRY(dsdot_usm_sycl, onemkl::cublas::dot),
+    ONEMKL_TABLE_ENTRY(cdotc_usm_sycl, onemkl::cublas::dotc),
+    ONEMKL_TABLE_ENTRY(zdotc_usm_sycl, onemkl::cublas::dotc),
+    ONEMKL_TABLE_ENTRY(cdotu_usm_sycl, onemkl::cublas::dotu),
+    ONEMKL_TABLE_ENTRY(zdotu_usm_sycl, onemkl::cublas::dotu),
+    ONEMKL_TABLE_ENTRY(isamin_usm_sycl, onemkl::cublas::iamin),
+    ONEMKL_TABLE_ENTRY(idamin_usm_sycl, onemkl::cublas::iamin),
+    ONEMKL_TABLE_ENTRY(icamin_usm_sycl, onemkl::cublas::iamin),
+    ONEMKL_TABLE_ENTRY(izamin_usm_sycl, onemkl::cublas::iamin),
+    ONEMKL_TABLE_ENTRY(isamax_usm_sycl, onemkl::cublas::iamax),
+    ONEMKL_TABLE_ENTRY(idamax_usm_sycl, onemkl::cublas::iamax),
+    ONEMKL_TABLE_ENTRY(icamax_usm_sycl, onemkl::cublas::iamax),
+    ONEMKL_TABLE_ENTRY(izamax_usm_sycl, onemkl::cublas::iamax),
+    ONEMKL_TABLE_ENTRY(snrm2_usm_sycl, onemkl::cublas::nrm2),
+    ONEMKL_TABLE_ENTRY(dnrm2_usm_sycl, onemkl::cublas::nrm2),
+    ONEMKL_TABLE_ENTRY(scnrm2_usm_sycl, onemkl::cublas::nrm2),
+    ONEMKL_TABLE_ENTRY(dznrm2_usm_sycl, onemkl::cublas::nrm2),
+    ONEMKL_TABLE_ENTRY(srot_usm_sycl, onemkl::cublas::rot),
+    ONEMKL_TABLE_ENTRY(drot_usm_sycl, onemkl::cublas::rot),
+    ONEMKL_TABLE_ENTRY(csrot_usm_sycl, onemkl::cublas::rot),
+    ONEMKL_TABLE_ENTRY(zdrot_usm_sycl, onemkl::cublas::rot),
+    ONEMKL_TABLE_ENTRY(srotg_usm_sycl, onemkl::cublas::rotg),
+    ONEMKL_TABLE_ENTRY(drotg_usm_sycl, onemkl::cublas::rotg),
+    ONEMKL_TABLE_ENTRY(crotg_usm_sycl, onemkl::cublas::rotg),
+    ONEMKL_TABLE_ENTRY(zrotg_usm_sycl, onemkl::cublas::rotg),
+    ONEMKL_TABLE_ENTRY(srotm_usm_sycl, onemkl::cublas::rotm),
+    ONEMKL_TABLE_ENTRY(drotm_usm_sycl, onemkl::cublas::rotm),
+    ONEMKL_TABLE_ENTRY(srotmg_usm_sycl, onemkl::cublas::rotmg),
+    ONEMKL_TABLE_ENTRY(drotmg_usm_sycl, onemkl::cublas::rotmg),
+    ONEMKL_TABLE_ENTRY(sscal_usm_sycl, onemkl::cublas::scal),
+    ONEMKL_TABLE_ENTRY(dscal_usm_sycl, onemkl::cublas::scal),
+    ONEMKL_TABLE_ENTRY(cscal_usm_sycl, onemkl::cublas::scal),
+    ONEMKL_TABLE_ENTRY(csscal_usm_sycl, onemkl::cublas::scal),
+    ONEMKL_TABLE_ENTRY(zscal_usm_sycl, onemkl::cublas::scal),
+    ONEMKL_TABLE_ENTRY(zdscal_usm_sycl, onemkl::cublas::scal),
+    ONEMKL_TABLE_ENTRY(sdsdot_usm_sycl, onemkl::cublas::sdsdot),
+    ONEMKL_TABLE_ENTRY(sswap_usm_sycl, onemkl::cublas::swap),
+    ONEMKL_TABLE_ENTRY(dswap_usm_sycl, onemkl::cublas::swap),
+    ONEMKL_TABLE_ENTRY(cswap_usm_sycl, onemkl::cublas::swap),
+    ONEMKL_TABLE_ENTRY(zswap_usm_sycl, onemkl::cublas::swap),
+    ONEMKL_TABLE_ENTRY(sgbmv_usm_sycl, onemkl::cublas::gbmv),
+    ONEMKL_TABLE_ENTRY(dgbmv_usm_sycl, onemkl::cublas::gbmv),
+    ONEMKL_TABLE_ENTRY(cgbmv_usm_sycl, onemkl::cublas::gbmv),
+    ONEMKL_TABLE_ENTRY(zgbmv_usm_sycl, onemkl::cublas::gbmv),
+    ONEMKL_TABLE_ENTRY(sgemv_usm_sycl, onemkl::cublas::gemv),
+    ONEMKL_TABLE_ENTRY(dgemv_usm_sycl, onemkl::cublas::gemv),
+    ONEMKL_TABLE_ENTRY(cgemv_usm_sycl, onemkl::cublas::gemv),
+    ONEMKL_TABLE_ENTRY(zgemv_usm_sycl, onemkl::cublas::gemv),
+    ONEMKL_TABLE_ENTRY(sger_usm_sycl, onemkl::cublas::ger),
+    ONEMKL_TABLE_ENTRY(dger_usm_sycl, onemkl::cublas::ger),
+    ONEMKL_TABLE_ENTRY(cgerc_usm_sycl, onemkl::cublas::gerc),
+    ONEMKL_TABLE_ENTRY(zgerc_usm_sycl, onemkl::cublas::gerc),
+    ONEMKL_TABLE_ENTRY(cgeru_usm_sycl, onemkl::cublas::geru),
+    ONEMKL_TABLE_ENTRY(zgeru_usm_sycl, onemkl::cublas::geru),
+    ONEMKL_TABLE_ENTRY(chbmv_usm_sycl, onemkl::cublas::hbmv),
+    ONEMKL_TABLE_ENTRY(zhbmv_usm_sycl, onemkl::cublas::hbmv),
+    ONEMKL_TABLE_ENTRY(chemv_usm_sycl, onemkl::cublas::hemv),
+    ONEMKL_TABLE_ENTRY(zhemv_usm_sycl, onemkl::cublas::hemv),
+    ONEMKL_TABLE_ENTRY(cher_usm_sycl, onemkl::cublas::her),
+    ONEMKL_TABLE_ENTRY(zher_usm_sycl, onemkl::cublas::her),
+    ONEMKL_TABLE_ENTRY(cher2_usm_sycl, onemkl::cublas::her2),
+    ONEMKL_TABLE_ENTRY(zher2_usm_sycl, onemkl::cublas::her2),
+    ONEMKL_TABLE_ENTRY(chpmv_usm_sycl, onemkl::cublas::hpmv),
+    ONEMKL_TABLE_ENTRY(zhpmv_usm_sycl, onemkl::cublas::hpmv),
+    ONEMKL_TABLE_ENTRY(chpr_usm_sycl, onemkl::cublas::hpr),
+    ONEMKL_TABLE_ENTRY(zhpr_usm_sycl, onemkl::cublas::hpr),
+    ONEMKL_TABLE_ENTRY(chpr2_usm_sycl, onemkl::cublas::hpr2),
+    ONEMKL_TABLE_ENTRY(zhpr2_usm_sycl, onemkl::cublas::hpr2),
+    ONEMKL_TABLE_ENTRY(ssbmv_usm_sycl, onemkl::cublas::sbmv),
+    ONEMKL_TABLE_ENTRY(dsbmv_usm_sycl, onemkl::cublas::sbmv),
+    ONEMKL_TABLE_ENTRY(sspmv_usm_sycl, onemkl::cublas::spmv),
+    ONEMKL_TABLE_ENTRY(dspmv_usm_sycl, onemkl::cublas::spmv),
+    ONEMKL_TABLE_ENTRY(sspr_usm_sycl, onemkl::cublas::spr),
+    ONEMKL_TABLE_ENTRY(dspr_usm_sycl, onemkl::cublas::spr),
+    ONEMKL_TABLE_ENTRY(sspr2_usm_sycl, onemkl::cublas::spr2),
+    ONEMKL_TABLE_ENTRY(dspr2_usm_sycl, onemkl::cublas::spr2),
+    ONEMKL_TABLE_ENTRY(ssymv_usm_sycl, onemkl::cublas::symv),
+    ONEMKL_TABLE_ENTRY(dsymv_usm_sycl, onemkl::cublas::symv),
+    ONEMKL_TABLE_ENTRY(ssyr_usm_sycl, onemkl::cublas::syr),
+    ONEMKL_TABLE_ENTRY(dsyr_usm_sycl, onemkl::cublas::syr),
+    ONEMKL_TABLE_ENTRY(ssyr2_usm_sycl, onemkl::cublas::syr2),
+    ONEMKL_TABLE_ENTRY(dsyr2_usm_sycl, onemkl::cublas::syr2),
+    ONEMKL_TABLE_ENTRY(stbmv_usm_sycl, onemkl::cublas::tbmv),
+    ONEMKL_TABLE_ENTRY(dtbmv_usm_sycl, onemkl::cublas::tbmv),
+    ONEMKL_TABLE_ENTRY(ctbmv_usm_sycl, onemkl::cublas::tbmv),
+    ONEMKL_TABLE_ENTRY(ztbmv_usm_sycl, onemkl::cublas::tbmv),
+    ONEMKL_TABLE_ENTRY(stbsv_usm_sycl, onemkl::cublas::tbsv),
+    ONEMKL_TABLE_ENTRY(dtbsv_usm_sycl, onemkl::cublas::tbsv),
+    ONEMKL_TABLE_ENTRY(ctbsv_usm_sycl, onemkl::cublas::tbsv),
+    ONEMKL_TABLE_ENTRY(ztbsv_usm_sycl, onemkl::cublas::tbsv),
+    ONEMKL_TABLE_ENTRY(stpmv_usm_sycl, onemkl::cublas::tpmv),
+    ONEMKL_TABLE_ENTRY(dtpmv_usm_sycl, onemkl::cublas::tpmv),
+    ONEMKL_TABLE_ENTRY(ctpmv_usm_sycl, onemkl::cublas::tpmv),
+    ONEMKL_TABLE_ENTRY(ztpmv_usm_sycl, onemkl::cublas::tpmv),
+    ONEMKL_TABLE_ENTRY(stpsv_usm_sycl, onemkl::cublas::tpsv),
+    ONEMKL_TABLE_ENTRY(dtpsv_usm_sycl, onemkl::cublas::tpsv),
+    ONEMKL_TABLE_ENTRY(ctpsv_usm_sycl, onemkl::cublas::tpsv),
+    ONEMKL_TABLE_ENTRY(ztpsv_usm_sycl, onemkl::cublas::tpsv),
+    ONEMKL_TABLE_ENTRY(strmv_usm_sycl, onemkl::cublas::trmv),
+    ONEMKL_TABLE_ENTRY(dtrmv_usm_sycl, onemkl::cublas::trmv),
+    ONEMKL_TABLE_ENTRY(ctrmv_usm_sycl, onemkl::cublas::trmv),
+    ONEMKL_TABLE_ENTRY(ztrmv_usm_sycl, onemkl::cublas::trmv),
+    ONEMKL_TABLE_ENTRY(strsv_usm_sycl, onemkl::cublas::trsv),
+    ONEMKL_TABLE_ENTRY(dtrsv_usm_sycl, onemkl::cublas::trsv),
+    ONEMKL_TABLE_ENTRY(ctrsv_usm_sycl, onemkl::cublas::trsv),
+    ONEMKL_TABLE_ENTRY(ztrsv_usm_sycl, onemkl::cublas::trsv),
+    ONEMKL_TABLE_ENTRY(sgemm_usm_sycl, onemkl::cublas::gemm),
+    ONEMKL_TABLE_ENTRY(dgemm_usm_sycl, onemkl::cublas::gemm),
+    ONEMKL_TABLE_ENTRY(cgemm_usm_sycl, onemkl::cublas::gemm),
+    ONEMKL_TABLE_ENTRY(zgemm_usm_sycl, onemkl::cublas::gemm),
+    ONEMKL_TABLE_ENTRY(chemm_usm_sycl, onemkl::cublas::hemm),
+    ONEMKL_TABLE_ENTRY(zhemm_usm_sycl, onemkl::cublas::hemm),
+    ONEMKL_TABLE_ENTRY(cherk_usm_sycl, onemkl::cublas::herk),
+    ONEMKL_TABLE_ENTRY(zherk_usm_sycl, onemkl::cublas::herk),
+    ONEMKL_TABLE_ENTRY(cher2k_usm_sycl, onemkl::cublas::her2k),
+    ONEMKL_TABLE_ENTRY(zher2k_usm_sycl, onemkl::cublas::her2k),
+    ONEMKL_TABLE_ENTRY(ssymm_usm_sycl, onemkl::cublas::symm),
+    ONEMKL_TABLE_ENTRY(dsymm_usm_sycl, onemkl::cublas::symm),
+    ONEMKL_TABLE_ENTRY(csymm_usm_sycl, onemkl::cublas::symm),
+    ONEMKL_TABLE_ENTRY(zsymm_usm_sycl, onemkl::cublas::symm),
+    ONEMKL_TABLE_ENTRY(ssyrk_usm_sycl, onemkl::cublas::syrk),
+    ONEMKL_TABLE_ENTRY(dsyrk_usm_sycl, onemkl::cublas::syrk),
+    ONEMKL_TABLE_ENTRY(csyrk_usm_sycl, onemkl::cublas::syrk),
+    ONEMKL_TABLE_ENTRY(zsyrk_usm_sycl, onemkl::cublas::syrk),
+    ONEMKL_TABLE_ENTRY(ssyr2k_usm_sycl, onemkl::cublas::syr2k),
+    ONEMKL_TABLE_ENTRY(dsyr2k_usm_sycl, onemkl::cublas::syr2k),
+    ONEMKL_TABLE_ENTRY(csyr2k_usm_sycl, onemkl::cublas::syr2k),
+    ONEMKL_TABLE_ENTRY(zsyr2k_usm_sycl, onemkl::cublas::syr2k),
+    ONEMKL_TABLE_ENTRY(strmm_usm_sycl, onemkl::cublas::trmm),
+    ONEMKL_TABLE_ENTRY(dtrmm_usm_sycl, onemkl::cublas::trmm),
+    ONEMKL_TABLE_ENTRY(ctrmm_usm_sycl, onemkl::cublas::trmm),
+    ONEMKL_TABLE_ENTRY(ztrmm_usm_sycl, onemkl::cublas::trmm),
+    ONEMKL_TABLE_ENTRY(strsm_usm_sycl, onemkl::cublas::trsm),
+    ONEMKL_TABLE_ENTRY(dtrsm_usm_sycl, onemkl::cublas::trsm),
+    ONEMKL_TABLE_ENTRY(ctrsm_usm_sycl, onemkl::cublas::trsm),
+    ONEMKL_TABLE_ENTRY(ztrsm_usm_sycl, onemkl::cublas::trsm),
+    ONEMKL_TABLE_ENTRY(sgemm_batch_group_usm_sycl, onemkl::cublas::gemm_batch),
+    ONEMKL_TABLE_ENTRY(dgemm_batch_group_usm_sycl, onemkl::cublas::gemm_batch),
+    ONEMKL_TABLE_ENTRY(cgemm_batch_group_usm_sycl, onemkl::cublas::gemm_batch),
+    ONEMKL_TABLE_ENTRY(zgemm_batch_group_usm_sycl, onemkl::cublas::gemm_batch),
+    ONEMKL_TABLE_ENTRY(sgemm_batch_strided_usm_sycl, onemkl::cublas::gemm_batch),
+    ONEMKL_TABLE_ENTRY(dgemm_batch_strided_usm_sycl, onemkl::cublas::gemm_batch),
+    ONEMKL_TABLE_ENTRY(cgemm_batch_strided_usm_sycl, onemkl::cublas::gemm_batch),
+    ONEMKL_TABLE_ENTRY(zgemm_batch_strided_usm_sycl, onemkl::cublas::gemm_batch),
+    ONEMKL_TABLE_ENTRY(sgemmt_usm_sycl, onemkl::cublas::gemmt),
+    ONEMKL_TABLE_ENTRY(dgemmt_usm_sycl, onemkl::cublas::gemmt),
+    ONEMKL_TABLE_ENTRY(cgemmt_usm_sycl, onemkl::cublas::gemmt),
+    ONEMKL_TABLE_ENTRY(zgemmt_usm_sycl, onemkl::cublas::gemmt),
+};
+
+extern "C" function_index_t WRAPPER_TABLE = {
+    WRAPPER_VERSION, sizeof(wrapper_entries) / sizeof(wrapper_entries[0]), wrapper_entries
 };
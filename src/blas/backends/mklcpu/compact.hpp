@@ -0,0 +1,296 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+
+#ifndef _COMPACT_HPP_
+#define _COMPACT_HPP_
+
+#include <complex>
+#include <cstdint>
+
+namespace onemkl {
+namespace mklcpu {
+
+// Compact layout: the matrices of a batch are interleaved in packs of
+//  compact_lanes, so that element (i, j) of all the matrices of a pack is
+//  contiguous and one vector instruction works on many matrices. In a pack,
+//  element (i, j) is at offset i + j * ld, counted in vectors of compact_lanes
+//  elements. Complex vectors hold the real parts of their lanes, then the
+//  imaginary parts. Must match onemkl::blas::compact_lanes.
+static constexpr int64_t compact_lanes = 16;
+
+namespace compact_impl {
+
+template <typename T>
+struct traits {
+    typedef T real;
+    static constexpr int64_t components = 1;
+};
+template <typename R>
+struct traits<std::complex<R>> {
+    typedef R real;
+    static constexpr int64_t components = 2;
+};
+
+static inline float re(float v) {
+    return v;
+}
+static inline double re(double v) {
+    return v;
+}
+template <typename R>
+static inline R re(std::complex<R> v) {
+    return v.real();
+}
+
+static inline float im(float) {
+    return 0;
+}
+static inline double im(double) {
+    return 0;
+}
+template <typename R>
+static inline R im(std::complex<R> v) {
+    return v.imag();
+}
+
+static inline void put(float *e, float v) {
+    e[0] = v;
+}
+static inline void put(double *e, double v) {
+    e[0] = v;
+}
+template <typename R>
+static inline void put(R *e, std::complex<R> v) {
+    e[0]             = v.real();
+    e[compact_lanes] = v.imag();
+}
+
+static inline void get(const float *e, float &v) {
+    v = e[0];
+}
+static inline void get(const double *e, double &v) {
+    v = e[0];
+}
+template <typename R>
+static inline void get(const R *e, std::complex<R> &v) {
+    v = std::complex<R>(e[0], e[compact_lanes]);
+}
+
+// x -= a * y on all lanes, with a conjugated if conj.
+template <int64_t C, typename R>
+static inline void sub_mul(R *x, const R *a, const R *y, bool conj) {
+    if (C == 1) {
+        for (int64_t q = 0; q < compact_lanes; q++)
+            x[q] -= a[q] * y[q];
+        return;
+    }
+    R s = conj ? R(-1) : R(1);
+    for (int64_t q = 0; q < compact_lanes; q++) {
+        R ar = a[q], ai = s * a[compact_lanes + q];
+        R yr = y[q], yi = y[compact_lanes + q];
+        x[q] -= ar * yr - ai * yi;
+        x[compact_lanes + q] -= ar * yi + ai * yr;
+    }
+}
+
+// x /= d on all lanes, with d conjugated if conj.
+template <int64_t C, typename R>
+static inline void div(R *x, const R *d, bool conj) {
+    if (C == 1) {
+        for (int64_t q = 0; q < compact_lanes; q++)
+            x[q] /= d[q];
+        return;
+    }
+    R s = conj ? R(-1) : R(1);
+    for (int64_t q = 0; q < compact_lanes; q++) {
+        R dr = d[q], di = s * d[compact_lanes + q];
+        R xr = x[q], xi = x[compact_lanes + q];
+        R scale              = R(1) / (dr * dr + di * di);
+        x[q]                 = (xr * dr + xi * di) * scale;
+        x[compact_lanes + q] = (xi * dr - xr * di) * scale;
+    }
+}
+
+// x = alpha * x on all lanes.
+template <int64_t C, typename R>
+static inline void scal(R *x, R alpha_re, R alpha_im) {
+    if (C == 1) {
+        for (int64_t q = 0; q < compact_lanes; q++)
+            x[q] *= alpha_re;
+        return;
+    }
+    for (int64_t q = 0; q < compact_lanes; q++) {
+        R xr = x[q], xi = x[compact_lanes + q];
+        x[q]                 = alpha_re * xr - alpha_im * xi;
+        x[compact_lanes + q] = alpha_re * xi + alpha_im * xr;
+    }
+}
+
+} // namespace compact_impl
+
+// The kernels below work on pack p of the batch. Lanes past batch_size are
+//  zero after packing and are computed like the others, but never unpacked.
+
+// Copy matrices a[i] (rows x cols, leading dimension lda) into pack p of ap.
+template <typename T>
+static void compact_pack(int64_t p, int64_t rows, int64_t cols, const T *const *a, int64_t lda,
+                         T *ap, int64_t ldap, int64_t batch_size) {
+    typedef typename compact_impl::traits<T>::real R;
+    const int64_t S = compact_lanes * compact_impl::traits<T>::components;
+    R *base         = reinterpret_cast<R *>(ap) + p * ldap * cols * S;
+    for (int64_t l = 0; l < compact_lanes; l++) {
+        int64_t b = p * compact_lanes + l;
+        for (int64_t j = 0; j < cols; j++) {
+            for (int64_t i = 0; i < rows; i++)
+                compact_impl::put(base + (i + j * ldap) * S + l,
+                                  (b < batch_size) ? a[b][i + j * lda] : T(0));
+        }
+    }
+}
+
+// Copy pack p of ap back into the matrices a[i].
+template <typename T>
+static void compact_unpack(int64_t p, int64_t rows, int64_t cols, const T *ap, int64_t ldap,
+                           T *const *a, int64_t lda, int64_t batch_size) {
+    typedef typename compact_impl::traits<T>::real R;
+    const int64_t S = compact_lanes * compact_impl::traits<T>::components;
+    const R *base   = reinterpret_cast<const R *>(ap) + p * ldap * cols * S;
+    for (int64_t l = 0; l < compact_lanes && p * compact_lanes + l < batch_size; l++) {
+        T *dst = a[p * compact_lanes + l];
+        for (int64_t j = 0; j < cols; j++) {
+            for (int64_t i = 0; i < rows; i++)
+                compact_impl::get(base + (i + j * ldap) * S + l, dst[i + j * lda]);
+        }
+    }
+}
+
+// C = alpha * op(A) * op(B) + beta * C on pack p. C is not read when beta is 0.
+template <typename T>
+static void compact_gemm(int64_t p, bool trans_a, bool conj_a, bool trans_b, bool conj_b,
+                         int64_t m, int64_t n, int64_t k, T alpha, const T *ap, int64_t ldap,
+                         const T *bp, int64_t ldbp, T beta, T *cp, int64_t ldcp) {
+    typedef typename compact_impl::traits<T>::real R;
+    const int64_t C = compact_impl::traits<T>::components;
+    const int64_t S = compact_lanes * C;
+    const R *a      = reinterpret_cast<const R *>(ap) + p * ldap * (trans_a ? m : k) * S;
+    const R *b      = reinterpret_cast<const R *>(bp) + p * ldbp * (trans_b ? k : n) * S;
+    R *c            = reinterpret_cast<R *>(cp) + p * ldcp * n * S;
+    R alpha_re = compact_impl::re(alpha), alpha_im = compact_impl::im(alpha);
+    R beta_re = compact_impl::re(beta), beta_im = compact_impl::im(beta);
+    bool beta_zero = beta_re == R(0) && beta_im == R(0);
+
+    R acc[2 * compact_lanes];
+    for (int64_t j = 0; j < n; j++) {
+        for (int64_t i = 0; i < m; i++) {
+            for (int64_t q = 0; q < S; q++)
+                acc[q] = R(0);
+            for (int64_t l = 0; l < k; l++) {
+                const R *ae = a + (trans_a ? l + i * ldap : i + l * ldap) * S;
+                const R *be = b + (trans_b ? j + l * ldbp : l + j * ldbp) * S;
+                if (C == 1) {
+                    for (int64_t q = 0; q < compact_lanes; q++)
+                        acc[q] += ae[q] * be[q];
+                    continue;
+                }
+                R sa = conj_a ? R(-1) : R(1), sb = conj_b ? R(-1) : R(1);
+                for (int64_t q = 0; q < compact_lanes; q++) {
+                    R ar = ae[q], ai = sa * ae[compact_lanes + q];
+                    R br = be[q], bi = sb * be[compact_lanes + q];
+                    acc[q] += ar * br - ai * bi;
+                    acc[compact_lanes + q] += ar * bi + ai * br;
+                }
+            }
+            R *ce = c + (i + j * ldcp) * S;
+            compact_impl::scal<C>(acc, alpha_re, alpha_im);
+            if (!beta_zero)
+                compact_impl::scal<C>(ce, beta_re, beta_im);
+            else {
+                for (int64_t q = 0; q < S; q++)
+                    ce[q] = R(0);
+            }
+            for (int64_t q = 0; q < S; q++)
+                ce[q] += acc[q];
+        }
+    }
+}
+
+// Solve op(A) * X = alpha * B (left) or X * op(A) = alpha * B (right) on pack
+//  p, overwriting B with X.
+template <typename T>
+static void compact_trsm(int64_t p, bool left, bool upper, bool trans, bool conj, bool unit,
+                         int64_t m, int64_t n, T alpha, const T *ap, int64_t ldap, T *bp,
+                         int64_t ldbp) {
+    typedef typename compact_impl::traits<T>::real R;
+    const int64_t C = compact_impl::traits<T>::components;
+    const int64_t S = compact_lanes * C;
+    int64_t k       = left ? m : n;
+    const R *a      = reinterpret_cast<const R *>(ap) + p * ldap * k * S;
+    R *b            = reinterpret_cast<R *>(bp) + p * ldbp * n * S;
+
+    // Element (i, j) of op(A), and of B.
+    auto op_a = [&](int64_t i, int64_t j) {
+        return a + (trans ? j + i * ldap : i + j * ldap) * S;
+    };
+    auto b_at = [&](int64_t i, int64_t j) {
+        return b + (i + j * ldbp) * S;
+    };
+    // op(A) is upper triangular when A is upper and not transposed, or the
+    //  other way around.
+    bool op_upper = upper != trans;
+
+    R alpha_re = compact_impl::re(alpha), alpha_im = compact_impl::im(alpha);
+    for (int64_t j = 0; j < n; j++) {
+        for (int64_t i = 0; i < m; i++)
+            compact_impl::scal<C>(b_at(i, j), alpha_re, alpha_im);
+    }
+
+    if (left) {
+        // Column j of X solves op(A) * x = b, by back or forward substitution.
+        for (int64_t j = 0; j < n; j++) {
+            for (int64_t t = 0; t < m; t++) {
+                int64_t i = op_upper ? m - 1 - t : t;
+                R *x      = b_at(i, j);
+                for (int64_t l = op_upper ? i + 1 : 0; l < (op_upper ? m : i); l++)
+                    compact_impl::sub_mul<C>(x, op_a(i, l), b_at(l, j), conj);
+                if (!unit)
+                    compact_impl::div<C>(x, op_a(i, i), conj);
+            }
+        }
+    }
+    else {
+        // Row i of X solves x * op(A) = b, from the first column of op(A)
+        //  when it is upper triangular, from the last one otherwise.
+        for (int64_t i = 0; i < m; i++) {
+            for (int64_t t = 0; t < n; t++) {
+                int64_t j = op_upper ? t : n - 1 - t;
+                R *x      = b_at(i, j);
+                for (int64_t l = op_upper ? 0 : j + 1; l < (op_upper ? j : n); l++)
+                    compact_impl::sub_mul<C>(x, op_a(l, j), b_at(i, l), conj);
+                if (!unit)
+                    compact_impl::div<C>(x, op_a(j, j), conj);
+            }
+        }
+    }
+}
+
+} // namespace mklcpu
+} // namespace onemkl
+
+#endif //_COMPACT_HPP_
@@ -18,13 +18,439 @@
 *******************************************************************************/
 
 #include <CL/sycl.hpp>
+#include <algorithm>
 
 #include "cpu_common.hpp"
+#include "cpu_schedule.hpp"
+#include "cpu_scratch.hpp"
+#include "cpu_stats.hpp"
+#include "mkl_version.h"
 #include "onemkl/blas/detail/mklcpu/onemkl_blas_mklcpu.hpp"
 
 namespace onemkl {
 namespace mklcpu {
 
+// Counts the arrays of per-problem or per-group arguments laid out for MKL's
+//  group routines, of bytes in total.
+static inline void count_batch_arrays(int64_t arrays, std::size_t bytes) {
+    stats_count(cpu_counter::batch_arrays, arrays);
+    stats_count(cpu_counter::batch_array_bytes, bytes);
+}
+
+// Strided batches
+
+// Single-problem and strided-batch MKL entry points, by data type.
+static inline void gemm_one(char transa, char transb, int64_t m, int64_t n, int64_t k, float alpha,
+                            const float *a, int64_t lda, const float *b, int64_t ldb, float beta,
+                            float *c, int64_t ldc) {
+    ::sgemm(&transa, &transb, (const MKL_INT *)&m, (const MKL_INT *)&n, (const MKL_INT *)&k, &alpha,
+            a, (const MKL_INT *)&lda, b, (const MKL_INT *)&ldb, &beta, c, (const MKL_INT *)&ldc);
+}
+
+static inline void gemm_one(char transa, char transb, int64_t m, int64_t n, int64_t k,
+                            double alpha, const double *a, int64_t lda, const double *b,
+                            int64_t ldb, double beta, double *c, int64_t ldc) {
+    ::dgemm(&transa, &transb, (const MKL_INT *)&m, (const MKL_INT *)&n, (const MKL_INT *)&k, &alpha,
+            a, (const MKL_INT *)&lda, b, (const MKL_INT *)&ldb, &beta, c, (const MKL_INT *)&ldc);
+}
+
+static inline void gemm_one(char transa, char transb, int64_t m, int64_t n, int64_t k,
+                            std::complex<float> alpha, const std::complex<float> *a, int64_t lda,
+                            const std::complex<float> *b, int64_t ldb, std::complex<float> beta,
+                            std::complex<float> *c, int64_t ldc) {
+    ::cgemm(&transa, &transb, (const MKL_INT *)&m, (const MKL_INT *)&n, (const MKL_INT *)&k, &alpha,
+            a, (const MKL_INT *)&lda, b, (const MKL_INT *)&ldb, &beta, c, (const MKL_INT *)&ldc);
+}
+
+static inline void gemm_one(char transa, char transb, int64_t m, int64_t n, int64_t k,
+                            std::complex<double> alpha, const std::complex<double> *a, int64_t lda,
+                            const std::complex<double> *b, int64_t ldb, std::complex<double> beta,
+                            std::complex<double> *c, int64_t ldc) {
+    ::zgemm(&transa, &transb, (const MKL_INT *)&m, (const MKL_INT *)&n, (const MKL_INT *)&k, &alpha,
+            a, (const MKL_INT *)&lda, b, (const MKL_INT *)&ldb, &beta, c, (const MKL_INT *)&ldc);
+}
+
+#if INTEL_MKL_VERSION >= 20200002
+static inline void gemm_strided(char transa, char transb, int64_t m, int64_t n, int64_t k,
+                                float alpha, const float *a, int64_t lda, int64_t stride_a,
+                                const float *b, int64_t ldb, int64_t stride_b, float beta, float *c,
+                                int64_t ldc, int64_t stride_c, int64_t batch_size) {
+    ::sgemm_batch_strided(&transa, &transb, (const MKL_INT *)&m, (const MKL_INT *)&n,
+                          (const MKL_INT *)&k, &alpha, a, (const MKL_INT *)&lda,
+                          (const MKL_INT *)&stride_a, b, (const MKL_INT *)&ldb,
+                          (const MKL_INT *)&stride_b, &beta, c, (const MKL_INT *)&ldc,
+                          (const MKL_INT *)&stride_c, (const MKL_INT *)&batch_size);
+}
+
+static inline void gemm_strided(char transa, char transb, int64_t m, int64_t n, int64_t k,
+                                double alpha, const double *a, int64_t lda, int64_t stride_a,
+                                const double *b, int64_t ldb, int64_t stride_b, double beta,
+                                double *c, int64_t ldc, int64_t stride_c, int64_t batch_size) {
+    ::dgemm_batch_strided(&transa, &transb, (const MKL_INT *)&m, (const MKL_INT *)&n,
+                          (const MKL_INT *)&k, &alpha, a, (const MKL_INT *)&lda,
+                          (const MKL_INT *)&stride_a, b, (const MKL_INT *)&ldb,
+                          (const MKL_INT *)&stride_b, &beta, c, (const MKL_INT *)&ldc,
+                          (const MKL_INT *)&stride_c, (const MKL_INT *)&batch_size);
+}
+
+static inline void gemm_strided(char transa, char transb, int64_t m, int64_t n, int64_t k,
+                                std::complex<float> alpha, const std::complex<float> *a,
+                                int64_t lda, int64_t stride_a, const std::complex<float> *b,
+                                int64_t ldb, int64_t stride_b, std::complex<float> beta,
+                                std::complex<float> *c, int64_t ldc, int64_t stride_c,
+                                int64_t batch_size) {
+    ::cgemm_batch_strided(&transa, &transb, (const MKL_INT *)&m, (const MKL_INT *)&n,
+                          (const MKL_INT *)&k, &alpha, a, (const MKL_INT *)&lda,
+                          (const MKL_INT *)&stride_a, b, (const MKL_INT *)&ldb,
+                          (const MKL_INT *)&stride_b, &beta, c, (const MKL_INT *)&ldc,
+                          (const MKL_INT *)&stride_c, (const MKL_INT *)&batch_size);
+}
+
+static inline void gemm_strided(char transa, char transb, int64_t m, int64_t n, int64_t k,
+                                std::complex<double> alpha, const std::complex<double> *a,
+                                int64_t lda, int64_t stride_a, const std::complex<double> *b,
+                                int64_t ldb, int64_t stride_b, std::complex<double> beta,
+                                std::complex<double> *c, int64_t ldc, int64_t stride_c,
+                                int64_t batch_size) {
+    ::zgemm_batch_strided(&transa, &transb, (const MKL_INT *)&m, (const MKL_INT *)&n,
+                          (const MKL_INT *)&k, &alpha, a, (const MKL_INT *)&lda,
+                          (const MKL_INT *)&stride_a, b, (const MKL_INT *)&ldb,
+                          (const MKL_INT *)&stride_b, &beta, c, (const MKL_INT *)&ldc,
+                          (const MKL_INT *)&stride_c, (const MKL_INT *)&batch_size);
+}
+#endif
+
+// A batch whose problems all share A, with the B and C matrices laid out next
+//  to each other, is one GEMM with n * batch_size columns. op(B_i) are next to
+//  each other when the B_i are (nontrans), or when the B_i are stacked on top
+//  of each other (trans). Likewise a batch sharing B, with the op(A_i) and C_i
+//  stacked on top of each other, is one GEMM with m * batch_size rows.
+static inline bool is_shared_a_batch(char transb, int64_t n, int64_t ldb, int64_t stride_a,
+                                     int64_t stride_b, int64_t ldc, int64_t stride_c,
+                                     int64_t batch_size) {
+    if (stride_a != 0 || stride_c != ldc * n)
+        return false;
+    if (transb == 'N')
+        return stride_b == ldb * n;
+    return stride_b == n && ldb >= n * batch_size;
+}
+
+static inline bool is_shared_b_batch(char transa, int64_t m, int64_t lda, int64_t stride_a,
+                                     int64_t stride_b, int64_t ldc, int64_t stride_c,
+                                     int64_t batch_size) {
+    if (stride_b != 0 || stride_c != m || ldc < m * batch_size)
+        return false;
+    if (transa == 'N')
+        return stride_a == m && lda >= m * batch_size;
+    return stride_a == lda * m;
+}
+
+// Strided gemm_batch without expanding the strides into pointer arrays.
+//  Batches sharing an operand are collapsed into one GEMM when the layout
+//  allows it (see above). Problems that all update the same C
+//  (stride_c == 0) run one after the other, in order. Otherwise the batch
+//  goes to MKL's strided batch routine, which also accepts broadcast A or B
+//  (stride 0), or with older MKL to a parallel loop computing each problem's
+//  pointers on the fly.
+template <typename T>
+static void gemm_batch_strided(char transa, char transb, int64_t m, int64_t n, int64_t k, T alpha,
+                               const T *a, int64_t lda, int64_t stride_a, const T *b, int64_t ldb,
+                               int64_t stride_b, T beta, T *c, int64_t ldc, int64_t stride_c,
+                               int64_t batch_size) {
+    if (batch_size <= 0)
+        return;
+    if (batch_size > 1) {
+        if (is_shared_a_batch(transb, n, ldb, stride_a, stride_b, ldc, stride_c, batch_size)) {
+            gemm_one(transa, transb, m, n * batch_size, k, alpha, a, lda, b, ldb, beta, c, ldc);
+            return;
+        }
+        if (is_shared_b_batch(transa, m, lda, stride_a, stride_b, ldc, stride_c, batch_size)) {
+            gemm_one(transa, transb, m * batch_size, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+            return;
+        }
+    }
+    if (stride_c == 0 && batch_size > 1) {
+        for (int64_t i = 0; i < batch_size; i++)
+            gemm_one(transa, transb, m, n, k, alpha, a + i * stride_a, lda, b + i * stride_b, ldb,
+                     beta, c, ldc);
+        return;
+    }
+#if INTEL_MKL_VERSION >= 20200002
+    gemm_strided(transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
+                 stride_c, batch_size);
+#else
+    parallel_for(0, batch_size, [&](int64_t i) {
+        gemm_one(transa, transb, m, n, k, alpha, a + i * stride_a, lda, b + i * stride_b, ldb,
+                 beta, c + i * stride_c, ldc);
+    });
+#endif
+}
+
+// Group-batch MKL entry points, by data type.
+static inline void gemm_group(const char *transa, const char *transb, const int64_t *m,
+                              const int64_t *n, const int64_t *k, const float *alpha,
+                              const float **a, const int64_t *lda, const float **b,
+                              const int64_t *ldb, const float *beta, float **c, const int64_t *ldc,
+                              int64_t group_count, const int64_t *group_size) {
+    ::sgemm_batch(transa, transb, (const MKL_INT *)m, (const MKL_INT *)n, (const MKL_INT *)k, alpha,
+                  a, (const MKL_INT *)lda, b, (const MKL_INT *)ldb, beta, c, (const MKL_INT *)ldc,
+                  (const MKL_INT *)&group_count, (const MKL_INT *)group_size);
+}
+
+static inline void gemm_group(const char *transa, const char *transb, const int64_t *m,
+                              const int64_t *n, const int64_t *k, const double *alpha,
+                              const double **a, const int64_t *lda, const double **b,
+                              const int64_t *ldb, const double *beta, double **c,
+                              const int64_t *ldc, int64_t group_count, const int64_t *group_size) {
+    ::dgemm_batch(transa, transb, (const MKL_INT *)m, (const MKL_INT *)n, (const MKL_INT *)k, alpha,
+                  a, (const MKL_INT *)lda, b, (const MKL_INT *)ldb, beta, c, (const MKL_INT *)ldc,
+                  (const MKL_INT *)&group_count, (const MKL_INT *)group_size);
+}
+
+static inline void gemm_group(const char *transa, const char *transb, const int64_t *m,
+                              const int64_t *n, const int64_t *k, const std::complex<float> *alpha,
+                              const std::complex<float> **a, const int64_t *lda,
+                              const std::complex<float> **b, const int64_t *ldb,
+                              const std::complex<float> *beta, std::complex<float> **c,
+                              const int64_t *ldc, int64_t group_count, const int64_t *group_size) {
+    ::cgemm_batch(transa, transb, (const MKL_INT *)m, (const MKL_INT *)n, (const MKL_INT *)k, alpha,
+                  a, (const MKL_INT *)lda, b, (const MKL_INT *)ldb, beta, c, (const MKL_INT *)ldc,
+                  (const MKL_INT *)&group_count, (const MKL_INT *)group_size);
+}
+
+static inline void gemm_group(const char *transa, const char *transb, const int64_t *m,
+                              const int64_t *n, const int64_t *k, const std::complex<double> *alpha,
+                              const std::complex<double> **a, const int64_t *lda,
+                              const std::complex<double> **b, const int64_t *ldb,
+                              const std::complex<double> *beta, std::complex<double> **c,
+                              const int64_t *ldc, int64_t group_count, const int64_t *group_size) {
+    ::zgemm_batch(transa, transb, (const MKL_INT *)m, (const MKL_INT *)n, (const MKL_INT *)k, alpha,
+                  a, (const MKL_INT *)lda, b, (const MKL_INT *)ldb, beta, c, (const MKL_INT *)ldc,
+                  (const MKL_INT *)&group_count, (const MKL_INT *)group_size);
+}
+
+// Group gemm_batch, spread over the threads by schedule_batch(), largest
+//  problems first, or run by MKL when there is a single thread.
+template <typename T>
+static void gemm_batch_group(const char *transa, const char *transb, const int64_t *m,
+                             const int64_t *n, const int64_t *k, const T *alpha, const T **a,
+                             const int64_t *lda, const T **b, const int64_t *ldb, const T *beta,
+                             T **c, const int64_t *ldc, int64_t group_count,
+                             const int64_t *group_size) {
+    auto work = [&](int64_t g) {
+        return double(m[g]) * double(n[g]) * double(k[g]);
+    };
+    auto run = [&](int64_t g, int64_t i) {
+        gemm_one(transa[g], transb[g], m[g], n[g], k[g], alpha[g], a[i], lda[g], b[i], ldb[g],
+                 beta[g], c[i], ldc[g]);
+    };
+    if (!schedule_batch(group_count, group_size, work, run))
+        gemm_group(transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
+                   group_size);
+}
+
+// Group trsm_batch MKL entry points, by data type.
+static inline void trsm_group(const char *left_right, const char *upper_lower, const char *trans,
+                              const char *unit_diag, const int64_t *m, const int64_t *n,
+                              const float *alpha, const float **a, const int64_t *lda, float **b,
+                              const int64_t *ldb, int64_t group_count, const int64_t *group_size) {
+    ::strsm_batch(left_right, upper_lower, trans, unit_diag, (const MKL_INT *)m, (const MKL_INT *)n,
+                  alpha, a, (const MKL_INT *)lda, b, (const MKL_INT *)ldb,
+                  (const MKL_INT *)&group_count, (const MKL_INT *)group_size);
+}
+
+static inline void trsm_group(const char *left_right, const char *upper_lower, const char *trans,
+                              const char *unit_diag, const int64_t *m, const int64_t *n,
+                              const double *alpha, const double **a, const int64_t *lda, double **b,
+                              const int64_t *ldb, int64_t group_count, const int64_t *group_size) {
+    ::dtrsm_batch(left_right, upper_lower, trans, unit_diag, (const MKL_INT *)m, (const MKL_INT *)n,
+                  alpha, a, (const MKL_INT *)lda, b, (const MKL_INT *)ldb,
+                  (const MKL_INT *)&group_count, (const MKL_INT *)group_size);
+}
+
+static inline void trsm_group(const char *left_right, const char *upper_lower, const char *trans,
+                              const char *unit_diag, const int64_t *m, const int64_t *n,
+                              const std::complex<float> *alpha, const std::complex<float> **a,
+                              const int64_t *lda, std::complex<float> **b, const int64_t *ldb,
+                              int64_t group_count, const int64_t *group_size) {
+    ::ctrsm_batch(left_right, upper_lower, trans, unit_diag, (const MKL_INT *)m, (const MKL_INT *)n,
+                  alpha, a, (const MKL_INT *)lda, b, (const MKL_INT *)ldb,
+                  (const MKL_INT *)&group_count, (const MKL_INT *)group_size);
+}
+
+static inline void trsm_group(const char *left_right, const char *upper_lower, const char *trans,
+                              const char *unit_diag, const int64_t *m, const int64_t *n,
+                              const std::complex<double> *alpha, const std::complex<double> **a,
+                              const int64_t *lda, std::complex<double> **b, const int64_t *ldb,
+                              int64_t group_count, const int64_t *group_size) {
+    ::ztrsm_batch(left_right, upper_lower, trans, unit_diag, (const MKL_INT *)m, (const MKL_INT *)n,
+                  alpha, a, (const MKL_INT *)lda, b, (const MKL_INT *)ldb,
+                  (const MKL_INT *)&group_count, (const MKL_INT *)group_size);
+}
+
+// Strided trsm_batch, as a single group for MKL's group routine, with the
+//  problems' pointers laid out in scratch memory.
+template <typename T>
+static void trsm_batch_strided(char left_right, char upper_lower, char trans, char unit_diag,
+                               int64_t m, int64_t n, T alpha, const T *a, int64_t lda,
+                               int64_t stride_a, T *b, int64_t ldb, int64_t stride_b,
+                               int64_t batch_size) {
+    if (batch_size <= 0)
+        return;
+    scratch_buffer scratch(scratch_routine::trsm_batch, 2 * sizeof(T *) * batch_size);
+    const T **a_array = scratch.get<const T *>();
+    if (a_array == NULL) {
+        std::cout << "Error cannot allocate input arrays\n";
+        return;
+    }
+    T **b_array = (T **)(a_array + batch_size);
+    count_batch_arrays(2, 2 * sizeof(T *) * batch_size);
+    for (int64_t i = 0; i < batch_size; i++) {
+        a_array[i] = a + i * stride_a;
+        b_array[i] = b + i * stride_b;
+    }
+    trsm_group(&left_right, &upper_lower, &trans, &unit_diag, &m, &n, &alpha, a_array, &lda,
+               b_array, &ldb, 1, &batch_size);
+}
+
+// Single axpy, by data type.
+static inline void axpy_one(int64_t n, float alpha, const float *x, int64_t incx, float *y,
+                            int64_t incy) {
+    ::saxpy((const MKL_INT *)&n, &alpha, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy);
+}
+
+static inline void axpy_one(int64_t n, double alpha, const double *x, int64_t incx, double *y,
+                            int64_t incy) {
+    ::daxpy((const MKL_INT *)&n, &alpha, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy);
+}
+
+static inline void axpy_one(int64_t n, std::complex<float> alpha, const std::complex<float> *x,
+                            int64_t incx, std::complex<float> *y, int64_t incy) {
+    ::caxpy((const MKL_INT *)&n, &alpha, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy);
+}
+
+static inline void axpy_one(int64_t n, std::complex<double> alpha, const std::complex<double> *x,
+                            int64_t incx, std::complex<double> *y, int64_t incy) {
+    ::zaxpy((const MKL_INT *)&n, &alpha, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy);
+}
+
+// Vector i of a batch, from an array of pointers or at a fixed stride.
+//  distinct(count) is false when two of the first count vectors are the same
+//  one; vectors that are not the same must not overlap.
+template <typename T>
+struct pointer_vectors {
+    T *const *ptrs;
+    T *operator()(int64_t i) const {
+        return ptrs[i];
+    }
+    bool distinct(int64_t count) const {
+        scratch_buffer scratch(scratch_routine::axpy_batch, sizeof(T *) * count);
+        T **sorted = scratch.get<T *>();
+        if (sorted == nullptr)
+            return false;
+        std::copy(ptrs, ptrs + count, sorted);
+        std::sort(sorted, sorted + count);
+        return std::adjacent_find(sorted, sorted + count) == sorted + count;
+    }
+};
+
+template <typename T>
+struct strided_vectors {
+    T *base;
+    int64_t stride;
+    T *operator()(int64_t i) const {
+        return base + i * stride;
+    }
+    bool distinct(int64_t) const {
+        return stride != 0;
+    }
+};
+
+// Elements [begin, end) of the n-element vector x, as a vector of their own
+//  with the same increment.
+template <typename T>
+static inline T *subvector(T *x, int64_t n, int64_t inc, int64_t begin, int64_t end) {
+    return (inc >= 0) ? x + begin * inc : x + (n - end) * -inc;
+}
+
+// Smallest number of elements worth a task of its own.
+static constexpr int64_t axpy_batch_grain = 16384;
+
+template <typename T, typename X, typename Y>
+static void axpy_batch_serial(int64_t group_count, const int64_t *n, const T *alpha, X x,
+                              const int64_t *incx, Y y, const int64_t *incy,
+                              const int64_t *group_size) {
+    int64_t offset = 0;
+    for (int64_t g = 0; g < group_count; g++) {
+        for (int64_t j = 0; j < group_size[g]; j++)
+            axpy_one(n[g], alpha[g], x(offset + j), incx[g], y(offset + j), incy[g]);
+        offset += group_size[g];
+    }
+}
+
+// Batched axpy, in the group layout (strided batches are a single group).
+//  The elements of all the vectors, one after the other, are split into
+//  chunks of about equal length run by a parallel loop, so that a few long
+//  vectors do not leave the other threads idle, and a chunk may end in the
+//  middle of a vector. Chunks find their first vector by binary search in the
+//  groups' element offsets. Batches where some y has a zero increment, or
+//  where a y vector appears more than once, run serially, in problem order.
+template <typename T, typename X, typename Y>
+static void axpy_batch_balanced(int64_t group_count, const int64_t *n, const T *alpha, X x,
+                                const int64_t *incx, Y y, const int64_t *incy,
+                                const int64_t *group_size) {
+    int64_t total   = 0;
+    int64_t count   = 0;
+    bool splittable = true;
+    for (int64_t g = 0; g < group_count; g++) {
+        count += group_size[g];
+        if (n[g] > 0 && group_size[g] > 0) {
+            total += n[g] * group_size[g];
+            splittable = splittable && incy[g] != 0;
+        }
+    }
+    int64_t chunks = std::min(4 * max_concurrency(), total / axpy_batch_grain);
+    if (chunks <= 1 || !splittable || !y.distinct(count)) {
+        axpy_batch_serial(group_count, n, alpha, x, incx, y, incy, group_size);
+        return;
+    }
+
+    scratch_buffer scratch(scratch_routine::axpy_batch, 2 * sizeof(int64_t) * (group_count + 1));
+    int64_t *start = scratch.get<int64_t>();
+    if (start == nullptr) {
+        axpy_batch_serial(group_count, n, alpha, x, incx, y, incy, group_size);
+        return;
+    }
+
+    // start[g] is the first element of group g, first[g] its first vector.
+    int64_t *first = start + group_count + 1;
+    count_batch_arrays(2, 2 * sizeof(int64_t) * (group_count + 1));
+    start[0] = 0;
+    first[0] = 0;
+    for (int64_t g = 0; g < group_count; g++) {
+        start[g + 1] = start[g] + ((n[g] > 0) ? n[g] * group_size[g] : 0);
+        first[g + 1] = first[g] + group_size[g];
+    }
+
+    int64_t chunk = (total + chunks - 1) / chunks;
+    parallel_for(0, chunks, [&](int64_t c) {
+        int64_t begin = c * chunk;
+        int64_t end   = std::min(total, begin + chunk);
+        int64_t g     = std::upper_bound(start, start + group_count + 1, begin) - start - 1;
+        while (begin < end) {
+            int64_t offset = begin - start[g];
+            int64_t i      = first[g] + offset / n[g];
+            int64_t e      = offset % n[g];
+            int64_t e_end  = std::min(n[g], e + (end - begin));
+            axpy_one(e_end - e, alpha[g], subvector(x(i), n[g], incx[g], e, e_end), incx[g],
+                     subvector(y(i), n[g], incy[g], e, e_end), incy[g]);
+            begin += e_end - e;
+            while (begin < end && begin >= start[g + 1])
+                g++;
+        }
+    });
+}
+
 // Buffer APIs
 
 void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
@@ -38,42 +464,11 @@ void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int6
         auto c_acc   = c.get_access<cl::sycl::access::mode::read_write>(cgh);
         char transa_ = *fortran_char(transa);
         char transb_ = *fortran_char(transb);
-        MKL_INT one  = 1;
-
-        host_task<class mkl_kernel_init_sgemm_batch_stride>(cgh, [=]() {
-            float **a_array = (float **)::malloc(sizeof(float *) * batch_size);
-            float **b_array = (float **)::malloc(sizeof(float *) * batch_size);
-            float **c_array = (float **)::malloc(sizeof(float *) * batch_size);
-            if ((a_array == NULL) || (b_array == NULL) || (c_array == NULL)) {
-                std::cout << "Error cannot allocate input arrays\n";
-                ::free(a_array);
-                ::free(b_array);
-                ::free(c_array);
-                return;
-            }
-
-            for (int64_t i = 0; i < batch_size; i++) {
-                if (i == 0) {
-                    a_array[0] = a_acc.get_pointer();
-                    b_array[0] = b_acc.get_pointer();
-                    c_array[0] = c_acc.get_pointer();
-                }
-                else {
-                    a_array[i] = a_array[i - 1] + stride_a;
-                    b_array[i] = b_array[i - 1] + stride_b;
-                    c_array[i] = c_array[i - 1] + stride_c;
-                }
-            }
-
-            ::sgemm_batch(&transa_, &transb_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                          (const MKL_INT *)&k, &alpha, (const float **)a_array,
-                          (const MKL_INT *)&lda, (const float **)b_array, (const MKL_INT *)&ldb,
-                          &beta, c_array, (const MKL_INT *)&ldc, (const MKL_INT *)&one,
-                          (const MKL_INT *)&batch_size);
 
-            ::free(a_array);
-            ::free(b_array);
-            ::free(c_array);
+        host_task<class mkl_kernel_init_sgemm_batch_stride>(cgh, queue, [=]() {
+            gemm_batch_strided<float>(transa_, transb_, m, n, k, alpha, a_acc.get_pointer(), lda,
+                                      stride_a, b_acc.get_pointer(), ldb, stride_b, beta,
+                                      c_acc.get_pointer(), ldc, stride_c, batch_size);
         });
     });
 }
@@ -89,42 +484,11 @@ void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int6
         auto c_acc   = c.get_access<cl::sycl::access::mode::read_write>(cgh);
         char transa_ = *fortran_char(transa);
         char transb_ = *fortran_char(transb);
-        MKL_INT one  = 1;
-
-        host_task<class mkl_kernel_init_dgemm_batch_stride>(cgh, [=]() {
-            double **a_array = (double **)::malloc(sizeof(double *) * batch_size);
-            double **b_array = (double **)::malloc(sizeof(double *) * batch_size);
-            double **c_array = (double **)::malloc(sizeof(double *) * batch_size);
-            if ((a_array == NULL) || (b_array == NULL) || (c_array == NULL)) {
-                std::cout << "Error cannot allocate input arrays\n";
-                ::free(a_array);
-                ::free(b_array);
-                ::free(c_array);
-                return;
-            }
-
-            for (int64_t i = 0; i < batch_size; i++) {
-                if (i == 0) {
-                    a_array[0] = a_acc.get_pointer();
-                    b_array[0] = b_acc.get_pointer();
-                    c_array[0] = c_acc.get_pointer();
-                }
-                else {
-                    a_array[i] = a_array[i - 1] + stride_a;
-                    b_array[i] = b_array[i - 1] + stride_b;
-                    c_array[i] = c_array[i - 1] + stride_c;
-                }
-            }
-
-            ::dgemm_batch(&transa_, &transb_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                          (const MKL_INT *)&k, &alpha, (const double **)a_array,
-                          (const MKL_INT *)&lda, (const double **)b_array, (const MKL_INT *)&ldb,
-                          &beta, c_array, (const MKL_INT *)&ldc, (const MKL_INT *)&one,
-                          (const MKL_INT *)&batch_size);
 
-            ::free(a_array);
-            ::free(b_array);
-            ::free(c_array);
+        host_task<class mkl_kernel_init_dgemm_batch_stride>(cgh, queue, [=]() {
+            gemm_batch_strided<double>(transa_, transb_, m, n, k, alpha, a_acc.get_pointer(), lda,
+                                       stride_a, b_acc.get_pointer(), ldb, stride_b, beta,
+                                       c_acc.get_pointer(), ldc, stride_c, batch_size);
         });
     });
 }
@@ -141,42 +505,12 @@ void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int6
         auto c_acc   = c.get_access<cl::sycl::access::mode::read_write>(cgh);
         char transa_ = *fortran_char(transa);
         char transb_ = *fortran_char(transb);
-        MKL_INT one  = 1;
-
-        host_task<class mkl_kernel_init_cgemm_batch_stride>(cgh, [=]() {
-            MKL_Complex8 **a_array = (MKL_Complex8 **)::malloc(sizeof(MKL_Complex8 *) * batch_size);
-            MKL_Complex8 **b_array = (MKL_Complex8 **)::malloc(sizeof(MKL_Complex8 *) * batch_size);
-            MKL_Complex8 **c_array = (MKL_Complex8 **)::malloc(sizeof(MKL_Complex8 *) * batch_size);
-            if ((a_array == NULL) || (b_array == NULL) || (c_array == NULL)) {
-                std::cout << "Error cannot allocate input arrays\n";
-                ::free(a_array);
-                ::free(b_array);
-                ::free(c_array);
-                return;
-            }
-
-            for (int64_t i = 0; i < batch_size; i++) {
-                if (i == 0) {
-                    a_array[0] = a_acc.get_pointer();
-                    b_array[0] = b_acc.get_pointer();
-                    c_array[0] = c_acc.get_pointer();
-                }
-                else {
-                    a_array[i] = a_array[i - 1] + stride_a;
-                    b_array[i] = b_array[i - 1] + stride_b;
-                    c_array[i] = c_array[i - 1] + stride_c;
-                }
-            }
-
-            ::cgemm_batch(&transa_, &transb_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                          (const MKL_INT *)&k, &alpha, (const MKL_Complex8 **)a_array,
-                          (const MKL_INT *)&lda, (const MKL_Complex8 **)b_array,
-                          (const MKL_INT *)&ldb, &beta, c_array, (const MKL_INT *)&ldc,
-                          (const MKL_INT *)&one, (const MKL_INT *)&batch_size);
 
-            ::free(a_array);
-            ::free(b_array);
-            ::free(c_array);
+        host_task<class mkl_kernel_init_cgemm_batch_stride>(cgh, queue, [=]() {
+            gemm_batch_strided<std::complex<float>>(transa_, transb_, m, n, k, alpha,
+                                                    a_acc.get_pointer(), lda, stride_a,
+                                                    b_acc.get_pointer(), ldb, stride_b, beta,
+                                                    c_acc.get_pointer(), ldc, stride_c, batch_size);
         });
     });
 }
@@ -193,45 +527,13 @@ void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int6
         auto c_acc   = c.get_access<cl::sycl::access::mode::read_write>(cgh);
         char transa_ = *fortran_char(transa);
         char transb_ = *fortran_char(transb);
-        MKL_INT one  = 1;
-
-        host_task<class mkl_kernel_init_zgemm_batch_stride>(cgh, [=]() {
-            MKL_Complex16 **a_array =
-                (MKL_Complex16 **)::malloc(sizeof(MKL_Complex16 *) * batch_size);
-            MKL_Complex16 **b_array =
-                (MKL_Complex16 **)::malloc(sizeof(MKL_Complex16 *) * batch_size);
-            MKL_Complex16 **c_array =
-                (MKL_Complex16 **)::malloc(sizeof(MKL_Complex16 *) * batch_size);
-            if ((a_array == NULL) || (b_array == NULL) || (c_array == NULL)) {
-                std::cout << "Error cannot allocate input arrays\n";
-                ::free(a_array);
-                ::free(b_array);
-                ::free(c_array);
-                return;
-            }
-
-            for (int64_t i = 0; i < batch_size; i++) {
-                if (i == 0) {
-                    a_array[0] = a_acc.get_pointer();
-                    b_array[0] = b_acc.get_pointer();
-                    c_array[0] = c_acc.get_pointer();
-                }
-                else {
-                    a_array[i] = a_array[i - 1] + stride_a;
-                    b_array[i] = b_array[i - 1] + stride_b;
-                    c_array[i] = c_array[i - 1] + stride_c;
-                }
-            }
-
-            ::zgemm_batch(&transa_, &transb_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                          (const MKL_INT *)&k, &alpha, (const MKL_Complex16 **)a_array,
-                          (const MKL_INT *)&lda, (const MKL_Complex16 **)b_array,
-                          (const MKL_INT *)&ldb, &beta, c_array, (const MKL_INT *)&ldc,
-                          (const MKL_INT *)&one, (const MKL_INT *)&batch_size);
 
-            ::free(a_array);
-            ::free(b_array);
-            ::free(c_array);
+        host_task<class mkl_kernel_init_zgemm_batch_stride>(cgh, queue, [=]() {
+            gemm_batch_strided<std::complex<double>>(transa_, transb_, m, n, k, alpha,
+                                                     a_acc.get_pointer(), lda, stride_a,
+                                                     b_acc.get_pointer(), ldb, stride_b, beta,
+                                                     c_acc.get_pointer(), ldc, stride_c,
+                                                     batch_size);
         });
     });
 }
@@ -247,36 +549,11 @@ void trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_lower, trans
         char side_  = *fortran_char(left_right);
         char uplo_  = *fortran_char(upper_lower);
         char diag_  = *fortran_char(unit_diag);
-        MKL_INT one = 1;
-
-        host_task<class mkl_kernel_init_strsm_batch_stride>(cgh, [=]() {
-            float **a_array = (float **)::malloc(sizeof(float *) * batch_size);
-            float **b_array = (float **)::malloc(sizeof(float *) * batch_size);
-            if ((a_array == NULL) || (b_array == NULL)) {
-                std::cout << "Error cannot allocate input arrays\n";
-                ::free(a_array);
-                ::free(b_array);
-                return;
-            }
-
-            for (int64_t i = 0; i < batch_size; i++) {
-                if (i == 0) {
-                    a_array[0] = a_acc.get_pointer();
-                    b_array[0] = b_acc.get_pointer();
-                }
-                else {
-                    a_array[i] = a_array[i - 1] + stride_a;
-                    b_array[i] = b_array[i - 1] + stride_b;
-                }
-            }
 
-            ::strsm_batch(&side_, &uplo_, &trans_, &diag_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                          &alpha, (const float **)a_array, (const MKL_INT *)&lda, (float **)b_array,
-                          (const MKL_INT *)&ldb, (const MKL_INT *)&one,
-                          (const MKL_INT *)&batch_size);
-
-            ::free(a_array);
-            ::free(b_array);
+        host_task<class mkl_kernel_init_strsm_batch_stride>(cgh, queue, [=]() {
+            trsm_batch_strided<float>(side_, uplo_, trans_, diag_, m, n, alpha, a_acc.get_pointer(),
+                                      lda, stride_a, b_acc.get_pointer(), ldb, stride_b,
+                                      batch_size);
         });
     });
 }
@@ -292,36 +569,11 @@ void trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_lower, trans
         char side_  = *fortran_char(left_right);
         char uplo_  = *fortran_char(upper_lower);
         char diag_  = *fortran_char(unit_diag);
-        MKL_INT one = 1;
-
-        host_task<class mkl_kernel_init_dtrsm_batch_stride>(cgh, [=]() {
-            double **a_array = (double **)::malloc(sizeof(double *) * batch_size);
-            double **b_array = (double **)::malloc(sizeof(double *) * batch_size);
-            if ((a_array == NULL) || (b_array == NULL)) {
-                std::cout << "Error cannot allocate input arrays\n";
-                ::free(a_array);
-                ::free(b_array);
-                return;
-            }
-
-            for (int64_t i = 0; i < batch_size; i++) {
-                if (i == 0) {
-                    a_array[0] = a_acc.get_pointer();
-                    b_array[0] = b_acc.get_pointer();
-                }
-                else {
-                    a_array[i] = a_array[i - 1] + stride_a;
-                    b_array[i] = b_array[i - 1] + stride_b;
-                }
-            }
 
-            ::dtrsm_batch(&side_, &uplo_, &trans_, &diag_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                          &alpha, (const double **)a_array, (const MKL_INT *)&lda,
-                          (double **)b_array, (const MKL_INT *)&ldb, (const MKL_INT *)&one,
-                          (const MKL_INT *)&batch_size);
-
-            ::free(a_array);
-            ::free(b_array);
+        host_task<class mkl_kernel_init_dtrsm_batch_stride>(cgh, queue, [=]() {
+            trsm_batch_strided<double>(side_, uplo_, trans_, diag_, m, n, alpha,
+                                       a_acc.get_pointer(), lda, stride_a, b_acc.get_pointer(), ldb,
+                                       stride_b, batch_size);
         });
     });
 }
@@ -338,36 +590,11 @@ void trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_lower, trans
         char side_  = *fortran_char(left_right);
         char uplo_  = *fortran_char(upper_lower);
         char diag_  = *fortran_char(unit_diag);
-        MKL_INT one = 1;
-
-        host_task<class mkl_kernel_init_ctrsm_batch_stride>(cgh, [=]() {
-            MKL_Complex8 **a_array = (MKL_Complex8 **)::malloc(sizeof(MKL_Complex8 *) * batch_size);
-            MKL_Complex8 **b_array = (MKL_Complex8 **)::malloc(sizeof(MKL_Complex8 *) * batch_size);
-            if ((a_array == NULL) || (b_array == NULL)) {
-                std::cout << "Error cannot allocate input arrays\n";
-                ::free(a_array);
-                ::free(b_array);
-                return;
-            }
-
-            for (int64_t i = 0; i < batch_size; i++) {
-                if (i == 0) {
-                    a_array[0] = a_acc.get_pointer();
-                    b_array[0] = b_acc.get_pointer();
-                }
-                else {
-                    a_array[i] = a_array[i - 1] + stride_a;
-                    b_array[i] = b_array[i - 1] + stride_b;
-                }
-            }
 
-            ::ctrsm_batch(&side_, &uplo_, &trans_, &diag_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                          &alpha, (const MKL_Complex8 **)a_array, (const MKL_INT *)&lda,
-                          (MKL_Complex8 **)b_array, (const MKL_INT *)&ldb, (const MKL_INT *)&one,
-                          (const MKL_INT *)&batch_size);
-
-            ::free(a_array);
-            ::free(b_array);
+        host_task<class mkl_kernel_init_ctrsm_batch_stride>(cgh, queue, [=]() {
+            trsm_batch_strided<std::complex<float>>(side_, uplo_, trans_, diag_, m, n, alpha,
+                                                    a_acc.get_pointer(), lda, stride_a,
+                                                    b_acc.get_pointer(), ldb, stride_b, batch_size);
         });
     });
 }
@@ -384,37 +611,76 @@ void trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_lower, trans
         char side_  = *fortran_char(left_right);
         char uplo_  = *fortran_char(upper_lower);
         char diag_  = *fortran_char(unit_diag);
-        MKL_INT one = 1;
-        host_task<class mkl_kernel_init_ztrsm_batch_stride>(cgh, [=]() {
-            MKL_Complex16 **a_array =
-                (MKL_Complex16 **)::malloc(sizeof(MKL_Complex16 *) * batch_size);
-            MKL_Complex16 **b_array =
-                (MKL_Complex16 **)::malloc(sizeof(MKL_Complex16 *) * batch_size);
-            if ((a_array == NULL) || (b_array == NULL)) {
-                std::cout << "Error cannot allocate input arrays\n";
-                ::free(a_array);
-                ::free(b_array);
-                return;
-            }
 
-            for (int64_t i = 0; i < batch_size; i++) {
-                if (i == 0) {
-                    a_array[0] = a_acc.get_pointer();
-                    b_array[0] = b_acc.get_pointer();
-                }
-                else {
-                    a_array[i] = a_array[i - 1] + stride_a;
-                    b_array[i] = b_array[i - 1] + stride_b;
-                }
-            }
+        host_task<class mkl_kernel_init_ztrsm_batch_stride>(cgh, queue, [=]() {
+            trsm_batch_strided<std::complex<double>>(side_, uplo_, trans_, diag_, m, n, alpha,
+                                                     a_acc.get_pointer(), lda, stride_a,
+                                                     b_acc.get_pointer(), ldb, stride_b,
+                                                     batch_size);
+        });
+    });
+}
 
-            ::ztrsm_batch(&side_, &uplo_, &trans_, &diag_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                          &alpha, (const MKL_Complex16 **)a_array, (const MKL_INT *)&lda,
-                          (MKL_Complex16 **)b_array, (const MKL_INT *)&ldb, (const MKL_INT *)&one,
-                          (const MKL_INT *)&batch_size);
+void axpy_batch(cl::sycl::queue &queue, int64_t n, float alpha, cl::sycl::buffer<float, 1> &x,
+                int64_t incx, int64_t stridex, cl::sycl::buffer<float, 1> &y, int64_t incy,
+                int64_t stridey, int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto x_acc = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto y_acc = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_saxpy_batch_stride>(cgh, queue, [=]() {
+            axpy_batch_balanced(int64_t(1), &n, &alpha,
+                                strided_vectors<const float>{ x_acc.get_pointer(), stridex }, &incx,
+                                strided_vectors<float>{ y_acc.get_pointer(), stridey }, &incy,
+                                &batch_size);
+        });
+    });
+}
+
+void axpy_batch(cl::sycl::queue &queue, int64_t n, double alpha, cl::sycl::buffer<double, 1> &x,
+                int64_t incx, int64_t stridex, cl::sycl::buffer<double, 1> &y, int64_t incy,
+                int64_t stridey, int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto x_acc = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto y_acc = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_daxpy_batch_stride>(cgh, queue, [=]() {
+            axpy_batch_balanced(int64_t(1), &n, &alpha,
+                                strided_vectors<const double>{ x_acc.get_pointer(), stridex },
+                                &incx, strided_vectors<double>{ y_acc.get_pointer(), stridey },
+                                &incy, &batch_size);
+        });
+    });
+}
 
-            ::free(a_array);
-            ::free(b_array);
+void axpy_batch(cl::sycl::queue &queue, int64_t n, std::complex<float> alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &x, int64_t incx, int64_t stridex,
+                cl::sycl::buffer<std::complex<float>, 1> &y, int64_t incy, int64_t stridey,
+                int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto x_acc = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto y_acc = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_caxpy_batch_stride>(cgh, queue, [=]() {
+            axpy_batch_balanced(
+                int64_t(1), &n, &alpha,
+                strided_vectors<const std::complex<float>>{ x_acc.get_pointer(), stridex }, &incx,
+                strided_vectors<std::complex<float>>{ y_acc.get_pointer(), stridey }, &incy,
+                &batch_size);
+        });
+    });
+}
+
+void axpy_batch(cl::sycl::queue &queue, int64_t n, std::complex<double> alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &x, int64_t incx, int64_t stridex,
+                cl::sycl::buffer<std::complex<double>, 1> &y, int64_t incy, int64_t stridey,
+                int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto x_acc = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto y_acc = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_zaxpy_batch_stride>(cgh, queue, [=]() {
+            axpy_batch_balanced(
+                int64_t(1), &n, &alpha,
+                strided_vectors<const std::complex<double>>{ x_acc.get_pointer(), stridex }, &incx,
+                strided_vectors<std::complex<double>>{ y_acc.get_pointer(), stridey }, &incy,
+                &batch_size);
         });
     });
 }
@@ -431,25 +697,21 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose *transa, transpose
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_usm_sgemm>(cgh, [=]() {
-            char *transa_ = (char *)::malloc(sizeof(char) * group_count);
-            char *transb_ = (char *)::malloc(sizeof(char) * group_count);
-            if ((transa_ == NULL) || (transb_ == NULL)) {
+        host_task<class mkl_kernel_sgemm_batch_group_usm>(cgh, queue, [=]() {
+            scratch_buffer scratch(scratch_routine::gemm_batch, 2 * group_count);
+            char *transa_ = scratch.get<char>();
+            if (transa_ == NULL) {
                 std::cout << "Error cannot allocate trans arrays\n";
-                ::free(transa_);
-                ::free(transb_);
                 return;
             }
+            char *transb_ = transa_ + group_count;
+            count_batch_arrays(2, 2 * group_count);
             for (int64_t i = 0; i < group_count; i++) {
                 transa_[i] = *fortran_char(transa[i]);
                 transb_[i] = *fortran_char(transb[i]);
             }
-            ::sgemm_batch(transa_, transb_, (const MKL_INT *)m, (const MKL_INT *)n,
-                          (const MKL_INT *)k, alpha, (const float **)a, (const MKL_INT *)lda,
-                          (const float **)b, (const MKL_INT *)ldb, beta, c, (const MKL_INT *)ldc,
-                          (const MKL_INT *)&group_count, (const MKL_INT *)group_size);
-            ::free(transa_);
-            ::free(transb_);
+            gemm_batch_group(transa_, transb_, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                             group_count, group_size);
         });
     });
     return done;
@@ -465,25 +727,21 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose *transa, transpose
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_dgemm_batch_usm>(cgh, [=]() {
-            char *transa_ = (char *)::malloc(sizeof(char) * group_count);
-            char *transb_ = (char *)::malloc(sizeof(char) * group_count);
-            if ((transa_ == NULL) || (transb_ == NULL)) {
+        host_task<class mkl_kernel_dgemm_batch_group_usm>(cgh, queue, [=]() {
+            scratch_buffer scratch(scratch_routine::gemm_batch, 2 * group_count);
+            char *transa_ = scratch.get<char>();
+            if (transa_ == NULL) {
                 std::cout << "Error cannot allocate trans arrays\n";
-                ::free(transa_);
-                ::free(transb_);
                 return;
             }
+            char *transb_ = transa_ + group_count;
+            count_batch_arrays(2, 2 * group_count);
             for (int64_t i = 0; i < group_count; i++) {
                 transa_[i] = *fortran_char(transa[i]);
                 transb_[i] = *fortran_char(transb[i]);
             }
-            ::dgemm_batch(transa_, transb_, (const MKL_INT *)m, (const MKL_INT *)n,
-                          (const MKL_INT *)k, alpha, (const double **)a, (const MKL_INT *)lda,
-                          (const double **)b, (const MKL_INT *)ldb, beta, c, (const MKL_INT *)ldc,
-                          (const MKL_INT *)&group_count, (const MKL_INT *)group_size);
-            ::free(transa_);
-            ::free(transb_);
+            gemm_batch_group(transa_, transb_, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                             group_count, group_size);
         });
     });
     return done;
@@ -501,26 +759,21 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose *transa, transpose
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_cgemm_batch_usm>(cgh, [=]() {
-            char *transa_ = (char *)::malloc(sizeof(char) * group_count);
-            char *transb_ = (char *)::malloc(sizeof(char) * group_count);
-            if ((transa_ == NULL) || (transb_ == NULL)) {
+        host_task<class mkl_kernel_cgemm_batch_group_usm>(cgh, queue, [=]() {
+            scratch_buffer scratch(scratch_routine::gemm_batch, 2 * group_count);
+            char *transa_ = scratch.get<char>();
+            if (transa_ == NULL) {
                 std::cout << "Error cannot allocate trans arrays\n";
-                ::free(transa_);
-                ::free(transb_);
                 return;
             }
+            char *transb_ = transa_ + group_count;
+            count_batch_arrays(2, 2 * group_count);
             for (int64_t i = 0; i < group_count; i++) {
                 transa_[i] = *fortran_char(transa[i]);
                 transb_[i] = *fortran_char(transb[i]);
             }
-            ::cgemm_batch(transa_, transb_, (const MKL_INT *)m, (const MKL_INT *)n,
-                          (const MKL_INT *)k, alpha, (const std::complex<float> **)a,
-                          (const MKL_INT *)lda, (const std::complex<float> **)b,
-                          (const MKL_INT *)ldb, beta, c, (const MKL_INT *)ldc,
-                          (const MKL_INT *)&group_count, (const MKL_INT *)group_size);
-            ::free(transa_);
-            ::free(transb_);
+            gemm_batch_group(transa_, transb_, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                             group_count, group_size);
         });
     });
     return done;
@@ -538,26 +791,21 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose *transa, transpose
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_zgemm_batch_usm>(cgh, [=]() {
-            char *transa_ = (char *)::malloc(sizeof(char) * group_count);
-            char *transb_ = (char *)::malloc(sizeof(char) * group_count);
-            if ((transa_ == NULL) || (transb_ == NULL)) {
+        host_task<class mkl_kernel_zgemm_batch_group_usm>(cgh, queue, [=]() {
+            scratch_buffer scratch(scratch_routine::gemm_batch, 2 * group_count);
+            char *transa_ = scratch.get<char>();
+            if (transa_ == NULL) {
                 std::cout << "Error cannot allocate trans arrays\n";
-                ::free(transa_);
-                ::free(transb_);
                 return;
             }
+            char *transb_ = transa_ + group_count;
+            count_batch_arrays(2, 2 * group_count);
             for (int64_t i = 0; i < group_count; i++) {
                 transa_[i] = *fortran_char(transa[i]);
                 transb_[i] = *fortran_char(transb[i]);
             }
-            ::zgemm_batch(transa_, transb_, (const MKL_INT *)m, (const MKL_INT *)n,
-                          (const MKL_INT *)k, alpha, (const std::complex<double> **)a,
-                          (const MKL_INT *)lda, (const std::complex<double> **)b,
-                          (const MKL_INT *)ldb, beta, c, (const MKL_INT *)ldc,
-                          (const MKL_INT *)&group_count, (const MKL_INT *)group_size);
-            ::free(transa_);
-            ::free(transb_);
+            gemm_batch_group(transa_, transb_, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                             group_count, group_size);
         });
     });
     return done;
@@ -575,39 +823,9 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose transa, transpose t
         }
         const char transa_ = *fortran_char(transa);
         const char transb_ = *fortran_char(transb);
-        MKL_INT one        = 1;
-        host_task<class mkl_kernel_sgemm_batch_usm>(cgh, [=]() {
-            float **a_array = (float **)::malloc(sizeof(float *) * batch_size);
-            float **b_array = (float **)::malloc(sizeof(float *) * batch_size);
-            float **c_array = (float **)::malloc(sizeof(float *) * batch_size);
-            if ((a_array == NULL) || (b_array == NULL) || (c_array == NULL)) {
-                std::cout << "Error cannot allocate input arrays\n";
-                ::free(a_array);
-                ::free(b_array);
-                ::free(c_array);
-                return;
-            }
-            for (int64_t i = 0; i < batch_size; i++) {
-                if (i == 0) {
-                    a_array[0] = (float *)a;
-                    b_array[0] = (float *)b;
-                    c_array[0] = (float *)c;
-                }
-                else {
-                    a_array[i] = a_array[i - 1] + stride_a;
-                    b_array[i] = b_array[i - 1] + stride_b;
-                    c_array[i] = c_array[i - 1] + stride_c;
-                }
-            }
-            ::sgemm_batch(&transa_, &transb_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                          (const MKL_INT *)&k, &alpha, (const float **)a_array,
-                          (const MKL_INT *)&lda, (const float **)b_array, (const MKL_INT *)&ldb,
-                          &beta, c_array, (const MKL_INT *)&ldc, (const MKL_INT *)&one,
-                          (const MKL_INT *)&batch_size);
-
-            ::free(a_array);
-            ::free(b_array);
-            ::free(c_array);
+        host_task<class mkl_kernel_sgemm_batch_strided_usm>(cgh, queue, [=]() {
+            gemm_batch_strided<float>(transa_, transb_, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                                      stride_b, beta, c, ldc, stride_c, batch_size);
         });
     });
     return done;
@@ -626,39 +844,9 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose transa, transpose t
         }
         const char transa_ = *fortran_char(transa);
         const char transb_ = *fortran_char(transb);
-        MKL_INT one        = 1;
-        host_task<class mkl_kernel_dgemm_batch_usm>(cgh, [=]() {
-            double **a_array = (double **)::malloc(sizeof(double *) * batch_size);
-            double **b_array = (double **)::malloc(sizeof(double *) * batch_size);
-            double **c_array = (double **)::malloc(sizeof(double *) * batch_size);
-            if ((a_array == NULL) || (b_array == NULL) || (c_array == NULL)) {
-                std::cout << "Error cannot allocate input arrays\n";
-                ::free(a_array);
-                ::free(b_array);
-                ::free(c_array);
-                return;
-            }
-            for (int64_t i = 0; i < batch_size; i++) {
-                if (i == 0) {
-                    a_array[0] = (double *)a;
-                    b_array[0] = (double *)b;
-                    c_array[0] = (double *)c;
-                }
-                else {
-                    a_array[i] = a_array[i - 1] + stride_a;
-                    b_array[i] = b_array[i - 1] + stride_b;
-                    c_array[i] = c_array[i - 1] + stride_c;
-                }
-            }
-            ::dgemm_batch(&transa_, &transb_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                          (const MKL_INT *)&k, &alpha, (const double **)a_array,
-                          (const MKL_INT *)&lda, (const double **)b_array, (const MKL_INT *)&ldb,
-                          &beta, c_array, (const MKL_INT *)&ldc, (const MKL_INT *)&one,
-                          (const MKL_INT *)&batch_size);
-
-            ::free(a_array);
-            ::free(b_array);
-            ::free(c_array);
+        host_task<class mkl_kernel_dgemm_batch_strided_usm>(cgh, queue, [=]() {
+            gemm_batch_strided<double>(transa_, transb_, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                                       stride_b, beta, c, ldc, stride_c, batch_size);
         });
     });
     return done;
@@ -678,42 +866,10 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose transa, transpose t
         }
         const char transa_ = *fortran_char(transa);
         const char transb_ = *fortran_char(transb);
-        MKL_INT one        = 1;
-        host_task<class mkl_kernel_cgemm_batch_usm>(cgh, [=]() {
-            std::complex<float> **a_array =
-                (std::complex<float> **)::malloc(sizeof(std::complex<float> *) * batch_size);
-            std::complex<float> **b_array =
-                (std::complex<float> **)::malloc(sizeof(std::complex<float> *) * batch_size);
-            std::complex<float> **c_array =
-                (std::complex<float> **)::malloc(sizeof(std::complex<float> *) * batch_size);
-            if ((a_array == NULL) || (b_array == NULL) || (c_array == NULL)) {
-                std::cout << "Error cannot allocate input arrays\n";
-                ::free(a_array);
-                ::free(b_array);
-                ::free(c_array);
-                return;
-            }
-            for (int64_t i = 0; i < batch_size; i++) {
-                if (i == 0) {
-                    a_array[0] = (std::complex<float> *)a;
-                    b_array[0] = (std::complex<float> *)b;
-                    c_array[0] = (std::complex<float> *)c;
-                }
-                else {
-                    a_array[i] = a_array[i - 1] + stride_a;
-                    b_array[i] = b_array[i - 1] + stride_b;
-                    c_array[i] = c_array[i - 1] + stride_c;
-                }
-            }
-            ::cgemm_batch(&transa_, &transb_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                          (const MKL_INT *)&k, &alpha, (const std::complex<float> **)a_array,
-                          (const MKL_INT *)&lda, (const std::complex<float> **)b_array,
-                          (const MKL_INT *)&ldb, &beta, c_array, (const MKL_INT *)&ldc,
-                          (const MKL_INT *)&one, (const MKL_INT *)&batch_size);
-
-            ::free(a_array);
-            ::free(b_array);
-            ::free(c_array);
+        host_task<class mkl_kernel_cgemm_batch_strided_usm>(cgh, queue, [=]() {
+            gemm_batch_strided<std::complex<float>>(transa_, transb_, m, n, k, alpha, a, lda,
+                                                    stride_a, b, ldb, stride_b, beta, c, ldc,
+                                                    stride_c, batch_size);
         });
     });
     return done;
@@ -733,49 +889,87 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose transa, transpose t
         }
         const char transa_ = *fortran_char(transa);
         const char transb_ = *fortran_char(transb);
-        MKL_INT one        = 1;
-        host_task<class mkl_kernel_zgemm_batch_usm>(cgh, [=]() {
-            std::complex<double> **a_array =
-                (std::complex<double> **)::malloc(sizeof(std::complex<double> *) * batch_size);
-            std::complex<double> **b_array =
-                (std::complex<double> **)::malloc(sizeof(std::complex<double> *) * batch_size);
-            std::complex<double> **c_array =
-                (std::complex<double> **)::malloc(sizeof(std::complex<double> *) * batch_size);
-            if ((a_array == NULL) || (b_array == NULL) || (c_array == NULL)) {
-                std::cout << "Error cannot allocate input arrays\n";
-                ::free(a_array);
-                ::free(b_array);
-                ::free(c_array);
+        host_task<class mkl_kernel_zgemm_batch_strided_usm>(cgh, queue, [=]() {
+            gemm_batch_strided<std::complex<double>>(transa_, transb_, m, n, k, alpha, a, lda,
+                                                     stride_a, b, ldb, stride_b, beta, c, ldc,
+                                                     stride_c, batch_size);
+        });
+    });
+    return done;
+}
+
+cl::sycl::event trsm_batch(cl::sycl::queue &queue, side *left_right, uplo *upper_lower,
+                           transpose *trans, diag *unit_diag, int64_t *m, int64_t *n, float *alpha,
+                           const float **a, int64_t *lda, float **b, int64_t *ldb,
+                           int64_t group_count, int64_t *group_size,
+                           const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class mkl_kernel_strsm_batch_group_usm>(cgh, queue, [=]() {
+            scratch_buffer scratch(scratch_routine::trsm_batch, 4 * group_count);
+            char *side_ = scratch.get<char>();
+            if (side_ == NULL) {
+                std::cout << "Error cannot allocate side arrays\n";
                 return;
             }
-            for (int64_t i = 0; i < batch_size; i++) {
-                if (i == 0) {
-                    a_array[0] = (std::complex<double> *)a;
-                    b_array[0] = (std::complex<double> *)b;
-                    c_array[0] = (std::complex<double> *)c;
-                }
-                else {
-                    a_array[i] = a_array[i - 1] + stride_a;
-                    b_array[i] = b_array[i - 1] + stride_b;
-                    c_array[i] = c_array[i - 1] + stride_c;
-                }
+            char *uplo_  = side_ + group_count;
+            char *trans_ = uplo_ + group_count;
+            char *diag_  = trans_ + group_count;
+            count_batch_arrays(4, 4 * group_count);
+            for (int64_t i = 0; i < group_count; i++) {
+                side_[i]  = *fortran_char(left_right[i]);
+                uplo_[i]  = *fortran_char(upper_lower[i]);
+                trans_[i] = *fortran_char(trans[i]);
+                diag_[i]  = *fortran_char(unit_diag[i]);
             }
-            ::zgemm_batch(&transa_, &transb_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                          (const MKL_INT *)&k, &alpha, (const std::complex<double> **)a_array,
-                          (const MKL_INT *)&lda, (const std::complex<double> **)b_array,
-                          (const MKL_INT *)&ldb, &beta, c_array, (const MKL_INT *)&ldc,
-                          (const MKL_INT *)&one, (const MKL_INT *)&batch_size);
+            trsm_group(side_, uplo_, trans_, diag_, m, n, alpha, a, lda, b, ldb, group_count,
+                       group_size);
+        });
+    });
+    return done;
+}
 
-            ::free(a_array);
-            ::free(b_array);
-            ::free(c_array);
+cl::sycl::event trsm_batch(cl::sycl::queue &queue, side *left_right, uplo *upper_lower,
+                           transpose *trans, diag *unit_diag, int64_t *m, int64_t *n, double *alpha,
+                           const double **a, int64_t *lda, double **b, int64_t *ldb,
+                           int64_t group_count, int64_t *group_size,
+                           const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class mkl_kernel_dtrsm_batch_group_usm>(cgh, queue, [=]() {
+            scratch_buffer scratch(scratch_routine::trsm_batch, 4 * group_count);
+            char *side_ = scratch.get<char>();
+            if (side_ == NULL) {
+                std::cout << "Error cannot allocate side arrays\n";
+                return;
+            }
+            char *uplo_  = side_ + group_count;
+            char *trans_ = uplo_ + group_count;
+            char *diag_  = trans_ + group_count;
+            count_batch_arrays(4, 4 * group_count);
+            for (int64_t i = 0; i < group_count; i++) {
+                side_[i]  = *fortran_char(left_right[i]);
+                uplo_[i]  = *fortran_char(upper_lower[i]);
+                trans_[i] = *fortran_char(trans[i]);
+                diag_[i]  = *fortran_char(unit_diag[i]);
+            }
+            trsm_group(side_, uplo_, trans_, diag_, m, n, alpha, a, lda, b, ldb, group_count,
+                       group_size);
         });
     });
     return done;
 }
 
-cl::sycl::event axpy_batch(cl::sycl::queue &queue, int64_t *n, float *alpha, const float **x,
-                           int64_t *incx, float **y, int64_t *incy, int64_t group_count,
+cl::sycl::event trsm_batch(cl::sycl::queue &queue, side *left_right, uplo *upper_lower,
+                           transpose *trans, diag *unit_diag, int64_t *m, int64_t *n,
+                           std::complex<float> *alpha, const std::complex<float> **a, int64_t *lda,
+                           std::complex<float> **b, int64_t *ldb, int64_t group_count,
                            int64_t *group_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
@@ -783,16 +977,167 @@ cl::sycl::event axpy_batch(cl::sycl::queue &queue, int64_t *n, float *alpha, con
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_saxpy_batch_usm>(cgh, [=]() {
-            int64_t offset = 0;
+        host_task<class mkl_kernel_ctrsm_batch_group_usm>(cgh, queue, [=]() {
+            scratch_buffer scratch(scratch_routine::trsm_batch, 4 * group_count);
+            char *side_ = scratch.get<char>();
+            if (side_ == NULL) {
+                std::cout << "Error cannot allocate side arrays\n";
+                return;
+            }
+            char *uplo_  = side_ + group_count;
+            char *trans_ = uplo_ + group_count;
+            char *diag_  = trans_ + group_count;
+            count_batch_arrays(4, 4 * group_count);
+            for (int64_t i = 0; i < group_count; i++) {
+                side_[i]  = *fortran_char(left_right[i]);
+                uplo_[i]  = *fortran_char(upper_lower[i]);
+                trans_[i] = *fortran_char(trans[i]);
+                diag_[i]  = *fortran_char(unit_diag[i]);
+            }
+            trsm_group(side_, uplo_, trans_, diag_, m, n, alpha, a, lda, b, ldb, group_count,
+                       group_size);
+        });
+    });
+    return done;
+}
+
+cl::sycl::event trsm_batch(cl::sycl::queue &queue, side *left_right, uplo *upper_lower,
+                           transpose *trans, diag *unit_diag, int64_t *m, int64_t *n,
+                           std::complex<double> *alpha, const std::complex<double> **a,
+                           int64_t *lda, std::complex<double> **b, int64_t *ldb,
+                           int64_t group_count, int64_t *group_size,
+                           const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class mkl_kernel_ztrsm_batch_group_usm>(cgh, queue, [=]() {
+            scratch_buffer scratch(scratch_routine::trsm_batch, 4 * group_count);
+            char *side_ = scratch.get<char>();
+            if (side_ == NULL) {
+                std::cout << "Error cannot allocate side arrays\n";
+                return;
+            }
+            char *uplo_  = side_ + group_count;
+            char *trans_ = uplo_ + group_count;
+            char *diag_  = trans_ + group_count;
+            count_batch_arrays(4, 4 * group_count);
             for (int64_t i = 0; i < group_count; i++) {
-                for (int64_t j = 0; j < group_size[i]; j++) {
-                    ::saxpy((const MKL_INT *)(n + i), (const float *)(alpha + i), x[offset + j],
-                            (const MKL_INT *)(incx + i), y[offset + j],
-                            (const MKL_INT *)(incy + i));
-                }
-                offset += group_size[i];
+                side_[i]  = *fortran_char(left_right[i]);
+                uplo_[i]  = *fortran_char(upper_lower[i]);
+                trans_[i] = *fortran_char(trans[i]);
+                diag_[i]  = *fortran_char(unit_diag[i]);
             }
+            trsm_group(side_, uplo_, trans_, diag_, m, n, alpha, a, lda, b, ldb, group_count,
+                       group_size);
+        });
+    });
+    return done;
+}
+
+cl::sycl::event trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_lower,
+                           transpose trans, diag unit_diag, int64_t m, int64_t n, float alpha,
+                           const float *a, int64_t lda, int64_t stride_a, float *b, int64_t ldb,
+                           int64_t stride_b, int64_t batch_size,
+                           const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        const char side_  = *fortran_char(left_right);
+        const char uplo_  = *fortran_char(upper_lower);
+        const char trans_ = *fortran_char(trans);
+        const char diag_  = *fortran_char(unit_diag);
+        host_task<class mkl_kernel_strsm_batch_strided_usm>(cgh, queue, [=]() {
+            trsm_batch_strided<float>(side_, uplo_, trans_, diag_, m, n, alpha, a, lda, stride_a, b,
+                                      ldb, stride_b, batch_size);
+        });
+    });
+    return done;
+}
+
+cl::sycl::event trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_lower,
+                           transpose trans, diag unit_diag, int64_t m, int64_t n, double alpha,
+                           const double *a, int64_t lda, int64_t stride_a, double *b, int64_t ldb,
+                           int64_t stride_b, int64_t batch_size,
+                           const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        const char side_  = *fortran_char(left_right);
+        const char uplo_  = *fortran_char(upper_lower);
+        const char trans_ = *fortran_char(trans);
+        const char diag_  = *fortran_char(unit_diag);
+        host_task<class mkl_kernel_dtrsm_batch_strided_usm>(cgh, queue, [=]() {
+            trsm_batch_strided<double>(side_, uplo_, trans_, diag_, m, n, alpha, a, lda, stride_a,
+                                       b, ldb, stride_b, batch_size);
+        });
+    });
+    return done;
+}
+
+cl::sycl::event trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_lower,
+                           transpose trans, diag unit_diag, int64_t m, int64_t n,
+                           std::complex<float> alpha, const std::complex<float> *a, int64_t lda,
+                           int64_t stride_a, std::complex<float> *b, int64_t ldb, int64_t stride_b,
+                           int64_t batch_size,
+                           const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        const char side_  = *fortran_char(left_right);
+        const char uplo_  = *fortran_char(upper_lower);
+        const char trans_ = *fortran_char(trans);
+        const char diag_  = *fortran_char(unit_diag);
+        host_task<class mkl_kernel_ctrsm_batch_strided_usm>(cgh, queue, [=]() {
+            trsm_batch_strided<std::complex<float>>(side_, uplo_, trans_, diag_, m, n, alpha, a,
+                                                    lda, stride_a, b, ldb, stride_b, batch_size);
+        });
+    });
+    return done;
+}
+
+cl::sycl::event trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_lower,
+                           transpose trans, diag unit_diag, int64_t m, int64_t n,
+                           std::complex<double> alpha, const std::complex<double> *a, int64_t lda,
+                           int64_t stride_a, std::complex<double> *b, int64_t ldb, int64_t stride_b,
+                           int64_t batch_size,
+                           const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        const char side_  = *fortran_char(left_right);
+        const char uplo_  = *fortran_char(upper_lower);
+        const char trans_ = *fortran_char(trans);
+        const char diag_  = *fortran_char(unit_diag);
+        host_task<class mkl_kernel_ztrsm_batch_strided_usm>(cgh, queue, [=]() {
+            trsm_batch_strided<std::complex<double>>(side_, uplo_, trans_, diag_, m, n, alpha, a,
+                                                     lda, stride_a, b, ldb, stride_b, batch_size);
+        });
+    });
+    return done;
+}
+
+cl::sycl::event axpy_batch(cl::sycl::queue &queue, int64_t *n, float *alpha, const float **x,
+                           int64_t *incx, float **y, int64_t *incy, int64_t group_count,
+                           int64_t *group_size,
+                           const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class mkl_kernel_saxpy_batch_group_usm>(cgh, queue, [=]() {
+            axpy_batch_balanced(group_count, n, alpha, pointer_vectors<const float>{ x }, incx,
+                                pointer_vectors<float>{ y }, incy, group_size);
         });
     });
     return done;
@@ -807,16 +1152,9 @@ cl::sycl::event axpy_batch(cl::sycl::queue &queue, int64_t *n, double *alpha, co
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_daxpy_batch_usm>(cgh, [=]() {
-            int64_t offset = 0;
-            for (int64_t i = 0; i < group_count; i++) {
-                for (int64_t j = 0; j < group_size[i]; j++) {
-                    ::daxpy((const MKL_INT *)(n + i), (const double *)(alpha + i), x[offset + j],
-                            (const MKL_INT *)(incx + i), y[offset + j],
-                            (const MKL_INT *)(incy + i));
-                }
-                offset += group_size[i];
-            }
+        host_task<class mkl_kernel_daxpy_batch_group_usm>(cgh, queue, [=]() {
+            axpy_batch_balanced(group_count, n, alpha, pointer_vectors<const double>{ x }, incx,
+                                pointer_vectors<double>{ y }, incy, group_size);
         });
     });
     return done;
@@ -831,17 +1169,10 @@ cl::sycl::event axpy_batch(cl::sycl::queue &queue, int64_t *n, std::complex<floa
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_caxpy_batch_usm>(cgh, [=]() {
-            int64_t offset = 0;
-            for (int64_t i = 0; i < group_count; i++) {
-                for (int64_t j = 0; j < group_size[i]; j++) {
-                    MKL_Complex8 alpha_ = { alpha[i].real(), alpha[i].imag() };
-                    ::caxpy((const MKL_INT *)(n + i), (const MKL_Complex8 *)&alpha_, x[offset + j],
-                            (const MKL_INT *)(incx + i), y[offset + j],
-                            (const MKL_INT *)(incy + i));
-                }
-                offset += group_size[i];
-            }
+        host_task<class mkl_kernel_caxpy_batch_group_usm>(cgh, queue, [=]() {
+            axpy_batch_balanced(group_count, n, alpha,
+                                pointer_vectors<const std::complex<float>>{ x }, incx,
+                                pointer_vectors<std::complex<float>>{ y }, incy, group_size);
         });
     });
     return done;
@@ -856,21 +1187,87 @@ cl::sycl::event axpy_batch(cl::sycl::queue &queue, int64_t *n, std::complex<doub
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_zaxpy_batch_usm>(cgh, [=]() {
-            int64_t offset = 0;
-            for (int64_t i = 0; i < group_count; i++) {
-                for (int64_t j = 0; j < group_size[i]; j++) {
-                    MKL_Complex16 alpha_ = { alpha[i].real(), alpha[i].imag() };
-                    ::zaxpy((const MKL_INT *)(n + i), (const MKL_Complex16 *)&alpha_, x[offset + j],
-                            (const MKL_INT *)(incx + i), y[offset + j],
-                            (const MKL_INT *)(incy + i));
-                }
-                offset += group_size[i];
-            }
+        host_task<class mkl_kernel_zaxpy_batch_group_usm>(cgh, queue, [=]() {
+            axpy_batch_balanced(group_count, n, alpha,
+                                pointer_vectors<const std::complex<double>>{ x }, incx,
+                                pointer_vectors<std::complex<double>>{ y }, incy, group_size);
         });
     });
     return done;
 }
 
+cl::sycl::event axpy_batch(cl::sycl::queue &queue, int64_t n, float alpha, const float *x,
+                           int64_t incx, int64_t stridex, float *y, int64_t incy, int64_t stridey,
+                           int64_t batch_size,
+                           const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class mkl_kernel_saxpy_batch_strided_usm>(cgh, queue, [=]() {
+            axpy_batch_balanced(int64_t(1), &n, &alpha, strided_vectors<const float>{ x, stridex },
+                                &incx, strided_vectors<float>{ y, stridey }, &incy, &batch_size);
+        });
+    });
+    return done;
+}
+
+cl::sycl::event axpy_batch(cl::sycl::queue &queue, int64_t n, double alpha, const double *x,
+                           int64_t incx, int64_t stridex, double *y, int64_t incy, int64_t stridey,
+                           int64_t batch_size,
+                           const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class mkl_kernel_daxpy_batch_strided_usm>(cgh, queue, [=]() {
+            axpy_batch_balanced(int64_t(1), &n, &alpha, strided_vectors<const double>{ x, stridex },
+                                &incx, strided_vectors<double>{ y, stridey }, &incy, &batch_size);
+        });
+    });
+    return done;
+}
+
+cl::sycl::event axpy_batch(cl::sycl::queue &queue, int64_t n, std::complex<float> alpha,
+                           const std::complex<float> *x, int64_t incx, int64_t stridex,
+                           std::complex<float> *y, int64_t incy, int64_t stridey,
+                           int64_t batch_size,
+                           const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class mkl_kernel_caxpy_batch_strided_usm>(cgh, queue, [=]() {
+            axpy_batch_balanced(int64_t(1), &n, &alpha,
+                                strided_vectors<const std::complex<float>>{ x, stridex }, &incx,
+                                strided_vectors<std::complex<float>>{ y, stridey }, &incy,
+                                &batch_size);
+        });
+    });
+    return done;
+}
+
+cl::sycl::event axpy_batch(cl::sycl::queue &queue, int64_t n, std::complex<double> alpha,
+                           const std::complex<double> *x, int64_t incx, int64_t stridex,
+                           std::complex<double> *y, int64_t incy, int64_t stridey,
+                           int64_t batch_size,
+                           const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class mkl_kernel_zaxpy_batch_strided_usm>(cgh, queue, [=]() {
+            axpy_batch_balanced(int64_t(1), &n, &alpha,
+                                strided_vectors<const std::complex<double>>{ x, stridex }, &incx,
+                                strided_vectors<std::complex<double>>{ y, stridey }, &incy,
+                                &batch_size);
+        });
+    });
+    return done;
+}
 } // namespace mklcpu
 } // namespace onemkl
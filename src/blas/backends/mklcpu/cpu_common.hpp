@@ -25,10 +25,22 @@
 
 #include <CL/sycl.hpp>
 #include <complex>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <vector>
 
 #include "mkl_blas.h"
 #include "mkl_cblas.h"
+#include "mkl_service.h"
 
+#ifdef ONEMKL_MKLCPU_THREAD_TBB
+    #include "tbb/parallel_for.h"
+    #include "tbb/task_arena.h"
+#endif
+
+#include "cpu_stats.hpp"
 #include "onemkl/blas/detail/mklcpu/onemkl_blas_mklcpu.hpp"
 #include "onemkl/types.hpp"
 
@@ -47,9 +59,164 @@ static inline void host_task_internal(H &cgh, F f, long) {
     cgh.template single_task<K>(f);
 }
 
+// Threading settings of a queue, applied around every MKL call made on it.
+//  Several queues running threaded MKL at once would each size themselves to
+//  all cores; a thread budget per queue avoids the oversubscription. A policy
+//  is immutable: changing the settings of a queue replaces it, and tasks
+//  already submitted keep the policy they were submitted with.
+class execution_policy {
+public:
+    // Policy of queue, or nullptr when the queue uses the defaults.
+    static std::shared_ptr<const execution_policy> get(const cl::sycl::queue &queue);
+    static void set(const cl::sycl::queue &queue, std::shared_ptr<const execution_policy> policy);
+
+    template <typename F>
+    static void run(const std::shared_ptr<const execution_policy> &policy, const F &f) {
+        if (!policy) {
+            f();
+            return;
+        }
+#ifdef ONEMKL_MKLCPU_THREAD_TBB
+        // TBB-threaded MKL runs its parallel regions in the arena of the caller.
+        if (policy->arena) {
+            policy->arena->execute([&]() { run_budget(*policy, f); });
+            return;
+        }
+#endif
+        run_budget(*policy, f);
+    }
+
+    int num_threads = 0;
+#ifdef ONEMKL_MKLCPU_THREAD_TBB
+    std::shared_ptr<tbb::task_arena> arena;
+#endif
+
+private:
+    template <typename F>
+    static void run_budget(const execution_policy &policy, const F &f) {
+        if (policy.num_threads <= 0) {
+            f();
+            return;
+        }
+        int previous = mkl_set_num_threads_local(policy.num_threads);
+        f();
+        mkl_set_num_threads_local(previous);
+    }
+};
+
+// Run f(i) for i in [begin, end) from a host task. With TBB threading the
+//  iterations are spread over the current arena, that of the queue when it
+//  has one. Otherwise MKL is sequential, and so is the loop.
+template <typename F>
+static inline void parallel_for(int64_t begin, int64_t end, const F &f) {
+#ifdef ONEMKL_MKLCPU_THREAD_TBB
+    tbb::parallel_for(begin, end, f);
+#else
+    for (int64_t i = begin; i < end; i++)
+        f(i);
+#endif
+}
+
+// Number of threads parallel_for can spread its iterations over.
+static inline int64_t max_concurrency() {
+#ifdef ONEMKL_MKLCPU_THREAD_TBB
+    return tbb::this_task_arena::max_concurrency();
+#else
+    return 1;
+#endif
+}
+
+// Number of host tasks submitted by this thread (cpu_fusion.cpp). A fused
+//  batch only takes more calls while nothing else was submitted after it.
+std::uint64_t &thread_submissions();
+
+// Submit f as a host task that runs with the execution policy queue has now,
+//  timed under the name of K while statistics are on.
 template <typename K, typename H, typename F>
-static inline void host_task(H &cgh, F f) {
-    (void)host_task_internal<K>(cgh, f, 0);
+static inline void host_task(H &cgh, const cl::sycl::queue &queue, F f) {
+    thread_submissions()++;
+    auto policy = execution_policy::get(queue);
+    int task    = stats_task<K>();
+    (void)host_task_internal<K>(
+        cgh, [=]() { stats_run(task, [&]() { execution_policy::run(policy, f); }); }, 0);
+}
+
+// Calls recorded inside fused_begin()/fused_end() on a queue are appended to
+//  the pending batch, a host_task that runs them in order. A call joins the
+//  batch while its task has not started, no other host task was submitted by
+//  the thread since, and the call has no dependencies of its own; otherwise
+//  it starts a new batch, which depends on the previous one
+//  so that the calls run in the order they were made. The event returned for
+//  a call is the one of its batch, so it completes only after the call has
+//  run. Recorders are per thread.
+struct fused_batch;
+
+class fusion_recorder {
+public:
+    explicit fusion_recorder(cl::sycl::queue &queue) : queue(queue), depth(0) {}
+
+    // Recorder for queue on this thread, or nullptr outside of a fused scope.
+    static fusion_recorder *active(const cl::sycl::queue &queue);
+
+    cl::sycl::event record(const cl::sycl::vector_class<cl::sycl::event> &dependencies,
+                           std::function<void()> f);
+    // Stop appending to the pending batch; it runs when its dependencies are met.
+    void flush();
+
+    cl::sycl::queue queue;
+    int depth;
+
+private:
+    std::shared_ptr<fused_batch> batch;
+    std::uint64_t batch_submission = 0;
+    cl::sycl::event last;
+    bool has_last = false;
+};
+
+// For small problems, submitting a command group costs far more than the MKL
+//  call itself. When ONEMKL_MKLCPU_INLINE_THRESHOLD is set to a positive value,
+//  USM calls of at most that many elements whose dependencies have completed
+//  run directly on the calling thread and return a default-constructed event,
+//  which is complete. Only host and CPU queues that are not in order run calls
+//  inline: an in-order queue may have unfinished work the call must follow.
+//  inline_threshold() gives the threshold of queue (cpu_execution.cpp), 0 when
+//  calls on it never run inline; it is cached per queue on each thread, so
+//  neither the device nor the environment is queried on every call.
+std::int64_t inline_threshold(const cl::sycl::queue &queue);
+
+static inline bool can_run_inline(cl::sycl::queue &queue, std::int64_t size,
+                                  const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    std::int64_t threshold = inline_threshold(queue);
+    if (threshold <= 0 || size > threshold)
+        return false;
+    for (auto &e : dependencies) {
+        if (e.get_info<cl::sycl::info::event::command_execution_status>() !=
+            cl::sycl::info::event_command_status::complete)
+            return false;
+    }
+    return true;
+}
+
+// Run f after dependencies: recorded into an active fused scope, inline (see
+//  above), or as a host_task.
+template <typename K, typename F>
+static inline cl::sycl::event submit_usm(
+    cl::sycl::queue &queue, std::int64_t size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies, F f) {
+    if (auto recorder = fusion_recorder::active(queue))
+        return recorder->record(dependencies, f);
+    if (can_run_inline(queue, size, dependencies)) {
+        auto policy = execution_policy::get(queue);
+        stats_run(stats_task<K>(), [&]() { execution_policy::run(policy, f); });
+        return cl::sycl::event();
+    }
+    return queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<K>(cgh, queue, f);
+    });
 }
 
 // Conversion functions to traditional Fortran characters.
@@ -97,6 +264,14 @@ inline const char *fortran_char(side s) {
     return "L";
 }
 
+inline const char *fortran_char(pack_matrix p) {
+    if (p == pack_matrix::a)
+        return "A";
+    if (p == pack_matrix::b)
+        return "B";
+    return "A";
+}
+
 } // namespace mklcpu
 } // namespace onemkl
 
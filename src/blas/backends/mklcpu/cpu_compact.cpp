@@ -0,0 +1,261 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+
+#include <CL/sycl.hpp>
+
+#include "compact.hpp"
+#include "cpu_common.hpp"
+#include "onemkl/blas/detail/mklcpu/onemkl_blas_mklcpu.hpp"
+
+namespace onemkl {
+namespace mklcpu {
+
+// Packs of the batch are independent and run in parallel.
+static inline int64_t compact_packs(int64_t batch_size) {
+    return (batch_size + compact_lanes - 1) / compact_lanes;
+}
+
+template <typename K, typename T>
+static cl::sycl::event compact_pack_usm(
+    cl::sycl::queue &queue, int64_t rows, int64_t cols, const T **a, int64_t lda, T *ap,
+    int64_t ldap, int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    return queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<K>(cgh, queue, [=]() {
+            parallel_for(0, compact_packs(batch_size), [&](int64_t p) {
+                compact_pack(p, rows, cols, a, lda, ap, ldap, batch_size);
+            });
+        });
+    });
+}
+
+template <typename K, typename T>
+static cl::sycl::event compact_unpack_usm(
+    cl::sycl::queue &queue, int64_t rows, int64_t cols, const T *ap, int64_t ldap, T **a,
+    int64_t lda, int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    return queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<K>(cgh, queue, [=]() {
+            parallel_for(0, compact_packs(batch_size), [&](int64_t p) {
+                compact_unpack(p, rows, cols, ap, ldap, a, lda, batch_size);
+            });
+        });
+    });
+}
+
+template <typename K, typename T>
+static cl::sycl::event gemm_compact_usm(
+    cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,
+    T alpha, const T *ap, int64_t ldap, const T *bp, int64_t ldbp, T beta, T *cp, int64_t ldcp,
+    int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    bool trans_a = transa != transpose::nontrans, conj_a = transa == transpose::conjtrans;
+    bool trans_b = transb != transpose::nontrans, conj_b = transb == transpose::conjtrans;
+    return queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<K>(cgh, queue, [=]() {
+            parallel_for(0, compact_packs(batch_size), [&](int64_t p) {
+                compact_gemm(p, trans_a, conj_a, trans_b, conj_b, m, n, k, alpha, ap, ldap, bp,
+                             ldbp, beta, cp, ldcp);
+            });
+        });
+    });
+}
+
+template <typename K, typename T>
+static cl::sycl::event trsm_compact_usm(
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+    int64_t m, int64_t n, T alpha, const T *ap, int64_t ldap, T *bp, int64_t ldbp,
+    int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    bool left = left_right == side::left, upper = upper_lower == uplo::upper;
+    bool transposed = trans != transpose::nontrans, conj = trans == transpose::conjtrans;
+    bool unit       = unit_diag == diag::unit;
+    return queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<K>(cgh, queue, [=]() {
+            parallel_for(0, compact_packs(batch_size), [&](int64_t p) {
+                compact_trsm(p, left, upper, transposed, conj, unit, m, n, alpha, ap, ldap, bp,
+                             ldbp);
+            });
+        });
+    });
+}
+
+cl::sycl::event compact_pack(cl::sycl::queue &queue, int64_t rows, int64_t cols, const float **a,
+                             int64_t lda, float *ap, int64_t ldap, int64_t batch_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    return compact_pack_usm<class mkl_kernel_scompact_pack_usm>(queue, rows, cols, a, lda, ap, ldap,
+                                                                batch_size, dependencies);
+}
+
+cl::sycl::event compact_pack(cl::sycl::queue &queue, int64_t rows, int64_t cols, const double **a,
+                             int64_t lda, double *ap, int64_t ldap, int64_t batch_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    return compact_pack_usm<class mkl_kernel_dcompact_pack_usm>(queue, rows, cols, a, lda, ap, ldap,
+                                                                batch_size, dependencies);
+}
+
+cl::sycl::event compact_pack(cl::sycl::queue &queue, int64_t rows, int64_t cols,
+                             const std::complex<float> **a, int64_t lda, std::complex<float> *ap,
+                             int64_t ldap, int64_t batch_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    return compact_pack_usm<class mkl_kernel_ccompact_pack_usm>(queue, rows, cols, a, lda, ap, ldap,
+                                                                batch_size, dependencies);
+}
+
+cl::sycl::event compact_pack(cl::sycl::queue &queue, int64_t rows, int64_t cols,
+                             const std::complex<double> **a, int64_t lda, std::complex<double> *ap,
+                             int64_t ldap, int64_t batch_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    return compact_pack_usm<class mkl_kernel_zcompact_pack_usm>(queue, rows, cols, a, lda, ap, ldap,
+                                                                batch_size, dependencies);
+}
+
+cl::sycl::event compact_unpack(cl::sycl::queue &queue, int64_t rows, int64_t cols, const float *ap,
+                               int64_t ldap, float **a, int64_t lda, int64_t batch_size,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    return compact_unpack_usm<class mkl_kernel_scompact_unpack_usm>(queue, rows, cols, ap, ldap, a,
+                                                                    lda, batch_size, dependencies);
+}
+
+cl::sycl::event compact_unpack(cl::sycl::queue &queue, int64_t rows, int64_t cols, const double *ap,
+                               int64_t ldap, double **a, int64_t lda, int64_t batch_size,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    return compact_unpack_usm<class mkl_kernel_dcompact_unpack_usm>(queue, rows, cols, ap, ldap, a,
+                                                                    lda, batch_size, dependencies);
+}
+
+cl::sycl::event compact_unpack(cl::sycl::queue &queue, int64_t rows, int64_t cols,
+                               const std::complex<float> *ap, int64_t ldap, std::complex<float> **a,
+                               int64_t lda, int64_t batch_size,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    return compact_unpack_usm<class mkl_kernel_ccompact_unpack_usm>(queue, rows, cols, ap, ldap, a,
+                                                                    lda, batch_size, dependencies);
+}
+
+cl::sycl::event compact_unpack(cl::sycl::queue &queue, int64_t rows, int64_t cols,
+                               const std::complex<double> *ap, int64_t ldap,
+                               std::complex<double> **a, int64_t lda, int64_t batch_size,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    return compact_unpack_usm<class mkl_kernel_zcompact_unpack_usm>(queue, rows, cols, ap, ldap, a,
+                                                                    lda, batch_size, dependencies);
+}
+
+cl::sycl::event gemm_compact(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                             int64_t n, int64_t k, float alpha, const float *ap, int64_t ldap,
+                             const float *bp, int64_t ldbp, float beta, float *cp, int64_t ldcp,
+                             int64_t batch_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    return gemm_compact_usm<class mkl_kernel_sgemm_compact_usm>(queue, transa, transb, m, n, k,
+                                                                alpha, ap, ldap, bp, ldbp, beta, cp,
+                                                                ldcp, batch_size, dependencies);
+}
+
+cl::sycl::event gemm_compact(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                             int64_t n, int64_t k, double alpha, const double *ap, int64_t ldap,
+                             const double *bp, int64_t ldbp, double beta, double *cp, int64_t ldcp,
+                             int64_t batch_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    return gemm_compact_usm<class mkl_kernel_dgemm_compact_usm>(queue, transa, transb, m, n, k,
+                                                                alpha, ap, ldap, bp, ldbp, beta, cp,
+                                                                ldcp, batch_size, dependencies);
+}
+
+cl::sycl::event gemm_compact(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                             int64_t n, int64_t k, std::complex<float> alpha,
+                             const std::complex<float> *ap, int64_t ldap,
+                             const std::complex<float> *bp, int64_t ldbp, std::complex<float> beta,
+                             std::complex<float> *cp, int64_t ldcp, int64_t batch_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    return gemm_compact_usm<class mkl_kernel_cgemm_compact_usm>(queue, transa, transb, m, n, k,
+                                                                alpha, ap, ldap, bp, ldbp, beta, cp,
+                                                                ldcp, batch_size, dependencies);
+}
+
+cl::sycl::event gemm_compact(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                             int64_t n, int64_t k, std::complex<double> alpha,
+                             const std::complex<double> *ap, int64_t ldap,
+                             const std::complex<double> *bp, int64_t ldbp,
+                             std::complex<double> beta, std::complex<double> *cp, int64_t ldcp,
+                             int64_t batch_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    return gemm_compact_usm<class mkl_kernel_zgemm_compact_usm>(queue, transa, transb, m, n, k,
+                                                                alpha, ap, ldap, bp, ldbp, beta, cp,
+                                                                ldcp, batch_size, dependencies);
+}
+
+cl::sycl::event trsm_compact(cl::sycl::queue &queue, side left_right, uplo upper_lower,
+                             transpose trans, diag unit_diag, int64_t m, int64_t n, float alpha,
+                             const float *ap, int64_t ldap, float *bp, int64_t ldbp,
+                             int64_t batch_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    return trsm_compact_usm<class mkl_kernel_strsm_compact_usm>(queue, left_right, upper_lower,
+                                                                trans, unit_diag, m, n, alpha, ap,
+                                                                ldap, bp, ldbp, batch_size,
+                                                                dependencies);
+}
+
+cl::sycl::event trsm_compact(cl::sycl::queue &queue, side left_right, uplo upper_lower,
+                             transpose trans, diag unit_diag, int64_t m, int64_t n, double alpha,
+                             const double *ap, int64_t ldap, double *bp, int64_t ldbp,
+                             int64_t batch_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    return trsm_compact_usm<class mkl_kernel_dtrsm_compact_usm>(queue, left_right, upper_lower,
+                                                                trans, unit_diag, m, n, alpha, ap,
+                                                                ldap, bp, ldbp, batch_size,
+                                                                dependencies);
+}
+
+cl::sycl::event trsm_compact(cl::sycl::queue &queue, side left_right, uplo upper_lower,
+                             transpose trans, diag unit_diag, int64_t m, int64_t n,
+                             std::complex<float> alpha, const std::complex<float> *ap, int64_t ldap,
+                             std::complex<float> *bp, int64_t ldbp, int64_t batch_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    return trsm_compact_usm<class mkl_kernel_ctrsm_compact_usm>(queue, left_right, upper_lower,
+                                                                trans, unit_diag, m, n, alpha, ap,
+                                                                ldap, bp, ldbp, batch_size,
+                                                                dependencies);
+}
+
+cl::sycl::event trsm_compact(cl::sycl::queue &queue, side left_right, uplo upper_lower,
+                             transpose trans, diag unit_diag, int64_t m, int64_t n,
+                             std::complex<double> alpha, const std::complex<double> *ap,
+                             int64_t ldap, std::complex<double> *bp, int64_t ldbp,
+                             int64_t batch_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    return trsm_compact_usm<class mkl_kernel_ztrsm_compact_usm>(queue, left_right, upper_lower,
+                                                                trans, unit_diag, m, n, alpha, ap,
+                                                                ldap, bp, ldbp, batch_size,
+                                                                dependencies);
+}
+
+} // namespace mklcpu
+} // namespace onemkl
@@ -0,0 +1,301 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstring>
+
+#include "cpu_common.hpp"
+#include "cpu_convert.hpp"
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) && \
+    !defined(__SYCL_DEVICE_ONLY__)
+    #define ONEMKL_MKLCPU_CONVERT_X86
+    #include <immintrin.h>
+#endif
+
+namespace onemkl {
+namespace mklcpu {
+
+static void half_to_float_scalar(const fp16 *src, float *dst, int64_t count) {
+    for (int64_t i = 0; i < count; i++)
+        dst[i] = float(src[i]);
+}
+
+static void float_to_half_scalar(const float *src, fp16 *dst, int64_t count) {
+    for (int64_t i = 0; i < count; i++)
+        dst[i] = fp16(src[i]);
+}
+
+static void bfloat16_to_float_scalar(const bfloat16 *src, float *dst, int64_t count) {
+    for (int64_t i = 0; i < count; i++)
+        dst[i] = float(src[i]);
+}
+
+static void float_to_bfloat16_scalar(const float *src, bfloat16 *dst, int64_t count) {
+    for (int64_t i = 0; i < count; i++)
+        dst[i] = bfloat16(src[i]);
+}
+
+#ifdef ONEMKL_MKLCPU_CONVERT_X86
+
+// Each kernel converts whole vectors, and the tail through a vector-sized
+//  copy, so that all the values of a matrix are rounded the same way.
+
+__attribute__((target("avx,f16c"))) static void half_to_float_f16c(const fp16 *src, float *dst,
+                                                                    int64_t count) {
+    int64_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m128i h = _mm_loadu_si128((const __m128i *)(src + i));
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(h));
+    }
+    if (i < count) {
+        fp16 h[8] = {};
+        float f[8];
+        std::memcpy(h, src + i, sizeof(fp16) * (count - i));
+        _mm256_storeu_ps(f, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i *)h)));
+        std::memcpy(dst + i, f, sizeof(float) * (count - i));
+    }
+}
+
+__attribute__((target("avx,f16c"))) static void float_to_half_f16c(const float *src, fp16 *dst,
+                                                                    int64_t count) {
+    int64_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m128i h = _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128((__m128i *)(dst + i), h);
+    }
+    if (i < count) {
+        float f[8] = {};
+        fp16 h[8];
+        std::memcpy(f, src + i, sizeof(float) * (count - i));
+        _mm_storeu_si128((__m128i *)h,
+                         _mm256_cvtps_ph(_mm256_loadu_ps(f), _MM_FROUND_TO_NEAREST_INT));
+        std::memcpy(dst + i, h, sizeof(fp16) * (count - i));
+    }
+}
+
+__attribute__((target("avx512f"))) static void half_to_float_avx512(const fp16 *src, float *dst,
+                                                                     int64_t count) {
+    int64_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m256i h = _mm256_loadu_si256((const __m256i *)(src + i));
+        _mm512_storeu_ps(dst + i, _mm512_cvtph_ps(h));
+    }
+    if (i < count) {
+        fp16 h[16] = {};
+        float f[16];
+        std::memcpy(h, src + i, sizeof(fp16) * (count - i));
+        _mm512_storeu_ps(f, _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i *)h)));
+        std::memcpy(dst + i, f, sizeof(float) * (count - i));
+    }
+}
+
+__attribute__((target("avx512f"))) static void float_to_half_avx512(const float *src, fp16 *dst,
+                                                                     int64_t count) {
+    int64_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m256i h = _mm512_cvtps_ph(_mm512_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT);
+        _mm256_storeu_si256((__m256i *)(dst + i), h);
+    }
+    if (i < count) {
+        float f[16] = {};
+        fp16 h[16];
+        std::memcpy(f, src + i, sizeof(float) * (count - i));
+        _mm256_storeu_si256((__m256i *)h,
+                            _mm512_cvtps_ph(_mm512_loadu_ps(f), _MM_FROUND_TO_NEAREST_INT));
+        std::memcpy(dst + i, h, sizeof(fp16) * (count - i));
+    }
+}
+
+// bfloat16 is the upper half of a float: widening is a shift, and narrowing
+//  adds the rounding bias 0x7fff plus the lowest kept bit before shifting,
+//  except for NaNs, which are truncated and made quiet. All of it is exact
+//  integer arithmetic, so tails go through the scalar conversion.
+
+__attribute__((target("avx2"))) static void bfloat16_to_float_avx2(const bfloat16 *src,
+                                                                   float *dst, int64_t count) {
+    int64_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i w = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)(src + i)));
+        _mm256_storeu_si256((__m256i *)(dst + i), _mm256_slli_epi32(w, 16));
+    }
+    for (; i < count; i++)
+        dst[i] = float(src[i]);
+}
+
+__attribute__((target("avx2"))) static void float_to_bfloat16_avx2(const float *src,
+                                                                   bfloat16 *dst, int64_t count) {
+    const __m256i bias  = _mm256_set1_epi32(0x7fff);
+    const __m256i one   = _mm256_set1_epi32(1);
+    const __m256i quiet = _mm256_set1_epi32(0x40);
+    int64_t i           = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 f    = _mm256_loadu_ps(src + i);
+        __m256i u   = _mm256_castps_si256(f);
+        __m256i hi  = _mm256_srli_epi32(u, 16);
+        __m256i r   = _mm256_add_epi32(u, _mm256_add_epi32(bias, _mm256_and_si256(hi, one)));
+        __m256i nan = _mm256_castps_si256(_mm256_cmp_ps(f, f, _CMP_UNORD_Q));
+        r = _mm256_blendv_epi8(_mm256_srli_epi32(r, 16), _mm256_or_si256(hi, quiet), nan);
+        // Values fit in 16 bits, so the saturating pack only narrows them;
+        //  the permute puts the two lanes' halves together.
+        __m256i p = _mm256_permute4x64_epi64(_mm256_packus_epi32(r, r), 0xd8);
+        _mm_storeu_si128((__m128i *)(dst + i), _mm256_castsi256_si128(p));
+    }
+    for (; i < count; i++)
+        dst[i] = bfloat16(src[i]);
+}
+
+__attribute__((target("avx512f"))) static void bfloat16_to_float_avx512(const bfloat16 *src,
+                                                                        float *dst,
+                                                                        int64_t count) {
+    int64_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m512i w = _mm512_cvtepu16_epi32(_mm256_loadu_si256((const __m256i *)(src + i)));
+        _mm512_storeu_si512(dst + i, _mm512_slli_epi32(w, 16));
+    }
+    for (; i < count; i++)
+        dst[i] = float(src[i]);
+}
+
+__attribute__((target("avx512f"))) static void float_to_bfloat16_avx512(const float *src,
+                                                                        bfloat16 *dst,
+                                                                        int64_t count) {
+    const __m512i bias  = _mm512_set1_epi32(0x7fff);
+    const __m512i one   = _mm512_set1_epi32(1);
+    const __m512i quiet = _mm512_set1_epi32(0x40);
+    int64_t i           = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m512 f      = _mm512_loadu_ps(src + i);
+        __m512i u     = _mm512_castps_si512(f);
+        __m512i hi    = _mm512_srli_epi32(u, 16);
+        __m512i r     = _mm512_add_epi32(u, _mm512_add_epi32(bias, _mm512_and_si512(hi, one)));
+        __mmask16 nan = _mm512_cmp_ps_mask(f, f, _CMP_UNORD_Q);
+        r = _mm512_mask_mov_epi32(_mm512_srli_epi32(r, 16), nan, _mm512_or_si512(hi, quiet));
+        _mm256_storeu_si256((__m256i *)(dst + i), _mm512_cvtepi32_epi16(r));
+    }
+    for (; i < count; i++)
+        dst[i] = bfloat16(src[i]);
+}
+
+#endif
+
+// The widest kernels the CPU runs, picked on first use.
+struct convert_kernels {
+    void (*to_float)(const fp16 *, float *, int64_t);
+    void (*to_half)(const float *, fp16 *, int64_t);
+    void (*bf16_to_float)(const bfloat16 *, float *, int64_t);
+    void (*to_bf16)(const float *, bfloat16 *, int64_t);
+
+    convert_kernels()
+            : to_float(half_to_float_scalar),
+              to_half(float_to_half_scalar),
+              bf16_to_float(bfloat16_to_float_scalar),
+              to_bf16(float_to_bfloat16_scalar) {
+#ifdef ONEMKL_MKLCPU_CONVERT_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) {
+            to_float      = half_to_float_avx512;
+            to_half       = float_to_half_avx512;
+            bf16_to_float = bfloat16_to_float_avx512;
+            to_bf16       = float_to_bfloat16_avx512;
+        }
+        else {
+            if (__builtin_cpu_supports("avx") && __builtin_cpu_supports("f16c")) {
+                to_float = half_to_float_f16c;
+                to_half  = float_to_half_f16c;
+            }
+            if (__builtin_cpu_supports("avx2")) {
+                bf16_to_float = bfloat16_to_float_avx2;
+                to_bf16       = float_to_bfloat16_avx2;
+            }
+        }
+#endif
+    }
+};
+
+static const convert_kernels &kernels() {
+    static const convert_kernels k;
+    return k;
+}
+
+void half_to_float(const fp16 *src, float *dst, int64_t count) {
+    kernels().to_float(src, dst, count);
+}
+
+void float_to_half(const float *src, fp16 *dst, int64_t count) {
+    kernels().to_half(src, dst, count);
+}
+
+void bfloat16_to_float(const bfloat16 *src, float *dst, int64_t count) {
+    kernels().bf16_to_float(src, dst, count);
+}
+
+void float_to_bfloat16(const float *src, bfloat16 *dst, int64_t count) {
+    kernels().to_bf16(src, dst, count);
+}
+
+// Matrices are converted in chunks of about convert_grain values, spread
+//  over the threads by parallel_for.
+static constexpr int64_t convert_grain = 65536;
+
+template <typename S, typename D>
+static void convert_matrix(void (*kernel)(const S *, D *, int64_t), int64_t rows, int64_t cols,
+                           const S *src, int64_t ld_src, D *dst, int64_t ld_dst) {
+    if (rows <= 0 || cols <= 0)
+        return;
+    if (rows == ld_src && rows == ld_dst) {
+        int64_t count  = rows * cols;
+        int64_t chunks = (count + convert_grain - 1) / convert_grain;
+        parallel_for(0, chunks, [&](int64_t c) {
+            int64_t begin = c * convert_grain;
+            kernel(src + begin, dst + begin, std::min(convert_grain, count - begin));
+        });
+        return;
+    }
+    int64_t step   = std::max<int64_t>(1, convert_grain / rows);
+    int64_t chunks = (cols + step - 1) / step;
+    parallel_for(0, chunks, [&](int64_t c) {
+        int64_t end = std::min(cols, (c + 1) * step);
+        for (int64_t j = c * step; j < end; j++)
+            kernel(src + j * ld_src, dst + j * ld_dst, rows);
+    });
+}
+
+void half_to_float(int64_t rows, int64_t cols, const fp16 *src, int64_t ld_src, float *dst,
+                   int64_t ld_dst) {
+    convert_matrix(kernels().to_float, rows, cols, src, ld_src, dst, ld_dst);
+}
+
+void float_to_half(int64_t rows, int64_t cols, const float *src, int64_t ld_src, fp16 *dst,
+                   int64_t ld_dst) {
+    convert_matrix(kernels().to_half, rows, cols, src, ld_src, dst, ld_dst);
+}
+
+void bfloat16_to_float(int64_t rows, int64_t cols, const bfloat16 *src, int64_t ld_src,
+                       float *dst, int64_t ld_dst) {
+    convert_matrix(kernels().bf16_to_float, rows, cols, src, ld_src, dst, ld_dst);
+}
+
+void float_to_bfloat16(int64_t rows, int64_t cols, const float *src, int64_t ld_src,
+                       bfloat16 *dst, int64_t ld_dst) {
+    convert_matrix(kernels().to_bf16, rows, cols, src, ld_src, dst, ld_dst);
+}
+
+} // namespace mklcpu
+} // namespace onemkl
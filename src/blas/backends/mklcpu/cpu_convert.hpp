@@ -0,0 +1,57 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _MKL_CPU_CONVERT_HPP_
+#define _MKL_CPU_CONVERT_HPP_
+
+#include <cstdint>
+
+#include "fp16.hpp"
+#include "onemkl/bfloat16.hpp"
+
+namespace onemkl {
+namespace mklcpu {
+
+// Conversions between fp16 and float of count contiguous values, with
+//  AVX-512F or F16C when the CPU has them and the fp16 class otherwise. The
+//  vector paths round to nearest even and keep denormals.
+void half_to_float(const fp16 *src, float *dst, int64_t count);
+void float_to_half(const float *src, fp16 *dst, int64_t count);
+
+// The same for rows x cols column-major matrices.
+void half_to_float(int64_t rows, int64_t cols, const fp16 *src, int64_t ld_src, float *dst,
+                   int64_t ld_dst);
+void float_to_half(int64_t rows, int64_t cols, const float *src, int64_t ld_src, fp16 *dst,
+                   int64_t ld_dst);
+
+// Conversions between bfloat16 and float, with AVX-512F or AVX2 when the CPU
+//  has them. Widening is exact; narrowing rounds to nearest even and keeps
+//  NaNs quiet, as bfloat16(float) does.
+void bfloat16_to_float(const bfloat16 *src, float *dst, int64_t count);
+void float_to_bfloat16(const float *src, bfloat16 *dst, int64_t count);
+
+void bfloat16_to_float(int64_t rows, int64_t cols, const bfloat16 *src, int64_t ld_src,
+                       float *dst, int64_t ld_dst);
+void float_to_bfloat16(int64_t rows, int64_t cols, const float *src, int64_t ld_src,
+                       bfloat16 *dst, int64_t ld_dst);
+
+} // namespace mklcpu
+} // namespace onemkl
+
+#endif //_MKL_CPU_CONVERT_HPP_
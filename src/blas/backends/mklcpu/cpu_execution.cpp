@@ -0,0 +1,174 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <CL/sycl.hpp>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "cpu_common.hpp"
+#include "include/device_cache.hpp"
+#include "onemkl/blas/detail/mklcpu/onemkl_blas_mklcpu.hpp"
+
+namespace onemkl {
+namespace mklcpu {
+
+// Policies are keyed by the implementation object of the queue, held weakly:
+//  a policy does not keep its queue and context alive, and a queue created
+//  after it is destroyed never matches its entry, even at the same address.
+//  Entries of destroyed queues are dropped by the next set(). Few queues have
+//  their own settings, a linear search is enough.
+typedef decltype(cl::sycl::detail::getSyclObjImpl(std::declval<cl::sycl::queue>())) queue_impl;
+typedef std::weak_ptr<typename queue_impl::element_type> queue_key;
+
+struct policy_entry {
+    queue_key queue;
+    std::shared_ptr<const execution_policy> policy;
+};
+
+typedef std::vector<policy_entry> policy_map;
+
+// Whether key refers to the same queue object as impl. Comparing the owners
+//  takes no reference.
+static bool same_queue(const queue_key &key, const queue_impl &impl) {
+    return !key.owner_before(impl) && !impl.owner_before(key);
+}
+
+// set() publishes a new immutable snapshot and bumps the generation. Each
+//  thread keeps the snapshot it last read, and takes the lock only to pick up
+//  a newer one, so lookups on the submission path do not contend.
+static std::mutex policies_mutex;
+static std::shared_ptr<const policy_map> policies;
+static std::atomic<std::uint64_t> policies_generation(0);
+
+static const policy_map *current_policies() {
+    static thread_local std::shared_ptr<const policy_map> snapshot;
+    static thread_local std::uint64_t generation = 0;
+    std::uint64_t latest = policies_generation.load(std::memory_order_acquire);
+    if (generation != latest) {
+        std::lock_guard<std::mutex> lock(policies_mutex);
+        snapshot   = policies;
+        generation = policies_generation.load(std::memory_order_relaxed);
+    }
+    return snapshot.get();
+}
+
+std::shared_ptr<const execution_policy> execution_policy::get(const cl::sycl::queue &queue) {
+    auto map = current_policies();
+    if (!map)
+        return nullptr;
+    queue_impl impl = cl::sycl::detail::getSyclObjImpl(queue);
+    for (auto &e : *map) {
+        if (same_queue(e.queue, impl))
+            return e.policy;
+    }
+    return nullptr;
+}
+
+void execution_policy::set(const cl::sycl::queue &queue,
+                           std::shared_ptr<const execution_policy> policy) {
+    queue_impl impl = cl::sycl::detail::getSyclObjImpl(queue);
+    std::lock_guard<std::mutex> lock(policies_mutex);
+    std::shared_ptr<policy_map> map(new policy_map());
+    if (policies) {
+        for (auto &e : *policies) {
+            if (!e.queue.expired() && !same_queue(e.queue, impl))
+                map->push_back(e);
+        }
+    }
+    if (policy)
+        map->push_back({ queue_key(impl), std::move(policy) });
+    if (map->empty())
+        map.reset();
+    policies = std::move(map);
+    policies_generation.fetch_add(1, std::memory_order_release);
+}
+
+std::int64_t inline_threshold(const cl::sycl::queue &queue) {
+    static thread_local queue_cache<std::int64_t> thresholds;
+    std::int64_t threshold;
+    if (thresholds.find(queue, threshold))
+        return threshold;
+    const char *env = std::getenv("ONEMKL_MKLCPU_INLINE_THRESHOLD");
+    threshold       = env ? (std::int64_t)std::strtoll(env, nullptr, 10) : (std::int64_t)0;
+    if (queue.has_property<cl::sycl::property::queue::in_order>() ||
+        (!queue.is_host() && !queue.get_device().is_cpu()))
+        threshold = 0;
+    thresholds.insert(queue, threshold);
+    return threshold;
+}
+
+void set_num_threads(cl::sycl::queue &queue, int num_threads) {
+    if (num_threads <= 0) {
+        execution_policy::set(queue, nullptr);
+        return;
+    }
+    std::shared_ptr<execution_policy> policy(new execution_policy());
+    policy->num_threads = num_threads;
+#ifdef ONEMKL_MKLCPU_THREAD_TBB
+    policy->arena = std::make_shared<tbb::task_arena>(num_threads);
+#endif
+    execution_policy::set(queue, std::move(policy));
+}
+
+// arena, when given, is a tbb::task_arena owned by the caller. Without TBB
+//  threading there is no arena to run in, and only the concurrency is kept as
+//  a thread budget.
+void set_task_arena(cl::sycl::queue &queue, int max_concurrency, int numa_node, void *arena) {
+    std::shared_ptr<execution_policy> policy(new execution_policy());
+#ifdef ONEMKL_MKLCPU_THREAD_TBB
+    if (arena) {
+        // The caller keeps ownership.
+        policy->arena.reset(static_cast<tbb::task_arena *>(arena), [](tbb::task_arena *) {});
+        policy->num_threads = policy->arena->max_concurrency();
+        execution_policy::set(queue, std::move(policy));
+        return;
+    }
+    if (max_concurrency <= 0 && numa_node < 0) {
+        execution_policy::set(queue, nullptr);
+        return;
+    }
+    int concurrency = max_concurrency > 0 ? max_concurrency : tbb::task_arena::automatic;
+    #if TBB_INTERFACE_VERSION >= 12000
+    if (numa_node >= 0)
+        policy->arena = std::make_shared<tbb::task_arena>(
+            tbb::task_arena::constraints(numa_node, concurrency));
+    else
+        policy->arena = std::make_shared<tbb::task_arena>(concurrency);
+    #else
+    // NUMA constraints need oneTBB; older TBB only limits the concurrency.
+    policy->arena = std::make_shared<tbb::task_arena>(concurrency);
+    #endif
+    policy->num_threads = max_concurrency > 0 ? max_concurrency : 0;
+#else
+    if (max_concurrency <= 0) {
+        execution_policy::set(queue, nullptr);
+        return;
+    }
+    policy->num_threads = max_concurrency;
+#endif
+    execution_policy::set(queue, std::move(policy));
+}
+
+} // namespace mklcpu
+} // namespace onemkl
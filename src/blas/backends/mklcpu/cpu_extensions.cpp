@@ -18,65 +18,186 @@
 *******************************************************************************/
 
 #include <CL/sycl.hpp>
+#include <algorithm>
+#include <type_traits>
 
 #include "cpu_common.hpp"
+#include "cpu_convert.hpp"
+#include "cpu_scratch.hpp"
+#include "cpu_stats.hpp"
 #include "fp16.hpp"
+#include "mkl_version.h"
 #include "onemkl/blas/detail/mklcpu/onemkl_blas_mklcpu.hpp"
 
 namespace onemkl {
 namespace mklcpu {
 
-template <typename T_src, typename T_dest>
-static inline void copy_mat(T_src &src, transpose trans, int64_t row, int64_t col, int64_t ld,
-                            T_dest off, T_dest *&dest) {
-    int64_t i, j;
-    if (trans == transpose::N) {
-        for (j = 0; j < col; j++) {
-            for (i = 0; i < row; i++) {
-                dest[i + ld * j] = (T_dest)src[i + ld * j] - off;
-            }
-        }
+// Blocking of the fp16 and bfloat16 GEMMs. Panels of op(A) and op(B), up to
+//  half_block_k deep, are converted to float as sgemm needs them, for one
+//  half_block_m x half_block_n block of C at a time, so the float workspace
+//  stays within 8 MiB whatever the size of the matrices.
+static constexpr int64_t half_block_m = 1024;
+static constexpr int64_t half_block_n = 1024;
+static constexpr int64_t half_block_k = 512;
+
+// Conversions of the GEMM inputs and outputs, by data type. The bytes read
+//  and written are counted while statistics are on.
+static inline void to_float(int64_t rows, int64_t cols, const fp16 *src, int64_t ld_src,
+                            float *dst, int64_t ld_dst) {
+    half_to_float(rows, cols, src, ld_src, dst, ld_dst);
+    stats_count(cpu_counter::fp16_conversion_bytes, rows * cols * (sizeof(fp16) + sizeof(float)));
+}
+
+static inline void to_float(int64_t rows, int64_t cols, const bfloat16 *src, int64_t ld_src,
+                            float *dst, int64_t ld_dst) {
+    bfloat16_to_float(rows, cols, src, ld_src, dst, ld_dst);
+    stats_count(cpu_counter::bf16_conversion_bytes,
+                rows * cols * (sizeof(bfloat16) + sizeof(float)));
+}
+
+static inline void from_float(int64_t rows, int64_t cols, const float *src, int64_t ld_src,
+                              fp16 *dst, int64_t ld_dst) {
+    float_to_half(rows, cols, src, ld_src, dst, ld_dst);
+    stats_count(cpu_counter::fp16_conversion_bytes, rows * cols * (sizeof(fp16) + sizeof(float)));
+}
+
+static inline void from_float(int64_t rows, int64_t cols, const float *src, int64_t ld_src,
+                              bfloat16 *dst, int64_t ld_dst) {
+    float_to_bfloat16(rows, cols, src, ld_src, dst, ld_dst);
+    stats_count(cpu_counter::bf16_conversion_bytes,
+                rows * cols * (sizeof(bfloat16) + sizeof(float)));
+}
+
+// A block of C as sgemm sees it: a float C in place, an fp16 or bfloat16 C
+//  through a float copy, read only when beta is not zero.
+struct float_block {
+    float *ptr;
+    int64_t ld;
+};
+
+static inline float_block load_block(float *c, int64_t ldc, int64_t, int64_t, float, float *) {
+    return { c, ldc };
+}
+
+template <typename T_c>
+static inline float_block load_block(T_c *c, int64_t ldc, int64_t rows, int64_t cols, float beta,
+                                     float *work) {
+    if (beta != 0.0f)
+        to_float(rows, cols, c, ldc, work, rows);
+    return { work, rows };
+}
+
+static inline void store_block(float *, int64_t, int64_t, int64_t, const float_block &) {}
+
+template <typename T_c>
+static inline void store_block(T_c *c, int64_t ldc, int64_t rows, int64_t cols,
+                               const float_block &block) {
+    from_float(rows, cols, block.ptr, block.ld, c, ldc);
+}
+
+// C = alpha * op(A) * op(B) + beta * C for fp16 or bfloat16 A and B, and a C
+//  of the same type or float, through sgemm on blocks converted on the fly.
+template <typename T_ab, typename T_c>
+static void gemm_blocked(scratch_routine routine, char transa, char transb, int64_t m, int64_t n,
+                         int64_t k, float alpha, const T_ab *a, int64_t lda, const T_ab *b,
+                         int64_t ldb, float beta, T_c *c, int64_t ldc) {
+    if (m <= 0 || n <= 0)
+        return;
+    int64_t mb = std::min(m, half_block_m);
+    int64_t nb = std::min(n, half_block_n);
+    int64_t kb = std::min(k, half_block_k);
+
+    std::size_t offset_b = scratch_align(sizeof(float) * mb * kb);
+    std::size_t offset_c = offset_b + scratch_align(sizeof(float) * kb * nb);
+    std::size_t size_c   = std::is_same<T_c, float>::value ? 0 : sizeof(float) * mb * nb;
+    scratch_buffer scratch(routine, std::max<std::size_t>(offset_c + size_c, 1));
+    float *f32_a = scratch.get<float>();
+    if (f32_a == NULL) {
+        std::cout << "Error cannot allocate input arrays\n";
+        return;
     }
-    else {
-        for (i = 0; i < row; i++) {
-            for (j = 0; j < col; j++) {
-                dest[i * ld + j] = (T_dest)src[i * ld + j] - off;
-            }
+    float *f32_b = scratch.get<float>(offset_b);
+    float *f32_c = scratch.get<float>(offset_c);
+
+    for (int64_t j = 0; j < n; j += nb) {
+        int64_t cols = std::min(nb, n - j);
+        for (int64_t i = 0; i < m; i += mb) {
+            int64_t rows      = std::min(mb, m - i);
+            T_c *c_block      = c + i + j * ldc;
+            float_block block = load_block(c_block, ldc, rows, cols, beta, f32_c);
+            float beta_p      = beta;
+            int64_t p         = 0;
+            do {
+                // Panels of op(A) and op(B), kept in the layout of A and B.
+                int64_t depth = std::min(kb, k - p);
+                int64_t lda_p, ldb_p;
+                if (transa == 'N') {
+                    to_float(rows, depth, a + i + p * lda, lda, f32_a, rows);
+                    lda_p = rows;
+                }
+                else {
+                    to_float(depth, rows, a + p + i * lda, lda, f32_a, depth);
+                    lda_p = std::max<int64_t>(depth, 1);
+                }
+                if (transb == 'N') {
+                    to_float(depth, cols, b + p + j * ldb, ldb, f32_b, depth);
+                    ldb_p = std::max<int64_t>(depth, 1);
+                }
+                else {
+                    to_float(cols, depth, b + j + p * ldb, ldb, f32_b, cols);
+                    ldb_p = cols;
+                }
+                ::sgemm((const char *)&transa, (const char *)&transb, (const MKL_INT *)&rows,
+                        (const MKL_INT *)&cols, (const MKL_INT *)&depth, (const float *)&alpha,
+                        f32_a, (const MKL_INT *)&lda_p, f32_b, (const MKL_INT *)&ldb_p,
+                        (const float *)&beta_p, block.ptr, (const MKL_INT *)&block.ld);
+                beta_p = 1.0f;
+                p += depth;
+            } while (p < k);
+            store_block(c_block, ldc, rows, cols, block);
         }
     }
 }
 
-template <typename T_src, typename T_dest, typename T_off>
-static inline void copy_mat(T_src &src, int64_t row, int64_t col, int64_t ld, offset off_kind,
-                            T_off off, T_dest &dest) {
-    using T_data = typename std::remove_reference<decltype(dest[0])>::type;
-    int64_t i, j;
-    T_data tmp;
-
-    if (off_kind == offset::F) {
-        tmp = off[0];
-        for (j = 0; j < col; j++) {
-            for (i = 0; i < row; i++) {
-                dest[i + ld * j] = tmp + (T_data)src[i + ld * j];
-            }
-        }
-    }
-    else if (off_kind == offset::C) {
-        for (j = 0; j < col; j++) {
-            for (i = 0; i < row; i++) {
-                tmp              = off[i];
-                dest[i + ld * j] = tmp + (T_data)src[i + ld * j];
-            }
-        }
+// C = alpha * op(A) * op(B) + beta * C for bfloat16 A and B. MKL multiplies
+//  bfloat16 matrices itself since 2020, so only a bfloat16 C goes through
+//  float, one block at a time; older versions convert A and B as well.
+template <typename T_c>
+static void gemm_bfloat16(scratch_routine routine, char transa, char transb, int64_t m, int64_t n,
+                          int64_t k, float alpha, const bfloat16 *a, int64_t lda,
+                          const bfloat16 *b, int64_t ldb, float beta, T_c *c, int64_t ldc) {
+#if INTEL_MKL_VERSION >= 20200000
+    if (m <= 0 || n <= 0)
+        return;
+    bool f32_c = std::is_same<T_c, float>::value;
+    int64_t mb = f32_c ? m : std::min(m, half_block_m);
+    int64_t nb = f32_c ? n : std::min(n, half_block_n);
+    scratch_buffer scratch(routine, f32_c ? 1 : sizeof(float) * mb * nb);
+    float *work = scratch.get<float>();
+    if (work == NULL) {
+        std::cout << "Error cannot allocate output arrays\n";
+        return;
     }
-    else {
-        for (j = 0; j < col; j++) {
-            tmp = off[j];
-            for (i = 0; i < row; i++) {
-                dest[i + ld * j] = tmp + (T_data)src[i + ld * j];
-            }
+    for (int64_t j = 0; j < n; j += nb) {
+        int64_t cols = std::min(nb, n - j);
+        for (int64_t i = 0; i < m; i += mb) {
+            int64_t rows           = std::min(mb, m - i);
+            T_c *c_block           = c + i + j * ldc;
+            float_block block      = load_block(c_block, ldc, rows, cols, beta, work);
+            const bfloat16 *a_rows = a + (transa == 'N' ? i : i * lda);
+            const bfloat16 *b_cols = b + (transb == 'N' ? j * ldb : j);
+            ::gemm_bf16bf16f32((const char *)&transa, (const char *)&transb,
+                               (const MKL_INT *)&rows, (const MKL_INT *)&cols,
+                               (const MKL_INT *)&k, (const float *)&alpha,
+                               (const MKL_BF16 *)a_rows, (const MKL_INT *)&lda,
+                               (const MKL_BF16 *)b_cols, (const MKL_INT *)&ldb,
+                               (const float *)&beta, block.ptr, (const MKL_INT *)&block.ld);
+            store_block(c_block, ldc, rows, cols, block);
         }
     }
+#else
+    gemm_blocked(routine, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+#endif
 }
 
 // Buffer APIs
@@ -97,28 +218,32 @@ void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
         auto accessor_a    = a_fp16.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b    = b_fp16.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c    = c_fp16.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_hgemm>(cgh, [=]() {
-            int64_t sizea, sizeb, sizec;
-            sizea = (transa == transpose::N) ? lda * k : lda * m;
-            sizeb = (transb == transpose::N) ? ldb * n : ldb * k;
-            sizec = ldc * n;
-            // copy A, B and C to float
-            float *f32_a = (float *)::malloc(sizeof(float) * sizea);
-            float *f32_b = (float *)::malloc(sizeof(float) * sizeb);
-            float *f32_c = (float *)::malloc(sizeof(float) * sizec);
-            copy_mat(accessor_a, transa, m, k, lda, 0.0f, f32_a);
-            copy_mat(accessor_b, transb, k, n, ldb, 0.0f, f32_b);
-            copy_mat(accessor_c, transpose::N, m, n, ldc, 0.0f, f32_c);
-            ::sgemm((const char *)&transa_, (const char *)&transb_, (const MKL_INT *)&m,
-                    (const MKL_INT *)&n, (const MKL_INT *)&k, (const float *)&f32_alpha, f32_a,
-                    (const MKL_INT *)&lda, f32_b, (const MKL_INT *)&ldb, (const float *)&f32_beta,
-                    f32_c, (const MKL_INT *)&ldc);
-            // copy C back to half
-            fp16 co = 0.0f;
-            copy_mat(f32_c, m, n, ldc, offset::F, &co, accessor_c);
-            ::free(f32_a);
-            ::free(f32_b);
-            ::free(f32_c);
+        host_task<class mkl_kernel_hgemm>(cgh, queue, [=]() {
+            gemm_blocked<fp16, fp16>(scratch_routine::gemm_half, transa_, transb_, m, n, k,
+                                     f32_alpha, accessor_a.get_pointer(), lda,
+                                     accessor_b.get_pointer(), ldb, f32_beta,
+                                     accessor_c.get_pointer(), ldc);
+        });
+    });
+}
+
+void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+          int64_t k, bfloat16 alpha, cl::sycl::buffer<bfloat16, 1> &a, int64_t lda,
+          cl::sycl::buffer<bfloat16, 1> &b, int64_t ldb, bfloat16 beta,
+          cl::sycl::buffer<bfloat16, 1> &c, int64_t ldc) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        const char transa_ = *fortran_char(transa);
+        const char transb_ = *fortran_char(transb);
+        float f32_alpha    = (float)alpha;
+        float f32_beta     = (float)beta;
+        auto accessor_a    = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b    = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_c    = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_gemm_bf16bf16bf16>(cgh, queue, [=]() {
+            gemm_bfloat16<bfloat16>(scratch_routine::gemm_bf16, transa_, transb_, m, n, k,
+                                    f32_alpha, accessor_a.get_pointer(), lda,
+                                    accessor_b.get_pointer(), ldb, f32_beta,
+                                    accessor_c.get_pointer(), ldc);
         });
     });
 }
@@ -171,21 +296,29 @@ void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb, int64_
         auto accessor_a    = a_fp16.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b    = b_fp16.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c    = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_gemm_f16f16f32>(cgh, [=]() {
-            int64_t sizea, sizeb;
-            sizea = (transa == transpose::N) ? lda * k : lda * m;
-            sizeb = (transb == transpose::N) ? ldb * n : ldb * k;
-            // copy A and B to float
-            float *f32_a = (float *)::malloc(sizeof(float) * sizea);
-            float *f32_b = (float *)::malloc(sizeof(float) * sizeb);
-            copy_mat(accessor_a, transa, m, k, lda, 0.0f, f32_a);
-            copy_mat(accessor_b, transb, k, n, ldb, 0.0f, f32_b);
-            ::sgemm((const char *)&transa_, (const char *)&transb_, (const MKL_INT *)&m,
-                    (const MKL_INT *)&n, (const MKL_INT *)&k, (const float *)&alpha, f32_a,
-                    (const MKL_INT *)&lda, f32_b, (const MKL_INT *)&ldb, (const float *)&beta,
-                    accessor_c.get_pointer(), (const MKL_INT *)&ldc);
-            ::free(f32_a);
-            ::free(f32_b);
+        host_task<class mkl_kernel_gemm_f16f16f32>(cgh, queue, [=]() {
+            gemm_blocked<fp16, float>(scratch_routine::gemm_ext_half, transa_, transb_, m, n, k,
+                                      alpha, accessor_a.get_pointer(), lda,
+                                      accessor_b.get_pointer(), ldb, beta,
+                                      accessor_c.get_pointer(), ldc);
+        });
+    });
+}
+
+void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+              int64_t k, float alpha, cl::sycl::buffer<bfloat16, 1> &a, int64_t lda,
+              cl::sycl::buffer<bfloat16, 1> &b, int64_t ldb, float beta,
+              cl::sycl::buffer<float, 1> &c, int64_t ldc) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        const char transa_ = *fortran_char(transa);
+        const char transb_ = *fortran_char(transb);
+        auto accessor_a    = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b    = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_c    = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_gemm_bf16bf16f32>(cgh, queue, [=]() {
+            gemm_bfloat16<float>(scratch_routine::gemm_ext_bf16, transa_, transb_, m, n, k, alpha,
+                                 accessor_a.get_pointer(), lda, accessor_b.get_pointer(), ldb,
+                                 beta, accessor_c.get_pointer(), ldc);
         });
     });
 }
@@ -202,7 +335,7 @@ void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb, offset
         auto accessor_b     = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c     = c.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_co    = co.get_access<cl::sycl::access::mode::read>(cgh);
-        host_task<class mkl_kernel_gemm_s8u8s32>(cgh, [=]() {
+        host_task<class mkl_kernel_gemm_s8u8s32>(cgh, queue, [=]() {
             MKL_INT8 *a_mat =
                 static_cast<MKL_INT8 *>(static_cast<void *>(accessor_a.get_pointer()));
             MKL_UINT8 *b_mat =
@@ -230,7 +363,7 @@ void gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa, transpose
         auto accessor_a         = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b         = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c         = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_sgemmt>(cgh, [=]() {
+        host_task<class mkl_kernel_sgemmt>(cgh, queue, [=]() {
             ::sgemmt((const char *)&upper_lower_, (const char *)&transa_, (const char *)&transb_,
                      (const MKL_INT *)&n, (const MKL_INT *)&k, (const float *)&alpha,
                      accessor_a.get_pointer(), (const MKL_INT *)&lda, accessor_b.get_pointer(),
@@ -251,7 +384,7 @@ void gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa, transpose
         auto accessor_a         = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b         = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c         = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dgemmt>(cgh, [=]() {
+        host_task<class mkl_kernel_dgemmt>(cgh, queue, [=]() {
             ::dgemmt((const char *)&upper_lower_, (const char *)&transa_, (const char *)&transb_,
                      (const MKL_INT *)&n, (const MKL_INT *)&k, (const double *)&alpha,
                      accessor_a.get_pointer(), (const MKL_INT *)&lda, accessor_b.get_pointer(),
@@ -274,7 +407,7 @@ void gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa, transpose
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_cgemmt>(cgh, [=]() {
+        host_task<class mkl_kernel_cgemmt>(cgh, queue, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_  = { beta_real, beta_imag };
             ::cgemmt((const char *)&upper_lower_, (const char *)&transa_, (const char *)&transb_,
@@ -299,7 +432,7 @@ void gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa, transpose
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zgemmt>(cgh, [=]() {
+        host_task<class mkl_kernel_zgemmt>(cgh, queue, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_  = { beta_real, beta_imag };
             ::zgemmt((const char *)&upper_lower_, (const char *)&transa_, (const char *)&transb_,
@@ -313,6 +446,95 @@ void gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa, transpose
 
 // USM APIs
 
+cl::sycl::event gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                     int64_t n, int64_t k, bfloat16 alpha, const bfloat16 *a, int64_t lda,
+                     const bfloat16 *b, int64_t ldb, bfloat16 beta, bfloat16 *c, int64_t ldc,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        const char transa_ = *fortran_char(transa);
+        const char transb_ = *fortran_char(transb);
+        float f32_alpha    = (float)alpha;
+        float f32_beta     = (float)beta;
+        host_task<class mkl_kernel_gemm_bf16bf16bf16_usm>(cgh, queue, [=]() {
+            gemm_bfloat16<bfloat16>(scratch_routine::gemm_bf16, transa_, transb_, m, n, k,
+                                    f32_alpha, a, lda, b, ldb, f32_beta, c, ldc);
+        });
+    });
+    return done;
+}
+
+cl::sycl::event gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                         int64_t n, int64_t k, float alpha, const half *a, int64_t lda,
+                         const half *b, int64_t ldb, float beta, float *c, int64_t ldc,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        const char transa_ = *fortran_char(transa);
+        const char transb_ = *fortran_char(transb);
+        host_task<class mkl_kernel_gemm_f16f16f32_usm>(cgh, queue, [=]() {
+            const fp16 *a_fp16 = static_cast<const fp16 *>(static_cast<const void *>(a));
+            const fp16 *b_fp16 = static_cast<const fp16 *>(static_cast<const void *>(b));
+            gemm_blocked<fp16, float>(scratch_routine::gemm_ext_half, transa_, transb_, m, n, k,
+                                      alpha, a_fp16, lda, b_fp16, ldb, beta, c, ldc);
+        });
+    });
+    return done;
+}
+
+cl::sycl::event gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                         int64_t n, int64_t k, float alpha, const bfloat16 *a, int64_t lda,
+                         const bfloat16 *b, int64_t ldb, float beta, float *c, int64_t ldc,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        const char transa_ = *fortran_char(transa);
+        const char transb_ = *fortran_char(transb);
+        host_task<class mkl_kernel_gemm_bf16bf16f32_usm>(cgh, queue, [=]() {
+            gemm_bfloat16<float>(scratch_routine::gemm_ext_bf16, transa_, transb_, m, n, k, alpha,
+                                 a, lda, b, ldb, beta, c, ldc);
+        });
+    });
+    return done;
+}
+
+cl::sycl::event gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb, offset offsetc,
+                         int64_t m, int64_t n, int64_t k, float alpha, const int8_t *a, int64_t lda,
+                         int8_t ao, const uint8_t *b, int64_t ldb, uint8_t bo, float beta,
+                         int32_t *c, int64_t ldc, const int32_t *co,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        const char transa_  = *fortran_char(transa);
+        const char transb_  = *fortran_char(transb);
+        const char offsetc_ = *fortran_char(offsetc);
+        host_task<class mkl_kernel_gemm_s8u8s32_usm>(cgh, queue, [=]() {
+            const MKL_INT8 *a_mat = static_cast<const MKL_INT8 *>(static_cast<const void *>(a));
+            const MKL_UINT8 *b_mat = static_cast<const MKL_UINT8 *>(static_cast<const void *>(b));
+            MKL_INT8 bo_internal = -bo;
+            MKL_INT8 ao_internal = -ao;
+            ::gemm_s8u8s32((const char *)&transa_, (const char *)&transb_, (const char *)&offsetc_,
+                           (const MKL_INT *)&m, (const MKL_INT *)&n, (const MKL_INT *)&k,
+                           (const float *)&alpha, a_mat, (const MKL_INT *)&lda, &ao_internal, b_mat,
+                           (const MKL_INT *)&ldb, &bo_internal, (const float *)&beta,
+                           (MKL_INT32 *)c, (const MKL_INT *)&ldc, (const MKL_INT32 *)co);
+        });
+    });
+    return done;
+}
+
 cl::sycl::event gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa, transpose transb,
                       int64_t n, int64_t k, float alpha, const float *a, int64_t lda,
                       const float *b, int64_t ldb, float beta, float *c, int64_t ldc,
@@ -325,7 +547,7 @@ cl::sycl::event gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa
         const char upper_lower_ = *fortran_char(upper_lower);
         const char transa_      = *fortran_char(transa);
         const char transb_      = *fortran_char(transb);
-        host_task<class mkl_kernel_sgemmt_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_sgemmt_usm>(cgh, queue, [=]() {
             ::sgemmt((const char *)&upper_lower_, (const char *)&transa_, (const char *)&transb_,
                      (const MKL_INT *)&n, (const MKL_INT *)&k, (const float *)&alpha, a,
                      (const MKL_INT *)&lda, b, (const MKL_INT *)&ldb, (const float *)&beta, c,
@@ -347,7 +569,7 @@ cl::sycl::event gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa
         const char upper_lower_ = *fortran_char(upper_lower);
         const char transa_      = *fortran_char(transa);
         const char transb_      = *fortran_char(transb);
-        host_task<class mkl_kernel_dgemmt_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_dgemmt_usm>(cgh, queue, [=]() {
             ::dgemmt((const char *)&upper_lower_, (const char *)&transa_, (const char *)&transb_,
                      (const MKL_INT *)&n, (const MKL_INT *)&k, (const double *)&alpha, a,
                      (const MKL_INT *)&lda, b, (const MKL_INT *)&ldb, (const double *)&beta, c,
@@ -372,7 +594,7 @@ cl::sycl::event gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa
         const char transb_      = *fortran_char(transb);
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
         float beta_real = beta.real(), beta_imag = beta.imag();
-        host_task<class mkl_kernel_cgemmt_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_cgemmt_usm>(cgh, queue, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_  = { beta_real, beta_imag };
             ::cgemmt((const char *)&upper_lower_, (const char *)&transa_, (const char *)&transb_,
@@ -399,7 +621,7 @@ cl::sycl::event gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa
         const char transb_      = *fortran_char(transb);
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
         double beta_real = beta.real(), beta_imag = beta.imag();
-        host_task<class mkl_kernel_zgemmt_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_zgemmt_usm>(cgh, queue, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_  = { beta_real, beta_imag };
             ::zgemmt((const char *)&upper_lower_, (const char *)&transa_, (const char *)&transb_,
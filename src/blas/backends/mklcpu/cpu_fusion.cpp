@@ -0,0 +1,124 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <CL/sycl.hpp>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "cpu_common.hpp"
+#include "onemkl/blas/detail/mklcpu/onemkl_blas_mklcpu.hpp"
+
+namespace onemkl {
+namespace mklcpu {
+
+// Calls of a submitted batch. Its task takes them when it starts; until then
+//  the recorder can append more.
+struct fused_batch {
+    std::mutex mutex;
+    std::vector<std::function<void()>> calls;
+    bool started = false;
+};
+
+std::uint64_t &thread_submissions() {
+    static thread_local std::uint64_t submissions = 0;
+    return submissions;
+}
+
+// Few scopes are open at once on a thread, a linear search is enough.
+static thread_local std::vector<std::unique_ptr<fusion_recorder>> recorders;
+
+fusion_recorder *fusion_recorder::active(const cl::sycl::queue &queue) {
+    for (auto &r : recorders) {
+        if (r->queue == queue)
+            return r.get();
+    }
+    return nullptr;
+}
+
+cl::sycl::event fusion_recorder::record(
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies, std::function<void()> f) {
+    // Work submitted after the batch, e.g. a GEMM or a buffer call, must run
+    //  before the calls made after it: a call only joins the batch when it is
+    //  still the last thing this thread submitted.
+    if (batch && dependencies.empty() && batch_submission == thread_submissions()) {
+        std::lock_guard<std::mutex> lock(batch->mutex);
+        if (!batch->started) {
+            batch->calls.push_back(std::move(f));
+            return last;
+        }
+    }
+
+    // The pending batch has started or was followed by other work, or the
+    //  call must wait for dependencies the earlier calls do not have: start a
+    //  new batch after the previous one.
+    batch = std::make_shared<fused_batch>();
+    batch->calls.push_back(std::move(f));
+    auto pending = batch;
+    last         = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        if (has_last)
+            cgh.depends_on(last);
+        host_task<class mkl_kernel_fused>(cgh, queue, [=]() {
+            std::vector<std::function<void()>> calls;
+            {
+                std::lock_guard<std::mutex> lock(pending->mutex);
+                pending->started = true;
+                calls.swap(pending->calls);
+            }
+            for (auto &call : calls)
+                call();
+        });
+    });
+    has_last         = true;
+    batch_submission = thread_submissions();
+    return last;
+}
+
+void fusion_recorder::flush() {
+    batch.reset();
+}
+
+void fused_begin(cl::sycl::queue &queue) {
+    auto recorder = fusion_recorder::active(queue);
+    if (!recorder) {
+        recorders.emplace_back(new fusion_recorder(queue));
+        recorder = recorders.back().get();
+    }
+    recorder->depth++;
+}
+
+void fused_end(cl::sycl::queue &queue) {
+    auto recorder = fusion_recorder::active(queue);
+    if (!recorder || --recorder->depth > 0)
+        return;
+    recorder->flush();
+    for (auto it = recorders.begin(); it != recorders.end(); ++it) {
+        if (it->get() == recorder) {
+            recorders.erase(it);
+            break;
+        }
+    }
+}
+
+} // namespace mklcpu
+} // namespace onemkl
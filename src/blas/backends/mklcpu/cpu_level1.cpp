@@ -32,7 +32,7 @@ void asum(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int6
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x      = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
-        host_task<class mkl_kernel_sasum>(cgh, [=]() {
+        host_task<class mkl_kernel_sasum>(cgh, queue, [=]() {
             accessor_result[0] =
                 ::sasum((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx);
         });
@@ -44,7 +44,7 @@ void asum(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, int
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x      = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
-        host_task<class mkl_kernel_dasum>(cgh, [=]() {
+        host_task<class mkl_kernel_dasum>(cgh, queue, [=]() {
             accessor_result[0] =
                 ::dasum((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx);
         });
@@ -56,7 +56,7 @@ void asum(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<float
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x      = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
-        host_task<class mkl_kernel_scasum>(cgh, [=]() {
+        host_task<class mkl_kernel_scasum>(cgh, queue, [=]() {
             accessor_result[0] =
                 ::scasum((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx);
         });
@@ -68,7 +68,7 @@ void asum(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<doubl
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x      = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
-        host_task<class mkl_kernel_dzasum>(cgh, [=]() {
+        host_task<class mkl_kernel_dzasum>(cgh, queue, [=]() {
             accessor_result[0] =
                 ::dzasum((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx);
         });
@@ -80,7 +80,7 @@ void axpy(cl::sycl::queue &queue, int64_t n, float alpha, cl::sycl::buffer<float
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_saxpy>(cgh, [=]() {
+        host_task<class mkl_kernel_saxpy>(cgh, queue, [=]() {
             ::saxpy((const MKL_INT *)&n, (const float *)&alpha, accessor_x.get_pointer(),
                     (const MKL_INT *)&incx, accessor_y.get_pointer(), (const MKL_INT *)&incy);
         });
@@ -92,7 +92,7 @@ void axpy(cl::sycl::queue &queue, int64_t n, double alpha, cl::sycl::buffer<doub
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_daxpy>(cgh, [=]() {
+        host_task<class mkl_kernel_daxpy>(cgh, queue, [=]() {
             ::daxpy((const MKL_INT *)&n, (const double *)&alpha, accessor_x.get_pointer(),
                     (const MKL_INT *)&incx, accessor_y.get_pointer(), (const MKL_INT *)&incy);
         });
@@ -106,7 +106,7 @@ void axpy(cl::sycl::queue &queue, int64_t n, std::complex<float> alpha,
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_caxpy>(cgh, [=]() {
+        host_task<class mkl_kernel_caxpy>(cgh, queue, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             ::caxpy((const MKL_INT *)&n, (const MKL_Complex8 *)&alpha_, accessor_x.get_pointer(),
                     (const MKL_INT *)&incx, accessor_y.get_pointer(), (const MKL_INT *)&incy);
@@ -121,7 +121,7 @@ void axpy(cl::sycl::queue &queue, int64_t n, std::complex<double> alpha,
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zaxpy>(cgh, [=]() {
+        host_task<class mkl_kernel_zaxpy>(cgh, queue, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             ::zaxpy((const MKL_INT *)&n, (const MKL_Complex16 *)&alpha_, accessor_x.get_pointer(),
                     (const MKL_INT *)&incx, accessor_y.get_pointer(), (const MKL_INT *)&incy);
@@ -134,7 +134,7 @@ void copy(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int6
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_scopy>(cgh, [=]() {
+        host_task<class mkl_kernel_scopy>(cgh, queue, [=]() {
             ::scopy((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx,
                     accessor_y.get_pointer(), (const MKL_INT *)&incy);
         });
@@ -146,7 +146,7 @@ void copy(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, int
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dcopy>(cgh, [=]() {
+        host_task<class mkl_kernel_dcopy>(cgh, queue, [=]() {
             ::dcopy((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx,
                     accessor_y.get_pointer(), (const MKL_INT *)&incy);
         });
@@ -158,7 +158,7 @@ void copy(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<float
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_ccopy>(cgh, [=]() {
+        host_task<class mkl_kernel_ccopy>(cgh, queue, [=]() {
             ::ccopy((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx,
                     accessor_y.get_pointer(), (const MKL_INT *)&incy);
         });
@@ -170,7 +170,7 @@ void copy(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<doubl
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zcopy>(cgh, [=]() {
+        host_task<class mkl_kernel_zcopy>(cgh, queue, [=]() {
             ::zcopy((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx,
                     accessor_y.get_pointer(), (const MKL_INT *)&incy);
         });
@@ -183,7 +183,7 @@ void dot(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int64
         auto accessor_x      = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y      = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
-        host_task<class mkl_kernel_sdot>(cgh, [=]() {
+        host_task<class mkl_kernel_sdot>(cgh, queue, [=]() {
             accessor_result[0] =
                 ::sdot((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx,
                        accessor_y.get_pointer(), (const MKL_INT *)&incy);
@@ -197,7 +197,7 @@ void dot(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, int6
         auto accessor_x      = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y      = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
-        host_task<class mkl_kernel_ddot>(cgh, [=]() {
+        host_task<class mkl_kernel_ddot>(cgh, queue, [=]() {
             accessor_result[0] =
                 ::ddot((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx,
                        accessor_y.get_pointer(), (const MKL_INT *)&incy);
@@ -211,7 +211,7 @@ void dot(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int64
         auto accessor_x      = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y      = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
-        host_task<class mkl_kernel_dsdot>(cgh, [=]() {
+        host_task<class mkl_kernel_dsdot>(cgh, queue, [=]() {
             accessor_result[0] =
                 ::dsdot((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx,
                         accessor_y.get_pointer(), (const MKL_INT *)&incy);
@@ -226,7 +226,7 @@ void dotc(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<float
         auto accessor_x      = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y      = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_cdotc>(cgh, [=]() {
+        host_task<class mkl_kernel_cdotc>(cgh, queue, [=]() {
             ::cdotc(accessor_result.get_pointer(), (const MKL_INT *)&n, accessor_x.get_pointer(),
                     (const MKL_INT *)&incx, accessor_y.get_pointer(), (const MKL_INT *)&incy);
         });
@@ -240,7 +240,7 @@ void dotc(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<doubl
         auto accessor_x      = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y      = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zdotc>(cgh, [=]() {
+        host_task<class mkl_kernel_zdotc>(cgh, queue, [=]() {
             ::zdotc(accessor_result.get_pointer(), (const MKL_INT *)&n, accessor_x.get_pointer(),
                     (const MKL_INT *)&incx, accessor_y.get_pointer(), (const MKL_INT *)&incy);
         });
@@ -254,7 +254,7 @@ void dotu(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<float
         auto accessor_x      = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y      = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_cdotu>(cgh, [=]() {
+        host_task<class mkl_kernel_cdotu>(cgh, queue, [=]() {
             ::cdotu(accessor_result.get_pointer(), (const MKL_INT *)&n, accessor_x.get_pointer(),
                     (const MKL_INT *)&incx, accessor_y.get_pointer(), (const MKL_INT *)&incy);
         });
@@ -268,7 +268,7 @@ void dotu(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<doubl
         auto accessor_x      = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y      = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zdotu>(cgh, [=]() {
+        host_task<class mkl_kernel_zdotu>(cgh, queue, [=]() {
             ::zdotu(accessor_result.get_pointer(), (const MKL_INT *)&n, accessor_x.get_pointer(),
                     (const MKL_INT *)&incx, accessor_y.get_pointer(), (const MKL_INT *)&incy);
         });
@@ -280,7 +280,7 @@ void iamin(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x      = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
-        host_task<class mkl_kernel_isamin>(cgh, [=]() {
+        host_task<class mkl_kernel_isamin>(cgh, queue, [=]() {
             accessor_result[0] =
                 ::cblas_isamin((MKL_INT)n, accessor_x.get_pointer(), (MKL_INT)incx);
         });
@@ -292,7 +292,7 @@ void iamin(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, in
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x      = x.template get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.template get_access<cl::sycl::access::mode::write>(cgh);
-        host_task<class mkl_kernel_idamin>(cgh, [=]() {
+        host_task<class mkl_kernel_idamin>(cgh, queue, [=]() {
             accessor_result[0] =
                 ::cblas_idamin((const MKL_INT)n, accessor_x.get_pointer(), (const MKL_INT)incx);
         });
@@ -304,7 +304,7 @@ void iamin(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<floa
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x      = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
-        host_task<class mkl_kernel_icamin>(cgh, [=]() {
+        host_task<class mkl_kernel_icamin>(cgh, queue, [=]() {
             accessor_result[0] =
                 ::cblas_icamin((MKL_INT)n, accessor_x.get_pointer(), (MKL_INT)incx);
         });
@@ -316,7 +316,7 @@ void iamin(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<doub
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x      = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
-        host_task<class mkl_kernel_izamin>(cgh, [=]() {
+        host_task<class mkl_kernel_izamin>(cgh, queue, [=]() {
             accessor_result[0] =
                 ::cblas_izamin((MKL_INT)n, accessor_x.get_pointer(), (MKL_INT)incx);
         });
@@ -328,7 +328,7 @@ void iamax(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x      = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
-        host_task<class mkl_kernel_isamax>(cgh, [=]() {
+        host_task<class mkl_kernel_isamax>(cgh, queue, [=]() {
             accessor_result[0] =
                 ::cblas_isamax((MKL_INT)n, accessor_x.get_pointer(), (MKL_INT)incx);
         });
@@ -340,7 +340,7 @@ void iamax(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, in
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x      = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
-        host_task<class mkl_kernel_idamax>(cgh, [=]() {
+        host_task<class mkl_kernel_idamax>(cgh, queue, [=]() {
             accessor_result[0] =
                 ::cblas_idamax((MKL_INT)n, accessor_x.get_pointer(), (MKL_INT)incx);
         });
@@ -352,7 +352,7 @@ void iamax(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<floa
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x      = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
-        host_task<class mkl_kernel_icamax>(cgh, [=]() {
+        host_task<class mkl_kernel_icamax>(cgh, queue, [=]() {
             accessor_result[0] =
                 ::cblas_icamax((MKL_INT)n, accessor_x.get_pointer(), (MKL_INT)incx);
         });
@@ -364,7 +364,7 @@ void iamax(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<doub
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x      = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
-        host_task<class mkl_kernel_izamax>(cgh, [=]() {
+        host_task<class mkl_kernel_izamax>(cgh, queue, [=]() {
             accessor_result[0] =
                 ::cblas_izamax((MKL_INT)n, accessor_x.get_pointer(), (MKL_INT)incx);
         });
@@ -376,7 +376,7 @@ void nrm2(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int6
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x      = x.template get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.template get_access<cl::sycl::access::mode::write>(cgh);
-        host_task<class mkl_kernel_snrm2>(cgh, [=]() {
+        host_task<class mkl_kernel_snrm2>(cgh, queue, [=]() {
             accessor_result[0] =
                 ::snrm2((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx);
         });
@@ -388,7 +388,7 @@ void nrm2(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, int
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x      = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
-        host_task<class mkl_kernel_dnrm2>(cgh, [=]() {
+        host_task<class mkl_kernel_dnrm2>(cgh, queue, [=]() {
             accessor_result[0] =
                 ::dnrm2((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx);
         });
@@ -400,7 +400,7 @@ void nrm2(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<float
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x      = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
-        host_task<class mkl_kernel_scnrm2>(cgh, [=]() {
+        host_task<class mkl_kernel_scnrm2>(cgh, queue, [=]() {
             accessor_result[0] =
                 ::scnrm2((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx);
         });
@@ -412,7 +412,7 @@ void nrm2(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<doubl
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x      = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
-        host_task<class mkl_kernel_dznrm2>(cgh, [=]() {
+        host_task<class mkl_kernel_dznrm2>(cgh, queue, [=]() {
             accessor_result[0] =
                 ::dznrm2((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx);
         });
@@ -424,7 +424,7 @@ void rot(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int64
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_srot>(cgh, [=]() {
+        host_task<class mkl_kernel_srot>(cgh, queue, [=]() {
             ::srot((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx,
                    accessor_y.get_pointer(), (const MKL_INT *)&incy, &c, &s);
         });
@@ -436,7 +436,7 @@ void rot(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, int6
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_drot>(cgh, [=]() {
+        host_task<class mkl_kernel_drot>(cgh, queue, [=]() {
             ::drot((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx,
                    accessor_y.get_pointer(), (const MKL_INT *)&incy, &c, &s);
         });
@@ -449,7 +449,7 @@ void rot(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<float>
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_csrot>(cgh, [=]() {
+        host_task<class mkl_kernel_csrot>(cgh, queue, [=]() {
             ::csrot((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx,
                     accessor_y.get_pointer(), (const MKL_INT *)&incy, &c, &s);
         });
@@ -462,7 +462,7 @@ void rot(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<double
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zdrot>(cgh, [=]() {
+        host_task<class mkl_kernel_zdrot>(cgh, queue, [=]() {
             ::zdrot((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx,
                     accessor_y.get_pointer(), (const MKL_INT *)&incy, &c, &s);
         });
@@ -476,7 +476,7 @@ void rotg(cl::sycl::queue &queue, cl::sycl::buffer<float, 1> &a, cl::sycl::buffe
         auto accessor_b = b.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_s = s.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_srotg>(cgh, [=]() {
+        host_task<class mkl_kernel_srotg>(cgh, queue, [=]() {
             ::srotg(accessor_a.get_pointer(), accessor_b.get_pointer(), accessor_c.get_pointer(),
                     accessor_s.get_pointer());
         });
@@ -490,7 +490,7 @@ void rotg(cl::sycl::queue &queue, cl::sycl::buffer<double, 1> &a, cl::sycl::buff
         auto accessor_b = b.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_s = s.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_drotg>(cgh, [=]() {
+        host_task<class mkl_kernel_drotg>(cgh, queue, [=]() {
             ::drotg(accessor_a.get_pointer(), accessor_b.get_pointer(), accessor_c.get_pointer(),
                     accessor_s.get_pointer());
         });
@@ -505,7 +505,7 @@ void rotg(cl::sycl::queue &queue, cl::sycl::buffer<std::complex<float>, 1> &a,
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_s = s.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_crotg>(cgh, [=]() {
+        host_task<class mkl_kernel_crotg>(cgh, queue, [=]() {
             ::crotg(accessor_a.get_pointer(), accessor_b.get_pointer(), accessor_c.get_pointer(),
                     accessor_s.get_pointer());
         });
@@ -520,7 +520,7 @@ void rotg(cl::sycl::queue &queue, cl::sycl::buffer<std::complex<double>, 1> &a,
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_s = s.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zrotg>(cgh, [=]() {
+        host_task<class mkl_kernel_zrotg>(cgh, queue, [=]() {
             ::zrotg(accessor_a.get_pointer(), accessor_b.get_pointer(), accessor_c.get_pointer(),
                     accessor_s.get_pointer());
         });
@@ -533,7 +533,7 @@ void rotm(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int6
         auto accessor_x     = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_y     = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_param = param.get_access<cl::sycl::access::mode::read>(cgh);
-        host_task<class mkl_kernel_srotm>(cgh, [=]() {
+        host_task<class mkl_kernel_srotm>(cgh, queue, [=]() {
             ::srotm((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx,
                     accessor_y.get_pointer(), (const MKL_INT *)&incy, accessor_param.get_pointer());
         });
@@ -546,7 +546,7 @@ void rotm(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, int
         auto accessor_x     = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_y     = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_param = param.get_access<cl::sycl::access::mode::read>(cgh);
-        host_task<class mkl_kernel_drotm>(cgh, [=]() {
+        host_task<class mkl_kernel_drotm>(cgh, queue, [=]() {
             ::drotm((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx,
                     accessor_y.get_pointer(), (const MKL_INT *)&incy, accessor_param.get_pointer());
         });
@@ -560,7 +560,7 @@ void rotmg(cl::sycl::queue &queue, cl::sycl::buffer<float, 1> &d1, cl::sycl::buf
         auto accessor_d2    = d2.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_x1    = x1.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_param = param.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_srotmg>(cgh, [=]() {
+        host_task<class mkl_kernel_srotmg>(cgh, queue, [=]() {
             ::srotmg(accessor_d1.get_pointer(), accessor_d2.get_pointer(),
                      accessor_x1.get_pointer(), (float *)&y1, accessor_param.get_pointer());
         });
@@ -574,7 +574,7 @@ void rotmg(cl::sycl::queue &queue, cl::sycl::buffer<double, 1> &d1, cl::sycl::bu
         auto accessor_d2    = d2.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_x1    = x1.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_param = param.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_drotmg>(cgh, [=]() {
+        host_task<class mkl_kernel_drotmg>(cgh, queue, [=]() {
             ::drotmg(accessor_d1.get_pointer(), accessor_d2.get_pointer(),
                      accessor_x1.get_pointer(), (double *)&y1, accessor_param.get_pointer());
         });
@@ -585,7 +585,7 @@ void scal(cl::sycl::queue &queue, int64_t n, float alpha, cl::sycl::buffer<float
           int64_t incx) {
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_sscal>(cgh, [=]() {
+        host_task<class mkl_kernel_sscal>(cgh, queue, [=]() {
             ::sscal((const MKL_INT *)&n, (const float *)&alpha, accessor_x.get_pointer(),
                     (const MKL_INT *)&incx);
         });
@@ -596,7 +596,7 @@ void scal(cl::sycl::queue &queue, int64_t n, double alpha, cl::sycl::buffer<doub
           int64_t incx) {
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dscal>(cgh, [=]() {
+        host_task<class mkl_kernel_dscal>(cgh, queue, [=]() {
             ::dscal((const MKL_INT *)&n, (const double *)&alpha, accessor_x.get_pointer(),
                     (const MKL_INT *)&incx);
         });
@@ -608,7 +608,7 @@ void scal(cl::sycl::queue &queue, int64_t n, std::complex<float> alpha,
     queue.submit([&](cl::sycl::handler &cgh) {
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_cscal>(cgh, [=]() {
+        host_task<class mkl_kernel_cscal>(cgh, queue, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             ::cscal((const MKL_INT *)&n, (const MKL_Complex8 *)&alpha_, accessor_x.get_pointer(),
                     (const MKL_INT *)&incx);
@@ -620,7 +620,7 @@ void scal(cl::sycl::queue &queue, int64_t n, float alpha,
           cl::sycl::buffer<std::complex<float>, 1> &x, int64_t incx) {
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_csscal>(cgh, [=]() {
+        host_task<class mkl_kernel_csscal>(cgh, queue, [=]() {
             ::csscal((const MKL_INT *)&n, (const float *)&alpha, accessor_x.get_pointer(),
                      (const MKL_INT *)&incx);
         });
@@ -632,7 +632,7 @@ void scal(cl::sycl::queue &queue, int64_t n, std::complex<double> alpha,
     queue.submit([&](cl::sycl::handler &cgh) {
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zscal>(cgh, [=]() {
+        host_task<class mkl_kernel_zscal>(cgh, queue, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             ::zscal((const MKL_INT *)&n, (const MKL_Complex16 *)&alpha_, accessor_x.get_pointer(),
                     (const MKL_INT *)&incx);
@@ -644,7 +644,7 @@ void scal(cl::sycl::queue &queue, int64_t n, double alpha,
           cl::sycl::buffer<std::complex<double>, 1> &x, int64_t incx) {
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zdscal>(cgh, [=]() {
+        host_task<class mkl_kernel_zdscal>(cgh, queue, [=]() {
             ::zdscal((const MKL_INT *)&n, (const double *)&alpha, accessor_x.get_pointer(),
                      (const MKL_INT *)&incx);
         });
@@ -658,7 +658,7 @@ void sdsdot(cl::sycl::queue &queue, int64_t n, float sb, cl::sycl::buffer<float,
         auto accessor_x      = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y      = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
-        host_task<class mkl_kernel_sdsdot>(cgh, [=]() {
+        host_task<class mkl_kernel_sdsdot>(cgh, queue, [=]() {
             accessor_result[0] =
                 ::sdsdot((const MKL_INT *)&n, (const float *)&sb, accessor_x.get_pointer(),
                          (const MKL_INT *)&incx, accessor_y.get_pointer(), (const MKL_INT *)&incy);
@@ -671,7 +671,7 @@ void swap(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int6
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_sswap>(cgh, [=]() {
+        host_task<class mkl_kernel_sswap>(cgh, queue, [=]() {
             ::sswap((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx,
                     accessor_y.get_pointer(), (const MKL_INT *)&incy);
         });
@@ -683,7 +683,7 @@ void swap(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, int
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dswap>(cgh, [=]() {
+        host_task<class mkl_kernel_dswap>(cgh, queue, [=]() {
             ::dswap((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx,
                     accessor_y.get_pointer(), (const MKL_INT *)&incy);
         });
@@ -695,7 +695,7 @@ void swap(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<float
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_cswap>(cgh, [=]() {
+        host_task<class mkl_kernel_cswap>(cgh, queue, [=]() {
             ::cswap((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx,
                     accessor_y.get_pointer(), (const MKL_INT *)&incy);
         });
@@ -707,7 +707,7 @@ void swap(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<doubl
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zswap>(cgh, [=]() {
+        host_task<class mkl_kernel_zswap>(cgh, queue, [=]() {
             ::zswap((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx,
                     accessor_y.get_pointer(), (const MKL_INT *)&incy);
         });
@@ -718,56 +718,32 @@ void swap(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<doubl
 
 cl::sycl::event asum(cl::sycl::queue &queue, int64_t n, const float *x, int64_t incx, float *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class mkl_kernel_sasum_usm>(cgh, [=]() {
-            result[0] = ::sasum((const MKL_INT *)&n, x, (const MKL_INT *)&incx);
-        });
+    auto done = submit_usm<class mkl_kernel_sasum_usm>(queue, n, dependencies, [=]() {
+        result[0] = ::sasum((const MKL_INT *)&n, x, (const MKL_INT *)&incx);
     });
     return done;
 }
 
 cl::sycl::event asum(cl::sycl::queue &queue, int64_t n, const double *x, int64_t incx,
                      double *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class mkl_kernel_dasum_usm>(cgh, [=]() {
-            result[0] = ::dasum((const MKL_INT *)&n, x, (const MKL_INT *)&incx);
-        });
+    auto done = submit_usm<class mkl_kernel_dasum_usm>(queue, n, dependencies, [=]() {
+        result[0] = ::dasum((const MKL_INT *)&n, x, (const MKL_INT *)&incx);
     });
     return done;
 }
 
 cl::sycl::event asum(cl::sycl::queue &queue, int64_t n, const std::complex<float> *x, int64_t incx,
                      float *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class mkl_kernel_scasum_usm>(cgh, [=]() {
-            result[0] = ::scasum((const MKL_INT *)&n, x, (const MKL_INT *)&incx);
-        });
+    auto done = submit_usm<class mkl_kernel_scasum_usm>(queue, n, dependencies, [=]() {
+        result[0] = ::scasum((const MKL_INT *)&n, x, (const MKL_INT *)&incx);
     });
     return done;
 }
 
 cl::sycl::event asum(cl::sycl::queue &queue, int64_t n, const std::complex<double> *x, int64_t incx,
                      double *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class mkl_kernel_dzasum_usm>(cgh, [=]() {
-            result[0] = ::dzasum((const MKL_INT *)&n, x, (const MKL_INT *)&incx);
-        });
+    auto done = submit_usm<class mkl_kernel_dzasum_usm>(queue, n, dependencies, [=]() {
+        result[0] = ::dzasum((const MKL_INT *)&n, x, (const MKL_INT *)&incx);
     });
     return done;
 }
@@ -775,15 +751,9 @@ cl::sycl::event asum(cl::sycl::queue &queue, int64_t n, const std::complex<doubl
 cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, float alpha, const float *x, int64_t incx,
                      float *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class mkl_kernel_saxpy_usm>(cgh, [=]() {
-            ::saxpy((const MKL_INT *)&n, (const float *)&alpha, x, (const MKL_INT *)&incx, y,
-                    (const MKL_INT *)&incy);
-        });
+    auto done = submit_usm<class mkl_kernel_saxpy_usm>(queue, n, dependencies, [=]() {
+        ::saxpy((const MKL_INT *)&n, (const float *)&alpha, x, (const MKL_INT *)&incx, y,
+                (const MKL_INT *)&incy);
     });
     return done;
 }
@@ -791,15 +761,9 @@ cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, float alpha, const float
 cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, double alpha, const double *x, int64_t incx,
                      double *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class mkl_kernel_daxpy_usm>(cgh, [=]() {
-            ::daxpy((const MKL_INT *)&n, (const double *)&alpha, x, (const MKL_INT *)&incx, y,
-                    (const MKL_INT *)&incy);
-        });
+    auto done = submit_usm<class mkl_kernel_daxpy_usm>(queue, n, dependencies, [=]() {
+        ::daxpy((const MKL_INT *)&n, (const double *)&alpha, x, (const MKL_INT *)&incx, y,
+                (const MKL_INT *)&incy);
     });
     return done;
 }
@@ -807,17 +771,11 @@ cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, double alpha, const doub
 cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, std::complex<float> alpha,
                      const std::complex<float> *x, int64_t incx, std::complex<float> *y,
                      int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        float alpha_real = alpha.real(), alpha_imag = alpha.imag();
-        host_task<class mkl_kernel_caxpy_usm>(cgh, [=]() {
-            MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
-            ::caxpy((const MKL_INT *)&n, (const MKL_Complex8 *)&alpha_, x, (const MKL_INT *)&incx,
-                    y, (const MKL_INT *)&incy);
-        });
+    float alpha_real = alpha.real(), alpha_imag = alpha.imag();
+    auto done = submit_usm<class mkl_kernel_caxpy_usm>(queue, n, dependencies, [=]() {
+        MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
+        ::caxpy((const MKL_INT *)&n, (const MKL_Complex8 *)&alpha_, x, (const MKL_INT *)&incx,
+                y, (const MKL_INT *)&incy);
     });
     return done;
 }
@@ -825,45 +783,27 @@ cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, std::complex<float> alph
 cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, std::complex<double> alpha,
                      const std::complex<double> *x, int64_t incx, std::complex<double> *y,
                      int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        double alpha_real = alpha.real(), alpha_imag = alpha.imag();
-        host_task<class mkl_kernel_zaxpy_usm>(cgh, [=]() {
-            MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
-            ::zaxpy((const MKL_INT *)&n, (const MKL_Complex16 *)&alpha_, x, (const MKL_INT *)&incx,
-                    y, (const MKL_INT *)&incy);
-        });
+    double alpha_real = alpha.real(), alpha_imag = alpha.imag();
+    auto done = submit_usm<class mkl_kernel_zaxpy_usm>(queue, n, dependencies, [=]() {
+        MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
+        ::zaxpy((const MKL_INT *)&n, (const MKL_Complex16 *)&alpha_, x, (const MKL_INT *)&incx,
+                y, (const MKL_INT *)&incy);
     });
     return done;
 }
 
 cl::sycl::event copy(cl::sycl::queue &queue, int64_t n, const float *x, int64_t incx, float *y,
                      int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class mkl_kernel_scopy_usm>(cgh, [=]() {
-            ::scopy((const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy);
-        });
+    auto done = submit_usm<class mkl_kernel_scopy_usm>(queue, n, dependencies, [=]() {
+        ::scopy((const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy);
     });
     return done;
 }
 
 cl::sycl::event copy(cl::sycl::queue &queue, int64_t n, const double *x, int64_t incx, double *y,
                      int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class mkl_kernel_dcopy_usm>(cgh, [=]() {
-            ::dcopy((const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy);
-        });
+    auto done = submit_usm<class mkl_kernel_dcopy_usm>(queue, n, dependencies, [=]() {
+        ::dcopy((const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy);
     });
     return done;
 }
@@ -871,14 +811,8 @@ cl::sycl::event copy(cl::sycl::queue &queue, int64_t n, const double *x, int64_t
 cl::sycl::event copy(cl::sycl::queue &queue, int64_t n, const std::complex<float> *x, int64_t incx,
                      std::complex<float> *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class mkl_kernel_ccopy_usm>(cgh, [=]() {
-            ::ccopy((const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy);
-        });
+    auto done = submit_usm<class mkl_kernel_ccopy_usm>(queue, n, dependencies, [=]() {
+        ::ccopy((const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy);
     });
     return done;
 }
@@ -886,14 +820,8 @@ cl::sycl::event copy(cl::sycl::queue &queue, int64_t n, const std::complex<float
 cl::sycl::event copy(cl::sycl::queue &queue, int64_t n, const std::complex<double> *x, int64_t incx,
                      std::complex<double> *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class mkl_kernel_zcopy_usm>(cgh, [=]() {
-            ::zcopy((const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy);
-        });
+    auto done = submit_usm<class mkl_kernel_zcopy_usm>(queue, n, dependencies, [=]() {
+        ::zcopy((const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy);
     });
     return done;
 }
@@ -901,15 +829,9 @@ cl::sycl::event copy(cl::sycl::queue &queue, int64_t n, const std::complex<doubl
 cl::sycl::event dot(cl::sycl::queue &queue, int64_t n, const float *x, int64_t incx, const float *y,
                     int64_t incy, float *result,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class mkl_kernel_sdot_usm>(cgh, [=]() {
-            result[0] =
-                ::sdot((const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy);
-        });
+    auto done = submit_usm<class mkl_kernel_sdot_usm>(queue, n, dependencies, [=]() {
+        result[0] =
+            ::sdot((const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy);
     });
     return done;
 }
@@ -917,15 +839,9 @@ cl::sycl::event dot(cl::sycl::queue &queue, int64_t n, const float *x, int64_t i
 cl::sycl::event dot(cl::sycl::queue &queue, int64_t n, const double *x, int64_t incx,
                     const double *y, int64_t incy, double *result,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class mkl_kernel_ddot_usm>(cgh, [=]() {
-            result[0] =
-                ::ddot((const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy);
-        });
+    auto done = submit_usm<class mkl_kernel_ddot_usm>(queue, n, dependencies, [=]() {
+        result[0] =
+            ::ddot((const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy);
     });
     return done;
 }
@@ -933,15 +849,9 @@ cl::sycl::event dot(cl::sycl::queue &queue, int64_t n, const double *x, int64_t
 cl::sycl::event dot(cl::sycl::queue &queue, int64_t n, const float *x, int64_t incx, const float *y,
                     int64_t incy, double *result,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class mkl_kernel_dsdot_usm>(cgh, [=]() {
-            result[0] =
-                ::dsdot((const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy);
-        });
+    auto done = submit_usm<class mkl_kernel_dsdot_usm>(queue, n, dependencies, [=]() {
+        result[0] =
+            ::dsdot((const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy);
     });
     return done;
 }
@@ -949,15 +859,8 @@ cl::sycl::event dot(cl::sycl::queue &queue, int64_t n, const float *x, int64_t i
 cl::sycl::event dotc(cl::sycl::queue &queue, int64_t n, const std::complex<float> *x, int64_t incx,
                      const std::complex<float> *y, int64_t incy, std::complex<float> *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class mkl_kernel_cdotc_usm>(cgh, [=]() {
-            ::cdotc(result, (const MKL_INT *)&n, x, (const MKL_INT *)&incx, y,
-                    (const MKL_INT *)&incy);
-        });
+    auto done = submit_usm<class mkl_kernel_cdotc_usm>(queue, n, dependencies, [=]() {
+        ::cdotc(result, (const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy);
     });
     return done;
 }
@@ -965,15 +868,8 @@ cl::sycl::event dotc(cl::sycl::queue &queue, int64_t n, const std::complex<float
 cl::sycl::event dotc(cl::sycl::queue &queue, int64_t n, const std::complex<double> *x, int64_t incx,
                      const std::complex<double> *y, int64_t incy, std::complex<double> *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class mkl_kernel_zdotc_usm>(cgh, [=]() {
-            ::zdotc(result, (const MKL_INT *)&n, x, (const MKL_INT *)&incx, y,
-                    (const MKL_INT *)&incy);
-        });
+    auto done = submit_usm<class mkl_kernel_zdotc_usm>(queue, n, dependencies, [=]() {
+        ::zdotc(result, (const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy);
     });
     return done;
 }
@@ -981,15 +877,8 @@ cl::sycl::event dotc(cl::sycl::queue &queue, int64_t n, const std::complex<doubl
 cl::sycl::event dotu(cl::sycl::queue &queue, int64_t n, const std::complex<float> *x, int64_t incx,
                      const std::complex<float> *y, int64_t incy, std::complex<float> *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class mkl_kernel_cdotu_usm>(cgh, [=]() {
-            ::cdotu(result, (const MKL_INT *)&n, x, (const MKL_INT *)&incx, y,
-                    (const MKL_INT *)&incy);
-        });
+    auto done = submit_usm<class mkl_kernel_cdotu_usm>(queue, n, dependencies, [=]() {
+        ::cdotu(result, (const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy);
     });
     return done;
 }
@@ -997,15 +886,8 @@ cl::sycl::event dotu(cl::sycl::queue &queue, int64_t n, const std::complex<float
 cl::sycl::event dotu(cl::sycl::queue &queue, int64_t n, const std::complex<double> *x, int64_t incx,
                      const std::complex<double> *y, int64_t incy, std::complex<double> *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class mkl_kernel_zdotu_usm>(cgh, [=]() {
-            ::zdotu(result, (const MKL_INT *)&n, x, (const MKL_INT *)&incx, y,
-                    (const MKL_INT *)&incy);
-        });
+    auto done = submit_usm<class mkl_kernel_zdotu_usm>(queue, n, dependencies, [=]() {
+        ::zdotu(result, (const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy);
     });
     return done;
 }
@@ -1013,14 +895,8 @@ cl::sycl::event dotu(cl::sycl::queue &queue, int64_t n, const std::complex<doubl
 cl::sycl::event iamin(cl::sycl::queue &queue, int64_t n, const float *x, int64_t incx,
                       int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class mkl_kernel_isamin_usm>(cgh, [=]() {
-            result[0] = ::cblas_isamin((MKL_INT)n, x, (MKL_INT)incx);
-        });
+    auto done = submit_usm<class mkl_kernel_isamin_usm>(queue, n, dependencies, [=]() {
+        result[0] = ::cblas_isamin((MKL_INT)n, x, (MKL_INT)incx);
     });
     return done;
 }
@@ -1028,14 +904,8 @@ cl::sycl::event iamin(cl::sycl::queue &queue, int64_t n, const float *x, int64_t
 cl::sycl::event iamin(cl::sycl::queue &queue, int64_t n, const double *x, int64_t incx,
                       int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class mkl_kernel_idamin_usm>(cgh, [=]() {
-            result[0] = ::cblas_idamin((const MKL_INT)n, x, (const MKL_INT)incx);
-        });
+    auto done = submit_usm<class mkl_kernel_idamin_usm>(queue, n, dependencies, [=]() {
+        result[0] = ::cblas_idamin((const MKL_INT)n, x, (const MKL_INT)incx);
     });
     return done;
 }
@@ -1043,14 +913,8 @@ cl::sycl::event iamin(cl::sycl::queue &queue, int64_t n, const double *x, int64_
 cl::sycl::event iamin(cl::sycl::queue &queue, int64_t n, const std::complex<float> *x, int64_t incx,
                       int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class mkl_kernel_icamin_usm>(cgh, [=]() {
-            result[0] = ::cblas_icamin((MKL_INT)n, x, (MKL_INT)incx);
-        });
+    auto done = submit_usm<class mkl_kernel_icamin_usm>(queue, n, dependencies, [=]() {
+        result[0] = ::cblas_icamin((MKL_INT)n, x, (MKL_INT)incx);
     });
     return done;
 }
@@ -1058,14 +922,8 @@ cl::sycl::event iamin(cl::sycl::queue &queue, int64_t n, const std::complex<floa
 cl::sycl::event iamin(cl::sycl::queue &queue, int64_t n, const std::complex<double> *x,
                       int64_t incx, int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class mkl_kernel_izamin_usm>(cgh, [=]() {
-            result[0] = ::cblas_izamin((MKL_INT)n, x, (MKL_INT)incx);
-        });
+    auto done = submit_usm<class mkl_kernel_izamin_usm>(queue, n, dependencies, [=]() {
+        result[0] = ::cblas_izamin((MKL_INT)n, x, (MKL_INT)incx);
     });
     return done;
 }
@@ -1073,14 +931,8 @@ cl::sycl::event iamin(cl::sycl::queue &queue, int64_t n, const std::complex<doub
 cl::sycl::event iamax(cl::sycl::queue &queue, int64_t n, const float *x, int64_t incx,
                       int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class mkl_kernel_isamax_usm>(cgh, [=]() {
-            result[0] = ::cblas_isamax((MKL_INT)n, x, (MKL_INT)incx);
-        });
+    auto done = submit_usm<class mkl_kernel_isamax_usm>(queue, n, dependencies, [=]() {
+        result[0] = ::cblas_isamax((MKL_INT)n, x, (MKL_INT)incx);
     });
     return done;
 }
@@ -1088,14 +940,8 @@ cl::sycl::event iamax(cl::sycl::queue &queue, int64_t n, const float *x, int64_t
 cl::sycl::event iamax(cl::sycl::queue &queue, int64_t n, const double *x, int64_t incx,
                       int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class mkl_kernel_idamax_usm>(cgh, [=]() {
-            result[0] = ::cblas_idamax((MKL_INT)n, x, (MKL_INT)incx);
-        });
+    auto done = submit_usm<class mkl_kernel_idamax_usm>(queue, n, dependencies, [=]() {
+        result[0] = ::cblas_idamax((MKL_INT)n, x, (MKL_INT)incx);
     });
     return done;
 }
@@ -1103,14 +949,8 @@ cl::sycl::event iamax(cl::sycl::queue &queue, int64_t n, const double *x, int64_
 cl::sycl::event iamax(cl::sycl::queue &queue, int64_t n, const std::complex<float> *x, int64_t incx,
                       int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class mkl_kernel_icamax_usm>(cgh, [=]() {
-            result[0] = ::cblas_icamax((MKL_INT)n, x, (MKL_INT)incx);
-        });
+    auto done = submit_usm<class mkl_kernel_icamax_usm>(queue, n, dependencies, [=]() {
+        result[0] = ::cblas_icamax((MKL_INT)n, x, (MKL_INT)incx);
     });
     return done;
 }
@@ -1118,70 +958,40 @@ cl::sycl::event iamax(cl::sycl::queue &queue, int64_t n, const std::complex<floa
 cl::sycl::event iamax(cl::sycl::queue &queue, int64_t n, const std::complex<double> *x,
                       int64_t incx, int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class mkl_kernel_izamax_usm>(cgh, [=]() {
-            result[0] = ::cblas_izamax((MKL_INT)n, x, (MKL_INT)incx);
-        });
+    auto done = submit_usm<class mkl_kernel_izamax_usm>(queue, n, dependencies, [=]() {
+        result[0] = ::cblas_izamax((MKL_INT)n, x, (MKL_INT)incx);
     });
     return done;
 }
 
 cl::sycl::event nrm2(cl::sycl::queue &queue, int64_t n, const float *x, int64_t incx, float *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class mkl_kernel_snrm2_usm>(cgh, [=]() {
-            result[0] = ::snrm2((const MKL_INT *)&n, x, (const MKL_INT *)&incx);
-        });
+    auto done = submit_usm<class mkl_kernel_snrm2_usm>(queue, n, dependencies, [=]() {
+        result[0] = ::snrm2((const MKL_INT *)&n, x, (const MKL_INT *)&incx);
     });
     return done;
 }
 
 cl::sycl::event nrm2(cl::sycl::queue &queue, int64_t n, const double *x, int64_t incx,
                      double *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class mkl_kernel_dnrm2_usm>(cgh, [=]() {
-            result[0] = ::dnrm2((const MKL_INT *)&n, x, (const MKL_INT *)&incx);
-        });
+    auto done = submit_usm<class mkl_kernel_dnrm2_usm>(queue, n, dependencies, [=]() {
+        result[0] = ::dnrm2((const MKL_INT *)&n, x, (const MKL_INT *)&incx);
     });
     return done;
 }
 
 cl::sycl::event nrm2(cl::sycl::queue &queue, int64_t n, const std::complex<float> *x, int64_t incx,
                      float *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class mkl_kernel_scnrm2_usm>(cgh, [=]() {
-            result[0] = ::scnrm2((const MKL_INT *)&n, x, (const MKL_INT *)&incx);
-        });
+    auto done = submit_usm<class mkl_kernel_scnrm2_usm>(queue, n, dependencies, [=]() {
+        result[0] = ::scnrm2((const MKL_INT *)&n, x, (const MKL_INT *)&incx);
     });
     return done;
 }
 
 cl::sycl::event nrm2(cl::sycl::queue &queue, int64_t n, const std::complex<double> *x, int64_t incx,
                      double *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class mkl_kernel_dznrm2_usm>(cgh, [=]() {
-            result[0] = ::dznrm2((const MKL_INT *)&n, x, (const MKL_INT *)&incx);
-        });
+    auto done = submit_usm<class mkl_kernel_dznrm2_usm>(queue, n, dependencies, [=]() {
+        result[0] = ::dznrm2((const MKL_INT *)&n, x, (const MKL_INT *)&incx);
     });
     return done;
 }
@@ -1189,15 +999,8 @@ cl::sycl::event nrm2(cl::sycl::queue &queue, int64_t n, const std::complex<doubl
 cl::sycl::event rot(cl::sycl::queue &queue, int64_t n, float *x, int64_t incx, float *y,
                     int64_t incy, float c, float s,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class mkl_kernel_srot_usm>(cgh, [=]() {
-            ::srot((const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy, &c,
-                   &s);
-        });
+    auto done = submit_usm<class mkl_kernel_srot_usm>(queue, n, dependencies, [=]() {
+        ::srot((const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy, &c, &s);
     });
     return done;
 }
@@ -1205,15 +1008,8 @@ cl::sycl::event rot(cl::sycl::queue &queue, int64_t n, float *x, int64_t incx, f
 cl::sycl::event rot(cl::sycl::queue &queue, int64_t n, double *x, int64_t incx, double *y,
                     int64_t incy, double c, double s,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class mkl_kernel_drot_usm>(cgh, [=]() {
-            ::drot((const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy, &c,
-                   &s);
-        });
+    auto done = submit_usm<class mkl_kernel_drot_usm>(queue, n, dependencies, [=]() {
+        ::drot((const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy, &c, &s);
     });
     return done;
 }
@@ -1221,15 +1017,8 @@ cl::sycl::event rot(cl::sycl::queue &queue, int64_t n, double *x, int64_t incx,
 cl::sycl::event rot(cl::sycl::queue &queue, int64_t n, std::complex<float> *x, int64_t incx,
                     std::complex<float> *y, int64_t incy, float c, float s,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class mkl_kernel_csrot_usm>(cgh, [=]() {
-            ::csrot((const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy, &c,
-                    &s);
-        });
+    auto done = submit_usm<class mkl_kernel_csrot_usm>(queue, n, dependencies, [=]() {
+        ::csrot((const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy, &c, &s);
     });
     return done;
 }
@@ -1237,43 +1026,24 @@ cl::sycl::event rot(cl::sycl::queue &queue, int64_t n, std::complex<float> *x, i
 cl::sycl::event rot(cl::sycl::queue &queue, int64_t n, std::complex<double> *x, int64_t incx,
                     std::complex<double> *y, int64_t incy, double c, double s,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class mkl_kernel_zdrot_usm>(cgh, [=]() {
-            ::zdrot((const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy, &c,
-                    &s);
-        });
+    auto done = submit_usm<class mkl_kernel_zdrot_usm>(queue, n, dependencies, [=]() {
+        ::zdrot((const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy, &c, &s);
     });
     return done;
 }
 
 cl::sycl::event rotg(cl::sycl::queue &queue, float *a, float *b, float *c, float *s,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class mkl_kernel_srotg_usm>(cgh, [=]() {
-            ::srotg(a, b, c, s);
-        });
+    auto done = submit_usm<class mkl_kernel_srotg_usm>(queue, 1, dependencies, [=]() {
+        ::srotg(a, b, c, s);
     });
     return done;
 }
 
 cl::sycl::event rotg(cl::sycl::queue &queue, double *a, double *b, double *c, double *s,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class mkl_kernel_drotg_usm>(cgh, [=]() {
-            ::drotg(a, b, c, s);
-        });
+    auto done = submit_usm<class mkl_kernel_drotg_usm>(queue, 1, dependencies, [=]() {
+        ::drotg(a, b, c, s);
     });
     return done;
 }
@@ -1281,14 +1051,8 @@ cl::sycl::event rotg(cl::sycl::queue &queue, double *a, double *b, double *c, do
 cl::sycl::event rotg(cl::sycl::queue &queue, std::complex<float> *a, std::complex<float> *b,
                      float *c, std::complex<float> *s,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class mkl_kernel_crotg_usm>(cgh, [=]() {
-            ::crotg(a, b, c, s);
-        });
+    auto done = submit_usm<class mkl_kernel_crotg_usm>(queue, 1, dependencies, [=]() {
+        ::crotg(a, b, c, s);
     });
     return done;
 }
@@ -1296,14 +1060,8 @@ cl::sycl::event rotg(cl::sycl::queue &queue, std::complex<float> *a, std::comple
 cl::sycl::event rotg(cl::sycl::queue &queue, std::complex<double> *a, std::complex<double> *b,
                      double *c, std::complex<double> *s,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class mkl_kernel_zrotg_usm>(cgh, [=]() {
-            ::zrotg(a, b, c, s);
-        });
+    auto done = submit_usm<class mkl_kernel_zrotg_usm>(queue, 1, dependencies, [=]() {
+        ::zrotg(a, b, c, s);
     });
     return done;
 }
@@ -1311,15 +1069,8 @@ cl::sycl::event rotg(cl::sycl::queue &queue, std::complex<double> *a, std::compl
 cl::sycl::event rotm(cl::sycl::queue &queue, int64_t n, float *x, int64_t incx, float *y,
                      int64_t incy, float *param,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class mkl_kernel_srotm_usm>(cgh, [=]() {
-            ::srotm((const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy,
-                    param);
-        });
+    auto done = submit_usm<class mkl_kernel_srotm_usm>(queue, n, dependencies, [=]() {
+        ::srotm((const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy, param);
     });
     return done;
 }
@@ -1327,71 +1078,40 @@ cl::sycl::event rotm(cl::sycl::queue &queue, int64_t n, float *x, int64_t incx,
 cl::sycl::event rotm(cl::sycl::queue &queue, int64_t n, double *x, int64_t incx, double *y,
                      int64_t incy, double *param,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class mkl_kernel_drotm_usm>(cgh, [=]() {
-            ::drotm((const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy,
-                    param);
-        });
+    auto done = submit_usm<class mkl_kernel_drotm_usm>(queue, n, dependencies, [=]() {
+        ::drotm((const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy, param);
     });
     return done;
 }
 
 cl::sycl::event rotmg(cl::sycl::queue &queue, float *d1, float *d2, float *x1, float y1,
                       float *param, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class mkl_kernel_srotmg_usm>(cgh, [=]() {
-            ::srotmg(d1, d2, x1, (float *)&y1, param);
-        });
+    auto done = submit_usm<class mkl_kernel_srotmg_usm>(queue, 1, dependencies, [=]() {
+        ::srotmg(d1, d2, x1, (float *)&y1, param);
     });
     return done;
 }
 
 cl::sycl::event rotmg(cl::sycl::queue &queue, double *d1, double *d2, double *x1, double y1,
                       double *param, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class mkl_kernel_drotmg_usm>(cgh, [=]() {
-            ::drotmg(d1, d2, x1, (double *)&y1, param);
-        });
+    auto done = submit_usm<class mkl_kernel_drotmg_usm>(queue, 1, dependencies, [=]() {
+        ::drotmg(d1, d2, x1, (double *)&y1, param);
     });
     return done;
 }
 
 cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, float alpha, float *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class mkl_kernel_sscal_usm>(cgh, [=]() {
-            ::sscal((const MKL_INT *)&n, (const float *)&alpha, x, (const MKL_INT *)&incx);
-        });
+    auto done = submit_usm<class mkl_kernel_sscal_usm>(queue, n, dependencies, [=]() {
+        ::sscal((const MKL_INT *)&n, (const float *)&alpha, x, (const MKL_INT *)&incx);
     });
     return done;
 }
 
 cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, double alpha, double *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class mkl_kernel_dscal_usm>(cgh, [=]() {
-            ::dscal((const MKL_INT *)&n, (const double *)&alpha, x, (const MKL_INT *)&incx);
-        });
+    auto done = submit_usm<class mkl_kernel_dscal_usm>(queue, n, dependencies, [=]() {
+        ::dscal((const MKL_INT *)&n, (const double *)&alpha, x, (const MKL_INT *)&incx);
     });
     return done;
 }
@@ -1399,30 +1119,18 @@ cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, double alpha, double *x,
 cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, std::complex<float> alpha,
                      std::complex<float> *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        float alpha_real = alpha.real(), alpha_imag = alpha.imag();
-        host_task<class mkl_kernel_cscal_usm>(cgh, [=]() {
-            MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
-            ::cscal((const MKL_INT *)&n, (const MKL_Complex8 *)&alpha_, x, (const MKL_INT *)&incx);
-        });
+    float alpha_real = alpha.real(), alpha_imag = alpha.imag();
+    auto done = submit_usm<class mkl_kernel_cscal_usm>(queue, n, dependencies, [=]() {
+        MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
+        ::cscal((const MKL_INT *)&n, (const MKL_Complex8 *)&alpha_, x, (const MKL_INT *)&incx);
     });
     return done;
 }
 
 cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, float alpha, std::complex<float> *x,
                      int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class mkl_kernel_csscal_usm>(cgh, [=]() {
-            ::csscal((const MKL_INT *)&n, (const float *)&alpha, x, (const MKL_INT *)&incx);
-        });
+    auto done = submit_usm<class mkl_kernel_csscal_usm>(queue, n, dependencies, [=]() {
+        ::csscal((const MKL_INT *)&n, (const float *)&alpha, x, (const MKL_INT *)&incx);
     });
     return done;
 }
@@ -1430,30 +1138,18 @@ cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, float alpha, std::comple
 cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, std::complex<double> alpha,
                      std::complex<double> *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        double alpha_real = alpha.real(), alpha_imag = alpha.imag();
-        host_task<class mkl_kernel_zscal_usm>(cgh, [=]() {
-            MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
-            ::zscal((const MKL_INT *)&n, (const MKL_Complex16 *)&alpha_, x, (const MKL_INT *)&incx);
-        });
+    double alpha_real = alpha.real(), alpha_imag = alpha.imag();
+    auto done = submit_usm<class mkl_kernel_zscal_usm>(queue, n, dependencies, [=]() {
+        MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
+        ::zscal((const MKL_INT *)&n, (const MKL_Complex16 *)&alpha_, x, (const MKL_INT *)&incx);
     });
     return done;
 }
 
 cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, double alpha, std::complex<double> *x,
                      int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class mkl_kernel_zdscal_usm>(cgh, [=]() {
-            ::zdscal((const MKL_INT *)&n, (const double *)&alpha, x, (const MKL_INT *)&incx);
-        });
+    auto done = submit_usm<class mkl_kernel_zdscal_usm>(queue, n, dependencies, [=]() {
+        ::zdscal((const MKL_INT *)&n, (const double *)&alpha, x, (const MKL_INT *)&incx);
     });
     return done;
 }
@@ -1461,43 +1157,25 @@ cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, double alpha, std::compl
 cl::sycl::event sdsdot(cl::sycl::queue &queue, int64_t n, float sb, const float *x, int64_t incx,
                        const float *y, int64_t incy, float *result,
                        const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class mkl_kernel_sdsdot_usm>(cgh, [=]() {
-            result[0] = ::sdsdot((const MKL_INT *)&n, (const float *)&sb, x, (const MKL_INT *)&incx,
-                                 y, (const MKL_INT *)&incy);
-        });
+    auto done = submit_usm<class mkl_kernel_sdsdot_usm>(queue, n, dependencies, [=]() {
+        result[0] = ::sdsdot((const MKL_INT *)&n, (const float *)&sb, x, (const MKL_INT *)&incx,
+                             y, (const MKL_INT *)&incy);
     });
     return done;
 }
 
 cl::sycl::event swap(cl::sycl::queue &queue, int64_t n, float *x, int64_t incx, float *y,
                      int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class mkl_kernel_sswap_usm>(cgh, [=]() {
-            ::sswap((const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy);
-        });
+    auto done = submit_usm<class mkl_kernel_sswap_usm>(queue, n, dependencies, [=]() {
+        ::sswap((const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy);
     });
     return done;
 }
 
 cl::sycl::event swap(cl::sycl::queue &queue, int64_t n, double *x, int64_t incx, double *y,
                      int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class mkl_kernel_dswap_usm>(cgh, [=]() {
-            ::dswap((const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy);
-        });
+    auto done = submit_usm<class mkl_kernel_dswap_usm>(queue, n, dependencies, [=]() {
+        ::dswap((const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy);
     });
     return done;
 }
@@ -1505,14 +1183,8 @@ cl::sycl::event swap(cl::sycl::queue &queue, int64_t n, double *x, int64_t incx,
 cl::sycl::event swap(cl::sycl::queue &queue, int64_t n, std::complex<float> *x, int64_t incx,
                      std::complex<float> *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class mkl_kernel_cswap_usm>(cgh, [=]() {
-            ::cswap((const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy);
-        });
+    auto done = submit_usm<class mkl_kernel_cswap_usm>(queue, n, dependencies, [=]() {
+        ::cswap((const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy);
     });
     return done;
 }
@@ -1520,14 +1192,8 @@ cl::sycl::event swap(cl::sycl::queue &queue, int64_t n, std::complex<float> *x,
 cl::sycl::event swap(cl::sycl::queue &queue, int64_t n, std::complex<double> *x, int64_t incx,
                      std::complex<double> *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class mkl_kernel_zswap_usm>(cgh, [=]() {
-            ::zswap((const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy);
-        });
+    auto done = submit_usm<class mkl_kernel_zswap_usm>(queue, n, dependencies, [=]() {
+        ::zswap((const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy);
     });
     return done;
 }
@@ -35,7 +35,7 @@ void gbmv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, int64_t
         auto accessor_a   = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x   = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y   = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_sgbmv>(cgh, [=]() {
+        host_task<class mkl_kernel_sgbmv>(cgh, queue, [=]() {
             ::sgbmv((const char *)&trans_, (const MKL_INT *)&m, (const MKL_INT *)&n,
                     (const MKL_INT *)&kl, (const MKL_INT *)&ku, (const float *)&alpha,
                     accessor_a.get_pointer(), (const MKL_INT *)&lda, accessor_x.get_pointer(),
@@ -53,7 +53,7 @@ void gbmv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, int64_t
         auto accessor_a   = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x   = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y   = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dgbmv>(cgh, [=]() {
+        host_task<class mkl_kernel_dgbmv>(cgh, queue, [=]() {
             ::dgbmv((const char *)&trans_, (const MKL_INT *)&m, (const MKL_INT *)&n,
                     (const MKL_INT *)&kl, (const MKL_INT *)&ku, (const double *)&alpha,
                     accessor_a.get_pointer(), (const MKL_INT *)&lda, accessor_x.get_pointer(),
@@ -74,7 +74,7 @@ void gbmv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, int64_t
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_cgbmv>(cgh, [=]() {
+        host_task<class mkl_kernel_cgbmv>(cgh, queue, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_  = { beta_real, beta_imag };
             ::cgbmv((const char *)&trans_, (const MKL_INT *)&m, (const MKL_INT *)&n,
@@ -97,7 +97,7 @@ void gbmv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, int64_t
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zgbmv>(cgh, [=]() {
+        host_task<class mkl_kernel_zgbmv>(cgh, queue, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_  = { beta_real, beta_imag };
             ::zgbmv((const char *)&trans_, (const MKL_INT *)&m, (const MKL_INT *)&n,
@@ -117,7 +117,7 @@ void gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, float a
         auto accessor_a   = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x   = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y   = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_sgemv>(cgh, [=]() {
+        host_task<class mkl_kernel_sgemv>(cgh, queue, [=]() {
             ::sgemv((const char *)&trans_, (const MKL_INT *)&m, (const MKL_INT *)&n,
                     (const float *)&alpha, accessor_a.get_pointer(), (const MKL_INT *)&lda,
                     accessor_x.get_pointer(), (const MKL_INT *)&incx, (const float *)&beta,
@@ -134,7 +134,7 @@ void gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, double
         auto accessor_a   = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x   = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y   = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dgemv>(cgh, [=]() {
+        host_task<class mkl_kernel_dgemv>(cgh, queue, [=]() {
             ::dgemv((const char *)&trans_, (const MKL_INT *)&m, (const MKL_INT *)&n,
                     (const double *)&alpha, accessor_a.get_pointer(), (const MKL_INT *)&lda,
                     accessor_x.get_pointer(), (const MKL_INT *)&incx, (const double *)&beta,
@@ -154,7 +154,7 @@ void gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, std::co
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_cgemv>(cgh, [=]() {
+        host_task<class mkl_kernel_cgemv>(cgh, queue, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_  = { beta_real, beta_imag };
             ::cgemv((const char *)&trans_, (const MKL_INT *)&m, (const MKL_INT *)&n,
@@ -176,7 +176,7 @@ void gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, std::co
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zgemv>(cgh, [=]() {
+        host_task<class mkl_kernel_zgemv>(cgh, queue, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_  = { beta_real, beta_imag };
             ::zgemv((const char *)&trans_, (const MKL_INT *)&m, (const MKL_INT *)&n,
@@ -194,7 +194,7 @@ void ger(cl::sycl::queue &queue, int64_t m, int64_t n, float alpha, cl::sycl::bu
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_sger>(cgh, [=]() {
+        host_task<class mkl_kernel_sger>(cgh, queue, [=]() {
             ::sger((const MKL_INT *)&m, (const MKL_INT *)&n, (const float *)&alpha,
                    accessor_x.get_pointer(), (const MKL_INT *)&incx, accessor_y.get_pointer(),
                    (const MKL_INT *)&incy, accessor_a.get_pointer(), (const MKL_INT *)&lda);
@@ -209,7 +209,7 @@ void ger(cl::sycl::queue &queue, int64_t m, int64_t n, double alpha, cl::sycl::b
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dger>(cgh, [=]() {
+        host_task<class mkl_kernel_dger>(cgh, queue, [=]() {
             ::dger((const MKL_INT *)&m, (const MKL_INT *)&n, (const double *)&alpha,
                    accessor_x.get_pointer(), (const MKL_INT *)&incx, accessor_y.get_pointer(),
                    (const MKL_INT *)&incy, accessor_a.get_pointer(), (const MKL_INT *)&lda);
@@ -226,7 +226,7 @@ void gerc(cl::sycl::queue &queue, int64_t m, int64_t n, std::complex<float> alph
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_cgerc>(cgh, [=]() {
+        host_task<class mkl_kernel_cgerc>(cgh, queue, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             ::cgerc((const MKL_INT *)&m, (const MKL_INT *)&n, (const MKL_Complex8 *)&alpha_,
                     accessor_x.get_pointer(), (const MKL_INT *)&incx, accessor_y.get_pointer(),
@@ -244,7 +244,7 @@ void gerc(cl::sycl::queue &queue, int64_t m, int64_t n, std::complex<double> alp
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zgerc>(cgh, [=]() {
+        host_task<class mkl_kernel_zgerc>(cgh, queue, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             ::zgerc((const MKL_INT *)&m, (const MKL_INT *)&n, (const MKL_Complex16 *)&alpha_,
                     accessor_x.get_pointer(), (const MKL_INT *)&incx, accessor_y.get_pointer(),
@@ -262,7 +262,7 @@ void geru(cl::sycl::queue &queue, int64_t m, int64_t n, std::complex<float> alph
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_cgeru>(cgh, [=]() {
+        host_task<class mkl_kernel_cgeru>(cgh, queue, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             ::cgeru((const MKL_INT *)&m, (const MKL_INT *)&n, (const MKL_Complex8 *)&alpha_,
                     accessor_x.get_pointer(), (const MKL_INT *)&incx, accessor_y.get_pointer(),
@@ -280,7 +280,7 @@ void geru(cl::sycl::queue &queue, int64_t m, int64_t n, std::complex<double> alp
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zgeru>(cgh, [=]() {
+        host_task<class mkl_kernel_zgeru>(cgh, queue, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             ::zgeru((const MKL_INT *)&m, (const MKL_INT *)&n, (const MKL_Complex16 *)&alpha_,
                     accessor_x.get_pointer(), (const MKL_INT *)&incx, accessor_y.get_pointer(),
@@ -300,7 +300,7 @@ void hbmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, int64_t k, std::c
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_chbmv>(cgh, [=]() {
+        host_task<class mkl_kernel_chbmv>(cgh, queue, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_  = { beta_real, beta_imag };
             ::chbmv((const char *)&upper_lower_, (const MKL_INT *)&n, (const MKL_INT *)&k,
@@ -322,7 +322,7 @@ void hbmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, int64_t k,
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zhbmv>(cgh, [=]() {
+        host_task<class mkl_kernel_zhbmv>(cgh, queue, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_  = { beta_real, beta_imag };
             ::zhbmv((const char *)&upper_lower_, (const MKL_INT *)&n, (const MKL_INT *)&k,
@@ -344,7 +344,7 @@ void hemv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::complex<floa
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_chemv>(cgh, [=]() {
+        host_task<class mkl_kernel_chemv>(cgh, queue, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_  = { beta_real, beta_imag };
             ::chemv((const char *)&upper_lower_, (const MKL_INT *)&n, (const MKL_Complex8 *)&alpha_,
@@ -366,7 +366,7 @@ void hemv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::complex<doub
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zhemv>(cgh, [=]() {
+        host_task<class mkl_kernel_zhemv>(cgh, queue, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_  = { beta_real, beta_imag };
             ::zhemv((const char *)&upper_lower_, (const MKL_INT *)&n,
@@ -384,7 +384,7 @@ void her(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
         const char upper_lower_ = *fortran_char(upper_lower);
         auto accessor_x         = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_a         = a.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_cher>(cgh, [=]() {
+        host_task<class mkl_kernel_cher>(cgh, queue, [=]() {
             ::cher((const char *)&upper_lower_, (const MKL_INT *)&n, (const float *)&alpha,
                    accessor_x.get_pointer(), (const MKL_INT *)&incx, accessor_a.get_pointer(),
                    (const MKL_INT *)&lda);
@@ -399,7 +399,7 @@ void her(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
         const char upper_lower_ = *fortran_char(upper_lower);
         auto accessor_x         = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_a         = a.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zher>(cgh, [=]() {
+        host_task<class mkl_kernel_zher>(cgh, queue, [=]() {
             ::zher((const char *)&upper_lower_, (const MKL_INT *)&n, (const double *)&alpha,
                    accessor_x.get_pointer(), (const MKL_INT *)&incx, accessor_a.get_pointer(),
                    (const MKL_INT *)&lda);
@@ -417,7 +417,7 @@ void her2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::complex<floa
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_cher2>(cgh, [=]() {
+        host_task<class mkl_kernel_cher2>(cgh, queue, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             ::cher2((const char *)&upper_lower_, (const MKL_INT *)&n, (const MKL_Complex8 *)&alpha_,
                     accessor_x.get_pointer(), (const MKL_INT *)&incx, accessor_y.get_pointer(),
@@ -436,7 +436,7 @@ void her2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::complex<doub
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zher2>(cgh, [=]() {
+        host_task<class mkl_kernel_zher2>(cgh, queue, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             ::zher2((const char *)&upper_lower_, (const MKL_INT *)&n,
                     (const MKL_Complex16 *)&alpha_, accessor_x.get_pointer(),
@@ -457,7 +457,7 @@ void hpmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::complex<floa
         auto accessor_ap = ap.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x  = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y  = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_chpmv>(cgh, [=]() {
+        host_task<class mkl_kernel_chpmv>(cgh, queue, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_  = { beta_real, beta_imag };
             ::chpmv((const char *)&upper_lower_, (const MKL_INT *)&n, (const MKL_Complex8 *)&alpha_,
@@ -478,7 +478,7 @@ void hpmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::complex<doub
         auto accessor_ap = ap.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x  = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y  = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zhpmv>(cgh, [=]() {
+        host_task<class mkl_kernel_zhpmv>(cgh, queue, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_  = { beta_real, beta_imag };
             ::zhpmv((const char *)&upper_lower_, (const MKL_INT *)&n,
@@ -496,7 +496,7 @@ void hpr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
         const char upper_lower_ = *fortran_char(upper_lower);
         auto accessor_x         = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_ap        = ap.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_chpr>(cgh, [=]() {
+        host_task<class mkl_kernel_chpr>(cgh, queue, [=]() {
             ::chpr((const char *)&upper_lower_, (const MKL_INT *)&n, (const float *)&alpha,
                    accessor_x.get_pointer(), (const MKL_INT *)&incx, accessor_ap.get_pointer());
         });
@@ -510,7 +510,7 @@ void hpr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
         const char upper_lower_ = *fortran_char(upper_lower);
         auto accessor_x         = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_ap        = ap.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zhpr>(cgh, [=]() {
+        host_task<class mkl_kernel_zhpr>(cgh, queue, [=]() {
             ::zhpr((const char *)&upper_lower_, (const MKL_INT *)&n, (const double *)&alpha,
                    accessor_x.get_pointer(), (const MKL_INT *)&incx, accessor_ap.get_pointer());
         });
@@ -527,7 +527,7 @@ void hpr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::complex<floa
         auto accessor_x  = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y  = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_ap = ap.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_chpr2>(cgh, [=]() {
+        host_task<class mkl_kernel_chpr2>(cgh, queue, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             ::chpr2((const char *)&upper_lower_, (const MKL_INT *)&n, (const MKL_Complex8 *)&alpha_,
                     accessor_x.get_pointer(), (const MKL_INT *)&incx, accessor_y.get_pointer(),
@@ -546,7 +546,7 @@ void hpr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::complex<doub
         auto accessor_x  = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y  = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_ap = ap.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zhpr2>(cgh, [=]() {
+        host_task<class mkl_kernel_zhpr2>(cgh, queue, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             ::zhpr2((const char *)&upper_lower_, (const MKL_INT *)&n,
                     (const MKL_Complex16 *)&alpha_, accessor_x.get_pointer(),
@@ -564,7 +564,7 @@ void sbmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, int64_t k, float
         auto accessor_a         = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x         = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y         = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_ssbmv>(cgh, [=]() {
+        host_task<class mkl_kernel_ssbmv>(cgh, queue, [=]() {
             ::ssbmv((const char *)&upper_lower_, (const MKL_INT *)&n, (const MKL_INT *)&k,
                     (const float *)&alpha, accessor_a.get_pointer(), (const MKL_INT *)&lda,
                     accessor_x.get_pointer(), (const MKL_INT *)&incx, (const float *)&beta,
@@ -581,7 +581,7 @@ void sbmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, int64_t k, double
         auto accessor_a         = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x         = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y         = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dsbmv>(cgh, [=]() {
+        host_task<class mkl_kernel_dsbmv>(cgh, queue, [=]() {
             ::dsbmv((const char *)&upper_lower_, (const MKL_INT *)&n, (const MKL_INT *)&k,
                     (const double *)&alpha, accessor_a.get_pointer(), (const MKL_INT *)&lda,
                     accessor_x.get_pointer(), (const MKL_INT *)&incx, (const double *)&beta,
@@ -598,7 +598,7 @@ void spmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
         auto accessor_ap        = ap.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x         = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y         = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_sspmv>(cgh, [=]() {
+        host_task<class mkl_kernel_sspmv>(cgh, queue, [=]() {
             ::sspmv((const char *)&upper_lower_, (const MKL_INT *)&n, (const float *)&alpha,
                     accessor_ap.get_pointer(), accessor_x.get_pointer(), (const MKL_INT *)&incx,
                     (const float *)&beta, accessor_y.get_pointer(), (const MKL_INT *)&incy);
@@ -614,7 +614,7 @@ void spmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
         auto accessor_ap        = ap.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x         = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y         = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dspmv>(cgh, [=]() {
+        host_task<class mkl_kernel_dspmv>(cgh, queue, [=]() {
             ::dspmv((const char *)&upper_lower_, (const MKL_INT *)&n, (const double *)&alpha,
                     accessor_ap.get_pointer(), accessor_x.get_pointer(), (const MKL_INT *)&incx,
                     (const double *)&beta, accessor_y.get_pointer(), (const MKL_INT *)&incy);
@@ -628,7 +628,7 @@ void spr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
         const char upper_lower_ = *fortran_char(upper_lower);
         auto accessor_x         = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_ap        = ap.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_sspr>(cgh, [=]() {
+        host_task<class mkl_kernel_sspr>(cgh, queue, [=]() {
             ::sspr((const char *)&upper_lower_, (const MKL_INT *)&n, (const float *)&alpha,
                    accessor_x.get_pointer(), (const MKL_INT *)&incx, accessor_ap.get_pointer());
         });
@@ -641,7 +641,7 @@ void spr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
         const char upper_lower_ = *fortran_char(upper_lower);
         auto accessor_x         = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_ap        = ap.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dspr>(cgh, [=]() {
+        host_task<class mkl_kernel_dspr>(cgh, queue, [=]() {
             ::dspr((const char *)&upper_lower_, (const MKL_INT *)&n, (const double *)&alpha,
                    accessor_x.get_pointer(), (const MKL_INT *)&incx, accessor_ap.get_pointer());
         });
@@ -656,7 +656,7 @@ void spr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
         auto accessor_x         = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y         = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_ap        = ap.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_sspr2>(cgh, [=]() {
+        host_task<class mkl_kernel_sspr2>(cgh, queue, [=]() {
             ::sspr2((const char *)&upper_lower_, (const MKL_INT *)&n, (const float *)&alpha,
                     accessor_x.get_pointer(), (const MKL_INT *)&incx, accessor_y.get_pointer(),
                     (const MKL_INT *)&incy, accessor_ap.get_pointer());
@@ -672,7 +672,7 @@ void spr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
         auto accessor_x         = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y         = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_ap        = ap.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dspr2>(cgh, [=]() {
+        host_task<class mkl_kernel_dspr2>(cgh, queue, [=]() {
             ::dspr2((const char *)&upper_lower_, (const MKL_INT *)&n, (const double *)&alpha,
                     accessor_x.get_pointer(), (const MKL_INT *)&incx, accessor_y.get_pointer(),
                     (const MKL_INT *)&incy, accessor_ap.get_pointer());
@@ -688,7 +688,7 @@ void symv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
         auto accessor_a         = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x         = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y         = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_ssymv>(cgh, [=]() {
+        host_task<class mkl_kernel_ssymv>(cgh, queue, [=]() {
             ::ssymv((const char *)&upper_lower_, (const MKL_INT *)&n, (const float *)&alpha,
                     accessor_a.get_pointer(), (const MKL_INT *)&lda, accessor_x.get_pointer(),
                     (const MKL_INT *)&incx, (const float *)&beta, accessor_y.get_pointer(),
@@ -705,7 +705,7 @@ void symv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
         auto accessor_a         = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x         = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y         = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dsymv>(cgh, [=]() {
+        host_task<class mkl_kernel_dsymv>(cgh, queue, [=]() {
             ::dsymv((const char *)&upper_lower_, (const MKL_INT *)&n, (const double *)&alpha,
                     accessor_a.get_pointer(), (const MKL_INT *)&lda, accessor_x.get_pointer(),
                     (const MKL_INT *)&incx, (const double *)&beta, accessor_y.get_pointer(),
@@ -720,7 +720,7 @@ void syr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
         const char upper_lower_ = *fortran_char(upper_lower);
         auto accessor_x         = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_a         = a.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_ssyr>(cgh, [=]() {
+        host_task<class mkl_kernel_ssyr>(cgh, queue, [=]() {
             ::ssyr((const char *)&upper_lower_, (const MKL_INT *)&n, (const float *)&alpha,
                    accessor_x.get_pointer(), (const MKL_INT *)&incx, accessor_a.get_pointer(),
                    (const MKL_INT *)&lda);
@@ -735,7 +735,7 @@ void syr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
         const char upper_lower_ = *fortran_char(upper_lower);
         auto accessor_x         = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_a         = a.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dsyr>(cgh, [=]() {
+        host_task<class mkl_kernel_dsyr>(cgh, queue, [=]() {
             ::dsyr((const char *)&upper_lower_, (const MKL_INT *)&n, (const double *)&alpha,
                    accessor_x.get_pointer(), (const MKL_INT *)&incx, accessor_a.get_pointer(),
                    (const MKL_INT *)&lda);
@@ -751,7 +751,7 @@ void syr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
         auto accessor_x         = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y         = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_a         = a.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_ssyr2>(cgh, [=]() {
+        host_task<class mkl_kernel_ssyr2>(cgh, queue, [=]() {
             ::ssyr2((const char *)&upper_lower_, (const MKL_INT *)&n, (const float *)&alpha,
                     accessor_x.get_pointer(), (const MKL_INT *)&incx, accessor_y.get_pointer(),
                     (const MKL_INT *)&incy, accessor_a.get_pointer(), (const MKL_INT *)&lda);
@@ -767,7 +767,7 @@ void syr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
         auto accessor_x         = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y         = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_a         = a.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dsyr2>(cgh, [=]() {
+        host_task<class mkl_kernel_dsyr2>(cgh, queue, [=]() {
             ::dsyr2((const char *)&upper_lower_, (const MKL_INT *)&n, (const double *)&alpha,
                     accessor_x.get_pointer(), (const MKL_INT *)&incx, accessor_y.get_pointer(),
                     (const MKL_INT *)&incy, accessor_a.get_pointer(), (const MKL_INT *)&lda);
@@ -784,7 +784,7 @@ void tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         const char unit_diag_   = *fortran_char(unit_diag);
         auto accessor_a         = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x         = x.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_stbmv>(cgh, [=]() {
+        host_task<class mkl_kernel_stbmv>(cgh, queue, [=]() {
             ::stbmv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
                     (const MKL_INT *)&n, (const MKL_INT *)&k, accessor_a.get_pointer(),
                     (const MKL_INT *)&lda, accessor_x.get_pointer(), (const MKL_INT *)&incx);
@@ -801,7 +801,7 @@ void tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         const char unit_diag_   = *fortran_char(unit_diag);
         auto accessor_a         = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x         = x.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dtbmv>(cgh, [=]() {
+        host_task<class mkl_kernel_dtbmv>(cgh, queue, [=]() {
             ::dtbmv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
                     (const MKL_INT *)&n, (const MKL_INT *)&k, accessor_a.get_pointer(),
                     (const MKL_INT *)&lda, accessor_x.get_pointer(), (const MKL_INT *)&incx);
@@ -818,7 +818,7 @@ void tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         const char unit_diag_   = *fortran_char(unit_diag);
         auto accessor_a         = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x         = x.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_ctbmv>(cgh, [=]() {
+        host_task<class mkl_kernel_ctbmv>(cgh, queue, [=]() {
             ::ctbmv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
                     (const MKL_INT *)&n, (const MKL_INT *)&k, accessor_a.get_pointer(),
                     (const MKL_INT *)&lda, accessor_x.get_pointer(), (const MKL_INT *)&incx);
@@ -835,7 +835,7 @@ void tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         const char unit_diag_   = *fortran_char(unit_diag);
         auto accessor_a         = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x         = x.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_ztbmv>(cgh, [=]() {
+        host_task<class mkl_kernel_ztbmv>(cgh, queue, [=]() {
             ::ztbmv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
                     (const MKL_INT *)&n, (const MKL_INT *)&k, accessor_a.get_pointer(),
                     (const MKL_INT *)&lda, accessor_x.get_pointer(), (const MKL_INT *)&incx);
@@ -852,7 +852,7 @@ void tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         const char unit_diag_   = *fortran_char(unit_diag);
         auto accessor_a         = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x         = x.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_stbsv>(cgh, [=]() {
+        host_task<class mkl_kernel_stbsv>(cgh, queue, [=]() {
             ::stbsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
                     (const MKL_INT *)&n, (const MKL_INT *)&k, accessor_a.get_pointer(),
                     (const MKL_INT *)&lda, accessor_x.get_pointer(), (const MKL_INT *)&incx);
@@ -869,7 +869,7 @@ void tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         const char unit_diag_   = *fortran_char(unit_diag);
         auto accessor_a         = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x         = x.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dtbsv>(cgh, [=]() {
+        host_task<class mkl_kernel_dtbsv>(cgh, queue, [=]() {
             ::dtbsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
                     (const MKL_INT *)&n, (const MKL_INT *)&k, accessor_a.get_pointer(),
                     (const MKL_INT *)&lda, accessor_x.get_pointer(), (const MKL_INT *)&incx);
@@ -886,7 +886,7 @@ void tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         const char unit_diag_   = *fortran_char(unit_diag);
         auto accessor_a         = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x         = x.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_ctbsv>(cgh, [=]() {
+        host_task<class mkl_kernel_ctbsv>(cgh, queue, [=]() {
             ::ctbsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
                     (const MKL_INT *)&n, (const MKL_INT *)&k, accessor_a.get_pointer(),
                     (const MKL_INT *)&lda, accessor_x.get_pointer(), (const MKL_INT *)&incx);
@@ -903,7 +903,7 @@ void tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         const char unit_diag_   = *fortran_char(unit_diag);
         auto accessor_a         = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x         = x.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_ztbsv>(cgh, [=]() {
+        host_task<class mkl_kernel_ztbsv>(cgh, queue, [=]() {
             ::ztbsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
                     (const MKL_INT *)&n, (const MKL_INT *)&k, accessor_a.get_pointer(),
                     (const MKL_INT *)&lda, accessor_x.get_pointer(), (const MKL_INT *)&incx);
@@ -919,7 +919,7 @@ void tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         const char unit_diag_   = *fortran_char(unit_diag);
         auto accessor_ap        = ap.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x         = x.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_stpmv>(cgh, [=]() {
+        host_task<class mkl_kernel_stpmv>(cgh, queue, [=]() {
             ::stpmv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
                     (const MKL_INT *)&n, accessor_ap.get_pointer(), accessor_x.get_pointer(),
                     (const MKL_INT *)&incx);
@@ -935,7 +935,7 @@ void tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         const char unit_diag_   = *fortran_char(unit_diag);
         auto accessor_ap        = ap.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x         = x.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dtpmv>(cgh, [=]() {
+        host_task<class mkl_kernel_dtpmv>(cgh, queue, [=]() {
             ::dtpmv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
                     (const MKL_INT *)&n, accessor_ap.get_pointer(), accessor_x.get_pointer(),
                     (const MKL_INT *)&incx);
@@ -952,7 +952,7 @@ void tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         const char unit_diag_   = *fortran_char(unit_diag);
         auto accessor_ap        = ap.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x         = x.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_ctpmv>(cgh, [=]() {
+        host_task<class mkl_kernel_ctpmv>(cgh, queue, [=]() {
             ::ctpmv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
                     (const MKL_INT *)&n, accessor_ap.get_pointer(), accessor_x.get_pointer(),
                     (const MKL_INT *)&incx);
@@ -969,7 +969,7 @@ void tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         const char unit_diag_   = *fortran_char(unit_diag);
         auto accessor_ap        = ap.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x         = x.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_ztpmv>(cgh, [=]() {
+        host_task<class mkl_kernel_ztpmv>(cgh, queue, [=]() {
             ::ztpmv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
                     (const MKL_INT *)&n, accessor_ap.get_pointer(), accessor_x.get_pointer(),
                     (const MKL_INT *)&incx);
@@ -985,7 +985,7 @@ void tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         const char unit_diag_   = *fortran_char(unit_diag);
         auto accessor_ap        = ap.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x         = x.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_stpsv>(cgh, [=]() {
+        host_task<class mkl_kernel_stpsv>(cgh, queue, [=]() {
             ::stpsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
                     (const MKL_INT *)&n, accessor_ap.get_pointer(), accessor_x.get_pointer(),
                     (const MKL_INT *)&incx);
@@ -1001,7 +1001,7 @@ void tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         const char unit_diag_   = *fortran_char(unit_diag);
         auto accessor_ap        = ap.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x         = x.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dtpsv>(cgh, [=]() {
+        host_task<class mkl_kernel_dtpsv>(cgh, queue, [=]() {
             ::dtpsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
                     (const MKL_INT *)&n, accessor_ap.get_pointer(), accessor_x.get_pointer(),
                     (const MKL_INT *)&incx);
@@ -1018,7 +1018,7 @@ void tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         const char unit_diag_   = *fortran_char(unit_diag);
         auto accessor_ap        = ap.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x         = x.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_ctpsv>(cgh, [=]() {
+        host_task<class mkl_kernel_ctpsv>(cgh, queue, [=]() {
             ::ctpsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
                     (const MKL_INT *)&n, accessor_ap.get_pointer(), accessor_x.get_pointer(),
                     (const MKL_INT *)&incx);
@@ -1035,7 +1035,7 @@ void tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         const char unit_diag_   = *fortran_char(unit_diag);
         auto accessor_ap        = ap.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x         = x.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_ztpsv>(cgh, [=]() {
+        host_task<class mkl_kernel_ztpsv>(cgh, queue, [=]() {
             ::ztpsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
                     (const MKL_INT *)&n, accessor_ap.get_pointer(), accessor_x.get_pointer(),
                     (const MKL_INT *)&incx);
@@ -1051,7 +1051,7 @@ void trmv(cl::sycl::queue &queue, uplo upper_lower, transpose transa, diag unit_
         const char unit_diag_   = *fortran_char(unit_diag);
         auto accessor_a         = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b         = b.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_strmv>(cgh, [=]() {
+        host_task<class mkl_kernel_strmv>(cgh, queue, [=]() {
             ::strmv((const char *)&upper_lower_, (const char *)&transa_, (const char *)&unit_diag_,
                     (const MKL_INT *)&n, accessor_a.get_pointer(), (const MKL_INT *)&lda,
                     accessor_b.get_pointer(), (const MKL_INT *)&incx);
@@ -1068,7 +1068,7 @@ void trmv(cl::sycl::queue &queue, uplo upper_lower, transpose transa, diag unit_
         const char unit_diag_   = *fortran_char(unit_diag);
         auto accessor_a         = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b         = b.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dtrmv>(cgh, [=]() {
+        host_task<class mkl_kernel_dtrmv>(cgh, queue, [=]() {
             ::dtrmv((const char *)&upper_lower_, (const char *)&transa_, (const char *)&unit_diag_,
                     (const MKL_INT *)&n, accessor_a.get_pointer(), (const MKL_INT *)&lda,
                     accessor_b.get_pointer(), (const MKL_INT *)&incx);
@@ -1085,7 +1085,7 @@ void trmv(cl::sycl::queue &queue, uplo upper_lower, transpose transa, diag unit_
         const char unit_diag_   = *fortran_char(unit_diag);
         auto accessor_a         = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b         = b.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_ctrmv>(cgh, [=]() {
+        host_task<class mkl_kernel_ctrmv>(cgh, queue, [=]() {
             ::ctrmv((const char *)&upper_lower_, (const char *)&transa_, (const char *)&unit_diag_,
                     (const MKL_INT *)&n, accessor_a.get_pointer(), (const MKL_INT *)&lda,
                     accessor_b.get_pointer(), (const MKL_INT *)&incx);
@@ -1102,7 +1102,7 @@ void trmv(cl::sycl::queue &queue, uplo upper_lower, transpose transa, diag unit_
         const char unit_diag_   = *fortran_char(unit_diag);
         auto accessor_a         = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b         = b.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_ztrmv>(cgh, [=]() {
+        host_task<class mkl_kernel_ztrmv>(cgh, queue, [=]() {
             ::ztrmv((const char *)&upper_lower_, (const char *)&transa_, (const char *)&unit_diag_,
                     (const MKL_INT *)&n, accessor_a.get_pointer(), (const MKL_INT *)&lda,
                     accessor_b.get_pointer(), (const MKL_INT *)&incx);
@@ -1118,7 +1118,7 @@ void trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         const char unit_diag_   = *fortran_char(unit_diag);
         auto accessor_a         = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x         = x.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_strsv>(cgh, [=]() {
+        host_task<class mkl_kernel_strsv>(cgh, queue, [=]() {
             ::strsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
                     (const MKL_INT *)&n, accessor_a.get_pointer(), (const MKL_INT *)&lda,
                     accessor_x.get_pointer(), (const MKL_INT *)&incx);
@@ -1135,7 +1135,7 @@ void trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         const char unit_diag_   = *fortran_char(unit_diag);
         auto accessor_a         = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x         = x.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dtrsv>(cgh, [=]() {
+        host_task<class mkl_kernel_dtrsv>(cgh, queue, [=]() {
             ::dtrsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
                     (const MKL_INT *)&n, accessor_a.get_pointer(), (const MKL_INT *)&lda,
                     accessor_x.get_pointer(), (const MKL_INT *)&incx);
@@ -1152,7 +1152,7 @@ void trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         const char unit_diag_   = *fortran_char(unit_diag);
         auto accessor_a         = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x         = x.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_ctrsv>(cgh, [=]() {
+        host_task<class mkl_kernel_ctrsv>(cgh, queue, [=]() {
             ::ctrsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
                     (const MKL_INT *)&n, accessor_a.get_pointer(), (const MKL_INT *)&lda,
                     accessor_x.get_pointer(), (const MKL_INT *)&incx);
@@ -1169,7 +1169,7 @@ void trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         const char unit_diag_   = *fortran_char(unit_diag);
         auto accessor_a         = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x         = x.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_ztrsv>(cgh, [=]() {
+        host_task<class mkl_kernel_ztrsv>(cgh, queue, [=]() {
             ::ztrsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
                     (const MKL_INT *)&n, accessor_a.get_pointer(), (const MKL_INT *)&lda,
                     accessor_x.get_pointer(), (const MKL_INT *)&incx);
@@ -1183,18 +1183,12 @@ cl::sycl::event gbmv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t
                      int64_t ku, float alpha, const float *a, int64_t lda, const float *x,
                      int64_t incx, float beta, float *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char trans_ = *fortran_char(trans);
-        host_task<class mkl_kernel_sgbmv_usm>(cgh, [=]() {
-            ::sgbmv((const char *)&trans_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                    (const MKL_INT *)&kl, (const MKL_INT *)&ku, (const float *)&alpha, a,
-                    (const MKL_INT *)&lda, x, (const MKL_INT *)&incx, (const float *)&beta, y,
-                    (const MKL_INT *)&incy);
-        });
+    const char trans_ = *fortran_char(trans);
+    auto done = submit_usm<class mkl_kernel_sgbmv_usm>(queue, m * n, dependencies, [=]() {
+        ::sgbmv((const char *)&trans_, (const MKL_INT *)&m, (const MKL_INT *)&n,
+                (const MKL_INT *)&kl, (const MKL_INT *)&ku, (const float *)&alpha, a,
+                (const MKL_INT *)&lda, x, (const MKL_INT *)&incx, (const float *)&beta, y,
+                (const MKL_INT *)&incy);
     });
     return done;
 }
@@ -1203,18 +1197,12 @@ cl::sycl::event gbmv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t
                      int64_t ku, double alpha, const double *a, int64_t lda, const double *x,
                      int64_t incx, double beta, double *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char trans_ = *fortran_char(trans);
-        host_task<class mkl_kernel_dgbmv_usm>(cgh, [=]() {
-            ::dgbmv((const char *)&trans_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                    (const MKL_INT *)&kl, (const MKL_INT *)&ku, (const double *)&alpha, a,
-                    (const MKL_INT *)&lda, x, (const MKL_INT *)&incx, (const double *)&beta, y,
-                    (const MKL_INT *)&incy);
-        });
+    const char trans_ = *fortran_char(trans);
+    auto done = submit_usm<class mkl_kernel_dgbmv_usm>(queue, m * n, dependencies, [=]() {
+        ::dgbmv((const char *)&trans_, (const MKL_INT *)&m, (const MKL_INT *)&n,
+                (const MKL_INT *)&kl, (const MKL_INT *)&ku, (const double *)&alpha, a,
+                (const MKL_INT *)&lda, x, (const MKL_INT *)&incx, (const double *)&beta, y,
+                (const MKL_INT *)&incy);
     });
     return done;
 }
@@ -1224,22 +1212,16 @@ cl::sycl::event gbmv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t
                      int64_t lda, const std::complex<float> *x, int64_t incx,
                      std::complex<float> beta, std::complex<float> *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char trans_ = *fortran_char(trans);
-        float alpha_real = alpha.real(), alpha_imag = alpha.imag();
-        float beta_real = beta.real(), beta_imag = beta.imag();
-        host_task<class mkl_kernel_cgbmv_usm>(cgh, [=]() {
-            MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
-            MKL_Complex8 beta_  = { beta_real, beta_imag };
-            ::cgbmv((const char *)&trans_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                    (const MKL_INT *)&kl, (const MKL_INT *)&ku, (const MKL_Complex8 *)&alpha_, a,
-                    (const MKL_INT *)&lda, x, (const MKL_INT *)&incx, (const MKL_Complex8 *)&beta_,
-                    y, (const MKL_INT *)&incy);
-        });
+    const char trans_ = *fortran_char(trans);
+    float alpha_real = alpha.real(), alpha_imag = alpha.imag();
+    float beta_real = beta.real(), beta_imag = beta.imag();
+    auto done = submit_usm<class mkl_kernel_cgbmv_usm>(queue, m * n, dependencies, [=]() {
+        MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
+        MKL_Complex8 beta_  = { beta_real, beta_imag };
+        ::cgbmv((const char *)&trans_, (const MKL_INT *)&m, (const MKL_INT *)&n,
+                (const MKL_INT *)&kl, (const MKL_INT *)&ku, (const MKL_Complex8 *)&alpha_, a,
+                (const MKL_INT *)&lda, x, (const MKL_INT *)&incx, (const MKL_Complex8 *)&beta_,
+                y, (const MKL_INT *)&incy);
     });
     return done;
 }
@@ -1249,22 +1231,16 @@ cl::sycl::event gbmv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t
                      int64_t lda, const std::complex<double> *x, int64_t incx,
                      std::complex<double> beta, std::complex<double> *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char trans_ = *fortran_char(trans);
-        double alpha_real = alpha.real(), alpha_imag = alpha.imag();
-        double beta_real = beta.real(), beta_imag = beta.imag();
-        host_task<class mkl_kernel_zgbmv_usm>(cgh, [=]() {
-            MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
-            MKL_Complex16 beta_  = { beta_real, beta_imag };
-            ::zgbmv((const char *)&trans_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                    (const MKL_INT *)&kl, (const MKL_INT *)&ku, (const MKL_Complex16 *)&alpha_, a,
-                    (const MKL_INT *)&lda, x, (const MKL_INT *)&incx, (const MKL_Complex16 *)&beta_,
-                    y, (const MKL_INT *)&incy);
-        });
+    const char trans_ = *fortran_char(trans);
+    double alpha_real = alpha.real(), alpha_imag = alpha.imag();
+    double beta_real = beta.real(), beta_imag = beta.imag();
+    auto done = submit_usm<class mkl_kernel_zgbmv_usm>(queue, m * n, dependencies, [=]() {
+        MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
+        MKL_Complex16 beta_  = { beta_real, beta_imag };
+        ::zgbmv((const char *)&trans_, (const MKL_INT *)&m, (const MKL_INT *)&n,
+                (const MKL_INT *)&kl, (const MKL_INT *)&ku, (const MKL_Complex16 *)&alpha_, a,
+                (const MKL_INT *)&lda, x, (const MKL_INT *)&incx, (const MKL_Complex16 *)&beta_,
+                y, (const MKL_INT *)&incy);
     });
     return done;
 }
@@ -1273,17 +1249,11 @@ cl::sycl::event gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t
                      const float *a, int64_t lda, const float *x, int64_t incx, float beta,
                      float *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char trans_ = *fortran_char(trans);
-        host_task<class mkl_kernel_sgemv_usm>(cgh, [=]() {
-            ::sgemv((const char *)&trans_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                    (const float *)&alpha, a, (const MKL_INT *)&lda, x, (const MKL_INT *)&incx,
-                    (const float *)&beta, y, (const MKL_INT *)&incy);
-        });
+    const char trans_ = *fortran_char(trans);
+    auto done = submit_usm<class mkl_kernel_sgemv_usm>(queue, m * n, dependencies, [=]() {
+        ::sgemv((const char *)&trans_, (const MKL_INT *)&m, (const MKL_INT *)&n,
+                (const float *)&alpha, a, (const MKL_INT *)&lda, x, (const MKL_INT *)&incx,
+                (const float *)&beta, y, (const MKL_INT *)&incy);
     });
     return done;
 }
@@ -1292,17 +1262,11 @@ cl::sycl::event gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t
                      const double *a, int64_t lda, const double *x, int64_t incx, double beta,
                      double *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char trans_ = *fortran_char(trans);
-        host_task<class mkl_kernel_dgemv_usm>(cgh, [=]() {
-            ::dgemv((const char *)&trans_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                    (const double *)&alpha, a, (const MKL_INT *)&lda, x, (const MKL_INT *)&incx,
-                    (const double *)&beta, y, (const MKL_INT *)&incy);
-        });
+    const char trans_ = *fortran_char(trans);
+    auto done = submit_usm<class mkl_kernel_dgemv_usm>(queue, m * n, dependencies, [=]() {
+        ::dgemv((const char *)&trans_, (const MKL_INT *)&m, (const MKL_INT *)&n,
+                (const double *)&alpha, a, (const MKL_INT *)&lda, x, (const MKL_INT *)&incx,
+                (const double *)&beta, y, (const MKL_INT *)&incy);
     });
     return done;
 }
@@ -1312,22 +1276,15 @@ cl::sycl::event gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t
                      const std::complex<float> *x, int64_t incx, std::complex<float> beta,
                      std::complex<float> *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char trans_ = *fortran_char(trans);
-        float alpha_real = alpha.real(), alpha_imag = alpha.imag();
-        float beta_real = beta.real(), beta_imag = beta.imag();
-        host_task<class mkl_kernel_cgemv_usm>(cgh, [=]() {
-            MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
-            MKL_Complex8 beta_  = { beta_real, beta_imag };
-            ::cgemv((const char *)&trans_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                    (const MKL_Complex8 *)&alpha_, a, (const MKL_INT *)&lda, x,
-                    (const MKL_INT *)&incx, (const MKL_Complex8 *)&beta_, y,
-                    (const MKL_INT *)&incy);
-        });
+    const char trans_ = *fortran_char(trans);
+    float alpha_real = alpha.real(), alpha_imag = alpha.imag();
+    float beta_real = beta.real(), beta_imag = beta.imag();
+    auto done = submit_usm<class mkl_kernel_cgemv_usm>(queue, m * n, dependencies, [=]() {
+        MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
+        MKL_Complex8 beta_  = { beta_real, beta_imag };
+        ::cgemv((const char *)&trans_, (const MKL_INT *)&m, (const MKL_INT *)&n,
+                (const MKL_Complex8 *)&alpha_, a, (const MKL_INT *)&lda, x, (const MKL_INT *)&incx,
+                (const MKL_Complex8 *)&beta_, y, (const MKL_INT *)&incy);
     });
     return done;
 }
@@ -1337,22 +1294,15 @@ cl::sycl::event gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t
                      const std::complex<double> *x, int64_t incx, std::complex<double> beta,
                      std::complex<double> *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char trans_ = *fortran_char(trans);
-        double alpha_real = alpha.real(), alpha_imag = alpha.imag();
-        double beta_real = beta.real(), beta_imag = beta.imag();
-        host_task<class mkl_kernel_zgemv_usm>(cgh, [=]() {
-            MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
-            MKL_Complex16 beta_  = { beta_real, beta_imag };
-            ::zgemv((const char *)&trans_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                    (const MKL_Complex16 *)&alpha_, a, (const MKL_INT *)&lda, x,
-                    (const MKL_INT *)&incx, (const MKL_Complex16 *)&beta_, y,
-                    (const MKL_INT *)&incy);
-        });
+    const char trans_ = *fortran_char(trans);
+    double alpha_real = alpha.real(), alpha_imag = alpha.imag();
+    double beta_real = beta.real(), beta_imag = beta.imag();
+    auto done = submit_usm<class mkl_kernel_zgemv_usm>(queue, m * n, dependencies, [=]() {
+        MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
+        MKL_Complex16 beta_  = { beta_real, beta_imag };
+        ::zgemv((const char *)&trans_, (const MKL_INT *)&m, (const MKL_INT *)&n,
+                (const MKL_Complex16 *)&alpha_, a, (const MKL_INT *)&lda, x, (const MKL_INT *)&incx,
+                (const MKL_Complex16 *)&beta_, y, (const MKL_INT *)&incy);
     });
     return done;
 }
@@ -1360,15 +1310,9 @@ cl::sycl::event gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t
 cl::sycl::event ger(cl::sycl::queue &queue, int64_t m, int64_t n, float alpha, const float *x,
                     int64_t incx, const float *y, int64_t incy, float *a, int64_t lda,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class mkl_kernel_sger_usm>(cgh, [=]() {
-            ::sger((const MKL_INT *)&m, (const MKL_INT *)&n, (const float *)&alpha, x,
-                   (const MKL_INT *)&incx, y, (const MKL_INT *)&incy, a, (const MKL_INT *)&lda);
-        });
+    auto done = submit_usm<class mkl_kernel_sger_usm>(queue, m * n, dependencies, [=]() {
+        ::sger((const MKL_INT *)&m, (const MKL_INT *)&n, (const float *)&alpha, x,
+               (const MKL_INT *)&incx, y, (const MKL_INT *)&incy, a, (const MKL_INT *)&lda);
     });
     return done;
 }
@@ -1376,15 +1320,9 @@ cl::sycl::event ger(cl::sycl::queue &queue, int64_t m, int64_t n, float alpha, c
 cl::sycl::event ger(cl::sycl::queue &queue, int64_t m, int64_t n, double alpha, const double *x,
                     int64_t incx, const double *y, int64_t incy, double *a, int64_t lda,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class mkl_kernel_dger_usm>(cgh, [=]() {
-            ::dger((const MKL_INT *)&m, (const MKL_INT *)&n, (const double *)&alpha, x,
-                   (const MKL_INT *)&incx, y, (const MKL_INT *)&incy, a, (const MKL_INT *)&lda);
-        });
+    auto done = submit_usm<class mkl_kernel_dger_usm>(queue, m * n, dependencies, [=]() {
+        ::dger((const MKL_INT *)&m, (const MKL_INT *)&n, (const double *)&alpha, x,
+               (const MKL_INT *)&incx, y, (const MKL_INT *)&incy, a, (const MKL_INT *)&lda);
     });
     return done;
 }
@@ -1393,17 +1331,11 @@ cl::sycl::event gerc(cl::sycl::queue &queue, int64_t m, int64_t n, std::complex<
                      const std::complex<float> *x, int64_t incx, const std::complex<float> *y,
                      int64_t incy, std::complex<float> *a, int64_t lda,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        float alpha_real = alpha.real(), alpha_imag = alpha.imag();
-        host_task<class mkl_kernel_cgerc_usm>(cgh, [=]() {
-            MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
-            ::cgerc((const MKL_INT *)&m, (const MKL_INT *)&n, (const MKL_Complex8 *)&alpha_, x,
-                    (const MKL_INT *)&incx, y, (const MKL_INT *)&incy, a, (const MKL_INT *)&lda);
-        });
+    float alpha_real = alpha.real(), alpha_imag = alpha.imag();
+    auto done = submit_usm<class mkl_kernel_cgerc_usm>(queue, m * n, dependencies, [=]() {
+        MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
+        ::cgerc((const MKL_INT *)&m, (const MKL_INT *)&n, (const MKL_Complex8 *)&alpha_, x,
+                (const MKL_INT *)&incx, y, (const MKL_INT *)&incy, a, (const MKL_INT *)&lda);
     });
     return done;
 }
@@ -1412,17 +1344,11 @@ cl::sycl::event gerc(cl::sycl::queue &queue, int64_t m, int64_t n, std::complex<
                      const std::complex<double> *x, int64_t incx, const std::complex<double> *y,
                      int64_t incy, std::complex<double> *a, int64_t lda,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        double alpha_real = alpha.real(), alpha_imag = alpha.imag();
-        host_task<class mkl_kernel_zgerc_usm>(cgh, [=]() {
-            MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
-            ::zgerc((const MKL_INT *)&m, (const MKL_INT *)&n, (const MKL_Complex16 *)&alpha_, x,
-                    (const MKL_INT *)&incx, y, (const MKL_INT *)&incy, a, (const MKL_INT *)&lda);
-        });
+    double alpha_real = alpha.real(), alpha_imag = alpha.imag();
+    auto done = submit_usm<class mkl_kernel_zgerc_usm>(queue, m * n, dependencies, [=]() {
+        MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
+        ::zgerc((const MKL_INT *)&m, (const MKL_INT *)&n, (const MKL_Complex16 *)&alpha_, x,
+                (const MKL_INT *)&incx, y, (const MKL_INT *)&incy, a, (const MKL_INT *)&lda);
     });
     return done;
 }
@@ -1431,17 +1357,11 @@ cl::sycl::event geru(cl::sycl::queue &queue, int64_t m, int64_t n, std::complex<
                      const std::complex<float> *x, int64_t incx, const std::complex<float> *y,
                      int64_t incy, std::complex<float> *a, int64_t lda,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        float alpha_real = alpha.real(), alpha_imag = alpha.imag();
-        host_task<class mkl_kernel_cgeru_usm>(cgh, [=]() {
-            MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
-            ::cgeru((const MKL_INT *)&m, (const MKL_INT *)&n, (const MKL_Complex8 *)&alpha_, x,
-                    (const MKL_INT *)&incx, y, (const MKL_INT *)&incy, a, (const MKL_INT *)&lda);
-        });
+    float alpha_real = alpha.real(), alpha_imag = alpha.imag();
+    auto done = submit_usm<class mkl_kernel_cgeru_usm>(queue, m * n, dependencies, [=]() {
+        MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
+        ::cgeru((const MKL_INT *)&m, (const MKL_INT *)&n, (const MKL_Complex8 *)&alpha_, x,
+                (const MKL_INT *)&incx, y, (const MKL_INT *)&incy, a, (const MKL_INT *)&lda);
     });
     return done;
 }
@@ -1450,17 +1370,11 @@ cl::sycl::event geru(cl::sycl::queue &queue, int64_t m, int64_t n, std::complex<
                      const std::complex<double> *x, int64_t incx, const std::complex<double> *y,
                      int64_t incy, std::complex<double> *a, int64_t lda,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        double alpha_real = alpha.real(), alpha_imag = alpha.imag();
-        host_task<class mkl_kernel_zgeru_usm>(cgh, [=]() {
-            MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
-            ::zgeru((const MKL_INT *)&m, (const MKL_INT *)&n, (const MKL_Complex16 *)&alpha_, x,
-                    (const MKL_INT *)&incx, y, (const MKL_INT *)&incy, a, (const MKL_INT *)&lda);
-        });
+    double alpha_real = alpha.real(), alpha_imag = alpha.imag();
+    auto done = submit_usm<class mkl_kernel_zgeru_usm>(queue, m * n, dependencies, [=]() {
+        MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
+        ::zgeru((const MKL_INT *)&m, (const MKL_INT *)&n, (const MKL_Complex16 *)&alpha_, x,
+                (const MKL_INT *)&incx, y, (const MKL_INT *)&incy, a, (const MKL_INT *)&lda);
     });
     return done;
 }
@@ -1470,22 +1384,15 @@ cl::sycl::event hbmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, int64_
                      const std::complex<float> *x, int64_t incx, std::complex<float> beta,
                      std::complex<float> *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char upper_lower_ = *fortran_char(upper_lower);
-        float alpha_real = alpha.real(), alpha_imag = alpha.imag();
-        float beta_real = beta.real(), beta_imag = beta.imag();
-        host_task<class mkl_kernel_chbmv_usm>(cgh, [=]() {
-            MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
-            MKL_Complex8 beta_  = { beta_real, beta_imag };
-            ::chbmv((const char *)&upper_lower_, (const MKL_INT *)&n, (const MKL_INT *)&k,
-                    (const MKL_Complex8 *)&alpha_, a, (const MKL_INT *)&lda, x,
-                    (const MKL_INT *)&incx, (const MKL_Complex8 *)&beta_, y,
-                    (const MKL_INT *)&incy);
-        });
+    const char upper_lower_ = *fortran_char(upper_lower);
+    float alpha_real = alpha.real(), alpha_imag = alpha.imag();
+    float beta_real = beta.real(), beta_imag = beta.imag();
+    auto done = submit_usm<class mkl_kernel_chbmv_usm>(queue, n * n, dependencies, [=]() {
+        MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
+        MKL_Complex8 beta_  = { beta_real, beta_imag };
+        ::chbmv((const char *)&upper_lower_, (const MKL_INT *)&n, (const MKL_INT *)&k,
+                (const MKL_Complex8 *)&alpha_, a, (const MKL_INT *)&lda, x, (const MKL_INT *)&incx,
+                (const MKL_Complex8 *)&beta_, y, (const MKL_INT *)&incy);
     });
     return done;
 }
@@ -1495,22 +1402,15 @@ cl::sycl::event hbmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, int64_
                      const std::complex<double> *x, int64_t incx, std::complex<double> beta,
                      std::complex<double> *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char upper_lower_ = *fortran_char(upper_lower);
-        double alpha_real = alpha.real(), alpha_imag = alpha.imag();
-        double beta_real = beta.real(), beta_imag = beta.imag();
-        host_task<class mkl_kernel_zhbmv_usm>(cgh, [=]() {
-            MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
-            MKL_Complex16 beta_  = { beta_real, beta_imag };
-            ::zhbmv((const char *)&upper_lower_, (const MKL_INT *)&n, (const MKL_INT *)&k,
-                    (const MKL_Complex16 *)&alpha_, a, (const MKL_INT *)&lda, x,
-                    (const MKL_INT *)&incx, (const MKL_Complex16 *)&beta_, y,
-                    (const MKL_INT *)&incy);
-        });
+    const char upper_lower_ = *fortran_char(upper_lower);
+    double alpha_real = alpha.real(), alpha_imag = alpha.imag();
+    double beta_real = beta.real(), beta_imag = beta.imag();
+    auto done = submit_usm<class mkl_kernel_zhbmv_usm>(queue, n * n, dependencies, [=]() {
+        MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
+        MKL_Complex16 beta_  = { beta_real, beta_imag };
+        ::zhbmv((const char *)&upper_lower_, (const MKL_INT *)&n, (const MKL_INT *)&k,
+                (const MKL_Complex16 *)&alpha_, a, (const MKL_INT *)&lda, x, (const MKL_INT *)&incx,
+                (const MKL_Complex16 *)&beta_, y, (const MKL_INT *)&incy);
     });
     return done;
 }
@@ -1519,21 +1419,15 @@ cl::sycl::event hemv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::c
                      const std::complex<float> *a, int64_t lda, const std::complex<float> *x,
                      int64_t incx, std::complex<float> beta, std::complex<float> *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char upper_lower_ = *fortran_char(upper_lower);
-        float alpha_real = alpha.real(), alpha_imag = alpha.imag();
-        float beta_real = beta.real(), beta_imag = beta.imag();
-        host_task<class mkl_kernel_chemv_usm>(cgh, [=]() {
-            MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
-            MKL_Complex8 beta_  = { beta_real, beta_imag };
-            ::chemv((const char *)&upper_lower_, (const MKL_INT *)&n, (const MKL_Complex8 *)&alpha_,
-                    a, (const MKL_INT *)&lda, x, (const MKL_INT *)&incx,
-                    (const MKL_Complex8 *)&beta_, y, (const MKL_INT *)&incy);
-        });
+    const char upper_lower_ = *fortran_char(upper_lower);
+    float alpha_real = alpha.real(), alpha_imag = alpha.imag();
+    float beta_real = beta.real(), beta_imag = beta.imag();
+    auto done = submit_usm<class mkl_kernel_chemv_usm>(queue, n * n, dependencies, [=]() {
+        MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
+        MKL_Complex8 beta_  = { beta_real, beta_imag };
+        ::chemv((const char *)&upper_lower_, (const MKL_INT *)&n, (const MKL_Complex8 *)&alpha_,
+                a, (const MKL_INT *)&lda, x, (const MKL_INT *)&incx,
+                (const MKL_Complex8 *)&beta_, y, (const MKL_INT *)&incy);
     });
     return done;
 }
@@ -1543,22 +1437,15 @@ cl::sycl::event hemv(cl::sycl::queue &queue, uplo upper_lower, int64_t n,
                      const std::complex<double> *x, int64_t incx, std::complex<double> beta,
                      std::complex<double> *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char upper_lower_ = *fortran_char(upper_lower);
-        double alpha_real = alpha.real(), alpha_imag = alpha.imag();
-        double beta_real = beta.real(), beta_imag = beta.imag();
-        host_task<class mkl_kernel_zhemv_usm>(cgh, [=]() {
-            MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
-            MKL_Complex16 beta_  = { beta_real, beta_imag };
-            ::zhemv((const char *)&upper_lower_, (const MKL_INT *)&n,
-                    (const MKL_Complex16 *)&alpha_, a, (const MKL_INT *)&lda, x,
-                    (const MKL_INT *)&incx, (const MKL_Complex16 *)&beta_, y,
-                    (const MKL_INT *)&incy);
-        });
+    const char upper_lower_ = *fortran_char(upper_lower);
+    double alpha_real = alpha.real(), alpha_imag = alpha.imag();
+    double beta_real = beta.real(), beta_imag = beta.imag();
+    auto done = submit_usm<class mkl_kernel_zhemv_usm>(queue, n * n, dependencies, [=]() {
+        MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
+        MKL_Complex16 beta_  = { beta_real, beta_imag };
+        ::zhemv((const char *)&upper_lower_, (const MKL_INT *)&n, (const MKL_Complex16 *)&alpha_, a,
+                (const MKL_INT *)&lda, x, (const MKL_INT *)&incx, (const MKL_Complex16 *)&beta_, y,
+                (const MKL_INT *)&incy);
     });
     return done;
 }
@@ -1566,16 +1453,10 @@ cl::sycl::event hemv(cl::sycl::queue &queue, uplo upper_lower, int64_t n,
 cl::sycl::event her(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
                     const std::complex<float> *x, int64_t incx, std::complex<float> *a, int64_t lda,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char upper_lower_ = *fortran_char(upper_lower);
-        host_task<class mkl_kernel_cher_usm>(cgh, [=]() {
-            ::cher((const char *)&upper_lower_, (const MKL_INT *)&n, (const float *)&alpha, x,
-                   (const MKL_INT *)&incx, a, (const MKL_INT *)&lda);
-        });
+    const char upper_lower_ = *fortran_char(upper_lower);
+    auto done = submit_usm<class mkl_kernel_cher_usm>(queue, n * n, dependencies, [=]() {
+        ::cher((const char *)&upper_lower_, (const MKL_INT *)&n, (const float *)&alpha, x,
+               (const MKL_INT *)&incx, a, (const MKL_INT *)&lda);
     });
     return done;
 }
@@ -1583,16 +1464,10 @@ cl::sycl::event her(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float a
 cl::sycl::event her(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
                     const std::complex<double> *x, int64_t incx, std::complex<double> *a,
                     int64_t lda, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char upper_lower_ = *fortran_char(upper_lower);
-        host_task<class mkl_kernel_zher_usm>(cgh, [=]() {
-            ::zher((const char *)&upper_lower_, (const MKL_INT *)&n, (const double *)&alpha, x,
-                   (const MKL_INT *)&incx, a, (const MKL_INT *)&lda);
-        });
+    const char upper_lower_ = *fortran_char(upper_lower);
+    auto done = submit_usm<class mkl_kernel_zher_usm>(queue, n * n, dependencies, [=]() {
+        ::zher((const char *)&upper_lower_, (const MKL_INT *)&n, (const double *)&alpha, x,
+               (const MKL_INT *)&incx, a, (const MKL_INT *)&lda);
     });
     return done;
 }
@@ -1601,18 +1476,12 @@ cl::sycl::event her2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::c
                      const std::complex<float> *x, int64_t incx, const std::complex<float> *y,
                      int64_t incy, std::complex<float> *a, int64_t lda,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char upper_lower_ = *fortran_char(upper_lower);
-        float alpha_real = alpha.real(), alpha_imag = alpha.imag();
-        host_task<class mkl_kernel_cher2_usm>(cgh, [=]() {
-            MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
-            ::cher2((const char *)&upper_lower_, (const MKL_INT *)&n, (const MKL_Complex8 *)&alpha_,
-                    x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy, a, (const MKL_INT *)&lda);
-        });
+    const char upper_lower_ = *fortran_char(upper_lower);
+    float alpha_real = alpha.real(), alpha_imag = alpha.imag();
+    auto done = submit_usm<class mkl_kernel_cher2_usm>(queue, n * n, dependencies, [=]() {
+        MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
+        ::cher2((const char *)&upper_lower_, (const MKL_INT *)&n, (const MKL_Complex8 *)&alpha_,
+                x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy, a, (const MKL_INT *)&lda);
     });
     return done;
 }
@@ -1621,19 +1490,12 @@ cl::sycl::event her2(cl::sycl::queue &queue, uplo upper_lower, int64_t n,
                      std::complex<double> alpha, const std::complex<double> *x, int64_t incx,
                      const std::complex<double> *y, int64_t incy, std::complex<double> *a,
                      int64_t lda, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char upper_lower_ = *fortran_char(upper_lower);
-        double alpha_real = alpha.real(), alpha_imag = alpha.imag();
-        host_task<class mkl_kernel_zher2_usm>(cgh, [=]() {
-            MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
-            ::zher2((const char *)&upper_lower_, (const MKL_INT *)&n,
-                    (const MKL_Complex16 *)&alpha_, x, (const MKL_INT *)&incx, y,
-                    (const MKL_INT *)&incy, a, (const MKL_INT *)&lda);
-        });
+    const char upper_lower_ = *fortran_char(upper_lower);
+    double alpha_real = alpha.real(), alpha_imag = alpha.imag();
+    auto done = submit_usm<class mkl_kernel_zher2_usm>(queue, n * n, dependencies, [=]() {
+        MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
+        ::zher2((const char *)&upper_lower_, (const MKL_INT *)&n, (const MKL_Complex16 *)&alpha_, x,
+                (const MKL_INT *)&incx, y, (const MKL_INT *)&incy, a, (const MKL_INT *)&lda);
     });
     return done;
 }
@@ -1642,21 +1504,14 @@ cl::sycl::event hpmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::c
                      const std::complex<float> *ap, const std::complex<float> *x, int64_t incx,
                      std::complex<float> beta, std::complex<float> *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char upper_lower_ = *fortran_char(upper_lower);
-        float alpha_real = alpha.real(), alpha_imag = alpha.imag();
-        float beta_real = beta.real(), beta_imag = beta.imag();
-        host_task<class mkl_kernel_chpmv_usm>(cgh, [=]() {
-            MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
-            MKL_Complex8 beta_  = { beta_real, beta_imag };
-            ::chpmv((const char *)&upper_lower_, (const MKL_INT *)&n, (const MKL_Complex8 *)&alpha_,
-                    ap, x, (const MKL_INT *)&incx, (const MKL_Complex8 *)&beta_, y,
-                    (const MKL_INT *)&incy);
-        });
+    const char upper_lower_ = *fortran_char(upper_lower);
+    float alpha_real = alpha.real(), alpha_imag = alpha.imag();
+    float beta_real = beta.real(), beta_imag = beta.imag();
+    auto done = submit_usm<class mkl_kernel_chpmv_usm>(queue, n * n, dependencies, [=]() {
+        MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
+        MKL_Complex8 beta_  = { beta_real, beta_imag };
+        ::chpmv((const char *)&upper_lower_, (const MKL_INT *)&n, (const MKL_Complex8 *)&alpha_, ap,
+                x, (const MKL_INT *)&incx, (const MKL_Complex8 *)&beta_, y, (const MKL_INT *)&incy);
     });
     return done;
 }
@@ -1666,21 +1521,15 @@ cl::sycl::event hpmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n,
                      const std::complex<double> *x, int64_t incx, std::complex<double> beta,
                      std::complex<double> *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char upper_lower_ = *fortran_char(upper_lower);
-        double alpha_real = alpha.real(), alpha_imag = alpha.imag();
-        double beta_real = beta.real(), beta_imag = beta.imag();
-        host_task<class mkl_kernel_zhpmv_usm>(cgh, [=]() {
-            MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
-            MKL_Complex16 beta_  = { beta_real, beta_imag };
-            ::zhpmv((const char *)&upper_lower_, (const MKL_INT *)&n,
-                    (const MKL_Complex16 *)&alpha_, ap, x, (const MKL_INT *)&incx,
-                    (const MKL_Complex16 *)&beta_, y, (const MKL_INT *)&incy);
-        });
+    const char upper_lower_ = *fortran_char(upper_lower);
+    double alpha_real = alpha.real(), alpha_imag = alpha.imag();
+    double beta_real = beta.real(), beta_imag = beta.imag();
+    auto done = submit_usm<class mkl_kernel_zhpmv_usm>(queue, n * n, dependencies, [=]() {
+        MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
+        MKL_Complex16 beta_  = { beta_real, beta_imag };
+        ::zhpmv((const char *)&upper_lower_, (const MKL_INT *)&n,
+                (const MKL_Complex16 *)&alpha_, ap, x, (const MKL_INT *)&incx,
+                (const MKL_Complex16 *)&beta_, y, (const MKL_INT *)&incy);
     });
     return done;
 }
@@ -1688,16 +1537,10 @@ cl::sycl::event hpmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n,
 cl::sycl::event hpr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
                     const std::complex<float> *x, int64_t incx, std::complex<float> *ap,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char upper_lower_ = *fortran_char(upper_lower);
-        host_task<class mkl_kernel_chpr_usm>(cgh, [=]() {
-            ::chpr((const char *)&upper_lower_, (const MKL_INT *)&n, (const float *)&alpha, x,
-                   (const MKL_INT *)&incx, ap);
-        });
+    const char upper_lower_ = *fortran_char(upper_lower);
+    auto done = submit_usm<class mkl_kernel_chpr_usm>(queue, n * n, dependencies, [=]() {
+        ::chpr((const char *)&upper_lower_, (const MKL_INT *)&n, (const float *)&alpha, x,
+               (const MKL_INT *)&incx, ap);
     });
     return done;
 }
@@ -1705,16 +1548,10 @@ cl::sycl::event hpr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float a
 cl::sycl::event hpr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
                     const std::complex<double> *x, int64_t incx, std::complex<double> *ap,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char upper_lower_ = *fortran_char(upper_lower);
-        host_task<class mkl_kernel_zhpr_usm>(cgh, [=]() {
-            ::zhpr((const char *)&upper_lower_, (const MKL_INT *)&n, (const double *)&alpha, x,
-                   (const MKL_INT *)&incx, ap);
-        });
+    const char upper_lower_ = *fortran_char(upper_lower);
+    auto done = submit_usm<class mkl_kernel_zhpr_usm>(queue, n * n, dependencies, [=]() {
+        ::zhpr((const char *)&upper_lower_, (const MKL_INT *)&n, (const double *)&alpha, x,
+               (const MKL_INT *)&incx, ap);
     });
     return done;
 }
@@ -1723,18 +1560,12 @@ cl::sycl::event hpr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::c
                      const std::complex<float> *x, int64_t incx, const std::complex<float> *y,
                      int64_t incy, std::complex<float> *ap,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char upper_lower_ = *fortran_char(upper_lower);
-        float alpha_real = alpha.real(), alpha_imag = alpha.imag();
-        host_task<class mkl_kernel_chpr2_usm>(cgh, [=]() {
-            MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
-            ::chpr2((const char *)&upper_lower_, (const MKL_INT *)&n, (const MKL_Complex8 *)&alpha_,
-                    x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy, ap);
-        });
+    const char upper_lower_ = *fortran_char(upper_lower);
+    float alpha_real = alpha.real(), alpha_imag = alpha.imag();
+    auto done = submit_usm<class mkl_kernel_chpr2_usm>(queue, n * n, dependencies, [=]() {
+        MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
+        ::chpr2((const char *)&upper_lower_, (const MKL_INT *)&n, (const MKL_Complex8 *)&alpha_,
+                x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy, ap);
     });
     return done;
 }
@@ -1743,19 +1574,12 @@ cl::sycl::event hpr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n,
                      std::complex<double> alpha, const std::complex<double> *x, int64_t incx,
                      const std::complex<double> *y, int64_t incy, std::complex<double> *ap,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char upper_lower_ = *fortran_char(upper_lower);
-        double alpha_real = alpha.real(), alpha_imag = alpha.imag();
-        host_task<class mkl_kernel_zhpr2_usm>(cgh, [=]() {
-            MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
-            ::zhpr2((const char *)&upper_lower_, (const MKL_INT *)&n,
-                    (const MKL_Complex16 *)&alpha_, x, (const MKL_INT *)&incx, y,
-                    (const MKL_INT *)&incy, ap);
-        });
+    const char upper_lower_ = *fortran_char(upper_lower);
+    double alpha_real = alpha.real(), alpha_imag = alpha.imag();
+    auto done = submit_usm<class mkl_kernel_zhpr2_usm>(queue, n * n, dependencies, [=]() {
+        MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
+        ::zhpr2((const char *)&upper_lower_, (const MKL_INT *)&n, (const MKL_Complex16 *)&alpha_, x,
+                (const MKL_INT *)&incx, y, (const MKL_INT *)&incy, ap);
     });
     return done;
 }
@@ -1764,17 +1588,11 @@ cl::sycl::event sbmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, int64_
                      const float *a, int64_t lda, const float *x, int64_t incx, float beta,
                      float *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char upper_lower_ = *fortran_char(upper_lower);
-        host_task<class mkl_kernel_ssbmv_usm>(cgh, [=]() {
-            ::ssbmv((const char *)&upper_lower_, (const MKL_INT *)&n, (const MKL_INT *)&k,
-                    (const float *)&alpha, a, (const MKL_INT *)&lda, x, (const MKL_INT *)&incx,
-                    (const float *)&beta, y, (const MKL_INT *)&incy);
-        });
+    const char upper_lower_ = *fortran_char(upper_lower);
+    auto done = submit_usm<class mkl_kernel_ssbmv_usm>(queue, n * n, dependencies, [=]() {
+        ::ssbmv((const char *)&upper_lower_, (const MKL_INT *)&n, (const MKL_INT *)&k,
+                (const float *)&alpha, a, (const MKL_INT *)&lda, x, (const MKL_INT *)&incx,
+                (const float *)&beta, y, (const MKL_INT *)&incy);
     });
     return done;
 }
@@ -1783,17 +1601,11 @@ cl::sycl::event sbmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, int64_
                      const double *a, int64_t lda, const double *x, int64_t incx, double beta,
                      double *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char upper_lower_ = *fortran_char(upper_lower);
-        host_task<class mkl_kernel_dsbmv_usm>(cgh, [=]() {
-            ::dsbmv((const char *)&upper_lower_, (const MKL_INT *)&n, (const MKL_INT *)&k,
-                    (const double *)&alpha, a, (const MKL_INT *)&lda, x, (const MKL_INT *)&incx,
-                    (const double *)&beta, y, (const MKL_INT *)&incy);
-        });
+    const char upper_lower_ = *fortran_char(upper_lower);
+    auto done = submit_usm<class mkl_kernel_dsbmv_usm>(queue, n * n, dependencies, [=]() {
+        ::dsbmv((const char *)&upper_lower_, (const MKL_INT *)&n, (const MKL_INT *)&k,
+                (const double *)&alpha, a, (const MKL_INT *)&lda, x, (const MKL_INT *)&incx,
+                (const double *)&beta, y, (const MKL_INT *)&incy);
     });
     return done;
 }
@@ -1801,16 +1613,10 @@ cl::sycl::event sbmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, int64_
 cl::sycl::event spmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
                      const float *ap, const float *x, int64_t incx, float beta, float *y,
                      int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char upper_lower_ = *fortran_char(upper_lower);
-        host_task<class mkl_kernel_sspmv_usm>(cgh, [=]() {
-            ::sspmv((const char *)&upper_lower_, (const MKL_INT *)&n, (const float *)&alpha, ap, x,
-                    (const MKL_INT *)&incx, (const float *)&beta, y, (const MKL_INT *)&incy);
-        });
+    const char upper_lower_ = *fortran_char(upper_lower);
+    auto done = submit_usm<class mkl_kernel_sspmv_usm>(queue, n * n, dependencies, [=]() {
+        ::sspmv((const char *)&upper_lower_, (const MKL_INT *)&n, (const float *)&alpha, ap, x,
+                (const MKL_INT *)&incx, (const float *)&beta, y, (const MKL_INT *)&incy);
     });
     return done;
 }
@@ -1818,16 +1624,10 @@ cl::sycl::event spmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float
 cl::sycl::event spmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
                      const double *ap, const double *x, int64_t incx, double beta, double *y,
                      int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char upper_lower_ = *fortran_char(upper_lower);
-        host_task<class mkl_kernel_dspmv_usm>(cgh, [=]() {
-            ::dspmv((const char *)&upper_lower_, (const MKL_INT *)&n, (const double *)&alpha, ap, x,
-                    (const MKL_INT *)&incx, (const double *)&beta, y, (const MKL_INT *)&incy);
-        });
+    const char upper_lower_ = *fortran_char(upper_lower);
+    auto done = submit_usm<class mkl_kernel_dspmv_usm>(queue, n * n, dependencies, [=]() {
+        ::dspmv((const char *)&upper_lower_, (const MKL_INT *)&n, (const double *)&alpha, ap, x,
+                (const MKL_INT *)&incx, (const double *)&beta, y, (const MKL_INT *)&incy);
     });
     return done;
 }
@@ -1835,16 +1635,10 @@ cl::sycl::event spmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double
 cl::sycl::event spr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
                     const float *x, int64_t incx, float *ap,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char upper_lower_ = *fortran_char(upper_lower);
-        host_task<class mkl_kernel_sspr_usm>(cgh, [=]() {
-            ::sspr((const char *)&upper_lower_, (const MKL_INT *)&n, (const float *)&alpha, x,
-                   (const MKL_INT *)&incx, ap);
-        });
+    const char upper_lower_ = *fortran_char(upper_lower);
+    auto done = submit_usm<class mkl_kernel_sspr_usm>(queue, n * n, dependencies, [=]() {
+        ::sspr((const char *)&upper_lower_, (const MKL_INT *)&n, (const float *)&alpha, x,
+               (const MKL_INT *)&incx, ap);
     });
     return done;
 }
@@ -1852,16 +1646,10 @@ cl::sycl::event spr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float a
 cl::sycl::event spr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
                     const double *x, int64_t incx, double *ap,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char upper_lower_ = *fortran_char(upper_lower);
-        host_task<class mkl_kernel_dspr_usm>(cgh, [=]() {
-            ::dspr((const char *)&upper_lower_, (const MKL_INT *)&n, (const double *)&alpha, x,
-                   (const MKL_INT *)&incx, ap);
-        });
+    const char upper_lower_ = *fortran_char(upper_lower);
+    auto done = submit_usm<class mkl_kernel_dspr_usm>(queue, n * n, dependencies, [=]() {
+        ::dspr((const char *)&upper_lower_, (const MKL_INT *)&n, (const double *)&alpha, x,
+               (const MKL_INT *)&incx, ap);
     });
     return done;
 }
@@ -1869,16 +1657,10 @@ cl::sycl::event spr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double
 cl::sycl::event spr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
                      const float *x, int64_t incx, const float *y, int64_t incy, float *ap,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char upper_lower_ = *fortran_char(upper_lower);
-        host_task<class mkl_kernel_sspr2_usm>(cgh, [=]() {
-            ::sspr2((const char *)&upper_lower_, (const MKL_INT *)&n, (const float *)&alpha, x,
-                    (const MKL_INT *)&incx, y, (const MKL_INT *)&incy, ap);
-        });
+    const char upper_lower_ = *fortran_char(upper_lower);
+    auto done = submit_usm<class mkl_kernel_sspr2_usm>(queue, n * n, dependencies, [=]() {
+        ::sspr2((const char *)&upper_lower_, (const MKL_INT *)&n, (const float *)&alpha, x,
+                (const MKL_INT *)&incx, y, (const MKL_INT *)&incy, ap);
     });
     return done;
 }
@@ -1886,16 +1668,10 @@ cl::sycl::event spr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float
 cl::sycl::event spr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
                      const double *x, int64_t incx, const double *y, int64_t incy, double *ap,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char upper_lower_ = *fortran_char(upper_lower);
-        host_task<class mkl_kernel_dspr2_usm>(cgh, [=]() {
-            ::dspr2((const char *)&upper_lower_, (const MKL_INT *)&n, (const double *)&alpha, x,
-                    (const MKL_INT *)&incx, y, (const MKL_INT *)&incy, ap);
-        });
+    const char upper_lower_ = *fortran_char(upper_lower);
+    auto done = submit_usm<class mkl_kernel_dspr2_usm>(queue, n * n, dependencies, [=]() {
+        ::dspr2((const char *)&upper_lower_, (const MKL_INT *)&n, (const double *)&alpha, x,
+                (const MKL_INT *)&incx, y, (const MKL_INT *)&incy, ap);
     });
     return done;
 }
@@ -1904,17 +1680,11 @@ cl::sycl::event symv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float
                      const float *a, int64_t lda, const float *x, int64_t incx, float beta,
                      float *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char upper_lower_ = *fortran_char(upper_lower);
-        host_task<class mkl_kernel_ssymv_usm>(cgh, [=]() {
-            ::ssymv((const char *)&upper_lower_, (const MKL_INT *)&n, (const float *)&alpha, a,
-                    (const MKL_INT *)&lda, x, (const MKL_INT *)&incx, (const float *)&beta, y,
-                    (const MKL_INT *)&incy);
-        });
+    const char upper_lower_ = *fortran_char(upper_lower);
+    auto done = submit_usm<class mkl_kernel_ssymv_usm>(queue, n * n, dependencies, [=]() {
+        ::ssymv((const char *)&upper_lower_, (const MKL_INT *)&n, (const float *)&alpha, a,
+                (const MKL_INT *)&lda, x, (const MKL_INT *)&incx, (const float *)&beta, y,
+                (const MKL_INT *)&incy);
     });
     return done;
 }
@@ -1923,17 +1693,11 @@ cl::sycl::event symv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double
                      const double *a, int64_t lda, const double *x, int64_t incx, double beta,
                      double *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char upper_lower_ = *fortran_char(upper_lower);
-        host_task<class mkl_kernel_dsymv_usm>(cgh, [=]() {
-            ::dsymv((const char *)&upper_lower_, (const MKL_INT *)&n, (const double *)&alpha, a,
-                    (const MKL_INT *)&lda, x, (const MKL_INT *)&incx, (const double *)&beta, y,
-                    (const MKL_INT *)&incy);
-        });
+    const char upper_lower_ = *fortran_char(upper_lower);
+    auto done = submit_usm<class mkl_kernel_dsymv_usm>(queue, n * n, dependencies, [=]() {
+        ::dsymv((const char *)&upper_lower_, (const MKL_INT *)&n, (const double *)&alpha, a,
+                (const MKL_INT *)&lda, x, (const MKL_INT *)&incx, (const double *)&beta, y,
+                (const MKL_INT *)&incy);
     });
     return done;
 }
@@ -1941,16 +1705,10 @@ cl::sycl::event symv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double
 cl::sycl::event syr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
                     const float *x, int64_t incx, float *a, int64_t lda,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char upper_lower_ = *fortran_char(upper_lower);
-        host_task<class mkl_kernel_ssyr_usm>(cgh, [=]() {
-            ::ssyr((const char *)&upper_lower_, (const MKL_INT *)&n, (const float *)&alpha, x,
-                   (const MKL_INT *)&incx, a, (const MKL_INT *)&lda);
-        });
+    const char upper_lower_ = *fortran_char(upper_lower);
+    auto done = submit_usm<class mkl_kernel_ssyr_usm>(queue, n * n, dependencies, [=]() {
+        ::ssyr((const char *)&upper_lower_, (const MKL_INT *)&n, (const float *)&alpha, x,
+               (const MKL_INT *)&incx, a, (const MKL_INT *)&lda);
     });
     return done;
 }
@@ -1958,16 +1716,10 @@ cl::sycl::event syr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float a
 cl::sycl::event syr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
                     const double *x, int64_t incx, double *a, int64_t lda,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char upper_lower_ = *fortran_char(upper_lower);
-        host_task<class mkl_kernel_dsyr_usm>(cgh, [=]() {
-            ::dsyr((const char *)&upper_lower_, (const MKL_INT *)&n, (const double *)&alpha, x,
-                   (const MKL_INT *)&incx, a, (const MKL_INT *)&lda);
-        });
+    const char upper_lower_ = *fortran_char(upper_lower);
+    auto done = submit_usm<class mkl_kernel_dsyr_usm>(queue, n * n, dependencies, [=]() {
+        ::dsyr((const char *)&upper_lower_, (const MKL_INT *)&n, (const double *)&alpha, x,
+               (const MKL_INT *)&incx, a, (const MKL_INT *)&lda);
     });
     return done;
 }
@@ -1975,16 +1727,10 @@ cl::sycl::event syr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double
 cl::sycl::event syr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
                      const float *x, int64_t incx, const float *y, int64_t incy, float *a,
                      int64_t lda, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char upper_lower_ = *fortran_char(upper_lower);
-        host_task<class mkl_kernel_ssyr2_usm>(cgh, [=]() {
-            ::ssyr2((const char *)&upper_lower_, (const MKL_INT *)&n, (const float *)&alpha, x,
-                    (const MKL_INT *)&incx, y, (const MKL_INT *)&incy, a, (const MKL_INT *)&lda);
-        });
+    const char upper_lower_ = *fortran_char(upper_lower);
+    auto done = submit_usm<class mkl_kernel_ssyr2_usm>(queue, n * n, dependencies, [=]() {
+        ::ssyr2((const char *)&upper_lower_, (const MKL_INT *)&n, (const float *)&alpha, x,
+                (const MKL_INT *)&incx, y, (const MKL_INT *)&incy, a, (const MKL_INT *)&lda);
     });
     return done;
 }
@@ -1992,16 +1738,10 @@ cl::sycl::event syr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float
 cl::sycl::event syr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
                      const double *x, int64_t incx, const double *y, int64_t incy, double *a,
                      int64_t lda, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char upper_lower_ = *fortran_char(upper_lower);
-        host_task<class mkl_kernel_dsyr2_usm>(cgh, [=]() {
-            ::dsyr2((const char *)&upper_lower_, (const MKL_INT *)&n, (const double *)&alpha, x,
-                    (const MKL_INT *)&incx, y, (const MKL_INT *)&incy, a, (const MKL_INT *)&lda);
-        });
+    const char upper_lower_ = *fortran_char(upper_lower);
+    auto done = submit_usm<class mkl_kernel_dsyr2_usm>(queue, n * n, dependencies, [=]() {
+        ::dsyr2((const char *)&upper_lower_, (const MKL_INT *)&n, (const double *)&alpha, x,
+                (const MKL_INT *)&incx, y, (const MKL_INT *)&incy, a, (const MKL_INT *)&lda);
     });
     return done;
 }
@@ -2009,19 +1749,13 @@ cl::sycl::event syr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double
 cl::sycl::event tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                      int64_t n, int64_t k, const float *a, int64_t lda, float *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char upper_lower_ = *fortran_char(upper_lower);
-        const char trans_       = *fortran_char(trans);
-        const char unit_diag_   = *fortran_char(unit_diag);
-        host_task<class mkl_kernel_stbmv_usm>(cgh, [=]() {
-            ::stbmv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, (const MKL_INT *)&k, a, (const MKL_INT *)&lda, x,
-                    (const MKL_INT *)&incx);
-        });
+    const char upper_lower_ = *fortran_char(upper_lower);
+    const char trans_       = *fortran_char(trans);
+    const char unit_diag_   = *fortran_char(unit_diag);
+    auto done = submit_usm<class mkl_kernel_stbmv_usm>(queue, n * n, dependencies, [=]() {
+        ::stbmv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
+                (const MKL_INT *)&n, (const MKL_INT *)&k, a, (const MKL_INT *)&lda, x,
+                (const MKL_INT *)&incx);
     });
     return done;
 }
@@ -2029,19 +1763,13 @@ cl::sycl::event tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
 cl::sycl::event tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                      int64_t n, int64_t k, const double *a, int64_t lda, double *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char upper_lower_ = *fortran_char(upper_lower);
-        const char trans_       = *fortran_char(trans);
-        const char unit_diag_   = *fortran_char(unit_diag);
-        host_task<class mkl_kernel_dtbmv_usm>(cgh, [=]() {
-            ::dtbmv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, (const MKL_INT *)&k, a, (const MKL_INT *)&lda, x,
-                    (const MKL_INT *)&incx);
-        });
+    const char upper_lower_ = *fortran_char(upper_lower);
+    const char trans_       = *fortran_char(trans);
+    const char unit_diag_   = *fortran_char(unit_diag);
+    auto done = submit_usm<class mkl_kernel_dtbmv_usm>(queue, n * n, dependencies, [=]() {
+        ::dtbmv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
+                (const MKL_INT *)&n, (const MKL_INT *)&k, a, (const MKL_INT *)&lda, x,
+                (const MKL_INT *)&incx);
     });
     return done;
 }
@@ -2050,19 +1778,13 @@ cl::sycl::event tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
                      int64_t n, int64_t k, const std::complex<float> *a, int64_t lda,
                      std::complex<float> *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char upper_lower_ = *fortran_char(upper_lower);
-        const char trans_       = *fortran_char(trans);
-        const char unit_diag_   = *fortran_char(unit_diag);
-        host_task<class mkl_kernel_ctbmv_usm>(cgh, [=]() {
-            ::ctbmv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, (const MKL_INT *)&k, a, (const MKL_INT *)&lda, x,
-                    (const MKL_INT *)&incx);
-        });
+    const char upper_lower_ = *fortran_char(upper_lower);
+    const char trans_       = *fortran_char(trans);
+    const char unit_diag_   = *fortran_char(unit_diag);
+    auto done = submit_usm<class mkl_kernel_ctbmv_usm>(queue, n * n, dependencies, [=]() {
+        ::ctbmv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
+                (const MKL_INT *)&n, (const MKL_INT *)&k, a, (const MKL_INT *)&lda, x,
+                (const MKL_INT *)&incx);
     });
     return done;
 }
@@ -2071,19 +1793,13 @@ cl::sycl::event tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
                      int64_t n, int64_t k, const std::complex<double> *a, int64_t lda,
                      std::complex<double> *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char upper_lower_ = *fortran_char(upper_lower);
-        const char trans_       = *fortran_char(trans);
-        const char unit_diag_   = *fortran_char(unit_diag);
-        host_task<class mkl_kernel_ztbmv_usm>(cgh, [=]() {
-            ::ztbmv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, (const MKL_INT *)&k, a, (const MKL_INT *)&lda, x,
-                    (const MKL_INT *)&incx);
-        });
+    const char upper_lower_ = *fortran_char(upper_lower);
+    const char trans_       = *fortran_char(trans);
+    const char unit_diag_   = *fortran_char(unit_diag);
+    auto done = submit_usm<class mkl_kernel_ztbmv_usm>(queue, n * n, dependencies, [=]() {
+        ::ztbmv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
+                (const MKL_INT *)&n, (const MKL_INT *)&k, a, (const MKL_INT *)&lda, x,
+                (const MKL_INT *)&incx);
     });
     return done;
 }
@@ -2091,19 +1807,13 @@ cl::sycl::event tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
 cl::sycl::event tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                      int64_t n, int64_t k, const float *a, int64_t lda, float *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char upper_lower_ = *fortran_char(upper_lower);
-        const char trans_       = *fortran_char(trans);
-        const char unit_diag_   = *fortran_char(unit_diag);
-        host_task<class mkl_kernel_stbsv_usm>(cgh, [=]() {
-            ::stbsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, (const MKL_INT *)&k, a, (const MKL_INT *)&lda, x,
-                    (const MKL_INT *)&incx);
-        });
+    const char upper_lower_ = *fortran_char(upper_lower);
+    const char trans_       = *fortran_char(trans);
+    const char unit_diag_   = *fortran_char(unit_diag);
+    auto done = submit_usm<class mkl_kernel_stbsv_usm>(queue, n * n, dependencies, [=]() {
+        ::stbsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
+                (const MKL_INT *)&n, (const MKL_INT *)&k, a, (const MKL_INT *)&lda, x,
+                (const MKL_INT *)&incx);
     });
     return done;
 }
@@ -2111,19 +1821,13 @@ cl::sycl::event tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
 cl::sycl::event tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                      int64_t n, int64_t k, const double *a, int64_t lda, double *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char upper_lower_ = *fortran_char(upper_lower);
-        const char trans_       = *fortran_char(trans);
-        const char unit_diag_   = *fortran_char(unit_diag);
-        host_task<class mkl_kernel_dtbsv_usm>(cgh, [=]() {
-            ::dtbsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, (const MKL_INT *)&k, a, (const MKL_INT *)&lda, x,
-                    (const MKL_INT *)&incx);
-        });
+    const char upper_lower_ = *fortran_char(upper_lower);
+    const char trans_       = *fortran_char(trans);
+    const char unit_diag_   = *fortran_char(unit_diag);
+    auto done = submit_usm<class mkl_kernel_dtbsv_usm>(queue, n * n, dependencies, [=]() {
+        ::dtbsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
+                (const MKL_INT *)&n, (const MKL_INT *)&k, a, (const MKL_INT *)&lda, x,
+                (const MKL_INT *)&incx);
     });
     return done;
 }
@@ -2132,19 +1836,13 @@ cl::sycl::event tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
                      int64_t n, int64_t k, const std::complex<float> *a, int64_t lda,
                      std::complex<float> *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char upper_lower_ = *fortran_char(upper_lower);
-        const char trans_       = *fortran_char(trans);
-        const char unit_diag_   = *fortran_char(unit_diag);
-        host_task<class mkl_kernel_ctbsv_usm>(cgh, [=]() {
-            ::ctbsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, (const MKL_INT *)&k, a, (const MKL_INT *)&lda, x,
-                    (const MKL_INT *)&incx);
-        });
+    const char upper_lower_ = *fortran_char(upper_lower);
+    const char trans_       = *fortran_char(trans);
+    const char unit_diag_   = *fortran_char(unit_diag);
+    auto done = submit_usm<class mkl_kernel_ctbsv_usm>(queue, n * n, dependencies, [=]() {
+        ::ctbsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
+                (const MKL_INT *)&n, (const MKL_INT *)&k, a, (const MKL_INT *)&lda, x,
+                (const MKL_INT *)&incx);
     });
     return done;
 }
@@ -2153,19 +1851,13 @@ cl::sycl::event tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
                      int64_t n, int64_t k, const std::complex<double> *a, int64_t lda,
                      std::complex<double> *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char upper_lower_ = *fortran_char(upper_lower);
-        const char trans_       = *fortran_char(trans);
-        const char unit_diag_   = *fortran_char(unit_diag);
-        host_task<class mkl_kernel_ztbsv_usm>(cgh, [=]() {
-            ::ztbsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, (const MKL_INT *)&k, a, (const MKL_INT *)&lda, x,
-                    (const MKL_INT *)&incx);
-        });
+    const char upper_lower_ = *fortran_char(upper_lower);
+    const char trans_       = *fortran_char(trans);
+    const char unit_diag_   = *fortran_char(unit_diag);
+    auto done = submit_usm<class mkl_kernel_ztbsv_usm>(queue, n * n, dependencies, [=]() {
+        ::ztbsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
+                (const MKL_INT *)&n, (const MKL_INT *)&k, a, (const MKL_INT *)&lda, x,
+                (const MKL_INT *)&incx);
     });
     return done;
 }
@@ -2173,18 +1865,12 @@ cl::sycl::event tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
 cl::sycl::event tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                      int64_t n, const float *ap, float *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char upper_lower_ = *fortran_char(upper_lower);
-        const char trans_       = *fortran_char(trans);
-        const char unit_diag_   = *fortran_char(unit_diag);
-        host_task<class mkl_kernel_stpmv_usm>(cgh, [=]() {
-            ::stpmv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, ap, x, (const MKL_INT *)&incx);
-        });
+    const char upper_lower_ = *fortran_char(upper_lower);
+    const char trans_       = *fortran_char(trans);
+    const char unit_diag_   = *fortran_char(unit_diag);
+    auto done = submit_usm<class mkl_kernel_stpmv_usm>(queue, n * n, dependencies, [=]() {
+        ::stpmv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
+                (const MKL_INT *)&n, ap, x, (const MKL_INT *)&incx);
     });
     return done;
 }
@@ -2192,18 +1878,12 @@ cl::sycl::event tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
 cl::sycl::event tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                      int64_t n, const double *ap, double *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char upper_lower_ = *fortran_char(upper_lower);
-        const char trans_       = *fortran_char(trans);
-        const char unit_diag_   = *fortran_char(unit_diag);
-        host_task<class mkl_kernel_dtpmv_usm>(cgh, [=]() {
-            ::dtpmv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, ap, x, (const MKL_INT *)&incx);
-        });
+    const char upper_lower_ = *fortran_char(upper_lower);
+    const char trans_       = *fortran_char(trans);
+    const char unit_diag_   = *fortran_char(unit_diag);
+    auto done = submit_usm<class mkl_kernel_dtpmv_usm>(queue, n * n, dependencies, [=]() {
+        ::dtpmv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
+                (const MKL_INT *)&n, ap, x, (const MKL_INT *)&incx);
     });
     return done;
 }
@@ -2211,18 +1891,12 @@ cl::sycl::event tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
 cl::sycl::event tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                      int64_t n, const std::complex<float> *ap, std::complex<float> *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char upper_lower_ = *fortran_char(upper_lower);
-        const char trans_       = *fortran_char(trans);
-        const char unit_diag_   = *fortran_char(unit_diag);
-        host_task<class mkl_kernel_ctpmv_usm>(cgh, [=]() {
-            ::ctpmv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, ap, x, (const MKL_INT *)&incx);
-        });
+    const char upper_lower_ = *fortran_char(upper_lower);
+    const char trans_       = *fortran_char(trans);
+    const char unit_diag_   = *fortran_char(unit_diag);
+    auto done = submit_usm<class mkl_kernel_ctpmv_usm>(queue, n * n, dependencies, [=]() {
+        ::ctpmv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
+                (const MKL_INT *)&n, ap, x, (const MKL_INT *)&incx);
     });
     return done;
 }
@@ -2230,18 +1904,12 @@ cl::sycl::event tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
 cl::sycl::event tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                      int64_t n, const std::complex<double> *ap, std::complex<double> *x,
                      int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char upper_lower_ = *fortran_char(upper_lower);
-        const char trans_       = *fortran_char(trans);
-        const char unit_diag_   = *fortran_char(unit_diag);
-        host_task<class mkl_kernel_ztpmv_usm>(cgh, [=]() {
-            ::ztpmv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, ap, x, (const MKL_INT *)&incx);
-        });
+    const char upper_lower_ = *fortran_char(upper_lower);
+    const char trans_       = *fortran_char(trans);
+    const char unit_diag_   = *fortran_char(unit_diag);
+    auto done = submit_usm<class mkl_kernel_ztpmv_usm>(queue, n * n, dependencies, [=]() {
+        ::ztpmv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
+                (const MKL_INT *)&n, ap, x, (const MKL_INT *)&incx);
     });
     return done;
 }
@@ -2249,18 +1917,12 @@ cl::sycl::event tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
 cl::sycl::event tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                      int64_t n, const float *ap, float *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char upper_lower_ = *fortran_char(upper_lower);
-        const char trans_       = *fortran_char(trans);
-        const char unit_diag_   = *fortran_char(unit_diag);
-        host_task<class mkl_kernel_stpsv_usm>(cgh, [=]() {
-            ::stpsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, ap, x, (const MKL_INT *)&incx);
-        });
+    const char upper_lower_ = *fortran_char(upper_lower);
+    const char trans_       = *fortran_char(trans);
+    const char unit_diag_   = *fortran_char(unit_diag);
+    auto done = submit_usm<class mkl_kernel_stpsv_usm>(queue, n * n, dependencies, [=]() {
+        ::stpsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
+                (const MKL_INT *)&n, ap, x, (const MKL_INT *)&incx);
     });
     return done;
 }
@@ -2268,18 +1930,12 @@ cl::sycl::event tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
 cl::sycl::event tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                      int64_t n, const double *ap, double *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char upper_lower_ = *fortran_char(upper_lower);
-        const char trans_       = *fortran_char(trans);
-        const char unit_diag_   = *fortran_char(unit_diag);
-        host_task<class mkl_kernel_dtpsv_usm>(cgh, [=]() {
-            ::dtpsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, ap, x, (const MKL_INT *)&incx);
-        });
+    const char upper_lower_ = *fortran_char(upper_lower);
+    const char trans_       = *fortran_char(trans);
+    const char unit_diag_   = *fortran_char(unit_diag);
+    auto done = submit_usm<class mkl_kernel_dtpsv_usm>(queue, n * n, dependencies, [=]() {
+        ::dtpsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
+                (const MKL_INT *)&n, ap, x, (const MKL_INT *)&incx);
     });
     return done;
 }
@@ -2287,18 +1943,12 @@ cl::sycl::event tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
 cl::sycl::event tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                      int64_t n, const std::complex<float> *ap, std::complex<float> *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char upper_lower_ = *fortran_char(upper_lower);
-        const char trans_       = *fortran_char(trans);
-        const char unit_diag_   = *fortran_char(unit_diag);
-        host_task<class mkl_kernel_ctpsv_usm>(cgh, [=]() {
-            ::ctpsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, ap, x, (const MKL_INT *)&incx);
-        });
+    const char upper_lower_ = *fortran_char(upper_lower);
+    const char trans_       = *fortran_char(trans);
+    const char unit_diag_   = *fortran_char(unit_diag);
+    auto done = submit_usm<class mkl_kernel_ctpsv_usm>(queue, n * n, dependencies, [=]() {
+        ::ctpsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
+                (const MKL_INT *)&n, ap, x, (const MKL_INT *)&incx);
     });
     return done;
 }
@@ -2306,18 +1956,12 @@ cl::sycl::event tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
 cl::sycl::event tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                      int64_t n, const std::complex<double> *ap, std::complex<double> *x,
                      int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char upper_lower_ = *fortran_char(upper_lower);
-        const char trans_       = *fortran_char(trans);
-        const char unit_diag_   = *fortran_char(unit_diag);
-        host_task<class mkl_kernel_ztpsv_usm>(cgh, [=]() {
-            ::ztpsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, ap, x, (const MKL_INT *)&incx);
-        });
+    const char upper_lower_ = *fortran_char(upper_lower);
+    const char trans_       = *fortran_char(trans);
+    const char unit_diag_   = *fortran_char(unit_diag);
+    auto done = submit_usm<class mkl_kernel_ztpsv_usm>(queue, n * n, dependencies, [=]() {
+        ::ztpsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
+                (const MKL_INT *)&n, ap, x, (const MKL_INT *)&incx);
     });
     return done;
 }
@@ -2325,18 +1969,12 @@ cl::sycl::event tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
 cl::sycl::event trmv(cl::sycl::queue &queue, uplo upper_lower, transpose transa, diag unit_diag,
                      int64_t n, const float *a, int64_t lda, float *b, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char upper_lower_ = *fortran_char(upper_lower);
-        const char transa_      = *fortran_char(transa);
-        const char unit_diag_   = *fortran_char(unit_diag);
-        host_task<class mkl_kernel_strmv_usm>(cgh, [=]() {
-            ::strmv((const char *)&upper_lower_, (const char *)&transa_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, a, (const MKL_INT *)&lda, b, (const MKL_INT *)&incx);
-        });
+    const char upper_lower_ = *fortran_char(upper_lower);
+    const char transa_      = *fortran_char(transa);
+    const char unit_diag_   = *fortran_char(unit_diag);
+    auto done = submit_usm<class mkl_kernel_strmv_usm>(queue, n * n, dependencies, [=]() {
+        ::strmv((const char *)&upper_lower_, (const char *)&transa_, (const char *)&unit_diag_,
+                (const MKL_INT *)&n, a, (const MKL_INT *)&lda, b, (const MKL_INT *)&incx);
     });
     return done;
 }
@@ -2344,18 +1982,12 @@ cl::sycl::event trmv(cl::sycl::queue &queue, uplo upper_lower, transpose transa,
 cl::sycl::event trmv(cl::sycl::queue &queue, uplo upper_lower, transpose transa, diag unit_diag,
                      int64_t n, const double *a, int64_t lda, double *b, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char upper_lower_ = *fortran_char(upper_lower);
-        const char transa_      = *fortran_char(transa);
-        const char unit_diag_   = *fortran_char(unit_diag);
-        host_task<class mkl_kernel_dtrmv_usm>(cgh, [=]() {
-            ::dtrmv((const char *)&upper_lower_, (const char *)&transa_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, a, (const MKL_INT *)&lda, b, (const MKL_INT *)&incx);
-        });
+    const char upper_lower_ = *fortran_char(upper_lower);
+    const char transa_      = *fortran_char(transa);
+    const char unit_diag_   = *fortran_char(unit_diag);
+    auto done = submit_usm<class mkl_kernel_dtrmv_usm>(queue, n * n, dependencies, [=]() {
+        ::dtrmv((const char *)&upper_lower_, (const char *)&transa_, (const char *)&unit_diag_,
+                (const MKL_INT *)&n, a, (const MKL_INT *)&lda, b, (const MKL_INT *)&incx);
     });
     return done;
 }
@@ -2363,18 +1995,12 @@ cl::sycl::event trmv(cl::sycl::queue &queue, uplo upper_lower, transpose transa,
 cl::sycl::event trmv(cl::sycl::queue &queue, uplo upper_lower, transpose transa, diag unit_diag,
                      int64_t n, const std::complex<float> *a, int64_t lda, std::complex<float> *b,
                      int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char upper_lower_ = *fortran_char(upper_lower);
-        const char transa_      = *fortran_char(transa);
-        const char unit_diag_   = *fortran_char(unit_diag);
-        host_task<class mkl_kernel_ctrmv_usm>(cgh, [=]() {
-            ::ctrmv((const char *)&upper_lower_, (const char *)&transa_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, a, (const MKL_INT *)&lda, b, (const MKL_INT *)&incx);
-        });
+    const char upper_lower_ = *fortran_char(upper_lower);
+    const char transa_      = *fortran_char(transa);
+    const char unit_diag_   = *fortran_char(unit_diag);
+    auto done = submit_usm<class mkl_kernel_ctrmv_usm>(queue, n * n, dependencies, [=]() {
+        ::ctrmv((const char *)&upper_lower_, (const char *)&transa_, (const char *)&unit_diag_,
+                (const MKL_INT *)&n, a, (const MKL_INT *)&lda, b, (const MKL_INT *)&incx);
     });
     return done;
 }
@@ -2382,18 +2008,12 @@ cl::sycl::event trmv(cl::sycl::queue &queue, uplo upper_lower, transpose transa,
 cl::sycl::event trmv(cl::sycl::queue &queue, uplo upper_lower, transpose transa, diag unit_diag,
                      int64_t n, const std::complex<double> *a, int64_t lda, std::complex<double> *b,
                      int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char upper_lower_ = *fortran_char(upper_lower);
-        const char transa_      = *fortran_char(transa);
-        const char unit_diag_   = *fortran_char(unit_diag);
-        host_task<class mkl_kernel_ztrmv_usm>(cgh, [=]() {
-            ::ztrmv((const char *)&upper_lower_, (const char *)&transa_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, a, (const MKL_INT *)&lda, b, (const MKL_INT *)&incx);
-        });
+    const char upper_lower_ = *fortran_char(upper_lower);
+    const char transa_      = *fortran_char(transa);
+    const char unit_diag_   = *fortran_char(unit_diag);
+    auto done = submit_usm<class mkl_kernel_ztrmv_usm>(queue, n * n, dependencies, [=]() {
+        ::ztrmv((const char *)&upper_lower_, (const char *)&transa_, (const char *)&unit_diag_,
+                (const MKL_INT *)&n, a, (const MKL_INT *)&lda, b, (const MKL_INT *)&incx);
     });
     return done;
 }
@@ -2401,18 +2021,12 @@ cl::sycl::event trmv(cl::sycl::queue &queue, uplo upper_lower, transpose transa,
 cl::sycl::event trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                      int64_t n, const float *a, int64_t lda, float *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char upper_lower_ = *fortran_char(upper_lower);
-        const char trans_       = *fortran_char(trans);
-        const char unit_diag_   = *fortran_char(unit_diag);
-        host_task<class mkl_kernel_strsv_usm>(cgh, [=]() {
-            ::strsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, a, (const MKL_INT *)&lda, x, (const MKL_INT *)&incx);
-        });
+    const char upper_lower_ = *fortran_char(upper_lower);
+    const char trans_       = *fortran_char(trans);
+    const char unit_diag_   = *fortran_char(unit_diag);
+    auto done = submit_usm<class mkl_kernel_strsv_usm>(queue, n * n, dependencies, [=]() {
+        ::strsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
+                (const MKL_INT *)&n, a, (const MKL_INT *)&lda, x, (const MKL_INT *)&incx);
     });
     return done;
 }
@@ -2420,18 +2034,12 @@ cl::sycl::event trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
 cl::sycl::event trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                      int64_t n, const double *a, int64_t lda, double *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char upper_lower_ = *fortran_char(upper_lower);
-        const char trans_       = *fortran_char(trans);
-        const char unit_diag_   = *fortran_char(unit_diag);
-        host_task<class mkl_kernel_dtrsv_usm>(cgh, [=]() {
-            ::dtrsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, a, (const MKL_INT *)&lda, x, (const MKL_INT *)&incx);
-        });
+    const char upper_lower_ = *fortran_char(upper_lower);
+    const char trans_       = *fortran_char(trans);
+    const char unit_diag_   = *fortran_char(unit_diag);
+    auto done = submit_usm<class mkl_kernel_dtrsv_usm>(queue, n * n, dependencies, [=]() {
+        ::dtrsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
+                (const MKL_INT *)&n, a, (const MKL_INT *)&lda, x, (const MKL_INT *)&incx);
     });
     return done;
 }
@@ -2439,18 +2047,12 @@ cl::sycl::event trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
 cl::sycl::event trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                      int64_t n, const std::complex<float> *a, int64_t lda, std::complex<float> *x,
                      int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char upper_lower_ = *fortran_char(upper_lower);
-        const char trans_       = *fortran_char(trans);
-        const char unit_diag_   = *fortran_char(unit_diag);
-        host_task<class mkl_kernel_ctrsv_usm>(cgh, [=]() {
-            ::ctrsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, a, (const MKL_INT *)&lda, x, (const MKL_INT *)&incx);
-        });
+    const char upper_lower_ = *fortran_char(upper_lower);
+    const char trans_       = *fortran_char(trans);
+    const char unit_diag_   = *fortran_char(unit_diag);
+    auto done = submit_usm<class mkl_kernel_ctrsv_usm>(queue, n * n, dependencies, [=]() {
+        ::ctrsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
+                (const MKL_INT *)&n, a, (const MKL_INT *)&lda, x, (const MKL_INT *)&incx);
     });
     return done;
 }
@@ -2458,18 +2060,12 @@ cl::sycl::event trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
 cl::sycl::event trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                      int64_t n, const std::complex<double> *a, int64_t lda, std::complex<double> *x,
                      int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        const char upper_lower_ = *fortran_char(upper_lower);
-        const char trans_       = *fortran_char(trans);
-        const char unit_diag_   = *fortran_char(unit_diag);
-        host_task<class mkl_kernel_ztrsv_usm>(cgh, [=]() {
-            ::ztrsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, a, (const MKL_INT *)&lda, x, (const MKL_INT *)&incx);
-        });
+    const char upper_lower_ = *fortran_char(upper_lower);
+    const char trans_       = *fortran_char(trans);
+    const char unit_diag_   = *fortran_char(unit_diag);
+    auto done = submit_usm<class mkl_kernel_ztrsv_usm>(queue, n * n, dependencies, [=]() {
+        ::ztrsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
+                (const MKL_INT *)&n, a, (const MKL_INT *)&lda, x, (const MKL_INT *)&incx);
     });
     return done;
 }
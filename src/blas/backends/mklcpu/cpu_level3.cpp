@@ -37,7 +37,7 @@ void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
         auto accessor_a    = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b    = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c    = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_sgemm>(cgh, [=]() {
+        host_task<class mkl_kernel_sgemm>(cgh, queue, [=]() {
             ::sgemm((const char *)&transa_, (const char *)&transb_, (const MKL_INT *)&m,
                     (const MKL_INT *)&n, (const MKL_INT *)&k, (const float *)&alpha,
                     accessor_a.get_pointer(), (const MKL_INT *)&lda, accessor_b.get_pointer(),
@@ -57,7 +57,7 @@ void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
         auto accessor_a    = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b    = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c    = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dgemm>(cgh, [=]() {
+        host_task<class mkl_kernel_dgemm>(cgh, queue, [=]() {
             ::dgemm((const char *)&transa_, (const char *)&transb_, (const MKL_INT *)&m,
                     (const MKL_INT *)&n, (const MKL_INT *)&k, (const double *)&alpha,
                     accessor_a.get_pointer(), (const MKL_INT *)&lda, accessor_b.get_pointer(),
@@ -79,7 +79,7 @@ void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_cgemm>(cgh, [=]() {
+        host_task<class mkl_kernel_cgemm>(cgh, queue, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_  = { beta_real, beta_imag };
             ::cgemm((const char *)&transa_, (const char *)&transb_, (const MKL_INT *)&m,
@@ -103,7 +103,7 @@ void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zgemm>(cgh, [=]() {
+        host_task<class mkl_kernel_zgemm>(cgh, queue, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_  = { beta_real, beta_imag };
             ::zgemm((const char *)&transa_, (const char *)&transb_, (const MKL_INT *)&m,
@@ -127,7 +127,7 @@ void hemm(cl::sycl::queue &queue, side left_right, uplo upper_lower, int64_t m,
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_chemm>(cgh, [=]() {
+        host_task<class mkl_kernel_chemm>(cgh, queue, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_  = { beta_real, beta_imag };
             ::chemm((const char *)&left_right_, (const char *)&upper_lower_, (const MKL_INT *)&m,
@@ -150,7 +150,7 @@ void hemm(cl::sycl::queue &queue, side left_right, uplo upper_lower, int64_t m,
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zhemm>(cgh, [=]() {
+        host_task<class mkl_kernel_zhemm>(cgh, queue, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_  = { beta_real, beta_imag };
             ::zhemm((const char *)&left_right_, (const char *)&upper_lower_, (const MKL_INT *)&m,
@@ -169,7 +169,7 @@ void herk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
         const char trans_       = *fortran_char(trans);
         auto accessor_a         = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c         = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_cherk>(cgh, [=]() {
+        host_task<class mkl_kernel_cherk>(cgh, queue, [=]() {
             ::cherk((const char *)&upper_lower_, (const char *)&trans_, (const MKL_INT *)&n,
                     (const MKL_INT *)&k, (const float *)&alpha, accessor_a.get_pointer(),
                     (const MKL_INT *)&lda, (const float *)&beta, accessor_c.get_pointer(),
@@ -186,7 +186,7 @@ void herk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
         const char trans_       = *fortran_char(trans);
         auto accessor_a         = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c         = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zherk>(cgh, [=]() {
+        host_task<class mkl_kernel_zherk>(cgh, queue, [=]() {
             ::zherk((const char *)&upper_lower_, (const char *)&trans_, (const MKL_INT *)&n,
                     (const MKL_INT *)&k, (const double *)&alpha, accessor_a.get_pointer(),
                     (const MKL_INT *)&lda, (const double *)&beta, accessor_c.get_pointer(),
@@ -206,7 +206,7 @@ void her2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_cher2k>(cgh, [=]() {
+        host_task<class mkl_kernel_cher2k>(cgh, queue, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             ::cher2k((const char *)&upper_lower_, (const char *)&trans_, (const MKL_INT *)&n,
                      (const MKL_INT *)&k, (const MKL_Complex8 *)&alpha_, accessor_a.get_pointer(),
@@ -227,7 +227,7 @@ void her2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zher2k>(cgh, [=]() {
+        host_task<class mkl_kernel_zher2k>(cgh, queue, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             ::zher2k((const char *)&upper_lower_, (const char *)&trans_, (const MKL_INT *)&n,
                      (const MKL_INT *)&k, (const MKL_Complex16 *)&alpha_, accessor_a.get_pointer(),
@@ -246,7 +246,7 @@ void symm(cl::sycl::queue &queue, side left_right, uplo upper_lower, int64_t m,
         auto accessor_a         = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b         = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c         = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_ssymm>(cgh, [=]() {
+        host_task<class mkl_kernel_ssymm>(cgh, queue, [=]() {
             ::ssymm((const char *)&left_right_, (const char *)&upper_lower_, (const MKL_INT *)&m,
                     (const MKL_INT *)&n, (const float *)&alpha, accessor_a.get_pointer(),
                     (const MKL_INT *)&lda, accessor_b.get_pointer(), (const MKL_INT *)&ldb,
@@ -264,7 +264,7 @@ void symm(cl::sycl::queue &queue, side left_right, uplo upper_lower, int64_t m,
         auto accessor_a         = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b         = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c         = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dsymm>(cgh, [=]() {
+        host_task<class mkl_kernel_dsymm>(cgh, queue, [=]() {
             ::dsymm((const char *)&left_right_, (const char *)&upper_lower_, (const MKL_INT *)&m,
                     (const MKL_INT *)&n, (const double *)&alpha, accessor_a.get_pointer(),
                     (const MKL_INT *)&lda, accessor_b.get_pointer(), (const MKL_INT *)&ldb,
@@ -285,7 +285,7 @@ void symm(cl::sycl::queue &queue, side left_right, uplo upper_lower, int64_t m,
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_csymm>(cgh, [=]() {
+        host_task<class mkl_kernel_csymm>(cgh, queue, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_  = { beta_real, beta_imag };
             ::csymm((const char *)&left_right_, (const char *)&upper_lower_, (const MKL_INT *)&m,
@@ -308,7 +308,7 @@ void symm(cl::sycl::queue &queue, side left_right, uplo upper_lower, int64_t m,
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zsymm>(cgh, [=]() {
+        host_task<class mkl_kernel_zsymm>(cgh, queue, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_  = { beta_real, beta_imag };
             ::zsymm((const char *)&left_right_, (const char *)&upper_lower_, (const MKL_INT *)&m,
@@ -327,7 +327,7 @@ void syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
         const char trans_       = *fortran_char(trans);
         auto accessor_a         = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c         = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_ssyrk>(cgh, [=]() {
+        host_task<class mkl_kernel_ssyrk>(cgh, queue, [=]() {
             ::ssyrk((const char *)&upper_lower_, (const char *)&trans_, (const MKL_INT *)&n,
                     (const MKL_INT *)&k, (const float *)&alpha, accessor_a.get_pointer(),
                     (const MKL_INT *)&lda, (const float *)&beta, accessor_c.get_pointer(),
@@ -344,7 +344,7 @@ void syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
         const char trans_       = *fortran_char(trans);
         auto accessor_a         = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c         = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dsyrk>(cgh, [=]() {
+        host_task<class mkl_kernel_dsyrk>(cgh, queue, [=]() {
             ::dsyrk((const char *)&upper_lower_, (const char *)&trans_, (const MKL_INT *)&n,
                     (const MKL_INT *)&k, (const double *)&alpha, accessor_a.get_pointer(),
                     (const MKL_INT *)&lda, (const double *)&beta, accessor_c.get_pointer(),
@@ -363,7 +363,7 @@ void syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
         float beta_real = beta.real(), beta_imag = beta.imag();
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_csyrk>(cgh, [=]() {
+        host_task<class mkl_kernel_csyrk>(cgh, queue, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_  = { beta_real, beta_imag };
             ::csyrk((const char *)&upper_lower_, (const char *)&trans_, (const MKL_INT *)&n,
@@ -384,7 +384,7 @@ void syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
         double beta_real = beta.real(), beta_imag = beta.imag();
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zsyrk>(cgh, [=]() {
+        host_task<class mkl_kernel_zsyrk>(cgh, queue, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_  = { beta_real, beta_imag };
             ::zsyrk((const char *)&upper_lower_, (const char *)&trans_, (const MKL_INT *)&n,
@@ -404,7 +404,7 @@ void syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
         auto accessor_a         = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b         = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c         = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_ssyr2k>(cgh, [=]() {
+        host_task<class mkl_kernel_ssyr2k>(cgh, queue, [=]() {
             ::ssyr2k((const char *)&upper_lower_, (const char *)&trans_, (const MKL_INT *)&n,
                      (const MKL_INT *)&k, (const float *)&alpha, accessor_a.get_pointer(),
                      (const MKL_INT *)&lda, accessor_b.get_pointer(), (const MKL_INT *)&ldb,
@@ -423,7 +423,7 @@ void syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
         auto accessor_a         = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b         = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c         = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dsyr2k>(cgh, [=]() {
+        host_task<class mkl_kernel_dsyr2k>(cgh, queue, [=]() {
             ::dsyr2k((const char *)&upper_lower_, (const char *)&trans_, (const MKL_INT *)&n,
                      (const MKL_INT *)&k, (const double *)&alpha, accessor_a.get_pointer(),
                      (const MKL_INT *)&lda, accessor_b.get_pointer(), (const MKL_INT *)&ldb,
@@ -444,7 +444,7 @@ void syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_csyr2k>(cgh, [=]() {
+        host_task<class mkl_kernel_csyr2k>(cgh, queue, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_  = { beta_real, beta_imag };
             ::csyr2k((const char *)&upper_lower_, (const char *)&trans_, (const MKL_INT *)&n,
@@ -467,7 +467,7 @@ void syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zsyr2k>(cgh, [=]() {
+        host_task<class mkl_kernel_zsyr2k>(cgh, queue, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_  = { beta_real, beta_imag };
             ::zsyr2k((const char *)&upper_lower_, (const char *)&trans_, (const MKL_INT *)&n,
@@ -489,7 +489,7 @@ void trmm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose t
         const char unit_diag_   = *fortran_char(unit_diag);
         auto accessor_a         = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b         = b.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_strmm>(cgh, [=]() {
+        host_task<class mkl_kernel_strmm>(cgh, queue, [=]() {
             ::strmm((const char *)&left_right_, (const char *)&upper_lower_, (const char *)&transa_,
                     (const char *)&unit_diag_, (const MKL_INT *)&m, (const MKL_INT *)&n,
                     (const float *)&alpha, accessor_a.get_pointer(), (const MKL_INT *)&lda,
@@ -508,7 +508,7 @@ void trmm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose t
         const char unit_diag_   = *fortran_char(unit_diag);
         auto accessor_a         = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b         = b.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dtrmm>(cgh, [=]() {
+        host_task<class mkl_kernel_dtrmm>(cgh, queue, [=]() {
             ::dtrmm((const char *)&left_right_, (const char *)&upper_lower_, (const char *)&transa_,
                     (const char *)&unit_diag_, (const MKL_INT *)&m, (const MKL_INT *)&n,
                     (const double *)&alpha, accessor_a.get_pointer(), (const MKL_INT *)&lda,
@@ -529,7 +529,7 @@ void trmm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose t
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_ctrmm>(cgh, [=]() {
+        host_task<class mkl_kernel_ctrmm>(cgh, queue, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             ::ctrmm((const char *)&left_right_, (const char *)&upper_lower_, (const char *)&transa_,
                     (const char *)&unit_diag_, (const MKL_INT *)&m, (const MKL_INT *)&n,
@@ -551,7 +551,7 @@ void trmm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose t
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_ztrmm>(cgh, [=]() {
+        host_task<class mkl_kernel_ztrmm>(cgh, queue, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             ::ztrmm((const char *)&left_right_, (const char *)&upper_lower_, (const char *)&transa_,
                     (const char *)&unit_diag_, (const MKL_INT *)&m, (const MKL_INT *)&n,
@@ -571,7 +571,7 @@ void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose t
         const char unit_diag_   = *fortran_char(unit_diag);
         auto accessor_a         = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b         = b.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_strsm>(cgh, [=]() {
+        host_task<class mkl_kernel_strsm>(cgh, queue, [=]() {
             ::strsm((const char *)&left_right_, (const char *)&upper_lower_, (const char *)&transa_,
                     (const char *)&unit_diag_, (const MKL_INT *)&m, (const MKL_INT *)&n,
                     (const float *)&alpha, accessor_a.get_pointer(), (const MKL_INT *)&lda,
@@ -590,7 +590,7 @@ void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose t
         const char unit_diag_   = *fortran_char(unit_diag);
         auto accessor_a         = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b         = b.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dtrsm>(cgh, [=]() {
+        host_task<class mkl_kernel_dtrsm>(cgh, queue, [=]() {
             ::dtrsm((const char *)&left_right_, (const char *)&upper_lower_, (const char *)&transa_,
                     (const char *)&unit_diag_, (const MKL_INT *)&m, (const MKL_INT *)&n,
                     (const double *)&alpha, accessor_a.get_pointer(), (const MKL_INT *)&lda,
@@ -611,7 +611,7 @@ void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose t
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_ctrsm>(cgh, [=]() {
+        host_task<class mkl_kernel_ctrsm>(cgh, queue, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             ::ctrsm((const char *)&left_right_, (const char *)&upper_lower_, (const char *)&transa_,
                     (const char *)&unit_diag_, (const MKL_INT *)&m, (const MKL_INT *)&n,
@@ -633,7 +633,7 @@ void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose t
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_ztrsm>(cgh, [=]() {
+        host_task<class mkl_kernel_ztrsm>(cgh, queue, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             ::ztrsm((const char *)&left_right_, (const char *)&upper_lower_, (const char *)&transa_,
                     (const char *)&unit_diag_, (const MKL_INT *)&m, (const MKL_INT *)&n,
@@ -656,7 +656,7 @@ cl::sycl::event gemm(cl::sycl::queue &queue, transpose transa, transpose transb,
         }
         const char transa_ = *fortran_char(transa);
         const char transb_ = *fortran_char(transb);
-        host_task<class mkl_kernel_sgemm_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_sgemm_usm>(cgh, queue, [=]() {
             ::sgemm((const char *)&transa_, (const char *)&transb_, (const MKL_INT *)&m,
                     (const MKL_INT *)&n, (const MKL_INT *)&k, (const float *)&alpha, a,
                     (const MKL_INT *)&lda, b, (const MKL_INT *)&ldb, (const float *)&beta, c,
@@ -677,7 +677,7 @@ cl::sycl::event gemm(cl::sycl::queue &queue, transpose transa, transpose transb,
         }
         const char transa_ = *fortran_char(transa);
         const char transb_ = *fortran_char(transb);
-        host_task<class mkl_kernel_dgemm_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_dgemm_usm>(cgh, queue, [=]() {
             ::dgemm((const char *)&transa_, (const char *)&transb_, (const MKL_INT *)&m,
                     (const MKL_INT *)&n, (const MKL_INT *)&k, (const double *)&alpha, a,
                     (const MKL_INT *)&lda, b, (const MKL_INT *)&ldb, (const double *)&beta, c,
@@ -701,7 +701,7 @@ cl::sycl::event gemm(cl::sycl::queue &queue, transpose transa, transpose transb,
         const char transb_ = *fortran_char(transb);
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
         float beta_real = beta.real(), beta_imag = beta.imag();
-        host_task<class mkl_kernel_cgemm_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_cgemm_usm>(cgh, queue, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_  = { beta_real, beta_imag };
             ::cgemm((const char *)&transa_, (const char *)&transb_, (const MKL_INT *)&m,
@@ -727,7 +727,7 @@ cl::sycl::event gemm(cl::sycl::queue &queue, transpose transa, transpose transb,
         const char transb_ = *fortran_char(transb);
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
         double beta_real = beta.real(), beta_imag = beta.imag();
-        host_task<class mkl_kernel_zgemm_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_zgemm_usm>(cgh, queue, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_  = { beta_real, beta_imag };
             ::zgemm((const char *)&transa_, (const char *)&transb_, (const MKL_INT *)&m,
@@ -753,7 +753,7 @@ cl::sycl::event hemm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
         const char upper_lower_ = *fortran_char(upper_lower);
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
         float beta_real = beta.real(), beta_imag = beta.imag();
-        host_task<class mkl_kernel_chemm_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_chemm_usm>(cgh, queue, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_  = { beta_real, beta_imag };
             ::chemm((const char *)&left_right_, (const char *)&upper_lower_, (const MKL_INT *)&m,
@@ -778,7 +778,7 @@ cl::sycl::event hemm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
         const char upper_lower_ = *fortran_char(upper_lower);
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
         double beta_real = beta.real(), beta_imag = beta.imag();
-        host_task<class mkl_kernel_zhemm_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_zhemm_usm>(cgh, queue, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_  = { beta_real, beta_imag };
             ::zhemm((const char *)&left_right_, (const char *)&upper_lower_, (const MKL_INT *)&m,
@@ -801,7 +801,7 @@ cl::sycl::event herk(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         }
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_       = *fortran_char(trans);
-        host_task<class mkl_kernel_cherk_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_cherk_usm>(cgh, queue, [=]() {
             ::cherk((const char *)&upper_lower_, (const char *)&trans_, (const MKL_INT *)&n,
                     (const MKL_INT *)&k, (const float *)&alpha, a, (const MKL_INT *)&lda,
                     (const float *)&beta, c, (const MKL_INT *)&ldc);
@@ -821,7 +821,7 @@ cl::sycl::event herk(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         }
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_       = *fortran_char(trans);
-        host_task<class mkl_kernel_zherk_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_zherk_usm>(cgh, queue, [=]() {
             ::zherk((const char *)&upper_lower_, (const char *)&trans_, (const MKL_INT *)&n,
                     (const MKL_INT *)&k, (const double *)&alpha, a, (const MKL_INT *)&lda,
                     (const double *)&beta, c, (const MKL_INT *)&ldc);
@@ -843,7 +843,7 @@ cl::sycl::event her2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_       = *fortran_char(trans);
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
-        host_task<class mkl_kernel_cher2k_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_cher2k_usm>(cgh, queue, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             ::cher2k((const char *)&upper_lower_, (const char *)&trans_, (const MKL_INT *)&n,
                      (const MKL_INT *)&k, (const MKL_Complex8 *)&alpha_, a, (const MKL_INT *)&lda,
@@ -866,7 +866,7 @@ cl::sycl::event her2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_       = *fortran_char(trans);
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
-        host_task<class mkl_kernel_zher2k_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_zher2k_usm>(cgh, queue, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             ::zher2k((const char *)&upper_lower_, (const char *)&trans_, (const MKL_INT *)&n,
                      (const MKL_INT *)&k, (const MKL_Complex16 *)&alpha_, a, (const MKL_INT *)&lda,
@@ -887,7 +887,7 @@ cl::sycl::event symm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
         }
         const char left_right_  = *fortran_char(left_right);
         const char upper_lower_ = *fortran_char(upper_lower);
-        host_task<class mkl_kernel_ssymm_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_ssymm_usm>(cgh, queue, [=]() {
             ::ssymm((const char *)&left_right_, (const char *)&upper_lower_, (const MKL_INT *)&m,
                     (const MKL_INT *)&n, (const float *)&alpha, a, (const MKL_INT *)&lda, b,
                     (const MKL_INT *)&ldb, (const float *)&beta, c, (const MKL_INT *)&ldc);
@@ -907,7 +907,7 @@ cl::sycl::event symm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
         }
         const char left_right_  = *fortran_char(left_right);
         const char upper_lower_ = *fortran_char(upper_lower);
-        host_task<class mkl_kernel_dsymm_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_dsymm_usm>(cgh, queue, [=]() {
             ::dsymm((const char *)&left_right_, (const char *)&upper_lower_, (const MKL_INT *)&m,
                     (const MKL_INT *)&n, (const double *)&alpha, a, (const MKL_INT *)&lda, b,
                     (const MKL_INT *)&ldb, (const double *)&beta, c, (const MKL_INT *)&ldc);
@@ -930,7 +930,7 @@ cl::sycl::event symm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
         const char upper_lower_ = *fortran_char(upper_lower);
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
         float beta_real = beta.real(), beta_imag = beta.imag();
-        host_task<class mkl_kernel_csymm_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_csymm_usm>(cgh, queue, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_  = { beta_real, beta_imag };
             ::csymm((const char *)&left_right_, (const char *)&upper_lower_, (const MKL_INT *)&m,
@@ -955,7 +955,7 @@ cl::sycl::event symm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
         const char upper_lower_ = *fortran_char(upper_lower);
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
         double beta_real = beta.real(), beta_imag = beta.imag();
-        host_task<class mkl_kernel_zsymm_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_zsymm_usm>(cgh, queue, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_  = { beta_real, beta_imag };
             ::zsymm((const char *)&left_right_, (const char *)&upper_lower_, (const MKL_INT *)&m,
@@ -977,7 +977,7 @@ cl::sycl::event syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         }
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_       = *fortran_char(trans);
-        host_task<class mkl_kernel_ssyrk_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_ssyrk_usm>(cgh, queue, [=]() {
             ::ssyrk((const char *)&upper_lower_, (const char *)&trans_, (const MKL_INT *)&n,
                     (const MKL_INT *)&k, (const float *)&alpha, a, (const MKL_INT *)&lda,
                     (const float *)&beta, c, (const MKL_INT *)&ldc);
@@ -996,7 +996,7 @@ cl::sycl::event syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         }
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_       = *fortran_char(trans);
-        host_task<class mkl_kernel_dsyrk_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_dsyrk_usm>(cgh, queue, [=]() {
             ::dsyrk((const char *)&upper_lower_, (const char *)&trans_, (const MKL_INT *)&n,
                     (const MKL_INT *)&k, (const double *)&alpha, a, (const MKL_INT *)&lda,
                     (const double *)&beta, c, (const MKL_INT *)&ldc);
@@ -1018,7 +1018,7 @@ cl::sycl::event syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         const char trans_       = *fortran_char(trans);
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
         float beta_real = beta.real(), beta_imag = beta.imag();
-        host_task<class mkl_kernel_csyrk_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_csyrk_usm>(cgh, queue, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_  = { beta_real, beta_imag };
             ::csyrk((const char *)&upper_lower_, (const char *)&trans_, (const MKL_INT *)&n,
@@ -1042,7 +1042,7 @@ cl::sycl::event syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         const char trans_       = *fortran_char(trans);
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
         double beta_real = beta.real(), beta_imag = beta.imag();
-        host_task<class mkl_kernel_zsyrk_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_zsyrk_usm>(cgh, queue, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_  = { beta_real, beta_imag };
             ::zsyrk((const char *)&upper_lower_, (const char *)&trans_, (const MKL_INT *)&n,
@@ -1064,7 +1064,7 @@ cl::sycl::event syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         }
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_       = *fortran_char(trans);
-        host_task<class mkl_kernel_ssyr2k_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_ssyr2k_usm>(cgh, queue, [=]() {
             ::ssyr2k((const char *)&upper_lower_, (const char *)&trans_, (const MKL_INT *)&n,
                      (const MKL_INT *)&k, (const float *)&alpha, a, (const MKL_INT *)&lda, b,
                      (const MKL_INT *)&ldb, (const float *)&beta, c, (const MKL_INT *)&ldc);
@@ -1084,7 +1084,7 @@ cl::sycl::event syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         }
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_       = *fortran_char(trans);
-        host_task<class mkl_kernel_dsyr2k_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_dsyr2k_usm>(cgh, queue, [=]() {
             ::dsyr2k((const char *)&upper_lower_, (const char *)&trans_, (const MKL_INT *)&n,
                      (const MKL_INT *)&k, (const double *)&alpha, a, (const MKL_INT *)&lda, b,
                      (const MKL_INT *)&ldb, (const double *)&beta, c, (const MKL_INT *)&ldc);
@@ -1107,7 +1107,7 @@ cl::sycl::event syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         const char trans_       = *fortran_char(trans);
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
         float beta_real = beta.real(), beta_imag = beta.imag();
-        host_task<class mkl_kernel_csyr2k_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_csyr2k_usm>(cgh, queue, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_  = { beta_real, beta_imag };
             ::csyr2k((const char *)&upper_lower_, (const char *)&trans_, (const MKL_INT *)&n,
@@ -1133,7 +1133,7 @@ cl::sycl::event syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         const char trans_       = *fortran_char(trans);
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
         double beta_real = beta.real(), beta_imag = beta.imag();
-        host_task<class mkl_kernel_zsyr2k_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_zsyr2k_usm>(cgh, queue, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_  = { beta_real, beta_imag };
             ::zsyr2k((const char *)&upper_lower_, (const char *)&trans_, (const MKL_INT *)&n,
@@ -1158,7 +1158,7 @@ cl::sycl::event trmm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
         const char upper_lower_ = *fortran_char(upper_lower);
         const char transa_      = *fortran_char(transa);
         const char unit_diag_   = *fortran_char(unit_diag);
-        host_task<class mkl_kernel_strmm_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_strmm_usm>(cgh, queue, [=]() {
             ::strmm((const char *)&left_right_, (const char *)&upper_lower_, (const char *)&transa_,
                     (const char *)&unit_diag_, (const MKL_INT *)&m, (const MKL_INT *)&n,
                     (const float *)&alpha, a, (const MKL_INT *)&lda, b, (const MKL_INT *)&ldb);
@@ -1180,7 +1180,7 @@ cl::sycl::event trmm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
         const char upper_lower_ = *fortran_char(upper_lower);
         const char transa_      = *fortran_char(transa);
         const char unit_diag_   = *fortran_char(unit_diag);
-        host_task<class mkl_kernel_dtrmm_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_dtrmm_usm>(cgh, queue, [=]() {
             ::dtrmm((const char *)&left_right_, (const char *)&upper_lower_, (const char *)&transa_,
                     (const char *)&unit_diag_, (const MKL_INT *)&m, (const MKL_INT *)&n,
                     (const double *)&alpha, a, (const MKL_INT *)&lda, b, (const MKL_INT *)&ldb);
@@ -1203,7 +1203,7 @@ cl::sycl::event trmm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
         const char transa_      = *fortran_char(transa);
         const char unit_diag_   = *fortran_char(unit_diag);
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
-        host_task<class mkl_kernel_ctrmm_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_ctrmm_usm>(cgh, queue, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             ::ctrmm((const char *)&left_right_, (const char *)&upper_lower_, (const char *)&transa_,
                     (const char *)&unit_diag_, (const MKL_INT *)&m, (const MKL_INT *)&n,
@@ -1228,7 +1228,7 @@ cl::sycl::event trmm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
         const char transa_      = *fortran_char(transa);
         const char unit_diag_   = *fortran_char(unit_diag);
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
-        host_task<class mkl_kernel_ztrmm_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_ztrmm_usm>(cgh, queue, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             ::ztrmm((const char *)&left_right_, (const char *)&upper_lower_, (const char *)&transa_,
                     (const char *)&unit_diag_, (const MKL_INT *)&m, (const MKL_INT *)&n,
@@ -1252,7 +1252,7 @@ cl::sycl::event trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
         const char upper_lower_ = *fortran_char(upper_lower);
         const char transa_      = *fortran_char(transa);
         const char unit_diag_   = *fortran_char(unit_diag);
-        host_task<class mkl_kernel_strsm_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_strsm_usm>(cgh, queue, [=]() {
             ::strsm((const char *)&left_right_, (const char *)&upper_lower_, (const char *)&transa_,
                     (const char *)&unit_diag_, (const MKL_INT *)&m, (const MKL_INT *)&n,
                     (const float *)&alpha, a, (const MKL_INT *)&lda, b, (const MKL_INT *)&ldb);
@@ -1274,7 +1274,7 @@ cl::sycl::event trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
         const char upper_lower_ = *fortran_char(upper_lower);
         const char transa_      = *fortran_char(transa);
         const char unit_diag_   = *fortran_char(unit_diag);
-        host_task<class mkl_kernel_dtrsm_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_dtrsm_usm>(cgh, queue, [=]() {
             ::dtrsm((const char *)&left_right_, (const char *)&upper_lower_, (const char *)&transa_,
                     (const char *)&unit_diag_, (const MKL_INT *)&m, (const MKL_INT *)&n,
                     (const double *)&alpha, a, (const MKL_INT *)&lda, b, (const MKL_INT *)&ldb);
@@ -1297,7 +1297,7 @@ cl::sycl::event trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
         const char transa_      = *fortran_char(transa);
         const char unit_diag_   = *fortran_char(unit_diag);
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
-        host_task<class mkl_kernel_ctrsm_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_ctrsm_usm>(cgh, queue, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             ::ctrsm((const char *)&left_right_, (const char *)&upper_lower_, (const char *)&transa_,
                     (const char *)&unit_diag_, (const MKL_INT *)&m, (const MKL_INT *)&n,
@@ -1322,7 +1322,7 @@ cl::sycl::event trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
         const char transa_      = *fortran_char(transa);
         const char unit_diag_   = *fortran_char(unit_diag);
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
-        host_task<class mkl_kernel_ztrsm_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_ztrsm_usm>(cgh, queue, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             ::ztrsm((const char *)&left_right_, (const char *)&upper_lower_, (const char *)&transa_,
                     (const char *)&unit_diag_, (const MKL_INT *)&m, (const MKL_INT *)&n,
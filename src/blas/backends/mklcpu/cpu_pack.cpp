@@ -0,0 +1,217 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <CL/sycl.hpp>
+
+#include "cpu_common.hpp"
+#include "onemkl/blas/detail/mklcpu/onemkl_blas_mklcpu.hpp"
+
+namespace onemkl {
+namespace mklcpu {
+
+// ?gemm_pack and ?gemm_compute by data type. The packed operand is passed to
+//  ?gemm_compute with the 'P' transpose flag, its leading dimension is ignored.
+static inline void gemm_pack_mkl(const char *which, const char *trans, int64_t m, int64_t n,
+                                 int64_t k, float alpha, const float *src, int64_t ld, float *dst) {
+    ::sgemm_pack(which, trans, (const MKL_INT *)&m, (const MKL_INT *)&n, (const MKL_INT *)&k,
+                 &alpha, src, (const MKL_INT *)&ld, dst);
+}
+
+static inline void gemm_pack_mkl(const char *which, const char *trans, int64_t m, int64_t n,
+                                 int64_t k, double alpha, const double *src, int64_t ld,
+                                 double *dst) {
+    ::dgemm_pack(which, trans, (const MKL_INT *)&m, (const MKL_INT *)&n, (const MKL_INT *)&k,
+                 &alpha, src, (const MKL_INT *)&ld, dst);
+}
+
+static inline void gemm_compute_mkl(const char *transa, const char *transb, int64_t m, int64_t n,
+                                    int64_t k, const float *a, int64_t lda, const float *b,
+                                    int64_t ldb, float beta, float *c, int64_t ldc) {
+    ::sgemm_compute(transa, transb, (const MKL_INT *)&m, (const MKL_INT *)&n, (const MKL_INT *)&k,
+                    a, (const MKL_INT *)&lda, b, (const MKL_INT *)&ldb, &beta, c,
+                    (const MKL_INT *)&ldc);
+}
+
+static inline void gemm_compute_mkl(const char *transa, const char *transb, int64_t m, int64_t n,
+                                    int64_t k, const double *a, int64_t lda, const double *b,
+                                    int64_t ldb, double beta, double *c, int64_t ldc) {
+    ::dgemm_compute(transa, transb, (const MKL_INT *)&m, (const MKL_INT *)&n, (const MKL_INT *)&k,
+                    a, (const MKL_INT *)&lda, b, (const MKL_INT *)&ldb, &beta, c,
+                    (const MKL_INT *)&ldc);
+}
+
+// C = op(A) * op(B) + beta * C with A or B packed, x being the other operand.
+template <typename T>
+static inline void gemm_compute_packed(pack_matrix which, char trans, int64_t m, int64_t n,
+                                       int64_t k, const T *packed, const T *x, int64_t ldx, T beta,
+                                       T *c, int64_t ldc) {
+    if (which == pack_matrix::a)
+        gemm_compute_mkl("P", &trans, m, n, k, packed, m, x, ldx, beta, c, ldc);
+    else
+        gemm_compute_mkl(&trans, "P", m, n, k, x, ldx, packed, k, beta, c, ldc);
+}
+
+template <typename K, typename T>
+static cl::sycl::event gemm_pack_buffer(cl::sycl::queue &queue, pack_matrix which,
+                                        transpose trans, int64_t m, int64_t n, int64_t k, T alpha,
+                                        cl::sycl::buffer<T, 1> &src, int64_t ld, T *dst) {
+    return queue.submit([&](cl::sycl::handler &cgh) {
+        const char which_ = *fortran_char(which);
+        const char trans_ = *fortran_char(trans);
+        auto accessor_src = src.template get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<K>(cgh, queue, [=]() {
+            gemm_pack_mkl(&which_, &trans_, m, n, k, alpha, accessor_src.get_pointer(), ld, dst);
+        });
+    });
+}
+
+template <typename K, typename T>
+static cl::sycl::event gemm_pack_usm(cl::sycl::queue &queue, pack_matrix which, transpose trans,
+                                     int64_t m, int64_t n, int64_t k, T alpha, const T *src,
+                                     int64_t ld, T *dst,
+                                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    return queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        const char which_ = *fortran_char(which);
+        const char trans_ = *fortran_char(trans);
+        host_task<K>(cgh, queue, [=]() {
+            gemm_pack_mkl(&which_, &trans_, m, n, k, alpha, src, ld, dst);
+        });
+    });
+}
+
+template <typename K, typename T>
+static cl::sycl::event gemm_compute_buffer(
+    cl::sycl::queue &queue, pack_matrix which, transpose trans, int64_t m, int64_t n, int64_t k,
+    const T *packed, cl::sycl::buffer<T, 1> &x, int64_t ldx, T beta, cl::sycl::buffer<T, 1> &c,
+    int64_t ldc, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    return queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        const char trans_ = *fortran_char(trans);
+        auto accessor_x   = x.template get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_c   = c.template get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<K>(cgh, queue, [=]() {
+            gemm_compute_packed(which, trans_, m, n, k, packed, accessor_x.get_pointer(), ldx,
+                                beta, accessor_c.get_pointer(), ldc);
+        });
+    });
+}
+
+template <typename K, typename T>
+static cl::sycl::event gemm_compute_usm(
+    cl::sycl::queue &queue, pack_matrix which, transpose trans, int64_t m, int64_t n, int64_t k,
+    const T *packed, const T *x, int64_t ldx, T beta, T *c, int64_t ldc,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    return queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        const char trans_ = *fortran_char(trans);
+        host_task<K>(cgh, queue, [=]() {
+            gemm_compute_packed(which, trans_, m, n, k, packed, x, ldx, beta, c, ldc);
+        });
+    });
+}
+
+// The packed format depends on the instruction set MKL dispatches to, so the
+//  size is only known at run time.
+int64_t sgemm_pack_get_size(cl::sycl::queue &queue, pack_matrix which, int64_t m, int64_t n,
+                            int64_t k) {
+    return ::sgemm_pack_get_size(fortran_char(which), (const MKL_INT *)&m, (const MKL_INT *)&n,
+                                 (const MKL_INT *)&k);
+}
+
+cl::sycl::event gemm_pack(cl::sycl::queue &queue, pack_matrix which, transpose trans, int64_t m,
+                          int64_t n, int64_t k, float alpha, cl::sycl::buffer<float, 1> &src,
+                          int64_t ld, float *dst) {
+    return gemm_pack_buffer<class mkl_kernel_sgemm_pack>(queue, which, trans, m, n, k, alpha, src,
+                                                         ld, dst);
+}
+
+cl::sycl::event gemm_pack(cl::sycl::queue &queue, pack_matrix which, transpose trans, int64_t m,
+                          int64_t n, int64_t k, float alpha, const float *src, int64_t ld,
+                          float *dst, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    return gemm_pack_usm<class mkl_kernel_sgemm_pack_usm>(queue, which, trans, m, n, k, alpha, src,
+                                                          ld, dst, dependencies);
+}
+
+cl::sycl::event gemm_compute(cl::sycl::queue &queue, pack_matrix which, transpose trans, int64_t m,
+                             int64_t n, int64_t k, const float *packed,
+                             cl::sycl::buffer<float, 1> &x, int64_t ldx, float beta,
+                             cl::sycl::buffer<float, 1> &c, int64_t ldc,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    return gemm_compute_buffer<class mkl_kernel_sgemm_compute>(
+        queue, which, trans, m, n, k, packed, x, ldx, beta, c, ldc, dependencies);
+}
+
+cl::sycl::event gemm_compute(cl::sycl::queue &queue, pack_matrix which, transpose trans, int64_t m,
+                             int64_t n, int64_t k, const float *packed, const float *x,
+                             int64_t ldx, float beta, float *c, int64_t ldc,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    return gemm_compute_usm<class mkl_kernel_sgemm_compute_usm>(
+        queue, which, trans, m, n, k, packed, x, ldx, beta, c, ldc, dependencies);
+}
+
+int64_t dgemm_pack_get_size(cl::sycl::queue &queue, pack_matrix which, int64_t m, int64_t n,
+                            int64_t k) {
+    return ::dgemm_pack_get_size(fortran_char(which), (const MKL_INT *)&m, (const MKL_INT *)&n,
+                                 (const MKL_INT *)&k);
+}
+
+cl::sycl::event gemm_pack(cl::sycl::queue &queue, pack_matrix which, transpose trans, int64_t m,
+                          int64_t n, int64_t k, double alpha, cl::sycl::buffer<double, 1> &src,
+                          int64_t ld, double *dst) {
+    return gemm_pack_buffer<class mkl_kernel_dgemm_pack>(queue, which, trans, m, n, k, alpha, src,
+                                                         ld, dst);
+}
+
+cl::sycl::event gemm_pack(cl::sycl::queue &queue, pack_matrix which, transpose trans, int64_t m,
+                          int64_t n, int64_t k, double alpha, const double *src, int64_t ld,
+                          double *dst,
+                          const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    return gemm_pack_usm<class mkl_kernel_dgemm_pack_usm>(queue, which, trans, m, n, k, alpha, src,
+                                                          ld, dst, dependencies);
+}
+
+cl::sycl::event gemm_compute(cl::sycl::queue &queue, pack_matrix which, transpose trans, int64_t m,
+                             int64_t n, int64_t k, const double *packed,
+                             cl::sycl::buffer<double, 1> &x, int64_t ldx, double beta,
+                             cl::sycl::buffer<double, 1> &c, int64_t ldc,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    return gemm_compute_buffer<class mkl_kernel_dgemm_compute>(
+        queue, which, trans, m, n, k, packed, x, ldx, beta, c, ldc, dependencies);
+}
+
+cl::sycl::event gemm_compute(cl::sycl::queue &queue, pack_matrix which, transpose trans, int64_t m,
+                             int64_t n, int64_t k, const double *packed, const double *x,
+                             int64_t ldx, double beta, double *c, int64_t ldc,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    return gemm_compute_usm<class mkl_kernel_dgemm_compute_usm>(
+        queue, which, trans, m, n, k, packed, x, ldx, beta, c, ldc, dependencies);
+}
+
+} // namespace mklcpu
+} // namespace onemkl
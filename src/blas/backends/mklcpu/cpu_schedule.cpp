@@ -0,0 +1,74 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+
+#include <cstdio>
+#include <cstdlib>
+
+#include "cpu_schedule.hpp"
+
+namespace onemkl {
+namespace mklcpu {
+
+static schedule_counters counters;
+
+schedule_counters &schedule_usage() {
+    return counters;
+}
+
+void schedule_record(int64_t threaded, int64_t parallel, int64_t workers, const int64_t *busy_ns,
+                     int64_t makespan_ns) {
+    counters.batches.fetch_add(1, std::memory_order_relaxed);
+    counters.threaded_problems.fetch_add(threaded, std::memory_order_relaxed);
+    counters.parallel_problems.fetch_add(parallel, std::memory_order_relaxed);
+    if (parallel <= 0 || makespan_ns <= 0)
+        return;
+
+    std::uint64_t busy = 0, capacity = std::uint64_t(workers) * makespan_ns;
+    for (int64_t t = 0; t < workers; t++)
+        busy += std::min<std::uint64_t>(busy_ns[t], makespan_ns);
+    counters.busy_ns.fetch_add(busy, std::memory_order_relaxed);
+    counters.capacity_ns.fetch_add(capacity, std::memory_order_relaxed);
+
+    std::uint64_t idle  = (capacity - busy) * 1000000 / capacity;
+    std::uint64_t worst = counters.worst_idle_ppm.load(std::memory_order_relaxed);
+    while (idle > worst && !counters.worst_idle_ppm.compare_exchange_weak(worst, idle))
+        ;
+}
+
+// With ONEMKL_MKLCPU_BATCH_STATS set, print the counters at exit.
+static struct schedule_report {
+    ~schedule_report() {
+        if (!std::getenv("ONEMKL_MKLCPU_BATCH_STATS"))
+            return;
+        std::uint64_t busy = counters.busy_ns.load(), capacity = counters.capacity_ns.load();
+        std::fprintf(stderr,
+                     "mklcpu gemm_batch: %llu batches, %llu problems threaded, %llu in parallel\n",
+                     (unsigned long long)counters.batches.load(),
+                     (unsigned long long)counters.threaded_problems.load(),
+                     (unsigned long long)counters.parallel_problems.load());
+        if (capacity > 0)
+            std::fprintf(stderr, "  load balance %.1f%% overall, %.1f%% worst batch\n",
+                         100.0 * busy / capacity,
+                         100.0 - counters.worst_idle_ppm.load() / 10000.0);
+    }
+} report;
+
+} // namespace mklcpu
+} // namespace onemkl
@@ -0,0 +1,154 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+
+#ifndef _MKL_CPU_SCHEDULE_HPP_
+#define _MKL_CPU_SCHEDULE_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include "cpu_common.hpp"
+#include "cpu_scratch.hpp"
+
+namespace onemkl {
+namespace mklcpu {
+
+// Counters of the batches run by schedule_batch(). Busy time is the time
+//  from the start of the parallel phase until each thread ran out of
+//  problems, capacity the length of that phase times the number of threads.
+//  busy / capacity is the load balance achieved, 1 when no thread waited for
+//  the others at the end of the phase.
+struct schedule_counters {
+    std::atomic<std::uint64_t> batches;
+    std::atomic<std::uint64_t> threaded_problems;
+    std::atomic<std::uint64_t> parallel_problems;
+    std::atomic<std::uint64_t> busy_ns;
+    std::atomic<std::uint64_t> capacity_ns;
+    std::atomic<std::uint64_t> worst_idle_ppm;
+};
+
+schedule_counters &schedule_usage();
+void schedule_record(int64_t threaded, int64_t parallel, int64_t workers, const int64_t *busy_ns,
+                     int64_t makespan_ns);
+
+static inline int64_t elapsed_ns(std::chrono::steady_clock::time_point since) {
+    auto elapsed = std::chrono::steady_clock::now() - since;
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+}
+
+// Run a group batch through run(g, i), for problem i of the batch (numbered
+//  across groups) in group g, where each problem of group g costs work(g).
+//  Problems are taken longest first. While one problem is at least a
+//  thread's share of the work left, it runs alone, threaded inside MKL. The
+//  others run one per thread with sequential MKL, each thread taking the
+//  largest problem left whenever it is done with its previous one. Returns
+//  false without running anything when there is a single thread or no
+//  scratch memory; callers then hand the batch to MKL.
+template <typename W, typename R>
+static bool schedule_batch(int64_t group_count, const int64_t *group_size, const W &work,
+                           const R &run) {
+    int64_t workers = std::min<int64_t>(max_concurrency(), mkl_get_max_threads());
+    if (workers <= 1 || group_count <= 0)
+        return false;
+
+    std::size_t index_bytes = scratch_align(3 * sizeof(int64_t) * (group_count + 1));
+    scratch_buffer scratch(scratch_routine::gemm_batch, index_bytes + sizeof(int64_t) * workers);
+    int64_t *order = scratch.get<int64_t>();
+    if (order == nullptr)
+        return false;
+
+    // first[g] is the first problem of group g. start[o] numbers the problems
+    //  left for the parallel phase, in the order of the groups in order[].
+    int64_t *first = order + group_count + 1;
+    int64_t *start = first + group_count + 1;
+    int64_t *busy  = scratch.get<int64_t>(index_bytes);
+
+    double total = 0;
+    first[0]     = 0;
+    for (int64_t g = 0; g < group_count; g++) {
+        order[g]     = g;
+        first[g + 1] = first[g] + group_size[g];
+        total += work(g) * group_size[g];
+    }
+    std::sort(order, order + group_count, [&](int64_t x, int64_t y) {
+        double wx = work(x), wy = work(y);
+        return wx > wy || (wx == wy && x < y);
+    });
+
+    // Problems worth all the threads, one after the other. The next problem
+    //  is the j-th of group order[o].
+    int64_t o = 0, j = 0, threaded = 0;
+    while (o < group_count) {
+        int64_t g = order[o];
+        if (j >= group_size[g]) {
+            o++;
+            j = 0;
+            continue;
+        }
+        // total is the work left, this problem included. A problem of at
+        //  least total / workers would on its own keep one thread busy for
+        //  the whole parallel phase, so it runs threaded instead. Problems
+        //  come longest first, and total only shrinks by the problems taken
+        //  here, so once the largest one left is under a thread's share, all
+        //  the others are too and the parallel phase can balance them.
+        double w = work(g);
+        if (w <= 0 || w * workers < total)
+            break;
+        run(g, first[g] + j);
+        total -= w;
+        threaded++;
+        j++;
+    }
+
+    // The others, one per thread.
+    int64_t count = 0, makespan = 0;
+    if (o < group_count) {
+        start[o] = -j;
+        for (int64_t p = o; p < group_count; p++)
+            start[p + 1] = start[p] + group_size[order[p]];
+        count = start[group_count];
+    }
+    if (count > 0) {
+        std::atomic<int64_t> next(0);
+        auto begin = std::chrono::steady_clock::now();
+        // Each thread is timed over its whole loop, from the start of the
+        //  phase, so only the wait for the last problems to finish counts as
+        //  idle and not the order in which threads happened to take them.
+        parallel_for(0, workers, [&](int64_t t) {
+            int previous = mkl_set_num_threads_local(1);
+            for (int64_t i = next++; i < count; i = next++) {
+                int64_t p = std::upper_bound(start + o, start + group_count + 1, i) - start - 1;
+                run(order[p], first[order[p]] + i - start[p]);
+            }
+            mkl_set_num_threads_local(previous);
+            busy[t] = elapsed_ns(begin);
+        });
+        makespan = elapsed_ns(begin);
+    }
+    schedule_record(threaded, count, workers, busy, makespan);
+    return true;
+}
+
+} // namespace mklcpu
+} // namespace onemkl
+
+#endif //_MKL_CPU_SCHEDULE_HPP_
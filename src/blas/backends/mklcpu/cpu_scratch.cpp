@@ -0,0 +1,201 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "cpu_common.hpp"
+#include "cpu_scratch.hpp"
+
+namespace onemkl {
+namespace mklcpu {
+
+// Usage counters are per thread, so that counting an allocation does not
+//  contend with other threads, and are summed when read. Only their thread
+//  writes them: a relaxed load and store is enough.
+struct thread_usage {
+    std::atomic<std::uint64_t> allocations[(int)scratch_routine::count];
+    std::atomic<std::uint64_t> bytes[(int)scratch_routine::count];
+};
+
+// Counters of all threads, kept after the threads exit. Never destroyed, so
+//  that threads ending late still find it.
+struct usage_registry {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<thread_usage>> threads;
+};
+
+static usage_registry &registry() {
+    static usage_registry *r = new usage_registry;
+    return *r;
+}
+
+static thread_usage &local_usage() {
+    thread_local thread_usage *usage = nullptr;
+    if (!usage) {
+        // Value-initialized: all counters start at zero.
+        std::unique_ptr<thread_usage> block(new thread_usage());
+        usage   = block.get();
+        auto &r = registry();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        r.threads.push_back(std::move(block));
+    }
+    return *usage;
+}
+
+static inline void bump(std::atomic<std::uint64_t> &counter, std::uint64_t value) {
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+static std::atomic<std::uint64_t> retained(0);
+static std::atomic<std::uint64_t> high_water(0);
+static std::atomic<std::uint64_t> system_allocations(0);
+
+static std::size_t scratch_limit() {
+    static const std::size_t limit = []() {
+        const char *env = std::getenv("ONEMKL_MKLCPU_SCRATCH_LIMIT");
+        return env ? (std::size_t)std::strtoull(env, nullptr, 10) : (std::size_t)256 << 20;
+    }();
+    return limit;
+}
+
+static void *system_alloc(std::size_t bytes) {
+    system_allocations.fetch_add(1, std::memory_order_relaxed);
+    return mkl_malloc(bytes, scratch_alignment);
+}
+
+// Memory kept by one thread between host tasks. Blocks are handed out from
+//  the bottom up and returned in reverse order.
+struct scratch_arena {
+    char *base           = nullptr;
+    std::size_t capacity = 0;
+    std::size_t top      = 0;
+
+    // Replace the block by one of at least bytes, when nothing is handed out.
+    bool grow(std::size_t bytes) {
+        std::size_t limit = scratch_limit();
+        if (top != 0 || bytes > limit)
+            return false;
+        std::size_t new_capacity = std::max(bytes, std::min(2 * capacity, limit));
+        void *p                  = system_alloc(new_capacity);
+        if (!p)
+            return false;
+        release();
+        base     = static_cast<char *>(p);
+        capacity = new_capacity;
+
+        std::uint64_t total = retained.fetch_add(capacity, std::memory_order_relaxed) + capacity;
+        std::uint64_t peak  = high_water.load(std::memory_order_relaxed);
+        while (total > peak && !high_water.compare_exchange_weak(peak, total))
+            ;
+        return true;
+    }
+
+    void release() {
+        if (!base)
+            return;
+        mkl_free(base);
+        retained.fetch_sub(capacity, std::memory_order_relaxed);
+        base     = nullptr;
+        capacity = 0;
+    }
+
+    ~scratch_arena() {
+        release();
+    }
+};
+
+static thread_local scratch_arena arena;
+
+scratch_buffer::scratch_buffer(scratch_routine routine, std::size_t bytes)
+        : ptr(nullptr), size(scratch_align(std::max<std::size_t>(bytes, 1))), owned(false) {
+    auto &usage = local_usage();
+    bump(usage.allocations[(int)routine], 1);
+    bump(usage.bytes[(int)routine], bytes);
+
+    if (arena.top + size <= arena.capacity || arena.grow(size)) {
+        ptr = arena.base + arena.top;
+        arena.top += size;
+        return;
+    }
+    ptr   = system_alloc(size);
+    owned = true;
+}
+
+scratch_buffer::~scratch_buffer() {
+    if (owned)
+        mkl_free(ptr);
+    else if (ptr)
+        arena.top -= size;
+}
+
+scratch_counters scratch_usage(scratch_routine routine) {
+    scratch_counters counters;
+    auto &r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    for (auto &t : r.threads) {
+        counters.allocations += t->allocations[(int)routine].load(std::memory_order_relaxed);
+        counters.bytes += t->bytes[(int)routine].load(std::memory_order_relaxed);
+    }
+    return counters;
+}
+
+std::uint64_t scratch_retained_bytes() {
+    return retained.load(std::memory_order_relaxed);
+}
+
+std::uint64_t scratch_high_water_bytes() {
+    return high_water.load(std::memory_order_relaxed);
+}
+
+std::uint64_t scratch_system_allocations() {
+    return system_allocations.load(std::memory_order_relaxed);
+}
+
+const char *scratch_routine_name(scratch_routine routine) {
+    static const char *names[] = { "gemm_batch", "trsm_batch", "gemm_half", "gemm_ext_half",
+                                   "axpy_batch", "gemm_bf16", "gemm_ext_bf16" };
+    static_assert(sizeof(names) / sizeof(names[0]) == (std::size_t)scratch_routine::count,
+                  "one name per scratch routine");
+    return names[(int)routine];
+}
+
+// With ONEMKL_MKLCPU_SCRATCH_STATS set, print the counters at exit.
+static struct scratch_report {
+    ~scratch_report() {
+        if (!std::getenv("ONEMKL_MKLCPU_SCRATCH_STATS"))
+            return;
+        std::fprintf(stderr, "mklcpu scratch: high water %llu bytes, %llu system allocations\n",
+                     (unsigned long long)scratch_high_water_bytes(),
+                     (unsigned long long)scratch_system_allocations());
+        for (int i = 0; i < (int)scratch_routine::count; i++) {
+            scratch_counters usage = scratch_usage((scratch_routine)i);
+            std::fprintf(stderr, "  %-16s %12llu calls %16llu bytes\n",
+                         scratch_routine_name((scratch_routine)i),
+                         (unsigned long long)usage.allocations, (unsigned long long)usage.bytes);
+        }
+    }
+} report;
+
+} // namespace mklcpu
+} // namespace onemkl
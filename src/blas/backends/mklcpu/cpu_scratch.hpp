@@ -0,0 +1,93 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _MKL_CPU_SCRATCH_HPP_
+#define _MKL_CPU_SCRATCH_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace onemkl {
+namespace mklcpu {
+
+// Routines taking scratch memory, counted separately.
+enum class scratch_routine : int {
+    gemm_batch,
+    trsm_batch,
+    gemm_half,
+    gemm_ext_half,
+    axpy_batch,
+    gemm_bf16,
+    gemm_ext_bf16,
+    count
+};
+
+struct scratch_counters {
+    std::uint64_t allocations = 0;
+    std::uint64_t bytes       = 0;
+};
+
+// Counters of all routines, summed over the threads, and of the memory held
+//  by the arenas.
+scratch_counters scratch_usage(scratch_routine routine);
+std::uint64_t scratch_retained_bytes();
+std::uint64_t scratch_high_water_bytes();
+std::uint64_t scratch_system_allocations();
+const char *scratch_routine_name(scratch_routine routine);
+
+// Alignment of every scratch block; offsets into a block should be rounded
+//  with scratch_align() to keep each part aligned.
+static constexpr std::size_t scratch_alignment = 64;
+
+static inline std::size_t scratch_align(std::size_t bytes) {
+    return (bytes + scratch_alignment - 1) & ~(scratch_alignment - 1);
+}
+
+// Temporary memory for the duration of a host task. Each thread keeps an
+//  arena that grows to the largest request it has seen, up to
+//  ONEMKL_MKLCPU_SCRATCH_LIMIT bytes (256 MiB by default), so repeated calls
+//  do not go through the system allocator or fault in fresh pages. Requests
+//  that do not fit get memory of their own, released with the buffer.
+//  Buffers must be released in the reverse order of their creation, which
+//  scoping them in the host task gives. get() is nullptr if out of memory.
+class scratch_buffer {
+public:
+    scratch_buffer(scratch_routine routine, std::size_t bytes);
+    ~scratch_buffer();
+
+    scratch_buffer(const scratch_buffer &) = delete;
+    scratch_buffer &operator=(const scratch_buffer &) = delete;
+
+    // The block, seen as T, starting offset bytes in.
+    template <typename T>
+    T *get(std::size_t offset = 0) const {
+        return ptr ? reinterpret_cast<T *>(static_cast<char *>(ptr) + offset) : nullptr;
+    }
+
+private:
+    void *ptr;
+    std::size_t size;
+    bool owned;
+};
+
+} // namespace mklcpu
+} // namespace onemkl
+
+#endif //_MKL_CPU_SCRATCH_HPP_
@@ -0,0 +1,173 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "cpu_common.hpp"
+#include "cpu_scratch.hpp"
+#include "cpu_stats.hpp"
+
+namespace onemkl {
+namespace mklcpu {
+
+std::atomic<bool> stats_on{ false };
+
+namespace {
+
+// Kernel names with execution time counters; the others run untimed.
+constexpr int max_tasks = 512;
+
+struct task_counters {
+    std::atomic<std::uint64_t> tasks;
+    std::atomic<std::uint64_t> exec_ns;
+    std::atomic<std::uint64_t> histogram[blas::stats_buckets];
+};
+
+struct thread_stats {
+    std::atomic<std::uint64_t> counters[(int)cpu_counter::count];
+    task_counters tasks[max_tasks];
+};
+
+// Counters are only written by their thread: a relaxed load and store is
+//  enough, and cheaper than a read-modify-write.
+inline void bump(std::atomic<std::uint64_t> &counter, std::uint64_t value) {
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+// Counters of all threads, kept after the threads exit. Never destroyed, so
+//  that threads ending late still find it.
+struct stats_registry {
+    std::mutex mutex;
+    std::vector<std::string> task_names;
+    std::vector<std::unique_ptr<thread_stats>> threads;
+};
+
+stats_registry &registry() {
+    static stats_registry *r = new stats_registry;
+    return *r;
+}
+
+thread_stats &local_stats() {
+    thread_local thread_stats *stats = nullptr;
+    if (!stats) {
+        // Value-initialized: all counters start at zero.
+        std::unique_ptr<thread_stats> block(new thread_stats());
+        stats   = block.get();
+        auto &r = registry();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        r.threads.push_back(std::move(block));
+    }
+    return *stats;
+}
+
+// "sgemm_usm" out of the name of mkl_kernel_sgemm_usm *, mangled or not.
+std::string task_name(const char *type_name) {
+    static const char prefix[] = "mkl_kernel_";
+    const char *begin          = std::strstr(type_name, prefix);
+    if (!begin)
+        return type_name;
+    begin += sizeof(prefix) - 1;
+    const char *end = begin;
+    while ((*end >= 'a' && *end <= 'z') || (*end >= '0' && *end <= '9') || *end == '_')
+        end++;
+    return std::string(begin, end);
+}
+
+const char *counter_name(cpu_counter counter) {
+    static const char *names[] = { "fp16_conversion_bytes", "bf16_conversion_bytes",
+                                   "batch_arrays", "batch_array_bytes" };
+    static_assert(sizeof(names) / sizeof(names[0]) == (std::size_t)cpu_counter::count,
+                  "one name per counter");
+    return names[(int)counter];
+}
+
+} // namespace
+
+void stats_count_slow(cpu_counter counter, std::uint64_t value) {
+    bump(local_stats().counters[(int)counter], value);
+}
+
+int stats_register_task(const char *type_name) {
+    std::string name = task_name(type_name);
+    auto &r          = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    for (std::size_t i = 0; i < r.task_names.size(); i++) {
+        if (r.task_names[i] == name)
+            return (int)i;
+    }
+    if (r.task_names.size() >= max_tasks)
+        return -1;
+    r.task_names.push_back(name);
+    return (int)r.task_names.size() - 1;
+}
+
+void stats_task_time(int task, std::uint64_t ns) {
+    task_counters &c = local_stats().tasks[task];
+    bump(c.tasks, 1);
+    bump(c.exec_ns, ns);
+    bump(c.histogram[blas::stats_bucket(ns)], 1);
+}
+
+void stats_enable(bool enable) {
+    stats_on.store(enable, std::memory_order_relaxed);
+}
+
+void stats_read(blas::detail::stats_sink &sink) {
+    auto &r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+
+    for (std::size_t i = 0; i < r.task_names.size(); i++) {
+        std::uint64_t tasks = 0, exec_ns = 0;
+        std::uint64_t histogram[blas::stats_buckets] = {};
+        for (auto &t : r.threads) {
+            const task_counters &c = t->tasks[i];
+            tasks += c.tasks.load(std::memory_order_relaxed);
+            exec_ns += c.exec_ns.load(std::memory_order_relaxed);
+            for (int b = 0; b < blas::stats_buckets; b++)
+                histogram[b] += c.histogram[b].load(std::memory_order_relaxed);
+        }
+        if (tasks)
+            sink.task(r.task_names[i].c_str(), tasks, exec_ns, histogram);
+    }
+
+    for (int i = 0; i < (int)cpu_counter::count; i++) {
+        std::uint64_t value = 0;
+        for (auto &t : r.threads)
+            value += t->counters[i].load(std::memory_order_relaxed);
+        sink.counter(counter_name((cpu_counter)i), value, true);
+    }
+
+    // Scratch memory is counted whether statistics are on or not.
+    for (int i = 0; i < (int)scratch_routine::count; i++) {
+        std::string name     = std::string("scratch_") + scratch_routine_name((scratch_routine)i);
+        scratch_counters use = scratch_usage((scratch_routine)i);
+        sink.counter((name + "_allocations").c_str(), use.allocations, true);
+        sink.counter((name + "_bytes").c_str(), use.bytes, true);
+    }
+    sink.counter("scratch_system_allocations", scratch_system_allocations(), true);
+    sink.counter("scratch_retained_bytes", scratch_retained_bytes(), false);
+    sink.counter("scratch_high_water_bytes", scratch_high_water_bytes(), false);
+}
+
+} // namespace mklcpu
+} // namespace onemkl
@@ -0,0 +1,84 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _MKL_CPU_STATS_HPP_
+#define _MKL_CPU_STATS_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <typeinfo>
+
+namespace onemkl {
+namespace mklcpu {
+
+// Internal costs counted while statistics are on.
+enum class cpu_counter : int {
+    fp16_conversion_bytes,
+    bf16_conversion_bytes,
+    batch_arrays,
+    batch_array_bytes,
+    count
+};
+
+// Statistics of the backend, turned on by stats_enable(), usually from the
+//  loader's. Each thread has counters of its own that only it writes, so
+//  counting takes no lock; stats_read() adds up the counters of all threads.
+extern std::atomic<bool> stats_on;
+
+void stats_count_slow(cpu_counter counter, std::uint64_t value);
+int stats_register_task(const char *type_name);
+void stats_task_time(int task, std::uint64_t ns);
+
+static inline void stats_count(cpu_counter counter, std::uint64_t value) {
+    if (stats_on.load(std::memory_order_relaxed))
+        stats_count_slow(counter, value);
+}
+
+// Id of the tasks of kernel name K in the execution time counters, -1 while
+//  statistics are off. The counters are named after K, less its mkl_kernel_
+//  prefix, and shared by the kernel names that are the same once so reduced.
+template <typename K>
+static inline int stats_task() {
+    if (!stats_on.load(std::memory_order_relaxed))
+        return -1;
+    // Kernel names are incomplete types, pointers to them are not.
+    static const int id = stats_register_task(typeid(K *).name());
+    return id;
+}
+
+// Run f, timed into the counters of task unless it is -1.
+template <typename F>
+static inline void stats_run(int task, const F &f) {
+    if (task < 0) {
+        f();
+        return;
+    }
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                  std::chrono::steady_clock::now() - start)
+                  .count();
+    stats_task_time(task, (std::uint64_t)ns);
+}
+
+} // namespace mklcpu
+} // namespace onemkl
+
+#endif //_MKL_CPU_STATS_HPP_
@@ -200,7 +200,7 @@ struct fp16 {
     }
 };
 
-fp16::fp16(float f) {
+inline fp16::fp16(float f) {
     uint32_t i = float_to_raw(f);
     uint32_t s = i >> 31;
     uint32_t e = (i >> 23) & 0xFF;
@@ -289,21 +289,21 @@ inline fp16::operator float() const {
 
 namespace std {
 
-bool isfinite(onemkl::mklcpu::fp16 h) {
+inline bool isfinite(onemkl::mklcpu::fp16 h) {
     return (~h.raw & 0x7C00);
 }
 
-onemkl::mklcpu::fp16 abs(onemkl::mklcpu::fp16 h) {
+inline onemkl::mklcpu::fp16 abs(onemkl::mklcpu::fp16 h) {
     onemkl::mklcpu::fp16 a = h;
     a.raw &= ~0x8000;
     return a;
 }
 
-onemkl::mklcpu::fp16 real(onemkl::mklcpu::fp16 h) {
+inline onemkl::mklcpu::fp16 real(onemkl::mklcpu::fp16 h) {
     return h;
 }
 
-float imag(onemkl::mklcpu::fp16 h) {
+inline float imag(onemkl::mklcpu::fp16 h) {
     return 0.0f;
 }
 
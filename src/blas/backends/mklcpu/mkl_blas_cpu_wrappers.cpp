@@ -18,346 +18,412 @@
 *******************************************************************************/
 
 #include "blas/function_table.hpp"
+#include "onemkl/detail/config.hpp"
 #include "onemkl/blas/detail/mklcpu/onemkl_blas_mklcpu.hpp"
 
-#define WRAPPER_VERSION 1
+#define WRAPPER_VERSION 2
 
-extern "C" ONEMKL_EXPORT function_table_t mkl_blas_table = {
-    WRAPPER_VERSION,
-    onemkl::mklcpu::asum,
-    onemkl::mklcpu::asum,
-    onemkl::mklcpu::asum,
-    onemkl::mklcpu::asum,
-    onemkl::mklcpu::axpy,
-    onemkl::mklcpu::axpy,
-    onemkl::mklcpu::axpy,
-    onemkl::mklcpu::axpy,
-    onemkl::mklcpu::copy,
-    onemkl::mklcpu::copy,
-    onemkl::mklcpu::copy,
-    onemkl::mklcpu::copy,
-    onemkl::mklcpu::dot,
-    onemkl::mklcpu::dot,
-    onemkl::mklcpu::dot,
-    onemkl::mklcpu::dotc,
-    onemkl::mklcpu::dotc,
-    onemkl::mklcpu::dotu,
-    onemkl::mklcpu::dotu,
-    onemkl::mklcpu::iamin,
-    onemkl::mklcpu::iamin,
-    onemkl::mklcpu::iamin,
-    onemkl::mklcpu::iamin,
-    onemkl::mklcpu::iamax,
-    onemkl::mklcpu::iamax,
-    onemkl::mklcpu::iamax,
-    onemkl::mklcpu::iamax,
-    onemkl::mklcpu::nrm2,
-    onemkl::mklcpu::nrm2,
-    onemkl::mklcpu::nrm2,
-    onemkl::mklcpu::nrm2,
-    onemkl::mklcpu::rot,
-    onemkl::mklcpu::rot,
-    onemkl::mklcpu::rot,
-    onemkl::mklcpu::rot,
-    onemkl::mklcpu::rotg,
-    onemkl::mklcpu::rotg,
-    onemkl::mklcpu::rotg,
-    onemkl::mklcpu::rotg,
-    onemkl::mklcpu::rotm,
-    onemkl::mklcpu::rotm,
-    onemkl::mklcpu::rotmg,
-    onemkl::mklcpu::rotmg,
-    onemkl::mklcpu::scal,
-    onemkl::mklcpu::scal,
-    onemkl::mklcpu::scal,
-    onemkl::mklcpu::scal,
-    onemkl::mklcpu::scal,
-    onemkl::mklcpu::scal,
-    onemkl::mklcpu::sdsdot,
-    onemkl::mklcpu::swap,
-    onemkl::mklcpu::swap,
-    onemkl::mklcpu::swap,
-    onemkl::mklcpu::swap,
-    onemkl::mklcpu::gbmv,
-    onemkl::mklcpu::gbmv,
-    onemkl::mklcpu::gbmv,
-    onemkl::mklcpu::gbmv,
-    onemkl::mklcpu::gemv,
-    onemkl::mklcpu::gemv,
-    onemkl::mklcpu::gemv,
-    onemkl::mklcpu::gemv,
-    onemkl::mklcpu::ger,
-    onemkl::mklcpu::ger,
-    onemkl::mklcpu::gerc,
-    onemkl::mklcpu::gerc,
-    onemkl::mklcpu::geru,
-    onemkl::mklcpu::geru,
-    onemkl::mklcpu::hbmv,
-    onemkl::mklcpu::hbmv,
-    onemkl::mklcpu::hemv,
-    onemkl::mklcpu::hemv,
-    onemkl::mklcpu::her,
-    onemkl::mklcpu::her,
-    onemkl::mklcpu::her2,
-    onemkl::mklcpu::her2,
-    onemkl::mklcpu::hpmv,
-    onemkl::mklcpu::hpmv,
-    onemkl::mklcpu::hpr,
-    onemkl::mklcpu::hpr,
-    onemkl::mklcpu::hpr2,
-    onemkl::mklcpu::hpr2,
-    onemkl::mklcpu::sbmv,
-    onemkl::mklcpu::sbmv,
-    onemkl::mklcpu::spmv,
-    onemkl::mklcpu::spmv,
-    onemkl::mklcpu::spr,
-    onemkl::mklcpu::spr,
-    onemkl::mklcpu::spr2,
-    onemkl::mklcpu::spr2,
-    onemkl::mklcpu::symv,
-    onemkl::mklcpu::symv,
-    onemkl::mklcpu::syr,
-    onemkl::mklcpu::syr,
-    onemkl::mklcpu::syr2,
-    onemkl::mklcpu::syr2,
-    onemkl::mklcpu::tbmv,
-    onemkl::mklcpu::tbmv,
-    onemkl::mklcpu::tbmv,
-    onemkl::mklcpu::tbmv,
-    onemkl::mklcpu::tbsv,
-    onemkl::mklcpu::tbsv,
-    onemkl::mklcpu::tbsv,
-    onemkl::mklcpu::tbsv,
-    onemkl::mklcpu::tpmv,
-    onemkl::mklcpu::tpmv,
-    onemkl::mklcpu::tpmv,
-    onemkl::mklcpu::tpmv,
-    onemkl::mklcpu::tpsv,
-    onemkl::mklcpu::tpsv,
-    onemkl::mklcpu::tpsv,
-    onemkl::mklcpu::tpsv,
-    onemkl::mklcpu::trmv,
-    onemkl::mklcpu::trmv,
-    onemkl::mklcpu::trmv,
-    onemkl::mklcpu::trmv,
-    onemkl::mklcpu::trsv,
-    onemkl::mklcpu::trsv,
-    onemkl::mklcpu::trsv,
-    onemkl::mklcpu::trsv,
-    onemkl::mklcpu::gemm,
-    onemkl::mklcpu::gemm,
-    onemkl::mklcpu::gemm,
-    onemkl::mklcpu::gemm,
-    onemkl::mklcpu::gemm,
-    onemkl::mklcpu::hemm,
-    onemkl::mklcpu::hemm,
-    onemkl::mklcpu::herk,
-    onemkl::mklcpu::herk,
-    onemkl::mklcpu::her2k,
-    onemkl::mklcpu::her2k,
-    onemkl::mklcpu::symm,
-    onemkl::mklcpu::symm,
-    onemkl::mklcpu::symm,
-    onemkl::mklcpu::symm,
-    onemkl::mklcpu::syrk,
-    onemkl::mklcpu::syrk,
-    onemkl::mklcpu::syrk,
-    onemkl::mklcpu::syrk,
-    onemkl::mklcpu::syr2k,
-    onemkl::mklcpu::syr2k,
-    onemkl::mklcpu::syr2k,
-    onemkl::mklcpu::syr2k,
-    onemkl::mklcpu::trmm,
-    onemkl::mklcpu::trmm,
-    onemkl::mklcpu::trmm,
-    onemkl::mklcpu::trmm,
-    onemkl::mklcpu::trsm,
-    onemkl::mklcpu::trsm,
-    onemkl::mklcpu::trsm,
-    onemkl::mklcpu::trsm,
-    onemkl::mklcpu::gemm_batch,
-    onemkl::mklcpu::gemm_batch,
-    onemkl::mklcpu::gemm_batch,
-    onemkl::mklcpu::gemm_batch,
-    onemkl::mklcpu::trsm_batch,
-    onemkl::mklcpu::trsm_batch,
-    onemkl::mklcpu::trsm_batch,
-    onemkl::mklcpu::trsm_batch,
-    onemkl::mklcpu::gemmt,
-    onemkl::mklcpu::gemmt,
-    onemkl::mklcpu::gemmt,
-    onemkl::mklcpu::gemmt,
-    onemkl::mklcpu::gemm_ext,
-    onemkl::mklcpu::gemm_ext,
-    onemkl::mklcpu::gemm_ext,
-    onemkl::mklcpu::gemm_ext,
-    onemkl::mklcpu::gemm_ext,
-    onemkl::mklcpu::gemm_ext,
-    onemkl::mklcpu::gemm_ext,
-    onemkl::mklcpu::asum,
-    onemkl::mklcpu::asum,
-    onemkl::mklcpu::asum,
-    onemkl::mklcpu::asum,
-    onemkl::mklcpu::axpy,
-    onemkl::mklcpu::axpy,
-    onemkl::mklcpu::axpy,
-    onemkl::mklcpu::axpy,
-    onemkl::mklcpu::axpy_batch,
-    onemkl::mklcpu::axpy_batch,
-    onemkl::mklcpu::axpy_batch,
-    onemkl::mklcpu::axpy_batch,
-    onemkl::mklcpu::copy,
-    onemkl::mklcpu::copy,
-    onemkl::mklcpu::copy,
-    onemkl::mklcpu::copy,
-    onemkl::mklcpu::dot,
-    onemkl::mklcpu::dot,
-    onemkl::mklcpu::dot,
-    onemkl::mklcpu::dotc,
-    onemkl::mklcpu::dotc,
-    onemkl::mklcpu::dotu,
-    onemkl::mklcpu::dotu,
-    onemkl::mklcpu::iamin,
-    onemkl::mklcpu::iamin,
-    onemkl::mklcpu::iamin,
-    onemkl::mklcpu::iamin,
-    onemkl::mklcpu::iamax,
-    onemkl::mklcpu::iamax,
-    onemkl::mklcpu::iamax,
-    onemkl::mklcpu::iamax,
-    onemkl::mklcpu::nrm2,
-    onemkl::mklcpu::nrm2,
-    onemkl::mklcpu::nrm2,
-    onemkl::mklcpu::nrm2,
-    onemkl::mklcpu::rot,
-    onemkl::mklcpu::rot,
-    onemkl::mklcpu::rot,
-    onemkl::mklcpu::rot,
-    onemkl::mklcpu::rotg,
-    onemkl::mklcpu::rotg,
-    onemkl::mklcpu::rotg,
-    onemkl::mklcpu::rotg,
-    onemkl::mklcpu::rotm,
-    onemkl::mklcpu::rotm,
-    onemkl::mklcpu::rotmg,
-    onemkl::mklcpu::rotmg,
-    onemkl::mklcpu::scal,
-    onemkl::mklcpu::scal,
-    onemkl::mklcpu::scal,
-    onemkl::mklcpu::scal,
-    onemkl::mklcpu::scal,
-    onemkl::mklcpu::scal,
-    onemkl::mklcpu::sdsdot,
-    onemkl::mklcpu::swap,
-    onemkl::mklcpu::swap,
-    onemkl::mklcpu::swap,
-    onemkl::mklcpu::swap,
-    onemkl::mklcpu::gbmv,
-    onemkl::mklcpu::gbmv,
-    onemkl::mklcpu::gbmv,
-    onemkl::mklcpu::gbmv,
-    onemkl::mklcpu::gemv,
-    onemkl::mklcpu::gemv,
-    onemkl::mklcpu::gemv,
-    onemkl::mklcpu::gemv,
-    onemkl::mklcpu::ger,
-    onemkl::mklcpu::ger,
-    onemkl::mklcpu::gerc,
-    onemkl::mklcpu::gerc,
-    onemkl::mklcpu::geru,
-    onemkl::mklcpu::geru,
-    onemkl::mklcpu::hbmv,
-    onemkl::mklcpu::hbmv,
-    onemkl::mklcpu::hemv,
-    onemkl::mklcpu::hemv,
-    onemkl::mklcpu::her,
-    onemkl::mklcpu::her,
-    onemkl::mklcpu::her2,
-    onemkl::mklcpu::her2,
-    onemkl::mklcpu::hpmv,
-    onemkl::mklcpu::hpmv,
-    onemkl::mklcpu::hpr,
-    onemkl::mklcpu::hpr,
-    onemkl::mklcpu::hpr2,
-    onemkl::mklcpu::hpr2,
-    onemkl::mklcpu::sbmv,
-    onemkl::mklcpu::sbmv,
-    onemkl::mklcpu::spmv,
-    onemkl::mklcpu::spmv,
-    onemkl::mklcpu::spr,
-    onemkl::mklcpu::spr,
-    onemkl::mklcpu::spr2,
-    onemkl::mklcpu::spr2,
-    onemkl::mklcpu::symv,
-    onemkl::mklcpu::symv,
-    onemkl::mklcpu::syr,
-    onemkl::mklcpu::syr,
-    onemkl::mklcpu::syr2,
-    onemkl::mklcpu::syr2,
-    onemkl::mklcpu::tbmv,
-    onemkl::mklcpu::tbmv,
-    onemkl::mklcpu::tbmv,
-    onemkl::mklcpu::tbmv,
-    onemkl::mklcpu::tbsv,
-    onemkl::mklcpu::tbsv,
-    onemkl::mklcpu::tbsv,
-    onemkl::mklcpu::tbsv,
-    onemkl::mklcpu::tpmv,
-    onemkl::mklcpu::tpmv,
-    onemkl::mklcpu::tpmv,
-    onemkl::mklcpu::tpmv,
-    onemkl::mklcpu::tpsv,
-    onemkl::mklcpu::tpsv,
-    onemkl::mklcpu::tpsv,
-    onemkl::mklcpu::tpsv,
-    onemkl::mklcpu::trmv,
-    onemkl::mklcpu::trmv,
-    onemkl::mklcpu::trmv,
-    onemkl::mklcpu::trmv,
-    onemkl::mklcpu::trsv,
-    onemkl::mklcpu::trsv,
-    onemkl::mklcpu::trsv,
-    onemkl::mklcpu::trsv,
-    onemkl::mklcpu::gemm,
-    onemkl::mklcpu::gemm,
-    onemkl::mklcpu::gemm,
-    onemkl::mklcpu::gemm,
-    onemkl::mklcpu::hemm,
-    onemkl::mklcpu::hemm,
-    onemkl::mklcpu::herk,
-    onemkl::mklcpu::herk,
-    onemkl::mklcpu::her2k,
-    onemkl::mklcpu::her2k,
-    onemkl::mklcpu::symm,
-    onemkl::mklcpu::symm,
-    onemkl::mklcpu::symm,
-    onemkl::mklcpu::symm,
-    onemkl::mklcpu::syrk,
-    onemkl::mklcpu::syrk,
-    onemkl::mklcpu::syrk,
-    onemkl::mklcpu::syrk,
-    onemkl::mklcpu::syr2k,
-    onemkl::mklcpu::syr2k,
-    onemkl::mklcpu::syr2k,
-    onemkl::mklcpu::syr2k,
-    onemkl::mklcpu::trmm,
-    onemkl::mklcpu::trmm,
-    onemkl::mklcpu::trmm,
-    onemkl::mklcpu::trmm,
-    onemkl::mklcpu::trsm,
-    onemkl::mklcpu::trsm,
-    onemkl::mklcpu::trsm,
-    onemkl::mklcpu::trsm,
-    onemkl::mklcpu::gemm_batch,
-    onemkl::mklcpu::gemm_batch,
-    onemkl::mklcpu::gemm_batch,
-    onemkl::mklcpu::gemm_batch,
-    onemkl::mklcpu::gemm_batch,
-    onemkl::mklcpu::gemm_batch,
-    onemkl::mklcpu::gemm_batch,
-    onemkl::mklcpu::gemm_batch,
-    onemkl::mklcpu::gemmt,
-    onemkl::mklcpu::gemmt,
-    onemkl::mklcpu::gemmt,
-    onemkl::mklcpu::gemmt,
+// Shared backends are loaded with dlopen and looked up by a common name, static
+//  ones are linked into the loader and need a name of their own.
+#ifdef BUILD_SHARED_LIBS
+    #define WRAPPER_TABLE mkl_blas_table
+#else
+    #define WRAPPER_TABLE mkl_blas_mklcpu_table
+#endif
+
+static const function_table_entry_t wrapper_entries[] = {
+    ONEMKL_TABLE_ENTRY(scasum_sycl, onemkl::mklcpu::asum),
+    ONEMKL_TABLE_ENTRY(dzasum_sycl, onemkl::mklcpu::asum),
+    ONEMKL_TABLE_ENTRY(sasum_sycl, onemkl::mklcpu::asum),
+    ONEMKL_TABLE_ENTRY(dasum_sycl, onemkl::mklcpu::asum),
+    ONEMKL_TABLE_ENTRY(saxpy_sycl, onemkl::mklcpu::axpy),
+    ONEMKL_TABLE_ENTRY(daxpy_sycl, onemkl::mklcpu::axpy),
+    ONEMKL_TABLE_ENTRY(caxpy_sycl, onemkl::mklcpu::axpy),
+    ONEMKL_TABLE_ENTRY(zaxpy_sycl, onemkl::mklcpu::axpy),
+    ONEMKL_TABLE_ENTRY(saxpy_batch_strided_sycl, onemkl::mklcpu::axpy_batch),
+    ONEMKL_TABLE_ENTRY(daxpy_batch_strided_sycl, onemkl::mklcpu::axpy_batch),
+    ONEMKL_TABLE_ENTRY(caxpy_batch_strided_sycl, onemkl::mklcpu::axpy_batch),
+    ONEMKL_TABLE_ENTRY(zaxpy_batch_strided_sycl, onemkl::mklcpu::axpy_batch),
+    ONEMKL_TABLE_ENTRY(scopy_sycl, onemkl::mklcpu::copy),
+    ONEMKL_TABLE_ENTRY(dcopy_sycl, onemkl::mklcpu::copy),
+    ONEMKL_TABLE_ENTRY(ccopy_sycl, onemkl::mklcpu::copy),
+    ONEMKL_TABLE_ENTRY(zcopy_sycl, onemkl::mklcpu::copy),
+    ONEMKL_TABLE_ENTRY(sdot_sycl, onemkl::mklcpu::dot),
+    ONEMKL_TABLE_ENTRY(ddot_sycl, onemkl::mklcpu::dot),
+    ONEMKL_TABLE_ENTRY(dsdot_sycl, onemkl::mklcpu::dot),
+    ONEMKL_TABLE_ENTRY(cdotc_sycl, onemkl::mklcpu::dotc),
+    ONEMKL_TABLE_ENTRY(zdotc_sycl, onemkl::mklcpu::dotc),
+    ONEMKL_TABLE_ENTRY(cdotu_sycl, onemkl::mklcpu::dotu),
+    ONEMKL_TABLE_ENTRY(zdotu_sycl, onemkl::mklcpu::dotu),
+    ONEMKL_TABLE_ENTRY(isamin_sycl, onemkl::mklcpu::iamin),
+    ONEMKL_TABLE_ENTRY(idamin_sycl, onemkl::mklcpu::iamin),
+    ONEMKL_TABLE_ENTRY(icamin_sycl, onemkl::mklcpu::iamin),
+    ONEMKL_TABLE_ENTRY(izamin_sycl, onemkl::mklcpu::iamin),
+    ONEMKL_TABLE_ENTRY(isamax_sycl, onemkl::mklcpu::iamax),
+    ONEMKL_TABLE_ENTRY(idamax_sycl, onemkl::mklcpu::iamax),
+    ONEMKL_TABLE_ENTRY(icamax_sycl, onemkl::mklcpu::iamax),
+    ONEMKL_TABLE_ENTRY(izamax_sycl, onemkl::mklcpu::iamax),
+    ONEMKL_TABLE_ENTRY(snrm2_sycl, onemkl::mklcpu::nrm2),
+    ONEMKL_TABLE_ENTRY(dnrm2_sycl, onemkl::mklcpu::nrm2),
+    ONEMKL_TABLE_ENTRY(scnrm2_sycl, onemkl::mklcpu::nrm2),
+    ONEMKL_TABLE_ENTRY(dznrm2_sycl, onemkl::mklcpu::nrm2),
+    ONEMKL_TABLE_ENTRY(srot_sycl, onemkl::mklcpu::rot),
+    ONEMKL_TABLE_ENTRY(drot_sycl, onemkl::mklcpu::rot),
+    ONEMKL_TABLE_ENTRY(csrot_sycl, onemkl::mklcpu::rot),
+    ONEMKL_TABLE_ENTRY(zdrot_sycl, onemkl::mklcpu::rot),
+    ONEMKL_TABLE_ENTRY(srotg_sycl, onemkl::mklcpu::rotg),
+    ONEMKL_TABLE_ENTRY(drotg_sycl, onemkl::mklcpu::rotg),
+    ONEMKL_TABLE_ENTRY(crotg_sycl, onemkl::mklcpu::rotg),
+    ONEMKL_TABLE_ENTRY(zrotg_sycl, onemkl::mklcpu::rotg),
+    ONEMKL_TABLE_ENTRY(srotm_sycl, onemkl::mklcpu::rotm),
+    ONEMKL_TABLE_ENTRY(drotm_sycl, onemkl::mklcpu::rotm),
+    ONEMKL_TABLE_ENTRY(srotmg_sycl, onemkl::mklcpu::rotmg),
+    ONEMKL_TABLE_ENTRY(drotmg_sycl, onemkl::mklcpu::rotmg),
+    ONEMKL_TABLE_ENTRY(sscal_sycl, onemkl::mklcpu::scal),
+    ONEMKL_TABLE_ENTRY(dscal_sycl, onemkl::mklcpu::scal),
+    ONEMKL_TABLE_ENTRY(cscal_sycl, onemkl::mklcpu::scal),
+    ONEMKL_TABLE_ENTRY(csscal_sycl, onemkl::mklcpu::scal),
+    ONEMKL_TABLE_ENTRY(zscal_sycl, onemkl::mklcpu::scal),
+    ONEMKL_TABLE_ENTRY(zdscal_sycl, onemkl::mklcpu::scal),
+    ONEMKL_TABLE_ENTRY(sdsdot_sycl, onemkl::mklcpu::sdsdot),
+    ONEMKL_TABLE_ENTRY(sswap_sycl, onemkl::mklcpu::swap),
+    ONEMKL_TABLE_ENTRY(dswap_sycl, onemkl::mklcpu::swap),
+    ONEMKL_TABLE_ENTRY(cswap_sycl, onemkl::mklcpu::swap),
+    ONEMKL_TABLE_ENTRY(zswap_sycl, onemkl::mklcpu::swap),
+    ONEMKL_TABLE_ENTRY(sgbmv_sycl, onemkl::mklcpu::gbmv),
+    ONEMKL_TABLE_ENTRY(dgbmv_sycl, onemkl::mklcpu::gbmv),
+    ONEMKL_TABLE_ENTRY(cgbmv_sycl, onemkl::mklcpu::gbmv),
+    ONEMKL_TABLE_ENTRY(zgbmv_sycl, onemkl::mklcpu::gbmv),
+    ONEMKL_TABLE_ENTRY(sgemv_sycl, onemkl::mklcpu::gemv),
+    ONEMKL_TABLE_ENTRY(dgemv_sycl, onemkl::mklcpu::gemv),
+    ONEMKL_TABLE_ENTRY(cgemv_sycl, onemkl::mklcpu::gemv),
+    ONEMKL_TABLE_ENTRY(zgemv_sycl, onemkl::mklcpu::gemv),
+    ONEMKL_TABLE_ENTRY(sger_sycl, onemkl::mklcpu::ger),
+    ONEMKL_TABLE_ENTRY(dger_sycl, onemkl::mklcpu::ger),
+    ONEMKL_TABLE_ENTRY(cgerc_sycl, onemkl::mklcpu::gerc),
+    ONEMKL_TABLE_ENTRY(zgerc_sycl, onemkl::mklcpu::gerc),
+    ONEMKL_TABLE_ENTRY(cgeru_sycl, onemkl::mklcpu::geru),
+    ONEMKL_TABLE_ENTRY(zgeru_sycl, onemkl::mklcpu::geru),
+    ONEMKL_TABLE_ENTRY(chbmv_sycl, onemkl::mklcpu::hbmv),
+    ONEMKL_TABLE_ENTRY(zhbmv_sycl, onemkl::mklcpu::hbmv),
+    ONEMKL_TABLE_ENTRY(chemv_sycl, onemkl::mklcpu::hemv),
+    ONEMKL_TABLE_ENTRY(zhemv_sycl, onemkl::mklcpu::hemv),
+    ONEMKL_TABLE_ENTRY(cher_sycl, onemkl::mklcpu::her),
+    ONEMKL_TABLE_ENTRY(zher_sycl, onemkl::mklcpu::her),
+    ONEMKL_TABLE_ENTRY(cher2_sycl, onemkl::mklcpu::her2),
+    ONEMKL_TABLE_ENTRY(zher2_sycl, onemkl::mklcpu::her2),
+    ONEMKL_TABLE_ENTRY(chpmv_sycl, onemkl::mklcpu::hpmv),
+    ONEMKL_TABLE_ENTRY(zhpmv_sycl, onemkl::mklcpu::hpmv),
+    ONEMKL_TABLE_ENTRY(chpr_sycl, onemkl::mklcpu::hpr),
+    ONEMKL_TABLE_ENTRY(zhpr_sycl, onemkl::mklcpu::hpr),
+    ONEMKL_TABLE_ENTRY(chpr2_sycl, onemkl::mklcpu::hpr2),
+    ONEMKL_TABLE_ENTRY(zhpr2_sycl, onemkl::mklcpu::hpr2),
+    ONEMKL_TABLE_ENTRY(ssbmv_sycl, onemkl::mklcpu::sbmv),
+    ONEMKL_TABLE_ENTRY(dsbmv_sycl, onemkl::mklcpu::sbmv),
+    ONEMKL_TABLE_ENTRY(sspmv_sycl, onemkl::mklcpu::spmv),
+    ONEMKL_TABLE_ENTRY(dspmv_sycl, onemkl::mklcpu::spmv),
+    ONEMKL_TABLE_ENTRY(sspr_sycl, onemkl::mklcpu::spr),
+    ONEMKL_TABLE_ENTRY(dspr_sycl, onemkl::mklcpu::spr),
+    ONEMKL_TABLE_ENTRY(sspr2_sycl, onemkl::mklcpu::spr2),
+    ONEMKL_TABLE_ENTRY(dspr2_sycl, onemkl::mklcpu::spr2),
+    ONEMKL_TABLE_ENTRY(ssymv_sycl, onemkl::mklcpu::symv),
+    ONEMKL_TABLE_ENTRY(dsymv_sycl, onemkl::mklcpu::symv),
+    ONEMKL_TABLE_ENTRY(ssyr_sycl, onemkl::mklcpu::syr),
+    ONEMKL_TABLE_ENTRY(dsyr_sycl, onemkl::mklcpu::syr),
+    ONEMKL_TABLE_ENTRY(ssyr2_sycl, onemkl::mklcpu::syr2),
+    ONEMKL_TABLE_ENTRY(dsyr2_sycl, onemkl::mklcpu::syr2),
+    ONEMKL_TABLE_ENTRY(stbmv_sycl, onemkl::mklcpu::tbmv),
+    ONEMKL_TABLE_ENTRY(dtbmv_sycl, onemkl::mklcpu::tbmv),
+    ONEMKL_TABLE_ENTRY(ctbmv_sycl, onemkl::mklcpu::tbmv),
+    ONEMKL_TABLE_ENTRY(ztbmv_sycl, onemkl::mklcpu::tbmv),
+    ONEMKL_TABLE_ENTRY(stbsv_sycl, onemkl::mklcpu::tbsv),
+    ONEMKL_TABLE_ENTRY(dtbsv_sycl, onemkl::mklcpu::tbsv),
+    ONEMKL_TABLE_ENTRY(ctbsv_sycl, onemkl::mklcpu::tbsv),
+    ONEMKL_TABLE_ENTRY(ztbsv_sycl, onemkl::mklcpu::tbsv),
+    ONEMKL_TABLE_ENTRY(stpmv_sycl, onemkl::mklcpu::tpmv),
+    ONEMKL_TABLE_ENTRY(dtpmv_sycl, onemkl::mklcpu::tpmv),
+    ONEMKL_TABLE_ENTRY(ctpmv_sycl, onemkl::mklcpu::tpmv),
+    ONEMKL_TABLE_ENTRY(ztpmv_sycl, onemkl::mklcpu::tpmv),
+    ONEMKL_TABLE_ENTRY(stpsv_sycl, onemkl::mklcpu::tpsv),
+    ONEMKL_TABLE_ENTRY(dtpsv_sycl, onemkl::mklcpu::tpsv),
+    ONEMKL_TABLE_ENTRY(ctpsv_sycl, onemkl::mklcpu::tpsv),
+    ONEMKL_TABLE_ENTRY(ztpsv_sycl, onemkl::mklcpu::tpsv),
+    ONEMKL_TABLE_ENTRY(strmv_sycl, onemkl::mklcpu::trmv),
+    ONEMKL_TABLE_ENTRY(dtrmv_sycl, onemkl::mklcpu::trmv),
+    ONEMKL_TABLE_ENTRY(ctrmv_sycl, onemkl::mklcpu::trmv),
+    ONEMKL_TABLE_ENTRY(ztrmv_sycl, onemkl::mklcpu::trmv),
+    ONEMKL_TABLE_ENTRY(strsv_sycl, onemkl::mklcpu::trsv),
+    ONEMKL_TABLE_ENTRY(dtrsv_sycl, onemkl::mklcpu::trsv),
+    ONEMKL_TABLE_ENTRY(ctrsv_sycl, onemkl::mklcpu::trsv),
+    ONEMKL_TABLE_ENTRY(ztrsv_sycl, onemkl::mklcpu::trsv),
+    ONEMKL_TABLE_ENTRY(sgemm_sycl, onemkl::mklcpu::gemm),
+    ONEMKL_TABLE_ENTRY(dgemm_sycl, onemkl::mklcpu::gemm),
+    ONEMKL_TABLE_ENTRY(cgemm_sycl, onemkl::mklcpu::gemm),
+    ONEMKL_TABLE_ENTRY(zgemm_sycl, onemkl::mklcpu::gemm),
+    ONEMKL_TABLE_ENTRY(hgemm_sycl, onemkl::mklcpu::gemm),
+    ONEMKL_TABLE_ENTRY(gemm_bf16bf16bf16_sycl, onemkl::mklcpu::gemm),
+    ONEMKL_TABLE_ENTRY(chemm_sycl, onemkl::mklcpu::hemm),
+    ONEMKL_TABLE_ENTRY(zhemm_sycl, onemkl::mklcpu::hemm),
+    ONEMKL_TABLE_ENTRY(cherk_sycl, onemkl::mklcpu::herk),
+    ONEMKL_TABLE_ENTRY(zherk_sycl, onemkl::mklcpu::herk),
+    ONEMKL_TABLE_ENTRY(cher2k_sycl, onemkl::mklcpu::her2k),
+    ONEMKL_TABLE_ENTRY(zher2k_sycl, onemkl::mklcpu::her2k),
+    ONEMKL_TABLE_ENTRY(ssymm_sycl, onemkl::mklcpu::symm),
+    ONEMKL_TABLE_ENTRY(dsymm_sycl, onemkl::mklcpu::symm),
+    ONEMKL_TABLE_ENTRY(csymm_sycl, onemkl::mklcpu::symm),
+    ONEMKL_TABLE_ENTRY(zsymm_sycl, onemkl::mklcpu::symm),
+    ONEMKL_TABLE_ENTRY(ssyrk_sycl, onemkl::mklcpu::syrk),
+    ONEMKL_TABLE_ENTRY(dsyrk_sycl, onemkl::mklcpu::syrk),
+    ONEMKL_TABLE_ENTRY(csyrk_sycl, onemkl::mklcpu::syrk),
+    ONEMKL_TABLE_ENTRY(zsyrk_sycl, onemkl::mklcpu::syrk),
+    ONEMKL_TABLE_ENTRY(ssyr2k_sycl, onemkl::mklcpu::syr2k),
+    ONEMKL_TABLE_ENTRY(dsyr2k_sycl, onemkl::mklcpu::syr2k),
+    ONEMKL_TABLE_ENTRY(csyr2k_sycl, onemkl::mklcpu::syr2k),
+    ONEMKL_TABLE_ENTRY(zsyr2k_sycl, onemkl::mklcpu::syr2k),
+    ONEMKL_TABLE_ENTRY(strmm_sycl, onemkl::mklcpu::trmm),
+    ONEMKL_TABLE_ENTRY(dtrmm_sycl, onemkl::mklcpu::trmm),
+    ONEMKL_TABLE_ENTRY(ctrmm_sycl, onemkl::mklcpu::trmm),
+    ONEMKL_TABLE_ENTRY(ztrmm_sycl, onemkl::mklcpu::trmm),
+    ONEMKL_TABLE_ENTRY(strsm_sycl, onemkl::mklcpu::trsm),
+    ONEMKL_TABLE_ENTRY(dtrsm_sycl, onemkl::mklcpu::trsm),
+    ONEMKL_TABLE_ENTRY(ctrsm_sycl, onemkl::mklcpu::trsm),
+    ONEMKL_TABLE_ENTRY(ztrsm_sycl, onemkl::mklcpu::trsm),
+    ONEMKL_TABLE_ENTRY(sgemm_batch_strided_sycl, onemkl::mklcpu::gemm_batch),
+    ONEMKL_TABLE_ENTRY(dgemm_batch_strided_sycl, onemkl::mklcpu::gemm_batch),
+    ONEMKL_TABLE_ENTRY(cgemm_batch_strided_sycl, onemkl::mklcpu::gemm_batch),
+    ONEMKL_TABLE_ENTRY(zgemm_batch_strided_sycl, onemkl::mklcpu::gemm_batch),
+    ONEMKL_TABLE_ENTRY(strsm_batch_strided_sycl, onemkl::mklcpu::trsm_batch),
+    ONEMKL_TABLE_ENTRY(dtrsm_batch_strided_sycl, onemkl::mklcpu::trsm_batch),
+    ONEMKL_TABLE_ENTRY(ctrsm_batch_strided_sycl, onemkl::mklcpu::trsm_batch),
+    ONEMKL_TABLE_ENTRY(ztrsm_batch_strided_sycl, onemkl::mklcpu::trsm_batch),
+    ONEMKL_TABLE_ENTRY(sgemmt_sycl, onemkl::mklcpu::gemmt),
+    ONEMKL_TABLE_ENTRY(dgemmt_sycl, onemkl::mklcpu::gemmt),
+    ONEMKL_TABLE_ENTRY(cgemmt_sycl, onemkl::mklcpu::gemmt),
+    ONEMKL_TABLE_ENTRY(zgemmt_sycl, onemkl::mklcpu::gemmt),
+    ONEMKL_TABLE_ENTRY(gemm_f16f16f32_ext_sycl, onemkl::mklcpu::gemm_ext),
+    ONEMKL_TABLE_ENTRY(gemm_bf16bf16f32_ext_sycl, onemkl::mklcpu::gemm_ext),
+    ONEMKL_TABLE_ENTRY(gemm_s8u8s32_ext_sycl, onemkl::mklcpu::gemm_ext),
+    ONEMKL_TABLE_ENTRY(sgemm_ext_sycl, onemkl::mklcpu::gemm_ext),
+    ONEMKL_TABLE_ENTRY(dgemm_ext_sycl, onemkl::mklcpu::gemm_ext),
+    ONEMKL_TABLE_ENTRY(cgemm_ext_sycl, onemkl::mklcpu::gemm_ext),
+    ONEMKL_TABLE_ENTRY(zgemm_ext_sycl, onemkl::mklcpu::gemm_ext),
+    ONEMKL_TABLE_ENTRY(hgemm_ext_sycl, onemkl::mklcpu::gemm_ext),
+    ONEMKL_TABLE_ENTRY(scasum_usm_sycl, onemkl::mklcpu::asum),
+    ONEMKL_TABLE_ENTRY(dzasum_usm_sycl, onemkl::mklcpu::asum),
+    ONEMKL_TABLE_ENTRY(sasum_usm_sycl, onemkl::mklcpu::asum),
+    ONEMKL_TABLE_ENTRY(dasum_usm_sycl, onemkl::mklcpu::asum),
+    ONEMKL_TABLE_ENTRY(saxpy_usm_sycl, onemkl::mklcpu::axpy),
+    ONEMKL_TABLE_ENTRY(daxpy_usm_sycl, onemkl::mklcpu::axpy),
+    ONEMKL_TABLE_ENTRY(caxpy_usm_sycl, onemkl::mklcpu::axpy),
+    ONEMKL_TABLE_ENTRY(zaxpy_usm_sycl, onemkl::mklcpu::axpy),
+    ONEMKL_TABLE_ENTRY(saxpy_batch_group_usm_sycl, onemkl::mklcpu::axpy_batch),
+    ONEMKL_TABLE_ENTRY(daxpy_batch_group_usm_sycl, onemkl::mklcpu::axpy_batch),
+    ONEMKL_TABLE_ENTRY(caxpy_batch_group_usm_sycl, onemkl::mklcpu::axpy_batch),
+    ONEMKL_TABLE_ENTRY(zaxpy_batch_group_usm_sycl, onemkl::mklcpu::axpy_batch),
+    ONEMKL_TABLE_ENTRY(saxpy_batch_strided_usm_sycl, onemkl::mklcpu::axpy_batch),
+    ONEMKL_TABLE_ENTRY(daxpy_batch_strided_usm_sycl, onemkl::mklcpu::axpy_batch),
+    ONEMKL_TABLE_ENTRY(caxpy_batch_strided_usm_sycl, onemkl::mklcpu::axpy_batch),
+    ONEMKL_TABLE_ENTRY(zaxpy_batch_strided_usm_sycl, onemkl::mklcpu::axpy_batch),
+    ONEMKL_TABLE_ENTRY(scompact_pack_usm_sycl, onemkl::mklcpu::compact_pack),
+    ONEMKL_TABLE_ENTRY(dcompact_pack_usm_sycl, onemkl::mklcpu::compact_pack),
+    ONEMKL_TABLE_ENTRY(ccompact_pack_usm_sycl, onemkl::mklcpu::compact_pack),
+    ONEMKL_TABLE_ENTRY(zcompact_pack_usm_sycl, onemkl::mklcpu::compact_pack),
+    ONEMKL_TABLE_ENTRY(scompact_unpack_usm_sycl, onemkl::mklcpu::compact_unpack),
+    ONEMKL_TABLE_ENTRY(dcompact_unpack_usm_sycl, onemkl::mklcpu::compact_unpack),
+    ONEMKL_TABLE_ENTRY(ccompact_unpack_usm_sycl, onemkl::mklcpu::compact_unpack),
+    ONEMKL_TABLE_ENTRY(zcompact_unpack_usm_sycl, onemkl::mklcpu::compact_unpack),
+    ONEMKL_TABLE_ENTRY(sgemm_compact_usm_sycl, onemkl::mklcpu::gemm_compact),
+    ONEMKL_TABLE_ENTRY(dgemm_compact_usm_sycl, onemkl::mklcpu::gemm_compact),
+    ONEMKL_TABLE_ENTRY(cgemm_compact_usm_sycl, onemkl::mklcpu::gemm_compact),
+    ONEMKL_TABLE_ENTRY(zgemm_compact_usm_sycl, onemkl::mklcpu::gemm_compact),
+    ONEMKL_TABLE_ENTRY(strsm_compact_usm_sycl, onemkl::mklcpu::trsm_compact),
+    ONEMKL_TABLE_ENTRY(dtrsm_compact_usm_sycl, onemkl::mklcpu::trsm_compact),
+    ONEMKL_TABLE_ENTRY(ctrsm_compact_usm_sycl, onemkl::mklcpu::trsm_compact),
+    ONEMKL_TABLE_ENTRY(ztrsm_compact_usm_sycl, onemkl::mklcpu::trsm_compact),
+    ONEMKL_TABLE_ENTRY(scopy_usm_sycl, onemkl::mklcpu::copy),
+    ONEMKL_TABLE_ENTRY(dcopy_usm_sycl, onemkl::mklcpu::copy),
+    ONEMKL_TABLE_ENTRY(ccopy_usm_sycl, onemkl::mklcpu::copy),
+    ONEMKL_TABLE_ENTRY(zcopy_usm_sycl, onemkl::mklcpu::copy),
+    ONEMKL_TABLE_ENTRY(sdot_usm_sycl, onemkl::mklcpu::dot),
+    ONEMKL_TABLE_ENTRY(ddot_usm_sycl, onemkl::mklcpu::dot),
+    ONEMKL_TABLE_ENTRY(dsdot_usm_sycl, onemkl::mklcpu::dot),
+    ONEMKL_TABLE_ENTRY(cdotc_usm_sycl, onemkl::mklcpu::dotc),
+    ONEMKL_TABLE_ENTRY(zdotc_usm_sycl, onemkl::mklcpu::dotc),
+    ONEMKL_TABLE_ENTRY(cdotu_usm_sycl, onemkl::mklcpu::dotu),
+    ONEMKL_TABLE_ENTRY(zdotu_usm_sycl, onemkl::mklcpu::dotu),
+    ONEMKL_TABLE_ENTRY(isamin_usm_sycl, onemkl::mklcpu::iamin),
+    ONEMKL_TABLE_ENTRY(idamin_usm_sycl, onemkl::mklcpu::iamin),
+    ONEMKL_TABLE_ENTRY(icamin_usm_sycl, onemkl::mklcpu::iamin),
+    ONEMKL_TABLE_ENTRY(izamin_usm_sycl, onemkl::mklcpu::iamin),
+    ONEMKL_TABLE_ENTRY(isamax_usm_sycl, onemkl::mklcpu::iamax),
+    ONEMKL_TABLE_ENTRY(idamax_usm_sycl, onemkl::mklcpu::iamax),
+    ONEMKL_TABLE_ENTRY(icamax_usm_sycl, onemkl::mklcpu::iamax),
+    ONEMKL_TABLE_ENTRY(izamax_usm_sycl, onemkl::mklcpu::iamax),
+    ONEMKL_TABLE_ENTRY(snrm2_usm_sycl, onemkl::mklcpu::nrm2),
+    ONEMKL_TABLE_ENTRY(dnrm2_usm_sycl, onemkl::mklcpu::nrm2),
+    ONEMKL_TABLE_ENTRY(scnrm2_usm_sycl, onemkl::mklcpu::nrm2),
+    ONEMKL_TABLE_ENTRY(dznrm2_usm_sycl, onemkl::mklcpu::nrm2),
+    ONEMKL_TABLE_ENTRY(srot_usm_sycl, onemkl::mklcpu::rot),
+    ONEMKL_TABLE_ENTRY(drot_usm_sycl, onemkl::mklcpu::rot),
+    ONEMKL_TABLE_ENTRY(csrot_usm_sycl, onemkl::mklcpu::rot),
+    ONEMKL_TABLE_ENTRY(zdrot_usm_sycl, onemkl::mklcpu::rot),
+    ONEMKL_TABLE_ENTRY(srotg_usm_sycl, onemkl::mklcpu::rotg),
+    ONEMKL_TABLE_ENTRY(drotg_usm_sycl, onemkl::mklcpu::rotg),
+    ONEMKL_TABLE_ENTRY(crotg_usm_sycl, onemkl::mklcpu::rotg),
+    ONEMKL_TABLE_ENTRY(zrotg_usm_sycl, onemkl::mklcpu::rotg),
+    ONEMKL_TABLE_ENTRY(srotm_usm_sycl, onemkl::mklcpu::rotm),
+    ONEMKL_TABLE_ENTRY(drotm_usm_sycl, onemkl::mklcpu::rotm),
+    ONEMKL_TABLE_ENTRY(srotmg_usm_sycl, onemkl::mklcpu::rotmg),
+    ONEMKL_TABLE_ENTRY(drotmg_usm_sycl, onemkl::mklcpu::rotmg),
+    ONEMKL_TABLE_ENTRY(sscal_usm_sycl, onemkl::mklcpu::scal),
+    ONEMKL_TABLE_ENTRY(dscal_usm_sycl, onemkl::mklcpu::scal),
+    ONEMKL_TABLE_ENTRY(cscal_usm_sycl, onemkl::mklcpu::scal),
+    ONEMKL_TABLE_ENTRY(csscal_usm_sycl, onemkl::mklcpu::scal),
+    ONEMKL_TABLE_ENTRY(zscal_usm_sycl, onemkl::mklcpu::scal),
+    ONEMKL_TABLE_ENTRY(zdscal_usm_sycl, onemkl::mklcpu::scal),
+    ONEMKL_TABLE_ENTRY(sdsdot_usm_sycl, onemkl::mklcpu::sdsdot),
+    ONEMKL_TABLE_ENTRY(sswap_usm_sycl, onemkl::mklcpu::swap),
+    ONEMKL_TABLE_ENTRY(dswap_usm_sycl, onemkl::mklcpu::swap),
+    ONEMKL_TABLE_ENTRY(cswap_usm_sycl, onemkl::mklcpu::swap),
+    ONEMKL_TABLE_ENTRY(zswap_usm_sycl, onemkl::mklcpu::swap),
+    ONEMKL_TABLE_ENTRY(sgbmv_usm_sycl, onemkl::mklcpu::gbmv),
+    ONEMKL_TABLE_ENTRY(dgbmv_usm_sycl, onemkl::mklcpu::gbmv),
+    ONEMKL_TABLE_ENTRY(cgbmv_usm_sycl, onemkl::mklcpu::gbmv),
+    ONEMKL_TABLE_ENTRY(zgbmv_usm_sycl, onemkl::mklcpu::gbmv),
+    ONEMKL_TABLE_ENTRY(sgemv_usm_sycl, onemkl::mklcpu::gemv),
+    ONEMKL_TABLE_ENTRY(dgemv_usm_sycl, onemkl::mklcpu::gemv),
+    ONEMKL_TABLE_ENTRY(cgemv_usm_sycl, onemkl::mklcpu::gemv),
+    ONEMKL_TABLE_ENTRY(zgemv_usm_sycl, onemkl::mklcpu::gemv),
+    ONEMKL_TABLE_ENTRY(sger_usm_sycl, onemkl::mklcpu::ger),
+    ONEMKL_TABLE_ENTRY(dger_usm_sycl, onemkl::mklcpu::ger),
+    ONEMKL_TABLE_ENTRY(cgerc_usm_sycl, onemkl::mklcpu::gerc),
+    ONEMKL_TABLE_ENTRY(zgerc_usm_sycl, onemkl::mklcpu::gerc),
+    ONEMKL_TABLE_ENTRY(cgeru_usm_sycl, onemkl::mklcpu::geru),
+    ONEMKL_TABLE_ENTRY(zgeru_usm_sycl, onemkl::mklcpu::geru),
+    ONEMKL_TABLE_ENTRY(chbmv_usm_sycl, onemkl::mklcpu::hbmv),
+    ONEMKL_TABLE_ENTRY(zhbmv_usm_sycl, onemkl::mklcpu::hbmv),
+    ONEMKL_TABLE_ENTRY(chemv_usm_sycl, onemkl::mklcpu::hemv),
+    ONEMKL_TABLE_ENTRY(zhemv_usm_sycl, onemkl::mklcpu::hemv),
+    ONEMKL_TABLE_ENTRY(cher_usm_sycl, onemkl::mklcpu::her),
+    ONEMKL_TABLE_ENTRY(zher_usm_sycl, onemkl::mklcpu::her),
+    ONEMKL_TABLE_ENTRY(cher2_usm_sycl, onemkl::mklcpu::her2),
+    ONEMKL_TABLE_ENTRY(zher2_usm_sycl, onemkl::mklcpu::her2),
+    ONEMKL_TABLE_ENTRY(chpmv_usm_sycl, onemkl::mklcpu::hpmv),
+    ONEMKL_TABLE_ENTRY(zhpmv_usm_sycl, onemkl::mklcpu::hpmv),
+    ONEMKL_TABLE_ENTRY(chpr_usm_sycl, onemkl::mklcpu::hpr),
+    ONEMKL_TABLE_ENTRY(zhpr_usm_sycl, onemkl::mklcpu::hpr),
+    ONEMKL_TABLE_ENTRY(chpr2_usm_sycl, onemkl::mklcpu::hpr2),
+    ONEMKL_TABLE_ENTRY(zhpr2_usm_sycl, onemkl::mklcpu::hpr2),
+    ONEMKL_TABLE_ENTRY(ssbmv_usm_sycl, onemkl::mklcpu::sbmv),
+    ONEMKL_TABLE_ENTRY(dsbmv_usm_sycl, onemkl::mklcpu::sbmv),
+    ONEMKL_TABLE_ENTRY(sspmv_usm_sycl, onemkl::mklcpu::spmv),
+    ONEMKL_TABLE_ENTRY(dspmv_usm_sycl, onemkl::mklcpu::spmv),
+    ONEMKL_TABLE_ENTRY(sspr_usm_sycl, onemkl::mklcpu::spr),
+    ONEMKL_TABLE_ENTRY(dspr_usm_sycl, onemkl::mklcpu::spr),
+    ONEMKL_TABLE_ENTRY(sspr2_usm_sycl, onemkl::mklcpu::spr2),
+    ONEMKL_TABLE_ENTRY(dspr2_usm_sycl, onemkl::mklcpu::spr2),
+    ONEMKL_TABLE_ENTRY(ssymv_usm_sycl, onemkl::mklcpu::symv),
+    ONEMKL_TABLE_ENTRY(dsymv_usm_sycl, onemkl::mklcpu::symv),
+    ONEMKL_TABLE_ENTRY(ssyr_usm_sycl, onemkl::mklcpu::syr),
+    ONEMKL_TABLE_ENTRY(dsyr_usm_sycl, onemkl::mklcpu::syr),
+    ONEMKL_TABLE_ENTRY(ssyr2_usm_sycl, onemkl::mklcpu::syr2),
+    ONEMKL_TABLE_ENTRY(dsyr2_usm_sycl, onemkl::mklcpu::syr2),
+    ONEMKL_TABLE_ENTRY(stbmv_usm_sycl, onemkl::mklcpu::tbmv),
+    ONEMKL_TABLE_ENTRY(dtbmv_usm_sycl, onemkl::mklcpu::tbmv),
+    ONEMKL_TABLE_ENTRY(ctbmv_usm_sycl, onemkl::mklcpu::tbmv),
+    ONEMKL_TABLE_ENTRY(ztbmv_usm_sycl, onemkl::mklcpu::tbmv),
+    ONEMKL_TABLE_ENTRY(stbsv_usm_sycl, onemkl::mklcpu::tbsv),
+    ONEMKL_TABLE_ENTRY(dtbsv_usm_sycl, onemkl::mklcpu::tbsv),
+    ONEMKL_TABLE_ENTRY(ctbsv_usm_sycl, onemkl::mklcpu::tbsv),
+    ONEMKL_TABLE_ENTRY(ztbsv_usm_sycl, onemkl::mklcpu::tbsv),
+    ONEMKL_TABLE_ENTRY(stpmv_usm_sycl, onemkl::mklcpu::tpmv),
+    ONEMKL_TABLE_ENTRY(dtpmv_usm_sycl, onemkl::mklcpu::tpmv),
+    ONEMKL_TABLE_ENTRY(ctpmv_usm_sycl, onemkl::mklcpu::tpmv),
+    ONEMKL_TABLE_ENTRY(ztpmv_usm_sycl, onemkl::mklcpu::tpmv),
+    ONEMKL_TABLE_ENTRY(stpsv_usm_sycl, onemkl::mklcpu::tpsv),
+    ONEMKL_TABLE_ENTRY(dtpsv_usm_sycl, onemkl::mklcpu::tpsv),
+    ONEMKL_TABLE_ENTRY(ctpsv_usm_sycl, onemkl::mklcpu::tpsv),
+    ONEMKL_TABLE_ENTRY(ztpsv_usm_sycl, onemkl::mklcpu::tpsv),
+    ONEMKL_TABLE_ENTRY(strmv_usm_sycl, onemkl::mklcpu::trmv),
+    ONEMKL_TABLE_ENTRY(dtrmv_usm_sycl, onemkl::mklcpu::trmv),
+    ONEMKL_TABLE_ENTRY(ctrmv_usm_sycl, onemkl::mklcpu::trmv),
+    ONEMKL_TABLE_ENTRY(ztrmv_usm_sycl, onemkl::mklcpu::trmv),
+    ONEMKL_TABLE_ENTRY(strsv_usm_sycl, onemkl::mklcpu::trsv),
+    ONEMKL_TABLE_ENTRY(dtrsv_usm_sycl, onemkl::mklcpu::trsv),
+    ONEMKL_TABLE_ENTRY(ctrsv_usm_sycl, onemkl::mklcpu::trsv),
+    ONEMKL_TABLE_ENTRY(ztrsv_usm_sycl, onemkl::mklcpu::trsv),
+    ONEMKL_TABLE_ENTRY(sgemm_usm_sycl, onemkl::mklcpu::gemm),
+    ONEMKL_TABLE_ENTRY(dgemm_usm_sycl, onemkl::mklcpu::gemm),
+    ONEMKL_TABLE_ENTRY(cgemm_usm_sycl, onemkl::mklcpu::gemm),
+    ONEMKL_TABLE_ENTRY(zgemm_usm_sycl, onemkl::mklcpu::gemm),
+    ONEMKL_TABLE_ENTRY(gemm_bf16bf16bf16_usm_sycl, onemkl::mklcpu::gemm),
+    ONEMKL_TABLE_ENTRY(chemm_usm_sycl, onemkl::mklcpu::hemm),
+    ONEMKL_TABLE_ENTRY(zhemm_usm_sycl, onemkl::mklcpu::hemm),
+    ONEMKL_TABLE_ENTRY(cherk_usm_sycl, onemkl::mklcpu::herk),
+    ONEMKL_TABLE_ENTRY(zherk_usm_sycl, onemkl::mklcpu::herk),
+    ONEMKL_TABLE_ENTRY(cher2k_usm_sycl, onemkl::mklcpu::her2k),
+    ONEMKL_TABLE_ENTRY(zher2k_usm_sycl, onemkl::mklcpu::her2k),
+    ONEMKL_TABLE_ENTRY(ssymm_usm_sycl, onemkl::mklcpu::symm),
+    ONEMKL_TABLE_ENTRY(dsymm_usm_sycl, onemkl::mklcpu::symm),
+    ONEMKL_TABLE_ENTRY(csymm_usm_sycl, onemkl::mklcpu::symm),
+    ONEMKL_TABLE_ENTRY(zsymm_usm_sycl, onemkl::mklcpu::symm),
+    ONEMKL_TABLE_ENTRY(ssyrk_usm_sycl, onemkl::mklcpu::syrk),
+    ONEMKL_TABLE_ENTRY(dsyrk_usm_sycl, onemkl::mklcpu::syrk),
+    ONEMKL_TABLE_ENTRY(csyrk_usm_sycl, onemkl::mklcpu::syrk),
+    ONEMKL_TABLE_ENTRY(zsyrk_usm_sycl, onemkl::mklcpu::syrk),
+    ONEMKL_TABLE_ENTRY(ssyr2k_usm_sycl, onemkl::mklcpu::syr2k),
+    ONEMKL_TABLE_ENTRY(dsyr2k_usm_sycl, onemkl::mklcpu::syr2k),
+    ONEMKL_TABLE_ENTRY(csyr2k_usm_sycl, onemkl::mklcpu::syr2k),
+    ONEMKL_TABLE_ENTRY(zsyr2k_usm_sycl, onemkl::mklcpu::syr2k),
+    ONEMKL_TABLE_ENTRY(strmm_usm_sycl, onemkl::mklcpu::trmm),
+    ONEMKL_TABLE_ENTRY(dtrmm_usm_sycl, onemkl::mklcpu::trmm),
+    ONEMKL_TABLE_ENTRY(ctrmm_usm_sycl, onemkl::mklcpu::trmm),
+    ONEMKL_TABLE_ENTRY(ztrmm_usm_sycl, onemkl::mklcpu::trmm),
+    ONEMKL_TABLE_ENTRY(strsm_usm_sycl, onemkl::mklcpu::trsm),
+    ONEMKL_TABLE_ENTRY(dtrsm_usm_sycl, onemkl::mklcpu::trsm),
+    ONEMKL_TABLE_ENTRY(ctrsm_usm_sycl, onemkl::mklcpu::trsm),
+    ONEMKL_TABLE_ENTRY(ztrsm_usm_sycl, onemkl::mklcpu::trsm),
+    ONEMKL_TABLE_ENTRY(sgemm_batch_group_usm_sycl, onemkl::mklcpu::gemm_batch),
+    ONEMKL_TABLE_ENTRY(dgemm_batch_group_usm_sycl, onemkl::mklcpu::gemm_batch),
+    ONEMKL_TABLE_ENTRY(cgemm_batch_group_usm_sycl, onemkl::mklcpu::gemm_batch),
+    ONEMKL_TABLE_ENTRY(zgemm_batch_group_usm_sycl, onemkl::mklcpu::gemm_batch),
+    ONEMKL_TABLE_ENTRY(sgemm_batch_strided_usm_sycl, onemkl::mklcpu::gemm_batch),
+    ONEMKL_TABLE_ENTRY(dgemm_batch_strided_usm_sycl, onemkl::mklcpu::gemm_batch),
+    ONEMKL_TABLE_ENTRY(cgemm_batch_strided_usm_sycl, onemkl::mklcpu::gemm_batch),
+    ONEMKL_TABLE_ENTRY(zgemm_batch_strided_usm_sycl, onemkl::mklcpu::gemm_batch),
+    ONEMKL_TABLE_ENTRY(strsm_batch_group_usm_sycl, onemkl::mklcpu::trsm_batch),
+    ONEMKL_TABLE_ENTRY(dtrsm_batch_group_usm_sycl, onemkl::mklcpu::trsm_batch),
+    ONEMKL_TABLE_ENTRY(ctrsm_batch_group_usm_sycl, onemkl::mklcpu::trsm_batch),
+    ONEMKL_TABLE_ENTRY(ztrsm_batch_group_usm_sycl, onemkl::mklcpu::trsm_batch),
+    ONEMKL_TABLE_ENTRY(strsm_batch_strided_usm_sycl, onemkl::mklcpu::trsm_batch),
+    ONEMKL_TABLE_ENTRY(dtrsm_batch_strided_usm_sycl, onemkl::mklcpu::trsm_batch),
+    ONEMKL_TABLE_ENTRY(ctrsm_batch_strided_usm_sycl, onemkl::mklcpu::trsm_batch),
+    ONEMKL_TABLE_ENTRY(ztrsm_batch_strided_usm_sycl, onemkl::mklcpu::trsm_batch),
+    ONEMKL_TABLE_ENTRY(gemm_f16f16f32_ext_usm_sycl, onemkl::mklcpu::gemm_ext),
+    ONEMKL_TABLE_ENTRY(gemm_bf16bf16f32_ext_usm_sycl, onemkl::mklcpu::gemm_ext),
+    ONEMKL_TABLE_ENTRY(gemm_s8u8s32_ext_usm_sycl, onemkl::mklcpu::gemm_ext),
+    ONEMKL_TABLE_ENTRY(sgemmt_usm_sycl, onemkl::mklcpu::gemmt),
+    ONEMKL_TABLE_ENTRY(dgemmt_usm_sycl, onemkl::mklcpu::gemmt),
+    ONEMKL_TABLE_ENTRY(cgemmt_usm_sycl, onemkl::mklcpu::gemmt),
+    ONEMKL_TABLE_ENTRY(zgemmt_usm_sycl, onemkl::mklcpu::gemmt),
+    ONEMKL_TABLE_ENTRY(fused_begin_sycl, onemkl::mklcpu::fused_begin),
+    ONEMKL_TABLE_ENTRY(fused_end_sycl, onemkl::mklcpu::fused_end),
+    ONEMKL_TABLE_ENTRY(set_num_threads_sycl, onemkl::mklcpu::set_num_threads),
+    ONEMKL_TABLE_ENTRY(set_task_arena_sycl, onemkl::mklcpu::set_task_arena),
+    ONEMKL_TABLE_ENTRY(sgemm_pack_get_size_sycl, onemkl::mklcpu::sgemm_pack_get_size),
+    ONEMKL_TABLE_ENTRY(sgemm_pack_sycl, onemkl::mklcpu::gemm_pack),
+    ONEMKL_TABLE_ENTRY(sgemm_pack_usm_sycl, onemkl::mklcpu::gemm_pack),
+    ONEMKL_TABLE_ENTRY(sgemm_compute_sycl, onemkl::mklcpu::gemm_compute),
+    ONEMKL_TABLE_ENTRY(sgemm_compute_usm_sycl, onemkl::mklcpu::gemm_compute),
+    ONEMKL_TABLE_ENTRY(dgemm_pack_get_size_sycl, onemkl::mklcpu::dgemm_pack_get_size),
+    ONEMKL_TABLE_ENTRY(dgemm_pack_sycl, onemkl::mklcpu::gemm_pack),
+    ONEMKL_TABLE_ENTRY(dgemm_pack_usm_sycl, onemkl::mklcpu::gemm_pack),
+    ONEMKL_TABLE_ENTRY(dgemm_compute_sycl, onemkl::mklcpu::gemm_compute),
+    ONEMKL_TABLE_ENTRY(dgemm_compute_usm_sycl, onemkl::mklcpu::gemm_compute),
+    ONEMKL_TABLE_ENTRY(stats_enable_sycl, onemkl::mklcpu::stats_enable),
+    ONEMKL_TABLE_ENTRY(stats_read_sycl, onemkl::mklcpu::stats_read),
+};
+
+extern "C" ONEMKL_EXPORT function_index_t WRAPPER_TABLE = {
+    WRAPPER_VERSION, sizeof(wrapper_entries) / sizeof(wrapper_entries[0]), wrapper_entries
 };
@@ -18,346 +18,358 @@
 *******************************************************************************/
 
 #include "blas/function_table.hpp"
+#include "onemkl/detail/config.hpp"
 #include "onemkl/blas/detail/mklgpu/onemkl_blas_mklgpu.hpp"
 
-#define WRAPPER_VERSION 1
+#define WRAPPER_VERSION 2
 
-extern "C" ONEMKL_EXPORT function_table_t mkl_blas_table = {
-    WRAPPER_VERSION,
-    onemkl::mklgpu::asum,
-    onemkl::mklgpu::asum,
-    onemkl::mklgpu::asum,
-    onemkl::mklgpu::asum,
-    onemkl::mklgpu::axpy,
-    onemkl::mklgpu::axpy,
-    onemkl::mklgpu::axpy,
-    onemkl::mklgpu::axpy,
-    onemkl::mklgpu::copy,
-    onemkl::mklgpu::copy,
-    onemkl::mklgpu::copy,
-    onemkl::mklgpu::copy,
-    onemkl::mklgpu::dot,
-    onemkl::mklgpu::dot,
-    onemkl::mklgpu::dot,
-    onemkl::mklgpu::dotc,
-    onemkl::mklgpu::dotc,
-    onemkl::mklgpu::dotu,
-    onemkl::mklgpu::dotu,
-    onemkl::mklgpu::iamin,
-    onemkl::mklgpu::iamin,
-    onemkl::mklgpu::iamin,
-    onemkl::mklgpu::iamin,
-    onemkl::mklgpu::iamax,
-    onemkl::mklgpu::iamax,
-    onemkl::mklgpu::iamax,
-    onemkl::mklgpu::iamax,
-    onemkl::mklgpu::nrm2,
-    onemkl::mklgpu::nrm2,
-    onemkl::mklgpu::nrm2,
-    onemkl::mklgpu::nrm2,
-    onemkl::mklgpu::rot,
-    onemkl::mklgpu::rot,
-    onemkl::mklgpu::rot,
-    onemkl::mklgpu::rot,
-    onemkl::mklgpu::rotg,
-    onemkl::mklgpu::rotg,
-    onemkl::mklgpu::rotg,
-    onemkl::mklgpu::rotg,
-    onemkl::mklgpu::rotm,
-    onemkl::mklgpu::rotm,
-    onemkl::mklgpu::rotmg,
-    onemkl::mklgpu::rotmg,
-    onemkl::mklgpu::scal,
-    onemkl::mklgpu::scal,
-    onemkl::mklgpu::scal,
-    onemkl::mklgpu::scal,
-    onemkl::mklgpu::scal,
-    onemkl::mklgpu::scal,
-    onemkl::mklgpu::sdsdot,
-    onemkl::mklgpu::swap,
-    onemkl::mklgpu::swap,
-    onemkl::mklgpu::swap,
-    onemkl::mklgpu::swap,
-    onemkl::mklgpu::gbmv,
-    onemkl::mklgpu::gbmv,
-    onemkl::mklgpu::gbmv,
-    onemkl::mklgpu::gbmv,
-    onemkl::mklgpu::gemv,
-    onemkl::mklgpu::gemv,
-    onemkl::mklgpu::gemv,
-    onemkl::mklgpu::gemv,
-    onemkl::mklgpu::ger,
-    onemkl::mklgpu::ger,
-    onemkl::mklgpu::gerc,
-    onemkl::mklgpu::gerc,
-    onemkl::mklgpu::geru,
-    onemkl::mklgpu::geru,
-    onemkl::mklgpu::hbmv,
-    onemkl::mklgpu::hbmv,
-    onemkl::mklgpu::hemv,
-    onemkl::mklgpu::hemv,
-    onemkl::mklgpu::her,
-    onemkl::mklgpu::her,
-    onemkl::mklgpu::her2,
-    onemkl::mklgpu::her2,
-    onemkl::mklgpu::hpmv,
-    onemkl::mklgpu::hpmv,
-    onemkl::mklgpu::hpr,
-    onemkl::mklgpu::hpr,
-    onemkl::mklgpu::hpr2,
-    onemkl::mklgpu::hpr2,
-    onemkl::mklgpu::sbmv,
-    onemkl::mklgpu::sbmv,
-    onemkl::mklgpu::spmv,
-    onemkl::mklgpu::spmv,
-    onemkl::mklgpu::spr,
-    onemkl::mklgpu::spr,
-    onemkl::mklgpu::spr2,
-    onemkl::mklgpu::spr2,
-    onemkl::mklgpu::symv,
-    onemkl::mklgpu::symv,
-    onemkl::mklgpu::syr,
-    onemkl::mklgpu::syr,
-    onemkl::mklgpu::syr2,
-    onemkl::mklgpu::syr2,
-    onemkl::mklgpu::tbmv,
-    onemkl::mklgpu::tbmv,
-    onemkl::mklgpu::tbmv,
-    onemkl::mklgpu::tbmv,
-    onemkl::mklgpu::tbsv,
-    onemkl::mklgpu::tbsv,
-    onemkl::mklgpu::tbsv,
-    onemkl::mklgpu::tbsv,
-    onemkl::mklgpu::tpmv,
-    onemkl::mklgpu::tpmv,
-    onemkl::mklgpu::tpmv,
-    onemkl::mklgpu::tpmv,
-    onemkl::mklgpu::tpsv,
-    onemkl::mklgpu::tpsv,
-    onemkl::mklgpu::tpsv,
-    onemkl::mklgpu::tpsv,
-    onemkl::mklgpu::trmv,
-    onemkl::mklgpu::trmv,
-    onemkl::mklgpu::trmv,
-    onemkl::mklgpu::trmv,
-    onemkl::mklgpu::trsv,
-    onemkl::mklgpu::trsv,
-    onemkl::mklgpu::trsv,
-    onemkl::mklgpu::trsv,
-    onemkl::mklgpu::gemm,
-    onemkl::mklgpu::gemm,
-    onemkl::mklgpu::gemm,
-    onemkl::mklgpu::gemm,
-    onemkl::mklgpu::gemm,
-    onemkl::mklgpu::hemm,
-    onemkl::mklgpu::hemm,
-    onemkl::mklgpu::herk,
-    onemkl::mklgpu::herk,
-    onemkl::mklgpu::her2k,
-    onemkl::mklgpu::her2k,
-    onemkl::mklgpu::symm,
-    onemkl::mklgpu::symm,
-    onemkl::mklgpu::symm,
-    onemkl::mklgpu::symm,
-    onemkl::mklgpu::syrk,
-    onemkl::mklgpu::syrk,
-    onemkl::mklgpu::syrk,
-    onemkl::mklgpu::syrk,
-    onemkl::mklgpu::syr2k,
-    onemkl::mklgpu::syr2k,
-    onemkl::mklgpu::syr2k,
-    onemkl::mklgpu::syr2k,
-    onemkl::mklgpu::trmm,
-    onemkl::mklgpu::trmm,
-    onemkl::mklgpu::trmm,
-    onemkl::mklgpu::trmm,
-    onemkl::mklgpu::trsm,
-    onemkl::mklgpu::trsm,
-    onemkl::mklgpu::trsm,
-    onemkl::mklgpu::trsm,
-    onemkl::mklgpu::gemm_batch,
-    onemkl::mklgpu::gemm_batch,
-    onemkl::mklgpu::gemm_batch,
-    onemkl::mklgpu::gemm_batch,
-    onemkl::mklgpu::trsm_batch,
-    onemkl::mklgpu::trsm_batch,
-    onemkl::mklgpu::trsm_batch,
-    onemkl::mklgpu::trsm_batch,
-    onemkl::mklgpu::gemmt,
-    onemkl::mklgpu::gemmt,
-    onemkl::mklgpu::gemmt,
-    onemkl::mklgpu::gemmt,
-    onemkl::mklgpu::gemm_ext,
-    onemkl::mklgpu::gemm_ext,
-    onemkl::mklgpu::gemm_ext,
-    onemkl::mklgpu::gemm_ext,
-    onemkl::mklgpu::gemm_ext,
-    onemkl::mklgpu::gemm_ext,
-    onemkl::mklgpu::gemm_ext,
-    onemkl::mklgpu::asum,
-    onemkl::mklgpu::asum,
-    onemkl::mklgpu::asum,
-    onemkl::mklgpu::asum,
-    onemkl::mklgpu::axpy,
-    onemkl::mklgpu::axpy,
-    onemkl::mklgpu::axpy,
-    onemkl::mklgpu::axpy,
-    onemkl::mklgpu::axpy_batch,
-    onemkl::mklgpu::axpy_batch,
-    onemkl::mklgpu::axpy_batch,
-    onemkl::mklgpu::axpy_batch,
-    onemkl::mklgpu::copy,
-    onemkl::mklgpu::copy,
-    onemkl::mklgpu::copy,
-    onemkl::mklgpu::copy,
-    onemkl::mklgpu::dot,
-    onemkl::mklgpu::dot,
-    onemkl::mklgpu::dot,
-    onemkl::mklgpu::dotc,
-    onemkl::mklgpu::dotc,
-    onemkl::mklgpu::dotu,
-    onemkl::mklgpu::dotu,
-    onemkl::mklgpu::iamin,
-    onemkl::mklgpu::iamin,
-    onemkl::mklgpu::iamin,
-    onemkl::mklgpu::iamin,
-    onemkl::mklgpu::iamax,
-    onemkl::mklgpu::iamax,
-    onemkl::mklgpu::iamax,
-    onemkl::mklgpu::iamax,
-    onemkl::mklgpu::nrm2,
-    onemkl::mklgpu::nrm2,
-    onemkl::mklgpu::nrm2,
-    onemkl::mklgpu::nrm2,
-    onemkl::mklgpu::rot,
-    onemkl::mklgpu::rot,
-    onemkl::mklgpu::rot,
-    onemkl::mklgpu::rot,
-    onemkl::mklgpu::rotg,
-    onemkl::mklgpu::rotg,
-    onemkl::mklgpu::rotg,
-    onemkl::mklgpu::rotg,
-    onemkl::mklgpu::rotm,
-    onemkl::mklgpu::rotm,
-    onemkl::mklgpu::rotmg,
-    onemkl::mklgpu::rotmg,
-    onemkl::mklgpu::scal,
-    onemkl::mklgpu::scal,
-    onemkl::mklgpu::scal,
-    onemkl::mklgpu::scal,
-    onemkl::mklgpu::scal,
-    onemkl::mklgpu::scal,
-    onemkl::mklgpu::sdsdot,
-    onemkl::mklgpu::swap,
-    onemkl::mklgpu::swap,
-    onemkl::mklgpu::swap,
-    onemkl::mklgpu::swap,
-    onemkl::mklgpu::gbmv,
-    onemkl::mklgpu::gbmv,
-    onemkl::mklgpu::gbmv,
-    onemkl::mklgpu::gbmv,
-    onemkl::mklgpu::gemv,
-    onemkl::mklgpu::gemv,
-    onemkl::mklgpu::gemv,
-    onemkl::mklgpu::gemv,
-    onemkl::mklgpu::ger,
-    onemkl::mklgpu::ger,
-    onemkl::mklgpu::gerc,
-    onemkl::mklgpu::gerc,
-    onemkl::mklgpu::geru,
-    onemkl::mklgpu::geru,
-    onemkl::mklgpu::hbmv,
-    onemkl::mklgpu::hbmv,
-    onemkl::mklgpu::hemv,
-    onemkl::mklgpu::hemv,
-    onemkl::mklgpu::her,
-    onemkl::mklgpu::her,
-    onemkl::mklgpu::her2,
-    onemkl::mklgpu::her2,
-    onemkl::mklgpu::hpmv,
-    onemkl::mklgpu::hpmv,
-    onemkl::mklgpu::hpr,
-    onemkl::mklgpu::hpr,
-    onemkl::mklgpu::hpr2,
-    onemkl::mklgpu::hpr2,
-    onemkl::mklgpu::sbmv,
-    onemkl::mklgpu::sbmv,
-    onemkl::mklgpu::spmv,
-    onemkl::mklgpu::spmv,
-    onemkl::mklgpu::spr,
-    onemkl::mklgpu::spr,
-    onemkl::mklgpu::spr2,
-    onemkl::mklgpu::spr2,
-    onemkl::mklgpu::symv,
-    onemkl::mklgpu::symv,
-    onemkl::mklgpu::syr,
-    onemkl::mklgpu::syr,
-    onemkl::mklgpu::syr2,
-    onemkl::mklgpu::syr2,
-    onemkl::mklgpu::tbmv,
-    onemkl::mklgpu::tbmv,
-    onemkl::mklgpu::tbmv,
-    onemkl::mklgpu::tbmv,
-    onemkl::mklgpu::tbsv,
-    onemkl::mklgpu::tbsv,
-    onemkl::mklgpu::tbsv,
-    onemkl::mklgpu::tbsv,
-    onemkl::mklgpu::tpmv,
-    onemkl::mklgpu::tpmv,
-    onemkl::mklgpu::tpmv,
-    onemkl::mklgpu::tpmv,
-    onemkl::mklgpu::tpsv,
-    onemkl::mklgpu::tpsv,
-    onemkl::mklgpu::tpsv,
-    onemkl::mklgpu::tpsv,
-    onemkl::mklgpu::trmv,
-    onemkl::mklgpu::trmv,
-    onemkl::mklgpu::trmv,
-    onemkl::mklgpu::trmv,
-    onemkl::mklgpu::trsv,
-    onemkl::mklgpu::trsv,
-    onemkl::mklgpu::trsv,
-    onemkl::mklgpu::trsv,
-    onemkl::mklgpu::gemm,
-    onemkl::mklgpu::gemm,
-    onemkl::mklgpu::gemm,
-    onemkl::mklgpu::gemm,
-    onemkl::mklgpu::hemm,
-    onemkl::mklgpu::hemm,
-    onemkl::mklgpu::herk,
-    onemkl::mklgpu::herk,
-    onemkl::mklgpu::her2k,
-    onemkl::mklgpu::her2k,
-    onemkl::mklgpu::symm,
-    onemkl::mklgpu::symm,
-    onemkl::mklgpu::symm,
-    onemkl::mklgpu::symm,
-    onemkl::mklgpu::syrk,
-    onemkl::mklgpu::syrk,
-    onemkl::mklgpu::syrk,
-    onemkl::mklgpu::syrk,
-    onemkl::mklgpu::syr2k,
-    onemkl::mklgpu::syr2k,
-    onemkl::mklgpu::syr2k,
-    onemkl::mklgpu::syr2k,
-    onemkl::mklgpu::trmm,
-    onemkl::mklgpu::trmm,
-    onemkl::mklgpu::trmm,
-    onemkl::mklgpu::trmm,
-    onemkl::mklgpu::trsm,
-    onemkl::mklgpu::trsm,
-    onemkl::mklgpu::trsm,
-    onemkl::mklgpu::trsm,
-    onemkl::mklgpu::gemm_batch,
-    onemkl::mklgpu::gemm_batch,
-    onemkl::mklgpu::gemm_batch,
-    onemkl::mklgpu::gemm_batch,
-    onemkl::mklgpu::gemm_batch,
-    onemkl::mklgpu::gemm_batch,
-    onemkl::mklgpu::gemm_batch,
-    onemkl::mklgpu::gemm_batch,
-    onemkl::mklgpu::gemmt,
-    onemkl::mklgpu::gemmt,
-    onemkl::mklgpu::gemmt,
-    onemkl::mklgpu::gemmt,
+// Shared backends are loaded with dlopen and looked up by a common name, static
+//  ones are linked into the loader and need a name of their own.
+#ifdef BUILD_SHARED_LIBS
+    #define WRAPPER_TABLE mkl_blas_table
+#else
+    #define WRAPPER_TABLE mkl_blas_mklgpu_table
+#endif
+
+static const function_table_entry_t wrapper_entries[] = {
+    ONEMKL_TABLE_ENTRY(scasum_sycl, onemkl::mklgpu::asum),
+    ONEMKL_TABLE_ENTRY(dzasum_sycl, onemkl::mklgpu::asum),
+    ONEMKL_TABLE_ENTRY(sasum_sycl, onemkl::mklgpu::asum),
+    ONEMKL_TABLE_ENTRY(dasum_sycl, onemkl::mklgpu::asum),
+    ONEMKL_TABLE_ENTRY(saxpy_sycl, onemkl::mklgpu::axpy),
+    ONEMKL_TABLE_ENTRY(daxpy_sycl, onemkl::mklgpu::axpy),
+    ONEMKL_TABLE_ENTRY(caxpy_sycl, onemkl::mklgpu::axpy),
+    ONEMKL_TABLE_ENTRY(zaxpy_sycl, onemkl::mklgpu::axpy),
+    ONEMKL_TABLE_ENTRY(scopy_sycl, onemkl::mklgpu::copy),
+    ONEMKL_TABLE_ENTRY(dcopy_sycl, onemkl::mklgpu::copy),
+    ONEMKL_TABLE_ENTRY(ccopy_sycl, onemkl::mklgpu::copy),
+    ONEMKL_TABLE_ENTRY(zcopy_sycl, onemkl::mklgpu::copy),
+    ONEMKL_TABLE_ENTRY(sdot_sycl, onemkl::mklgpu::dot),
+    ONEMKL_TABLE_ENTRY(ddot_sycl, onemkl::mklgpu::dot),
+    ONEMKL_TABLE_ENTRY(dsdot_sycl, onemkl::mklgpu::dot),
+    ONEMKL_TABLE_ENTRY(cdotc_sycl, onemkl::mklgpu::dotc),
+    ONEMKL_TABLE_ENTRY(zdotc_sycl, onemkl::mklgpu::dotc),
+    ONEMKL_TABLE_ENTRY(cdotu_sycl, onemkl::mklgpu::dotu),
+    ONEMKL_TABLE_ENTRY(zdotu_sycl, onemkl::mklgpu::dotu),
+    ONEMKL_TABLE_ENTRY(isamin_sycl, onemkl::mklgpu::iamin),
+    ONEMKL_TABLE_ENTRY(idamin_sycl, onemkl::mklgpu::iamin),
+    ONEMKL_TABLE_ENTRY(icamin_sycl, onemkl::mklgpu::iamin),
+    ONEMKL_TABLE_ENTRY(izamin_sycl, onemkl::mklgpu::iamin),
+    ONEMKL_TABLE_ENTRY(isamax_sycl, onemkl::mklgpu::iamax),
+    ONEMKL_TABLE_ENTRY(idamax_sycl, onemkl::mklgpu::iamax),
+    ONEMKL_TABLE_ENTRY(icamax_sycl, onemkl::mklgpu::iamax),
+    ONEMKL_TABLE_ENTRY(izamax_sycl, onemkl::mklgpu::iamax),
+    ONEMKL_TABLE_ENTRY(snrm2_sycl, onemkl::mklgpu::nrm2),
+    ONEMKL_TABLE_ENTRY(dnrm2_sycl, onemkl::mklgpu::nrm2),
+    ONEMKL_TABLE_ENTRY(scnrm2_sycl, onemkl::mklgpu::nrm2),
+    ONEMKL_TABLE_ENTRY(dznrm2_sycl, onemkl::mklgpu::nrm2),
+    ONEMKL_TABLE_ENTRY(srot_sycl, onemkl::mklgpu::rot),
+    ONEMKL_TABLE_ENTRY(drot_sycl, onemkl::mklgpu::rot),
+    ONEMKL_TABLE_ENTRY(csrot_sycl, onemkl::mklgpu::rot),
+    ONEMKL_TABLE_ENTRY(zdrot_sycl, onemkl::mklgpu::rot),
+    ONEMKL_TABLE_ENTRY(srotg_sycl, onemkl::mklgpu::rotg),
+    ONEMKL_TABLE_ENTRY(drotg_sycl, onemkl::mklgpu::rotg),
+    ONEMKL_TABLE_ENTRY(crotg_sycl, onemkl::mklgpu::rotg),
+    ONEMKL_TABLE_ENTRY(zrotg_sycl, onemkl::mklgpu::rotg),
+    ONEMKL_TABLE_ENTRY(srotm_sycl, onemkl::mklgpu::rotm),
+    ONEMKL_TABLE_ENTRY(drotm_sycl, onemkl::mklgpu::rotm),
+    ONEMKL_TABLE_ENTRY(srotmg_sycl, onemkl::mklgpu::rotmg),
+    ONEMKL_TABLE_ENTRY(drotmg_sycl, onemkl::mklgpu::rotmg),
+    ONEMKL_TABLE_ENTRY(sscal_sycl, onemkl::mklgpu::scal),
+    ONEMKL_TABLE_ENTRY(dscal_sycl, onemkl::mklgpu::scal),
+    ONEMKL_TABLE_ENTRY(cscal_sycl, onemkl::mklgpu::scal),
+    ONEMKL_TABLE_ENTRY(csscal_sycl, onemkl::mklgpu::scal),
+    ONEMKL_TABLE_ENTRY(zscal_sycl, onemkl::mklgpu::scal),
+    ONEMKL_TABLE_ENTRY(zdscal_sycl, onemkl::mklgpu::scal),
+    ONEMKL_TABLE_ENTRY(sdsdot_sycl, onemkl::mklgpu::sdsdot),
+    ONEMKL_TABLE_ENTRY(sswap_sycl, onemkl::mklgpu::swap),
+    ONEMKL_TABLE_ENTRY(dswap_sycl, onemkl::mklgpu::swap),
+    ONEMKL_TABLE_ENTRY(cswap_sycl, onemkl::mklgpu::swap),
+    ONEMKL_TABLE_ENTRY(zswap_sycl, onemkl::mklgpu::swap),
+    ONEMKL_TABLE_ENTRY(sgbmv_sycl, onemkl::mklgpu::gbmv),
+    ONEMKL_TABLE_ENTRY(dgbmv_sycl, onemkl::mklgpu::gbmv),
+    ONEMKL_TABLE_ENTRY(cgbmv_sycl, onemkl::mklgpu::gbmv),
+    ONEMKL_TABLE_ENTRY(zgbmv_sycl, onemkl::mklgpu::gbmv),
+    ONEMKL_TABLE_ENTRY(sgemv_sycl, onemkl::mklgpu::gemv),
+    ONEMKL_TABLE_ENTRY(dgemv_sycl, onemkl::mklgpu::gemv),
+    ONEMKL_TABLE_ENTRY(cgemv_sycl, onemkl::mklgpu::gemv),
+    ONEMKL_TABLE_ENTRY(zgemv_sycl, onemkl::mklgpu::gemv),
+    ONEMKL_TABLE_ENTRY(sger_sycl, onemkl::mklgpu::ger),
+    ONEMKL_TABLE_ENTRY(dger_sycl, onemkl::mklgpu::ger),
+    ONEMKL_TABLE_ENTRY(cgerc_sycl, onemkl::mklgpu::gerc),
+    ONEMKL_TABLE_ENTRY(zgerc_sycl, onemkl::mklgpu::gerc),
+    ONEMKL_TABLE_ENTRY(cgeru_sycl, onemkl::mklgpu::geru),
+    ONEMKL_TABLE_ENTRY(zgeru_sycl, onemkl::mklgpu::geru),
+    ONEMKL_TABLE_ENTRY(chbmv_sycl, onemkl::mklgpu::hbmv),
+    ONEMKL_TABLE_ENTRY(zhbmv_sycl, onemkl::mklgpu::hbmv),
+    ONEMKL_TABLE_ENTRY(chemv_sycl, onemkl::mklgpu::hemv),
+    ONEMKL_TABLE_ENTRY(zhemv_sycl, onemkl::mklgpu::hemv),
+    ONEMKL_TABLE_ENTRY(cher_sycl, onemkl::mklgpu::her),
+    ONEMKL_TABLE_ENTRY(zher_sycl, onemkl::mklgpu::her),
+    ONEMKL_TABLE_ENTRY(cher2_sycl, onemkl::mklgpu::her2),
+    ONEMKL_TABLE_ENTRY(zher2_sycl, onemkl::mklgpu::her2),
+    ONEMKL_TABLE_ENTRY(chpmv_sycl, onemkl::mklgpu::hpmv),
+    ONEMKL_TABLE_ENTRY(zhpmv_sycl, onemkl::mklgpu::hpmv),
+    ONEMKL_TABLE_ENTRY(chpr_sycl, onemkl::mklgpu::hpr),
+    ONEMKL_TABLE_ENTRY(zhpr_sycl, onemkl::mklgpu::hpr),
+    ONEMKL_TABLE_ENTRY(chpr2_sycl, onemkl::mklgpu::hpr2),
+    ONEMKL_TABLE_ENTRY(zhpr2_sycl, onemkl::mklgpu::hpr2),
+    ONEMKL_TABLE_ENTRY(ssbmv_sycl, onemkl::mklgpu::sbmv),
+    ONEMKL_TABLE_ENTRY(dsbmv_sycl, onemkl::mklgpu::sbmv),
+    ONEMKL_TABLE_ENTRY(sspmv_sycl, onemkl::mklgpu::spmv),
+    ONEMKL_TABLE_ENTRY(dspmv_sycl, onemkl::mklgpu::spmv),
+    ONEMKL_TABLE_ENTRY(sspr_sycl, onemkl::mklgpu::spr),
+    ONEMKL_TABLE_ENTRY(dspr_sycl, onemkl::mklgpu::spr),
+    ONEMKL_TABLE_ENTRY(sspr2_sycl, onemkl::mklgpu::spr2),
+    ONEMKL_TABLE_ENTRY(dspr2_sycl, onemkl::mklgpu::spr2),
+    ONEMKL_TABLE_ENTRY(ssymv_sycl, onemkl::mklgpu::symv),
+    ONEMKL_TABLE_ENTRY(dsymv_sycl, onemkl::mklgpu::symv),
+    ONEMKL_TABLE_ENTRY(ssyr_sycl, onemkl::mklgpu::syr),
+    ONEMKL_TABLE_ENTRY(dsyr_sycl, onemkl::mklgpu::syr),
+    ONEMKL_TABLE_ENTRY(ssyr2_sycl, onemkl::mklgpu::syr2),
+    ONEMKL_TABLE_ENTRY(dsyr2_sycl, onemkl::mklgpu::syr2),
+    ONEMKL_TABLE_ENTRY(stbmv_sycl, onemkl::mklgpu::tbmv),
+    ONEMKL_TABLE_ENTRY(dtbmv_sycl, onemkl::mklgpu::tbmv),
+    ONEMKL_TABLE_ENTRY(ctbmv_sycl, onemkl::mklgpu::tbmv),
+    ONEMKL_TABLE_ENTRY(ztbmv_sycl, onemkl::mklgpu::tbmv),
+    ONEMKL_TABLE_ENTRY(stbsv_sycl, onemkl::mklgpu::tbsv),
+    ONEMKL_TABLE_ENTRY(dtbsv_sycl, onemkl::mklgpu::tbsv),
+    ONEMKL_TABLE_ENTRY(ctbsv_sycl, onemkl::mklgpu::tbsv),
+    ONEMKL_TABLE_ENTRY(ztbsv_sycl, onemkl::mklgpu::tbsv),
+    ONEMKL_TABLE_ENTRY(stpmv_sycl, onemkl::mklgpu::tpmv),
+    ONEMKL_TABLE_ENTRY(dtpmv_sycl, onemkl::mklgpu::tpmv),
+    ONEMKL_TABLE_ENTRY(ctpmv_sycl, onemkl::mklgpu::tpmv),
+    ONEMKL_TABLE_ENTRY(ztpmv_sycl, onemkl::mklgpu::tpmv),
+    ONEMKL_TABLE_ENTRY(stpsv_sycl, onemkl::mklgpu::tpsv),
+    ONEMKL_TABLE_ENTRY(dtpsv_sycl, onemkl::mklgpu::tpsv),
+    ONEMKL_TABLE_ENTRY(ctpsv_sycl, onemkl::mklgpu::tpsv),
+    ONEMKL_TABLE_ENTRY(ztpsv_sycl, onemkl::mklgpu::tpsv),
+    ONEMKL_TABLE_ENTRY(strmv_sycl, onemkl::mklgpu::trmv),
+    ONEMKL_TABLE_ENTRY(dtrmv_sycl, onemkl::mklgpu::trmv),
+    ONEMKL_TABLE_ENTRY(ctrmv_sycl, onemkl::mklgpu::trmv),
+    ONEMKL_TABLE_ENTRY(ztrmv_sycl, onemkl::mklgpu::trmv),
+    ONEMKL_TABLE_ENTRY(strsv_sycl, onemkl::mklgpu::trsv),
+    ONEMKL_TABLE_ENTRY(dtrsv_sycl, onemkl::mklgpu::trsv),
+    ONEMKL_TABLE_ENTRY(ctrsv_sycl, onemkl::mklgpu::trsv),
+    ONEMKL_TABLE_ENTRY(ztrsv_sycl, onemkl::mklgpu::trsv),
+    ONEMKL_TABLE_ENTRY(sgemm_sycl, onemkl::mklgpu::gemm),
+    ONEMKL_TABLE_ENTRY(dgemm_sycl, onemkl::mklgpu::gemm),
+    ONEMKL_TABLE_ENTRY(cgemm_sycl, onemkl::mklgpu::gemm),
+    ONEMKL_TABLE_ENTRY(zgemm_sycl, onemkl::mklgpu::gemm),
+    ONEMKL_TABLE_ENTRY(hgemm_sycl, onemkl::mklgpu::gemm),
+    ONEMKL_TABLE_ENTRY(chemm_sycl, onemkl::mklgpu::hemm),
+    ONEMKL_TABLE_ENTRY(zhemm_sycl, onemkl::mklgpu::hemm),
+    ONEMKL_TABLE_ENTRY(cherk_sycl, onemkl::mklgpu::herk),
+    ONEMKL_TABLE_ENTRY(zherk_sycl, onemkl::mklgpu::herk),
+    ONEMKL_TABLE_ENTRY(cher2k_sycl, onemkl::mklgpu::her2k),
+    ONEMKL_TABLE_ENTRY(zher2k_sycl, onemkl::mklgpu::her2k),
+    ONEMKL_TABLE_ENTRY(ssymm_sycl, onemkl::mklgpu::symm),
+    ONEMKL_TABLE_ENTRY(dsymm_sycl, onemkl::mklgpu::symm),
+    ONEMKL_TABLE_ENTRY(csymm_sycl, onemkl::mklgpu::symm),
+    ONEMKL_TABLE_ENTRY(zsymm_sycl, onemkl::mklgpu::symm),
+    ONEMKL_TABLE_ENTRY(ssyrk_sycl, onemkl::mklgpu::syrk),
+    ONEMKL_TABLE_ENTRY(dsyrk_sycl, onemkl::mklgpu::syrk),
+    ONEMKL_TABLE_ENTRY(csyrk_sycl, onemkl::mklgpu::syrk),
+    ONEMKL_TABLE_ENTRY(zsyrk_sycl, onemkl::mklgpu::syrk),
+    ONEMKL_TABLE_ENTRY(ssyr2k_sycl, onemkl::mklgpu::syr2k),
+    ONEMKL_TABLE_ENTRY(dsyr2k_sycl, onemkl::mklgpu::syr2k),
+    ONEMKL_TABLE_ENTRY(csyr2k_sycl, onemkl::mklgpu::syr2k),
+    ONEMKL_TABLE_ENTRY(zsyr2k_sycl, onemkl::mklgpu::syr2k),
+    ONEMKL_TABLE_ENTRY(strmm_sycl, onemkl::mklgpu::trmm),
+    ONEMKL_TABLE_ENTRY(dtrmm_sycl, onemkl::mklgpu::trmm),
+    ONEMKL_TABLE_ENTRY(ctrmm_sycl, onemkl::mklgpu::trmm),
+    ONEMKL_TABLE_ENTRY(ztrmm_sycl, onemkl::mklgpu::trmm),
+    ONEMKL_TABLE_ENTRY(strsm_sycl, onemkl::mklgpu::trsm),
+    ONEMKL_TABLE_ENTRY(dtrsm_sycl, onemkl::mklgpu::trsm),
+    ONEMKL_TABLE_ENTRY(ctrsm_sycl, onemkl::mklgpu::trsm),
+    ONEMKL_TABLE_ENTRY(ztrsm_sycl, onemkl::mklgpu::trsm),
+    ONEMKL_TABLE_ENTRY(sgemm_batch_strided_sycl, onemkl::mklgpu::gemm_batch),
+    ONEMKL_TABLE_ENTRY(dgemm_batch_strided_sycl, onemkl::mklgpu::gemm_batch),
+    ONEMKL_TABLE_ENTRY(cgemm_batch_strided_sycl, onemkl::mklgpu::gemm_batch),
+    ONEMKL_TABLE_ENTRY(zgemm_batch_strided_sycl, onemkl::mklgpu::gemm_batch),
+    ONEMKL_TABLE_ENTRY(strsm_batch_strided_sycl, onemkl::mklgpu::trsm_batch),
+    ONEMKL_TABLE_ENTRY(dtrsm_batch_strided_sycl, onemkl::mklgpu::trsm_batch),
+    ONEMKL_TABLE_ENTRY(ctrsm_batch_strided_sycl, onemkl::mklgpu::trsm_batch),
+    ONEMKL_TABLE_ENTRY(ztrsm_batch_strided_sycl, onemkl::mklgpu::trsm_batch),
+    ONEMKL_TABLE_ENTRY(sgemmt_sycl, onemkl::mklgpu::gemmt),
+    ONEMKL_TABLE_ENTRY(dgemmt_sycl, onemkl::mklgpu::gemmt),
+    ONEMKL_TABLE_ENTRY(cgemmt_sycl, onemkl::mklgpu::gemmt),
+    ONEMKL_TABLE_ENTRY(zgemmt_sycl, onemkl::mklgpu::gemmt),
+    ONEMKL_TABLE_ENTRY(gemm_f16f16f32_ext_sycl, onemkl::mklgpu::gemm_ext),
+    ONEMKL_TABLE_ENTRY(gemm_s8u8s32_ext_sycl, onemkl::mklgpu::gemm_ext),
+    ONEMKL_TABLE_ENTRY(sgemm_ext_sycl, onemkl::mklgpu::gemm_ext),
+    ONEMKL_TABLE_ENTRY(dgemm_ext_sycl, onemkl::mklgpu::gemm_ext),
+    ONEMKL_TABLE_ENTRY(cgemm_ext_sycl, onemkl::mklgpu::gemm_ext),
+    ONEMKL_TABLE_ENTRY(zgemm_ext_sycl, onemkl::mklgpu::gemm_ext),
+    ONEMKL_TABLE_ENTRY(hgemm_ext_sycl, onemkl::mklgpu::gemm_ext),
+    ONEMKL_TABLE_ENTRY(scasum_usm_sycl, onemkl::mklgpu::asum),
+    ONEMKL_TABLE_ENTRY(dzasum_usm_sycl, onemkl::mklgpu::asum),
+    ONEMKL_TABLE_ENTRY(sasum_usm_sycl, onemkl::mklgpu::asum),
+    ONEMKL_TABLE_ENTRY(dasum_usm_sycl, onemkl::mklgpu::asum),
+    ONEMKL_TABLE_ENTRY(saxpy_usm_sycl, onemkl::mklgpu::axpy),
+    ONEMKL_TABLE_ENTRY(daxpy_usm_sycl, onemkl::mklgpu::axpy),
+    ONEMKL_TABLE_ENTRY(caxpy_usm_sycl, onemkl::mklgpu::axpy),
+    ONEMKL_TABLE_ENTRY(zaxpy_usm_sycl, onemkl::mklgpu::axpy),
+    ONEMKL_TABLE_ENTRY(saxpy_batch_group_usm_sycl, onemkl::mklgpu::axpy_batch),
+    ONEMKL_TABLE_ENTRY(daxpy_batch_group_usm_sycl, onemkl::mklgpu::axpy_batch),
+    ONEMKL_TABLE_ENTRY(caxpy_batch_group_usm_sycl, onemkl::mklgpu::axpy_batch),
+    ONEMKL_TABLE_ENTRY(zaxpy_batch_group_usm_sycl, onemkl::mklgpu::axpy_batch),
+    ONEMKL_TABLE_ENTRY(scopy_usm_sycl, onemkl::mklgpu::copy),
+    ONEMKL_TABLE_ENTRY(dcopy_usm_sycl, onemkl::mklgpu::copy),
+    ONEMKL_TABLE_ENTRY(ccopy_usm_sycl, onemkl::mklgpu::copy),
+    ONEMKL_TABLE_ENTRY(zcopy_usm_sycl, onemkl::mklgpu::copy),
+    ONEMKL_TABLE_ENTRY(sdot_usm_sycl, onemkl::mklgpu::dot),
+    ONEMKL_TABLE_ENTRY(ddot_usm_sycl, onemkl::mklgpu::dot),
+    ONEMKL_TABLE_ENTRY(dsdot_usm_sycl, onemkl::mklgpu::dot),
+    ONEMKL_TABLE_ENTRY(cdotc_usm_sycl, onemkl::mklgpu::dotc),
+    ONEMKL_TABLE_ENTRY(zdotc_usm_sycl, onemkl::mklgpu::dotc),
+    ONEMKL_TABLE_ENTRY(cdotu_usm_sycl, onemkl::mklgpu::dotu),
+    ONEMKL_TABLE_ENTRY(zdotu_usm_sycl, onemkl::mklgpu::dotu),
+    ONEMKL_TABLE_ENTRY(isamin_usm_sycl, onemkl::mklgpu::iamin),
+    ONEMKL_TABLE_ENTRY(idamin_usm_sycl, onemkl::mklgpu::iamin),
+    ONEMKL_TABLE_ENTRY(icamin_usm_sycl, onemkl::mklgpu::iamin),
+    ONEMKL_TABLE_ENTRY(izamin_usm_sycl, onemkl::mklgpu::iamin),
+    ONEMKL_TABLE_ENTRY(isamax_usm_sycl, onemkl::mklgpu::iamax),
+    ONEMKL_TABLE_ENTRY(idamax_usm_sycl, onemkl::mklgpu::iamax),
+    ONEMKL_TABLE_ENTRY(icamax_usm_sycl, onemkl::mklgpu::iamax),
+    ONEMKL_TABLE_ENTRY(izamax_usm_sycl, onemkl::mklgpu::iamax),
+    ONEMKL_TABLE_ENTRY(snrm2_usm_sycl, onemkl::mklgpu::nrm2),
+    ONEMKL_TABLE_ENTRY(dnrm2_usm_sycl, onemkl::mklgpu::nrm2),
+    ONEMKL_TABLE_ENTRY(scnrm2_usm_sycl, onemkl::mklgpu::nrm2),
+    ONEMKL_TABLE_ENTRY(dznrm2_usm_sycl, onemkl::mklgpu::nrm2),
+    ONEMKL_TABLE_ENTRY(srot_usm_sycl, onemkl::mklgpu::rot),
+    ONEMKL_TABLE_ENTRY(drot_usm_sycl, onemkl::mklgpu::rot),
+    ONEMKL_TABLE_ENTRY(csrot_usm_sycl, onemkl::mklgpu::rot),
+    ONEMKL_TABLE_ENTRY(zdrot_usm_sycl, onemkl::mklgpu::rot),
+    ONEMKL_TABLE_ENTRY(srotg_usm_sycl, onemkl::mklgpu::rotg),
+    ONEMKL_TABLE_ENTRY(drotg_usm_sycl, onemkl::mklgpu::rotg),
+    ONEMKL_TABLE_ENTRY(crotg_usm_sycl, onemkl::mklgpu::rotg),
+    ONEMKL_TABLE_ENTRY(zrotg_usm_sycl, onemkl::mklgpu::rotg),
+    ONEMKL_TABLE_ENTRY(srotm_usm_sycl, onemkl::mklgpu::rotm),
+    ONEMKL_TABLE_ENTRY(drotm_usm_sycl, onemkl::mklgpu::rotm),
+    ONEMKL_TABLE_ENTRY(srotmg_usm_sycl, onemkl::mklgpu::rotmg),
+    ONEMKL_TABLE_ENTRY(drotmg_usm_sycl, onemkl::mklgpu::rotmg),
+    ONEMKL_TABLE_ENTRY(sscal_usm_sycl, onemkl::mklgpu::scal),
+    ONEMKL_TABLE_ENTRY(dscal_usm_sycl, onemkl::mklgpu::scal),
+    ONEMKL_TABLE_ENTRY(cscal_usm_sycl, onemkl::mklgpu::scal),
+    ONEMKL_TABLE_ENTRY(csscal_usm_sycl, onemkl::mklgpu::scal),
+    ONEMKL_TABLE_ENTRY(zscal_usm_sycl, onemkl::mklgpu::scal),
+    ONEMKL_TABLE_ENTRY(zdscal_usm_sycl, onemkl::mklgpu::scal),
+    ONEMKL_TABLE_ENTRY(sdsdot_usm_sycl, onemkl::mklgpu::sdsdot),
+    ONEMKL_TABLE_ENTRY(sswap_usm_sycl, onemkl::mklgpu::swap),
+    ONEMKL_TABLE_ENTRY(dswap_usm_sycl, onemkl::mklgpu::swap),
+    ONEMKL_TABLE_ENTRY(cswap_usm_sycl, onemkl::mklgpu::swap),
+    ONEMKL_TABLE_ENTRY(zswap_usm_sycl, onemkl::mklgpu::swap),
+    ONEMKL_TABLE_ENTRY(sgbmv_usm_sycl, onemkl::mklgpu::gbmv),
+    ONEMKL_TABLE_ENTRY(dgbmv_usm_sycl, onemkl::mklgpu::gbmv),
+    ONEMKL_TABLE_ENTRY(cgbmv_usm_sycl, onemkl::mklgpu::gbmv),
+    ONEMKL_TABLE_ENTRY(zgbmv_usm_sycl, onemkl::mklgpu::gbmv),
+    ONEMKL_TABLE_ENTRY(sgemv_usm_sycl, onemkl::mklgpu::gemv),
+    ONEMKL_TABLE_ENTRY(dgemv_usm_sycl, onemkl::mklgpu::gemv),
+    ONEMKL_TABLE_ENTRY(cgemv_usm_sycl, onemkl::mklgpu::gemv),
+    ONEMKL_TABLE_ENTRY(zgemv_usm_sycl, onemkl::mklgpu::gemv),
+    ONEMKL_TABLE_ENTRY(sger_usm_sycl, onemkl::mklgpu::ger),
+    ONEMKL_TABLE_ENTRY(dger_usm_sycl, onemkl::mklgpu::ger),
+    ONEMKL_TABLE_ENTRY(cgerc_usm_sycl, onemkl::mklgpu::gerc),
+    ONEMKL_TABLE_ENTRY(zgerc_usm_sycl, onemkl::mklgpu::gerc),
+    ONEMKL_TABLE_ENTRY(cgeru_usm_sycl, onemkl::mklgpu::geru),
+    ONEMKL_TABLE_ENTRY(zgeru_usm_sycl, onemkl::mklgpu::geru),
+    ONEMKL_TABLE_ENTRY(chbmv_usm_sycl, onemkl::mklgpu::hbmv),
+    ONEMKL_TABLE_ENTRY(zhbmv_usm_sycl, onemkl::mklgpu::hbmv),
+    ONEMKL_TABLE_ENTRY(chemv_usm_sycl, onemkl::mklgpu::hemv),
+    ONEMKL_TABLE_ENTRY(zhemv_usm_sycl, onemkl::mklgpu::hemv),
+    ONEMKL_TABLE_ENTRY(cher_usm_sycl, onemkl::mklgpu::her),
+    ONEMKL_TABLE_ENTRY(zher_usm_sycl, onemkl::mklgpu::her),
+    ONEMKL_TABLE_ENTRY(cher2_usm_sycl, onemkl::mklgpu::her2),
+    ONEMKL_TABLE_ENTRY(zher2_usm_sycl, onemkl::mklgpu::her2),
+    ONEMKL_TABLE_ENTRY(chpmv_usm_sycl, onemkl::mklgpu::hpmv),
+    ONEMKL_TABLE_ENTRY(zhpmv_usm_sycl, onemkl::mklgpu::hpmv),
+    ONEMKL_TABLE_ENTRY(chpr_usm_sycl, onemkl::mklgpu::hpr),
+    ONEMKL_TABLE_ENTRY(zhpr_usm_sycl, onemkl::mklgpu::hpr),
+    ONEMKL_TABLE_ENTRY(chpr2_usm_sycl, onemkl::mklgpu::hpr2),
+    ONEMKL_TABLE_ENTRY(zhpr2_usm_sycl, onemkl::mklgpu::hpr2),
+    ONEMKL_TABLE_ENTRY(ssbmv_usm_sycl, onemkl::mklgpu::sbmv),
+    ONEMKL_TABLE_ENTRY(dsbmv_usm_sycl, onemkl::mklgpu::sbmv),
+    ONEMKL_TABLE_ENTRY(sspmv_usm_sycl, onemkl::mklgpu::spmv),
+    ONEMKL_TABLE_ENTRY(dspmv_usm_sycl, onemkl::mklgpu::spmv),
+    ONEMKL_TABLE_ENTRY(sspr_usm_sycl, onemkl::mklgpu::spr),
+    ONEMKL_TABLE_ENTRY(dspr_usm_sycl, onemkl::mklgpu::spr),
+    ONEMKL_TABLE_ENTRY(sspr2_usm_sycl, onemkl::mklgpu::spr2),
+    ONEMKL_TABLE_ENTRY(dspr2_usm_sycl, onemkl::mklgpu::spr2),
+    ONEMKL_TABLE_ENTRY(ssymv_usm_sycl, onemkl::mklgpu::symv),
+    ONEMKL_TABLE_ENTRY(dsymv_usm_sycl, onemkl::mklgpu::symv),
+    ONEMKL_TABLE_ENTRY(ssyr_usm_sycl, onemkl::mklgpu::syr),
+    ONEMKL_TABLE_ENTRY(dsyr_usm_sycl, onemkl::mklgpu::syr),
+    ONEMKL_TABLE_ENTRY(ssyr2_usm_sycl, onemkl::mklgpu::syr2),
+    ONEMKL_TABLE_ENTRY(dsyr2_usm_sycl, onemkl::mklgpu::syr2),
+    ONEMKL_TABLE_ENTRY(stbmv_usm_sycl, onemkl::mklgpu::tbmv),
+    ONEMKL_TABLE_ENTRY(dtbmv_usm_sycl, onemkl::mklgpu::tbmv),
+    ONEMKL_TABLE_ENTRY(ctbmv_usm_sycl, onemkl::mklgpu::tbmv),
+    ONEMKL_TABLE_ENTRY(ztbmv_usm_sycl, onemkl::mklgpu::tbmv),
+    ONEMKL_TABLE_ENTRY(stbsv_usm_sycl, onemkl::mklgpu::tbsv),
+    ONEMKL_TABLE_ENTRY(dtbsv_usm_sycl, onemkl::mklgpu::tbsv),
+    ONEMKL_TABLE_ENTRY(ctbsv_usm_sycl, onemkl::mklgpu::tbsv),
+    ONEMKL_TABLE_ENTRY(ztbsv_usm_sycl, onemkl::mklgpu::tbsv),
+    ONEMKL_TABLE_ENTRY(stpmv_usm_sycl, onemkl::mklgpu::tpmv),
+    ONEMKL_TABLE_ENTRY(dtpmv_usm_sycl, onemkl::mklgpu::tpmv),
+    ONEMKL_TABLE_ENTRY(ctpmv_usm_sycl, onemkl::mklgpu::tpmv),
+    ONEMKL_TABLE_ENTRY(ztpmv_usm_sycl, onemkl::mklgpu::tpmv),
+    ONEMKL_TABLE_ENTRY(stpsv_usm_sycl, onemkl::mklgpu::tpsv),
+    ONEMKL_TABLE_ENTRY(dtpsv_usm_sycl, onemkl::mklgpu::tpsv),
+    ONEMKL_TABLE_ENTRY(ctpsv_usm_sycl, onemkl::mklgpu::tpsv),
+    ONEMKL_TABLE_ENTRY(ztpsv_usm_sycl, onemkl::mklgpu::tpsv),
+    ONEMKL_TABLE_ENTRY(strmv_usm_sycl, onemkl::mklgpu::trmv),
+    ONEMKL_TABLE_ENTRY(dtrmv_usm_sycl, onemkl::mklgpu::trmv),
+    ONEMKL_TABLE_ENTRY(ctrmv_usm_sycl, onemkl::mklgpu::trmv),
+    ONEMKL_TABLE_ENTRY(ztrmv_usm_sycl, onemkl::mklgpu::trmv),
+    ONEMKL_TABLE_ENTRY(strsv_usm_sycl, onemkl::mklgpu::trsv),
+    ONEMKL_TABLE_ENTRY(dtrsv_usm_sycl, onemkl::mklgpu::trsv),
+    ONEMKL_TABLE_ENTRY(ctrsv_usm_sycl, onemkl::mklgpu::trsv),
+    ONEMKL_TABLE_ENTRY(ztrsv_usm_sycl, onemkl::mklgpu::trsv),
+    ONEMKL_TABLE_ENTRY(sgemm_usm_sycl, onemkl::mklgpu::gemm),
+    ONEMKL_TABLE_ENTRY(dgemm_usm_sycl, onemkl::mklgpu::gemm),
+    ONEMKL_TABLE_ENTRY(cgemm_usm_sycl, onemkl::mklgpu::gemm),
+    ONEMKL_TABLE_ENTRY(zgemm_usm_sycl, onemkl::mklgpu::gemm),
+    ONEMKL_TABLE_ENTRY(chemm_usm_sycl, onemkl::mklgpu::hemm),
+    ONEMKL_TABLE_ENTRY(zhemm_usm_sycl, onemkl::mklgpu::hemm),
+    ONEMKL_TABLE_ENTRY(cherk_usm_sycl, onemkl::mklgpu::herk),
+    ONEMKL_TABLE_ENTRY(zherk_usm_sycl, onemkl::mklgpu::herk),
+    ONEMKL_TABLE_ENTRY(cher2k_usm_sycl, onemkl::mklgpu::her2k),
+    ONEMKL_TABLE_ENTRY(zher2k_usm_sycl, onemkl::mklgpu::her2k),
+    ONEMKL_TABLE_ENTRY(ssymm_usm_sycl, onemkl::mklgpu::symm),
+    ONEMKL_TABLE_ENTRY(dsymm_usm_sycl, onemkl::mklgpu::symm),
+    ONEMKL_TABLE_ENTRY(csymm_usm_sycl, onemkl::mklgpu::symm),
+    ONEMKL_TABLE_ENTRY(zsymm_usm_sycl, onemkl::mklgpu::symm),
+    ONEMKL_TABLE_ENTRY(ssyrk_usm_sycl, onemkl::mklgpu::syrk),
+    ONEMKL_TABLE_ENTRY(dsyrk_usm_sycl, onemkl::mklgpu::syrk),
+    ONEMKL_TABLE_ENTRY(csyrk_usm_sycl, onemkl::mklgpu::syrk),
+    ONEMKL_TABLE_ENTRY(zsyrk_usm_sycl, onemkl::mklgpu::syrk),
+    ONEMKL_TABLE_ENTRY(ssyr2k_usm_sycl, onemkl::mklgpu::syr2k),
+    ONEMKL_TABLE_ENTRY(dsyr2k_usm_sycl, onemkl::mklgpu::syr2k),
+    ONEMKL_TABLE_ENTRY(csyr2k_usm_sycl, onemkl::mklgpu::syr2k),
+    ONEMKL_TABLE_ENTRY(zsyr2k_usm_sycl, onemkl::mklgpu::syr2k),
+    ONEMKL_TABLE_ENTRY(strmm_usm_sycl, onemkl::mklgpu::trmm),
+    ONEMKL_TABLE_ENTRY(dtrmm_usm_sycl, onemkl::mklgpu::trmm),
+    ONEMKL_TABLE_ENTRY(ctrmm_usm_sycl, onemkl::mklgpu::trmm),
+    ONEMKL_TABLE_ENTRY(ztrmm_usm_sycl, onemkl::mklgpu::trmm),
+    ONEMKL_TABLE_ENTRY(strsm_usm_sycl, onemkl::mklgpu::trsm),
+    ONEMKL_TABLE_ENTRY(dtrsm_usm_sycl, onemkl::mklgpu::trsm),
+    ONEMKL_TABLE_ENTRY(ctrsm_usm_sycl, onemkl::mklgpu::trsm),
+    ONEMKL_TABLE_ENTRY(ztrsm_usm_sycl, onemkl::mklgpu::trsm),
+    ONEMKL_TABLE_ENTRY(sgemm_batch_group_usm_sycl, onemkl::mklgpu::gemm_batch),
+    ONEMKL_TABLE_ENTRY(dgemm_batch_group_usm_sycl, onemkl::mklgpu::gemm_batch),
+    ONEMKL_TABLE_ENTRY(cgemm_batch_group_usm_sycl, onemkl::mklgpu::gemm_batch),
+    ONEMKL_TABLE_ENTRY(zgemm_batch_group_usm_sycl, onemkl::mklgpu::gemm_batch),
+    ONEMKL_TABLE_ENTRY(sgemm_batch_strided_usm_sycl, onemkl::mklgpu::gemm_batch),
+    ONEMKL_TABLE_ENTRY(dgemm_batch_strided_usm_sycl, onemkl::mklgpu::gemm_batch),
+    ONEMKL_TABLE_ENTRY(cgemm_batch_strided_usm_sycl, onemkl::mklgpu::gemm_batch),
+    ONEMKL_TABLE_ENTRY(zgemm_batch_strided_usm_sycl, onemkl::mklgpu::gemm_batch),
+    ONEMKL_TABLE_ENTRY(sgemmt_usm_sycl, onemkl::mklgpu::gemmt),
+    ONEMKL_TABLE_ENTRY(dgemmt_usm_sycl, onemkl::mklgpu::gemmt),
+    ONEMKL_TABLE_ENTRY(cgemmt_usm_sycl, onemkl::mklgpu::gemmt),
+    ONEMKL_TABLE_ENTRY(zgemmt_usm_sycl, onemkl::mklgpu::gemmt),
+};
+
+extern "C" ONEMKL_EXPORT function_index_t WRAPPER_TABLE = {
+    WRAPPER_VERSION, sizeof(wrapper_entries) / sizeof(wrapper_entries[0]), wrapper_entries
 };
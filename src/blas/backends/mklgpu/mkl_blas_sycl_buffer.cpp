@@ -19,6 +19,7 @@
 
 #include <CL/sycl.hpp>
 
+#include "include/exceptions_helper.hpp"
 #include "mkl_internal_blas_gpu_wrappers.hpp"
 #include "onemkl/blas/detail/mklgpu/onemkl_blas_mklgpu.hpp"
 #include "onemkl/types.hpp"
@@ -68,6 +69,13 @@ void gemm(cl::sycl::queue &queue, onemkl::transpose transa, onemkl::transpose tr
                                    ldc);
 }
 
+void gemm(cl::sycl::queue &queue, onemkl::transpose transa, onemkl::transpose transb,
+          std::int64_t m, std::int64_t n, std::int64_t k, bfloat16 alpha,
+          cl::sycl::buffer<bfloat16, 1> &a, std::int64_t lda, cl::sycl::buffer<bfloat16, 1> &b,
+          std::int64_t ldb, bfloat16 beta, cl::sycl::buffer<bfloat16, 1> &c, std::int64_t ldc) {
+    throw backend_unsupported_exception();
+}
+
 void symm(cl::sycl::queue &queue, onemkl::side left_right, onemkl::uplo upper_lower, std::int64_t m,
           std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
           cl::sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
@@ -814,6 +822,33 @@ void axpy(cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
     onemkl::mklgpu::internal::axpy(queue, n, alpha, x, incx, y, incy);
 }
 
+void axpy_batch(cl::sycl::queue &queue, std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &x,
+                std::int64_t incx, std::int64_t stridex, cl::sycl::buffer<float, 1> &y,
+                std::int64_t incy, std::int64_t stridey, std::int64_t batch_size) {
+    throw backend_unsupported_exception();
+}
+
+void axpy_batch(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                cl::sycl::buffer<double, 1> &x, std::int64_t incx, std::int64_t stridex,
+                cl::sycl::buffer<double, 1> &y, std::int64_t incy, std::int64_t stridey,
+                std::int64_t batch_size) {
+    throw backend_unsupported_exception();
+}
+
+void axpy_batch(cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                std::int64_t stridex, cl::sycl::buffer<std::complex<float>, 1> &y,
+                std::int64_t incy, std::int64_t stridey, std::int64_t batch_size) {
+    throw backend_unsupported_exception();
+}
+
+void axpy_batch(cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                std::int64_t stridex, cl::sycl::buffer<std::complex<double>, 1> &y,
+                std::int64_t incy, std::int64_t stridey, std::int64_t batch_size) {
+    throw backend_unsupported_exception();
+}
+
 void copy(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
           cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
     onemkl::mklgpu::internal::copy(queue, n, x, incx, y, incy);
@@ -1112,6 +1147,13 @@ void gemm_ext(cl::sycl::queue &queue, onemkl::transpose transa, onemkl::transpos
                                        c, ldc);
 }
 
+void gemm_ext(cl::sycl::queue &queue, onemkl::transpose transa, onemkl::transpose transb,
+              std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+              cl::sycl::buffer<bfloat16, 1> &a, std::int64_t lda, cl::sycl::buffer<bfloat16, 1> &b,
+              std::int64_t ldb, float beta, cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+    throw backend_unsupported_exception();
+}
+
 void gemm_ext(cl::sycl::queue &queue, onemkl::transpose transa, onemkl::transpose transb,
               onemkl::offset offsetc, std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
               cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda, int8_t ao,
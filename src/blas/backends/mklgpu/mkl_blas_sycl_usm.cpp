@@ -19,6 +19,7 @@
 
 #include <CL/sycl.hpp>
 
+#include "include/exceptions_helper.hpp"
 #include "mkl_internal_blas_gpu_wrappers.hpp"
 #include "onemkl/blas/detail/mklgpu/onemkl_blas_mklgpu.hpp"
 #include "onemkl/types.hpp"
@@ -64,6 +65,14 @@ cl::sycl::event gemm(cl::sycl::queue &queue, onemkl::transpose transa, onemkl::t
                                           beta, c, ldc, dependencies);
 }
 
+cl::sycl::event gemm(cl::sycl::queue &queue, onemkl::transpose transa, onemkl::transpose transb,
+                     std::int64_t m, std::int64_t n, std::int64_t k, bfloat16 alpha,
+                     const bfloat16 *a, std::int64_t lda, const bfloat16 *b, std::int64_t ldb,
+                     bfloat16 beta, bfloat16 *c, std::int64_t ldc,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
 cl::sycl::event symm(cl::sycl::queue &queue, onemkl::side left_right, onemkl::uplo upper_lower,
                      std::int64_t m, std::int64_t n, float alpha, const float *a, std::int64_t lda,
                      const float *b, std::int64_t ldb, float beta, float *c, std::int64_t ldc,
@@ -994,6 +1003,170 @@ cl::sycl::event axpy_batch(cl::sycl::queue &queue, std::int64_t *n, std::complex
                                                 group_size, dependencies);
 }
 
+cl::sycl::event axpy_batch(cl::sycl::queue &queue, std::int64_t n, float alpha, const float *x,
+                           std::int64_t incx, std::int64_t stridex, float *y, std::int64_t incy,
+                           std::int64_t stridey, std::int64_t batch_size,
+                           const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event axpy_batch(cl::sycl::queue &queue, std::int64_t n, double alpha, const double *x,
+                           std::int64_t incx, std::int64_t stridex, double *y, std::int64_t incy,
+                           std::int64_t stridey, std::int64_t batch_size,
+                           const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event axpy_batch(cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
+                           const std::complex<float> *x, std::int64_t incx, std::int64_t stridex,
+                           std::complex<float> *y, std::int64_t incy, std::int64_t stridey,
+                           std::int64_t batch_size,
+                           const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event axpy_batch(cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+                           const std::complex<double> *x, std::int64_t incx, std::int64_t stridex,
+                           std::complex<double> *y, std::int64_t incy, std::int64_t stridey,
+                           std::int64_t batch_size,
+                           const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event compact_pack(cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols,
+                             const float **a, std::int64_t lda, float *ap, std::int64_t ldap,
+                             std::int64_t batch_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event compact_pack(cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols,
+                             const double **a, std::int64_t lda, double *ap, std::int64_t ldap,
+                             std::int64_t batch_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event compact_pack(cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols,
+                             const std::complex<float> **a, std::int64_t lda,
+                             std::complex<float> *ap, std::int64_t ldap, std::int64_t batch_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event compact_pack(cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols,
+                             const std::complex<double> **a, std::int64_t lda,
+                             std::complex<double> *ap, std::int64_t ldap, std::int64_t batch_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event compact_unpack(cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols,
+                               const float *ap, std::int64_t ldap, float **a, std::int64_t lda,
+                               std::int64_t batch_size,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event compact_unpack(cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols,
+                               const double *ap, std::int64_t ldap, double **a, std::int64_t lda,
+                               std::int64_t batch_size,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event compact_unpack(cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols,
+                               const std::complex<float> *ap, std::int64_t ldap,
+                               std::complex<float> **a, std::int64_t lda, std::int64_t batch_size,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event compact_unpack(cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols,
+                               const std::complex<double> *ap, std::int64_t ldap,
+                               std::complex<double> **a, std::int64_t lda, std::int64_t batch_size,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event gemm_compact(cl::sycl::queue &queue, onemkl::transpose transa,
+                             onemkl::transpose transb, std::int64_t m, std::int64_t n,
+                             std::int64_t k, float alpha, const float *ap, std::int64_t ldap,
+                             const float *bp, std::int64_t ldbp, float beta, float *cp,
+                             std::int64_t ldcp, std::int64_t batch_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event gemm_compact(cl::sycl::queue &queue, onemkl::transpose transa,
+                             onemkl::transpose transb, std::int64_t m, std::int64_t n,
+                             std::int64_t k, double alpha, const double *ap, std::int64_t ldap,
+                             const double *bp, std::int64_t ldbp, double beta, double *cp,
+                             std::int64_t ldcp, std::int64_t batch_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event gemm_compact(cl::sycl::queue &queue, onemkl::transpose transa,
+                             onemkl::transpose transb, std::int64_t m, std::int64_t n,
+                             std::int64_t k, std::complex<float> alpha,
+                             const std::complex<float> *ap, std::int64_t ldap,
+                             const std::complex<float> *bp, std::int64_t ldbp,
+                             std::complex<float> beta, std::complex<float> *cp, std::int64_t ldcp,
+                             std::int64_t batch_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event gemm_compact(cl::sycl::queue &queue, onemkl::transpose transa,
+                             onemkl::transpose transb, std::int64_t m, std::int64_t n,
+                             std::int64_t k, std::complex<double> alpha,
+                             const std::complex<double> *ap, std::int64_t ldap,
+                             const std::complex<double> *bp, std::int64_t ldbp,
+                             std::complex<double> beta, std::complex<double> *cp, std::int64_t ldcp,
+                             std::int64_t batch_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event trsm_compact(cl::sycl::queue &queue, onemkl::side left_right,
+                             onemkl::uplo upper_lower, onemkl::transpose trans,
+                             onemkl::diag unit_diag, std::int64_t m, std::int64_t n, float alpha,
+                             const float *ap, std::int64_t ldap, float *bp, std::int64_t ldbp,
+                             std::int64_t batch_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event trsm_compact(cl::sycl::queue &queue, onemkl::side left_right,
+                             onemkl::uplo upper_lower, onemkl::transpose trans,
+                             onemkl::diag unit_diag, std::int64_t m, std::int64_t n, double alpha,
+                             const double *ap, std::int64_t ldap, double *bp, std::int64_t ldbp,
+                             std::int64_t batch_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event trsm_compact(cl::sycl::queue &queue, onemkl::side left_right,
+                             onemkl::uplo upper_lower, onemkl::transpose trans,
+                             onemkl::diag unit_diag, std::int64_t m, std::int64_t n,
+                             std::complex<float> alpha, const std::complex<float> *ap,
+                             std::int64_t ldap, std::complex<float> *bp, std::int64_t ldbp,
+                             std::int64_t batch_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event trsm_compact(cl::sycl::queue &queue, onemkl::side left_right,
+                             onemkl::uplo upper_lower, onemkl::transpose trans,
+                             onemkl::diag unit_diag, std::int64_t m, std::int64_t n,
+                             std::complex<double> alpha, const std::complex<double> *ap,
+                             std::int64_t ldap, std::complex<double> *bp, std::int64_t ldbp,
+                             std::int64_t batch_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
 cl::sycl::event copy(cl::sycl::queue &queue, std::int64_t n, const float *x, std::int64_t incx,
                      float *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
@@ -1290,6 +1463,107 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, onemkl::transpose transa,
                                                 batch_size, dependencies);
 }
 
+cl::sycl::event trsm_batch(cl::sycl::queue &queue, onemkl::side *left_right,
+                           onemkl::uplo *upper_lower, onemkl::transpose *trans,
+                           onemkl::diag *unit_diag, std::int64_t *m, std::int64_t *n, float *alpha,
+                           const float **a, std::int64_t *lda, float **b, std::int64_t *ldb,
+                           std::int64_t group_count, std::int64_t *group_size,
+                           const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event trsm_batch(cl::sycl::queue &queue, onemkl::side *left_right,
+                           onemkl::uplo *upper_lower, onemkl::transpose *trans,
+                           onemkl::diag *unit_diag, std::int64_t *m, std::int64_t *n, double *alpha,
+                           const double **a, std::int64_t *lda, double **b, std::int64_t *ldb,
+                           std::int64_t group_count, std::int64_t *group_size,
+                           const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event trsm_batch(cl::sycl::queue &queue, onemkl::side *left_right,
+                           onemkl::uplo *upper_lower, onemkl::transpose *trans,
+                           onemkl::diag *unit_diag, std::int64_t *m, std::int64_t *n,
+                           std::complex<float> *alpha, const std::complex<float> **a,
+                           std::int64_t *lda, std::complex<float> **b, std::int64_t *ldb,
+                           std::int64_t group_count, std::int64_t *group_size,
+                           const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event trsm_batch(cl::sycl::queue &queue, onemkl::side *left_right,
+                           onemkl::uplo *upper_lower, onemkl::transpose *trans,
+                           onemkl::diag *unit_diag, std::int64_t *m, std::int64_t *n,
+                           std::complex<double> *alpha, const std::complex<double> **a,
+                           std::int64_t *lda, std::complex<double> **b, std::int64_t *ldb,
+                           std::int64_t group_count, std::int64_t *group_size,
+                           const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event trsm_batch(cl::sycl::queue &queue, onemkl::side left_right,
+                           onemkl::uplo upper_lower, onemkl::transpose trans,
+                           onemkl::diag unit_diag, std::int64_t m, std::int64_t n, float alpha,
+                           const float *a, std::int64_t lda, std::int64_t stride_a, float *b,
+                           std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+                           const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event trsm_batch(cl::sycl::queue &queue, onemkl::side left_right,
+                           onemkl::uplo upper_lower, onemkl::transpose trans,
+                           onemkl::diag unit_diag, std::int64_t m, std::int64_t n, double alpha,
+                           const double *a, std::int64_t lda, std::int64_t stride_a, double *b,
+                           std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+                           const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event trsm_batch(cl::sycl::queue &queue, onemkl::side left_right,
+                           onemkl::uplo upper_lower, onemkl::transpose trans,
+                           onemkl::diag unit_diag, std::int64_t m, std::int64_t n,
+                           std::complex<float> alpha, const std::complex<float> *a,
+                           std::int64_t lda, std::int64_t stride_a, std::complex<float> *b,
+                           std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+                           const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event trsm_batch(cl::sycl::queue &queue, onemkl::side left_right,
+                           onemkl::uplo upper_lower, onemkl::transpose trans,
+                           onemkl::diag unit_diag, std::int64_t m, std::int64_t n,
+                           std::complex<double> alpha, const std::complex<double> *a,
+                           std::int64_t lda, std::int64_t stride_a, std::complex<double> *b,
+                           std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+                           const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event gemm_ext(cl::sycl::queue &queue, onemkl::transpose transa, onemkl::transpose transb,
+                         std::int64_t m, std::int64_t n, std::int64_t k, float alpha, const half *a,
+                         std::int64_t lda, const half *b, std::int64_t ldb, float beta, float *c,
+                         std::int64_t ldc,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event gemm_ext(cl::sycl::queue &queue, onemkl::transpose transa, onemkl::transpose transb,
+                         std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                         const bfloat16 *a, std::int64_t lda, const bfloat16 *b, std::int64_t ldb,
+                         float beta, float *c, std::int64_t ldc,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event gemm_ext(cl::sycl::queue &queue, onemkl::transpose transa, onemkl::transpose transb,
+                         onemkl::offset offsetc, std::int64_t m, std::int64_t n, std::int64_t k,
+                         float alpha, const int8_t *a, std::int64_t lda, int8_t ao,
+                         const uint8_t *b, std::int64_t ldb, uint8_t bo, float beta, int32_t *c,
+                         std::int64_t ldc, const int32_t *co,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
 cl::sycl::event gemmt(cl::sycl::queue &queue, onemkl::uplo upper_lower, onemkl::transpose transa,
                       onemkl::transpose transb, std::int64_t n, std::int64_t k, float alpha,
                       const float *a, std::int64_t lda, const float *b, std::int64_t ldb,
@@ -22,12 +22,16 @@
 
 #include <CL/sycl.hpp>
 #include <complex>
+#include <cstddef>
 #include <cstdint>
+#include "onemkl/blas/stats.hpp"
 #include "onemkl/types.hpp"
 
+// Signatures of all routines a backend can provide. The struct is never filled
+//  in: backends export their routines by name (see function_index_t below) and
+//  the loader resolves each one on first use, into a slot given by the position
+//  of the field with the same name.
 typedef struct {
-    int version;
-
     // Buffer APIs
 
     void (*scasum_sycl)(cl::sycl::queue &queue, std::int64_t n,
@@ -52,6 +56,29 @@ typedef struct {
     void (*zaxpy_sycl)(cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
                        cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
                        cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy);
+    void (*saxpy_batch_strided_sycl)(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                                     cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                     std::int64_t stridex, cl::sycl::buffer<float, 1> &y,
+                                     std::int64_t incy, std::int64_t stridey,
+                                     std::int64_t batch_size);
+    void (*daxpy_batch_strided_sycl)(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                                     cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                                     std::int64_t stridex, cl::sycl::buffer<double, 1> &y,
+                                     std::int64_t incy, std::int64_t stridey,
+                                     std::int64_t batch_size);
+    void (*caxpy_batch_strided_sycl)(cl::sycl::queue &queue, std::int64_t n,
+                                     std::complex<float> alpha,
+                                     cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                                     std::int64_t stridex,
+                                     cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
+                                     std::int64_t stridey, std::int64_t batch_size);
+    void (*zaxpy_batch_strided_sycl)(cl::sycl::queue &queue, std::int64_t n,
+                                     std::complex<double> alpha,
+                                     cl::sycl::buffer<std::complex<double>, 1> &x,
+                                     std::int64_t incx, std::int64_t stridex,
+                                     cl::sycl::buffer<std::complex<double>, 1> &y,
+                                     std::int64_t incy, std::int64_t stridey,
+                                     std::int64_t batch_size);
     void (*scopy_sycl)(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
                        std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy);
     void (*dcopy_sycl)(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &x,
@@ -479,6 +506,13 @@ typedef struct {
                        std::int64_t m, std::int64_t n, std::int64_t k, half alpha,
                        cl::sycl::buffer<half, 1> &a, std::int64_t lda, cl::sycl::buffer<half, 1> &b,
                        std::int64_t ldb, half beta, cl::sycl::buffer<half, 1> &c, std::int64_t ldc);
+    void (*gemm_bf16bf16bf16_sycl)(cl::sycl::queue &queue, onemkl::transpose transa,
+                                   onemkl::transpose transb, std::int64_t m, std::int64_t n,
+                                   std::int64_t k, onemkl::bfloat16 alpha,
+                                   cl::sycl::buffer<onemkl::bfloat16, 1> &a, std::int64_t lda,
+                                   cl::sycl::buffer<onemkl::bfloat16, 1> &b, std::int64_t ldb,
+                                   onemkl::bfloat16 beta, cl::sycl::buffer<onemkl::bfloat16, 1> &c,
+                                   std::int64_t ldc);
     void (*chemm_sycl)(cl::sycl::queue &queue, onemkl::side left_right, onemkl::uplo upper_lower,
                        std::int64_t m, std::int64_t n, std::complex<float> alpha,
                        cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
@@ -696,6 +730,12 @@ typedef struct {
                                     std::int64_t lda, cl::sycl::buffer<half, 1> &b,
                                     std::int64_t ldb, float beta, cl::sycl::buffer<float, 1> &c,
                                     std::int64_t ldc);
+    void (*gemm_bf16bf16f32_ext_sycl)(cl::sycl::queue &queue, onemkl::transpose transa,
+                                      onemkl::transpose transb, std::int64_t m, std::int64_t n,
+                                      std::int64_t k, float alpha,
+                                      cl::sycl::buffer<onemkl::bfloat16, 1> &a, std::int64_t lda,
+                                      cl::sycl::buffer<onemkl::bfloat16, 1> &b, std::int64_t ldb,
+                                      float beta, cl::sycl::buffer<float, 1> &c, std::int64_t ldc);
     void (*gemm_s8u8s32_ext_sycl)(cl::sycl::queue &queue, onemkl::transpose transa,
                                   onemkl::transpose transb, onemkl::offset offsetc, std::int64_t m,
                                   std::int64_t n, std::int64_t k, float alpha,
@@ -786,6 +826,122 @@ typedef struct {
         std::int64_t *incy, std::int64_t group_count, std::int64_t *group_size,
         const cl::sycl::vector_class<cl::sycl::event> &dependencies);
 
+    cl::sycl::event (*saxpy_batch_strided_usm_sycl)(
+        cl::sycl::queue &queue, std::int64_t n, float alpha, const float *x, std::int64_t incx,
+        std::int64_t stridex, float *y, std::int64_t incy, std::int64_t stridey,
+        std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+
+    cl::sycl::event (*daxpy_batch_strided_usm_sycl)(
+        cl::sycl::queue &queue, std::int64_t n, double alpha, const double *x, std::int64_t incx,
+        std::int64_t stridex, double *y, std::int64_t incy, std::int64_t stridey,
+        std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+
+    cl::sycl::event (*caxpy_batch_strided_usm_sycl)(
+        cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
+        const std::complex<float> *x, std::int64_t incx, std::int64_t stridex,
+        std::complex<float> *y, std::int64_t incy, std::int64_t stridey, std::int64_t batch_size,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+
+    cl::sycl::event (*zaxpy_batch_strided_usm_sycl)(
+        cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+        const std::complex<double> *x, std::int64_t incx, std::int64_t stridex,
+        std::complex<double> *y, std::int64_t incy, std::int64_t stridey, std::int64_t batch_size,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+
+    cl::sycl::event (*scompact_pack_usm_sycl)(
+        cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols, const float **a,
+        std::int64_t lda, float *ap, std::int64_t ldap, std::int64_t batch_size,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+
+    cl::sycl::event (*dcompact_pack_usm_sycl)(
+        cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols, const double **a,
+        std::int64_t lda, double *ap, std::int64_t ldap, std::int64_t batch_size,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+
+    cl::sycl::event (*ccompact_pack_usm_sycl)(
+        cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols, const std::complex<float> **a,
+        std::int64_t lda, std::complex<float> *ap, std::int64_t ldap, std::int64_t batch_size,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+
+    cl::sycl::event (*zcompact_pack_usm_sycl)(
+        cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols,
+        const std::complex<double> **a, std::int64_t lda, std::complex<double> *ap,
+        std::int64_t ldap, std::int64_t batch_size,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+
+    cl::sycl::event (*scompact_unpack_usm_sycl)(
+        cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols, const float *ap,
+        std::int64_t ldap, float **a, std::int64_t lda, std::int64_t batch_size,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+
+    cl::sycl::event (*dcompact_unpack_usm_sycl)(
+        cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols, const double *ap,
+        std::int64_t ldap, double **a, std::int64_t lda, std::int64_t batch_size,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+
+    cl::sycl::event (*ccompact_unpack_usm_sycl)(
+        cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols, const std::complex<float> *ap,
+        std::int64_t ldap, std::complex<float> **a, std::int64_t lda, std::int64_t batch_size,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+
+    cl::sycl::event (*zcompact_unpack_usm_sycl)(
+        cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols,
+        const std::complex<double> *ap, std::int64_t ldap, std::complex<double> **a,
+        std::int64_t lda, std::int64_t batch_size,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+
+    cl::sycl::event (*sgemm_compact_usm_sycl)(
+        cl::sycl::queue &queue, onemkl::transpose transa, onemkl::transpose transb, std::int64_t m,
+        std::int64_t n, std::int64_t k, float alpha, const float *ap, std::int64_t ldap,
+        const float *bp, std::int64_t ldbp, float beta, float *cp, std::int64_t ldcp,
+        std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+
+    cl::sycl::event (*dgemm_compact_usm_sycl)(
+        cl::sycl::queue &queue, onemkl::transpose transa, onemkl::transpose transb, std::int64_t m,
+        std::int64_t n, std::int64_t k, double alpha, const double *ap, std::int64_t ldap,
+        const double *bp, std::int64_t ldbp, double beta, double *cp, std::int64_t ldcp,
+        std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+
+    cl::sycl::event (*cgemm_compact_usm_sycl)(
+        cl::sycl::queue &queue, onemkl::transpose transa, onemkl::transpose transb, std::int64_t m,
+        std::int64_t n, std::int64_t k, std::complex<float> alpha, const std::complex<float> *ap,
+        std::int64_t ldap, const std::complex<float> *bp, std::int64_t ldbp,
+        std::complex<float> beta, std::complex<float> *cp, std::int64_t ldcp,
+        std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+
+    cl::sycl::event (*zgemm_compact_usm_sycl)(
+        cl::sycl::queue &queue, onemkl::transpose transa, onemkl::transpose transb, std::int64_t m,
+        std::int64_t n, std::int64_t k, std::complex<double> alpha, const std::complex<double> *ap,
+        std::int64_t ldap, const std::complex<double> *bp, std::int64_t ldbp,
+        std::complex<double> beta, std::complex<double> *cp, std::int64_t ldcp,
+        std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+
+    cl::sycl::event (*strsm_compact_usm_sycl)(
+        cl::sycl::queue &queue, onemkl::side left_right, onemkl::uplo upper_lower,
+        onemkl::transpose trans, onemkl::diag unit_diag, std::int64_t m, std::int64_t n,
+        float alpha, const float *ap, std::int64_t ldap, float *bp, std::int64_t ldbp,
+        std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+
+    cl::sycl::event (*dtrsm_compact_usm_sycl)(
+        cl::sycl::queue &queue, onemkl::side left_right, onemkl::uplo upper_lower,
+        onemkl::transpose trans, onemkl::diag unit_diag, std::int64_t m, std::int64_t n,
+        double alpha, const double *ap, std::int64_t ldap, double *bp, std::int64_t ldbp,
+        std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+
+    cl::sycl::event (*ctrsm_compact_usm_sycl)(
+        cl::sycl::queue &queue, onemkl::side left_right, onemkl::uplo upper_lower,
+        onemkl::transpose trans, onemkl::diag unit_diag, std::int64_t m, std::int64_t n,
+        std::complex<float> alpha, const std::complex<float> *ap, std::int64_t ldap,
+        std::complex<float> *bp, std::int64_t ldbp, std::int64_t batch_size,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+
+    cl::sycl::event (*ztrsm_compact_usm_sycl)(
+        cl::sycl::queue &queue, onemkl::side left_right, onemkl::uplo upper_lower,
+        onemkl::transpose trans, onemkl::diag unit_diag, std::int64_t m, std::int64_t n,
+        std::complex<double> alpha, const std::complex<double> *ap, std::int64_t ldap,
+        std::complex<double> *bp, std::int64_t ldbp, std::int64_t batch_size,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+
     cl::sycl::event (*scopy_usm_sycl)(cl::sycl::queue &queue, std::int64_t n, const float *x,
                                       std::int64_t incx, float *y, std::int64_t incy,
                                       const cl::sycl::vector_class<cl::sycl::event> &dependencies);
@@ -1323,6 +1479,12 @@ typedef struct {
                                       std::complex<double> beta, std::complex<double> *c,
                                       std::int64_t ldc,
                                       const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*gemm_bf16bf16bf16_usm_sycl)(
+        cl::sycl::queue &queue, onemkl::transpose transa, onemkl::transpose transb, std::int64_t m,
+        std::int64_t n, std::int64_t k, onemkl::bfloat16 alpha, const onemkl::bfloat16 *a,
+        std::int64_t lda, const onemkl::bfloat16 *b, std::int64_t ldb, onemkl::bfloat16 beta,
+        onemkl::bfloat16 *c, std::int64_t ldc,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
     cl::sycl::event (*chemm_usm_sycl)(cl::sycl::queue &queue, onemkl::side left_right,
                                       onemkl::uplo upper_lower, std::int64_t m, std::int64_t n,
                                       std::complex<float> alpha, const std::complex<float> *a,
@@ -1534,6 +1696,78 @@ typedef struct {
         std::int64_t stride_b, std::complex<double> beta, std::complex<double> *c, std::int64_t ldc,
         std::int64_t stride_c, std::int64_t batch_size,
         const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+
+    cl::sycl::event (*strsm_batch_group_usm_sycl)(
+        cl::sycl::queue &queue, onemkl::side *left_right, onemkl::uplo *upper_lower,
+        onemkl::transpose *trans, onemkl::diag *unit_diag, std::int64_t *m, std::int64_t *n,
+        float *alpha, const float **a, std::int64_t *lda, float **b, std::int64_t *ldb,
+        std::int64_t group_count, std::int64_t *group_size,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+
+    cl::sycl::event (*dtrsm_batch_group_usm_sycl)(
+        cl::sycl::queue &queue, onemkl::side *left_right, onemkl::uplo *upper_lower,
+        onemkl::transpose *trans, onemkl::diag *unit_diag, std::int64_t *m, std::int64_t *n,
+        double *alpha, const double **a, std::int64_t *lda, double **b, std::int64_t *ldb,
+        std::int64_t group_count, std::int64_t *group_size,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+
+    cl::sycl::event (*ctrsm_batch_group_usm_sycl)(
+        cl::sycl::queue &queue, onemkl::side *left_right, onemkl::uplo *upper_lower,
+        onemkl::transpose *trans, onemkl::diag *unit_diag, std::int64_t *m, std::int64_t *n,
+        std::complex<float> *alpha, const std::complex<float> **a, std::int64_t *lda,
+        std::complex<float> **b, std::int64_t *ldb, std::int64_t group_count,
+        std::int64_t *group_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+
+    cl::sycl::event (*ztrsm_batch_group_usm_sycl)(
+        cl::sycl::queue &queue, onemkl::side *left_right, onemkl::uplo *upper_lower,
+        onemkl::transpose *trans, onemkl::diag *unit_diag, std::int64_t *m, std::int64_t *n,
+        std::complex<double> *alpha, const std::complex<double> **a, std::int64_t *lda,
+        std::complex<double> **b, std::int64_t *ldb, std::int64_t group_count,
+        std::int64_t *group_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+
+    cl::sycl::event (*strsm_batch_strided_usm_sycl)(
+        cl::sycl::queue &queue, onemkl::side left_right, onemkl::uplo upper_lower,
+        onemkl::transpose trans, onemkl::diag unit_diag, std::int64_t m, std::int64_t n,
+        float alpha, const float *a, std::int64_t lda, std::int64_t stride_a, float *b,
+        std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+
+    cl::sycl::event (*dtrsm_batch_strided_usm_sycl)(
+        cl::sycl::queue &queue, onemkl::side left_right, onemkl::uplo upper_lower,
+        onemkl::transpose trans, onemkl::diag unit_diag, std::int64_t m, std::int64_t n,
+        double alpha, const double *a, std::int64_t lda, std::int64_t stride_a, double *b,
+        std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+
+    cl::sycl::event (*ctrsm_batch_strided_usm_sycl)(
+        cl::sycl::queue &queue, onemkl::side left_right, onemkl::uplo upper_lower,
+        onemkl::transpose trans, onemkl::diag unit_diag, std::int64_t m, std::int64_t n,
+        std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+        std::int64_t stride_a, std::complex<float> *b, std::int64_t ldb, std::int64_t stride_b,
+        std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+
+    cl::sycl::event (*ztrsm_batch_strided_usm_sycl)(
+        cl::sycl::queue &queue, onemkl::side left_right, onemkl::uplo upper_lower,
+        onemkl::transpose trans, onemkl::diag unit_diag, std::int64_t m, std::int64_t n,
+        std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
+        std::int64_t stride_a, std::complex<double> *b, std::int64_t ldb, std::int64_t stride_b,
+        std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*gemm_f16f16f32_ext_usm_sycl)(
+        cl::sycl::queue &queue, onemkl::transpose transa, onemkl::transpose transb, std::int64_t m,
+        std::int64_t n, std::int64_t k, float alpha, const half *a, std::int64_t lda, const half *b,
+        std::int64_t ldb, float beta, float *c, std::int64_t ldc,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*gemm_bf16bf16f32_ext_usm_sycl)(
+        cl::sycl::queue &queue, onemkl::transpose transa, onemkl::transpose transb, std::int64_t m,
+        std::int64_t n, std::int64_t k, float alpha, const onemkl::bfloat16 *a, std::int64_t lda,
+        const onemkl::bfloat16 *b, std::int64_t ldb, float beta, float *c, std::int64_t ldc,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*gemm_s8u8s32_ext_usm_sycl)(
+        cl::sycl::queue &queue, onemkl::transpose transa, onemkl::transpose transb,
+        onemkl::offset offsetc, std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+        const int8_t *a, std::int64_t lda, int8_t ao, const uint8_t *b, std::int64_t ldb,
+        uint8_t bo, float beta, int32_t *c, std::int64_t ldc, const int32_t *co,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
     cl::sycl::event (*sgemmt_usm_sycl)(cl::sycl::queue &queue, onemkl::uplo upper_lower,
                                        onemkl::transpose transa, onemkl::transpose transb,
                                        std::int64_t n, std::int64_t k, float alpha, const float *a,
@@ -1563,6 +1797,83 @@ typedef struct {
                                        std::int64_t ldc,
                                        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
 
+
+    // Execution control
+
+    void (*fused_begin_sycl)(cl::sycl::queue &queue);
+    void (*fused_end_sycl)(cl::sycl::queue &queue);
+    void (*set_num_threads_sycl)(cl::sycl::queue &queue, int num_threads);
+    void (*set_task_arena_sycl)(cl::sycl::queue &queue, int max_concurrency, int numa_node,
+                                void *arena);
+
+    // Packed GEMM
+
+    std::int64_t (*sgemm_pack_get_size_sycl)(cl::sycl::queue &queue, onemkl::pack_matrix which,
+                                             std::int64_t m, std::int64_t n, std::int64_t k);
+    cl::sycl::event (*sgemm_pack_sycl)(cl::sycl::queue &queue, onemkl::pack_matrix which,
+                                       onemkl::transpose trans, std::int64_t m, std::int64_t n,
+                                       std::int64_t k, float alpha, cl::sycl::buffer<float, 1> &src,
+                                       std::int64_t ld, float *dst);
+    cl::sycl::event (*sgemm_pack_usm_sycl)(
+        cl::sycl::queue &queue, onemkl::pack_matrix which, onemkl::transpose trans, std::int64_t m,
+        std::int64_t n, std::int64_t k, float alpha, const float *src, std::int64_t ld, float *dst,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*sgemm_compute_sycl)(
+        cl::sycl::queue &queue, onemkl::pack_matrix which, onemkl::transpose trans, std::int64_t m,
+        std::int64_t n, std::int64_t k, const float *packed, cl::sycl::buffer<float, 1> &x,
+        std::int64_t ldx, float beta, cl::sycl::buffer<float, 1> &c, std::int64_t ldc,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*sgemm_compute_usm_sycl)(
+        cl::sycl::queue &queue, onemkl::pack_matrix which, onemkl::transpose trans, std::int64_t m,
+        std::int64_t n, std::int64_t k, const float *packed, const float *x, std::int64_t ldx,
+        float beta, float *c, std::int64_t ldc,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    std::int64_t (*dgemm_pack_get_size_sycl)(cl::sycl::queue &queue, onemkl::pack_matrix which,
+                                             std::int64_t m, std::int64_t n, std::int64_t k);
+    cl::sycl::event (*dgemm_pack_sycl)(cl::sycl::queue &queue, onemkl::pack_matrix which,
+                                       onemkl::transpose trans, std::int64_t m, std::int64_t n,
+                                       std::int64_t k, double alpha,
+                                       cl::sycl::buffer<double, 1> &src, std::int64_t ld,
+                                       double *dst);
+    cl::sycl::event (*dgemm_pack_usm_sycl)(
+        cl::sycl::queue &queue, onemkl::pack_matrix which, onemkl::transpose trans, std::int64_t m,
+        std::int64_t n, std::int64_t k, double alpha, const double *src, std::int64_t ld,
+        double *dst, const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*dgemm_compute_sycl)(
+        cl::sycl::queue &queue, onemkl::pack_matrix which, onemkl::transpose trans, std::int64_t m,
+        std::int64_t n, std::int64_t k, const double *packed, cl::sycl::buffer<double, 1> &x,
+        std::int64_t ldx, double beta, cl::sycl::buffer<double, 1> &c, std::int64_t ldc,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*dgemm_compute_usm_sycl)(
+        cl::sycl::queue &queue, onemkl::pack_matrix which, onemkl::transpose trans, std::int64_t m,
+        std::int64_t n, std::int64_t k, const double *packed, const double *x, std::int64_t ldx,
+        double beta, double *c, std::int64_t ldc,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+
+    // Statistics
+
+    void (*stats_enable_sycl)(bool enable);
+    void (*stats_read_sycl)(onemkl::blas::detail::stats_sink &sink);
+
 } function_table_t;
 
+typedef struct {
+    const char *name;
+    void *fn;
+} function_table_entry_t;
+
+// Exported by each backend as mkl_blas_table (mkl_blas_<backend>_table in
+//  static builds). Entries may be in any order, and routines a backend does not
+//  provide can be left out.
+typedef struct {
+    int version;
+    std::size_t size;
+    const function_table_entry_t *entries;
+} function_index_t;
+
+// Entry for routine `name` of function_table_t, implemented by `fn`. The cast
+//  to the field's type selects the right overload of `fn`.
+#define ONEMKL_TABLE_ENTRY(name, fn) \
+    { #name, reinterpret_cast<void *>(static_cast<decltype(function_table_t::name)>(fn)) }
+
 #endif //_BLAS_FUNCTION_TABLE_HPP_
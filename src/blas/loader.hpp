@@ -20,13 +20,39 @@
 #ifndef _LOADER_HPP_
 #define _LOADER_HPP_
 
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
-#include <map>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
 #include "blas/function_table.hpp"
+#include "blas/trace.hpp"
+#include "include/device_cache.hpp"
+#include "include/exceptions_helper.hpp"
+#include "onemkl/detail/backends_selector.hpp"
+#include "onemkl/detail/config.hpp"
 
-#define SPEC_VERSION 1
+#define SPEC_VERSION 2
 
-#ifdef __linux__
+#ifndef BUILD_SHARED_LIBS
+// Static builds link the enabled backends into the loader and reference their
+//  tables directly, nothing is loaded at run-time.
+extern "C" {
+    #ifdef ENABLE_MKLCPU_BACKEND
+extern function_index_t mkl_blas_mklcpu_table;
+    #endif
+    #ifdef ENABLE_MKLGPU_BACKEND
+extern function_index_t mkl_blas_mklgpu_table;
+    #endif
+    #ifdef ENABLE_CUBLAS_BACKEND
+extern function_index_t mkl_blas_cublas_table;
+    #endif
+}
+#elif defined(__linux__)
     #include <dlfcn.h>
     #define LIB_TYPE                 void *
     #define GET_LIB_HANDLE(libname)  dlopen((libname), RTLD_LAZY | RTLD_GLOBAL)
@@ -46,7 +72,88 @@ namespace onemkl {
 namespace blas {
 namespace detail {
 
+// Per-backend table of routines, filled in lazily: a routine is looked up by
+//  name in the backend's index the first time it is called, and its address is
+//  cached in the slot matching its field in function_table_t.
+class backend_table {
+public:
+    static constexpr std::size_t num_slots = sizeof(function_table_t) / sizeof(void *);
+
+    backend_table() {
+        for (std::size_t i = 0; i < num_slots; i++)
+            slots[i].store(nullptr, std::memory_order_relaxed);
+    }
+
+    template <typename F>
+    F get(std::size_t slot, const char *name) {
+        F fn = find<F>(slot, name);
+        if (!fn)
+            throw onemkl::backend_unsupported_exception();
+        return fn;
+    }
+
+    // Like get(), but returns nullptr if the backend does not provide the routine.
+    template <typename F>
+    F find(std::size_t slot, const char *name) {
+        void *fn = slots[slot].load(std::memory_order_acquire);
+        if (!fn)
+            fn = resolve(slot, name);
+        return (fn == missing()) ? nullptr : reinterpret_cast<F>(fn);
+    }
+
+    void set_index(const function_index_t *idx) {
+        index.store(idx, std::memory_order_release);
+    }
+
+    const function_index_t *get_index() const {
+        return index.load(std::memory_order_acquire);
+    }
+
+private:
+    // Marks a slot whose routine is not provided by the backend.
+    static void *missing() {
+        static char marker;
+        return &marker;
+    }
+
+    void *resolve(std::size_t slot, const char *name) {
+        const function_index_t *idx = get_index();
+        void *fn                    = missing();
+        for (std::size_t i = 0; i < idx->size; i++) {
+            if (std::strcmp(idx->entries[i].name, name) == 0) {
+                fn = idx->entries[i].fn;
+                break;
+            }
+        }
+        // Racing threads store the same address, so no lock is needed.
+        slots[slot].store(fn, std::memory_order_release);
+        return fn;
+    }
+
+    std::atomic<const function_index_t *> index{ nullptr };
+    std::atomic<void *> slots[num_slots];
+};
+
+// Routine `name` of function_table_t for the backend serving `queue`,
+//  instrumented when tracing, statistics or recording are on.
+#define BACKEND_FUNC(queue, name)                                      \
+    make_traced<offsetof(function_table_t, name) / sizeof(void *)>(    \
+        queue,                                                         \
+        function_tables[queue].get<decltype(function_table_t::name)>(  \
+            offsetof(function_table_t, name) / sizeof(void *), #name), \
+        #name)
+
+// Same as BACKEND_FUNC, but nullptr when the backend does not provide it, and
+//  never traced.
+#define BACKEND_FIND(queue, name)                                  \
+    function_tables[queue].find<decltype(function_table_t::name)>( \
+        offsetof(function_table_t, name) / sizeof(void *), #name)
+
+// Process-wide registry of backend tables, indexed by onemkl::backend.
+//  Each backend library is loaded at most once, under its own std::once_flag;
+//  afterwards a lookup is a single acquire load of the published index.
 class table_initializer {
+#ifdef BUILD_SHARED_LIBS
     struct handle_deleter {
         using pointer = LIB_TYPE;
         void operator()(pointer p) const {
@@ -54,17 +161,64 @@ class table_initializer {
         }
     };
     using dlhandle = std::unique_ptr<LIB_TYPE, handle_deleter>;
+#endif
+
+    struct table_entry {
+        std::once_flag flag;
+        backend_table table;
+#ifdef BUILD_SHARED_LIBS
+        dlhandle handle;
+#endif
+    };
 
 public:
-    function_table_t &operator[](const char *libname) {
-        auto lib = tables.find(libname);
-        if (lib != tables.end())
-            return lib->second;
-        return add_table(libname);
+    static constexpr int num_backends = static_cast<int>(backend::unsupported) + 1;
+
+    backend_table &operator[](backend b) {
+        auto &entry = entries[static_cast<int>(b)];
+        if (entry.table.get_index())
+            return entry.table;
+        // If add_table() throws, the flag stays unset and the next caller retries.
+        std::call_once(entry.flag, &table_initializer::add_table, this, b, std::ref(entry));
+        return entry.table;
+    }
+
+    // Backend resolution is cached per device, so the device queries done by
+    //  get_backend() are only paid on the first call for a given device, and
+    //  per queue on each thread, so that repeated calls on a queue do not query
+    //  its device at all.
+    backend_table &operator[](cl::sycl::queue &queue) {
+        static thread_local queue_cache<backend_table *> queue_tables;
+        backend_table *t;
+        if (queue_tables.find(queue, t))
+            return *t;
+        cl::sycl::device device = queue.get_device();
+        if (!device_tables.find(device, t)) {
+            t = &(*this)[get_backend(queue)];
+            device_tables.insert(device, t);
+        }
+        queue_tables.insert(queue, t);
+        return *t;
+    }
+
+    // Table of backend b if it is already loaded, nullptr otherwise; never
+    //  loads anything.
+    backend_table *loaded(backend b) {
+        auto &entry = entries[static_cast<int>(b)];
+        return entry.table.get_index() ? &entry.table : nullptr;
+    }
+
+    // Backend whose table is t.
+    backend backend_of(const backend_table &t) const {
+        for (int i = 0; i < num_backends; i++) {
+            if (&entries[i].table == &t)
+                return static_cast<backend>(i);
+        }
+        return backend::unsupported;
     }
 
 private:
-#ifdef _WIN64
+#if defined(BUILD_SHARED_LIBS) && defined(_WIN64)
     // Create a string with last error message
     std::string GetLastErrorStdStr() {
         DWORD error = GetLastError();
@@ -87,14 +241,18 @@ private:
     }
 #endif
 
-    function_table_t &add_table(const char *libname) {
-        auto handle = dlhandle{ ::GET_LIB_HANDLE(libname) };
+#ifdef BUILD_SHARED_LIBS
+    void add_table(backend b, table_entry &entry) {
+        if (b == backend::unsupported)
+            throw std::runtime_error{ "Couldn't load selected backend" };
+
+        auto handle = dlhandle{ ::GET_LIB_HANDLE(backend_libname(b)) };
         if (!handle) {
             std::cerr << ERROR_MSG << '\n';
             throw std::runtime_error{ "Couldn't load selected backend" };
         }
 
-        auto t = reinterpret_cast<function_table_t *>(::GET_FUNC(handle.get(), "mkl_blas_table"));
+        auto t = reinterpret_cast<function_index_t *>(::GET_FUNC(handle.get(), "mkl_blas_table"));
 
         if (!t) {
             std::cerr << ERROR_MSG << '\n';
@@ -103,16 +261,47 @@ private:
         if (t->version != SPEC_VERSION)
             throw std::runtime_error{ "Loaded oneMKL specification version mismatch" };
 
-        handles[libname] = std::move(handle);
-        tables[libname]  = *t;
-        return *t;
+        entry.handle = std::move(handle);
+        entry.table.set_index(t);
     }
+#else
+    void add_table(backend b, table_entry &entry) {
+        function_index_t *t = nullptr;
+        switch (b) {
+    #ifdef ENABLE_MKLCPU_BACKEND
+            case backend::intelcpu:
+                t = &mkl_blas_mklcpu_table;
+                break;
+    #endif
+    #ifdef ENABLE_MKLGPU_BACKEND
+            case backend::intelgpu:
+                t = &mkl_blas_mklgpu_table;
+                break;
+    #endif
+    #ifdef ENABLE_CUBLAS_BACKEND
+            case backend::nvidiagpu:
+                t = &mkl_blas_cublas_table;
+                break;
+    #endif
+            default:
+                break;
+        }
+
+        if (!t)
+            throw std::runtime_error{ "Selected backend is not linked into this build" };
+        if (t->version != SPEC_VERSION)
+            throw std::runtime_error{ "Loaded oneMKL specification version mismatch" };
+
+        entry.table.set_index(t);
+    }
+#endif
 
-    std::map<const char *, function_table_t> tables;
-    std::map<const char *, dlhandle> handles;
+    table_entry entries[num_backends];
+    device_cache<backend_table *> device_tables;
 };
 
-static table_initializer function_tables;
+// Defined once in blas_loader.cpp.
+extern table_initializer function_tables;
 
 } //namespace detail
 } // namespace blas
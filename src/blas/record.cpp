@@ -0,0 +1,854 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "onemkl/blas/detail/blas_loader.hpp"
+#include "onemkl/detail/exceptions.hpp"
+#include "blas/loader.hpp"
+#include "blas/record.hpp"
+#include "blas/trace.hpp"
+
+namespace onemkl {
+namespace blas {
+namespace detail {
+
+namespace {
+
+constexpr std::size_t num_slots = backend_table::num_slots;
+
+// A recording is a header (magic, SPEC_VERSION and the number of table slots,
+//  so that it is only replayed by a library with the same function table)
+//  followed by records, in native byte order:
+//    name: u8 1, u16 slot, u16 length, the table field of slot;
+//          written before the first call to the slot.
+//    call: u8 2, u16 slot, u16 thread, u8 argument count, arguments.
+//  Each argument is u8 arg_kind and u8 value_type, then:
+//    value:         the value;
+//    buffer,
+//    pointer:       i64 extent, ld, stride, columns (see operand_layout);
+//    array:         i64 count, the count values;
+//    pointer_array: u32 groups, then i64 problems, extent, ld, stride,
+//                   columns per group;
+//    others:        nothing.
+const char record_magic[8] = { 'O', 'N', 'E', 'M', 'K', 'L', 'R', '1' };
+
+enum : std::uint8_t { record_name = 1, record_call_entry = 2 };
+
+// Recordings are written in blocks of this size, and when they are closed.
+constexpr std::size_t flush_bytes = 1 << 20;
+
+std::size_t value_size(value_type type) {
+    switch (type) {
+        case value_type::s:
+            return sizeof(float);
+        case value_type::d:
+            return sizeof(double);
+        case value_type::c:
+            return sizeof(std::complex<float>);
+        case value_type::z:
+            return sizeof(std::complex<double>);
+        case value_type::h:
+            return sizeof(half);
+        case value_type::bf16:
+            return sizeof(bfloat16);
+        case value_type::s8:
+        case value_type::u8:
+            return 1;
+        case value_type::s32:
+            return 4;
+        case value_type::s64:
+            return 8;
+        case value_type::transpose:
+        case value_type::uplo:
+        case value_type::diag:
+        case value_type::side:
+        case value_type::offset:
+        case value_type::pack_matrix:
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+std::vector<replay_fn> &registry() {
+    static std::vector<replay_fn> *r = new std::vector<replay_fn>(num_slots, nullptr);
+    return *r;
+}
+
+// The state is never destroyed, so that the recording can be closed at exit.
+struct record_state {
+    std::mutex mutex;
+    std::FILE *file = nullptr;
+    std::string path;
+    std::vector<unsigned char> bytes;
+    std::vector<bool> named;
+    int next_thread = 1;
+    std::once_flag at_exit;
+};
+
+record_state &state() {
+    static record_state *s = new record_state;
+    return *s;
+}
+
+int thread_id() {
+    thread_local int id = 0;
+    if (!id) {
+        auto &s = state();
+        std::lock_guard<std::mutex> lock(s.mutex);
+        id = s.next_thread++;
+    }
+    return id;
+}
+
+template <typename T>
+void put(std::vector<unsigned char> &out, T value) {
+    auto bytes = reinterpret_cast<const unsigned char *>(&value);
+    out.insert(out.end(), bytes, bytes + sizeof(T));
+}
+
+void put_layout(std::vector<unsigned char> &out, const operand_layout &layout) {
+    put<std::int64_t>(out, layout.extent);
+    put<std::int64_t>(out, layout.ld);
+    put<std::int64_t>(out, layout.stride);
+    put<std::int64_t>(out, layout.columns);
+}
+
+void flush(record_state &s) {
+    if (s.file && !s.bytes.empty())
+        std::fwrite(s.bytes.data(), 1, s.bytes.size(), s.file);
+    s.bytes.clear();
+}
+
+void close(record_state &s) {
+    if (!s.file)
+        return;
+    flush(s);
+    std::fclose(s.file);
+    s.file = nullptr;
+}
+
+bool contains(const std::string &s, const char *part) {
+    return s.find(part) != std::string::npos;
+}
+
+std::int64_t magnitude(std::int64_t value) {
+    return value < 0 ? -value : value;
+}
+
+bool is_int(const recorded_arg *args, std::size_t count, std::size_t i) {
+    return i < count && args[i].kind == arg_kind::value && args[i].type == value_type::s64;
+}
+
+std::int64_t int_of(const recorded_arg &arg) {
+    std::int64_t value;
+    std::memcpy(&value, arg.value, sizeof(value));
+    return value;
+}
+
+bool is_data(const recorded_arg &arg) {
+    return arg.kind == arg_kind::buffer || arg.kind == arg_kind::pointer ||
+           arg.kind == arg_kind::pointer_array;
+}
+
+// Packed routines take triangles of n x n matrices, without a leading
+//  dimension: "sspmv", "chpr2", "dtpsv".
+bool is_packed(const std::string &routine) {
+    if (routine.size() < 3)
+        return false;
+    std::string kind = routine.substr(1, 2);
+    return kind == "hp" || kind == "sp" || kind == "tp";
+}
+
+// Packed GEMM and the compact routines take operands in formats only the
+//  backend produces; their calls are recorded but not replayed.
+bool replayable_routine(const std::string &routine) {
+    if (contains(routine, "compact") || contains(routine, "gemm_compute"))
+        return false;
+    return !contains(routine, "gemm_pack") || contains(routine, "gemm_pack_get_size");
+}
+
+// Extents of the data operands of a call, bounded from its integer arguments:
+//  the largest dimension before the first operand bounds the rows and columns
+//  of every matrix, so an operand followed by its leading dimension or
+//  increment spans ld * dim elements, plus stride * (batch_size - 1) in the
+//  strided batch APIs. Operands without one are packed triangles, the column
+//  offsets of gemm_s8u8s32 or scalar results.
+void plain_layouts(const std::string &routine, const recorded_arg *args, std::size_t count,
+                   std::vector<operand_layout> &layouts) {
+    bool strided     = contains(routine, "_batch_strided");
+    bool packed      = is_packed(routine);
+    bool offsets     = false;
+    bool data_seen   = false;
+    std::int64_t dim = 0, batch = 1;
+    for (std::size_t i = 0; i < count; i++) {
+        if (is_data(args[i]))
+            data_seen = true;
+        if (args[i].kind == arg_kind::value && args[i].type == value_type::offset)
+            offsets = true;
+        if (is_int(args, count, i)) {
+            if (!data_seen)
+                dim = std::max(dim, magnitude(int_of(args[i])));
+            batch = std::max<std::int64_t>(int_of(args[i]), 1);
+        }
+    }
+    if (!strided)
+        batch = 1;
+
+    for (std::size_t i = 0; i < count; i++) {
+        if (args[i].kind != arg_kind::buffer && args[i].kind != arg_kind::pointer)
+            continue;
+        operand_layout &layout = layouts[i];
+        layout.columns         = dim;
+        if (is_int(args, count, i + 1)) {
+            layout.ld     = magnitude(int_of(args[i + 1]));
+            layout.extent = std::max<std::int64_t>(layout.ld * dim, 1);
+            if (strided && is_int(args, count, i + 2)) {
+                layout.stride = magnitude(int_of(args[i + 2]));
+                layout.extent += layout.stride * (batch - 1);
+            }
+        }
+        else if (packed)
+            layout.extent = std::max<std::int64_t>(dim * (dim + 1) / 2, 1);
+        else if (offsets)
+            layout.extent = std::max<std::int64_t>(dim, 1);
+        else
+            layout.extent = 8;
+        if (args[i].kind == arg_kind::buffer)
+            layout.extent = args[i].count;
+    }
+}
+
+// In the group batch APIs every pointer but the arrays of pointers is an
+//  array with one entry per group, group_count being the only integer passed
+//  by value and group_size the last array. Each problem of group g spans
+//  ld[g] * dim[g] elements, dim[g] being the largest of the sizes of the group.
+void group_layouts(const recorded_arg *args, std::size_t count,
+                   std::vector<std::vector<operand_layout>> &groups, std::int64_t &group_count) {
+    group_count                    = 0;
+    const std::int64_t *group_size = nullptr;
+    for (std::size_t i = 0; i < count; i++) {
+        if (is_int(args, count, i))
+            group_count = std::max<std::int64_t>(int_of(args[i]), 0);
+        if (args[i].kind == arg_kind::pointer && args[i].type == value_type::s64)
+            group_size = static_cast<const std::int64_t *>(args[i].pointer);
+    }
+
+    std::vector<std::int64_t> dims(group_count, 0);
+    for (std::size_t i = 0; i < count && args[i].kind != arg_kind::pointer_array; i++) {
+        if (args[i].kind != arg_kind::pointer || args[i].type != value_type::s64)
+            continue;
+        auto sizes = static_cast<const std::int64_t *>(args[i].pointer);
+        for (std::int64_t g = 0; g < group_count; g++)
+            dims[g] = std::max(dims[g], magnitude(sizes[g]));
+    }
+
+    for (std::size_t i = 0; i < count; i++) {
+        if (args[i].kind != arg_kind::pointer_array)
+            continue;
+        const std::int64_t *lds = nullptr;
+        if (i + 1 < count && args[i + 1].kind == arg_kind::pointer &&
+            args[i + 1].type == value_type::s64)
+            lds = static_cast<const std::int64_t *>(args[i + 1].pointer);
+        for (std::int64_t g = 0; g < group_count; g++) {
+            operand_layout layout;
+            layout.ld       = lds ? magnitude(lds[g]) : dims[g];
+            layout.columns  = dims[g];
+            layout.extent   = std::max<std::int64_t>(layout.ld * dims[g], 1);
+            layout.problems = group_size ? std::max<std::int64_t>(group_size[g], 0) : 0;
+            groups[i].push_back(layout);
+        }
+    }
+}
+
+void encode_call(const std::string &routine, const recorded_arg *args, std::size_t count,
+                 std::vector<unsigned char> &out) {
+    bool group = contains(routine, "_batch_group");
+    std::vector<operand_layout> layouts(count);
+    std::vector<std::vector<operand_layout>> groups(count);
+    std::int64_t group_count = 0;
+    if (group)
+        group_layouts(args, count, groups, group_count);
+    else
+        plain_layouts(routine, args, count, layouts);
+
+    for (std::size_t i = 0; i < count; i++) {
+        const recorded_arg &arg = args[i];
+        arg_kind kind           = arg.kind;
+        if (group && kind == arg_kind::pointer)
+            kind = arg_kind::array;
+        put<std::uint8_t>(out, static_cast<std::uint8_t>(kind));
+        put<std::uint8_t>(out, static_cast<std::uint8_t>(arg.type));
+        switch (kind) {
+            case arg_kind::value:
+                out.insert(out.end(), arg.value, arg.value + value_size(arg.type));
+                break;
+            case arg_kind::buffer:
+            case arg_kind::pointer:
+                put_layout(out, layouts[i]);
+                break;
+            case arg_kind::array: {
+                auto bytes = static_cast<const unsigned char *>(arg.pointer);
+                put<std::int64_t>(out, group_count);
+                out.insert(out.end(), bytes, bytes + group_count * value_size(arg.type));
+                break;
+            }
+            case arg_kind::pointer_array:
+                put<std::uint32_t>(out, static_cast<std::uint32_t>(groups[i].size()));
+                for (const auto &layout : groups[i]) {
+                    put<std::int64_t>(out, layout.problems);
+                    put_layout(out, layout);
+                }
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+void record_at_exit() {
+    record_stop();
+}
+
+// ONEMKL_BLAS_RECORD=<file> records the whole process into <file>.
+struct record_environment {
+    record_environment() {
+        const char *path = std::getenv("ONEMKL_BLAS_RECORD");
+        if (path && *path)
+            record_start(path);
+    }
+} record_environment_init;
+
+// Reads a recording, throwing on truncated or malformed input.
+class record_reader {
+public:
+    record_reader(const std::string &path, std::vector<unsigned char> &bytes)
+            : path(path),
+              bytes(bytes) {}
+
+    template <typename T>
+    T get() {
+        T value;
+        std::memcpy(&value, take(sizeof(T)), sizeof(T));
+        return value;
+    }
+
+    const unsigned char *take(std::size_t n) {
+        if (bytes.size() - pos < n)
+            fail("is truncated");
+        const unsigned char *p = bytes.data() + pos;
+        pos += n;
+        return p;
+    }
+
+    operand_layout layout() {
+        operand_layout l;
+        l.extent  = get<std::int64_t>();
+        l.ld      = get<std::int64_t>();
+        l.stride  = get<std::int64_t>();
+        l.columns = get<std::int64_t>();
+        if (l.extent < 0 || l.ld < 0 || l.stride < 0 || l.columns < 0)
+            fail("is corrupt");
+        return l;
+    }
+
+    bool done() const {
+        return pos == bytes.size();
+    }
+
+    void fail(const char *what) const {
+        throw std::runtime_error("oneMKL: recording " + path + " " + what);
+    }
+
+private:
+    const std::string &path;
+    std::vector<unsigned char> &bytes;
+    std::size_t pos = 0;
+};
+
+std::string format_value(value_type type, const unsigned char *value) {
+    char text[64];
+    float f;
+    double d;
+    std::int64_t i = 0;
+    switch (type) {
+        case value_type::s:
+            std::memcpy(&f, value, sizeof(f));
+            std::snprintf(text, sizeof(text), "%g", f);
+            return text;
+        case value_type::d:
+            std::memcpy(&d, value, sizeof(d));
+            std::snprintf(text, sizeof(text), "%g", d);
+            return text;
+        case value_type::c: {
+            std::complex<float> c;
+            std::memcpy(&c, value, sizeof(c));
+            std::snprintf(text, sizeof(text), "(%g,%g)", c.real(), c.imag());
+            return text;
+        }
+        case value_type::z: {
+            std::complex<double> z;
+            std::memcpy(&z, value, sizeof(z));
+            std::snprintf(text, sizeof(text), "(%g,%g)", z.real(), z.imag());
+            return text;
+        }
+        case value_type::h: {
+            half h;
+            std::memcpy(&h, value, sizeof(h));
+            std::snprintf(text, sizeof(text), "%g", static_cast<float>(h));
+            return text;
+        }
+        case value_type::bf16: {
+            bfloat16 b;
+            std::memcpy(&b, value, sizeof(b));
+            std::snprintf(text, sizeof(text), "%g", static_cast<float>(b));
+            return text;
+        }
+        case value_type::s8:
+            i = static_cast<std::int8_t>(value[0]);
+            break;
+        case value_type::u8:
+            i = value[0];
+            break;
+        case value_type::s32: {
+            std::int32_t v;
+            std::memcpy(&v, value, sizeof(v));
+            i = v;
+            break;
+        }
+        case value_type::s64:
+            std::memcpy(&i, value, sizeof(i));
+            break;
+        case value_type::transpose:
+            return std::string(1, "NT?C"[value[0] & 3]);
+        case value_type::uplo:
+            return std::string(1, "UL"[value[0] & 1]);
+        case value_type::diag:
+            return std::string(1, "NU"[value[0] & 1]);
+        case value_type::side:
+            return std::string(1, "LR"[value[0] & 1]);
+        case value_type::offset:
+            return std::string(1, "RCF?"[value[0] & 3]);
+        case value_type::pack_matrix:
+            return std::string(1, "AB"[value[0] & 1]);
+        default:
+            return "?";
+    }
+    std::snprintf(text, sizeof(text), "%lld", (long long)i);
+    return text;
+}
+
+// Arguments of a call as text: values as such, operands by their extent,
+//  per-group arrays by their contents; the queue and dependencies are left out.
+std::string format_arg(const replay_arg &arg) {
+    std::string text;
+    switch (arg.kind) {
+        case arg_kind::value:
+            return format_value(arg.type, arg.value);
+        case arg_kind::buffer:
+        case arg_kind::pointer:
+            return "[" + std::to_string(arg.layout.extent) + "]";
+        case arg_kind::array: {
+            std::size_t size = value_size(arg.type);
+            text             = "{";
+            for (std::size_t i = 0; size && i < arg.data.size() / size; i++)
+                text += (i ? ", " : "") + format_value(arg.type, arg.data.data() + i * size);
+            return text + "}";
+        }
+        case arg_kind::pointer_array:
+            text = "{";
+            for (std::size_t g = 0; g < arg.groups.size(); g++)
+                text += (g ? ", " : "") + std::to_string(arg.groups[g].problems) + " x [" +
+                        std::to_string(arg.groups[g].extent) + "]";
+            return text + "}";
+        case arg_kind::unsupported:
+            return "?";
+        default:
+            return "";
+    }
+}
+
+// Synthetic operands: ones on the diagonal of each column-major matrix,
+//  small values elsewhere, so that triangular solves stay well conditioned and
+//  repeated runs finite.
+template <typename T>
+T synthetic(double value) {
+    return static_cast<T>(value);
+}
+template <>
+std::complex<float> synthetic<std::complex<float>>(double value) {
+    return std::complex<float>(static_cast<float>(value), 0.0f);
+}
+template <>
+std::complex<double> synthetic<std::complex<double>>(double value) {
+    return std::complex<double>(value, 0.0);
+}
+template <>
+half synthetic<half>(double value) {
+    return half(static_cast<float>(value));
+}
+template <>
+bfloat16 synthetic<bfloat16>(double value) {
+    return bfloat16(static_cast<float>(value));
+}
+
+template <typename T>
+void fill(T *data, const operand_layout &layout) {
+    std::int64_t dim = std::max<std::int64_t>(layout.columns, 1);
+    double scale     = 0.5 / dim;
+    for (std::int64_t i = 0; i < layout.extent; i++) {
+        std::int64_t j = layout.stride > 0 ? i % layout.stride : i;
+        bool diagonal  = layout.ld > 0 && j % (layout.ld + 1) == 0 && j / (layout.ld + 1) < dim;
+        data[i] = synthetic<T>(diagonal ? 1.0 : scale * ((i * 7919) % 1000) / 1000.0);
+    }
+}
+
+void fill(void *data, value_type type, const operand_layout &layout) {
+    switch (type) {
+        case value_type::s:
+            fill(static_cast<float *>(data), layout);
+            break;
+        case value_type::d:
+            fill(static_cast<double *>(data), layout);
+            break;
+        case value_type::c:
+            fill(static_cast<std::complex<float> *>(data), layout);
+            break;
+        case value_type::z:
+            fill(static_cast<std::complex<double> *>(data), layout);
+            break;
+        case value_type::h:
+            fill(static_cast<half *>(data), layout);
+            break;
+        case value_type::bf16:
+            fill(static_cast<bfloat16 *>(data), layout);
+            break;
+        case value_type::s8:
+            fill(static_cast<std::int8_t *>(data), layout);
+            break;
+        case value_type::u8:
+            fill(static_cast<std::uint8_t *>(data), layout);
+            break;
+        case value_type::s32:
+            fill(static_cast<std::int32_t *>(data), layout);
+            break;
+        case value_type::s64:
+            fill(static_cast<std::int64_t *>(data), layout);
+            break;
+        default:
+            break;
+    }
+}
+
+template <typename T>
+std::shared_ptr<void> make_buffer(const operand_layout &layout) {
+    std::size_t count = static_cast<std::size_t>(std::max<std::int64_t>(layout.extent, 1));
+    auto buffer       = std::make_shared<cl::sycl::buffer<T, 1>>(cl::sycl::range<1>(count));
+    auto data         = buffer->template get_access<cl::sycl::access::mode::discard_write>();
+    fill(data.get_pointer(), layout);
+    return buffer;
+}
+
+std::shared_ptr<void> make_buffer(value_type type, const operand_layout &layout) {
+    switch (type) {
+        case value_type::s:
+            return make_buffer<float>(layout);
+        case value_type::d:
+            return make_buffer<double>(layout);
+        case value_type::c:
+            return make_buffer<std::complex<float>>(layout);
+        case value_type::z:
+            return make_buffer<std::complex<double>>(layout);
+        case value_type::h:
+            return make_buffer<half>(layout);
+        case value_type::bf16:
+            return make_buffer<bfloat16>(layout);
+        case value_type::s8:
+            return make_buffer<std::int8_t>(layout);
+        case value_type::u8:
+            return make_buffer<std::uint8_t>(layout);
+        case value_type::s32:
+            return make_buffer<std::int32_t>(layout);
+        case value_type::s64:
+            return make_buffer<std::int64_t>(layout);
+        default:
+            return nullptr;
+    }
+}
+
+void *allocate(replay_state &state, const cl::sycl::device &device, std::size_t bytes) {
+    void *p = cl::sycl::malloc_shared(std::max<std::size_t>(bytes, 1), device, state.context);
+    if (!p)
+        throw onemkl::MemoryAllocationException("cannot allocate replay operands");
+    state.allocations.push_back(p);
+    return p;
+}
+
+void release(replay_state &state) {
+    for (auto &arg : state.args) {
+        arg.memory = nullptr;
+        arg.buffer.reset();
+    }
+    for (void *p : state.allocations)
+        cl::sycl::free(p, state.context);
+    state.allocations.clear();
+    state.prepared = false;
+}
+
+} // namespace
+
+replay_state::~replay_state() {
+    release(*this);
+}
+
+bool replay_register(std::size_t slot, replay_fn fn) {
+    if (slot < num_slots)
+        registry()[slot] = fn;
+    return true;
+}
+
+void *replay_lookup(cl::sycl::queue &queue, std::size_t slot, const char *name) {
+    return function_tables[queue].get<void *>(slot, name);
+}
+
+void record_add(std::size_t slot, const char *name, const recorded_arg *args, std::size_t count) {
+    // The recording is closed at exit by a handler registered here, after the
+    //  SYCL runtime is up, so that it runs before the runtime is torn down.
+    auto &s = state();
+    std::call_once(s.at_exit, []() { std::atexit(record_at_exit); });
+
+    std::vector<unsigned char> call;
+    put<std::uint8_t>(call, record_call_entry);
+    put<std::uint16_t>(call, static_cast<std::uint16_t>(slot));
+    put<std::uint16_t>(call, static_cast<std::uint16_t>(thread_id()));
+    put<std::uint8_t>(call, static_cast<std::uint8_t>(count));
+    encode_call(routine_name(name), args, count, call);
+
+    std::lock_guard<std::mutex> lock(s.mutex);
+    if (!s.file)
+        return;
+    if (!s.named[slot]) {
+        std::size_t length = std::strlen(name);
+        s.named[slot]      = true;
+        put<std::uint8_t>(s.bytes, record_name);
+        put<std::uint16_t>(s.bytes, static_cast<std::uint16_t>(slot));
+        put<std::uint16_t>(s.bytes, static_cast<std::uint16_t>(length));
+        s.bytes.insert(s.bytes.end(), name, name + length);
+    }
+    s.bytes.insert(s.bytes.end(), call.begin(), call.end());
+    if (s.bytes.size() >= flush_bytes)
+        flush(s);
+}
+
+void record_start(const char *path) {
+    auto &s = state();
+    std::lock_guard<std::mutex> lock(s.mutex);
+    instrumentation.fetch_and(~instrument_record, std::memory_order_relaxed);
+    close(s);
+    s.path = path ? path : "";
+    if (s.path.empty())
+        return;
+    s.file = std::fopen(s.path.c_str(), "wb");
+    if (!s.file) {
+        std::fprintf(stderr, "oneMKL: cannot write recording to %s\n", s.path.c_str());
+        return;
+    }
+    s.named.assign(num_slots, false);
+    s.bytes.insert(s.bytes.end(), record_magic, record_magic + sizeof(record_magic));
+    put<std::uint32_t>(s.bytes, SPEC_VERSION);
+    put<std::uint32_t>(s.bytes, static_cast<std::uint32_t>(num_slots));
+    instrumentation.fetch_or(instrument_record, std::memory_order_relaxed);
+}
+
+void record_stop() {
+    instrumentation.fetch_and(~instrument_record);
+    auto &s = state();
+    std::lock_guard<std::mutex> lock(s.mutex);
+    close(s);
+}
+
+std::vector<recorded_call> record_load(const char *path) {
+    std::string file = path ? path : "";
+    std::FILE *in    = std::fopen(file.c_str(), "rb");
+    if (!in)
+        throw std::runtime_error("oneMKL: cannot read recording " + file);
+    std::vector<unsigned char> bytes;
+    unsigned char chunk[1 << 16];
+    std::size_t n;
+    while ((n = std::fread(chunk, 1, sizeof(chunk), in)) > 0)
+        bytes.insert(bytes.end(), chunk, chunk + n);
+    std::fclose(in);
+
+    record_reader r(file, bytes);
+    if (std::memcmp(r.take(sizeof(record_magic)), record_magic, sizeof(record_magic)) != 0)
+        r.fail("is not a oneMKL BLAS recording");
+    if (r.get<std::uint32_t>() != SPEC_VERSION || r.get<std::uint32_t>() != num_slots)
+        r.fail("was made by another version of the library");
+
+    std::vector<std::string> names(num_slots);
+    std::vector<recorded_call> calls;
+    while (!r.done()) {
+        std::uint8_t kind = r.get<std::uint8_t>();
+        std::size_t slot  = r.get<std::uint16_t>();
+        if (slot >= num_slots)
+            r.fail("is corrupt");
+        if (kind == record_name) {
+            std::size_t length = r.get<std::uint16_t>();
+            auto name          = reinterpret_cast<const char *>(r.take(length));
+            names[slot].assign(name, length);
+            continue;
+        }
+        if (kind != record_call_entry || names[slot].empty())
+            r.fail("is corrupt");
+
+        recorded_call call;
+        call.thread      = r.get<std::uint16_t>();
+        call.state       = std::make_shared<replay_state>();
+        call.state->slot = slot;
+        call.state->name = names[slot];
+        call.name        = routine_name(names[slot].c_str());
+        call.replayable  = registry()[slot] && replayable_routine(call.name);
+
+        std::size_t count = r.get<std::uint8_t>();
+        call.state->args.resize(count);
+        for (auto &arg : call.state->args) {
+            arg.kind = static_cast<arg_kind>(r.get<std::uint8_t>());
+            arg.type = static_cast<value_type>(r.get<std::uint8_t>());
+            switch (arg.kind) {
+                case arg_kind::value: {
+                    std::size_t size = value_size(arg.type);
+                    if (!size)
+                        r.fail("is corrupt");
+                    std::memcpy(arg.value, r.take(size), size);
+                    break;
+                }
+                case arg_kind::buffer:
+                case arg_kind::pointer:
+                    arg.layout = r.layout();
+                    break;
+                case arg_kind::array: {
+                    std::int64_t entries = r.get<std::int64_t>();
+                    if (entries < 0)
+                        r.fail("is corrupt");
+                    std::size_t size          = entries * value_size(arg.type);
+                    const unsigned char *data = r.take(size);
+                    arg.data.assign(data, data + size);
+                    break;
+                }
+                case arg_kind::pointer_array: {
+                    std::uint32_t groups = r.get<std::uint32_t>();
+                    for (std::uint32_t g = 0; g < groups; g++) {
+                        std::int64_t problems = r.get<std::int64_t>();
+                        operand_layout layout = r.layout();
+                        layout.problems       = std::max<std::int64_t>(problems, 0);
+                        arg.groups.push_back(layout);
+                    }
+                    break;
+                }
+                case arg_kind::dependencies:
+                case arg_kind::queue:
+                    break;
+                case arg_kind::unsupported:
+                    call.replayable = false;
+                    break;
+                default:
+                    r.fail("is corrupt");
+            }
+            std::string text = format_arg(arg);
+            if (!text.empty())
+                call.arguments += (call.arguments.empty() ? "" : ", ") + text;
+        }
+        calls.push_back(std::move(call));
+    }
+    return calls;
+}
+
+void replay_prepare(cl::sycl::queue &queue, recorded_call &call) {
+    if (!call.replayable || !call.state)
+        throw onemkl::InvalidArgumentsException("call to " + call.name + " cannot be replayed");
+    replay_state &state = *call.state;
+    release(state);
+    state.context          = queue.get_context();
+    cl::sycl::device device = queue.get_device();
+
+    for (auto &arg : state.args) {
+        std::size_t size = value_size(arg.type);
+        switch (arg.kind) {
+            case arg_kind::buffer:
+                arg.buffer = make_buffer(arg.type, arg.layout);
+                break;
+            case arg_kind::pointer:
+                arg.memory = allocate(state, device, arg.layout.extent * size);
+                fill(arg.memory, arg.type, arg.layout);
+                break;
+            case arg_kind::array:
+                arg.memory = allocate(state, device, arg.data.size());
+                std::memcpy(arg.memory, arg.data.data(), arg.data.size());
+                break;
+            case arg_kind::pointer_array: {
+                // One table of pointers into one block holding every problem,
+                //  each starting on a 64-byte boundary.
+                std::size_t problems = 0, bytes = 0;
+                for (const auto &group : arg.groups) {
+                    problems += group.problems;
+                    bytes += group.problems * ((group.extent * size + 63) & ~std::size_t(63));
+                }
+                auto table = static_cast<void **>(
+                    allocate(state, device, problems * sizeof(void *)));
+                auto block = static_cast<char *>(allocate(state, device, bytes));
+                arg.memory = table;
+                for (const auto &group : arg.groups) {
+                    for (std::int64_t p = 0; p < group.problems; p++) {
+                        fill(block, arg.type, group);
+                        *table++ = block;
+                        block += (group.extent * size + 63) & ~std::size_t(63);
+                    }
+                }
+                break;
+            }
+            default:
+                break;
+        }
+    }
+    state.prepared = true;
+}
+
+void replay_run(cl::sycl::queue &queue, recorded_call &call) {
+    if (!call.state || !call.state->prepared)
+        throw onemkl::InvalidArgumentsException("call to " + call.name + " is not prepared");
+    registry()[call.state->slot](queue, *call.state);
+}
+
+void replay_release(recorded_call &call) {
+    if (call.state)
+        release(*call.state);
+}
+
+} //namespace detail
+} // namespace blas
+} // namespace onemkl
@@ -0,0 +1,392 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _BLAS_RECORD_HPP_
+#define _BLAS_RECORD_HPP_
+
+#include <CL/sycl.hpp>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "onemkl/blas/record.hpp"
+#include "onemkl/types.hpp"
+
+namespace onemkl {
+namespace blas {
+namespace detail {
+
+// Call recording (record.cpp). While recording, each call made through the
+//  loader describes its arguments from their C++ types; record.cpp derives the
+//  extent of the data operands from the integer arguments and appends the call
+//  to the recording. Replay decodes the same arguments back, from synthetic
+//  operands, into a call to the routine in the same table slot.
+
+enum class arg_kind : std::uint8_t {
+    value,
+    buffer,
+    pointer,
+    array,
+    pointer_array,
+    dependencies,
+    queue,
+    unsupported
+};
+
+enum class value_type : std::uint8_t {
+    none,
+    s,
+    d,
+    c,
+    z,
+    h,
+    bf16,
+    s8,
+    u8,
+    s32,
+    s64,
+    transpose,
+    uplo,
+    diag,
+    side,
+    offset,
+    pack_matrix
+};
+
+template <typename T>
+constexpr value_type value_code() {
+    return value_type::none;
+}
+template <>
+constexpr value_type value_code<float>() {
+    return value_type::s;
+}
+template <>
+constexpr value_type value_code<double>() {
+    return value_type::d;
+}
+template <>
+constexpr value_type value_code<std::complex<float>>() {
+    return value_type::c;
+}
+template <>
+constexpr value_type value_code<std::complex<double>>() {
+    return value_type::z;
+}
+template <>
+constexpr value_type value_code<half>() {
+    return value_type::h;
+}
+template <>
+constexpr value_type value_code<bfloat16>() {
+    return value_type::bf16;
+}
+template <>
+constexpr value_type value_code<std::int8_t>() {
+    return value_type::s8;
+}
+template <>
+constexpr value_type value_code<std::uint8_t>() {
+    return value_type::u8;
+}
+template <>
+constexpr value_type value_code<std::int32_t>() {
+    return value_type::s32;
+}
+template <>
+constexpr value_type value_code<std::int64_t>() {
+    return value_type::s64;
+}
+template <>
+constexpr value_type value_code<transpose>() {
+    return value_type::transpose;
+}
+template <>
+constexpr value_type value_code<uplo>() {
+    return value_type::uplo;
+}
+template <>
+constexpr value_type value_code<diag>() {
+    return value_type::diag;
+}
+template <>
+constexpr value_type value_code<side>() {
+    return value_type::side;
+}
+template <>
+constexpr value_type value_code<offset>() {
+    return value_type::offset;
+}
+template <>
+constexpr value_type value_code<pack_matrix>() {
+    return value_type::pack_matrix;
+}
+
+template <typename T>
+constexpr bool is_value() {
+    return value_code<typename std::remove_cv<T>::type>() != value_type::none;
+}
+
+// One argument of a call being recorded. Pointers are kept so that the
+//  per-group arrays of the group batch APIs can be read.
+struct recorded_arg {
+    arg_kind kind           = arg_kind::unsupported;
+    value_type type         = value_type::none;
+    unsigned char value[16] = {};
+    std::int64_t count      = 0;
+    const void *pointer     = nullptr;
+};
+
+template <typename T>
+inline void describe_value(recorded_arg &arg, const T &value, std::true_type) {
+    static_assert(sizeof(T) <= sizeof(arg.value), "value too large to record");
+    arg.kind = arg_kind::value;
+    arg.type = value_code<T>();
+    std::memcpy(arg.value, &value, sizeof(T));
+}
+
+template <typename T>
+inline void describe_value(recorded_arg &, const T &, std::false_type) {}
+
+template <typename T>
+inline void describe(recorded_arg &arg, const T &value) {
+    describe_value(arg, value, std::integral_constant<bool, is_value<T>()>());
+}
+
+template <typename T>
+inline void describe(recorded_arg &arg, cl::sycl::buffer<T, 1> &buffer) {
+    if (!is_value<T>())
+        return;
+    arg.kind  = arg_kind::buffer;
+    arg.type  = value_code<T>();
+    arg.count = buffer.get_count();
+}
+
+template <typename T>
+inline void describe(recorded_arg &arg, T *pointer) {
+    if (!is_value<T>())
+        return;
+    arg.kind    = arg_kind::pointer;
+    arg.type    = value_code<typename std::remove_cv<T>::type>();
+    arg.pointer = pointer;
+}
+
+template <typename T>
+inline void describe(recorded_arg &arg, T **pointers) {
+    if (!is_value<T>())
+        return;
+    arg.kind    = arg_kind::pointer_array;
+    arg.type    = value_code<typename std::remove_cv<T>::type>();
+    arg.pointer = pointers;
+}
+
+inline void describe(recorded_arg &arg, cl::sycl::queue &) {
+    arg.kind = arg_kind::queue;
+}
+
+inline void describe(recorded_arg &arg, const cl::sycl::vector_class<cl::sycl::event> &) {
+    arg.kind = arg_kind::dependencies;
+}
+
+// Appends the call to the routine in table slot `slot`, field `name`, to the
+//  recording, if one is open.
+void record_add(std::size_t slot, const char *name, const recorded_arg *args, std::size_t count);
+
+template <typename... Args>
+void record_call(std::size_t slot, const char *name, Args &... args) {
+    recorded_arg described[sizeof...(Args)];
+    std::size_t i = 0;
+    int unused[]  = { 0, (describe(described[i++], args), 0)... };
+    (void)unused;
+    record_add(slot, name, described, sizeof...(Args));
+}
+
+// Synthetic operand of a replayed call: extent elements, filled as columns
+//  columns of leading dimension ld, repeated every stride elements. Arrays of
+//  pointers have one layout per group, for problems problems each.
+struct operand_layout {
+    std::int64_t extent   = 0;
+    std::int64_t ld       = 0;
+    std::int64_t stride   = 0;
+    std::int64_t columns  = 0;
+    std::int64_t problems = 1;
+};
+
+struct replay_arg {
+    arg_kind kind           = arg_kind::unsupported;
+    value_type type         = value_type::none;
+    unsigned char value[16] = {};
+    operand_layout layout;
+    std::vector<unsigned char> data;
+    std::vector<operand_layout> groups;
+
+    // Set by replay_prepare(): USM memory of pointers, arrays and arrays of
+    //  pointers, or the cl::sycl::buffer<T, 1> of buffers.
+    void *memory = nullptr;
+    std::shared_ptr<void> buffer;
+};
+
+struct replay_state {
+    std::size_t slot = 0;
+    std::string name;
+    std::vector<replay_arg> args;
+
+    bool prepared = false;
+    cl::sycl::context context;
+    std::vector<void *> allocations;
+
+    ~replay_state();
+};
+
+// Routine in table slot `slot`, field `name`, for the backend serving queue.
+void *replay_lookup(cl::sycl::queue &queue, std::size_t slot, const char *name);
+
+template <typename T, typename Enable = void>
+struct replay_decode {
+    static constexpr bool supported = false;
+};
+
+template <>
+struct replay_decode<cl::sycl::queue &> {
+    static constexpr bool supported = true;
+    static cl::sycl::queue &get(cl::sycl::queue &queue, replay_state &, std::size_t) {
+        return queue;
+    }
+};
+
+template <>
+struct replay_decode<const cl::sycl::vector_class<cl::sycl::event> &> {
+    static constexpr bool supported = true;
+    static const cl::sycl::vector_class<cl::sycl::event> &get(cl::sycl::queue &, replay_state &,
+                                                             std::size_t) {
+        static const cl::sycl::vector_class<cl::sycl::event> none;
+        return none;
+    }
+};
+
+template <typename T>
+struct replay_decode<T, typename std::enable_if<is_value<T>()>::type> {
+    static constexpr bool supported = true;
+    static T get(cl::sycl::queue &, replay_state &state, std::size_t i) {
+        T value;
+        std::memcpy(&value, state.args[i].value, sizeof(T));
+        return value;
+    }
+};
+
+template <typename T>
+struct replay_decode<cl::sycl::buffer<T, 1> &, typename std::enable_if<is_value<T>()>::type> {
+    static constexpr bool supported = true;
+    static cl::sycl::buffer<T, 1> &get(cl::sycl::queue &, replay_state &state, std::size_t i) {
+        return *static_cast<cl::sycl::buffer<T, 1> *>(state.args[i].buffer.get());
+    }
+};
+
+template <typename T>
+struct replay_decode<T *, typename std::enable_if<is_value<T>()>::type> {
+    static constexpr bool supported = true;
+    static T *get(cl::sycl::queue &, replay_state &state, std::size_t i) {
+        return static_cast<T *>(state.args[i].memory);
+    }
+};
+
+template <typename T>
+struct replay_decode<T **, typename std::enable_if<is_value<T>()>::type> {
+    static constexpr bool supported = true;
+    static T **get(cl::sycl::queue &, replay_state &state, std::size_t i) {
+        return static_cast<T **>(state.args[i].memory);
+    }
+};
+
+template <bool... B>
+struct bool_pack {};
+template <bool... B>
+struct all_true : std::is_same<bool_pack<true, B...>, bool_pack<B..., true>> {};
+
+template <std::size_t... I>
+struct indices {};
+template <std::size_t N, std::size_t... I>
+struct make_indices : make_indices<N - 1, N - 1, I...> {};
+template <std::size_t... I>
+struct make_indices<0, I...> {
+    typedef indices<I...> type;
+};
+
+typedef void (*replay_fn)(cl::sycl::queue &queue, replay_state &state);
+
+// Replays a call to a routine of type F, a function table field.
+template <typename F>
+struct replayer;
+
+template <typename R, typename... Args>
+struct replayer<R (*)(Args...)> {
+    static constexpr bool supported = all_true<replay_decode<Args>::supported...>::value;
+
+    static void run(cl::sycl::queue &queue, replay_state &state) {
+        invoke(queue, state, typename make_indices<sizeof...(Args)>::type());
+        queue.wait();
+    }
+
+    template <std::size_t... I>
+    static void invoke(cl::sycl::queue &queue, replay_state &state, indices<I...>) {
+        auto fn = reinterpret_cast<R (*)(Args...)>(
+            replay_lookup(queue, state.slot, state.name.c_str()));
+        fn(replay_decode<Args>::get(queue, state, I)...);
+    }
+};
+
+template <bool supported>
+struct replay_function {
+    template <typename F>
+    static replay_fn get() {
+        return &replayer<F>::run;
+    }
+};
+
+template <>
+struct replay_function<false> {
+    template <typename F>
+    static replay_fn get() {
+        return nullptr;
+    }
+};
+
+// Registers fn, nullptr if calls to slot cannot be replayed; returns true.
+bool replay_register(std::size_t slot, replay_fn fn);
+
+// Registered before main() for each table slot called through BACKEND_FUNC.
+template <std::size_t Slot, typename F>
+struct replay_registrar {
+    static const bool registered;
+};
+
+template <std::size_t Slot, typename F>
+const bool replay_registrar<Slot, F>::registered =
+    replay_register(Slot, replay_function<replayer<F>::supported>::template get<F>());
+
+} //namespace detail
+} // namespace blas
+} // namespace onemkl
+
+#endif //_BLAS_RECORD_HPP_
@@ -0,0 +1,697 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "onemkl/blas/detail/blas_loader.hpp"
+#include "blas/loader.hpp"
+#include "blas/trace.hpp"
+
+// Routine `name` of function_table_t in backend table t, nullptr when the
+//  backend does not provide it.
+#define TABLE_FIND(t, name)                      \
+    (t).find<decltype(function_table_t::name)>( \
+        offsetof(function_table_t, name) / sizeof(void *), #name)
+
+namespace onemkl {
+namespace blas {
+namespace detail {
+
+namespace {
+
+constexpr std::size_t num_slots = backend_table::num_slots;
+constexpr int num_backends      = table_initializer::num_backends;
+
+// Counters of one table slot on one thread. Only the owning thread writes
+//  them, with a relaxed load and store, so counting takes no lock and no
+//  read-modify-write; a concurrent read may miss the call being counted.
+struct slot_counters {
+    std::atomic<std::uint64_t> calls;
+    std::atomic<std::uint64_t> flops;
+    std::atomic<std::uint64_t> bytes;
+    std::atomic<std::uint64_t> submit_ns;
+};
+
+struct thread_counters {
+    slot_counters slots[num_slots];
+};
+
+inline void bump(std::atomic<std::uint64_t> &counter, std::uint64_t value) {
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+// Flop and byte models, shared by the routines with the same dimensions.
+//  Flops are those of the reference algorithm (4 real flops per complex
+//  multiply-add pair); bytes count every operand once, stored triangles and
+//  bands only.
+enum class cost_model {
+    none,
+    asum,
+    nrm2,
+    axpy,
+    axpy_batch,
+    axpy_batch_group,
+    copy,
+    dot,
+    iamax,
+    rot,
+    scal,
+    swap,
+    gemv,
+    gbmv,
+    ger,
+    hemv,
+    hbmv,
+    her,
+    her2,
+    tbmv,
+    trmv,
+    gemm,
+    gemm_batch,
+    gemm_batch_group,
+    hemm,
+    herk,
+    her2k,
+    trmm,
+    trsm_batch,
+    trsm_batch_group,
+    gemmt
+};
+
+cost_model model_of(const std::string &routine) {
+    static const std::map<std::string, cost_model> models = {
+        { "asum", cost_model::asum },
+        { "nrm2", cost_model::nrm2 },
+        { "axpy", cost_model::axpy },
+        { "axpy_batch_strided", cost_model::axpy_batch },
+        { "axpy_batch_group", cost_model::axpy_batch_group },
+        { "copy", cost_model::copy },
+        { "dot", cost_model::dot },
+        { "dotc", cost_model::dot },
+        { "dotu", cost_model::dot },
+        { "sdsdot", cost_model::dot },
+        { "iamax", cost_model::iamax },
+        { "iamin", cost_model::iamax },
+        { "rot", cost_model::rot },
+        { "rotm", cost_model::rot },
+        { "scal", cost_model::scal },
+        { "swap", cost_model::swap },
+        { "gemv", cost_model::gemv },
+        { "gbmv", cost_model::gbmv },
+        { "ger", cost_model::ger },
+        { "gerc", cost_model::ger },
+        { "geru", cost_model::ger },
+        { "hemv", cost_model::hemv },
+        { "symv", cost_model::hemv },
+        { "hpmv", cost_model::hemv },
+        { "spmv", cost_model::hemv },
+        { "hbmv", cost_model::hbmv },
+        { "sbmv", cost_model::hbmv },
+        { "her", cost_model::her },
+        { "syr", cost_model::her },
+        { "hpr", cost_model::her },
+        { "spr", cost_model::her },
+        { "her2", cost_model::her2 },
+        { "syr2", cost_model::her2 },
+        { "hpr2", cost_model::her2 },
+        { "spr2", cost_model::her2 },
+        { "tbmv", cost_model::tbmv },
+        { "tbsv", cost_model::tbmv },
+        { "trmv", cost_model::trmv },
+        { "trsv", cost_model::trmv },
+        { "tpmv", cost_model::trmv },
+        { "tpsv", cost_model::trmv },
+        { "gemm", cost_model::gemm },
+        { "gemm_ext", cost_model::gemm },
+        { "gemm_compute", cost_model::gemm },
+        { "gemm_batch_strided", cost_model::gemm_batch },
+        { "gemm_batch_group", cost_model::gemm_batch_group },
+        { "hemm", cost_model::hemm },
+        { "symm", cost_model::hemm },
+        { "herk", cost_model::herk },
+        { "syrk", cost_model::herk },
+        { "her2k", cost_model::her2k },
+        { "syr2k", cost_model::her2k },
+        { "trmm", cost_model::trmm },
+        { "trsm", cost_model::trmm },
+        { "trsm_batch_strided", cost_model::trsm_batch },
+        { "trsm_batch_group", cost_model::trsm_batch_group },
+        { "gemmt", cost_model::gemmt }
+    };
+    auto it = models.find(routine);
+    return (it == models.end()) ? cost_model::none : it->second;
+}
+
+double element_size(const char *precision) {
+    if (!precision)
+        return 0.0;
+    static const std::map<std::string, double> sizes = {
+        { "s", 4.0 }, { "d", 8.0 },    { "c", 8.0 },  { "z", 16.0 },
+        { "h", 2.0 }, { "bf16", 2.0 }, { "s8", 1.0 }, { "u8", 1.0 }
+    };
+    auto it = sizes.find(precision);
+    return (it == sizes.end()) ? 0.0 : it->second;
+}
+
+// Estimated flops and bytes of call r, from its dimensions (see the
+//  std::int64_t arguments of each routine in function_table_t). The group
+//  batch routines sum over their groups: dim(0) is group_count, array(a, g)
+//  entry g of their a-th std::int64_t array, the last one being group_size.
+void estimate(cost_model model, const trace_record &r, double &flops, double &bytes) {
+    auto dim = [&](int i) {
+        return (i < r.num_dims) ? (double)std::max<std::int64_t>(r.dims[i], 0) : 0.0;
+    };
+    auto array = [&](int a, std::int64_t g) {
+        return (a < r.num_arrays && r.arrays[a])
+                   ? (double)std::max<std::int64_t>(r.arrays[a][g], 0)
+                   : 0.0;
+    };
+    std::int64_t groups = (r.num_arrays > 0) ? (std::int64_t)dim(0) : 0;
+    int group_size      = r.num_arrays - 1;
+    double m = dim(0), n = dim(1), k = dim(2);
+    // Order of the triangular or Hermitian matrix of level 3 routines.
+    double order    = (r.side == 'R') ? n : m;
+    double elements = 0.0;
+    flops           = 0.0;
+    switch (model) {
+        case cost_model::none:
+            break;
+        case cost_model::asum:
+        case cost_model::iamax:
+            flops    = m;
+            elements = m;
+            break;
+        case cost_model::nrm2:
+            flops    = 2 * m;
+            elements = m;
+            break;
+        case cost_model::axpy:
+        case cost_model::dot:
+            flops    = 2 * m;
+            elements = 2 * m;
+            break;
+        case cost_model::axpy_batch:
+            flops    = 2 * m * dim(5);
+            elements = 2 * m * dim(5);
+            break;
+        case cost_model::axpy_batch_group:
+            // n, incx, incy, group_size
+            for (std::int64_t g = 0; g < groups; g++) {
+                flops += 2 * array(0, g) * array(group_size, g);
+                elements += 2 * array(0, g) * array(group_size, g);
+            }
+            break;
+        case cost_model::copy:
+        case cost_model::swap:
+            elements = 2 * m;
+            break;
+        case cost_model::rot:
+            flops    = 6 * m;
+            elements = 2 * m;
+            break;
+        case cost_model::scal:
+            flops    = m;
+            elements = m;
+            break;
+        case cost_model::gemv:
+        case cost_model::ger:
+            flops    = 2 * m * n;
+            elements = m * n + m + n;
+            break;
+        case cost_model::gbmv:
+            flops    = 2 * n * (k + dim(3) + 1);
+            elements = n * (k + dim(3) + 1) + m + n;
+            break;
+        case cost_model::hemv:
+            flops    = 2 * m * m;
+            elements = m * (m + 1) / 2 + 2 * m;
+            break;
+        case cost_model::hbmv:
+            flops    = 2 * m * (2 * n + 1);
+            elements = m * (n + 1) + 2 * m;
+            break;
+        case cost_model::her:
+            flops    = m * m;
+            elements = m * (m + 1) / 2 + m;
+            break;
+        case cost_model::her2:
+            flops    = 2 * m * m;
+            elements = m * (m + 1) / 2 + 2 * m;
+            break;
+        case cost_model::tbmv:
+            flops    = 2 * m * (n + 1);
+            elements = m * (n + 1) + m;
+            break;
+        case cost_model::trmv:
+            flops    = m * m;
+            elements = m * (m + 1) / 2 + m;
+            break;
+        case cost_model::gemm:
+            flops    = 2 * m * n * k;
+            elements = m * k + k * n + m * n;
+            break;
+        case cost_model::gemm_batch:
+            flops    = 2 * m * n * k * dim(9);
+            elements = (m * k + k * n + m * n) * dim(9);
+            break;
+        case cost_model::gemm_batch_group:
+            // m, n, k, lda, ldb, ldc, group_size
+            for (std::int64_t g = 0; g < groups; g++) {
+                double gm = array(0, g), gn = array(1, g), gk = array(2, g);
+                flops += 2 * gm * gn * gk * array(group_size, g);
+                elements += (gm * gk + gk * gn + gm * gn) * array(group_size, g);
+            }
+            break;
+        case cost_model::hemm:
+            flops    = 2 * m * n * order;
+            elements = order * (order + 1) / 2 + 2 * m * n;
+            break;
+        case cost_model::herk:
+            flops    = m * (m + 1) * n;
+            elements = m * n + m * (m + 1) / 2;
+            break;
+        case cost_model::her2k:
+        case cost_model::gemmt:
+            flops    = 2 * m * (m + 1) * n;
+            elements = 2 * m * n + m * (m + 1) / 2;
+            break;
+        case cost_model::trmm:
+            flops    = m * n * order;
+            elements = order * (order + 1) / 2 + m * n;
+            break;
+        case cost_model::trsm_batch:
+            flops    = m * n * order * dim(6);
+            elements = (order * (order + 1) / 2 + m * n) * dim(6);
+            break;
+        case cost_model::trsm_batch_group:
+            // m, n, lda, ldb, group_size
+            for (std::int64_t g = 0; g < groups; g++) {
+                double gm = array(0, g), gn = array(1, g);
+                double go = (r.sides && r.sides[g] == side::right) ? gn : gm;
+                flops += gm * gn * go * array(group_size, g);
+                elements += (go * (go + 1) / 2 + gm * gn) * array(group_size, g);
+            }
+            break;
+    }
+    if (r.precision && (!std::strcmp(r.precision, "c") || !std::strcmp(r.precision, "z")))
+        flops *= 4;
+    bytes = elements * element_size(r.precision);
+}
+
+// Routine and memory model of a counter name: "sgemm_usm" -> "gemm", USM;
+//  "scasum" -> "asum"; "isamax" -> "iamax"; "gemm_f16f16f32_ext" -> "gemm_ext".
+//  Names that do not start with a precision are kept whole.
+void split_name(const std::string &name, std::string &routine, bool &usm) {
+    static const char *two_letter[] = { "scasum", "dzasum", "scnrm2", "dznrm2", "csrot",
+                                        "zdrot",  "csscal", "zdscal", "dsdot" };
+    const std::string suffix = "_usm";
+    std::string base         = name;
+    usm = base.size() > suffix.size() &&
+          base.compare(base.size() - suffix.size(), suffix.size(), suffix) == 0;
+    if (usm)
+        base.resize(base.size() - suffix.size());
+
+    routine = base;
+    if (base.compare(0, 5, "gemm_") == 0) {
+        bool ext = base.size() > 4 && base.compare(base.size() - 4, 4, "_ext") == 0;
+        routine  = ext ? "gemm_ext" : "gemm";
+        return;
+    }
+    if (base == "sdsdot")
+        return;
+    for (const char *p : two_letter) {
+        if (base == p) {
+            routine = base.substr(2);
+            return;
+        }
+    }
+    if (base.size() > 2 && base[0] == 'i' && std::strchr("sdcz", base[1]))
+        routine = "i" + base.substr(2);
+    else if (base.size() > 1 && std::strchr("sdczh", base[0]))
+        routine = base.substr(1);
+}
+
+// Precision of a counter name, for those only known to a backend.
+std::string precision_of(const std::string &name) {
+    if (name.size() > 2 && name[0] == 'i' && std::strchr("sdcz", name[1]))
+        return name.substr(1, 1);
+    if (name.size() > 1 && std::strchr("sdczh", name[0]))
+        return name.substr(0, 1);
+    return "";
+}
+
+// Totals of a counter name, or of a backend counter, over all threads.
+struct totals {
+    std::string precision;
+    std::uint64_t calls     = 0;
+    std::uint64_t flops     = 0;
+    std::uint64_t bytes     = 0;
+    std::uint64_t submit_ns = 0;
+    std::uint64_t tasks     = 0;
+    std::uint64_t exec_ns   = 0;
+
+    std::uint64_t exec_histogram[stats_buckets] = {};
+};
+
+struct counter_total {
+    std::uint64_t value = 0;
+    bool cumulative     = true;
+};
+
+struct snapshot {
+    std::map<std::string, totals> routines;
+    std::map<std::string, counter_total> counters;
+};
+
+// Adds the counters of a backend to a snapshot, its internal counters named
+//  after the backend: "intelcpu.fp16_conversion_bytes".
+class snapshot_sink final : public stats_sink {
+public:
+    snapshot_sink(snapshot &out, const std::string &backend_name)
+            : out(out),
+              prefix(backend_name + ".") {}
+
+    void task(const char *name, std::uint64_t tasks, std::uint64_t exec_ns,
+              const std::uint64_t *exec_histogram) override {
+        totals &t = out.routines[name];
+        t.tasks += tasks;
+        t.exec_ns += exec_ns;
+        for (int b = 0; b < stats_buckets; b++)
+            t.exec_histogram[b] += exec_histogram[b];
+    }
+
+    void counter(const char *name, std::uint64_t value, bool cumulative) override {
+        counter_total &c = out.counters[prefix + name];
+        c.value += value;
+        c.cumulative = cumulative;
+    }
+
+private:
+    snapshot &out;
+    std::string prefix;
+};
+
+// What is known of a table slot, set by its first counted call.
+struct slot_info {
+    std::atomic<const char *> name;
+    std::atomic<const char *> precision;
+    std::atomic<int> model;
+};
+
+// Counter blocks outlive their threads, so that nothing counted is lost; the
+//  state is never destroyed, so that the counters can be dumped at exit.
+struct stats_state {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<thread_counters>> threads;
+    slot_info slots[num_slots];
+    // Backends told to count, while statistics are on.
+    std::atomic<bool> enabled[num_backends];
+    snapshot baseline;
+    std::string dump_path;
+    std::once_flag at_exit;
+};
+
+stats_state &state() {
+    static stats_state *s = new stats_state();
+    return *s;
+}
+
+thread_counters &local_counters() {
+    thread_local thread_counters *counters = nullptr;
+    if (!counters) {
+        // Value-initialized: all counters start at zero.
+        std::unique_ptr<thread_counters> block(new thread_counters());
+        counters = block.get();
+        auto &s  = state();
+        std::lock_guard<std::mutex> lock(s.mutex);
+        s.threads.push_back(std::move(block));
+    }
+    return *counters;
+}
+
+// Turn the counters of backend b on or off, if it is loaded. s.mutex is held.
+void enable_backend(stats_state &s, backend b, bool enable) {
+    backend_table *t = function_tables.loaded(b);
+    if (!t)
+        return;
+    if (auto fn = TABLE_FIND(*t, stats_enable_sycl))
+        fn(enable);
+    s.enabled[static_cast<int>(b)].store(enable, std::memory_order_relaxed);
+}
+
+// Counters of all threads and loaded backends. s.mutex is held.
+snapshot collect(stats_state &s) {
+    snapshot now;
+    for (auto &block : s.threads) {
+        for (std::size_t i = 0; i < num_slots; i++) {
+            const char *name = s.slots[i].name.load(std::memory_order_acquire);
+            if (!name)
+                continue;
+            const slot_counters &c = block->slots[i];
+            std::uint64_t calls    = c.calls.load(std::memory_order_relaxed);
+            if (!calls)
+                continue;
+            totals &t = now.routines[routine_name(name)];
+            if (const char *precision = s.slots[i].precision.load(std::memory_order_relaxed))
+                t.precision = precision;
+            t.calls += calls;
+            t.flops += c.flops.load(std::memory_order_relaxed);
+            t.bytes += c.bytes.load(std::memory_order_relaxed);
+            t.submit_ns += c.submit_ns.load(std::memory_order_relaxed);
+        }
+    }
+    for (int i = 0; i < num_backends; i++) {
+        backend b        = static_cast<backend>(i);
+        backend_table *t = function_tables.loaded(b);
+        if (!t)
+            continue;
+        if (auto fn = TABLE_FIND(*t, stats_read_sycl)) {
+            snapshot_sink sink(now, backend_map.at(b));
+            fn(sink);
+        }
+    }
+    return now;
+}
+
+std::uint64_t since(std::uint64_t now, std::uint64_t base) {
+    return (now > base) ? now - base : 0;
+}
+
+stats_report report(stats_state &s) {
+    snapshot now = collect(s);
+    stats_report out;
+    for (auto &entry : now.routines) {
+        totals t   = entry.second;
+        auto based = s.baseline.routines.find(entry.first);
+        if (based != s.baseline.routines.end()) {
+            const totals &base = based->second;
+            t.calls            = since(t.calls, base.calls);
+            t.flops            = since(t.flops, base.flops);
+            t.bytes            = since(t.bytes, base.bytes);
+            t.submit_ns        = since(t.submit_ns, base.submit_ns);
+            t.tasks            = since(t.tasks, base.tasks);
+            t.exec_ns          = since(t.exec_ns, base.exec_ns);
+            for (int b = 0; b < stats_buckets; b++)
+                t.exec_histogram[b] = since(t.exec_histogram[b], base.exec_histogram[b]);
+        }
+        if (!t.calls && !t.tasks)
+            continue;
+
+        routine_stats r;
+        r.name = entry.first;
+        split_name(r.name, r.routine, r.usm);
+        r.precision = t.precision.empty() ? precision_of(r.name) : t.precision;
+        r.calls     = t.calls;
+        r.flops     = t.flops;
+        r.bytes     = t.bytes;
+        r.submit_ns = t.submit_ns;
+        r.tasks     = t.tasks;
+        r.exec_ns   = t.exec_ns;
+        std::copy(t.exec_histogram, t.exec_histogram + stats_buckets, r.exec_histogram);
+        out.routines.push_back(r);
+    }
+    for (auto &entry : now.counters) {
+        counter_stats c;
+        c.name     = entry.first;
+        c.value    = entry.second.value;
+        auto based = s.baseline.counters.find(entry.first);
+        if (entry.second.cumulative && based != s.baseline.counters.end())
+            c.value = since(c.value, based->second.value);
+        out.counters.push_back(c);
+    }
+    return out;
+}
+
+void write_json(std::FILE *out, const stats_report &r) {
+    std::fprintf(out, "{\"routines\": [");
+    for (std::size_t i = 0; i < r.routines.size(); i++) {
+        const routine_stats &s = r.routines[i];
+        std::fprintf(out,
+                     "%s\n{\"name\": \"%s\", \"routine\": \"%s\", \"precision\": \"%s\", "
+                     "\"usm\": %s, \"calls\": %llu, \"flops\": %llu, \"bytes\": %llu, "
+                     "\"submit_ns\": %llu, \"tasks\": %llu, \"exec_ns\": %llu, "
+                     "\"exec_histogram\": [",
+                     i ? "," : "", s.name.c_str(), s.routine.c_str(), s.precision.c_str(),
+                     s.usm ? "true" : "false", (unsigned long long)s.calls,
+                     (unsigned long long)s.flops, (unsigned long long)s.bytes,
+                     (unsigned long long)s.submit_ns, (unsigned long long)s.tasks,
+                     (unsigned long long)s.exec_ns);
+        for (int b = 0; b < stats_buckets; b++)
+            std::fprintf(out, "%s%llu", b ? ", " : "", (unsigned long long)s.exec_histogram[b]);
+        std::fprintf(out, "]}");
+    }
+    std::fprintf(out, "\n],\n\"counters\": {");
+    for (std::size_t i = 0; i < r.counters.size(); i++)
+        std::fprintf(out, "%s\n\"%s\": %llu", i ? "," : "", r.counters[i].name.c_str(),
+                     (unsigned long long)r.counters[i].value);
+    std::fprintf(out, "\n}}\n");
+}
+
+// Routines first, then the backend counters after an empty line.
+void write_csv(std::FILE *out, const stats_report &r) {
+    std::fprintf(out, "name,routine,precision,usm,calls,flops,bytes,submit_ns,tasks,exec_ns");
+    for (int b = 0; b < stats_buckets; b++)
+        std::fprintf(out, ",exec_hist_%d", b);
+    std::fprintf(out, "\n");
+    for (const auto &s : r.routines) {
+        std::fprintf(out, "%s,%s,%s,%d,%llu,%llu,%llu,%llu,%llu,%llu", s.name.c_str(),
+                     s.routine.c_str(), s.precision.c_str(), s.usm ? 1 : 0,
+                     (unsigned long long)s.calls, (unsigned long long)s.flops,
+                     (unsigned long long)s.bytes, (unsigned long long)s.submit_ns,
+                     (unsigned long long)s.tasks, (unsigned long long)s.exec_ns);
+        for (int b = 0; b < stats_buckets; b++)
+            std::fprintf(out, ",%llu", (unsigned long long)s.exec_histogram[b]);
+        std::fprintf(out, "\n");
+    }
+    std::fprintf(out, "\ncounter,value\n");
+    for (const auto &c : r.counters)
+        std::fprintf(out, "%s,%llu\n", c.name.c_str(), (unsigned long long)c.value);
+}
+
+void stats_at_exit() {
+    auto &s = state();
+    std::string path;
+    {
+        std::lock_guard<std::mutex> lock(s.mutex);
+        path = s.dump_path;
+    }
+    stats_dump(path.c_str());
+}
+
+// ONEMKL_BLAS_STATS=<file> counts the whole process and dumps to <file>.
+struct stats_environment {
+    stats_environment() {
+        const char *path = std::getenv("ONEMKL_BLAS_STATS");
+        if (!path || !*path)
+            return;
+        // No backend is loaded yet: each is told on its first call.
+        state().dump_path = path;
+        instrumentation.fetch_or(instrument_stats, std::memory_order_relaxed);
+    }
+} stats_environment_init;
+
+} // namespace
+
+void stats_add(cl::sycl::queue &queue, std::size_t slot, const trace_record &r) {
+    auto &s         = state();
+    slot_info &info = s.slots[slot];
+    int model       = info.model.load(std::memory_order_relaxed);
+    if (!model) {
+        std::string routine;
+        bool usm;
+        split_name(routine_name(r.name), routine, usm);
+        model = static_cast<int>(model_of(routine)) + 1;
+        info.precision.store(r.precision, std::memory_order_relaxed);
+        info.name.store(r.name, std::memory_order_release);
+        info.model.store(model, std::memory_order_relaxed);
+    }
+
+    double flops, bytes;
+    estimate(static_cast<cost_model>(model - 1), r, flops, bytes);
+    slot_counters &c = local_counters().slots[slot];
+    bump(c.calls, 1);
+    bump(c.flops, (std::uint64_t)flops);
+    bump(c.bytes, (std::uint64_t)bytes);
+    bump(c.submit_ns, (std::uint64_t)(r.end_ns - r.begin_ns));
+
+    // Backends loaded after stats_enable() are told on their first call.
+    backend b = function_tables.backend_of(function_tables[queue]);
+    if (!s.enabled[static_cast<int>(b)].load(std::memory_order_relaxed)) {
+        std::lock_guard<std::mutex> lock(s.mutex);
+        if (instrumentation.load(std::memory_order_relaxed) & instrument_stats)
+            enable_backend(s, b, true);
+    }
+
+    // The dump at exit is registered here, after the SYCL runtime is up, so
+    //  that it runs before the runtime is torn down.
+    if (!s.dump_path.empty())
+        std::call_once(s.at_exit, []() { std::atexit(stats_at_exit); });
+}
+
+void stats_enable(bool enable) {
+    auto &s = state();
+    std::lock_guard<std::mutex> lock(s.mutex);
+    if (enable)
+        instrumentation.fetch_or(instrument_stats, std::memory_order_relaxed);
+    else
+        instrumentation.fetch_and(~instrument_stats, std::memory_order_relaxed);
+    for (int i = 0; i < num_backends; i++)
+        enable_backend(s, static_cast<backend>(i), enable);
+}
+
+stats_report stats() {
+    auto &s = state();
+    std::lock_guard<std::mutex> lock(s.mutex);
+    return report(s);
+}
+
+void stats_reset() {
+    auto &s = state();
+    std::lock_guard<std::mutex> lock(s.mutex);
+    s.baseline = collect(s);
+}
+
+void stats_dump(const char *path) {
+    stats_report r = stats();
+    std::FILE *out = std::fopen(path, "w");
+    if (!out) {
+        std::fprintf(stderr, "oneMKL: cannot write statistics to %s\n", path);
+        return;
+    }
+    std::string name(path);
+    const std::string json = ".json";
+    if (name.size() >= json.size() &&
+        name.compare(name.size() - json.size(), json.size(), json) == 0)
+        write_json(out, r);
+    else
+        write_csv(out, r);
+    std::fclose(out);
+}
+
+} //namespace detail
+} // namespace blas
+} // namespace onemkl
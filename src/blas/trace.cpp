@@ -0,0 +1,279 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "onemkl/blas/detail/blas_loader.hpp"
+#include "blas/loader.hpp"
+#include "blas/trace.hpp"
+
+namespace onemkl {
+namespace blas {
+namespace detail {
+
+std::atomic<unsigned> instrumentation{ 0 };
+
+namespace {
+
+// Records of one thread. Only the owning thread appends, so the mutex is
+//  uncontended except while the trace is being written. The buffer holds at
+//  most limit records: once full, each new record replaces the oldest one, at
+//  index oldest, so that a long-running process keeps its latest calls in
+//  bounded memory.
+struct thread_buffer {
+    std::mutex mutex;
+    std::vector<trace_record> records;
+    std::size_t oldest    = 0;
+    std::uint64_t dropped = 0;
+    int tid;
+
+    void add(trace_record &&r, std::size_t limit) {
+        if (records.size() < limit) {
+            records.push_back(std::move(r));
+            return;
+        }
+        records[oldest] = std::move(r);
+        oldest          = (oldest + 1) % records.size();
+        dropped++;
+    }
+
+    void clear() {
+        records.clear();
+        oldest  = 0;
+        dropped = 0;
+    }
+};
+
+// Records kept per thread unless ONEMKL_BLAS_TRACE_LIMIT says otherwise,
+//  some 16 MB.
+constexpr std::size_t default_trace_limit = 1 << 16;
+
+// Buffers outlive their threads so that the records of finished threads are
+//  still written; the state is never destroyed, so that the trace can be
+//  written at exit.
+struct trace_state {
+    std::mutex mutex;
+    std::string path;
+    double epoch_ns = 0.0;
+    int next_tid    = 1;
+    std::atomic<std::size_t> limit{ default_trace_limit };
+    std::vector<std::shared_ptr<thread_buffer>> buffers;
+    std::once_flag at_exit;
+};
+
+trace_state &state() {
+    static trace_state *s = new trace_state;
+    return *s;
+}
+
+double now_ns() {
+    return std::chrono::duration<double, std::nano>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+thread_buffer &local_buffer() {
+    thread_local std::shared_ptr<thread_buffer> buffer;
+    if (!buffer) {
+        buffer  = std::make_shared<thread_buffer>();
+        auto &s = state();
+        std::lock_guard<std::mutex> lock(s.mutex);
+        buffer->tid = s.next_tid++;
+        s.buffers.push_back(buffer);
+    }
+    return *buffer;
+}
+
+// Host events go to process 1, one track per thread; device execution times
+//  of profiled calls go to process 2, on the track of the thread that made
+//  the call, placed at the host time of the call plus the submit-to-start
+//  delay measured on the device.
+void write_event(std::FILE *out, const trace_record &r, int tid, double epoch_ns) {
+    std::string name = routine_name(r.name);
+    double ts        = (r.begin_ns - epoch_ns) / 1e3;
+    double dur       = (r.end_ns - r.begin_ns) / 1e3;
+
+    std::fprintf(out,
+                 ",\n{\"name\": \"%s\", \"cat\": \"blas\", \"ph\": \"X\", \"pid\": 1, "
+                 "\"tid\": %d, \"ts\": %.3f, \"dur\": %.3f, \"args\": {\"backend\": \"%s\", "
+                 "\"precision\": \"%s\", \"dims\": [",
+                 name.c_str(), tid, ts, dur, r.backend, r.precision ? r.precision : "");
+    for (int i = 0; i < r.num_dims; i++)
+        std::fprintf(out, "%s%lld", i ? ", " : "", (long long)r.dims[i]);
+    std::fprintf(out, "], \"submit_us\": %.3f", dur);
+
+    bool profiled   = false;
+    cl_ulong submit = 0, start = 0, end = 0;
+    if (r.has_event) {
+        try {
+            cl::sycl::event event = r.event;
+            event.wait();
+            submit   = event.get_profiling_info<cl::sycl::info::event_profiling::command_submit>();
+            start    = event.get_profiling_info<cl::sycl::info::event_profiling::command_start>();
+            end      = event.get_profiling_info<cl::sycl::info::event_profiling::command_end>();
+            profiled = end >= start && start >= submit;
+        }
+        catch (cl::sycl::exception const &) {
+        }
+    }
+    if (profiled)
+        std::fprintf(out, ", \"device_us\": %.3f", (end - start) / 1e3);
+    std::fprintf(out, "}}");
+
+    if (profiled)
+        std::fprintf(out,
+                     ",\n{\"name\": \"%s\", \"cat\": \"device\", \"ph\": \"X\", \"pid\": 2, "
+                     "\"tid\": %d, \"ts\": %.3f, \"dur\": %.3f}",
+                     name.c_str(), tid, ts + (start - submit) / 1e3, (end - start) / 1e3);
+}
+
+void trace_at_exit() {
+    trace_stop();
+}
+
+// ONEMKL_BLAS_TRACE=<file> traces the whole process into <file>.
+struct trace_environment {
+    trace_environment() {
+        const char *path = std::getenv("ONEMKL_BLAS_TRACE");
+        if (path && *path)
+            trace_start(path);
+    }
+} trace_environment_init;
+
+} // namespace
+
+std::string routine_name(const char *field) {
+    std::string name(field);
+    const std::string suffix = "_sycl";
+    if (name.size() > suffix.size() &&
+        name.compare(name.size() - suffix.size(), suffix.size(), suffix) == 0)
+        name.resize(name.size() - suffix.size());
+    return name;
+}
+
+void trace_begin(trace_record &r, const char *name) {
+    r.name     = name;
+    r.begin_ns = now_ns();
+}
+
+void instrument_end(cl::sycl::queue &queue, unsigned mode, std::size_t slot, trace_record &r) {
+    r.end_ns = now_ns();
+    if (mode & instrument_stats)
+        stats_add(queue, slot, r);
+    if (mode & instrument_trace)
+        trace_add(queue, r);
+}
+
+void trace_add(cl::sycl::queue &queue, trace_record &r) {
+    r.backend = backend_map.at(function_tables.backend_of(function_tables[queue])).c_str();
+    // Only events of profiling queues are kept, to resolve when writing.
+    if (r.has_event && !queue.has_property<cl::sycl::property::queue::enable_profiling>()) {
+        r.event     = cl::sycl::event();
+        r.has_event = false;
+    }
+
+    // The trace is written at exit by a handler registered here, after the
+    //  SYCL runtime is up, so that it runs before the runtime is torn down.
+    auto &s = state();
+    std::call_once(s.at_exit, []() { std::atexit(trace_at_exit); });
+
+    thread_buffer &buffer = local_buffer();
+    std::lock_guard<std::mutex> lock(buffer.mutex);
+    buffer.add(std::move(r), s.limit.load(std::memory_order_relaxed));
+}
+
+void trace_start(const char *path) {
+    auto &s = state();
+    std::lock_guard<std::mutex> lock(s.mutex);
+    for (auto &buffer : s.buffers) {
+        std::lock_guard<std::mutex> buffer_lock(buffer->mutex);
+        buffer->clear();
+    }
+    const char *limit = std::getenv("ONEMKL_BLAS_TRACE_LIMIT");
+    long long records = limit ? std::atoll(limit) : 0;
+    s.limit.store(records > 0 ? std::size_t(records) : default_trace_limit,
+                  std::memory_order_relaxed);
+    s.path     = path ? path : "";
+    s.epoch_ns = now_ns();
+    if (s.path.empty())
+        instrumentation.fetch_and(~instrument_trace, std::memory_order_relaxed);
+    else
+        instrumentation.fetch_or(instrument_trace, std::memory_order_relaxed);
+}
+
+void trace_stop() {
+    if (!(instrumentation.fetch_and(~instrument_trace) & instrument_trace))
+        return;
+
+    auto &s = state();
+    std::lock_guard<std::mutex> lock(s.mutex);
+    std::FILE *out = std::fopen(s.path.c_str(), "w");
+    if (!out) {
+        std::fprintf(stderr, "oneMKL: cannot write trace to %s\n", s.path.c_str());
+        return;
+    }
+    std::fprintf(out,
+                 "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [\n"
+                 "{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": 1, "
+                 "\"args\": {\"name\": \"host\"}},\n"
+                 "{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": 2, "
+                 "\"args\": {\"name\": \"device\"}}");
+    std::uint64_t dropped = 0;
+    for (auto &buffer : s.buffers) {
+        std::vector<trace_record> records;
+        std::size_t oldest;
+        {
+            std::lock_guard<std::mutex> buffer_lock(buffer->mutex);
+            records.swap(buffer->records);
+            oldest = buffer->oldest;
+            dropped += buffer->dropped;
+            buffer->clear();
+        }
+        for (std::size_t i = 0; i < records.size(); i++)
+            write_event(out, records[(oldest + i) % records.size()], buffer->tid, s.epoch_ns);
+    }
+    std::fprintf(out, "\n]}\n");
+    std::fclose(out);
+    if (dropped > 0)
+        std::fprintf(stderr,
+                     "oneMKL: trace %s holds the last %llu calls of each thread, "
+                     "%llu earlier calls were dropped\n",
+                     s.path.c_str(), (unsigned long long)s.limit.load(),
+                     (unsigned long long)dropped);
+
+    // Drop the buffers of threads that have exited.
+    s.buffers.erase(std::remove_if(s.buffers.begin(), s.buffers.end(),
+                                   [](const std::shared_ptr<thread_buffer> &buffer) {
+                                       return buffer.use_count() == 1;
+                                   }),
+                    s.buffers.end());
+}
+
+} //namespace detail
+} // namespace blas
+} // namespace onemkl
@@ -0,0 +1,235 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _BLAS_TRACE_HPP_
+#define _BLAS_TRACE_HPP_
+
+#include <CL/sycl.hpp>
+#include <atomic>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "onemkl/types.hpp"
+#include "blas/record.hpp"
+
+namespace onemkl {
+namespace blas {
+namespace detail {
+
+// Opt-in instrumentation of the calls made through the loader: tracing,
+//  written as a Chrome trace (chrome://tracing, Perfetto) by trace_stop() or at
+//  exit, statistics (stats.cpp) and recording (record.cpp). Tracing is enabled
+//  by trace_start() or by setting ONEMKL_BLAS_TRACE to the output file. While
+//  all are off, a call pays one relaxed load and a branch.
+enum : unsigned { instrument_trace = 1, instrument_stats = 2, instrument_record = 4 };
+extern std::atomic<unsigned> instrumentation;
+
+// One instrumented call. Dimensions are the std::int64_t arguments of the call
+//  in order, the precision that of its first buffer or pointer to data, side
+//  'L' or 'R' for the routines taking one. The group batch routines take their
+//  dimensions as arrays, one entry per group: arrays are their std::int64_t
+//  arrays in order, sides their array of sides. The arrays are read only while
+//  the call is instrumented.
+struct trace_record {
+    static constexpr int max_dims   = 12;
+    static constexpr int max_arrays = 8;
+
+    const char *name      = nullptr;
+    const char *backend   = nullptr;
+    const char *precision = nullptr;
+    std::int64_t dims[max_dims];
+    int num_dims = 0;
+    const std::int64_t *arrays[max_arrays];
+    int num_arrays            = 0;
+    const onemkl::side *sides = nullptr;
+    char side                 = 0;
+    double begin_ns           = 0.0;
+    double end_ns             = 0.0;
+    bool has_event            = false;
+    cl::sycl::event event;
+};
+
+template <typename T>
+inline const char *trace_precision() {
+    return nullptr;
+}
+template <>
+inline const char *trace_precision<float>() {
+    return "s";
+}
+template <>
+inline const char *trace_precision<double>() {
+    return "d";
+}
+template <>
+inline const char *trace_precision<std::complex<float>>() {
+    return "c";
+}
+template <>
+inline const char *trace_precision<std::complex<double>>() {
+    return "z";
+}
+template <>
+inline const char *trace_precision<half>() {
+    return "h";
+}
+template <>
+inline const char *trace_precision<bfloat16>() {
+    return "bf16";
+}
+template <>
+inline const char *trace_precision<std::int8_t>() {
+    return "s8";
+}
+template <>
+inline const char *trace_precision<std::uint8_t>() {
+    return "u8";
+}
+
+inline void trace_arg(trace_record &r, std::int64_t value) {
+    if (r.num_dims < trace_record::max_dims)
+        r.dims[r.num_dims++] = value;
+}
+
+inline void trace_arg(trace_record &r, side value) {
+    r.side = (value == side::left) ? 'L' : 'R';
+}
+
+inline void trace_arg(trace_record &r, const std::int64_t *values) {
+    if (r.num_arrays < trace_record::max_arrays)
+        r.arrays[r.num_arrays++] = values;
+}
+
+inline void trace_arg(trace_record &r, std::int64_t *values) {
+    trace_arg(r, static_cast<const std::int64_t *>(values));
+}
+
+inline void trace_arg(trace_record &r, side *values) {
+    r.sides = values;
+}
+
+template <typename T>
+inline void trace_arg(trace_record &r, cl::sycl::buffer<T, 1> &) {
+    if (!r.precision)
+        r.precision = trace_precision<T>();
+}
+
+template <typename T>
+inline void trace_arg(trace_record &r, T *) {
+    if (!r.precision)
+        r.precision = trace_precision<typename std::remove_cv<T>::type>();
+}
+
+template <typename T>
+inline void trace_arg(trace_record &, const T &) {}
+
+template <typename T>
+inline void trace_result(trace_record &, const T &) {}
+
+inline void trace_result(trace_record &r, const cl::sycl::event &event) {
+    r.event     = event;
+    r.has_event = true;
+}
+
+// Routine name of a table field: "sgemm_usm_sycl" -> "sgemm_usm".
+std::string routine_name(const char *field);
+
+// Starts a record for table field `name` on the calling thread.
+void trace_begin(trace_record &r, const char *name);
+// Completes r, the call to the routine in table slot `slot`, and hands it to
+//  the instrumentation enabled in mode.
+void instrument_end(cl::sycl::queue &queue, unsigned mode, std::size_t slot, trace_record &r);
+// Appends r to the trace buffer of the calling thread.
+void trace_add(cl::sycl::queue &queue, trace_record &r);
+// Adds r to the counters of the calling thread; defined in stats.cpp.
+void stats_add(cl::sycl::queue &queue, std::size_t slot, const trace_record &r);
+
+template <typename R>
+struct trace_invoker {
+    template <typename F, typename... Args>
+    static R call(cl::sycl::queue &queue, unsigned mode, std::size_t slot, trace_record &r, F fn,
+                  Args &&... args) {
+        R result = fn(std::forward<Args>(args)...);
+        trace_result(r, result);
+        instrument_end(queue, mode, slot, r);
+        return result;
+    }
+};
+
+template <>
+struct trace_invoker<void> {
+    template <typename F, typename... Args>
+    static void call(cl::sycl::queue &queue, unsigned mode, std::size_t slot, trace_record &r,
+                     F fn, Args &&... args) {
+        fn(std::forward<Args>(args)...);
+        instrument_end(queue, mode, slot, r);
+    }
+};
+
+// Backend routine fn, in table slot Slot, as returned by BACKEND_FUNC: calls
+//  it directly, or instruments the call when tracing, statistics or recording
+//  are on.
+template <std::size_t Slot, typename F>
+class traced_function {
+public:
+    traced_function(cl::sycl::queue &queue, F fn, const char *name)
+            : queue(queue),
+              fn(fn),
+              name(name) {}
+
+    template <typename... Args>
+    auto operator()(Args &&... args) -> decltype(std::declval<F &>()(std::forward<Args>(args)...)) {
+        typedef decltype(fn(std::forward<Args>(args)...)) result_type;
+        unsigned mode = instrumentation.load(std::memory_order_relaxed);
+        if (!mode)
+            return fn(std::forward<Args>(args)...);
+        if (mode & instrument_record) {
+            (void)replay_registrar<Slot, F>::registered;
+            record_call(Slot, name, args...);
+            if (!(mode & (instrument_trace | instrument_stats)))
+                return fn(std::forward<Args>(args)...);
+        }
+        trace_record r;
+        trace_begin(r, name);
+        int unused[] = { 0, (trace_arg(r, args), 0)... };
+        (void)unused;
+        return trace_invoker<result_type>::call(queue, mode, Slot, r, fn,
+                                                std::forward<Args>(args)...);
+    }
+
+private:
+    cl::sycl::queue &queue;
+    F fn;
+    const char *name;
+};
+
+template <std::size_t Slot, typename F>
+inline traced_function<Slot, F> make_traced(cl::sycl::queue &queue, F fn, const char *name) {
+    return traced_function<Slot, F>(queue, fn, name);
+}
+
+} //namespace detail
+} // namespace blas
+} // namespace onemkl
+
+#endif //_BLAS_TRACE_HPP_
@@ -0,0 +1,121 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef __DEVICE_CACHE_HPP
+#define __DEVICE_CACHE_HPP
+
+#include <CL/sycl.hpp>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+namespace onemkl {
+
+// Small fixed-size map from a SYCL device to a trivially copyable value.
+//  Lookups are lock-free: an entry becomes visible through a release store of
+//  its hash, which happens after its device and value have been written, and
+//  a hit compares the stored device, so that devices with the same hash are
+//  never confused. Inserts are rare (once per device) and are serialized. When
+//  the cache is full, insert() is a no-op and callers keep using their
+//  uncached path.
+template <typename T, std::size_t slots = 32>
+class device_cache {
+public:
+    device_cache() {
+        for (std::size_t i = 0; i < slots; i++)
+            keys[i].store(0, std::memory_order_relaxed);
+    }
+
+    static std::size_t key(const cl::sycl::device &device) {
+        std::size_t k = std::hash<cl::sycl::device>()(device);
+        return k ? k : 1;
+    }
+
+    bool find(const cl::sycl::device &device, T &value) const {
+        std::size_t key = device_cache::key(device);
+        for (std::size_t i = 0; i < slots; i++) {
+            std::size_t k = keys[i].load(std::memory_order_acquire);
+            if (k == key && *devices[i] == device) {
+                value = values[i].load(std::memory_order_relaxed);
+                return true;
+            }
+            if (k == 0)
+                return false;
+        }
+        return false;
+    }
+
+    void insert(const cl::sycl::device &device, T value) {
+        std::size_t key = device_cache::key(device);
+        std::lock_guard<std::mutex> lock(insert_mutex);
+        for (std::size_t i = 0; i < slots; i++) {
+            std::size_t k = keys[i].load(std::memory_order_relaxed);
+            if (k == key && *devices[i] == device)
+                return;
+            if (k == 0) {
+                devices[i].reset(new cl::sycl::device(device));
+                values[i].store(value, std::memory_order_relaxed);
+                keys[i].store(key, std::memory_order_release);
+                return;
+            }
+        }
+    }
+
+private:
+    std::atomic<std::size_t> keys[slots];
+    std::unique_ptr<cl::sycl::device> devices[slots];
+    std::atomic<T> values[slots];
+    std::mutex insert_mutex;
+};
+
+// The last few queues a thread looked up, with their values, so that a thread
+//  calling repeatedly on the same queues skips get_device(). The queues are
+//  held, so that a handle compared against cannot be reused by another queue;
+//  each thread keeps at most `slots` queues alive this way, until it moves on
+//  to other queues or exits. Meant to be thread_local.
+template <typename T, std::size_t slots = 4>
+class queue_cache {
+public:
+    bool find(const cl::sycl::queue &queue, T &value) const {
+        for (std::size_t i = 0; i < slots; i++) {
+            if (queues[i] && *queues[i] == queue) {
+                value = values[i];
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void insert(const cl::sycl::queue &queue, T value) {
+        queues[next].reset(new cl::sycl::queue(queue));
+        values[next] = value;
+        next         = (next + 1) % slots;
+    }
+
+private:
+    std::unique_ptr<cl::sycl::queue> queues[slots];
+    T values[slots];
+    std::size_t next = 0;
+};
+
+} // namespace onemkl
+
+#endif // __DEVICE_CACHE_HPP
@@ -0,0 +1,162 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "allocator_helper.hpp"
+#include "cblas.h"
+#include "onemkl/detail/config.hpp"
+#include "onemkl/onemkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+template <typename fp>
+int test(const device &dev, int64_t n, int64_t incx, int64_t incy, int64_t batch_size,
+         bool shared_x) {
+    // Prepare data.
+    int64_t stride_x, stride_y, size_x, size_y;
+    int64_t i;
+    fp alpha = rand_scalar<fp>();
+
+    // Leave a gap between the y vectors, and optionally use the same x for all of them.
+    stride_x = shared_x ? 0 : n * std::abs(incx);
+    stride_y = n * std::abs(incy) + 3;
+    size_x   = stride_x * (batch_size - 1) + n * std::abs(incx);
+    size_y   = stride_y * (batch_size - 1) + n * std::abs(incy);
+
+    vector<fp, allocator_helper<fp, 64>> x, y, y_ref;
+
+    rand_vector(x, size_x, 1);
+    rand_vector(y, size_y, 1);
+    y_ref = y;
+
+    // Call reference AXPY_BATCH_STRIDE.
+    using fp_ref = typename ref_type_info<fp>::type;
+    int n_ref    = (int)n;
+    int incx_ref = (int)incx;
+    int incy_ref = (int)incy;
+    for (i = 0; i < batch_size; i++) {
+        ::axpy((const int *)&n_ref, (const fp_ref *)&alpha,
+               (const fp_ref *)(x.data() + stride_x * i), (const int *)&incx_ref,
+               (fp_ref *)(y_ref.data() + stride_y * i), (const int *)&incy_ref);
+    }
+
+    // Call DPC++ AXPY_BATCH_STRIDE.
+
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const &e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const &e) {
+                std::cout << "Caught asynchronous SYCL exception during AXPY_BATCH_STRIDE:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler);
+
+    buffer<fp, 1> x_buffer(x.data(), range<1>(x.size()));
+    buffer<fp, 1> y_buffer(y.data(), range<1>(y.size()));
+
+    try {
+#ifdef CALL_RT_API
+        onemkl::blas::axpy_batch(main_queue, n, alpha, x_buffer, incx, stride_x, y_buffer, incy,
+                                 stride_y, batch_size);
+#else
+        TEST_RUN_CT(main_queue, onemkl::blas::axpy_batch,
+                    (main_queue, n, alpha, x_buffer, incx, stride_x, y_buffer, incy, stride_y,
+                     batch_size));
+#endif
+    }
+    catch (exception const &e) {
+        std::cout << "Caught synchronous SYCL exception during AXPY_BATCH_STRIDE:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+
+    catch (const onemkl::backend_unsupported_exception &e) {
+        return test_skipped;
+    }
+
+    catch (const std::runtime_error &error) {
+        std::cout << "Error raised during execution of AXPY_BATCH_STRIDE:\n"
+                  << error.what() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    bool good;
+    {
+        auto y_accessor = y_buffer.template get_access<access::mode::read>();
+        good            = check_equal_vector(y_accessor, y_ref, size_y, 1, n, std::cout);
+    }
+
+    return (int)good;
+}
+
+class AxpyBatchStrideTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(AxpyBatchStrideTests, RealSinglePrecision) {
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), 1357, 2, 3, 37, false));
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), 1357, 1, 1, 37, false));
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), 1357, -3, -2, 37, true));
+}
+
+TEST_P(AxpyBatchStrideTests, RealDoublePrecision) {
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), 1357, 2, 3, 37, false));
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), 1357, 1, 1, 37, false));
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), 1357, -3, -2, 37, true));
+}
+
+TEST_P(AxpyBatchStrideTests, ComplexSinglePrecision) {
+    EXPECT_TRUEORSKIP(test<std::complex<float>>(GetParam(), 1357, 2, 3, 37, false));
+    EXPECT_TRUEORSKIP(test<std::complex<float>>(GetParam(), 1357, 1, 1, 37, false));
+    EXPECT_TRUEORSKIP(test<std::complex<float>>(GetParam(), 1357, -3, -2, 37, true));
+}
+
+TEST_P(AxpyBatchStrideTests, ComplexDoublePrecision) {
+    EXPECT_TRUEORSKIP(test<std::complex<double>>(GetParam(), 1357, 2, 3, 37, false));
+    EXPECT_TRUEORSKIP(test<std::complex<double>>(GetParam(), 1357, 1, 1, 37, false));
+    EXPECT_TRUEORSKIP(test<std::complex<double>>(GetParam(), 1357, -3, -2, 37, true));
+}
+
+INSTANTIATE_TEST_SUITE_P(AxpyBatchStrideTestSuite, AxpyBatchStrideTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+} // anonymous namespace
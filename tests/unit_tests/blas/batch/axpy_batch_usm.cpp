@@ -215,14 +215,105 @@ int test(const device &dev, int64_t group_count) {
     return (int)good;
 }
 
+// All the problems of the batch update the same y, which must give the result
+// of the calls made one after the other.
+template <typename fp>
+int test_repeated_y(const device &dev, int64_t batch_size, int64_t n) {
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const &e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const &e) {
+                std::cout << "Caught asynchronous SYCL exception during AXPY_BATCH:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler);
+    context cxt = main_queue.get_context();
+    std::vector<event> dependencies;
+
+    int64_t one  = 1;
+    fp alpha     = rand_scalar<fp>();
+    fp *x        = (fp *)onemkl::malloc_shared(64, sizeof(fp) * n * batch_size, dev, cxt);
+    fp *y        = (fp *)onemkl::malloc_shared(64, sizeof(fp) * n, dev, cxt);
+    fp **x_array = (fp **)onemkl::malloc_shared(64, sizeof(fp *) * batch_size, dev, cxt);
+    fp **y_array = (fp **)onemkl::malloc_shared(64, sizeof(fp *) * batch_size, dev, cxt);
+    if ((x == NULL) || (y == NULL) || (x_array == NULL) || (y_array == NULL)) {
+        std::cout << "Error cannot allocate input arrays\n";
+        onemkl::free_shared(x, cxt);
+        onemkl::free_shared(y, cxt);
+        onemkl::free_shared(x_array, cxt);
+        onemkl::free_shared(y_array, cxt);
+        return false;
+    }
+
+    rand_vector(x, n * batch_size, 1);
+    rand_vector(y, n, 1);
+    for (int64_t i = 0; i < batch_size; i++) {
+        x_array[i] = x + i * n;
+        y_array[i] = y;
+    }
+
+    // Reference: the problems in order.
+    vector<fp> y_ref(y, y + n);
+    for (int64_t i = 0; i < batch_size; i++)
+        for (int64_t e = 0; e < n; e++)
+            y_ref[e] += alpha * x[i * n + e];
+
+    try {
+#ifdef CALL_RT_API
+        auto done = onemkl::blas::axpy_batch(main_queue, &n, &alpha, (const fp **)x_array, &one,
+                                             y_array, &one, 1, &batch_size, dependencies);
+        done.wait();
+#else
+        TEST_RUN_CT(main_queue, onemkl::blas::axpy_batch,
+                    (main_queue, &n, &alpha, (const fp **)x_array, &one, y_array, &one, 1,
+                     &batch_size, dependencies));
+        main_queue.wait();
+#endif
+    }
+    catch (exception const &e) {
+        std::cout << "Caught synchronous SYCL exception during AXPY_BATCH:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+
+    catch (const onemkl::backend_unsupported_exception &e) {
+        onemkl::free_shared(x, cxt);
+        onemkl::free_shared(y, cxt);
+        onemkl::free_shared(x_array, cxt);
+        onemkl::free_shared(y_array, cxt);
+        return test_skipped;
+    }
+
+    catch (const std::runtime_error &error) {
+        std::cout << "Error raised during execution of AXPY_BATCH:\n" << error.what() << std::endl;
+    }
+
+    bool good = check_equal_vector(y, y_ref, n, 1, batch_size, std::cout);
+
+    onemkl::free_shared(x, cxt);
+    onemkl::free_shared(y, cxt);
+    onemkl::free_shared(x_array, cxt);
+    onemkl::free_shared(y_array, cxt);
+    return (int)good;
+}
+
 class AxpyBatchUsmTests : public ::testing::TestWithParam<cl::sycl::device> {};
 
 TEST_P(AxpyBatchUsmTests, RealSinglePrecision) {
     EXPECT_TRUEORSKIP(test<float>(GetParam(), 5));
+    EXPECT_TRUEORSKIP(test_repeated_y<float>(GetParam(), 64, 4096));
 }
 
 TEST_P(AxpyBatchUsmTests, RealDoublePrecision) {
     EXPECT_TRUEORSKIP(test<double>(GetParam(), 5));
+    EXPECT_TRUEORSKIP(test_repeated_y<double>(GetParam(), 64, 4096));
 }
 
 TEST_P(AxpyBatchUsmTests, ComplexSinglePrecision) {
@@ -43,8 +43,12 @@ extern std::vector<cl::sycl::device> devices;
 
 namespace {
 
+// Layouts of the batch: separate matrices, one A shared by all problems, or
+//  one B shared by all problems with the A and C matrices stacked.
+enum class batch_layout { separate, shared_a, shared_b };
+
 template <typename fp>
-int test(const device &dev, int64_t batch_size) {
+int test(const device &dev, int64_t batch_size, batch_layout layout) {
     // Prepare data.
     int64_t m, n, k;
     int64_t lda, ldb, ldc;
@@ -85,15 +89,37 @@ int test(const device &dev, int64_t batch_size) {
     stride_b = (transb == onemkl::transpose::nontrans) ? ldb * n : ldb * k;
     stride_c = ldc * n;
 
-    vector<fp, allocator_helper<fp, 64>> A(stride_a * batch_size), B(stride_b * batch_size);
-    vector<fp, allocator_helper<fp, 64>> C(stride_c * batch_size), C_ref(stride_c * batch_size);
-
-    for (i = 0; i < batch_size; i++) {
-        rand_matrix(A.data() + stride_a * i, transa, m, k, lda);
-        rand_matrix(B.data() + stride_b * i, transb, k, n, ldb);
-        rand_matrix(C.data() + stride_c * i, onemkl::transpose::nontrans, m, n, ldc);
+    if (layout == batch_layout::shared_a)
+        stride_a = 0;
+    if (layout == batch_layout::shared_b) {
+        // Stack the A and C matrices so that the batch forms one tall GEMM.
+        stride_b = 0;
+        ldc      = m * batch_size;
+        stride_c = m;
+        if (transa == onemkl::transpose::nontrans) {
+            lda      = m * batch_size;
+            stride_a = m;
+        }
+        else {
+            stride_a = lda * m;
+        }
     }
 
+    int64_t size_a, size_b, size_c;
+
+    size_a = stride_a * (batch_size - 1) +
+             ((transa == onemkl::transpose::nontrans) ? lda * k : lda * m);
+    size_b = stride_b * (batch_size - 1) +
+             ((transb == onemkl::transpose::nontrans) ? ldb * n : ldb * k);
+    size_c = stride_c * (batch_size - 1) + ldc * n;
+
+    vector<fp, allocator_helper<fp, 64>> A(size_a), B(size_b);
+    vector<fp, allocator_helper<fp, 64>> C(size_c), C_ref(size_c);
+
+    rand_matrix(A, onemkl::transpose::nontrans, size_a, 1, size_a);
+    rand_matrix(B, onemkl::transpose::nontrans, size_b, 1, size_b);
+    rand_matrix(C, onemkl::transpose::nontrans, size_c, 1, size_c);
+
     C_ref = C;
 
     // Call reference GEMM_BATCH_STRIDE.
@@ -166,8 +192,8 @@ int test(const device &dev, int64_t batch_size) {
     bool good;
     {
         auto C_accessor = C_buffer.template get_access<access::mode::read>();
-        good            = check_equal_matrix(C_accessor, C_ref, stride_c * batch_size, 1,
-                                  stride_c * batch_size, 10 * k, std::cout);
+        good            = check_equal_matrix(C_accessor, C_ref, size_c, 1, size_c, 10 * k,
+                                  std::cout);
     }
 
     return (int)good;
@@ -176,19 +202,27 @@ int test(const device &dev, int64_t batch_size) {
 class GemmBatchStrideTests : public ::testing::TestWithParam<cl::sycl::device> {};
 
 TEST_P(GemmBatchStrideTests, RealSinglePrecision) {
-    EXPECT_TRUEORSKIP(test<float>(GetParam(), 5));
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), 5, batch_layout::separate));
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), 5, batch_layout::shared_a));
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), 5, batch_layout::shared_b));
 }
 
 TEST_P(GemmBatchStrideTests, RealDoublePrecision) {
-    EXPECT_TRUEORSKIP(test<double>(GetParam(), 5));
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), 5, batch_layout::separate));
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), 5, batch_layout::shared_a));
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), 5, batch_layout::shared_b));
 }
 
 TEST_P(GemmBatchStrideTests, ComplexSinglePrecision) {
-    EXPECT_TRUEORSKIP(test<std::complex<float>>(GetParam(), 5));
+    EXPECT_TRUEORSKIP(test<std::complex<float>>(GetParam(), 5, batch_layout::separate));
+    EXPECT_TRUEORSKIP(test<std::complex<float>>(GetParam(), 5, batch_layout::shared_a));
+    EXPECT_TRUEORSKIP(test<std::complex<float>>(GetParam(), 5, batch_layout::shared_b));
 }
 
 TEST_P(GemmBatchStrideTests, ComplexDoublePrecision) {
-    EXPECT_TRUEORSKIP(test<std::complex<double>>(GetParam(), 5));
+    EXPECT_TRUEORSKIP(test<std::complex<double>>(GetParam(), 5, batch_layout::separate));
+    EXPECT_TRUEORSKIP(test<std::complex<double>>(GetParam(), 5, batch_layout::shared_a));
+    EXPECT_TRUEORSKIP(test<std::complex<double>>(GetParam(), 5, batch_layout::shared_b));
 }
 
 INSTANTIATE_TEST_SUITE_P(GemmBatchStrideTestSuite, GemmBatchStrideTests,
@@ -43,8 +43,12 @@ extern std::vector<cl::sycl::device> devices;
 
 namespace {
 
+// Layouts of the batch: separate matrices, one A shared by all problems, or
+//  one B shared by all problems with the A and C matrices stacked.
+enum class batch_layout { separate, shared_a, shared_b };
+
 template <typename fp>
-int test(const device &dev, int64_t batch_size) {
+int test(const device &dev, int64_t batch_size, batch_layout layout) {
     // Catch asynchronous exceptions.
     auto exception_handler = [](exception_list exceptions) {
         for (std::exception_ptr const &e : exceptions) {
@@ -104,13 +108,37 @@ int test(const device &dev, int64_t batch_size) {
     stride_b = (transb == onemkl::transpose::nontrans) ? ldb * n : ldb * k;
     stride_c = ldc * n;
 
+    if (layout == batch_layout::shared_a)
+        stride_a = 0;
+    if (layout == batch_layout::shared_b) {
+        // Stack the A and C matrices so that the batch forms one tall GEMM.
+        stride_b = 0;
+        ldc      = m * batch_size;
+        stride_c = m;
+        if (transa == onemkl::transpose::nontrans) {
+            lda      = m * batch_size;
+            stride_a = m;
+        }
+        else {
+            stride_a = lda * m;
+        }
+    }
+
+    int64_t size_a, size_b, size_c;
+
+    size_a = stride_a * (batch_size - 1) +
+             ((transa == onemkl::transpose::nontrans) ? lda * k : lda * m);
+    size_b = stride_b * (batch_size - 1) +
+             ((transb == onemkl::transpose::nontrans) ? ldb * n : ldb * k);
+    size_c = stride_c * (batch_size - 1) + ldc * n;
+
     auto ua = usm_allocator<fp, usm::alloc::shared, 64>(cxt, dev);
     vector<fp, decltype(ua)> A(ua), B(ua), C(ua), C_ref(ua);
 
-    A.resize(stride_a * batch_size);
-    B.resize(stride_b * batch_size);
-    C.resize(stride_c * batch_size);
-    C_ref.resize(stride_c * batch_size);
+    A.resize(size_a);
+    B.resize(size_b);
+    C.resize(size_c);
+    C_ref.resize(size_c);
 
     fp **a_array     = (fp **)onemkl::malloc_shared(64, sizeof(fp *) * batch_size, dev, cxt);
     fp **b_array     = (fp **)onemkl::malloc_shared(64, sizeof(fp *) * batch_size, dev, cxt);
@@ -133,11 +161,10 @@ int test(const device &dev, int64_t batch_size) {
         c_ref_array[i] = &C_ref[i * stride_c];
     }
 
-    rand_matrix(A, onemkl::transpose::nontrans, stride_a * batch_size, 1, stride_a * batch_size);
-    rand_matrix(B, onemkl::transpose::nontrans, stride_b * batch_size, 1, stride_b * batch_size);
-    rand_matrix(C, onemkl::transpose::nontrans, stride_c * batch_size, 1, stride_c * batch_size);
-    copy_matrix(C, onemkl::transpose::nontrans, stride_c * batch_size, 1, stride_c * batch_size,
-                C_ref);
+    rand_matrix(A, onemkl::transpose::nontrans, size_a, 1, size_a);
+    rand_matrix(B, onemkl::transpose::nontrans, size_b, 1, size_b);
+    rand_matrix(C, onemkl::transpose::nontrans, size_c, 1, size_c);
+    copy_matrix(C, onemkl::transpose::nontrans, size_c, 1, size_c, C_ref);
 
     // Call reference GEMM_BATCH_STRIDE.
     using fp_ref       = typename ref_type_info<fp>::type;
@@ -193,8 +220,7 @@ int test(const device &dev, int64_t batch_size) {
     // Compare the results of reference implementation and DPC++ implementation.
     bool good = true;
     {
-        good = check_equal_matrix(C, C_ref, stride_c * batch_size, 1, stride_c * batch_size, 10 * k,
-                                  std::cout);
+        good = check_equal_matrix(C, C_ref, size_c, 1, size_c, 10 * k, std::cout);
     }
 
     onemkl::free_shared(a_array, cxt);
@@ -207,19 +233,27 @@ int test(const device &dev, int64_t batch_size) {
 class GemmBatchStrideUsmTests : public ::testing::TestWithParam<cl::sycl::device> {};
 
 TEST_P(GemmBatchStrideUsmTests, RealSinglePrecision) {
-    EXPECT_TRUEORSKIP(test<float>(GetParam(), 5));
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), 5, batch_layout::separate));
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), 5, batch_layout::shared_a));
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), 5, batch_layout::shared_b));
 }
 
 TEST_P(GemmBatchStrideUsmTests, RealDoublePrecision) {
-    EXPECT_TRUEORSKIP(test<double>(GetParam(), 5));
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), 5, batch_layout::separate));
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), 5, batch_layout::shared_a));
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), 5, batch_layout::shared_b));
 }
 
 TEST_P(GemmBatchStrideUsmTests, ComplexSinglePrecision) {
-    EXPECT_TRUEORSKIP(test<std::complex<float>>(GetParam(), 5));
+    EXPECT_TRUEORSKIP(test<std::complex<float>>(GetParam(), 5, batch_layout::separate));
+    EXPECT_TRUEORSKIP(test<std::complex<float>>(GetParam(), 5, batch_layout::shared_a));
+    EXPECT_TRUEORSKIP(test<std::complex<float>>(GetParam(), 5, batch_layout::shared_b));
 }
 
 TEST_P(GemmBatchStrideUsmTests, ComplexDoublePrecision) {
-    EXPECT_TRUEORSKIP(test<std::complex<double>>(GetParam(), 5));
+    EXPECT_TRUEORSKIP(test<std::complex<double>>(GetParam(), 5, batch_layout::separate));
+    EXPECT_TRUEORSKIP(test<std::complex<double>>(GetParam(), 5, batch_layout::shared_a));
+    EXPECT_TRUEORSKIP(test<std::complex<double>>(GetParam(), 5, batch_layout::shared_b));
 }
 
 INSTANTIATE_TEST_SUITE_P(GemmBatchStrideUsmTestSuite, GemmBatchStrideUsmTests,
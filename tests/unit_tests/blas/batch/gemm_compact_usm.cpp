@@ -0,0 +1,265 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "allocator_helper.hpp"
+#include "cblas.h"
+#include "onemkl/detail/config.hpp"
+#include "onemkl/onemkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+template <typename fp>
+int test(const device &dev, int64_t batch_size) {
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const &e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const &e) {
+                std::cout << "Caught asynchronous SYCL exception during GEMM_COMPACT:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler);
+    context cxt = main_queue.get_context();
+    event done;
+    std::vector<event> dependencies;
+
+    // Prepare data.
+    int64_t m, n, k;
+    int64_t lda, ldb, ldc;
+    onemkl::transpose transa, transb;
+    fp alpha, beta;
+
+    int64_t i, tmp;
+
+    m     = 1 + std::rand() % 16;
+    n     = 1 + std::rand() % 16;
+    k     = 1 + std::rand() % 16;
+    lda   = std::max(m, k);
+    ldb   = std::max(n, k);
+    ldc   = std::max(m, n);
+    alpha = rand_scalar<fp>();
+    beta  = rand_scalar<fp>();
+    if ((std::is_same<fp, float>::value) || (std::is_same<fp, double>::value)) {
+        transa = (onemkl::transpose)(std::rand() % 2);
+        transb = (onemkl::transpose)(std::rand() % 2);
+    }
+    else {
+        tmp = std::rand() % 3;
+        if (tmp == 2)
+            transa = onemkl::transpose::conjtrans;
+        else
+            transa = (onemkl::transpose)tmp;
+        tmp = std::rand() % 3;
+        if (tmp == 2)
+            transb = onemkl::transpose::conjtrans;
+        else
+            transb = (onemkl::transpose)tmp;
+    }
+
+    // Rows and columns of the matrices as stored.
+    int64_t rows_a, cols_a, rows_b, cols_b;
+
+    rows_a = (transa == onemkl::transpose::nontrans) ? m : k;
+    cols_a = (transa == onemkl::transpose::nontrans) ? k : m;
+    rows_b = (transb == onemkl::transpose::nontrans) ? k : n;
+    cols_b = (transb == onemkl::transpose::nontrans) ? n : k;
+
+    int64_t stride_a, stride_b, stride_c;
+
+    stride_a = lda * cols_a;
+    stride_b = ldb * cols_b;
+    stride_c = ldc * n;
+
+    auto ua = usm_allocator<fp, usm::alloc::shared, 64>(cxt, dev);
+    vector<fp, decltype(ua)> A(ua), B(ua), C(ua), C_ref(ua), A_compact(ua), B_compact(ua),
+        C_compact(ua);
+
+    A.resize(stride_a * batch_size);
+    B.resize(stride_b * batch_size);
+    C.resize(stride_c * batch_size);
+    C_ref.resize(stride_c * batch_size);
+    A_compact.resize(onemkl::blas::compact_size(lda, cols_a, batch_size));
+    B_compact.resize(onemkl::blas::compact_size(ldb, cols_b, batch_size));
+    C_compact.resize(onemkl::blas::compact_size(ldc, n, batch_size));
+
+    fp **a_array     = (fp **)onemkl::malloc_shared(64, sizeof(fp *) * batch_size, dev, cxt);
+    fp **b_array     = (fp **)onemkl::malloc_shared(64, sizeof(fp *) * batch_size, dev, cxt);
+    fp **c_array     = (fp **)onemkl::malloc_shared(64, sizeof(fp *) * batch_size, dev, cxt);
+    fp **c_ref_array = (fp **)onemkl::malloc_shared(64, sizeof(fp *) * batch_size, dev, cxt);
+
+    if ((a_array == NULL) || (b_array == NULL) || (c_array == NULL) || (c_ref_array == NULL)) {
+        std::cout << "Error cannot allocate arrays of pointers\n";
+        onemkl::free_shared(a_array, cxt);
+        onemkl::free_shared(b_array, cxt);
+        onemkl::free_shared(c_array, cxt);
+        onemkl::free_shared(c_ref_array, cxt);
+        return false;
+    }
+
+    for (i = 0; i < batch_size; i++) {
+        a_array[i]     = &A[i * stride_a];
+        b_array[i]     = &B[i * stride_b];
+        c_array[i]     = &C[i * stride_c];
+        c_ref_array[i] = &C_ref[i * stride_c];
+    }
+
+    rand_matrix(A, onemkl::transpose::nontrans, A.size(), 1, A.size());
+    rand_matrix(B, onemkl::transpose::nontrans, B.size(), 1, B.size());
+    rand_matrix(C, onemkl::transpose::nontrans, C.size(), 1, C.size());
+    copy_matrix(C, onemkl::transpose::nontrans, C.size(), 1, C.size(), C_ref);
+
+    // Call reference GEMM on each matrix.
+    using fp_ref = typename ref_type_info<fp>::type;
+    int m_ref    = (int)m;
+    int n_ref    = (int)n;
+    int k_ref    = (int)k;
+    int lda_ref  = (int)lda;
+    int ldb_ref  = (int)ldb;
+    int ldc_ref  = (int)ldc;
+    for (i = 0; i < batch_size; i++) {
+        ::gemm(convert_to_cblas_trans(transa), convert_to_cblas_trans(transb), (const int *)&m_ref,
+               (const int *)&n_ref, (const int *)&k_ref, (const fp_ref *)&alpha,
+               (const fp_ref *)a_array[i], (const int *)&lda_ref, (const fp_ref *)b_array[i],
+               (const int *)&ldb_ref, (const fp_ref *)&beta, (fp_ref *)c_ref_array[i],
+               (const int *)&ldc_ref);
+    }
+
+    // Pack, call DPC++ GEMM_COMPACT, and unpack C.
+
+    try {
+#ifdef CALL_RT_API
+        auto a_packed = onemkl::blas::compact_pack(main_queue, rows_a, cols_a, (const fp **)a_array,
+                                                   lda, &A_compact[0], lda, batch_size,
+                                                   dependencies);
+        auto b_packed = onemkl::blas::compact_pack(main_queue, rows_b, cols_b, (const fp **)b_array,
+                                                   ldb, &B_compact[0], ldb, batch_size,
+                                                   dependencies);
+        auto c_packed = onemkl::blas::compact_pack(main_queue, m, n, (const fp **)c_array, ldc,
+                                                   &C_compact[0], ldc, batch_size, dependencies);
+        done = onemkl::blas::gemm_compact(main_queue, transa, transb, m, n, k, alpha,
+                                          &A_compact[0], lda, &B_compact[0], ldb, beta,
+                                          &C_compact[0], ldc, batch_size,
+                                          std::vector<event>{ a_packed, b_packed, c_packed });
+        done = onemkl::blas::compact_unpack(main_queue, m, n, &C_compact[0], ldc, c_array, ldc,
+                                            batch_size, std::vector<event>{ done });
+        done.wait();
+#else
+        TEST_RUN_CT(main_queue, onemkl::blas::compact_pack,
+                    (main_queue, rows_a, cols_a, (const fp **)a_array, lda, &A_compact[0], lda,
+                     batch_size, dependencies));
+        TEST_RUN_CT(main_queue, onemkl::blas::compact_pack,
+                    (main_queue, rows_b, cols_b, (const fp **)b_array, ldb, &B_compact[0], ldb,
+                     batch_size, dependencies));
+        TEST_RUN_CT(main_queue, onemkl::blas::compact_pack,
+                    (main_queue, m, n, (const fp **)c_array, ldc, &C_compact[0], ldc, batch_size,
+                     dependencies));
+        main_queue.wait();
+        TEST_RUN_CT(main_queue, onemkl::blas::gemm_compact,
+                    (main_queue, transa, transb, m, n, k, alpha, &A_compact[0], lda,
+                     &B_compact[0], ldb, beta, &C_compact[0], ldc, batch_size, dependencies));
+        main_queue.wait();
+        TEST_RUN_CT(main_queue, onemkl::blas::compact_unpack,
+                    (main_queue, m, n, &C_compact[0], ldc, c_array, ldc, batch_size,
+                     dependencies));
+        main_queue.wait();
+#endif
+    }
+    catch (exception const &e) {
+        std::cout << "Caught synchronous SYCL exception during GEMM_COMPACT:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+
+    catch (const onemkl::backend_unsupported_exception &e) {
+        onemkl::free_shared(a_array, cxt);
+        onemkl::free_shared(b_array, cxt);
+        onemkl::free_shared(c_array, cxt);
+        onemkl::free_shared(c_ref_array, cxt);
+        return test_skipped;
+    }
+
+    catch (const std::runtime_error &error) {
+        std::cout << "Error raised during execution of GEMM_COMPACT:\n"
+                  << error.what() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    bool good = true;
+    {
+        good = check_equal_matrix(C, C_ref, C.size(), 1, C.size(), 10 * k, std::cout);
+    }
+
+    onemkl::free_shared(a_array, cxt);
+    onemkl::free_shared(b_array, cxt);
+    onemkl::free_shared(c_array, cxt);
+    onemkl::free_shared(c_ref_array, cxt);
+    return (int)good;
+}
+
+class GemmCompactUsmTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(GemmCompactUsmTests, RealSinglePrecision) {
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), 16));
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), 37));
+}
+
+TEST_P(GemmCompactUsmTests, RealDoublePrecision) {
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), 16));
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), 37));
+}
+
+TEST_P(GemmCompactUsmTests, ComplexSinglePrecision) {
+    EXPECT_TRUEORSKIP(test<std::complex<float>>(GetParam(), 16));
+    EXPECT_TRUEORSKIP(test<std::complex<float>>(GetParam(), 37));
+}
+
+TEST_P(GemmCompactUsmTests, ComplexDoublePrecision) {
+    EXPECT_TRUEORSKIP(test<std::complex<double>>(GetParam(), 16));
+    EXPECT_TRUEORSKIP(test<std::complex<double>>(GetParam(), 37));
+}
+
+INSTANTIATE_TEST_SUITE_P(GemmCompactUsmTestSuite, GemmCompactUsmTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+} // anonymous namespace
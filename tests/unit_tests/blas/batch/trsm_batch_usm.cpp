@@ -0,0 +1,241 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "allocator_helper.hpp"
+#include "cblas.h"
+#include "onemkl/detail/config.hpp"
+#include "onemkl/onemkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+template <typename fp>
+int test(const device &dev, int64_t group_count) {
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const &e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const &e) {
+                std::cout << "Caught asynchronous SYCL exception during TRSM_BATCH:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler);
+    context cxt = main_queue.get_context();
+    event done;
+    std::vector<event> dependencies;
+
+    // Prepare data.
+    auto uaint = usm_allocator<int64_t, usm::alloc::shared, 64>(cxt, dev);
+    vector<int64_t, decltype(uaint)> m(uaint), n(uaint), lda(uaint), ldb(uaint), group_size(uaint);
+
+    auto uatranspose = usm_allocator<onemkl::transpose, usm::alloc::shared, 64>(cxt, dev);
+    vector<onemkl::transpose, decltype(uatranspose)> trans(uatranspose);
+    auto uaside = usm_allocator<onemkl::side, usm::alloc::shared, 64>(cxt, dev);
+    vector<onemkl::side, decltype(uaside)> left_right(uaside);
+    auto uauplo = usm_allocator<onemkl::uplo, usm::alloc::shared, 64>(cxt, dev);
+    vector<onemkl::uplo, decltype(uauplo)> upper_lower(uauplo);
+    auto uadiag = usm_allocator<onemkl::diag, usm::alloc::shared, 64>(cxt, dev);
+    vector<onemkl::diag, decltype(uadiag)> unit_diag(uadiag);
+
+    auto uafp = usm_allocator<fp, usm::alloc::shared, 64>(cxt, dev);
+    vector<fp, decltype(uafp)> alpha(uafp);
+
+    m.resize(group_count);
+    n.resize(group_count);
+    lda.resize(group_count);
+    ldb.resize(group_count);
+    group_size.resize(group_count);
+    trans.resize(group_count);
+    left_right.resize(group_count);
+    upper_lower.resize(group_count);
+    unit_diag.resize(group_count);
+    alpha.resize(group_count);
+
+    int64_t i, tmp;
+    int64_t j, idx = 0;
+    int64_t total_batch_count = 0;
+    int64_t size_a = 0, size_b = 0;
+
+    for (i = 0; i < group_count; i++) {
+        group_size[i]  = 1 + std::rand() % 20;
+        m[i]           = 1 + std::rand() % 50;
+        n[i]           = 1 + std::rand() % 50;
+        lda[i]         = std::max(m[i], n[i]);
+        ldb[i]         = std::max(n[i], m[i]);
+        alpha[i]       = rand_scalar<fp>();
+        left_right[i]  = (onemkl::side)(std::rand() % 2);
+        upper_lower[i] = (onemkl::uplo)(std::rand() % 2);
+        unit_diag[i]   = (onemkl::diag)(std::rand() % 2);
+        if ((std::is_same<fp, float>::value) || (std::is_same<fp, double>::value)) {
+            trans[i] = (onemkl::transpose)(std::rand() % 2);
+        }
+        else {
+            tmp = std::rand() % 3;
+            if (tmp == 2)
+                trans[i] = onemkl::transpose::conjtrans;
+            else
+                trans[i] = (onemkl::transpose)tmp;
+        }
+        total_batch_count += group_size[i];
+    }
+
+    auto uafpp = usm_allocator<fp *, usm::alloc::shared, 64>(cxt, dev);
+    vector<fp *, decltype(uafpp)> a_array(uafpp), b_array(uafpp), b_ref_array(uafpp);
+    a_array.resize(total_batch_count);
+    b_array.resize(total_batch_count);
+    b_ref_array.resize(total_batch_count);
+
+    idx = 0;
+    for (i = 0; i < group_count; i++) {
+        int64_t k = (left_right[i] == onemkl::side::left) ? m[i] : n[i];
+        size_a    = lda[i] * k;
+        size_b    = ldb[i] * n[i];
+        for (j = 0; j < group_size[i]; j++) {
+            a_array[idx]     = (fp *)onemkl::malloc_shared(64, sizeof(fp) * size_a, dev, cxt);
+            b_array[idx]     = (fp *)onemkl::malloc_shared(64, sizeof(fp) * size_b, dev, cxt);
+            b_ref_array[idx] = (fp *)onemkl::malloc_shared(64, sizeof(fp) * size_b, dev, cxt);
+            rand_trsm_matrix(a_array[idx], trans[i], k, k, lda[i]);
+            rand_matrix(b_array[idx], onemkl::transpose::nontrans, m[i], n[i], ldb[i]);
+            copy_matrix(b_array[idx], onemkl::transpose::nontrans, m[i], n[i], ldb[i],
+                        b_ref_array[idx]);
+            idx++;
+        }
+    }
+
+    // Call reference TRSM_BATCH.
+    using fp_ref = typename ref_type_info<fp>::type;
+    idx          = 0;
+    for (i = 0; i < group_count; i++) {
+        int m_ref   = (int)m[i];
+        int n_ref   = (int)n[i];
+        int lda_ref = (int)lda[i];
+        int ldb_ref = (int)ldb[i];
+        for (j = 0; j < group_size[i]; j++) {
+            ::trsm(convert_to_cblas_side(left_right[i]), convert_to_cblas_uplo(upper_lower[i]),
+                   convert_to_cblas_trans(trans[i]), convert_to_cblas_diag(unit_diag[i]),
+                   (const int *)&m_ref, (const int *)&n_ref, (const fp_ref *)&alpha[i],
+                   (const fp_ref *)a_array[idx], (const int *)&lda_ref,
+                   (fp_ref *)b_ref_array[idx], (const int *)&ldb_ref);
+            idx++;
+        }
+    }
+
+    // Call DPC++ TRSM_BATCH.
+
+    try {
+#ifdef CALL_RT_API
+        done = onemkl::blas::trsm_batch(main_queue, &left_right[0], &upper_lower[0], &trans[0],
+                                        &unit_diag[0], &m[0], &n[0], &alpha[0],
+                                        (const fp **)&a_array[0], &lda[0], &b_array[0], &ldb[0],
+                                        group_count, &group_size[0], dependencies);
+        done.wait();
+#else
+        TEST_RUN_CT(main_queue, onemkl::blas::trsm_batch,
+                    (main_queue, &left_right[0], &upper_lower[0], &trans[0], &unit_diag[0], &m[0],
+                     &n[0], &alpha[0], (const fp **)&a_array[0], &lda[0], &b_array[0], &ldb[0],
+                     group_count, &group_size[0], dependencies));
+        main_queue.wait();
+#endif
+    }
+    catch (exception const &e) {
+        std::cout << "Caught synchronous SYCL exception during TRSM_BATCH:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+
+    catch (const onemkl::backend_unsupported_exception &e) {
+        for (idx = 0; idx < total_batch_count; idx++) {
+            onemkl::free_shared(a_array[idx], cxt);
+            onemkl::free_shared(b_array[idx], cxt);
+            onemkl::free_shared(b_ref_array[idx], cxt);
+        }
+        return test_skipped;
+    }
+
+    catch (const std::runtime_error &error) {
+        std::cout << "Error raised during execution of TRSM_BATCH:\n" << error.what() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    bool good = true;
+    {
+        idx = 0;
+        for (i = 0; i < group_count; i++) {
+            for (j = 0; j < group_size[i]; j++) {
+                good = good && check_equal_trsm_matrix(b_array[idx], b_ref_array[idx], m[i], n[i],
+                                                       ldb[i], 10 * std::max(m[i], n[i]),
+                                                       std::cout);
+                idx++;
+            }
+        }
+    }
+    for (idx = 0; idx < total_batch_count; idx++) {
+        onemkl::free_shared(a_array[idx], cxt);
+        onemkl::free_shared(b_array[idx], cxt);
+        onemkl::free_shared(b_ref_array[idx], cxt);
+    }
+    return (int)good;
+}
+
+class TrsmBatchUsmTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(TrsmBatchUsmTests, RealSinglePrecision) {
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), 5));
+}
+
+TEST_P(TrsmBatchUsmTests, RealDoublePrecision) {
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), 5));
+}
+
+TEST_P(TrsmBatchUsmTests, ComplexSinglePrecision) {
+    EXPECT_TRUEORSKIP(test<std::complex<float>>(GetParam(), 5));
+}
+
+TEST_P(TrsmBatchUsmTests, ComplexDoublePrecision) {
+    EXPECT_TRUEORSKIP(test<std::complex<double>>(GetParam(), 5));
+}
+
+INSTANTIATE_TEST_SUITE_P(TrsmBatchUsmTestSuite, TrsmBatchUsmTests, ::testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+} // anonymous namespace
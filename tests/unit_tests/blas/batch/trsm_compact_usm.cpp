@@ -0,0 +1,231 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "allocator_helper.hpp"
+#include "cblas.h"
+#include "onemkl/detail/config.hpp"
+#include "onemkl/onemkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+template <typename fp>
+int test(const device &dev, int64_t batch_size) {
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const &e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const &e) {
+                std::cout << "Caught asynchronous SYCL exception during TRSM_COMPACT:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler);
+    context cxt = main_queue.get_context();
+    event done;
+    std::vector<event> dependencies;
+
+    // Prepare data.
+    int64_t m, n;
+    int64_t lda, ldb;
+    onemkl::transpose trans;
+    onemkl::side left_right;
+    onemkl::uplo upper_lower;
+    onemkl::diag unit_diag;
+    fp alpha;
+
+    int64_t i, tmp;
+
+    m     = 1 + std::rand() % 16;
+    n     = 1 + std::rand() % 16;
+    lda   = std::max(m, n);
+    ldb   = std::max(n, m);
+    alpha = rand_scalar<fp>();
+    if ((std::is_same<fp, float>::value) || (std::is_same<fp, double>::value)) {
+        trans = (onemkl::transpose)(std::rand() % 2);
+    }
+    else {
+        tmp = std::rand() % 3;
+        if (tmp == 2)
+            trans = onemkl::transpose::conjtrans;
+        else
+            trans = (onemkl::transpose)tmp;
+    }
+    left_right  = (onemkl::side)(std::rand() % 2);
+    upper_lower = (onemkl::uplo)(std::rand() % 2);
+    unit_diag   = (onemkl::diag)(std::rand() % 2);
+
+    int64_t k, stride_a, stride_b;
+
+    k        = (left_right == onemkl::side::left) ? m : n;
+    stride_a = lda * k;
+    stride_b = ldb * n;
+
+    auto ua = usm_allocator<fp, usm::alloc::shared, 64>(cxt, dev);
+    vector<fp, decltype(ua)> A(ua), B(ua), B_ref(ua), A_compact(ua), B_compact(ua);
+
+    A.resize(stride_a * batch_size);
+    B.resize(stride_b * batch_size);
+    B_ref.resize(stride_b * batch_size);
+    A_compact.resize(onemkl::blas::compact_size(lda, k, batch_size));
+    B_compact.resize(onemkl::blas::compact_size(ldb, n, batch_size));
+
+    fp **a_array = (fp **)onemkl::malloc_shared(64, sizeof(fp *) * batch_size, dev, cxt);
+    fp **b_array = (fp **)onemkl::malloc_shared(64, sizeof(fp *) * batch_size, dev, cxt);
+
+    if ((a_array == NULL) || (b_array == NULL)) {
+        std::cout << "Error cannot allocate arrays of pointers\n";
+        onemkl::free_shared(a_array, cxt);
+        onemkl::free_shared(b_array, cxt);
+        return false;
+    }
+
+    for (i = 0; i < batch_size; i++) {
+        a_array[i] = &A[i * stride_a];
+        b_array[i] = &B[i * stride_b];
+        rand_trsm_matrix(a_array[i], trans, k, k, lda);
+        rand_matrix(b_array[i], onemkl::transpose::nontrans, m, n, ldb);
+    }
+
+    copy_matrix(B, onemkl::transpose::nontrans, B.size(), 1, B.size(), B_ref);
+
+    // Call reference TRSM on each matrix.
+    using fp_ref = typename ref_type_info<fp>::type;
+    int m_ref    = (int)m;
+    int n_ref    = (int)n;
+    int lda_ref  = (int)lda;
+    int ldb_ref  = (int)ldb;
+    for (i = 0; i < batch_size; i++) {
+        ::trsm(convert_to_cblas_side(left_right), convert_to_cblas_uplo(upper_lower),
+               convert_to_cblas_trans(trans), convert_to_cblas_diag(unit_diag), (const int *)&m_ref,
+               (const int *)&n_ref, (const fp_ref *)&alpha, (const fp_ref *)a_array[i],
+               (const int *)&lda_ref, (fp_ref *)(B_ref.data() + stride_b * i),
+               (const int *)&ldb_ref);
+    }
+
+    // Pack, call DPC++ TRSM_COMPACT, and unpack B.
+
+    try {
+#ifdef CALL_RT_API
+        auto a_packed = onemkl::blas::compact_pack(main_queue, k, k, (const fp **)a_array, lda,
+                                                   &A_compact[0], lda, batch_size, dependencies);
+        auto b_packed = onemkl::blas::compact_pack(main_queue, m, n, (const fp **)b_array, ldb,
+                                                   &B_compact[0], ldb, batch_size, dependencies);
+        done = onemkl::blas::trsm_compact(main_queue, left_right, upper_lower, trans, unit_diag, m,
+                                          n, alpha, &A_compact[0], lda, &B_compact[0], ldb,
+                                          batch_size, std::vector<event>{ a_packed, b_packed });
+        done = onemkl::blas::compact_unpack(main_queue, m, n, &B_compact[0], ldb, b_array, ldb,
+                                            batch_size, std::vector<event>{ done });
+        done.wait();
+#else
+        TEST_RUN_CT(main_queue, onemkl::blas::compact_pack,
+                    (main_queue, k, k, (const fp **)a_array, lda, &A_compact[0], lda, batch_size,
+                     dependencies));
+        TEST_RUN_CT(main_queue, onemkl::blas::compact_pack,
+                    (main_queue, m, n, (const fp **)b_array, ldb, &B_compact[0], ldb, batch_size,
+                     dependencies));
+        main_queue.wait();
+        TEST_RUN_CT(main_queue, onemkl::blas::trsm_compact,
+                    (main_queue, left_right, upper_lower, trans, unit_diag, m, n, alpha,
+                     &A_compact[0], lda, &B_compact[0], ldb, batch_size, dependencies));
+        main_queue.wait();
+        TEST_RUN_CT(main_queue, onemkl::blas::compact_unpack,
+                    (main_queue, m, n, &B_compact[0], ldb, b_array, ldb, batch_size,
+                     dependencies));
+        main_queue.wait();
+#endif
+    }
+    catch (exception const &e) {
+        std::cout << "Caught synchronous SYCL exception during TRSM_COMPACT:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+
+    catch (const onemkl::backend_unsupported_exception &e) {
+        onemkl::free_shared(a_array, cxt);
+        onemkl::free_shared(b_array, cxt);
+        return test_skipped;
+    }
+
+    catch (const std::runtime_error &error) {
+        std::cout << "Error raised during execution of TRSM_COMPACT:\n"
+                  << error.what() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    bool good = true;
+    {
+        good = check_equal_trsm_matrix(B, B_ref, B.size(), 1, B.size(), 10 * std::max(m, n),
+                                       std::cout);
+    }
+
+    onemkl::free_shared(a_array, cxt);
+    onemkl::free_shared(b_array, cxt);
+    return (int)good;
+}
+
+class TrsmCompactUsmTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(TrsmCompactUsmTests, RealSinglePrecision) {
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), 16));
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), 37));
+}
+
+TEST_P(TrsmCompactUsmTests, RealDoublePrecision) {
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), 16));
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), 37));
+}
+
+TEST_P(TrsmCompactUsmTests, ComplexSinglePrecision) {
+    EXPECT_TRUEORSKIP(test<std::complex<float>>(GetParam(), 16));
+    EXPECT_TRUEORSKIP(test<std::complex<float>>(GetParam(), 37));
+}
+
+TEST_P(TrsmCompactUsmTests, ComplexDoublePrecision) {
+    EXPECT_TRUEORSKIP(test<std::complex<double>>(GetParam(), 16));
+    EXPECT_TRUEORSKIP(test<std::complex<double>>(GetParam(), 37));
+}
+
+INSTANTIATE_TEST_SUITE_P(TrsmCompactUsmTestSuite, TrsmCompactUsmTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+} // anonymous namespace
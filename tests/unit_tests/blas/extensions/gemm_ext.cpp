@@ -137,6 +137,23 @@ TEST_P(GemmExtTests, HalfHalfFloatPrecision) {
                            91, 103, 105, 106, alpha, beta)));
 }
 
+TEST_P(GemmExtTests, BFloat16BFloat16FloatPrecision) {
+    float alpha(2.0);
+    float beta(3.0);
+    EXPECT_TRUEORSKIP((test<onemkl::bfloat16, float>(GetParam(), onemkl::transpose::nontrans,
+                                                     onemkl::transpose::nontrans, 79, 83, 91, 103,
+                                                     105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<onemkl::bfloat16, float>(GetParam(), onemkl::transpose::nontrans,
+                                                     onemkl::transpose::trans, 79, 83, 91, 103, 105,
+                                                     106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<onemkl::bfloat16, float>(GetParam(), onemkl::transpose::trans,
+                                                     onemkl::transpose::nontrans, 79, 83, 91, 103,
+                                                     105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<onemkl::bfloat16, float>(GetParam(), onemkl::transpose::trans,
+                                                     onemkl::transpose::trans, 79, 83, 91, 103, 105,
+                                                     106, alpha, beta)));
+}
+
 TEST_P(GemmExtTests, RealHalfPrecision) {
     half alpha(2.0);
     half beta(3.0);
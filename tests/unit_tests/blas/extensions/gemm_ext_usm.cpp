@@ -0,0 +1,163 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "cblas.h"
+#include "onemkl/detail/config.hpp"
+#include "onemkl/onemkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+template <typename Ta, typename Tc>
+int test(const device& dev, onemkl::transpose transa, onemkl::transpose transb, int m, int n, int k,
+         int lda, int ldb, int ldc, Tc alpha, Tc beta) {
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during GEMM_EXT:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler);
+    context cxt = main_queue.get_context();
+    event done;
+    std::vector<event> dependencies;
+
+    // Prepare data.
+    auto ua = usm_allocator<Ta, usm::alloc::shared, 64>(cxt, dev);
+    auto uc = usm_allocator<Tc, usm::alloc::shared, 64>(cxt, dev);
+    vector<Ta, decltype(ua)> A(ua), B(ua);
+    vector<Tc, decltype(uc)> C(uc);
+    rand_matrix(A, transa, m, k, lda);
+    rand_matrix(B, transb, k, n, ldb);
+    rand_matrix(C, onemkl::transpose::nontrans, m, n, ldc);
+
+    auto C_ref = C;
+
+    // Call Reference GEMM_EXT.
+    const int m_ref = m, n_ref = n, k_ref = k;
+    const int lda_ref = lda, ldb_ref = ldb, ldc_ref = ldc;
+
+    using Ta_ref = typename ref_type_info<Ta>::type;
+    using Tc_ref = typename ref_type_info<Tc>::type;
+
+    ::gemm_ext(convert_to_cblas_trans(transa), convert_to_cblas_trans(transb), &m_ref, &n_ref,
+               &k_ref, (Tc_ref*)&alpha, (Ta_ref*)A.data(), &lda_ref, (Ta_ref*)B.data(), &ldb_ref,
+               (Tc_ref*)&beta, (Tc_ref*)C_ref.data(), &ldc_ref);
+
+    // Call DPC++ GEMM_EXT.
+
+    try {
+#ifdef CALL_RT_API
+        done = onemkl::blas::gemm_ext(main_queue, transa, transb, m, n, k, alpha, A.data(), lda,
+                                      B.data(), ldb, beta, C.data(), ldc, dependencies);
+        done.wait();
+#else
+        TEST_RUN_CT(main_queue, onemkl::blas::gemm_ext,
+                    (main_queue, transa, transb, m, n, k, alpha, A.data(), lda, B.data(), ldb, beta,
+                     C.data(), ldc, dependencies));
+        main_queue.wait();
+#endif
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during GEMM_EXT:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+
+    catch (const onemkl::backend_unsupported_exception& e) {
+        return test_skipped;
+    }
+
+    catch (const std::runtime_error& error) {
+        std::cout << "Error raised during execution of GEMM_EXT:\n" << error.what() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+
+    bool good = check_equal_matrix(C, C_ref, m, n, ldc, 10 * k, std::cout);
+
+    return (int)good;
+}
+
+class GemmExtUsmTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(GemmExtUsmTests, HalfHalfFloatPrecision) {
+    float alpha(2.0);
+    float beta(3.0);
+    EXPECT_TRUEORSKIP(
+        (test<half, float>(GetParam(), onemkl::transpose::nontrans, onemkl::transpose::nontrans, 79,
+                           83, 91, 103, 105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP(
+        (test<half, float>(GetParam(), onemkl::transpose::nontrans, onemkl::transpose::trans, 79,
+                           83, 91, 103, 105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP(
+        (test<half, float>(GetParam(), onemkl::transpose::trans, onemkl::transpose::nontrans, 79,
+                           83, 91, 103, 105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP(
+        (test<half, float>(GetParam(), onemkl::transpose::trans, onemkl::transpose::trans, 79, 83,
+                           91, 103, 105, 106, alpha, beta)));
+}
+
+TEST_P(GemmExtUsmTests, BFloat16BFloat16FloatPrecision) {
+    float alpha(2.0);
+    float beta(3.0);
+    EXPECT_TRUEORSKIP((test<onemkl::bfloat16, float>(GetParam(), onemkl::transpose::nontrans,
+                                                     onemkl::transpose::nontrans, 79, 83, 91, 103,
+                                                     105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<onemkl::bfloat16, float>(GetParam(), onemkl::transpose::nontrans,
+                                                     onemkl::transpose::trans, 79, 83, 91, 103, 105,
+                                                     106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<onemkl::bfloat16, float>(GetParam(), onemkl::transpose::trans,
+                                                     onemkl::transpose::nontrans, 79, 83, 91, 103,
+                                                     105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<onemkl::bfloat16, float>(GetParam(), onemkl::transpose::trans,
+                                                     onemkl::transpose::trans, 79, 83, 91, 103, 105,
+                                                     106, alpha, beta)));
+}
+
+INSTANTIATE_TEST_SUITE_P(GemmExtUsmTestSuite, GemmExtUsmTests, ::testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+} // anonymous namespace
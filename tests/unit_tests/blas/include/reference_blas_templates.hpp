@@ -227,6 +227,32 @@ void gemm(CBLAS_TRANSPOSE transa, CBLAS_TRANSPOSE transb, const int *m, const in
     onemkl::aligned_free(cf);
 }
 
+template <>
+void gemm(CBLAS_TRANSPOSE transa, CBLAS_TRANSPOSE transb, const int *m, const int *n, const int *k,
+          const onemkl::bfloat16 *alpha, const onemkl::bfloat16 *a, const int *lda,
+          const onemkl::bfloat16 *b, const int *ldb, const onemkl::bfloat16 *beta,
+          onemkl::bfloat16 *c, const int *ldc) {
+    // Not supported in NETLIB. SGEMM is used as reference.
+    int sizea, sizeb, sizec;
+    const float alphaf = *alpha;
+    const float betaf  = *beta;
+    sizea              = (transa == CblasNoTrans) ? *lda * *k : *lda * *m;
+    sizeb              = (transb == CblasNoTrans) ? *ldb * *n : *ldb * *k;
+    sizec              = *ldc * *n;
+    float *af          = (float *)onemkl::aligned_alloc(64, sizeof(float) * sizea);
+    float *bf          = (float *)onemkl::aligned_alloc(64, sizeof(float) * sizeb);
+    float *cf          = (float *)onemkl::aligned_alloc(64, sizeof(float) * sizec);
+    copy_mat(a, transa, *m, *k, *lda, af);
+    copy_mat(b, transb, *k, *n, *ldb, bf);
+    copy_mat(c, CblasNoTrans, *m, *n, *ldc, cf);
+    cblas_sgemm(CblasColMajor, transa, transb, *m, *n, *k, alphaf, af, *lda, bf, *ldb, betaf, cf,
+                *ldc);
+    copy_mat(cf, CblasNoTrans, *m, *n, *ldc, c);
+    onemkl::aligned_free(af);
+    onemkl::aligned_free(bf);
+    onemkl::aligned_free(cf);
+}
+
 template <>
 void gemm(CBLAS_TRANSPOSE transa, CBLAS_TRANSPOSE transb, const int *m, const int *n, const int *k,
           const float *alpha, const float *a, const int *lda, const float *b, const int *ldb,
@@ -1520,6 +1546,25 @@ void gemm_ext(CBLAS_TRANSPOSE transa, CBLAS_TRANSPOSE transb, const int *m, cons
     onemkl::aligned_free(bf);
 }
 
+template <>
+void gemm_ext(CBLAS_TRANSPOSE transa, CBLAS_TRANSPOSE transb, const int *m, const int *n,
+              const int *k, const float *alpha, const onemkl::bfloat16 *a, const int *lda,
+              const onemkl::bfloat16 *b, const int *ldb, const float *beta, float *c,
+              const int *ldc) {
+    // Not supported in NETLIB. SGEMM is used as reference.
+    int sizea, sizeb;
+    sizea     = (transa == CblasNoTrans) ? *lda * *k : *lda * *m;
+    sizeb     = (transb == CblasNoTrans) ? *ldb * *n : *ldb * *k;
+    float *af = (float *)onemkl::aligned_alloc(64, sizeof(float) * sizea);
+    float *bf = (float *)onemkl::aligned_alloc(64, sizeof(float) * sizeb);
+    copy_mat(a, transa, *m, *k, *lda, af);
+    copy_mat(b, transb, *k, *n, *ldb, bf);
+    cblas_sgemm(CblasColMajor, transa, transb, *m, *n, *k, *alpha, af, *lda, bf, *ldb, *beta, c,
+                *ldc);
+    onemkl::aligned_free(af);
+    onemkl::aligned_free(bf);
+}
+
 template <typename fps, typename fpa, typename fpb, typename fpc>
 static void gemm_ext(CBLAS_TRANSPOSE transa, CBLAS_TRANSPOSE transb, CBLAS_OFFSET offsetc,
                      const int *m, const int *n, const int *k, const fps *alpha, const fpa *a,
@@ -149,6 +149,11 @@ half rand_scalar() {
     return half(std::rand() % 32000) / half(32000) - half(0.5);
 }
 
+template <>
+onemkl::bfloat16 rand_scalar() {
+    return onemkl::bfloat16(float(std::rand() % 32000) / 32000.0f - 0.5f);
+}
+
 template <typename fp>
 static fp rand_scalar(int mag) {
     fp tmp = fp(mag) + fp(std::rand()) / fp(RAND_MAX) - fp(0.5);
@@ -343,6 +348,18 @@ typename std::enable_if<std::is_integral<fp>::value, bool>::type check_equal(fp
     return (x == x_ref);
 }
 
+// bfloat16 has no numeric_limits; its epsilon is 2^-7.
+inline bool check_equal(onemkl::bfloat16 x, onemkl::bfloat16 x_ref, int error_mag) {
+    float bound = error_mag * 0.0078125f;
+    float aerr  = std::abs(float(x) - float(x_ref));
+    float rerr  = aerr / std::abs(float(x_ref));
+    bool ok     = (rerr <= bound) || (aerr <= bound);
+    if (!ok)
+        std::cout << "relative error = " << rerr << " absolute error = " << aerr
+                  << " limit = " << bound << std::endl;
+    return ok;
+}
+
 template <typename fp>
 bool check_equal_trsm(fp x, fp x_ref, int error_mag) {
     using fp_real = typename complex_info<fp>::real_type;
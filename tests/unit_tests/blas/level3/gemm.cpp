@@ -212,6 +212,23 @@ TEST_P(GemmTests, ComplexDoublePrecision) {
                                                  106, alpha, beta));
 }
 
+TEST_P(GemmTests, RealBFloat16Precision) {
+    onemkl::bfloat16 alpha(2.0);
+    onemkl::bfloat16 beta(3.0);
+    EXPECT_TRUEORSKIP(test<onemkl::bfloat16>(GetParam(), onemkl::transpose::nontrans,
+                                             onemkl::transpose::nontrans, 79, 83, 91, 103, 105, 106,
+                                             alpha, beta));
+    EXPECT_TRUEORSKIP(test<onemkl::bfloat16>(GetParam(), onemkl::transpose::nontrans,
+                                             onemkl::transpose::trans, 79, 83, 91, 103, 105, 106,
+                                             alpha, beta));
+    EXPECT_TRUEORSKIP(test<onemkl::bfloat16>(GetParam(), onemkl::transpose::trans,
+                                             onemkl::transpose::nontrans, 79, 83, 91, 103, 105, 106,
+                                             alpha, beta));
+    EXPECT_TRUEORSKIP(test<onemkl::bfloat16>(GetParam(), onemkl::transpose::trans,
+                                             onemkl::transpose::trans, 79, 83, 91, 103, 105, 106,
+                                             alpha, beta));
+}
+
 INSTANTIATE_TEST_SUITE_P(GemmTestSuite, GemmTests, ::testing::ValuesIn(devices),
                          ::DeviceNamePrint());
 
@@ -0,0 +1,184 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <iostream>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "cblas.h"
+#include "onemkl/detail/config.hpp"
+#include "onemkl/onemkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+// One operand packed once and multiplied by num_products different other
+// operands must give the results of gemm. Packed GEMM has no compile-time API,
+// so the compile-time build skips it.
+template <typename fp>
+int test(const device& dev, onemkl::pack_matrix which, onemkl::transpose transa,
+         onemkl::transpose transb, int m, int n, int k, int lda, int ldb, int ldc, fp alpha,
+         fp beta, int num_products) {
+    // Prepare data: A is packed and multiplied by every B, or B by every A.
+    int num_a = (which == onemkl::pack_matrix::a) ? 1 : num_products;
+    int num_b = (which == onemkl::pack_matrix::b) ? 1 : num_products;
+    vector<vector<fp>> A(num_a), B(num_b), C(num_products), C_ref;
+    for (int i = 0; i < num_a; i++)
+        rand_matrix(A[i], transa, m, k, lda);
+    for (int i = 0; i < num_b; i++)
+        rand_matrix(B[i], transb, k, n, ldb);
+    for (int i = 0; i < num_products; i++)
+        rand_matrix(C[i], onemkl::transpose::nontrans, m, n, ldc);
+    C_ref = C;
+
+    // Call Reference GEMM.
+    const int m_ref = m, n_ref = n, k_ref = k;
+    const int lda_ref = lda, ldb_ref = ldb, ldc_ref = ldc;
+
+    using fp_ref = typename ref_type_info<fp>::type;
+
+    for (int i = 0; i < num_products; i++) {
+        ::gemm(convert_to_cblas_trans(transa), convert_to_cblas_trans(transb), &m_ref, &n_ref,
+               &k_ref, (fp_ref*)&alpha, (fp_ref*)A[i % num_a].data(), &lda_ref,
+               (fp_ref*)B[i % num_b].data(), &ldb_ref, (fp_ref*)&beta, (fp_ref*)C_ref[i].data(),
+               &ldc_ref);
+    }
+
+    // Call DPC++ GEMM_PACK and GEMM_COMPUTE.
+
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during GEMM_PACK:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler);
+
+    {
+        vector<buffer<fp, 1>> A_buffer, B_buffer, C_buffer;
+        for (int i = 0; i < num_a; i++)
+            A_buffer.emplace_back(A[i].data(), range<1>(A[i].size()));
+        for (int i = 0; i < num_b; i++)
+            B_buffer.emplace_back(B[i].data(), range<1>(B[i].size()));
+        for (int i = 0; i < num_products; i++)
+            C_buffer.emplace_back(C[i].data(), range<1>(C[i].size()));
+
+        try {
+#ifdef CALL_RT_API
+            if (which == onemkl::pack_matrix::a) {
+                auto packed = onemkl::blas::gemm_pack(main_queue, which, transa, m, n, k, alpha,
+                                                      A_buffer[0], lda);
+                for (int i = 0; i < num_products; i++)
+                    onemkl::blas::gemm_compute(main_queue, packed, transb, B_buffer[i], ldb, beta,
+                                               C_buffer[i], ldc);
+            }
+            else {
+                auto packed = onemkl::blas::gemm_pack(main_queue, which, transb, m, n, k, alpha,
+                                                      B_buffer[0], ldb);
+                for (int i = 0; i < num_products; i++)
+                    onemkl::blas::gemm_compute(main_queue, transa, A_buffer[i], lda, packed, beta,
+                                               C_buffer[i], ldc);
+            }
+#else
+            return test_skipped;
+#endif
+        }
+        catch (exception const& e) {
+            std::cout << "Caught synchronous SYCL exception during GEMM_PACK:\n"
+                      << e.what() << std::endl
+                      << "OpenCL status: " << e.get_cl_code() << std::endl;
+        }
+
+        catch (const onemkl::backend_unsupported_exception& e) {
+            return test_skipped;
+        }
+
+        catch (const std::runtime_error& error) {
+            std::cout << "Error raised during execution of GEMM_PACK:\n"
+                      << error.what() << std::endl;
+        }
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+
+    bool good = true;
+    for (int i = 0; i < num_products; i++)
+        good = good && check_equal_matrix(C[i], C_ref[i], m, n, ldc, 10 * k, std::cout);
+
+    return (int)good;
+}
+
+class GemmPackTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(GemmPackTests, RealSinglePrecision) {
+    float alpha(2.0);
+    float beta(3.0);
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), onemkl::pack_matrix::a, onemkl::transpose::nontrans,
+                                  onemkl::transpose::nontrans, 79, 83, 91, 103, 105, 106, alpha,
+                                  beta, 3));
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), onemkl::pack_matrix::a, onemkl::transpose::trans,
+                                  onemkl::transpose::trans, 79, 83, 91, 103, 105, 106, alpha, beta,
+                                  3));
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), onemkl::pack_matrix::b, onemkl::transpose::nontrans,
+                                  onemkl::transpose::trans, 79, 83, 91, 103, 105, 106, alpha, beta,
+                                  3));
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), onemkl::pack_matrix::b, onemkl::transpose::trans,
+                                  onemkl::transpose::nontrans, 79, 83, 91, 103, 105, 106, alpha,
+                                  beta, 3));
+}
+
+TEST_P(GemmPackTests, RealDoublePrecision) {
+    double alpha(2.0);
+    double beta(3.0);
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), onemkl::pack_matrix::a,
+                                   onemkl::transpose::nontrans, onemkl::transpose::nontrans, 79, 83,
+                                   91, 103, 105, 106, alpha, beta, 3));
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), onemkl::pack_matrix::a, onemkl::transpose::trans,
+                                   onemkl::transpose::trans, 79, 83, 91, 103, 105, 106, alpha, beta,
+                                   3));
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), onemkl::pack_matrix::b,
+                                   onemkl::transpose::nontrans, onemkl::transpose::trans, 79, 83,
+                                   91, 103, 105, 106, alpha, beta, 3));
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), onemkl::pack_matrix::b, onemkl::transpose::trans,
+                                   onemkl::transpose::nontrans, 79, 83, 91, 103, 105, 106, alpha,
+                                   beta, 3));
+}
+
+INSTANTIATE_TEST_SUITE_P(GemmPackTestSuite, GemmPackTests, ::testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+} // anonymous namespace
@@ -0,0 +1,183 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <iostream>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "cblas.h"
+#include "onemkl/detail/config.hpp"
+#include "onemkl/onemkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+// One operand packed once and multiplied by num_products different other
+// operands must give the results of gemm. Packed GEMM has no compile-time API,
+// so the compile-time build skips it.
+template <typename fp>
+int test(const device& dev, onemkl::pack_matrix which, onemkl::transpose transa,
+         onemkl::transpose transb, int m, int n, int k, int lda, int ldb, int ldc, fp alpha,
+         fp beta, int num_products) {
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during GEMM_PACK:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler);
+    context cxt = main_queue.get_context();
+    std::vector<event> dependencies;
+
+    // Prepare data: A is packed and multiplied by every B, or B by every A.
+    auto ua = usm_allocator<fp, usm::alloc::shared, 64>(cxt, dev);
+    vector<vector<fp, decltype(ua)>> A, B, C, C_ref;
+    int num_a = (which == onemkl::pack_matrix::a) ? 1 : num_products;
+    int num_b = (which == onemkl::pack_matrix::b) ? 1 : num_products;
+    for (int i = 0; i < num_a; i++) {
+        A.emplace_back(ua);
+        rand_matrix(A.back(), transa, m, k, lda);
+    }
+    for (int i = 0; i < num_b; i++) {
+        B.emplace_back(ua);
+        rand_matrix(B.back(), transb, k, n, ldb);
+    }
+    for (int i = 0; i < num_products; i++) {
+        C.emplace_back(ua);
+        rand_matrix(C.back(), onemkl::transpose::nontrans, m, n, ldc);
+        C_ref.push_back(C.back());
+    }
+
+    // Call Reference GEMM.
+    const int m_ref = m, n_ref = n, k_ref = k;
+    const int lda_ref = lda, ldb_ref = ldb, ldc_ref = ldc;
+
+    using fp_ref = typename ref_type_info<fp>::type;
+
+    for (int i = 0; i < num_products; i++) {
+        ::gemm(convert_to_cblas_trans(transa), convert_to_cblas_trans(transb), &m_ref, &n_ref,
+               &k_ref, (fp_ref*)&alpha, (fp_ref*)A[i % num_a].data(), &lda_ref,
+               (fp_ref*)B[i % num_b].data(), &ldb_ref, (fp_ref*)&beta, (fp_ref*)C_ref[i].data(),
+               &ldc_ref);
+    }
+
+    // Call DPC++ GEMM_PACK and GEMM_COMPUTE.
+
+    try {
+#ifdef CALL_RT_API
+        if (which == onemkl::pack_matrix::a) {
+            auto packed = onemkl::blas::gemm_pack(main_queue, which, transa, m, n, k, alpha,
+                                                  A[0].data(), lda, dependencies);
+            for (int i = 0; i < num_products; i++)
+                onemkl::blas::gemm_compute(main_queue, packed, transb, B[i].data(), ldb, beta,
+                                           C[i].data(), ldc, dependencies);
+        }
+        else {
+            auto packed = onemkl::blas::gemm_pack(main_queue, which, transb, m, n, k, alpha,
+                                                  B[0].data(), ldb, dependencies);
+            for (int i = 0; i < num_products; i++)
+                onemkl::blas::gemm_compute(main_queue, transa, A[i].data(), lda, packed, beta,
+                                           C[i].data(), ldc, dependencies);
+        }
+        main_queue.wait();
+#else
+        return test_skipped;
+#endif
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during GEMM_PACK:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+
+    catch (const onemkl::backend_unsupported_exception& e) {
+        return test_skipped;
+    }
+
+    catch (const std::runtime_error& error) {
+        std::cout << "Error raised during execution of GEMM_PACK:\n" << error.what() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+
+    bool good = true;
+    for (int i = 0; i < num_products; i++)
+        good = good && check_equal_matrix(C[i], C_ref[i], m, n, ldc, 10 * k, std::cout);
+
+    return (int)good;
+}
+
+class GemmPackUsmTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(GemmPackUsmTests, RealSinglePrecision) {
+    float alpha(2.0);
+    float beta(3.0);
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), onemkl::pack_matrix::a, onemkl::transpose::nontrans,
+                                  onemkl::transpose::nontrans, 79, 83, 91, 103, 105, 106, alpha,
+                                  beta, 3));
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), onemkl::pack_matrix::a, onemkl::transpose::trans,
+                                  onemkl::transpose::trans, 79, 83, 91, 103, 105, 106, alpha, beta,
+                                  3));
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), onemkl::pack_matrix::b, onemkl::transpose::nontrans,
+                                  onemkl::transpose::trans, 79, 83, 91, 103, 105, 106, alpha, beta,
+                                  3));
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), onemkl::pack_matrix::b, onemkl::transpose::trans,
+                                  onemkl::transpose::nontrans, 79, 83, 91, 103, 105, 106, alpha,
+                                  beta, 3));
+}
+
+TEST_P(GemmPackUsmTests, RealDoublePrecision) {
+    double alpha(2.0);
+    double beta(3.0);
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), onemkl::pack_matrix::a,
+                                   onemkl::transpose::nontrans, onemkl::transpose::nontrans, 79, 83,
+                                   91, 103, 105, 106, alpha, beta, 3));
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), onemkl::pack_matrix::a, onemkl::transpose::trans,
+                                   onemkl::transpose::trans, 79, 83, 91, 103, 105, 106, alpha, beta,
+                                   3));
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), onemkl::pack_matrix::b,
+                                   onemkl::transpose::nontrans, onemkl::transpose::trans, 79, 83,
+                                   91, 103, 105, 106, alpha, beta, 3));
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), onemkl::pack_matrix::b, onemkl::transpose::trans,
+                                   onemkl::transpose::nontrans, 79, 83, 91, 103, 105, 106, alpha,
+                                   beta, 3));
+}
+
+INSTANTIATE_TEST_SUITE_P(GemmPackUsmTestSuite, GemmPackUsmTests, ::testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+} // anonymous namespace
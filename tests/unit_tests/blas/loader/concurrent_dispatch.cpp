@@ -0,0 +1,135 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <atomic>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "cblas.h"
+#include "onemkl/detail/config.hpp"
+#include "onemkl/onemkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+// Many host threads make their first run-time API call at the same time, each
+// on its own queue, racing on the loader's backend registry.
+template <typename fp>
+int test(const device &dev, int num_threads, int n) {
+    // Prepare data up front, rand() is not thread-safe.
+    vector<vector<fp>> x(num_threads), y(num_threads), y_ref(num_threads);
+    vector<fp> alpha(num_threads);
+    for (int tid = 0; tid < num_threads; tid++) {
+        alpha[tid] = rand_scalar<fp>();
+        rand_vector(x[tid], n, 1);
+        rand_vector(y[tid], n, 1);
+        y_ref[tid] = y[tid];
+        for (int i = 0; i < n; i++)
+            y_ref[tid][i] += alpha[tid] * x[tid][i];
+    }
+
+    std::atomic<int> ready(0);
+    std::atomic<int> failures(0);
+    std::atomic<int> skipped(0);
+
+    auto worker = [&](int tid) {
+        auto exception_handler = [](exception_list exceptions) {
+            for (std::exception_ptr const &e : exceptions) {
+                try {
+                    std::rethrow_exception(e);
+                }
+                catch (exception const &e) {
+                    std::cout << "Caught asynchronous SYCL exception during AXPY:\n"
+                              << e.what() << std::endl
+                              << "OpenCL status: " << e.get_cl_code() << std::endl;
+                }
+            }
+        };
+
+        queue main_queue(dev, exception_handler);
+
+        // Release all threads together so the first calls overlap.
+        ready++;
+        while (ready.load() < num_threads)
+            std::this_thread::yield();
+
+        try {
+            buffer<fp, 1> x_buffer(x[tid].data(), range<1>(x[tid].size()));
+            buffer<fp, 1> y_buffer(y[tid].data(), range<1>(y[tid].size()));
+            onemkl::blas::axpy(main_queue, n, alpha[tid], x_buffer, 1, y_buffer, 1);
+            main_queue.wait_and_throw();
+        }
+        catch (exception const &e) {
+            std::cout << "Caught synchronous SYCL exception during AXPY:\n"
+                      << e.what() << std::endl
+                      << "OpenCL status: " << e.get_cl_code() << std::endl;
+            failures++;
+            return;
+        }
+        catch (const onemkl::backend_unsupported_exception &e) {
+            skipped++;
+            return;
+        }
+        catch (const std::runtime_error &error) {
+            std::cout << "Error raised during execution of AXPY:\n" << error.what() << std::endl;
+            failures++;
+            return;
+        }
+
+        if (!check_equal_vector(y[tid], y_ref[tid], n, 1, n, std::cout))
+            failures++;
+    };
+
+    vector<std::thread> threads;
+    for (int tid = 0; tid < num_threads; tid++)
+        threads.emplace_back(worker, tid);
+    for (auto &t : threads)
+        t.join();
+
+    if (skipped.load() == num_threads)
+        return test_skipped;
+    return failures.load() == 0;
+}
+
+class ConcurrentDispatchTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(ConcurrentDispatchTests, RealSinglePrecision) {
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), 64, 1357));
+}
+
+TEST_P(ConcurrentDispatchTests, RealDoublePrecision) {
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), 96, 1357));
+}
+
+INSTANTIATE_TEST_SUITE_P(ConcurrentDispatchTestSuite, ConcurrentDispatchTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+} // anonymous namespace
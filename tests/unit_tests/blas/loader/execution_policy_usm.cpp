@@ -0,0 +1,142 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <iostream>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "cblas.h"
+#include "onemkl/detail/config.hpp"
+#include "onemkl/onemkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+// Calls on queues with a thread budget or a task arena, running at the same
+//  time, must give the same results as with the defaults.
+template <typename fp>
+int test(const device &dev, int n) {
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const &e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const &e) {
+                std::cout << "Caught asynchronous SYCL exception during EXECUTION_POLICY:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    const int num_queues = 3;
+    vector<queue> queues;
+    for (int q = 0; q < num_queues; q++)
+        queues.push_back(queue(dev, exception_handler));
+    context cxt = queues[0].get_context();
+
+    fp *a = (fp *)onemkl::malloc_shared(64, sizeof(fp) * n * n, dev, cxt);
+    fp *b = (fp *)onemkl::malloc_shared(64, sizeof(fp) * n * n, dev, cxt);
+    fp *c = (fp *)onemkl::malloc_shared(64, sizeof(fp) * n * n * num_queues, dev, cxt);
+    if ((a == NULL) || (b == NULL) || (c == NULL)) {
+        std::cout << "Error cannot allocate input arrays\n";
+        onemkl::free_shared(a, cxt);
+        onemkl::free_shared(b, cxt);
+        onemkl::free_shared(c, cxt);
+        return false;
+    }
+    for (int i = 0; i < n * n; i++) {
+        a[i] = rand_scalar<fp>();
+        b[i] = rand_scalar<fp>();
+    }
+
+    vector<fp> c_ref(n * n, fp(0));
+    for (int j = 0; j < n; j++)
+        for (int l = 0; l < n; l++)
+            for (int i = 0; i < n; i++)
+                c_ref[i + j * n] += a[i + l * n] * b[l + j * n];
+
+    try {
+        onemkl::blas::set_num_threads(queues[1], 1);
+        // An integer lvalue of another type is a concurrency, not an arena.
+        std::int64_t concurrency = 2;
+        onemkl::blas::set_task_arena(queues[2], concurrency);
+        vector<event> done;
+        for (int q = 0; q < num_queues; q++)
+            done.push_back(onemkl::blas::gemm(queues[q], onemkl::transpose::nontrans,
+                                              onemkl::transpose::nontrans, n, n, n, fp(1), a, n, b,
+                                              n, fp(0), c + q * n * n, n));
+        for (auto &e : done)
+            e.wait();
+        onemkl::blas::set_num_threads(queues[1], 0);
+        onemkl::blas::set_task_arena(queues[2], 0);
+    }
+    catch (exception const &e) {
+        std::cout << "Caught synchronous SYCL exception during EXECUTION_POLICY:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+    catch (const onemkl::backend_unsupported_exception &e) {
+        onemkl::free_shared(a, cxt);
+        onemkl::free_shared(b, cxt);
+        onemkl::free_shared(c, cxt);
+        return test_skipped;
+    }
+    catch (const std::runtime_error &error) {
+        std::cout << "Error raised during execution of EXECUTION_POLICY:\n"
+                  << error.what() << std::endl;
+    }
+
+    bool good = true;
+    for (int q = 0; q < num_queues; q++) {
+        fp *c_q = c + q * n * n;
+        good    = good && check_equal_vector(c_q, c_ref, n * n, 1, n, std::cout);
+    }
+
+    onemkl::free_shared(a, cxt);
+    onemkl::free_shared(b, cxt);
+    onemkl::free_shared(c, cxt);
+    return (int)good;
+}
+
+class ExecutionPolicyUsmTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(ExecutionPolicyUsmTests, RealSinglePrecision) {
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), 131));
+}
+
+TEST_P(ExecutionPolicyUsmTests, RealDoublePrecision) {
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), 131));
+}
+
+INSTANTIATE_TEST_SUITE_P(ExecutionPolicyUsmTestSuite, ExecutionPolicyUsmTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+} // anonymous namespace
@@ -0,0 +1,253 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <iostream>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "cblas.h"
+#include "onemkl/detail/config.hpp"
+#include "onemkl/onemkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+// A chain of dependent level 1 and level 2 calls inside a fused_scope must give
+// the same results as the calls made one by one, and the event of the last call
+// must cover its result before the scope ends.
+template <typename fp>
+int test(const device &dev, int n, bool with_dependency) {
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const &e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const &e) {
+                std::cout << "Caught asynchronous SYCL exception during FUSED_SCOPE:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    // In order, so that the calls stay ordered on backends that ignore the
+    //  scope without passing every event.
+    queue main_queue(dev, exception_handler, property::queue::in_order());
+    context cxt = main_queue.get_context();
+
+    fp *x      = (fp *)onemkl::malloc_shared(64, sizeof(fp) * n, dev, cxt);
+    fp *y      = (fp *)onemkl::malloc_shared(64, sizeof(fp) * n, dev, cxt);
+    fp *a      = (fp *)onemkl::malloc_shared(64, sizeof(fp) * n * n, dev, cxt);
+    fp *z      = (fp *)onemkl::malloc_shared(64, sizeof(fp) * n, dev, cxt);
+    fp *result = (fp *)onemkl::malloc_shared(64, sizeof(fp), dev, cxt);
+    if ((x == NULL) || (y == NULL) || (a == NULL) || (z == NULL) || (result == NULL)) {
+        std::cout << "Error cannot allocate input arrays\n";
+        onemkl::free_shared(x, cxt);
+        onemkl::free_shared(y, cxt);
+        onemkl::free_shared(a, cxt);
+        onemkl::free_shared(z, cxt);
+        onemkl::free_shared(result, cxt);
+        return false;
+    }
+
+    for (int i = 0; i < n; i++) {
+        x[i] = rand_scalar<fp>();
+        y[i] = rand_scalar<fp>();
+        z[i] = fp(0);
+    }
+    for (int i = 0; i < n * n; i++)
+        a[i] = rand_scalar<fp>();
+
+    // Reference: y = 2*x + y; x = 0.5*x; z = A*y; result = dot(x, z)
+    vector<fp> x_ref(x, x + n), y_ref(y, y + n), z_ref(n, fp(0));
+    for (int i = 0; i < n; i++)
+        y_ref[i] += fp(2) * x_ref[i];
+    for (int i = 0; i < n; i++)
+        x_ref[i] *= fp(0.5);
+    for (int j = 0; j < n; j++)
+        for (int i = 0; i < n; i++)
+            z_ref[i] += a[i + j * n] * y_ref[j];
+    fp result_ref = fp(0);
+    for (int i = 0; i < n; i++)
+        result_ref += x_ref[i] * z_ref[i];
+    fp result_in_scope = fp(0);
+
+    try {
+        onemkl::blas::fused_scope scope(main_queue);
+        auto done = onemkl::blas::axpy(main_queue, n, fp(2), x, 1, y, 1);
+        onemkl::blas::scal(main_queue, n, fp(0.5), x, 1);
+        vector<event> dependencies;
+        if (with_dependency)
+            dependencies.push_back(done);
+        onemkl::blas::gemv(main_queue, onemkl::transpose::nontrans, n, n, fp(1), a, n, y, 1, fp(0),
+                           z, 1, dependencies);
+        auto dot_done = onemkl::blas::dot(main_queue, n, x, 1, z, 1, result);
+        // The event of a call inside the scope completes once the call has run.
+        dot_done.wait();
+        result_in_scope = result[0];
+    }
+    catch (exception const &e) {
+        std::cout << "Caught synchronous SYCL exception during FUSED_SCOPE:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+    catch (const onemkl::backend_unsupported_exception &e) {
+        onemkl::free_shared(x, cxt);
+        onemkl::free_shared(y, cxt);
+        onemkl::free_shared(a, cxt);
+        onemkl::free_shared(z, cxt);
+        onemkl::free_shared(result, cxt);
+        return test_skipped;
+    }
+    catch (const std::runtime_error &error) {
+        std::cout << "Error raised during execution of FUSED_SCOPE:\n"
+                  << error.what() << std::endl;
+    }
+    main_queue.wait();
+
+    bool good = check_equal_vector(x, x_ref, n, 1, n, std::cout);
+    good      = good && check_equal_vector(y, y_ref, n, 1, n, std::cout);
+    good      = good && check_equal_vector(z, z_ref, n, 1, n, std::cout);
+    good      = good && check_equal(result[0], result_ref, n * n, std::cout);
+    good      = good && check_equal(result_in_scope, result_ref, n * n, std::cout);
+
+    onemkl::free_shared(x, cxt);
+    onemkl::free_shared(y, cxt);
+    onemkl::free_shared(a, cxt);
+    onemkl::free_shared(z, cxt);
+    onemkl::free_shared(result, cxt);
+    return (int)good;
+}
+
+// On an in-order queue, a routine that is not fused (gemm) between two fused
+// calls must see the result of the first and not that of the second.
+template <typename fp>
+int test_interleaved(const device &dev, int n) {
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const &e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const &e) {
+                std::cout << "Caught asynchronous SYCL exception during FUSED_SCOPE:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler, property::queue::in_order());
+    context cxt = main_queue.get_context();
+
+    fp *x = (fp *)onemkl::malloc_shared(64, sizeof(fp) * n, dev, cxt);
+    fp *y = (fp *)onemkl::malloc_shared(64, sizeof(fp) * n, dev, cxt);
+    fp *a = (fp *)onemkl::malloc_shared(64, sizeof(fp) * n * n, dev, cxt);
+    fp *c = (fp *)onemkl::malloc_shared(64, sizeof(fp) * n, dev, cxt);
+    if ((x == NULL) || (y == NULL) || (a == NULL) || (c == NULL)) {
+        std::cout << "Error cannot allocate input arrays\n";
+        onemkl::free_shared(x, cxt);
+        onemkl::free_shared(y, cxt);
+        onemkl::free_shared(a, cxt);
+        onemkl::free_shared(c, cxt);
+        return false;
+    }
+
+    for (int i = 0; i < n; i++) {
+        x[i] = rand_scalar<fp>();
+        y[i] = rand_scalar<fp>();
+        c[i] = fp(0);
+    }
+    for (int i = 0; i < n * n; i++)
+        a[i] = rand_scalar<fp>();
+
+    // Reference: y = 2*x + y; c = A*y; y = 0.5*y
+    vector<fp> y_ref(y, y + n), c_ref(n, fp(0));
+    for (int i = 0; i < n; i++)
+        y_ref[i] += fp(2) * x[i];
+    for (int j = 0; j < n; j++)
+        for (int i = 0; i < n; i++)
+            c_ref[i] += a[i + j * n] * y_ref[j];
+    for (int i = 0; i < n; i++)
+        y_ref[i] *= fp(0.5);
+
+    try {
+        onemkl::blas::fused_scope scope(main_queue);
+        onemkl::blas::axpy(main_queue, n, fp(2), x, 1, y, 1);
+        onemkl::blas::gemm(main_queue, onemkl::transpose::nontrans, onemkl::transpose::nontrans, n,
+                           1, n, fp(1), a, n, y, n, fp(0), c, n);
+        onemkl::blas::scal(main_queue, n, fp(0.5), y, 1);
+    }
+    catch (exception const &e) {
+        std::cout << "Caught synchronous SYCL exception during FUSED_SCOPE:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+    catch (const onemkl::backend_unsupported_exception &e) {
+        onemkl::free_shared(x, cxt);
+        onemkl::free_shared(y, cxt);
+        onemkl::free_shared(a, cxt);
+        onemkl::free_shared(c, cxt);
+        return test_skipped;
+    }
+    catch (const std::runtime_error &error) {
+        std::cout << "Error raised during execution of FUSED_SCOPE:\n"
+                  << error.what() << std::endl;
+    }
+    main_queue.wait();
+
+    bool good = check_equal_vector(c, c_ref, n, 1, n, std::cout);
+    good      = good && check_equal_vector(y, y_ref, n, 1, n, std::cout);
+
+    onemkl::free_shared(x, cxt);
+    onemkl::free_shared(y, cxt);
+    onemkl::free_shared(a, cxt);
+    onemkl::free_shared(c, cxt);
+    return (int)good;
+}
+
+class FusedScopeUsmTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(FusedScopeUsmTests, RealSinglePrecision) {
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), 57, false));
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), 57, true));
+    EXPECT_TRUEORSKIP(test_interleaved<float>(GetParam(), 57));
+}
+
+TEST_P(FusedScopeUsmTests, RealDoublePrecision) {
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), 57, false));
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), 57, true));
+    EXPECT_TRUEORSKIP(test_interleaved<double>(GetParam(), 57));
+}
+
+INSTANTIATE_TEST_SUITE_P(FusedScopeUsmTestSuite, FusedScopeUsmTests, ::testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+} // anonymous namespace
@@ -0,0 +1,163 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "cblas.h"
+#include "onemkl/detail/config.hpp"
+#include "onemkl/onemkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+static void set_inline_threshold(const char *threshold) {
+#ifdef _WIN64
+    _putenv_s("ONEMKL_MKLCPU_INLINE_THRESHOLD", threshold ? threshold : "");
+#else
+    if (threshold)
+        setenv("ONEMKL_MKLCPU_INLINE_THRESHOLD", threshold, 1);
+    else
+        unsetenv("ONEMKL_MKLCPU_INLINE_THRESHOLD");
+#endif
+}
+
+static bool complete(const event &e) {
+    return e.get_info<info::event::command_execution_status>() ==
+           info::event_command_status::complete;
+}
+
+// With ONEMKL_MKLCPU_INLINE_THRESHOLD set, small level 1 calls on a CPU queue
+// run on the calling thread: they must give the same results as submitted
+// calls, and return an event that is already complete.
+template <typename fp>
+int test(const device &dev, int n) {
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const &e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const &e) {
+                std::cout << "Caught asynchronous SYCL exception during INLINE:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    // The threshold is read when the queue is first used.
+    set_inline_threshold("4096");
+    queue main_queue(dev, exception_handler);
+    context cxt = main_queue.get_context();
+
+    fp *x      = (fp *)onemkl::malloc_shared(64, sizeof(fp) * n, dev, cxt);
+    fp *y      = (fp *)onemkl::malloc_shared(64, sizeof(fp) * n, dev, cxt);
+    fp *result = (fp *)onemkl::malloc_shared(64, sizeof(fp), dev, cxt);
+    if ((x == NULL) || (y == NULL) || (result == NULL)) {
+        std::cout << "Error cannot allocate input arrays\n";
+        onemkl::free_shared(x, cxt);
+        onemkl::free_shared(y, cxt);
+        onemkl::free_shared(result, cxt);
+        set_inline_threshold(nullptr);
+        return false;
+    }
+
+    for (int i = 0; i < n; i++) {
+        x[i] = rand_scalar<fp>();
+        y[i] = rand_scalar<fp>();
+    }
+
+    // Reference: y = 2*x + y; x = 0.5*x; result = dot(x, y)
+    vector<fp> x_ref(x, x + n), y_ref(y, y + n);
+    for (int i = 0; i < n; i++)
+        y_ref[i] += fp(2) * x_ref[i];
+    for (int i = 0; i < n; i++)
+        x_ref[i] *= fp(0.5);
+    fp result_ref = fp(0);
+    for (int i = 0; i < n; i++)
+        result_ref += x_ref[i] * y_ref[i];
+
+    bool inlined = true;
+    try {
+        auto axpy_done = onemkl::blas::axpy(main_queue, n, fp(2), x, 1, y, 1);
+        auto scal_done = onemkl::blas::scal(main_queue, n, fp(0.5), x, 1, { axpy_done });
+        auto dot_done =
+            onemkl::blas::dot(main_queue, n, x, 1, y, 1, result, { axpy_done, scal_done });
+        inlined = complete(axpy_done) && complete(scal_done) && complete(dot_done);
+    }
+    catch (exception const &e) {
+        std::cout << "Caught synchronous SYCL exception during INLINE:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+    catch (const onemkl::backend_unsupported_exception &e) {
+        onemkl::free_shared(x, cxt);
+        onemkl::free_shared(y, cxt);
+        onemkl::free_shared(result, cxt);
+        set_inline_threshold(nullptr);
+        return test_skipped;
+    }
+    catch (const std::runtime_error &error) {
+        std::cout << "Error raised during execution of INLINE:\n" << error.what() << std::endl;
+    }
+    main_queue.wait();
+    set_inline_threshold(nullptr);
+
+    bool good = check_equal_vector(x, x_ref, n, 1, n, std::cout);
+    good      = good && check_equal_vector(y, y_ref, n, 1, n, std::cout);
+    good      = good && check_equal(result[0], result_ref, n, std::cout);
+    // Only the mklcpu backend runs calls inline.
+    if ((dev.is_host() || dev.is_cpu()) && !inlined) {
+        std::cout << "Small calls on a CPU queue did not run inline\n";
+        good = false;
+    }
+
+    onemkl::free_shared(x, cxt);
+    onemkl::free_shared(y, cxt);
+    onemkl::free_shared(result, cxt);
+    return (int)good;
+}
+
+class InlineUsmTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(InlineUsmTests, RealSinglePrecision) {
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), 100));
+}
+
+TEST_P(InlineUsmTests, RealDoublePrecision) {
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), 100));
+}
+
+INSTANTIATE_TEST_SUITE_P(InlineUsmTestSuite, InlineUsmTests, ::testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+} // anonymous namespace
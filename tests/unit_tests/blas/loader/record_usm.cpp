@@ -0,0 +1,172 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "onemkl/detail/config.hpp"
+#include "onemkl/onemkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+template <typename fp>
+const char *prefix();
+template <>
+const char *prefix<float>() {
+    return "s";
+}
+template <>
+const char *prefix<double>() {
+    return "d";
+}
+
+// Calls made while recording must be loaded back in order with their
+// arguments, calls made after the recording stops must not; every loaded call
+// must replay on the queue.
+template <typename fp>
+int test(const device &dev, int m, int n, int k) {
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const &e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const &e) {
+                std::cout << "Caught asynchronous SYCL exception during RECORD:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler);
+    context cxt = main_queue.get_context();
+
+    fp *a = (fp *)onemkl::malloc_shared(64, sizeof(fp) * m * k, dev, cxt);
+    fp *b = (fp *)onemkl::malloc_shared(64, sizeof(fp) * k * n, dev, cxt);
+    fp *c = (fp *)onemkl::malloc_shared(64, sizeof(fp) * m * n, dev, cxt);
+    if ((a == NULL) || (b == NULL) || (c == NULL)) {
+        std::cout << "Error cannot allocate input arrays\n";
+        onemkl::free_shared(a, cxt);
+        onemkl::free_shared(b, cxt);
+        onemkl::free_shared(c, cxt);
+        return false;
+    }
+    for (int i = 0; i < m * k; i++)
+        a[i] = rand_scalar<fp>();
+    for (int i = 0; i < k * n; i++)
+        b[i] = rand_scalar<fp>();
+    for (int i = 0; i < m * n; i++)
+        c[i] = fp(0);
+
+    std::string path = std::string("onemkl_blas_record_") + prefix<fp>() + ".bin";
+    std::vector<onemkl::blas::recorded_call> calls;
+    bool replayed = true;
+    try {
+        onemkl::blas::record_start(path);
+        onemkl::blas::gemm(main_queue, onemkl::transpose::nontrans, onemkl::transpose::trans, m,
+                           n, k, fp(1), a, m, b, n, fp(0), c, m);
+        onemkl::blas::axpy(main_queue, m * k, fp(2), a, 1, c, 1);
+        main_queue.wait();
+        onemkl::blas::record_stop();
+        onemkl::blas::scal(main_queue, m * n, fp(0.5), c, 1);
+        main_queue.wait();
+
+        calls = onemkl::blas::record_load(path);
+        for (auto &call : calls) {
+            onemkl::blas::replay_prepare(main_queue, call);
+            onemkl::blas::replay_run(main_queue, call);
+            onemkl::blas::replay_release(call);
+        }
+    }
+    catch (exception const &e) {
+        std::cout << "Caught synchronous SYCL exception during RECORD:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+        replayed = false;
+    }
+    catch (const onemkl::backend_unsupported_exception &e) {
+        onemkl::blas::record_stop();
+        std::remove(path.c_str());
+        onemkl::free_shared(a, cxt);
+        onemkl::free_shared(b, cxt);
+        onemkl::free_shared(c, cxt);
+        return test_skipped;
+    }
+    catch (const std::runtime_error &error) {
+        std::cout << "Error raised during execution of RECORD:\n" << error.what() << std::endl;
+        replayed = false;
+    }
+
+    onemkl::free_shared(a, cxt);
+    onemkl::free_shared(b, cxt);
+    onemkl::free_shared(c, cxt);
+    std::remove(path.c_str());
+
+    // Operands are recorded with extents bounded by ld * max(m, n, k).
+    std::string p  = prefix<fp>();
+    int d          = std::max(m, std::max(n, k));
+    std::string mk = std::to_string(m * k);
+
+    std::string gemm_arguments = "N, T, " + std::to_string(m) + ", " + std::to_string(n) + ", " +
+                                 std::to_string(k) + ", 1, [" + std::to_string(m * d) + "], " +
+                                 std::to_string(m) + ", [" + std::to_string(n * d) + "], " +
+                                 std::to_string(n) + ", 0, [" + std::to_string(m * d) + "], " +
+                                 std::to_string(m);
+    bool good = replayed && calls.size() == 2 && calls[0].name == p + "gemm_usm" &&
+                calls[0].replayable && calls[0].arguments == gemm_arguments &&
+                calls[1].name == p + "axpy_usm" && calls[1].replayable &&
+                calls[1].arguments == mk + ", 2, [" + mk + "], 1, [" + mk + "], 1";
+    if (!good) {
+        std::cout << "Unexpected recording:\n";
+        for (const auto &call : calls)
+            std::cout << call.name << "(" << call.arguments << ")\n";
+    }
+
+    return (int)good;
+}
+
+class RecordUsmTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(RecordUsmTests, RealSinglePrecision) {
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), 7, 11, 13));
+}
+
+TEST_P(RecordUsmTests, RealDoublePrecision) {
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), 7, 11, 13));
+}
+
+INSTANTIATE_TEST_SUITE_P(RecordUsmTestSuite, RecordUsmTests, ::testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+} // anonymous namespace
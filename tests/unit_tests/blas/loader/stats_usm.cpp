@@ -0,0 +1,202 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "onemkl/detail/config.hpp"
+#include "onemkl/onemkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+template <typename fp>
+const char *prefix();
+template <>
+const char *prefix<float>() {
+    return "s";
+}
+template <>
+const char *prefix<double>() {
+    return "d";
+}
+
+const onemkl::blas::routine_stats *find(const onemkl::blas::stats_report &report,
+                                        const std::string &name) {
+    for (const auto &r : report.routines) {
+        if (r.name == name)
+            return &r;
+    }
+    return nullptr;
+}
+
+// Calls made while statistics are on must be counted with their flops and
+// bytes, calls made after they are turned off must not; the dump must list
+// the counted routines.
+template <typename fp>
+int test(const device &dev, int m, int n, int k) {
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const &e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const &e) {
+                std::cout << "Caught asynchronous SYCL exception during STATS:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler);
+    context cxt = main_queue.get_context();
+
+    fp *a = (fp *)onemkl::malloc_shared(64, sizeof(fp) * m * k, dev, cxt);
+    fp *b = (fp *)onemkl::malloc_shared(64, sizeof(fp) * k * n, dev, cxt);
+    fp *c = (fp *)onemkl::malloc_shared(64, sizeof(fp) * m * n, dev, cxt);
+    // A group gemm_batch of two problems, into c_batch.
+    fp *c_batch = (fp *)onemkl::malloc_shared(64, sizeof(fp) * 2 * m * n, dev, cxt);
+    fp *scalars = (fp *)onemkl::malloc_shared(64, sizeof(fp) * 2, dev, cxt);
+    fp **ptrs   = (fp **)onemkl::malloc_shared(64, sizeof(fp *) * 6, dev, cxt);
+    std::int64_t *dims =
+        (std::int64_t *)onemkl::malloc_shared(64, sizeof(std::int64_t) * 7, dev, cxt);
+    onemkl::transpose *trans =
+        (onemkl::transpose *)onemkl::malloc_shared(64, sizeof(onemkl::transpose) * 2, dev, cxt);
+    auto free_all = [&]() {
+        onemkl::free_shared(a, cxt);
+        onemkl::free_shared(b, cxt);
+        onemkl::free_shared(c, cxt);
+        onemkl::free_shared(c_batch, cxt);
+        onemkl::free_shared(scalars, cxt);
+        onemkl::free_shared(ptrs, cxt);
+        onemkl::free_shared(dims, cxt);
+        onemkl::free_shared(trans, cxt);
+    };
+    if ((a == NULL) || (b == NULL) || (c == NULL) || (c_batch == NULL) || (scalars == NULL) ||
+        (ptrs == NULL) || (dims == NULL) || (trans == NULL)) {
+        std::cout << "Error cannot allocate input arrays\n";
+        free_all();
+        return false;
+    }
+    for (int i = 0; i < m * k; i++)
+        a[i] = rand_scalar<fp>();
+    for (int i = 0; i < k * n; i++)
+        b[i] = rand_scalar<fp>();
+    for (int i = 0; i < m * n; i++)
+        c[i] = fp(0);
+    // m, n, k, lda, ldb, ldc, group_size
+    std::int64_t batch_dims[] = { m, n, k, m, k, m, 2 };
+    std::copy(batch_dims, batch_dims + 7, dims);
+    trans[0]         = onemkl::transpose::nontrans;
+    trans[1]         = onemkl::transpose::nontrans;
+    scalars[0]       = fp(1);
+    scalars[1]       = fp(0);
+    fp *batch_ptrs[] = { a, a, b, b, c_batch, c_batch + m * n };
+    std::copy(batch_ptrs, batch_ptrs + 6, ptrs);
+
+    std::string path = std::string("onemkl_blas_stats_") + prefix<fp>() + ".json";
+    onemkl::blas::stats_report report;
+    try {
+        onemkl::blas::stats_enable();
+        onemkl::blas::stats_reset();
+        onemkl::blas::gemm(main_queue, onemkl::transpose::nontrans, onemkl::transpose::nontrans, m,
+                           n, k, fp(1), a, m, b, k, fp(0), c, m);
+        onemkl::blas::axpy(main_queue, m * k, fp(2), a, 1, c, 1);
+        onemkl::blas::axpy(main_queue, m * k, fp(2), a, 1, c, 1);
+        onemkl::blas::gemm_batch(main_queue, trans, trans + 1, dims, dims + 1, dims + 2, scalars,
+                                 (const fp **)ptrs, dims + 3, (const fp **)ptrs + 2, dims + 4,
+                                 scalars + 1, ptrs + 4, dims + 5, 1, dims + 6);
+        main_queue.wait();
+        onemkl::blas::stats_enable(false);
+        onemkl::blas::scal(main_queue, m * n, fp(0.5), c, 1);
+        main_queue.wait();
+        report = onemkl::blas::stats();
+        onemkl::blas::stats_dump(path);
+    }
+    catch (exception const &e) {
+        std::cout << "Caught synchronous SYCL exception during STATS:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+    catch (const onemkl::backend_unsupported_exception &e) {
+        onemkl::blas::stats_enable(false);
+        free_all();
+        return test_skipped;
+    }
+    catch (const std::runtime_error &error) {
+        std::cout << "Error raised during execution of STATS:\n" << error.what() << std::endl;
+    }
+
+    free_all();
+
+    std::ifstream in(path);
+    std::stringstream contents;
+    contents << in.rdbuf();
+    std::string dump = contents.str();
+    std::remove(path.c_str());
+
+    std::string p                            = prefix<fp>();
+    const onemkl::blas::routine_stats *gemm  = find(report, p + "gemm_usm");
+    const onemkl::blas::routine_stats *axpy  = find(report, p + "axpy_usm");
+    const onemkl::blas::routine_stats *scal  = find(report, p + "scal_usm");
+    const onemkl::blas::routine_stats *batch = find(report, p + "gemm_batch_group_usm");
+
+    bool good = gemm && axpy && gemm->routine == "gemm" && gemm->precision == p && gemm->usm &&
+                gemm->calls == 1 && gemm->flops == 2ull * m * n * k &&
+                gemm->bytes == sizeof(fp) * (m * k + k * n + m * n) && axpy->calls == 2 &&
+                axpy->flops == 2ull * 2 * m * k && (!scal || scal->calls == 0) && batch &&
+                batch->flops == 2 * 2ull * m * n * k &&
+                batch->bytes == 2 * sizeof(fp) * (m * k + k * n + m * n) &&
+                dump.find("\"name\": \"" + p + "gemm_usm\"") != std::string::npos;
+    if (!good)
+        std::cout << "Unexpected statistics:\n" << dump << std::endl;
+
+    return (int)good;
+}
+
+class StatsUsmTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(StatsUsmTests, RealSinglePrecision) {
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), 7, 11, 13));
+}
+
+TEST_P(StatsUsmTests, RealDoublePrecision) {
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), 7, 11, 13));
+}
+
+INSTANTIATE_TEST_SUITE_P(StatsUsmTestSuite, StatsUsmTests, ::testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+} // anonymous namespace
@@ -0,0 +1,268 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "onemkl/detail/config.hpp"
+#include "onemkl/onemkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+template <typename fp>
+const char *prefix();
+template <>
+const char *prefix<float>() {
+    return "s";
+}
+template <>
+const char *prefix<double>() {
+    return "d";
+}
+
+static void set_trace_limit(const char *limit) {
+#ifdef _WIN64
+    _putenv_s("ONEMKL_BLAS_TRACE_LIMIT", limit ? limit : "");
+#else
+    if (limit)
+        setenv("ONEMKL_BLAS_TRACE_LIMIT", limit, 1);
+    else
+        unsetenv("ONEMKL_BLAS_TRACE_LIMIT");
+#endif
+}
+
+// Calls made between trace_start and trace_stop must appear in the trace with
+// their routine, precision and integer arguments; calls made after trace_stop
+// must not.
+template <typename fp>
+int test(const device &dev, int m, int n, int k) {
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const &e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const &e) {
+                std::cout << "Caught asynchronous SYCL exception during TRACE:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler, { property::queue::enable_profiling() });
+    context cxt = main_queue.get_context();
+
+    fp *a = (fp *)onemkl::malloc_shared(64, sizeof(fp) * m * k, dev, cxt);
+    fp *b = (fp *)onemkl::malloc_shared(64, sizeof(fp) * k * n, dev, cxt);
+    fp *c = (fp *)onemkl::malloc_shared(64, sizeof(fp) * m * n, dev, cxt);
+    if ((a == NULL) || (b == NULL) || (c == NULL)) {
+        std::cout << "Error cannot allocate input arrays\n";
+        onemkl::free_shared(a, cxt);
+        onemkl::free_shared(b, cxt);
+        onemkl::free_shared(c, cxt);
+        return false;
+    }
+    for (int i = 0; i < m * k; i++)
+        a[i] = rand_scalar<fp>();
+    for (int i = 0; i < k * n; i++)
+        b[i] = rand_scalar<fp>();
+    for (int i = 0; i < m * n; i++)
+        c[i] = fp(0);
+
+    std::string path = std::string("onemkl_blas_trace_") + prefix<fp>() + ".json";
+    try {
+        onemkl::blas::trace_start(path);
+        onemkl::blas::gemm(main_queue, onemkl::transpose::nontrans, onemkl::transpose::nontrans, m,
+                           n, k, fp(1), a, m, b, k, fp(0), c, m);
+        onemkl::blas::axpy(main_queue, m * k, fp(2), a, 1, c, 1);
+        main_queue.wait();
+        onemkl::blas::trace_stop();
+        onemkl::blas::scal(main_queue, m * n, fp(0.5), c, 1);
+        main_queue.wait();
+    }
+    catch (exception const &e) {
+        std::cout << "Caught synchronous SYCL exception during TRACE:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+    catch (const onemkl::backend_unsupported_exception &e) {
+        onemkl::blas::trace_stop();
+        std::remove(path.c_str());
+        onemkl::free_shared(a, cxt);
+        onemkl::free_shared(b, cxt);
+        onemkl::free_shared(c, cxt);
+        return test_skipped;
+    }
+    catch (const std::runtime_error &error) {
+        std::cout << "Error raised during execution of TRACE:\n" << error.what() << std::endl;
+    }
+
+    onemkl::free_shared(a, cxt);
+    onemkl::free_shared(b, cxt);
+    onemkl::free_shared(c, cxt);
+
+    std::ifstream in(path);
+    std::stringstream contents;
+    contents << in.rdbuf();
+    std::string trace = contents.str();
+    std::remove(path.c_str());
+
+    std::string p = prefix<fp>();
+    std::ostringstream gemm_dims, axpy_dims;
+    gemm_dims << "\"dims\": [" << m << ", " << n << ", " << k << ", " << m << ", " << k << ", "
+              << m << "]";
+    axpy_dims << "\"dims\": [" << m * k << ", 1, 1]";
+
+    bool good = trace.find("\"traceEvents\"") != std::string::npos &&
+                trace.find("\"name\": \"" + p + "gemm_usm\"") != std::string::npos &&
+                trace.find("\"name\": \"" + p + "axpy_usm\"") != std::string::npos &&
+                trace.find("\"precision\": \"" + p + "\"") != std::string::npos &&
+                trace.find(gemm_dims.str()) != std::string::npos &&
+                trace.find(axpy_dims.str()) != std::string::npos &&
+                trace.find("scal_usm\"") == std::string::npos;
+    if (!good)
+        std::cout << "Unexpected trace:\n" << trace << std::endl;
+
+    return (int)good;
+}
+
+// With ONEMKL_BLAS_TRACE_LIMIT=2, a thread making three calls keeps only the
+// last two in the trace.
+template <typename fp>
+int test_limit(const device &dev, int n) {
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const &e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const &e) {
+                std::cout << "Caught asynchronous SYCL exception during TRACE:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler);
+    context cxt = main_queue.get_context();
+
+    fp *x = (fp *)onemkl::malloc_shared(64, sizeof(fp) * n, dev, cxt);
+    fp *y = (fp *)onemkl::malloc_shared(64, sizeof(fp) * n, dev, cxt);
+    if ((x == NULL) || (y == NULL)) {
+        std::cout << "Error cannot allocate input arrays\n";
+        onemkl::free_shared(x, cxt);
+        onemkl::free_shared(y, cxt);
+        return false;
+    }
+    for (int i = 0; i < n; i++) {
+        x[i] = rand_scalar<fp>();
+        y[i] = rand_scalar<fp>();
+    }
+
+    std::string path = std::string("onemkl_blas_trace_limit_") + prefix<fp>() + ".json";
+    set_trace_limit("2");
+    try {
+        onemkl::blas::trace_start(path);
+        onemkl::blas::copy(main_queue, n, x, 1, y, 1);
+        main_queue.wait();
+        onemkl::blas::axpy(main_queue, n, fp(2), x, 1, y, 1);
+        main_queue.wait();
+        onemkl::blas::scal(main_queue, n, fp(0.5), y, 1);
+        main_queue.wait();
+        onemkl::blas::trace_stop();
+    }
+    catch (exception const &e) {
+        std::cout << "Caught synchronous SYCL exception during TRACE:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+    catch (const onemkl::backend_unsupported_exception &e) {
+        onemkl::blas::trace_stop();
+        set_trace_limit(nullptr);
+        std::remove(path.c_str());
+        onemkl::free_shared(x, cxt);
+        onemkl::free_shared(y, cxt);
+        return test_skipped;
+    }
+    catch (const std::runtime_error &error) {
+        std::cout << "Error raised during execution of TRACE:\n" << error.what() << std::endl;
+    }
+    set_trace_limit(nullptr);
+
+    onemkl::free_shared(x, cxt);
+    onemkl::free_shared(y, cxt);
+
+    std::ifstream in(path);
+    std::stringstream contents;
+    contents << in.rdbuf();
+    std::string trace = contents.str();
+    std::remove(path.c_str());
+
+    std::string p = prefix<fp>();
+
+    bool good = trace.find("\"traceEvents\"") != std::string::npos &&
+                trace.find("\"name\": \"" + p + "copy_usm\"") == std::string::npos &&
+                trace.find("\"name\": \"" + p + "axpy_usm\"") != std::string::npos &&
+                trace.find("\"name\": \"" + p + "scal_usm\"") != std::string::npos;
+    if (!good)
+        std::cout << "Unexpected trace:\n" << trace << std::endl;
+
+    return (int)good;
+}
+
+class TraceUsmTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(TraceUsmTests, RealSinglePrecision) {
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), 7, 11, 13));
+}
+
+TEST_P(TraceUsmTests, RealDoublePrecision) {
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), 7, 11, 13));
+}
+
+TEST_P(TraceUsmTests, RealSinglePrecisionLimit) {
+    EXPECT_TRUEORSKIP(test_limit<float>(GetParam(), 17));
+}
+
+TEST_P(TraceUsmTests, RealDoublePrecisionLimit) {
+    EXPECT_TRUEORSKIP(test_limit<double>(GetParam(), 17));
+}
+
+INSTANTIATE_TEST_SUITE_P(TraceUsmTestSuite, TraceUsmTests, ::testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+} // anonymous namespace